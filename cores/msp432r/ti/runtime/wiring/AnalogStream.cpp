@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+#include "AnalogStream.h"
+#include "wiring_private.h"
+
+#include <ti/drivers/Power.h>
+#include <ti/drivers/power/PowerMSP432.h>
+#include <ti/drivers/adcbuf/ADCBufMSP432.h>
+#include <ti/drivers/timer/TimerMSP432.h>
+
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+#include <driverlib/rom.h>
+#include <driverlib/rom_map.h>
+#include <driverlib/adc14.h>
+#include <driverlib/timer_a.h>
+
+extern const ADCBuf_Config ADCBuf_config[];
+
+/* the boards' only ADCBuf_config[] entry, Board_ADCBUF0 */
+#define ADCBUF_INDEX 0
+
+static bool adcbufInitialized = false;
+
+AnalogStream::AnalogStream(void)
+{
+    handle = NULL;
+    channelCount = 0;
+    blockSamples = 0;
+    blockFxn = NULL;
+    blockArg = NULL;
+    lastBlock = NULL;
+    pending = false;
+    overrunCount = 0;
+    stopping = false;
+}
+
+/*
+ *  ======== begin ========
+ *  Starts sampling count pins at rate sets per second into buffer,
+ *  2 * count * samples values. Returns false if a pin has no ADC
+ *  channel, the rate does not fit the trigger timer or the ADC, or the
+ *  timer, ADCBuf or the ADC (analogWatch()) is taken.
+ */
+bool AnalogStream::begin(const uint8_t *pins, uint8_t count, uint32_t rate,
+    uint16_t *buffer, uint16_t samples)
+{
+    ADCBufMSP432_HWAttrs const *hwAttrs;
+    ADCBufMSP432_Channels saved[ANALOG_STREAM_MAX_CHANNELS];
+    ADCBufMSP432_ParamsExtension extension;
+    PowerMSP432_Freqs freqs;
+    Semaphore_Params semParams;
+    ADCBuf_Params params;
+    uint32_t period;
+    UInt key;
+    uint8_t i;
+
+    end();
+
+    if (count == 0 || count > ANALOG_STREAM_MAX_CHANNELS || rate == 0 ||
+        rate * count > ANALOG_STREAM_MAX_CONVERSIONS || buffer == NULL ||
+        samples == 0) {
+        return (false);
+    }
+
+    /* the driver loads SMCLK / (rate * count) into the 16 bit CCR0 */
+    PowerMSP432_getFreqs(Power_getPerformanceLevel(), &freqs);
+    period = freqs.SMCLK / (rate * count);
+    if (period < 2 || period > 0xffff) {
+        return (false);
+    }
+
+    for (i = 0; i < count; i++) {
+        if (digital_pin_to_adc_index[pins[i]] == NOT_ON_ADC) {
+            return (false);
+        }
+    }
+
+    /* analogWatch() keeps conversions enabled */
+    if (ADC14->CTL0 & ADC14_CTL0_ENC) {
+        return (false);
+    }
+
+    /*
+     * ADCBufMSP432_open() leaves the object marked open when it cannot
+     * get its timer, so make sure it can first.
+     */
+    hwAttrs = (ADCBufMSP432_HWAttrs const *)ADCBuf_config[ADCBUF_INDEX].hwAttrs;
+    timerBase = TIMER_A0_BASE + (hwAttrs->adcTimerTriggerSource >> 1) * 0x400;
+    if (!TimerMSP432_allocateTimerResource(timerBase)) {
+        return (false);
+    }
+    TimerMSP432_freeTimerResource(timerBase);
+
+    if (adcbufInitialized == false) {
+        ADCBuf_init();
+        adcbufInitialized = true;
+    }
+
+    ADCBuf_Params_init(&params);
+    params.returnMode = ADCBuf_RETURN_MODE_CALLBACK;
+    params.recurrenceMode = ADCBuf_RECURRENCE_MODE_CONTINUOUS;
+    params.callbackFxn = adcbufFxn;
+    params.samplingFrequency = rate * count;
+    /* analogRead()'s sample time */
+    extension.samplingDuration = ADCBufMSP432_SAMPLING_DURATION_PULSE_WIDTH_64;
+    params.custom = &extension;
+
+    handle = ADCBuf_open(ADCBUF_INDEX, &params);
+    if (handle == NULL) {
+        return (false);
+    }
+
+    for (i = 0; i < count; i++) {
+        /* undo pin's current plumbing */
+        switch (digital_pin_to_pin_function[pins[i]]) {
+            case PIN_FUNC_ANALOG_OUTPUT:
+                stopAnalogWrite(pins[i]);
+                break;
+            case PIN_FUNC_DIGITAL_INPUT:
+                stopDigitalRead(pins[i]);
+                break;
+            case PIN_FUNC_DIGITAL_OUTPUT:
+                stopDigitalWrite(pins[i]);
+                break;
+        }
+        if (digital_pin_to_pin_function[pins[i]] != PIN_FUNC_ANALOG_INPUT) {
+            digital_pin_to_pin_function[pins[i]] = PIN_FUNC_UNUSED;
+        }
+
+        conversions[i].samplesRequestedCount = samples;
+        conversions[i].sampleBuffer = buffer + i * samples;
+        conversions[i].sampleBufferTwo = buffer + (count + i) * samples;
+        conversions[i].arg = this;
+        conversions[i].adcChannel = digital_pin_to_adc_index[pins[i]];
+    }
+
+    channelCount = count;
+    blockSamples = samples;
+    lastBlock = NULL;
+    pending = false;
+    overrunCount = 0;
+    stopping = false;
+
+    Semaphore_Params_init(&semParams);
+    semParams.mode = Semaphore_Mode_BINARY;
+    Semaphore_construct(&readySem, 0, &semParams);
+
+    /*
+     * The driver sets up the GPIOs of channelSetting[0..count-1], not
+     * those of the channels converted: point these entries at our pins
+     * for the duration of the call.
+     */
+    for (i = 0; i < count; i++) {
+        saved[i] = hwAttrs->channelSetting[i];
+    }
+    for (i = 0; i < count; i++) {
+        uint32_t channel = conversions[i].adcChannel;
+
+        hwAttrs->channelSetting[i].adcPin = channel < count ?
+            saved[channel].adcPin : hwAttrs->channelSetting[channel].adcPin;
+    }
+
+    ADCBuf_convert(handle, conversions, count);
+
+    for (i = 0; i < count; i++) {
+        hwAttrs->channelSetting[i] = saved[i];
+    }
+
+    /*
+     * The driver starts ADC14 with multiple sample-and-convert set:
+     * after the first trigger a repeated sequence runs back to back and
+     * ignores the timer. Switch to one conversion per trigger; the
+     * timer's first edge is a full period after its start.
+     */
+    key = Hwi_disable();
+    MAP_Timer_A_stopTimer(timerBase);
+    MAP_ADC14_disableConversion();
+    while (MAP_ADC14_isBusy()) {
+        ;
+    }
+    MAP_ADC14_enableSampleTimer(ADC_MANUAL_ITERATION);
+    MAP_ADC14_enableConversion();
+    MAP_Timer_A_clearTimer(timerBase);
+    MAP_Timer_A_startCounter(timerBase, TIMER_A_UP_MODE);
+    Hwi_restore(key);
+
+    return (true);
+}
+
+/*
+ *  ======== end ========
+ *  Stops sampling; analogRead() can be used again.
+ */
+void AnalogStream::end(void)
+{
+    if (handle == NULL) {
+        return;
+    }
+
+    /* convertCancel() hands over the partial block, drop it */
+    stopping = true;
+    MAP_Timer_A_stopTimer(timerBase);
+    ADCBuf_convertCancel(handle);
+    ADCBuf_close(handle);
+    handle = NULL;
+
+    /* in continuous mode the driver never releases these */
+    Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+    Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    Semaphore_destruct(&readySem);
+    restoreAnalogRead();
+
+    channelCount = 0;
+    blockSamples = 0;
+    pending = false;
+}
+
+/*
+ *  ======== onBlock ========
+ *  fxn runs in Hwi context as each block completes; NULL removes it.
+ */
+void AnalogStream::onBlock(AnalogStreamCallback fxn, void *arg)
+{
+    UInt key = Hwi_disable();
+
+    blockFxn = fxn;
+    blockArg = arg;
+
+    Hwi_restore(key);
+}
+
+/*
+ *  ======== read ========
+ *  Waits up to timeout Clock ticks (ms) for a block not returned yet
+ *  and returns it, or NULL. Blocks completed in between are counted by
+ *  overruns().
+ */
+const uint16_t *AnalogStream::read(uint32_t timeout)
+{
+    const uint16_t *block;
+    UInt key;
+
+    if (handle == NULL) {
+        return (NULL);
+    }
+
+    if (!Semaphore_pend(Semaphore_handle(&readySem), timeout)) {
+        return (NULL);
+    }
+
+    key = Hwi_disable();
+    block = lastBlock;
+    pending = false;
+    Hwi_restore(key);
+
+    return (block);
+}
+
+/*
+ *  ======== adcbufFxn ========
+ *  Hwi context, once per channel at the end of each block; the call
+ *  for the last channel delivers the block.
+ */
+void AnalogStream::adcbufFxn(ADCBuf_Handle handle,
+    ADCBuf_Conversion *conversion, void *completedBuffer, uint32_t channel)
+{
+    AnalogStream *stream = (AnalogStream *)conversion->arg;
+    const uint16_t *block;
+
+    if (stream->stopping ||
+        conversion != &stream->conversions[stream->channelCount - 1]) {
+        return;
+    }
+
+    block = (const uint16_t *)completedBuffer -
+        (stream->channelCount - 1) * stream->blockSamples;
+
+    if (stream->pending) {
+        stream->overrunCount++;
+    }
+    stream->lastBlock = block;
+    stream->pending = true;
+    Semaphore_post(Semaphore_handle(&stream->readySem));
+
+    if (stream->blockFxn != NULL) {
+        stream->blockFxn(block, stream->blockArg);
+    }
+}
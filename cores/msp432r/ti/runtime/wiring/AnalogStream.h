@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *  ======== AnalogStream.h ========
+ *  Continuous, timer paced sampling of a list of analog pins into
+ *  ping-pong buffers, delivered a block at a time.
+ *
+ *  ADCBufMSP432 runs the conversions: Timer_A1 triggers each one and
+ *  the ADC14 interrupt stores a channel set per sample period, so the
+ *  CPU cost is one interrupt per set instead of one analogRead() per
+ *  sample. (This version of the driver has no DMA path.)
+ *
+ *      uint8_t pins[] = {A0, A1, A2};
+ *      uint16_t buffer[2 * 3 * 256];
+ *      AnalogStream stream;
+ *
+ *      stream.begin(pins, 3, 10000, buffer, 256);
+ *      ...
+ *      const uint16_t *block = stream.read();
+ *      // block[c * 256 + s] is sample s of pins[c]
+ *
+ *  The buffer holds two blocks of count * samples values; a block lists
+ *  all samples of the first pin, then of the next, and so on. A block
+ *  stays valid for one block period after it is delivered, until the
+ *  driver comes back to its half. Samples are raw 14 bit values
+ *  referenced to AVCC, analogReadResolution() does not apply.
+ *
+ *  The channels of a set are converted one per trigger, rate * count
+ *  conversions per second, at most ANALOG_STREAM_MAX_CONVERSIONS. One
+ *  stream runs at a time; analogRead() must not be used while it runs,
+ *  and it needs Timer_A1, which analogWrite() uses once Timer_A0 is
+ *  full.
+ */
+
+#ifndef AnalogStream_h
+#define AnalogStream_h
+
+#include <stdint.h>
+
+#include <ti/drivers/ADCBuf.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Semaphore.h>
+
+#define ANALOG_STREAM_MAX_CHANNELS      16
+#define ANALOG_STREAM_MAX_CONVERSIONS   250000
+
+/* called in Hwi context with the block just completed */
+typedef void (*AnalogStreamCallback)(const uint16_t *block, void *arg);
+
+class AnalogStream
+{
+    public:
+        AnalogStream(void);
+
+        bool begin(const uint8_t *pins, uint8_t count, uint32_t rate,
+            uint16_t *buffer, uint16_t samples);
+        void end(void);
+
+        void onBlock(AnalogStreamCallback fxn, void *arg = NULL);
+        const uint16_t *read(uint32_t timeout = BIOS_WAIT_FOREVER);
+        bool available(void) { return (pending); }
+        uint32_t overruns(void) { return (overrunCount); }
+
+        uint8_t channels(void) { return (channelCount); }
+        uint16_t samples(void) { return (blockSamples); }
+
+    private:
+        static void adcbufFxn(ADCBuf_Handle handle,
+            ADCBuf_Conversion *conversion, void *completedBuffer,
+            uint32_t channel);
+
+        ADCBuf_Handle handle;
+        uint32_t timerBase;
+        ADCBuf_Conversion conversions[ANALOG_STREAM_MAX_CHANNELS];
+        uint8_t channelCount;
+        uint16_t blockSamples;
+
+        AnalogStreamCallback blockFxn;
+        void *blockArg;
+
+        /* read(): the last block, pending until read() takes it */
+        Semaphore_Struct readySem;
+        const uint16_t * volatile lastBlock;
+        volatile bool pending;
+        volatile uint32_t overrunCount;
+        volatile bool stopping;
+};
+
+#endif
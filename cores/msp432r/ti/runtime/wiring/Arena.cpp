@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arena.h"
+
+#include <xdc/std.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/hal/Hwi.h>
+#include <ti/sysbios/knl/Task.h>
+
+#define ARENA_ALIGN 8
+
+static Arena *arenas;           /* all arenas */
+static ArenaScope *scopes;      /* open scopes of all tasks, innermost first */
+
+Arena::Arena(void *buffer, size_t size)
+{
+    start = (char *)(((uintptr_t)buffer + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1));
+    end = (char *)buffer + size;
+    if (end < start) {
+        end = start;
+    }
+    allocated = false;
+    link();
+}
+
+Arena::Arena(size_t size)
+{
+    start = (char *)malloc(size);
+    end = start ? start + size : NULL;
+    allocated = true;
+    link();
+}
+
+Arena::~Arena(void)
+{
+    Arena **p;
+    UInt key;
+
+    key = Hwi_disable();
+    for (p = &arenas; *p != NULL; p = &(*p)->next) {
+        if (*p == this) {
+            *p = next;
+            break;
+        }
+    }
+    Hwi_restore(key);
+
+    if (allocated) {
+        free(start);
+    }
+}
+
+void Arena::link(void)
+{
+    UInt key;
+
+    top = start;
+    last = NULL;
+    peakUsed = 0;
+
+    key = Hwi_disable();
+    next = arenas;
+    arenas = this;
+    Hwi_restore(key);
+}
+
+/*
+ *  ======== Arena::alloc ========
+ */
+void *Arena::alloc(size_t size)
+{
+    char *ptr = top;
+
+    if (top == end || size > (size_t)(end - top)) {
+        return (NULL);
+    }
+
+    last = ptr;
+    top = (char *)(((uintptr_t)ptr + size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1));
+    if (top > end) {
+        top = end;
+    }
+    if ((size_t)(top - start) > peakUsed) {
+        peakUsed = top - start;
+    }
+
+    return (ptr);
+}
+
+/*
+ *  ======== Arena::resize ========
+ *  realloc() for a block of this arena: the latest allocation grows or
+ *  shrinks in place, others are copied to a new block
+ */
+void *Arena::resize(void *ptr, size_t oldSize, size_t size)
+{
+    char *block;
+
+    if (ptr == last && size <= (size_t)(end - last)) {
+        top = last;
+        return (alloc(size));
+    }
+
+    block = (char *)alloc(size);
+    if (block != NULL) {
+        memcpy(block, ptr, oldSize < size ? oldSize : size);
+    }
+
+    return (block);
+}
+
+void Arena::reset(void)
+{
+    top = start;
+    last = NULL;
+}
+
+/*
+ *  ======== Arena::current ========
+ */
+Arena *Arena::current(void)
+{
+    Task_Handle self;
+    ArenaScope *scope;
+    Arena *arena = NULL;
+    UInt key;
+
+    if (scopes == NULL || BIOS_getThreadType() != BIOS_ThreadType_Task) {
+        return (NULL);
+    }
+
+    self = Task_self();
+    key = Hwi_disable();
+    for (scope = scopes; scope != NULL; scope = scope->next) {
+        if (scope->task == (void *)self) {
+            arena = &scope->arena;
+            break;
+        }
+    }
+    Hwi_restore(key);
+
+    return (arena);
+}
+
+/*
+ *  ======== Arena::owner ========
+ */
+Arena *Arena::owner(const void *ptr)
+{
+    Arena *arena;
+    UInt key;
+
+    if (arenas == NULL) {
+        return (NULL);
+    }
+
+    key = Hwi_disable();
+    for (arena = arenas; arena != NULL; arena = arena->next) {
+        if (arena->owns(ptr)) {
+            break;
+        }
+    }
+    Hwi_restore(key);
+
+    return (arena);
+}
+
+ArenaScope::ArenaScope(Arena &arena) : arena(arena)
+{
+    UInt key;
+
+    mark = arena.top;
+    task = BIOS_getThreadType() == BIOS_ThreadType_Task ? (void *)Task_self() : NULL;
+
+    key = Hwi_disable();
+    next = scopes;
+    scopes = this;
+    Hwi_restore(key);
+}
+
+ArenaScope::~ArenaScope(void)
+{
+    ArenaScope **p;
+    UInt key;
+
+    key = Hwi_disable();
+    for (p = &scopes; *p != NULL; p = &(*p)->next) {
+        if (*p == this) {
+            *p = next;
+            break;
+        }
+    }
+    Hwi_restore(key);
+
+    arena.top = mark;
+    arena.last = NULL;
+}
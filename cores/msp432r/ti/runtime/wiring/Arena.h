@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== Arena.h ========
+ *  Bump pointer allocation from one region, all freed at once by
+ *  reset(): for the many short lived Strings and objects of handling
+ *  one request, which then need no free() each and never take the heap
+ *  lock.
+ *
+ *      static char region[2048];
+ *      Arena requestArena(region, sizeof(region));
+ *
+ *      void handle(WiFiClient &client)
+ *      {
+ *          ArenaScope scope(requestArena);
+ *
+ *          String line = client.readStringUntil('\n');
+ *          ...
+ *      }   // the String's buffer and the rest go back here, at once
+ *
+ *  While an ArenaScope is alive, new and String buffers allocated by
+ *  the task that opened it come from its arena, or from the heap once
+ *  the arena is full. delete and String free()s of arena memory are
+ *  no-ops. When the scope ends the arena drops everything allocated
+ *  since it opened, so none of that may be used afterwards: a String
+ *  declared before the scope, or returned out of it, must not grow
+ *  inside it. Scopes nest, an inner one frees only its own part.
+ */
+
+#ifndef Arena_h
+#define Arena_h
+
+#include <stddef.h>
+
+class Arena
+{
+    public:
+        Arena(void *buffer, size_t size);   /* the caller's region */
+        Arena(size_t size);                 /* a region malloc()ed once */
+        ~Arena(void);
+
+        void *alloc(size_t size);   /* 8 byte aligned, NULL when full */
+        void *resize(void *ptr, size_t oldSize, size_t size);
+        void reset(void);
+
+        size_t size(void) { return (end - start); }
+        size_t used(void) { return (top - start); }
+        size_t peak(void) { return (peakUsed); }    /* most ever used */
+        bool owns(const void *ptr) const
+            { return ((const char *)ptr >= start && (const char *)ptr < end); }
+
+        static Arena *current(void);            /* the calling task's, or NULL */
+        static Arena *owner(const void *ptr);   /* the arena ptr is in, or NULL */
+
+    private:
+        Arena(const Arena &);
+        Arena &operator=(const Arena &);
+        void link(void);
+
+        friend class ArenaScope;
+
+        char *start;
+        char *top;
+        char *end;
+        char *last;             /* latest allocation, which can grow in place */
+        size_t peakUsed;
+        bool allocated;         /* region is ours to free */
+        Arena *next;            /* all arenas, for owner() */
+};
+
+class ArenaScope
+{
+    public:
+        ArenaScope(Arena &arena);
+        ~ArenaScope(void);
+
+    private:
+        ArenaScope(const ArenaScope &);
+        ArenaScope &operator=(const ArenaScope &);
+
+        friend class Arena;
+
+        Arena &arena;
+        char *mark;             /* arena top when it opened */
+        void *task;             /* Task_Handle of the task that opened it */
+        ArenaScope *next;       /* open scopes, innermost first */
+};
+
+#endif
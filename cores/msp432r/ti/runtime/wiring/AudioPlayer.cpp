@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+#include "AudioPlayer.h"
+#include "wiring_private.h"
+
+#include <xdc/runtime/Error.h>
+
+#include <ti/compression/lz4/lz4_stream.h>
+
+AudioPlayer::AudioPlayer(void)
+{
+    channel.timer = NULL;
+    repeat = 1;
+    task = NULL;
+    nextFree = 0;
+    endIndex = 0;
+    state = AUDIO_PLAYER_IDLE;
+    underrunCount = 0;
+    source = NULL;
+    remaining = 0;
+    bits = 8;
+    compressed = false;
+    blockSamples = 0;
+    blockPos = NULL;
+    blockLeft = 0;
+}
+
+/*
+ *  ======== begin ========
+ *  Takes a timer for pin and starts its carrier at rate * repeat, the
+ *  pin idling low. Returns false if the pin has no Timer_A output, no
+ *  timer is free or the rate does not fit SMCLK.
+ */
+bool AudioPlayer::begin(uint8_t pin, uint32_t rate, int taskPriority)
+{
+    Semaphore_Params semParams;
+    Task_Params params;
+
+    end();
+
+    if (rate == 0) {
+        return (false);
+    }
+
+    /* the fewest periods per sample that lift the carrier out of earshot */
+    for (repeat = 1; repeat < 8 && rate * repeat < AUDIO_PLAYER_CARRIER;
+        repeat <<= 1) {
+    }
+
+    if (task == NULL) {
+        Semaphore_Params_init(&semParams);
+        semParams.mode = Semaphore_Mode_COUNTING;
+        Semaphore_construct(&refillSem, 0, &semParams);
+
+        Task_Params_init(&params);
+        params.arg0 = (UArg)this;
+        params.stackSize = 1024;
+        params.priority = taskPriority;
+        params.instance->name = (xdc_String)"audio";
+
+        task = Task_create(taskFxn, &params, Error_IGNORE);
+        if (task == NULL) {
+            return (false);
+        }
+    }
+
+    if (!pwmChannelBeginTimer(&channel, pin, rate * repeat)) {
+        channel.timer = NULL;
+        return (false);
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== end ========
+ *  Stops playback and frees the pin's timer. The refill task stays,
+ *  blocked, for the next begin().
+ */
+void AudioPlayer::end(void)
+{
+    stop();
+
+    if (channel.timer != NULL) {
+        pwmChannelEndTimer(&channel);
+        channel.timer = NULL;
+    }
+}
+
+/*
+ *  ======== play ========
+ *  Plays count samples, bits 8 (unsigned) or 16 (signed, little
+ *  endian), from memory that must stay put until playing() is false.
+ */
+bool AudioPlayer::play(const void *samples, uint32_t count, uint8_t bits)
+{
+    stop();
+
+    if (channel.timer == NULL || samples == NULL || count == 0 ||
+        (bits != 8 && bits != 16)) {
+        return (false);
+    }
+
+    source = (const uint8_t *)samples;
+    remaining = count;
+    this->bits = bits;
+    compressed = false;
+
+    return (start());
+}
+
+/*
+ *  ======== playCompressed ========
+ *  Plays a clip in the format of AudioPlayer.h, as written by
+ *  audio_compress.py --lz4.
+ */
+bool AudioPlayer::playCompressed(const uint8_t *clip)
+{
+    uint32_t count;
+    uint16_t clipBits;
+    uint16_t samples;
+
+    stop();
+
+    if (channel.timer == NULL || clip == NULL) {
+        return (false);
+    }
+
+    count = clip[0] | (clip[1] << 8) | ((uint32_t)clip[2] << 16) |
+        ((uint32_t)clip[3] << 24);
+    clipBits = clip[4] | (clip[5] << 8);
+    samples = clip[6] | (clip[7] << 8);
+
+    if (count == 0 || (clipBits != 8 && clipBits != 16) || samples == 0 ||
+        (uint32_t)samples * (clipBits / 8) > AUDIO_PLAYER_BLOCK) {
+        return (false);
+    }
+
+    source = clip + 8;
+    remaining = count;
+    bits = clipBits;
+    compressed = true;
+    blockSamples = samples;
+    blockLeft = 0;
+
+    return (start());
+}
+
+/*
+ *  ======== stop ========
+ *  Cuts playback short, leaving the pin low
+ */
+void AudioPlayer::stop(void)
+{
+    UInt key;
+
+    key = Task_disable();
+
+    if (state != AUDIO_PLAYER_IDLE) {
+        pwmWaveformEnd(&channel);
+        pwmChannelWrite(&channel, 0);
+        state = AUDIO_PLAYER_IDLE;
+    }
+
+    if (task != NULL) {
+        Semaphore_reset(Semaphore_handle(&refillSem), 0);
+    }
+
+    Task_restore(key);
+}
+
+/*
+ *  ======== start ========
+ *  Fill both halves and hand them to the uDMA
+ */
+bool AudioPlayer::start(void)
+{
+    UInt key;
+
+    key = Task_disable();
+
+    underrunCount = 0;
+    nextFree = 0;
+    state = AUDIO_PLAYER_PLAYING;
+    fill(0);
+    fill(AUDIO_PLAYER_HALF);
+
+    if (!pwmWaveformStream(&channel, counts, 2 * AUDIO_PLAYER_HALF,
+        refillFxn, (uintptr_t)this)) {
+        state = AUDIO_PLAYER_IDLE;
+        Task_restore(key);
+        return (false);
+    }
+
+    Task_restore(key);
+
+    return (true);
+}
+
+/*
+ *  ======== fill ========
+ *  Converts the next samples into the half at index, each repeated for
+ *  repeat PWM periods; silence (half duty) once the clip runs out.
+ */
+void AudioPlayer::fill(uint32_t index)
+{
+    uint16_t *p = &counts[index];
+    uint32_t scale = (uint32_t)channel.period + 1;
+    uint16_t value;
+    int32_t sample;
+    uint32_t i;
+    uint8_t j;
+
+    for (i = 0; i < AUDIO_PLAYER_HALF; i += repeat) {
+        if (state != AUDIO_PLAYER_PLAYING || !nextSample(&sample)) {
+            sample = 0;
+        }
+        value = (uint16_t)(((uint32_t)(sample + 32768) * scale) >> 16);
+        for (j = 0; j < repeat; j++) {
+            *p++ = value;
+        }
+    }
+
+    /* the half that plays the last samples ends playback once it is out */
+    if (state == AUDIO_PLAYER_PLAYING && remaining == 0) {
+        state = AUDIO_PLAYER_DRAINING;
+        endIndex = index;
+    }
+}
+
+/*
+ *  ======== nextSample ========
+ *  Fetch one sample as signed 16 bit, false at the end of the clip
+ */
+bool AudioPlayer::nextSample(int32_t *sample)
+{
+    const uint8_t *p;
+
+    if (remaining == 0) {
+        return (false);
+    }
+
+    if (compressed) {
+        if (blockLeft == 0 && !nextBlock()) {
+            remaining = 0;
+            return (false);
+        }
+        p = blockPos;
+        blockLeft--;
+    }
+    else {
+        p = source;
+    }
+
+    if (bits == 8) {
+        *sample = ((int32_t)p[0] - 128) << 8;
+        p += 1;
+    }
+    else {
+        *sample = (int16_t)(p[0] | (p[1] << 8));
+        p += 2;
+    }
+
+    if (compressed) {
+        blockPos = p;
+    }
+    else {
+        source = p;
+    }
+    remaining--;
+
+    return (true);
+}
+
+/*
+ *  ======== nextBlock ========
+ *  Decompress the next LZ4 block of the clip, false if it is corrupt
+ */
+bool AudioPlayer::nextBlock(void)
+{
+    LZ4_streamDecompressBlockParams params;
+    LZ4_streamDecompressBlockState lz4State;
+    LZ4_status status;
+    uint32_t samples;
+    uint32_t length;
+    uint16_t size;
+
+    samples = remaining < blockSamples ? remaining : blockSamples;
+    length = samples * (bits / 8);
+    size = source[0] | (source[1] << 8);
+
+    params.dst = block;
+    params.dstLength = length;
+    params.containsBlockSize = false;
+    LZ4_streamDecompressBlockInit(&params, &lz4State, &status);
+    if (LZ4_streamDecompressBlock(&lz4State, source + 2, size, &status) !=
+        length || status != LZ4_SUCCESS) {
+        return (false);
+    }
+
+    source += 2 + size;
+    blockPos = block;
+    blockLeft = samples;
+
+    return (true);
+}
+
+/*
+ *  ======== service ========
+ *  Refill the half the uDMA is done with, or end playback once the last
+ *  samples are out
+ */
+void AudioPlayer::service(void)
+{
+    UInt key;
+    uint32_t index;
+
+    key = Task_disable();
+
+    index = nextFree;
+    nextFree = nextFree == 0 ? AUDIO_PLAYER_HALF : 0;
+
+    if (state == AUDIO_PLAYER_DRAINING && index == endIndex) {
+        pwmWaveformEnd(&channel);
+        pwmChannelWrite(&channel, 0);
+        state = AUDIO_PLAYER_IDLE;
+    }
+    else if (state != AUDIO_PLAYER_IDLE) {
+        fill(index);
+    }
+
+    Task_restore(key);
+}
+
+/*
+ *  ======== refillFxn ========
+ *  pwmWaveformStream() callback, in Hwi context; the halves come free
+ *  in turn so the task keeps track of which
+ */
+void AudioPlayer::refillFxn(uintptr_t arg, uint32_t index)
+{
+    AudioPlayer *player = (AudioPlayer *)arg;
+
+    (void)index;
+    Semaphore_post(Semaphore_handle(&player->refillSem));
+}
+
+/*
+ *  ======== taskFxn ========
+ */
+void AudioPlayer::taskFxn(UArg arg0, UArg arg1)
+{
+    AudioPlayer *player = (AudioPlayer *)arg0;
+
+    for (;;) {
+        Semaphore_pend(Semaphore_handle(&player->refillSem),
+            BIOS_WAIT_FOREVER);
+
+        /* the other half came free too: the one being refilled replayed */
+        if (Semaphore_getCount(Semaphore_handle(&player->refillSem)) != 0) {
+            player->underrunCount++;
+        }
+
+        player->service();
+    }
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *  ======== AudioPlayer.h ========
+ *  PCM sample playback on a PWM pin, for voice prompts and effects on
+ *  a buzzer or an amplifier behind an RC filter.
+ *
+ *  The pin runs on a Timer_A of its own (pwmChannelBeginTimer()) at a
+ *  whole multiple of the sample rate, at least AUDIO_PLAYER_CARRIER so
+ *  the carrier is out of earshot, and the uDMA moves one duty value per
+ *  PWM period from a two half buffer (pwmWaveformStream()). A task
+ *  refills each half as it plays out, converting 8 bit unsigned or 16
+ *  bit signed samples, decompressing them first for playCompressed():
+ *
+ *      extern const uint8_t prompt[];  // from audio_compress.py --lz4
+ *      AudioPlayer player;
+ *
+ *      player.begin(39, 8000);
+ *      player.playCompressed(prompt);
+ *      while (player.playing()) delay(10);
+ *
+ *  Compressed clips are a header of the sample count (uint32_t), the
+ *  bits per sample and the samples per block (uint16_t each, all
+ *  little endian), then per block its size (uint16_t) and an
+ *  independent LZ4 block of that many samples, at most
+ *  AUDIO_PLAYER_BLOCK bytes decompressed. The LZ4 stream decoder has no
+ *  window over a wrapping buffer, so blocks do not refer back to one
+ *  another.
+ *
+ *  A half is AUDIO_PLAYER_HALF PWM periods, 16ms at a 32kHz carrier;
+ *  the task must get to it within that time or the half plays again,
+ *  which underruns() counts. The resolution is log2(SMCLK / carrier),
+ *  ~8.5 bits at 12MHz.
+ */
+
+#ifndef AudioPlayer_h
+#define AudioPlayer_h
+
+#include <stdint.h>
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/knl/Task.h>
+
+#define AUDIO_PLAYER_HALF       512     /* PWM periods per half buffer */
+#define AUDIO_PLAYER_BLOCK      512     /* bytes of a decompressed block */
+#define AUDIO_PLAYER_CARRIER    32000   /* lowest PWM frequency */
+
+class AudioPlayer
+{
+    public:
+        AudioPlayer(void);
+
+        /* refill task at taskPriority, above sketch loops */
+        bool begin(uint8_t pin, uint32_t rate, int taskPriority = 2);
+        void end(void);
+
+        bool play(const void *samples, uint32_t count, uint8_t bits = 8);
+        bool playCompressed(const uint8_t *clip);
+        void stop(void);
+
+        bool playing(void) { return (state != AUDIO_PLAYER_IDLE); }
+        uint32_t underruns(void) { return (underrunCount); }
+
+    private:
+        enum {
+            AUDIO_PLAYER_IDLE,
+            AUDIO_PLAYER_PLAYING,
+            AUDIO_PLAYER_DRAINING     /* out of samples, last half queued */
+        };
+
+        static void refillFxn(uintptr_t arg, uint32_t index);
+        static void taskFxn(UArg arg0, UArg arg1);
+
+        bool start(void);
+        void service(void);
+        void fill(uint32_t index);
+        bool nextSample(int32_t *sample);
+        bool nextBlock(void);
+
+        PwmChannel channel;
+        uint16_t counts[2 * AUDIO_PLAYER_HALF];
+        uint8_t repeat;             /* PWM periods per sample */
+
+        Task_Handle task;
+        Semaphore_Struct refillSem;
+        uint32_t nextFree;          /* index of the half to refill next */
+        uint32_t endIndex;          /* half holding the last samples */
+        volatile uint8_t state;
+        volatile uint32_t underrunCount;
+
+        /* the clip being played */
+        const uint8_t *source;
+        uint32_t remaining;         /* samples not yet fetched */
+        uint8_t bits;
+        bool compressed;
+        uint16_t blockSamples;      /* samples per LZ4 block */
+        const uint8_t *blockPos;
+        uint16_t blockLeft;
+        uint8_t block[AUDIO_PLAYER_BLOCK];
+};
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== BufferedPrint.h ========
+ *  Collects print() output in a buffer and hands it to another Print
+ *  in blocks, for outputs where every write() costs a packet or a
+ *  driver call:
+ *
+ *      BufferedPrint<128> out(client);
+ *
+ *      out.print("t=");
+ *      out.print(millis());
+ *      out.println();      // one client.write() for the whole line
+ *
+ *  The buffer goes out when it is full, at a '\n' (unless lineFlush is
+ *  false), on flush() and when the BufferedPrint goes out of scope.
+ *  Writes of N bytes or more bypass the buffer.
+ */
+
+#ifndef BufferedPrint_h
+#define BufferedPrint_h
+
+#include <string.h>
+
+#include "Print.h"
+
+template <size_t N>
+class BufferedPrint : public Print
+{
+    public:
+        BufferedPrint(Print &out, bool lineFlush = true) :
+            out(out), fill(0), lineFlush(lineFlush) {}
+        ~BufferedPrint() { flush(); }
+
+        virtual size_t write(uint8_t c)
+        {
+            buf[fill++] = c;
+            if (fill == N || (lineFlush && c == '\n')) {
+                flush();
+            }
+            return (1);
+        }
+
+        virtual size_t write(const uint8_t *buffer, size_t size)
+        {
+            if (fill + size > N) {
+                flush();
+            }
+            if (size >= N) {
+                return (out.write(buffer, size));
+            }
+
+            memcpy(&buf[fill], buffer, size);
+            fill += size;
+            if (fill == N ||
+                (lineFlush && memchr(buffer, '\n', size) != NULL)) {
+                flush();
+            }
+            return (size);
+        }
+
+        /* write out what is buffered */
+        void flush(void)
+        {
+            size_t n = fill;
+
+            fill = 0;
+            if (n != 0 && out.write(buf, n) != n) {
+                setWriteError();
+            }
+        }
+
+        size_t pending(void) { return (fill); }
+
+        using Print::write;
+
+    private:
+        Print &out;
+        uint8_t buf[N];
+        size_t fill;
+        bool lineFlush;
+};
+
+#endif
@@ -0,0 +1,447 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+#include "ControlLoop.h"
+
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
+
+PidController::PidController(void)
+{
+    kp = ki = kd = kff = 0;
+    outMin = 0;
+    outMax = 1;
+    alpha = 0;
+    setpoint = 0;
+    dt = kiDt = kdRate = 0;
+    integral = derivative = 0;
+    lastInput = lastOutput = 0;
+    primed = false;
+
+    inputPin = NULL;
+    inputQ15 = NULL;
+    inputFxn = NULL;
+    inputArg = 0;
+    outputCh = NULL;
+    outputFxn = NULL;
+    outputArg = 0;
+
+    loop = NULL;
+    next = NULL;
+    divider = 1;
+    countdown = 1;
+}
+
+/*
+ *  ======== scale ========
+ *  Fold the update interval into the gains. Called with Swis disabled.
+ */
+void PidController::scale(void)
+{
+    kiDt = ki * dt;
+    kdRate = dt > 0 ? kd / dt * (1 - alpha) : 0;
+}
+
+void PidController::setGains(float kp, float ki, float kd, float kff)
+{
+    uint32_t swiKey = Swi_disable();
+
+    this->kp = kp;
+    this->ki = ki;
+    this->kd = kd;
+    this->kff = kff;
+    scale();
+
+    Swi_restore(swiKey);
+}
+
+void PidController::setLimits(float min, float max)
+{
+    uint32_t swiKey = Swi_disable();
+
+    outMin = min;
+    outMax = max;
+
+    Swi_restore(swiKey);
+}
+
+void PidController::setDerivativeFilter(float alpha)
+{
+    uint32_t swiKey = Swi_disable();
+
+    this->alpha = alpha < 0 ? 0 : alpha;
+    scale();
+
+    Swi_restore(swiKey);
+}
+
+/*
+ *  ======== reset ========
+ *  Clear the integral and derivative, e.g. after the actuator was
+ *  overridden; the next update starts from its own input
+ */
+void PidController::reset(void)
+{
+    uint32_t swiKey = Swi_disable();
+
+    integral = 0;
+    derivative = 0;
+    primed = false;
+
+    Swi_restore(swiKey);
+}
+
+void PidController::inputAnalog(const AnalogPin *pin)
+{
+    uint32_t swiKey = Swi_disable();
+
+    inputPin = pin;
+    inputQ15 = NULL;
+    inputFxn = NULL;
+    primed = false;
+
+    Swi_restore(swiKey);
+}
+
+void PidController::inputValue(const volatile int32_t *q15)
+{
+    uint32_t swiKey = Swi_disable();
+
+    inputPin = NULL;
+    inputQ15 = q15;
+    inputFxn = NULL;
+    primed = false;
+
+    Swi_restore(swiKey);
+}
+
+void PidController::inputFunction(ControlInputFxn fxn, uintptr_t arg)
+{
+    uint32_t swiKey = Swi_disable();
+
+    inputPin = NULL;
+    inputQ15 = NULL;
+    inputFxn = fxn;
+    inputArg = arg;
+    primed = false;
+
+    Swi_restore(swiKey);
+}
+
+void PidController::outputPwm(const PwmChannel *ch)
+{
+    uint32_t swiKey = Swi_disable();
+
+    outputCh = ch;
+    outputFxn = NULL;
+
+    Swi_restore(swiKey);
+}
+
+void PidController::outputFunction(ControlOutputFxn fxn, uintptr_t arg)
+{
+    uint32_t swiKey = Swi_disable();
+
+    outputCh = NULL;
+    outputFxn = fxn;
+    outputArg = arg;
+
+    Swi_restore(swiKey);
+}
+
+/*
+ *  ======== update ========
+ *  Swi context: sample, compute and write one step.
+ *
+ *  The integral takes a step only if the output isn't saturated, or
+ *  the step moves it out of saturation, so it never winds up past
+ *  what the output can deliver.
+ */
+void PidController::update(void)
+{
+    float sp = setpoint;
+    float in, error, step, out;
+
+    if (inputPin != NULL) {
+        in = q15ToFloat(analogPinReadQ15(inputPin));
+    }
+    else if (inputQ15 != NULL) {
+        in = q15ToFloat(*inputQ15);
+    }
+    else if (inputFxn != NULL) {
+        in = inputFxn(inputArg);
+    }
+    else {
+        return;
+    }
+
+    if (!primed) {
+        lastInput = in;
+        primed = true;
+    }
+
+    error = sp - in;
+    derivative = alpha * derivative - kdRate * (in - lastInput);
+    step = integral + kiDt * error;
+    out = kp * error + step + derivative + kff * sp;
+
+    if (out > outMax) {
+        out = outMax;
+        if (error < 0) {
+            integral = step;
+        }
+    }
+    else if (out < outMin) {
+        out = outMin;
+        if (error > 0) {
+            integral = step;
+        }
+    }
+    else {
+        integral = step;
+    }
+
+    lastInput = in;
+    lastOutput = out;
+
+    if (outputCh != NULL) {
+        /* keep the conversion in range; pwmChannelWriteQ15() clamps */
+        if (out > 1) {
+            out = 1;
+        }
+        else if (out < -1) {
+            out = -1;
+        }
+        pwmChannelWriteQ15(outputCh, q15FromFloat(out));
+    }
+    else if (outputFxn != NULL) {
+        outputFxn(out, outputArg);
+    }
+}
+
+ControlLoop::ControlLoop(void)
+{
+    begun = false;
+    periodUs = 0;
+    controllers = NULL;
+    busy = false;
+    tickCount = 0;
+    overrunCount = 0;
+    maxTicks = 0;
+    timestampHz = 0;
+}
+
+/*
+ *  ======== timerFxn ========
+ *  MicroTimer callback, Hwi context: post the Swi, or count an overrun
+ *  if the previous tick's run hasn't finished
+ */
+void ControlLoop::timerFxn(uintptr_t arg)
+{
+    ControlLoop *loop = (ControlLoop *)arg;
+
+    loop->tickCount++;
+    if (loop->busy) {
+        loop->overrunCount++;
+        return;
+    }
+    loop->busy = true;
+    Swi_post(Swi_handle(&loop->swi));
+}
+
+/*
+ *  ======== swiFxn ========
+ *  Run the controllers due in this tick, in the order they were added
+ */
+void ControlLoop::swiFxn(UArg arg0, UArg arg1)
+{
+    ControlLoop *loop = (ControlLoop *)arg0;
+    PidController *pid;
+    uint32_t start = Timestamp_get32();
+    uint32_t elapsed;
+
+    for (pid = loop->controllers; pid != NULL; pid = pid->next) {
+        if (--pid->countdown == 0) {
+            pid->countdown = pid->divider;
+            pid->update();
+        }
+    }
+
+    elapsed = Timestamp_get32() - start;
+    if (elapsed > loop->maxTicks) {
+        loop->maxTicks = elapsed;
+    }
+    loop->busy = false;
+}
+
+/*
+ *  ======== begin ========
+ *  Tick every periodUs. swiPriority -1 is the highest Swi priority, so
+ *  only Hwis (and the loop's own timer) delay the controllers. Call
+ *  from a task, the first MicroTimer start creates its Hwi.
+ */
+bool ControlLoop::begin(uint32_t periodUs, int swiPriority)
+{
+    Swi_Params swiParams;
+    Types_FreqHz freq;
+    PidController *pid;
+    uint32_t swiKey;
+
+    if (begun || periodUs == 0) {
+        return (false);
+    }
+
+    Timestamp_getFreq(&freq);
+    timestampHz = freq.lo;
+
+    Swi_Params_init(&swiParams);
+    swiParams.arg0 = (UArg)this;
+    if (swiPriority >= 0) {
+        swiParams.priority = swiPriority;
+    }
+    Swi_construct(&swi, swiFxn, &swiParams, NULL);
+
+    swiKey = Swi_disable();
+    this->periodUs = periodUs;
+    for (pid = controllers; pid != NULL; pid = pid->next) {
+        pid->dt = periodUs * pid->divider * 1e-6f;
+        pid->scale();
+    }
+    Swi_restore(swiKey);
+
+    tickCount = 0;
+    overrunCount = 0;
+    maxTicks = 0;
+    busy = false;
+
+    if (!microTimerStart(&timer, timerFxn, (uintptr_t)this, periodUs,
+        periodUs)) {
+        Swi_destruct(&swi);
+        return (false);
+    }
+    begun = true;
+
+    return (true);
+}
+
+/*
+ *  ======== end ========
+ *  Stop ticking; the outputs keep their last values
+ */
+void ControlLoop::end(void)
+{
+    if (!begun) {
+        return;
+    }
+
+    microTimerStop(&timer);
+    while (busy) {
+        Task_sleep(1);
+    }
+    Swi_destruct(&swi);
+    begun = false;
+}
+
+/*
+ *  ======== add ========
+ *  Append pid, run every divider ticks starting with the next one. A
+ *  controller is on one loop at a time.
+ */
+bool ControlLoop::add(PidController *pid, uint16_t divider)
+{
+    PidController **link;
+    uint32_t swiKey;
+
+    if (divider == 0) {
+        return (false);
+    }
+
+    swiKey = Swi_disable();
+
+    if (pid->loop != NULL) {
+        Swi_restore(swiKey);
+        return (false);
+    }
+
+    pid->loop = this;
+    pid->divider = divider;
+    pid->countdown = 1;
+    pid->dt = periodUs * divider * 1e-6f;
+    pid->scale();
+    pid->next = NULL;
+
+    for (link = &controllers; *link != NULL; link = &(*link)->next) {
+        ;
+    }
+    *link = pid;
+
+    Swi_restore(swiKey);
+
+    return (true);
+}
+
+void ControlLoop::remove(PidController *pid)
+{
+    PidController **link;
+    uint32_t swiKey = Swi_disable();
+
+    for (link = &controllers; *link != NULL; link = &(*link)->next) {
+        if (*link == pid) {
+            *link = pid->next;
+            pid->loop = NULL;
+            break;
+        }
+    }
+
+    Swi_restore(swiKey);
+}
+
+/*
+ *  ======== maxMicros ========
+ *  The worst case Swi run time since the previous call, the margin
+ *  left against the period
+ */
+uint32_t ControlLoop::maxMicros(void)
+{
+    uint32_t swiKey = Swi_disable();
+    uint32_t ticks = maxTicks;
+
+    maxTicks = 0;
+    Swi_restore(swiKey);
+
+    if (timestampHz == 0) {
+        return (0);
+    }
+
+    return ((uint64_t)ticks * 1000000 / timestampHz);
+}
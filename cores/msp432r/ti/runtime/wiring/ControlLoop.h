@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== ControlLoop.h ========
+ *  PID controllers evaluated at fixed rates in a Swi instead of in
+ *  loop() on millis() deltas:
+ *
+ *      AnalogPin sensor;
+ *      PwmChannel heater;
+ *      PidController pid;
+ *      ControlLoop control;
+ *
+ *      analogPinBegin(&sensor, A0);
+ *      pwmChannelBegin(&heater, 39);
+ *      pid.setGains(2.0, 0.5, 0);
+ *      pid.setLimits(0, 1);
+ *      pid.inputAnalog(&sensor);
+ *      pid.outputPwm(&heater);
+ *      pid.setSetpoint(0.6);
+ *      control.add(&pid, 10);          // every 10th tick, 100Hz
+ *      control.begin(1000);            // 1kHz ticks
+ *
+ *  A MicroTimer interrupts every tick and posts the loop's Swi, which
+ *  samples each controller due in that tick, runs its update and
+ *  writes its output, so the sample interval is the timer's, whatever
+ *  the tasks are doing. Controllers on the same loop run at the tick
+ *  rate divided by their own divider.
+ *
+ *  Inputs, setpoints and outputs are fractions of full scale: an
+ *  AnalogPin reads as 0 to 1, a PWM output is written as a 0 to 1 duty
+ *  cycle straight to its CCR. The update itself is single precision
+ *  float, which the M4F's FPU does in about the time of the Q15 code
+ *  it would take to keep gains and integral in range. The integral
+ *  only accumulates while the output isn't saturated in the same
+ *  direction (anti-windup), the derivative is taken on the input so a
+ *  setpoint step doesn't kick it, and an optional feed-forward gain
+ *  adds a share of the setpoint to the output.
+ *
+ *  An AnalogPin input converts in the Swi: analogRead() and
+ *  analogPinRead() from tasks then must not be used, and neither may
+ *  an AnalogStream. For a stream, have its block callback store the
+ *  channel's value (in Q15, e.g. the block mean) and use
+ *  inputValue(). A tick that comes while the Swi is still running is
+ *  counted as an overrun and skipped.
+ */
+
+#ifndef ControlLoop_h
+#define ControlLoop_h
+
+#include <stdint.h>
+
+#include <ti/sysbios/knl/Swi.h>
+
+/* in Swi context, return the input / take the output as a fraction */
+typedef float (*ControlInputFxn)(uintptr_t arg);
+typedef void (*ControlOutputFxn)(float value, uintptr_t arg);
+
+class ControlLoop;
+
+class PidController
+{
+    public:
+        PidController(void);
+
+        /* ki in 1/s, kd in s; take effect at the next update */
+        void setGains(float kp, float ki, float kd, float kff = 0);
+        void setLimits(float min, float max);
+        /* 0 for none, up to just under 1 for heavy filtering */
+        void setDerivativeFilter(float alpha);
+        void setSetpoint(float setpoint) { this->setpoint = setpoint; }
+        void reset(void);
+
+        void inputAnalog(const AnalogPin *pin);
+        void inputValue(const volatile int32_t *q15);
+        void inputFunction(ControlInputFxn fxn, uintptr_t arg = 0);
+        void outputPwm(const PwmChannel *ch);
+        void outputFunction(ControlOutputFxn fxn, uintptr_t arg = 0);
+
+        float getSetpoint(void) { return (setpoint); }
+        float input(void) { return (lastInput); }
+        float output(void) { return (lastOutput); }
+
+    private:
+        friend class ControlLoop;
+
+        void scale(void);
+        void update(void);
+
+        /* set by the sketch */
+        float kp, ki, kd, kff;
+        float outMin, outMax;
+        float alpha;
+        volatile float setpoint;
+
+        /* per update, from the gains and the loop's interval */
+        float dt;
+        float kiDt;                 /* ki * dt */
+        float kdRate;               /* kd / dt * (1 - alpha) */
+
+        /* state */
+        float integral;
+        float derivative;
+        volatile float lastInput;
+        volatile float lastOutput;
+        bool primed;                /* lastInput holds a sample */
+
+        /* one of each is set */
+        const AnalogPin *inputPin;
+        const volatile int32_t *inputQ15;
+        ControlInputFxn inputFxn;
+        uintptr_t inputArg;
+        const PwmChannel *outputCh;
+        ControlOutputFxn outputFxn;
+        uintptr_t outputArg;
+
+        ControlLoop *loop;
+        PidController *next;
+        uint16_t divider;
+        uint16_t countdown;
+};
+
+class ControlLoop
+{
+    public:
+        ControlLoop(void);
+
+        bool begin(uint32_t periodUs, int swiPriority = -1);
+        void end(void);
+
+        /* run pid every divider ticks; may be called before begin() */
+        bool add(PidController *pid, uint16_t divider = 1);
+        void remove(PidController *pid);
+
+        uint32_t ticks(void) { return (tickCount); }
+        uint32_t overruns(void) { return (overrunCount); }
+        uint32_t period(void) { return (periodUs); }
+        /* longest Swi run since the last call, in microseconds */
+        uint32_t maxMicros(void);
+
+    private:
+        static void timerFxn(uintptr_t arg);
+        static void swiFxn(UArg arg0, UArg arg1);
+
+        MicroTimer timer;
+        Swi_Struct swi;
+        bool begun;
+
+        uint32_t periodUs;
+        PidController *controllers;
+        volatile bool busy;         /* posted, and not yet done */
+        volatile uint32_t tickCount;
+        volatile uint32_t overrunCount;
+        volatile uint32_t maxTicks; /* Timestamp counts */
+        uint32_t timestampHz;
+};
+
+#endif
@@ -47,7 +47,9 @@
 #include <xdc/runtime/System.h>
 
 #include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Event.h>
 #include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/knl/Swi.h>
 #include <ti/sysbios/knl/Task.h>
 #include <ti/sysbios/gates/GateMutex.h>
 
@@ -120,37 +122,318 @@ typedef unsigned int word;
 
 #define bit(b) (1UL << (b))
 
+/*
+ * Runs from SRAM, without the flash wait states at 48MHz: for interrupt
+ * handlers and what they call on every interrupt. The code is copied
+ * to SRAM with .data at startup; calls between it and flash, too far
+ * apart for a BL, go through veneers the linker adds.
+ */
+#define RAMFUNC __attribute__((section(".ramfunc"), noinline))
+
+/*
+ * Left alone by the startup code, which zeroes .bss: for large buffers
+ * whose first use writes them, and for data kept across a reset (a
+ * crash record, counters), which survives anything but a power-up.
+ * Such data needs a check of its own, a magic word or a CRC, to tell
+ * it from the garbage after power-up.
+ */
+#define NOINIT __attribute__((section(".noinit")))
+
+/*
+ * NOINIT, for uDMA buffers: word aligned, so transfers can move words,
+ * and placed with the uDMA control table.
+ */
+#define DMA_BUFFER __attribute__((section(".dmabuf"), aligned(4)))
+
 void init(void);
 
 unsigned long getCpuFrequency(void);
 void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t val);
 uint8_t shiftIn(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder);
+void shiftOutBuffer(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder,
+    const uint8_t *buf, size_t len);
+void shiftInBuffer(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder,
+    uint8_t *buf, size_t len);
 unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeout);
 void pinMode(uint8_t, uint8_t);
 void digitalWrite(uint8_t, uint8_t);
 int digitalRead(uint8_t);
+void strictPinMode(bool enable);
+bool checkPinMode(uint8_t pin, uint8_t mode);
+uint8_t portRead(uint8_t port);
+void portWrite(uint8_t port, uint8_t mask, uint8_t value);
 uint16_t analogRead(uint8_t);
 void analogWrite(uint8_t, int);
 void analogReference(uint16_t);
 void analogFrequency(uint32_t);
+void analogWriteResolution(uint16_t);
+void analogWriteQ15(uint8_t, int32_t);
+
+/* a PWM output resolved once, duty updates are a CCR store */
+typedef struct PwmChannel {
+    void *timer;                /* Timer_A_Type of the output */
+    volatile uint16_t *ccr;     /* its TAxCCRn */
+    uint16_t period;            /* TAxCCR0 at pwmChannelBegin() */
+    uint32_t max;               /* analogWriteResolution() full scale */
+} PwmChannel;
+
+bool pwmChannelBegin(PwmChannel *ch, uint8_t pin);
+bool pwmChannelBeginTimer(PwmChannel *ch, uint8_t pin, uint32_t hz);
+void pwmChannelEndTimer(PwmChannel *ch);
+void pwmChannelWrite(const PwmChannel *ch, uint32_t val);
+void pwmChannelWriteQ15(const PwmChannel *ch, int32_t duty);
+bool pwmChannelWriteSync(const PwmChannel *chs, const uint32_t *vals,
+    uint8_t count);
+uint16_t pwmChannelCompare(const PwmChannel *ch, uint32_t val);
+bool pwmWaveformBegin(const PwmChannel *ch, const uint16_t *counts,
+    uint32_t length, bool loop);
+
+/* called in Hwi context when a half of a pwmWaveformStream() is free */
+typedef void (*PwmWaveformCallback)(uintptr_t arg, uint32_t index);
+
+bool pwmWaveformStream(const PwmChannel *ch, uint16_t *counts,
+    uint32_t length, PwmWaveformCallback fxn, uintptr_t arg);
+void pwmWaveformEnd(const PwmChannel *ch);
+bool pwmWaveformActive(const PwmChannel *ch);
+
+/* complementary PWM pairs with dead-time, see motorPwmBegin() */
+#define MOTOR_PWM_MAX_PAIRS 2
+
+typedef struct MotorPwm {
+    void *timer;                /* Timer_A_Type, counting up/down */
+    volatile uint16_t *ccrs[2 * MOTOR_PWM_MAX_PAIRS]; /* high, low, ... */
+    uint8_t pins[2 * MOTOR_PWM_MAX_PAIRS];
+    uint8_t pairs;
+    uint16_t period;            /* TAxCCR0, half the PWM period */
+    uint16_t dead;              /* dead band in timer counts */
+    uint16_t window;            /* update window in timer counts */
+    uint32_t max;               /* analogWriteResolution() full scale */
+} MotorPwm;
+
+bool motorPwmBegin(MotorPwm *m, const uint8_t *pins, uint8_t pairs,
+    uint32_t hz, uint32_t deadNs);
+void motorPwmWrite(const MotorPwm *m, const uint32_t *vals);
+void motorPwmEnd(MotorPwm *m);
+
+/* hardware servo pulses on a Timer_A CCR, see servoPwmBegin() */
+typedef struct ServoPwm {
+    void *timer;                /* Timer_A_Type, NULL if not running */
+    volatile uint16_t *ccr;     /* the output's TAxCCRn */
+    uint16_t period;            /* timer counts per period, TAxCCR0 + 1 */
+    uint32_t periodUs;
+    uint8_t pin;
+} ServoPwm;
+
+bool servoPwmBegin(ServoPwm *s, uint8_t pin, uint32_t periodUs, uint32_t us);
+void servoPwmWrite(const ServoPwm *s, uint32_t us);
+void servoPwmEnd(ServoPwm *s);
+
+/* Timer_A owners, see timerReserve() */
+#define TIMER_OWNER_NONE    0
+#define TIMER_OWNER_PWM     1   /* analogWrite(), pwmChannelBegin(), ... */
+#define TIMER_OWNER_TONE    2
+#define TIMER_OWNER_SERVO   3
+#define TIMER_OWNER_SKETCH  4   /* kept from the core for the sketch */
+#define TIMER_OWNER_UNKNOWN 5   /* in use outside the core's bookkeeping */
+
+bool timerReserve(uint8_t timer, uint8_t owner);
+void timerRelease(uint8_t timer);
+uint8_t timerOwner(uint8_t timer, uint8_t *ccrs);
+
+/* implemented in msp432/wiring_microtimer.c */
+typedef void (*MicroTimerFxn)(uintptr_t arg);
+
+/* a software timer on the shared Timer32, see microTimerStart() */
+typedef struct MicroTimer {
+    struct MicroTimer *next;    /* queue link, sorted by due */
+    uint64_t due;               /* micros64() of the next expiry */
+    uint32_t period;            /* us, 0 for one-shot */
+    MicroTimerFxn fxn;
+    uintptr_t arg;
+    bool active;
+} MicroTimer;
+
+bool microTimerStart(MicroTimer *timer, MicroTimerFxn fxn, uintptr_t arg,
+    uint32_t us, uint32_t periodUs);
+void microTimerNext(MicroTimer *timer, uint32_t us);
+void microTimerStop(MicroTimer *timer);
+bool microTimerActive(const MicroTimer *timer);
 void analogReadResolution(uint16_t);
 
+/* implemented in msp432/wiring_adc14.c */
+void analogReadMulti(const uint8_t *pins, uint16_t *out, uint8_t count);
+uint16_t analogReadOversampled(uint8_t pin, uint8_t log2Samples);
+void analogReadAveraging(uint8_t log2Samples);
+
+/* an analog pin resolved once, for repeated analogPinRead() calls */
+typedef struct AnalogPin {
+    uint32_t mctl;      /* ADC14MCTL0: reference and channel */
+    uint8_t rshift;     /* analogReadResolution() scaling */
+    uint8_t lshift;
+} AnalogPin;
+
+bool analogPinBegin(AnalogPin *ap, uint8_t pin);
+uint16_t analogPinRead(const AnalogPin *ap);
+int32_t analogPinReadQ15(const AnalogPin *ap);
+int32_t analogReadQ15(uint8_t pin);
+
+/* analogWatch() callback states */
+#define ANALOG_WATCH_BELOW  -1
+#define ANALOG_WATCH_INSIDE 0
+#define ANALOG_WATCH_ABOVE  1
+
+typedef void (*AnalogWatchCallback)(uint8_t pin, uint16_t value, int state);
+bool analogWatch(uint8_t pin, uint16_t low, uint16_t high,
+    AnalogWatchCallback fxn);
+void analogWatchEnd(void);
+
 void delay(uint32_t milliseconds);
 
 /* Implemented in wiring.c */
-void delayMicroseconds(unsigned int us);
+void delayMicrosecondsSpin(unsigned int us);
 unsigned long micros();
-unsigned long millis();
+uint64_t micros64(void);
+void cyclesEnable(void);
+
+/* milliseconds since boot, kept by the Clock tick; read by millis() */
+extern volatile uint32_t millisCount;
+
+/*
+ *  ======== millis ========
+ *  Milliseconds since boot: one load of millisCount, no call.
+ */
+static inline unsigned long millis(void)
+{
+    return (millisCount);
+}
+
+/*
+ *  ======== cycles ========
+ *  The Cortex-M4 DWT cycle counter, in MCLK cycles. It wraps every
+ *  2^32 cycles (~89s at 48MHz); time spans with unsigned subtraction,
+ *  cycles() - start, are wrap-safe up to that.
+ */
+static inline uint32_t cycles(void)
+{
+    /* DWT_CTRL CYCCNTENA, DWT_CYCCNT */
+    if (!(*(volatile uint32_t *)0xE0001000 & 1)) {
+        cyclesEnable();
+    }
+
+    return (*(volatile uint32_t *)0xE0001004);
+}
+
+/* MCLK cycles per us, 0 until micros()/delayMicroseconds() first run */
+extern uint32_t delayCyclesPerUs;
+
+#define DELAY_US_INLINE_MAX 100
+
+/*
+ *  ======== delayMicrosecondsInline ========
+ *  delayMicroseconds() for constants: no call, the cycle count is one
+ *  multiply, so even 1us delays are exact to a few cycles.
+ */
+static inline __attribute__((always_inline)) void delayMicrosecondsInline(
+    uint32_t us)
+{
+    uint32_t start = *(volatile uint32_t *)0xE0001004;
+    uint32_t n = us * delayCyclesPerUs;
+
+    if (n == 0) {
+        delayMicrosecondsSpin(us);
+        return;
+    }
+
+    while ((*(volatile uint32_t *)0xE0001004 - start) < n) {
+        ;
+    }
+}
+
+/*
+ *  ======== delayMicroseconds ========
+ *  Constants up to DELAY_US_INLINE_MAX go inline, the rest to
+ *  delayMicrosecondsSpin() in wiring.c.
+ */
+static inline __attribute__((always_inline)) void delayMicroseconds(
+    unsigned int us)
+{
+    if (__builtin_constant_p(us) && us <= DELAY_US_INLINE_MAX) {
+        delayMicrosecondsInline(us);
+    }
+    else {
+        delayMicrosecondsSpin(us);
+    }
+}
 
 void setDelayResolution(uint32_t milliseconds);
 
+/* PowerMSP432_perfLevels[] index: 0 = 12MHz, 1 = 24MHz, 2 = 48MHz MCLK */
+bool setPerformanceLevel(uint8_t level);
+uint8_t getPerformanceLevel(void);
+
+/* setIdleMode(): deepest state the idle loop enters */
+#define IDLE_WFI                0   /* WFI only */
+#define IDLE_SLEEP              1   /* LPM0 */
+#define IDLE_DEEPSLEEP          2   /* LPM3, tickless; the default */
+
+bool setIdleMode(uint8_t mode);
+uint8_t getIdleMode(void);
+
+/* LPM3.5 until an RTC alarm or event, which resets the board */
+bool powerShutdown(void);
+bool powerWokeFromShutdown(void);
+
+/* idle states of the wiring Power policy, see powerStatsGet() */
+#define POWER_STATS_WFI         0   /* WFI only, DISALLOW_SLEEP held */
+#define POWER_STATS_SLEEP       1   /* LPM0 */
+#define POWER_STATS_DEEPSLEEP_0 2   /* LPM3, tickless */
+#define POWER_STATS_STATES      3
+
+#define POWER_STATS_IRQS        64  /* NVIC interrupts, INT_xxx - 16 */
+
+typedef struct PowerStats {
+    uint64_t elapsedUs;                     /* since powerStatsReset() */
+    uint64_t stateUs[POWER_STATS_STATES];   /* residency per state */
+    uint32_t stateCount[POWER_STATS_STATES];
+    uint32_t wakeups[POWER_STATS_IRQS];     /* wakeups per interrupt */
+} PowerStats;
+
+void powerStatsGet(PowerStats *stats);
+void powerStatsReset(void);
+
+/* boot stages from Board_init() on, see bootTraceMark() */
+#define BOOT_TRACE_STAGES       16
+
+typedef struct BootTraceStage {
+    const char *name;           /* stage that ended here */
+    uint32_t us;                /* since Board_init() entry */
+} BootTraceStage;
+
+void bootTraceMark(const char *name);
+uint8_t bootTraceGet(BootTraceStage *stages, uint8_t max);
+
 /* our interrupt APIs take pin numbers */
 #define digitalPinToInterrupt(pin) pin
 
 /* implemented in WInterrupts.c */
 void attachInterrupt(uint8_t, void (*)(void), int mode);
+void attachInterruptArg(uint8_t, void (*)(void *), void *, int mode);
+bool attachInterruptDirect(uint8_t, void (*)(void *), void *, int mode);
+
+/* post to a task-level waiter instead of running code in the Hwi */
+void attachInterruptSemaphore(uint8_t, Semaphore_Handle, int mode);
+void attachInterruptEvent(uint8_t, Event_Handle, UInt eventIds, int mode);
+void attachInterruptSwi(uint8_t, Swi_Handle, int mode);
+uint32_t interruptTime(uint8_t);
 void detachInterrupt(uint8_t);
 
+/* implemented in wiring_debounce.c */
+typedef void (*DebounceCallback)(uint8_t pin, int level);
+bool attachDebounce(uint8_t pin, DebounceCallback fxn, int mode);
+void detachDebounce(uint8_t pin);
+int debouncedRead(uint8_t pin);
+void setDebounceTime(uint32_t milliseconds);
+
 void disablePinInterrupt(uint8_t pin);
 void enablePinInterrupt(uint8_t pin);
 
@@ -173,6 +456,18 @@ uint16_t makeWord(byte h, byte l);
 
 unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeout = 1000000L);
 
+static inline void shiftOut(uint8_t dataPin, uint8_t clockPin,
+    uint8_t bitOrder, const uint8_t *buf, size_t len)
+{
+    shiftOutBuffer(dataPin, clockPin, bitOrder, buf, len);
+}
+
+static inline void shiftIn(uint8_t dataPin, uint8_t clockPin,
+    uint8_t bitOrder, uint8_t *buf, size_t len)
+{
+    shiftInBuffer(dataPin, clockPin, bitOrder, buf, len);
+}
+
 void tone(uint8_t _pin, unsigned int frequency, unsigned long duration = 0);
 void noTone(uint8_t _pin);
 
@@ -185,5 +480,16 @@ long map(long, long, long, long, long);
 #endif
 
 #include "pins_energia.h"
+#include "wiring_fast.h"
+#include "wiring_fixed.h"
+#include "wiring_random.h"
+#include "wiring_pulse.h"
+#include "wiring_edgelog.h"
+#include "wiring_trace.h"
+#include "wiring_log.h"
+#include "wiring_profile.h"
+#include "wiring_sampler.h"
+#include "wiring_dma.h"
+#include "wiring_nvs.h"
 
 #endif
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== EventGroup.h ========
+ *  One task blocking on several sources at once, instead of polling
+ *  each in turn:
+ *
+ *      #define EV_SERIAL  0x1
+ *      #define EV_RADIO   0x2
+ *      #define EV_BUTTON  0x4
+ *
+ *      EventGroup events;
+ *
+ *      Serial.setRxEvent(events.handle(), EV_SERIAL);
+ *      Radio.setReceiveEvent(events.handle(), EV_RADIO);
+ *      events.attachInterrupt(PUSH1, EV_BUTTON, FALLING);
+ *
+ *      uint32_t got = events.waitAny(EV_SERIAL | EV_RADIO | EV_BUTTON, 100);
+ *      if (got == 0) ...           // 100 ticks and none came
+ *
+ *  Bits are posted from any context, up to 32 of them, and a wait
+ *  returns and clears the ones it was waiting for. Posting a bit that
+ *  is already posted does nothing, so a source posts once for all it
+ *  has to say until the waiter gets to it. Only one task may wait on
+ *  an EventGroup at a time. Timeouts are Clock ticks.
+ */
+
+#ifndef EventGroup_h
+#define EventGroup_h
+
+#include <stdint.h>
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Event.h>
+
+class EventGroup
+{
+    public:
+        EventGroup(void) { Event_construct(&event, NULL); }
+        ~EventGroup() { Event_destruct(&event); }
+
+        void post(uint32_t bits) { Event_post(handle(), bits); }
+
+        /* the bits that came, 0 on timeout */
+        uint32_t waitAny(uint32_t bits, uint32_t timeout = BIOS_WAIT_FOREVER)
+        {
+            return (Event_pend(handle(), Event_Id_NONE, bits, timeout));
+        }
+
+        /* bits once all of them came, 0 on timeout */
+        uint32_t waitAll(uint32_t bits, uint32_t timeout = BIOS_WAIT_FOREVER)
+        {
+            return (Event_pend(handle(), bits, Event_Id_NONE, timeout));
+        }
+
+        /* posted and not waited for yet */
+        uint32_t posted(void) { return (Event_getPostedEvents(handle())); }
+
+        /* post bits on each edge of pin */
+        void attachInterrupt(uint8_t pin, uint32_t bits, int mode)
+        {
+            attachInterruptEvent(pin, handle(), bits, mode);
+        }
+
+        Event_Handle handle(void) { return (Event_handle(&event)); }
+
+    private:
+        EventGroup(const EventGroup &);
+        EventGroup &operator=(const EventGroup &);
+
+        Event_Struct event;
+};
+
+#endif
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+#include "wiring_private.h"
+#include "FrequencyCounter.h"
+
+#include <ti/drivers/Power.h>
+#include <ti/drivers/power/PowerMSP432.h>
+#include <ti/drivers/capture/CaptureMSP432.h>
+#ifdef __cplusplus
+}   /* CaptureMSP432.h opens an extern "C" block it never closes */
+#endif
+#include <ti/drivers/timer/TimerMSP432.h>
+
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
+
+#include <driverlib/rom.h>
+#include <driverlib/rom_map.h>
+#include <driverlib/gpio.h>
+#include <driverlib/interrupt.h>
+#include <driverlib/timer_a.h>
+
+extern const Capture_Config Capture_config[];
+
+/* the Timer_A clock inputs wired to header pins, bar Clock's Timer_A3 */
+static const struct {
+    uint8_t pin;
+    uint8_t port;
+    uint16_t mask;
+    uint32_t timer;
+    uint8_t intNum;
+} clockInputs[] = {
+    {25, GPIO_PORT_P4, GPIO_PIN2, TIMER_A2_BASE, INT_TA2_N},
+};
+
+#define NUM_CLOCK_INPUTS (sizeof(clockInputs) / sizeof(clockInputs[0]))
+
+static FrequencyCounter *captureCounters[PULSE_CAPTURES_MAX];
+
+static uint32_t timestampHz;
+
+FrequencyCounter::FrequencyCounter(void)
+{
+    clockInput = -1;
+    capture = -1;
+    handle = NULL;
+}
+
+/*
+ *  ======== begin ========
+ *  Returns false if the pin is neither a timer clock nor a capture
+ *  input, or its timer is taken (PWM, Clock, pulseIn, another
+ *  counter).
+ */
+bool FrequencyCounter::begin(uint8_t pin)
+{
+    Types_FreqHz freq;
+    unsigned int i;
+
+    end();
+
+    if (timestampHz == 0) {
+        Timestamp_getFreq(&freq);
+        timestampHz = freq.lo;
+    }
+
+    this->pin = pin;
+    overflows = 0;
+    edges = 0;
+    periodEdges = 0;
+    periodCounts = 0;
+    edgeTime = 0;
+    lastCount = 0;
+    lastFrequency = 0;
+
+    for (i = 0; i < NUM_CLOCK_INPUTS; i++) {
+        if (clockInputs[i].pin == pin) {
+            break;
+        }
+    }
+
+    if (i < NUM_CLOCK_INPUTS) {
+        Timer_A_ContinuousModeConfig config = {
+            TIMER_A_CLOCKSOURCE_EXTERNAL_TXCLK,
+            TIMER_A_CLOCKSOURCE_DIVIDER_1,
+            TIMER_A_TAIE_INTERRUPT_ENABLE,
+            TIMER_A_DO_CLEAR
+        };
+        Hwi_Params params;
+
+        if (!TimerMSP432_allocateTimerResource(clockInputs[i].timer)) {
+            return (false);
+        }
+
+        Hwi_Params_init(&params);
+        params.arg = (UArg)this;
+        Hwi_construct(&hwiStruct, clockInputs[i].intNum, overflowFxn,
+            &params, NULL);
+
+        MAP_GPIO_setAsPeripheralModuleFunctionInputPin(clockInputs[i].port,
+            clockInputs[i].mask, GPIO_PRIMARY_MODULE_FUNCTION);
+        digital_pin_to_pin_function[pin] = PIN_FUNC_UNUSED;
+
+        /* the timer keeps counting in LPM3, not deeper */
+        Power_setConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_1);
+
+        clockInput = i;
+        lastTime = Timestamp_get32();
+
+        MAP_Timer_A_configureContinuousMode(clockInputs[i].timer, &config);
+        MAP_Timer_A_startCounter(clockInputs[i].timer,
+            TIMER_A_CONTINUOUS_MODE);
+
+        return (true);
+    }
+
+    capture = digitalPinToCapture(pin);
+    if (capture >= 0) {
+        CaptureMSP432_HWAttrs const *hwAttrs;
+        PowerMSP432_Freqs freqs;
+        Capture_Params params;
+
+        Capture_Params_init(&params);
+        params.mode = Capture_RISING_EDGE;
+        params.callbackFxn = captureFxn;
+        params.periodUnit = Capture_PERIOD_COUNTS;
+
+        handle = Capture_open(capture, &params);
+        if (handle == NULL) {
+            capture = -1;
+            return (false);
+        }
+        digital_pin_to_pin_function[pin] = PIN_FUNC_UNUSED;
+
+        hwAttrs = (CaptureMSP432_HWAttrs const *)handle->hwAttrs;
+        PowerMSP432_getFreqs(Power_getPerformanceLevel(), &freqs);
+        countHz = (hwAttrs->clockSource == TIMER_A_CLOCKSOURCE_SMCLK ?
+            freqs.SMCLK : freqs.ACLK) / hwAttrs->clockDivider;
+
+        captureCounters[capture] = this;
+        lastTime = Timestamp_get32();
+        Capture_start(handle);
+
+        return (true);
+    }
+
+    return (false);
+}
+
+/*
+ *  ======== end ========
+ *  Stop counting and give the timer back; the pin is left an input.
+ *  Task context.
+ */
+void FrequencyCounter::end(void)
+{
+    if (clockInput >= 0) {
+        MAP_Timer_A_stopTimer(clockInputs[clockInput].timer);
+        MAP_Timer_A_disableInterrupt(clockInputs[clockInput].timer);
+        Hwi_destruct(&hwiStruct);
+        TimerMSP432_freeTimerResource(clockInputs[clockInput].timer);
+        Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_1);
+        clockInput = -1;
+        pinMode(pin, INPUT);
+    }
+
+    if (capture >= 0) {
+        Capture_stop(handle);
+        captureCounters[capture] = NULL;
+        Capture_close(handle);
+        handle = NULL;
+        capture = -1;
+        pinMode(pin, INPUT);
+    }
+}
+
+/*
+ *  ======== overflowFxn ========
+ *  TAIFG, once every 65536 input edges.
+ */
+void FrequencyCounter::overflowFxn(UArg arg)
+{
+    FrequencyCounter *fc = (FrequencyCounter *)arg;
+
+    MAP_Timer_A_clearInterruptFlag(clockInputs[fc->clockInput].timer);
+    fc->overflows++;
+}
+
+/*
+ *  ======== captureFxn ========
+ *  Hwi context, every rising edge. The driver's interval is 16 bits
+ *  and off by one on a wrap, so the CCR is read here and the wraps are
+ *  recovered from the Timestamp, as pulseIn() does.
+ */
+void FrequencyCounter::captureFxn(Capture_Handle handle, uint32_t interval)
+{
+    CaptureMSP432_HWAttrs const *hwAttrs =
+        (CaptureMSP432_HWAttrs const *)handle->hwAttrs;
+    FrequencyCounter *fc =
+        captureCounters[handle - (Capture_Handle)Capture_config];
+    uint32_t now = Timestamp_get32();
+    uint32_t counts, elapsed;
+    uint16_t count;
+
+    (void)interval;
+
+    if (fc == NULL) {
+        return;
+    }
+
+    count = MAP_Timer_A_getCaptureCompareCount(hwAttrs->timerBaseAddress,
+        (hwAttrs->capturePort >> CAPTUREMSP432_CCR_OFS) & 0xf);
+
+    if (fc->edges++ != 0) {
+        counts = (uint16_t)(count - fc->edgeCount);
+        elapsed = (uint32_t)(((uint64_t)(now - fc->edgeTime) * fc->countHz)
+            / timestampHz);
+        if (elapsed > counts) {
+            counts += ((elapsed - counts + 0x8000) >> 16) << 16;
+        }
+        fc->periodCounts += counts;
+        fc->periodEdges++;
+    }
+
+    fc->edgeCount = count;
+    fc->edgeTime = now;
+}
+
+/*
+ *  ======== readCount ========
+ *  Overflow count and timer as one value. TAR runs off the async input
+ *  clock, the driverlib read takes a majority vote; an overflow not yet
+ *  serviced shows as TAIFG with TAR already small.
+ */
+uint32_t FrequencyCounter::readCount(void)
+{
+    uint32_t timer = clockInputs[clockInput].timer;
+    uint32_t high;
+    uint16_t low;
+    uintptr_t key;
+
+    key = Hwi_disable();
+    high = overflows;
+    low = MAP_Timer_A_getCounterValue(timer);
+    if (MAP_Timer_A_getInterruptStatus(timer) == TIMER_A_INTERRUPT_PENDING
+        && low < 0x8000) {
+        high++;
+    }
+    Hwi_restore(key);
+
+    return ((high << 16) | low);
+}
+
+/*
+ *  ======== count ========
+ */
+uint32_t FrequencyCounter::count(void)
+{
+    if (clockInput >= 0) {
+        return (readCount());
+    }
+
+    return (edges);
+}
+
+/*
+ *  ======== frequency ========
+ *  Average since the previous call (since begin() for the first).
+ *  Calls less than 1 ms apart return the previous result. With no
+ *  edge in the window, a captured signal reads 0 once two of its last
+ *  periods have gone by.
+ */
+float FrequencyCounter::frequency(void)
+{
+    uint32_t now = Timestamp_get32();
+    uint32_t elapsed = now - lastTime;
+    uint32_t n, counts;
+    uintptr_t key;
+
+    if (clockInput >= 0) {
+        if (elapsed < timestampHz / 1000) {
+            return (lastFrequency);
+        }
+
+        n = readCount();
+        lastFrequency = (float)(n - lastCount) * timestampHz / elapsed;
+        lastCount = n;
+        lastTime = now;
+
+        return (lastFrequency);
+    }
+
+    if (capture < 0) {
+        return (0);
+    }
+
+    key = Hwi_disable();
+    n = periodEdges;
+    counts = periodCounts;
+    periodEdges = 0;
+    periodCounts = 0;
+    Hwi_restore(key);
+
+    if (n != 0) {
+        lastFrequency = (float)n * countHz / counts;
+        lastTime = now;
+    }
+    else if (lastFrequency * elapsed > 2.0f * timestampHz) {
+        lastFrequency = 0;
+    }
+
+    return (lastFrequency);
+}
+
+/*
+ *  ======== period ========
+ */
+float FrequencyCounter::period(void)
+{
+    float f = frequency();
+
+    return (f > 0 ? 1000000.0f / f : 0);
+}
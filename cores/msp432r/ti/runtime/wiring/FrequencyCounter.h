@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== FrequencyCounter.h ========
+ *  Frequency and period of a pulse train, measured by a Timer_A
+ *  instead of an interrupt per edge.
+ *
+ *  On the timer clock input, pin 25 = P4.2 = TA2CLK, the signal clocks
+ *  the timer itself: edges are counted in hardware with one overflow
+ *  interrupt per 65536 edges, so rates of several MHz cost no CPU.
+ *  (TA3CLK is not offered, Clock runs on Timer_A3.) frequency() divides the edges seen since
+ *  the previous call by the time elapsed, so its resolution is one
+ *  edge per call interval.
+ *
+ *  On any other pin with a Capture_config[] entry the timer runs from
+ *  SMCLK and timestamps each rising edge. That costs an interrupt per
+ *  edge, keep it for signals below a few tens of kHz, but resolves a
+ *  single period to 1/SMCLK, which is what slow flow meters and
+ *  tachometers need.
+ *
+ *      FrequencyCounter tach;
+ *
+ *      tach.begin(25);
+ *      ...
+ *      rpm = tach.frequency() * 60 / PULSES_PER_REV;
+ *
+ *  Both use the whole Timer_A2: a counter on TA2CLK excludes the
+ *  capture pins, pulseIn() on them and analogWrite() on P5.6, P5.7,
+ *  P6.6 and P6.7, and vice versa.
+ */
+
+#ifndef FrequencyCounter_h
+#define FrequencyCounter_h
+
+#include <stdint.h>
+
+#include <ti/drivers/Capture.h>
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+class FrequencyCounter
+{
+    public:
+        FrequencyCounter(void);
+
+        bool begin(uint8_t pin);
+        void end(void);
+
+        uint32_t count(void);       /* edges since begin(), wraps */
+        float frequency(void);      /* Hz since the previous call */
+        float period(void);         /* microseconds, 0 if no signal */
+
+        bool isHardwareCounting(void) { return (clockInput >= 0); }
+
+    private:
+        static void overflowFxn(UArg arg);
+        static void captureFxn(Capture_Handle handle, uint32_t interval);
+
+        uint32_t readCount(void);
+
+        uint8_t pin;
+        int8_t clockInput;          /* clockInputs[] index, or -1 */
+        int8_t capture;             /* Capture_config[] index, or -1 */
+
+        /* clock input: the timer is the low half of the count */
+        Hwi_Struct hwiStruct;
+        volatile uint32_t overflows;
+
+        /* capture: rising edge periods summed between frequency() calls */
+        Capture_Handle handle;
+        uint32_t countHz;
+        volatile uint32_t edges;
+        volatile uint32_t periodEdges;
+        volatile uint32_t periodCounts;
+        uint16_t edgeCount;
+        uint32_t edgeTime;
+
+        uint32_t lastCount;
+        uint32_t lastTime;
+        float lastFrequency;
+};
+
+#endif
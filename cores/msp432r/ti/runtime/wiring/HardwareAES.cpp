@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+#include "HardwareAES.h"
+
+#include <ti/devices/msp432p4xx/inc/msp.h>
+#include "Mutex.h"
+
+static Mutex aesLock;
+
+/* whose key the module holds, and in which direction */
+static const AES *aesKeyOwner = NULL;
+static bool aesKeyDecrypt;
+
+/*
+ *  ======== aesBlock ========
+ *  One block through the module with the loaded key, as driverlib's
+ *  AES256_encryptData() does it. in and out may be the same.
+ */
+static void aesBlock(const uint8_t *in, uint8_t *out)
+{
+    uint16_t word;
+    int i;
+
+    for (i = 0; i < AES_BLOCK_SIZE; i += 2) {
+        AES256->DIN = in[i] | (in[i + 1] << 8);
+    }
+    AES256->STAT |= AES256_STAT_KEYWR;
+
+    while (AES256->STAT & AES256_STAT_BUSY) {
+        ;
+    }
+
+    for (i = 0; i < AES_BLOCK_SIZE; i += 2) {
+        word = AES256->DOUT;
+        out[i] = word;
+        out[i + 1] = word >> 8;
+    }
+}
+
+static inline void xorBlock(uint8_t *out, const uint8_t *a, const uint8_t *b)
+{
+    int i;
+
+    for (i = 0; i < AES_BLOCK_SIZE; i++) {
+        out[i] = a[i] ^ b[i];
+    }
+}
+
+AES::AES(void)
+{
+    keyBits = 0;
+}
+
+bool AES::begin(const uint8_t *key, uint16_t keyBits)
+{
+    if (keyBits != 128 && keyBits != 192 && keyBits != 256) {
+        return (false);
+    }
+
+    end();
+
+    MutexLock lock(aesLock);
+
+    memcpy(this->key, key, keyBits / 8);
+    this->keyBits = keyBits;
+
+    return (true);
+}
+
+void AES::end(void)
+{
+    volatile uint8_t *p = key;
+    size_t i;
+
+    MutexLock lock(aesLock);
+
+    for (i = 0; i < sizeof(key); i++) {
+        p[i] = 0;
+    }
+    keyBits = 0;
+
+    if (aesKeyOwner == this) {
+        AES256->CTL0 = AES256_CTL0_SWRST;
+        aesKeyOwner = NULL;
+    }
+}
+
+/*
+ *  ======== load ========
+ *  Give the module this key, for encryption or as the first round
+ *  key for decryption (generated by the module, AESOP 2, then used
+ *  with AESOP 3). Called with aesLock held.
+ */
+void AES::load(bool decrypt)
+{
+    uint16_t length;
+    int i;
+
+    if (aesKeyOwner == this && aesKeyDecrypt == decrypt) {
+        return;
+    }
+
+    length = keyBits == 128 ? AES256_CTL0_KL__128BIT :
+        keyBits == 192 ? AES256_CTL0_KL__192BIT : AES256_CTL0_KL__256BIT;
+
+    AES256->CTL0 = AES256_CTL0_SWRST;
+    AES256->CTL0 = length | (decrypt ? AES256_CTL0_OP_2 : AES256_CTL0_OP_0);
+
+    for (i = 0; i < keyBits / 8; i += 2) {
+        AES256->KEY = key[i] | (key[i + 1] << 8);
+    }
+
+    if (decrypt) {
+        while (AES256->STAT & AES256_STAT_BUSY) {
+            ;
+        }
+        AES256->CTL0 = length | AES256_CTL0_OP_3;
+    }
+    else {
+        while (!(AES256->STAT & AES256_STAT_KEYWR)) {
+            ;
+        }
+    }
+
+    aesKeyOwner = this;
+    aesKeyDecrypt = decrypt;
+}
+
+bool AES::encryptECB(const uint8_t *in, uint8_t *out, size_t length)
+{
+    size_t n;
+
+    if (keyBits == 0 || length % AES_BLOCK_SIZE != 0) {
+        return (false);
+    }
+
+    MutexLock lock(aesLock);
+
+    load(false);
+    for (n = 0; n < length; n += AES_BLOCK_SIZE) {
+        aesBlock(in + n, out + n);
+    }
+
+    return (true);
+}
+
+bool AES::decryptECB(const uint8_t *in, uint8_t *out, size_t length)
+{
+    size_t n;
+
+    if (keyBits == 0 || length % AES_BLOCK_SIZE != 0) {
+        return (false);
+    }
+
+    MutexLock lock(aesLock);
+
+    load(true);
+    for (n = 0; n < length; n += AES_BLOCK_SIZE) {
+        aesBlock(in + n, out + n);
+    }
+
+    return (true);
+}
+
+bool AES::encryptCBC(uint8_t *iv, const uint8_t *in, uint8_t *out,
+    size_t length)
+{
+    uint8_t block[AES_BLOCK_SIZE];
+    size_t n;
+
+    if (keyBits == 0 || length % AES_BLOCK_SIZE != 0) {
+        return (false);
+    }
+
+    MutexLock lock(aesLock);
+
+    load(false);
+    for (n = 0; n < length; n += AES_BLOCK_SIZE) {
+        xorBlock(block, in + n, iv);
+        aesBlock(block, out + n);
+        memcpy(iv, out + n, AES_BLOCK_SIZE);
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== decryptCBC ========
+ *  The cipher block is kept before it's decrypted, in and out may be
+ *  the same
+ */
+bool AES::decryptCBC(uint8_t *iv, const uint8_t *in, uint8_t *out,
+    size_t length)
+{
+    uint8_t cipher[AES_BLOCK_SIZE];
+    size_t n;
+
+    if (keyBits == 0 || length % AES_BLOCK_SIZE != 0) {
+        return (false);
+    }
+
+    MutexLock lock(aesLock);
+
+    load(true);
+    for (n = 0; n < length; n += AES_BLOCK_SIZE) {
+        memcpy(cipher, in + n, AES_BLOCK_SIZE);
+        aesBlock(cipher, out + n);
+        xorBlock(out + n, out + n, iv);
+        memcpy(iv, cipher, AES_BLOCK_SIZE);
+    }
+
+    return (true);
+}
+
+bool AES::ctr(uint8_t *counter, const uint8_t *in, uint8_t *out,
+    size_t length)
+{
+    uint8_t stream[AES_BLOCK_SIZE];
+    size_t n, i, count;
+    int byte;
+
+    if (keyBits == 0) {
+        return (false);
+    }
+
+    MutexLock lock(aesLock);
+
+    load(false);
+    for (n = 0; n < length; n += count) {
+        aesBlock(counter, stream);
+
+        count = length - n < AES_BLOCK_SIZE ? length - n : AES_BLOCK_SIZE;
+        for (i = 0; i < count; i++) {
+            out[n + i] = in[n + i] ^ stream[i];
+        }
+
+        for (byte = AES_BLOCK_SIZE - 1; byte >= 0 && ++counter[byte] == 0;
+            byte--) {
+            ;
+        }
+    }
+
+    return (true);
+}
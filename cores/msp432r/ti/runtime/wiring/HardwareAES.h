@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== HardwareAES.h ========
+ *  AES-128/192/256 on the AES256 accelerator, ECB, CBC and CTR:
+ *
+ *      AES aes;
+ *      uint8_t iv[AES_BLOCK_SIZE];
+ *
+ *      aes.begin(key, 256);
+ *      aes.encryptCBC(iv, plain, cipher, 64);      // iv: 16 random bytes
+ *      aes.ctr(counter, in, out, length);          // either direction
+ *
+ *  A block takes the module 168 (AES-128) to 234 (AES-256) MCLK cycles
+ *  plus 16 bus accesses to load and unload, several times faster than
+ *  a table based software AES and without its tables in flash. The
+ *  modes' chaining XORs are done on the CPU between blocks.
+ *
+ *  The module holds one key, so each object keeps its own copy and
+ *  reloads the module only when another object, or a switch between
+ *  encrypting and decrypting, changed it. Like the CRC classes it is
+ *  shared under a Mutex: tasks only.
+ *
+ *  ECB and CBC work on whole blocks, length must be a multiple of
+ *  AES_BLOCK_SIZE; CBC leaves the last cipher block in iv, so a
+ *  message can be processed in pieces. CTR takes any length and
+ *  increments counter (big endian, all 16 bytes) per block used; a
+ *  partial last block's key stream is dropped, so a piece other than
+ *  the last should be a multiple of the block size.
+ *
+ *  The accelerator's DMA triggers are wired to uDMA channels 0 to 2,
+ *  which the SPI and Serial drivers use, so blocks are fed by the CPU.
+ */
+
+#ifndef HardwareAES_h
+#define HardwareAES_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define AES_BLOCK_SIZE  16
+
+class AES
+{
+    public:
+        AES(void);
+        ~AES(void) { end(); }
+
+        /* keyBits 128, 192 or 256; the key is copied */
+        bool begin(const uint8_t *key, uint16_t keyBits = 256);
+        void end(void);             /* wipes the key */
+
+        bool encryptECB(const uint8_t *in, uint8_t *out, size_t length);
+        bool decryptECB(const uint8_t *in, uint8_t *out, size_t length);
+        bool encryptCBC(uint8_t *iv, const uint8_t *in, uint8_t *out,
+            size_t length);
+        bool decryptCBC(uint8_t *iv, const uint8_t *in, uint8_t *out,
+            size_t length);
+        bool ctr(uint8_t *counter, const uint8_t *in, uint8_t *out,
+            size_t length);
+
+    private:
+        void load(bool decrypt);
+
+        uint8_t key[32];
+        uint16_t keyBits;           /* 0 before begin() */
+};
+
+#endif
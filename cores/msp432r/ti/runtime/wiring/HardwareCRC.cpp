@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+#include "HardwareCRC.h"
+
+#include <ti/devices/msp432p4xx/inc/msp.h>
+#include "Mutex.h"
+
+/*
+ * The module processes a word written to DI32 / DI16 from bit 0 up and
+ * one written to DIRB32 / DIRB16 from its top bit down; INIRES holds
+ * the shift register, RESR the same bit reversed. So CRC-32, which is
+ * LSB first, feeds DI32 and reads RESR32, and CCITT, MSB first, feeds
+ * DIRB16 and reads INIRES16. Little endian halfwords go to DI32 as
+ * they are; for DIRB16 their bytes are swapped, so that the first byte
+ * is the first one shifted in.
+ */
+static Mutex crcLock;
+
+/*
+ *  ======== update ========
+ *  The seed register is not reversed: crc goes in bit reversed
+ */
+void Crc32::update(const void *data, size_t length)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t seed = __RBIT(crc);
+    MutexLock lock(crcLock);
+
+    CRC32->INIRES32_HI = seed >> 16;
+    CRC32->INIRES32_LO = seed;
+
+    if (((uintptr_t)p & 1) && length != 0) {
+        *(volatile uint8_t *)&CRC32->DI32 = *p++;
+        length--;
+    }
+    for (; length >= 2; length -= 2, p += 2) {
+        CRC32->DI32 = *(const uint16_t *)p;
+    }
+    if (length != 0) {
+        *(volatile uint8_t *)&CRC32->DI32 = *p;
+    }
+
+    crc = ((uint32_t)CRC32->RESR32_HI << 16) | CRC32->RESR32_LO;
+}
+
+uint32_t Crc32::compute(const void *data, size_t length)
+{
+    Crc32 crc;
+
+    crc.update(data, length);
+
+    return (crc.value());
+}
+
+void Crc16::update(const void *data, size_t length)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    MutexLock lock(crcLock);
+
+    CRC32->INIRES16 = crc;
+
+    if (((uintptr_t)p & 1) && length != 0) {
+        *(volatile uint8_t *)&CRC32->DIRB16 = *p++;
+        length--;
+    }
+    for (; length >= 2; length -= 2, p += 2) {
+        CRC32->DIRB16 = __REV16(*(const uint16_t *)p);
+    }
+    if (length != 0) {
+        *(volatile uint8_t *)&CRC32->DIRB16 = *p;
+    }
+
+    crc = CRC32->INIRES16;
+}
+
+uint16_t Crc16::compute(const void *data, size_t length)
+{
+    Crc16 crc;
+
+    crc.update(data, length);
+
+    return (crc.value());
+}
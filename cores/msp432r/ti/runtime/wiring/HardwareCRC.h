@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== HardwareCRC.h ========
+ *  CRC-32 and CRC-16 on the CRC32 module, which takes a byte or a
+ *  16 bit word per bus write instead of a table lookup per byte:
+ *
+ *      Crc32 crc;
+ *
+ *      crc.update(header, sizeof(header));
+ *      crc.update(payload, length);
+ *      if (crc.value() != received) ...
+ *
+ *      uint16_t check = Crc16::compute(frame, length);
+ *
+ *  Crc32 is the CRC-32 of zlib, Ethernet and PNG (reflected 0x04C11DB7,
+ *  initial and final XOR 0xFFFFFFFF): "123456789" gives 0xCBF43926.
+ *  Crc16 is CRC-16/CCITT-FALSE (0x1021, MSB first, initial 0xFFFF, no
+ *  final XOR), the same as the FlashStore and FlashLog record CRCs:
+ *  "123456789" gives 0x29B1.
+ *
+ *  Each object keeps its own running value, so any number of them can
+ *  be updated in turn; each update() loads the module with it, feeds
+ *  the data and reads the result back, holding a Mutex meanwhile. So
+ *  update() is for tasks only, not for Hwis or Swis.
+ */
+
+#ifndef HardwareCRC_h
+#define HardwareCRC_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+class Crc32
+{
+    public:
+        Crc32(void) { reset(); }
+
+        void reset(void) { crc = 0xffffffff; }
+        void update(const void *data, size_t length);
+        uint32_t value(void) { return (~crc); }
+
+        static uint32_t compute(const void *data, size_t length);
+
+    private:
+        uint32_t crc;               /* reflected, before the final XOR */
+};
+
+class Crc16
+{
+    public:
+        Crc16(void) { reset(); }
+
+        void reset(void) { crc = 0xffff; }
+        void update(const void *data, size_t length);
+        uint16_t value(void) { return (crc); }
+
+        static uint16_t compute(const void *data, size_t length);
+
+    private:
+        uint16_t crc;
+};
+
+#endif
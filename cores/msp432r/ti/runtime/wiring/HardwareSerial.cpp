@@ -34,16 +34,180 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <ti/sysbios/BIOS.h>
 #include <ti/sysbios/family/arm/m3/Hwi.h>
+#include <ti/sysbios/knl/Task.h>
+
+#include <ti/drivers/uart/UARTMSP432.h>
+#include <ti/drivers/Power.h>
+#include <ti/drivers/power/PowerMSP432.h>
+
+#include <driverlib/rom.h>
+#include <driverlib/rom_map.h>
+#include <driverlib/dma.h>
+#include <driverlib/uart.h>
+#include <driverlib/interrupt.h>
+#include <driverlib/gpio.h>
+#include <driverlib/pmap.h>
+
+#include <ti/drivers/GPIO.h>
+#include <ti/drivers/gpio/GPIOMSP432.h>
 
 #include "wiring_private.h"
 #include "HardwareSerial.h"
+#include "HardwareCRC.h"
+
+extern "C" {
+extern const UART_Config UART_config[];
+extern UARTMSP432_HWAttrsV1 uartMSP432HWAttrs[];
+extern const GPIOMSP432_Config GPIOMSP432_config;
+extern const uint8_t pxmap[];
+}
 
 #define RX_BUFFER_EMPTY   (rxReadIndex == rxWriteIndex)
-#define RX_BUFFER_FULL    (((rxWriteIndex + 1) % SERIAL_RX_BUFFER_SIZE) == rxReadIndex)
+#define RX_BUFFER_FULL    (((rxWriteIndex + 1) & rxMask) == rxReadIndex)
+
+/* each uDMA ping-pong structure fills one half of rxBuffer */
+#define RX_DMA_HALF_SIZE  ((rxMask + 1) / 2)
+
+/* largest transfer a single uDMA structure can describe */
+#define RX_DMA_MAX_XFER   1024
+
+/*
+ * Per eUSCI_A module: RX uDMA trigger, port mapper functions (0 if the
+ * module can't be port mapped) and the fixed primary RX/TX pins in
+ * UARTMSP432 pin encoding (0 if none). Note that the Serial (A0) and
+ * Serial1 (A2) RX channels are shared with the SPI (B0) and SPI1 (B2)
+ * DMA channels respectively.
+ */
+static const struct {
+    uint32_t baseAddr;
+    uint32_t channel;
+    uint8_t pmapRx;
+    uint8_t pmapTx;
+    uint16_t fixedRx;
+    uint16_t fixedTx;
+} uartModules[] = {
+    {EUSCI_A0_BASE, DMA_CH1_EUSCIA0RX, PMAP_UCA0RXD, PMAP_UCA0TXD,
+        UARTMSP432_P1_2_UCA0RXD, UARTMSP432_P1_3_UCA0TXD},
+    {EUSCI_A1_BASE, DMA_CH3_EUSCIA1RX, PMAP_UCA1RXD, PMAP_UCA1TXD, 0, 0},
+    {EUSCI_A2_BASE, DMA_CH5_EUSCIA2RX, PMAP_UCA2RXD, PMAP_UCA2TXD, 0, 0},
+    {EUSCI_A3_BASE, DMA_CH7_EUSCIA3RX, 0, 0,
+        UARTMSP432_P9_6_UCA3RXD, UARTMSP432_P9_7_UCA3TXD},
+};
+
+#define NUM_UART_MODULES  (sizeof(uartModules) / sizeof(uartModules[0]))
+
+/* open HardwareSerial instance for each UART_config[] index */
+static HardwareSerial *serialPorts[SERIAL_MAX_PORTS];
+
+/*
+ *  ======== serialReadCallback ========
+ *  Shared UART driver callbacks; the handle is &UART_config[index]
+ */
+static RAMFUNC void serialReadCallback(UART_Handle uart, void *buf, size_t count)
+{
+    serialPorts[(UART_Config const *)uart - UART_config]->readCallback(uart, buf, count);
+}
+
+/*
+ *  ======== serialWriteCallback ========
+ */
+static RAMFUNC void serialWriteCallback(UART_Handle uart, void *buf, size_t count)
+{
+    serialPorts[(UART_Config const *)uart - UART_config]->writeCallback(uart, buf, count);
+}
+
+/*
+ *  ======== serialPerfChangeNotifyFxn ========
+ */
+static int serialPerfChangeNotifyFxn(unsigned int eventType,
+    uintptr_t eventArg, uintptr_t clientArg)
+{
+    ((HardwareSerial *)clientArg)->perfLevelChanged((unsigned int)eventArg);
+
+    return (Power_NOTIFYDONE);
+}
+
+/*
+ *  ======== findUartModule ========
+ */
+static int findUartModule(uint32_t baseAddr)
+{
+    unsigned int i;
+
+    for (i = 0; i < NUM_UART_MODULES; i++) {
+        if (uartModules[i].baseAddr == baseAddr) {
+            return (i);
+        }
+    }
+
+    return (-1);
+}
+
+/*
+ *  ======== encodeUartPin ========
+ *  UARTMSP432 rxPin/txPin encoding of Energia pin for the given port
+ *  mapper function (or fixed primary pin), or 0 if pin can't be used.
+ */
+static uint32_t encodeUartPin(uint8_t pin, uint8_t pmapValue, uint16_t fixedPin)
+{
+    uint16_t pinId;
+    uint8_t port, pinNum;
+
+    pinId = GPIOMSP432_config.pinConfigs[pin] & 0xffff;
+    port = pinId >> 8;
+
+    if ((pinId & 0xff) == 0) {
+        return (0);
+    }
+
+    pinNum = 0;
+    while (((1 << pinNum) & pinId) == 0) pinNum++;
+
+    /* only ports 2, 3 and 7 have a port mapper */
+    if (port == 2 || port == 3 || port == 7) {
+        if (pmapValue == 0) {
+            return (0);
+        }
+        return ((pmapValue << 10) | (port << 4) | pinNum);
+    }
+
+    if (fixedPin != 0 && (fixedPin & 0xff) == ((port << 4) | pinNum)) {
+        return (fixedPin);
+    }
 
-#define TX_BUFFER_EMPTY   (txReadIndex == txWriteIndex)
-#define TX_BUFFER_FULL    (((txWriteIndex + 1) % SERIAL_TX_BUFFER_SIZE) == txReadIndex)
+    return (0);
+}
+
+/*
+ *  ======== releaseUartPin ========
+ *  Undo UARTMSP432_open()'s port mapping and leave the pin a GPIO input
+ */
+static void releaseUartPin(uint32_t uartPin)
+{
+    uint8_t port = (uartPin >> 4) & 0xf;
+    uint8_t pinNum = uartPin & 0x7;
+
+    if ((uartPin >> 10) & 0x1f) {
+        /* the following code was extracted from PMAP_configurePort() */
+        PMAP->KEYID = PMAP_KEYID_VAL;
+        PMAP->CTL = (PMAP->CTL & ~PMAP_CTL_PRECFG) | PMAP_ENABLE_RECONFIGURATION;
+        HWREG8(PMAP_BASE + pinNum + pxmap[port]) = PMAP_NONE;
+        PMAP->KEYID = 0;
+    }
+
+    MAP_GPIO_setAsInputPin(port, 1 << pinNum);
+}
+
+/*
+ *  ======== rxDmaHwiFxn ========
+ *  dmaAttach() callback, arg is the HardwareSerial owning the channel
+ */
+static void rxDmaHwiFxn(uintptr_t arg)
+{
+    ((HardwareSerial *)arg)->rxDmaCallback();
+}
 
 HardwareSerial::HardwareSerial(void)
 {
@@ -71,8 +235,9 @@ HardwareSerial::HardwareSerial(unsigned long module, UART_Callback rCallback, UA
  */
 void HardwareSerial::init(unsigned long module, UART_Callback rCallback, UART_Callback tCallback)
 {
-    rxCallback = rCallback;
-    txCallback = tCallback;
+    /* by default, dispatch through the shared table-driven callbacks */
+    rxCallback = (rCallback != NULL) ? rCallback : serialReadCallback;
+    txCallback = (tCallback != NULL) ? tCallback : serialWriteCallback;
 
     /* by default, read() will not block */
     blockingModeEnabled = false;
@@ -80,20 +245,255 @@ void HardwareSerial::init(unsigned long module, UART_Callback rCallback, UART_Ca
     /* by default, read callback does not call UART_read() */
     useContinuousRead = false;
 
+    /* by default, rx chars are moved by the UART driver's ISR */
+    useRxDma = false;
+    rxDmaMode = false;
+    rxDmaHandle = NULL;
+    rxDmaOverruns = 0;
+
+    txWaiters = 0;
+    rxWaiters = 0;
+    rxEvent = NULL;
+    rxEventIds = 0;
+    rxOnDemand = false;
+    rxListening = false;
+    rxDemand = 0;
+    txAsyncBuffer = NULL;
+    txAsyncCallback = NULL;
+
+    frameMode = SERIAL_FRAME_NONE;
+    frameTerminator = '\n';
+    frameCheck = SERIAL_FRAME_CHECK_NONE;
+
+    baudCustom = false;
+    baudLevelMask = 0;
+
+    /* start with the statically allocated default rings */
+    rxBuffer = rxDefaultBuffer;
+    rxMask = SERIAL_RX_BUFFER_SIZE - 1;
+    txBuffer = txDefaultBuffer;
+    txRing.init(txBuffer, SERIAL_TX_BUFFER_SIZE);
+
     uartModule = module;
     begun = false;
 }
 
+/*
+ *  ======== allocBuffer ========
+ *  Point a ring at the default buffer or at a heap buffer of
+ *  size rounded up to a power of two, so indices can wrap with a mask.
+ */
+static unsigned char *allocBuffer(unsigned char *buf, unsigned char *defaultBuf,
+    unsigned long defaultSize, unsigned long size, unsigned long *mask)
+{
+    unsigned long pow2;
+
+    for (pow2 = 2; pow2 < size; pow2 <<= 1) {
+    }
+
+    if (pow2 == *mask + 1) {
+        return (buf);
+    }
+
+    if (buf != defaultBuf) {
+        free(buf);
+    }
+
+    if (pow2 == defaultSize) {
+        *mask = defaultSize - 1;
+        return (defaultBuf);
+    }
+
+    buf = (unsigned char *)malloc(pow2);
+    if (buf == NULL) {
+        *mask = defaultSize - 1;
+        return (defaultBuf);
+    }
+
+    *mask = pow2 - 1;
+    return (buf);
+}
+
 void HardwareSerial::flushAll(void)
 {
 }
 
+/*
+ *  ======== txWait ========
+ *  Wait for writeCallback() to make progress on the tx ring. Tasks pend
+ *  on txSem so lower priority tasks keep running; Hwis, Swis and callers
+ *  running before BIOS_start() still have to spin.
+ */
+void HardwareSerial::txWait(void)
+{
+    unsigned int hwiKey;
+
+    if (BIOS_getThreadType() != BIOS_ThreadType_Task) {
+        return;
+    }
+
+    hwiKey = Hwi_disable();
+
+    /* writeCallback() may have already run */
+    if (txActive == false) {
+        Hwi_restore(hwiKey);
+        return;
+    }
+
+    txWaiters++;
+
+    Hwi_restore(hwiKey);
+
+    Semaphore_pend(Semaphore_handle(&txSem), BIOS_WAIT_FOREVER);
+
+    hwiKey = Hwi_disable();
+
+    /* pass the wakeup on to the next waiting task */
+    if (--txWaiters) {
+        Semaphore_post(Semaphore_handle(&txSem));
+    }
+
+    Hwi_restore(hwiKey);
+}
+
+/*
+ *  ======== beginRxDma ========
+ *  Hand the UART receiver over to a uDMA channel running in ping-pong
+ *  mode across the two halves of rxBuffer. Returns false (leaving the
+ *  UART driver's rx ISR in charge) if the channel cannot be claimed.
+ */
+bool HardwareSerial::beginRxDma(void)
+{
+    UARTMSP432_HWAttrsV1 const *hwAttrs;
+    unsigned int hwiKey;
+    uint32_t ch;
+    int i;
+
+    hwAttrs = (UARTMSP432_HWAttrsV1 const *)UART_config[uartModule].hwAttrs;
+
+    i = findUartModule(hwAttrs->baseAddr);
+    if (i < 0) {
+        return (false);
+    }
+
+    rxDmaChannel = uartModules[i].channel;
+    ch = rxDmaChannel & 0x0f;
+
+    if (RX_DMA_HALF_SIZE > RX_DMA_MAX_XFER) {
+        return (false);
+    }
+
+    /* the channel may already be in use by SPI or another UART */
+    if (MAP_DMA_isChannelEnabled(ch)) {
+        return (false);
+    }
+
+    UDMAMSP432_init();
+    rxDmaHandle = UDMAMSP432_open();
+    if (rxDmaHandle == NULL) {
+        return (false);
+    }
+
+    if (!dmaAttach(ch, rxDmaHwiFxn, (uintptr_t)this, hwAttrs->intPriority)) {
+        UDMAMSP432_close(rxDmaHandle);
+        rxDmaHandle = NULL;
+        return (false);
+    }
+
+    hwiKey = Hwi_disable();
+
+    /* the UART driver's rx ISR would otherwise race the uDMA for RXBUF */
+    MAP_UART_disableInterrupt(hwAttrs->baseAddr, EUSCI_A_UART_RECEIVE_INTERRUPT);
+
+    MAP_DMA_assignChannel(rxDmaChannel);
+    MAP_DMA_disableChannelAttribute(rxDmaChannel, UDMA_ATTR_ALTSELECT |
+        UDMA_ATTR_USEBURST | UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+
+    MAP_DMA_setChannelControl(rxDmaChannel | UDMA_PRI_SELECT,
+        UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 | UDMA_ARB_1);
+    MAP_DMA_setChannelControl(rxDmaChannel | UDMA_ALT_SELECT,
+        UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 | UDMA_ARB_1);
+
+    armRxDma(UDMA_PRI_SELECT);
+    armRxDma(UDMA_ALT_SELECT);
+
+    MAP_DMA_clearInterruptFlag(ch);
+    MAP_DMA_enableChannel(ch);
+
+    Hwi_restore(hwiKey);
+
+    return (true);
+}
+
+/*
+ *  ======== endRxDma ========
+ */
+void HardwareSerial::endRxDma(void)
+{
+    unsigned int hwiKey;
+    uint32_t ch = rxDmaChannel & 0x0f;
+
+    hwiKey = Hwi_disable();
+
+    MAP_DMA_disableChannel(ch);
+    rxDmaMode = false;
+
+    Hwi_restore(hwiKey);
+
+    dmaDetach(ch);
+
+    UDMAMSP432_close(rxDmaHandle);
+    rxDmaHandle = NULL;
+}
+
+/*
+ *  ======== armRxDma ========
+ *  (Re)load the primary or alternate structure with its half of rxBuffer
+ */
+void HardwareSerial::armRxDma(uint32_t select)
+{
+    UARTMSP432_HWAttrsV1 const *hwAttrs;
+
+    hwAttrs = (UARTMSP432_HWAttrsV1 const *)UART_config[uartModule].hwAttrs;
+
+    MAP_DMA_setChannelTransfer(rxDmaChannel | select, UDMA_MODE_PINGPONG,
+        (void *)&EUSCI_A_CMSIS(hwAttrs->baseAddr)->RXBUF,
+        &rxBuffer[(select == UDMA_ALT_SELECT) ? RX_DMA_HALF_SIZE : 0],
+        RX_DMA_HALF_SIZE);
+}
+
+/*
+ *  ======== rxDmaPosition ========
+ *  Index in rxBuffer the uDMA will write next. Read live from the
+ *  control table so partially filled halves (ie the line went idle
+ *  mid-chunk) are visible without waiting for a completion interrupt.
+ */
+unsigned long HardwareSerial::rxDmaPosition(void)
+{
+    uint32_t ch = rxDmaChannel & 0x0f;
+    unsigned long start;
+    uint32_t select;
+
+    if (MAP_DMA_getChannelAttribute(ch) & UDMA_ATTR_ALTSELECT) {
+        select = UDMA_ALT_SELECT;
+        start = RX_DMA_HALF_SIZE;
+    }
+    else {
+        select = UDMA_PRI_SELECT;
+        start = 0;
+    }
+
+    return ((start + RX_DMA_HALF_SIZE - MAP_DMA_getChannelSize(ch | select))
+        & rxMask);
+}
+
 /*
  * Public Methods
  */
 void HardwareSerial::begin(unsigned long baud)
 {
     UART_Params uartParams;
+    unsigned int hwiKey;
 
     if (begun == true) return;
 
@@ -112,11 +512,20 @@ void HardwareSerial::begin(unsigned long baud)
         uartParams.readCallback = rxCallback;
         uartParams.writeMode = UART_MODE_CALLBACK;
         uartParams.writeCallback = txCallback;
-        continuousReadMode = useContinuousRead;
+        /* frames are delimited as chars arrive in readCallback() */
+        continuousReadMode = useContinuousRead
+            || (frameMode != SERIAL_FRAME_NONE);
+        frameEscape = false;
+        frameDiscard = false;
+        frameRemaining = 0;
+        frameStart = 0;
+        frameHead = 0;
+        frameTail = 0;
+        frameDrops = 0;
+        frameCrcErrors = 0;
         rxWriteIndex = 0;
         rxReadIndex = 0;
-        txWriteIndex = 0;
-        txReadIndex = 0;
+        txRing.init(txBuffer, txRing.size());
         txActive = false;
     }
 
@@ -126,14 +535,48 @@ void HardwareSerial::begin(unsigned long baud)
     uartParams.writeDataMode = UART_DATA_BINARY;
     uartParams.baudRate = baud;
 
+    /* route the shared driver callbacks to this instance */
+    serialPorts[uartModule] = this;
+
     uart = UART_open(uartModule, &uartParams);
 
     if (uart != NULL) {
-        GateMutex_construct(&gate, NULL);
-        if ((blockingModeEnabled == false) && (continuousReadMode == true)) {
+        Semaphore_Params semParams;
+
+        Semaphore_Params_init(&semParams);
+        semParams.mode = Semaphore_Mode_BINARY;
+        Semaphore_construct(&txSem, 0, &semParams);
+        Semaphore_construct(&rxSem, 0, &semParams);
+
+        /* counts complete frames queued in frameEnds[] */
+        semParams.mode = Semaphore_Mode_COUNTING;
+        Semaphore_construct(&frameSem, 0, &semParams);
+
+        /* queued behind the driver's own notify, see perfLevelChanged() */
+        Power_registerNotify(&perfNotify,
+            PowerMSP432_DONE_CHANGE_PERF_LEVEL, serialPerfChangeNotifyFxn,
+            (uintptr_t)this);
+
+        if ((blockingModeEnabled == false) && (useRxDma == true)
+            && (frameMode == SERIAL_FRAME_NONE)) {
+            rxDmaMode = beginRxDma();
+            if (rxDmaMode == true) {
+                /* rx chars are fetched from rxBuffer */
+                continuousReadMode = true;
+            }
+        }
+        if ((blockingModeEnabled == false) && (continuousReadMode == true)
+            && (rxDmaMode == false)) {
             /* start the read process */
             UART_read(uart, &rxBuffer[rxWriteIndex], 1);
         }
+
+        /* UART_open() leaves the receiver enabled */
+        hwiKey = Hwi_disable();
+        rxListening = true;
+        rxListenUpdate();
+        Hwi_restore(hwiKey);
+
         begun = true;
     }
 }
@@ -144,32 +587,436 @@ void HardwareSerial::begin(unsigned long baud, bool blockModeEnabled)
     begin(baud);
 }
 
+/*
+ *  ======== begin ========
+ *  Sizes are rounded up to a power of two. rxSize applies to rxBuffer,
+ *  which is only used in continuous read and rx DMA modes; otherwise rx
+ *  chars are held by the UART driver's own ring buffer. If an allocation
+ *  fails the port falls back to the default size.
+ */
+void HardwareSerial::begin(unsigned long baud, unsigned long rxSize, unsigned long txSize)
+{
+    unsigned long txMask = txRing.size() - 1;
+
+    if (begun == true) return;
+
+    rxBuffer = allocBuffer(rxBuffer, rxDefaultBuffer, SERIAL_RX_BUFFER_SIZE,
+        rxSize, &rxMask);
+    txBuffer = allocBuffer(txBuffer, txDefaultBuffer, SERIAL_TX_BUFFER_SIZE,
+        txSize, &txMask);
+    txRing.init(txBuffer, txMask + 1);
+
+    begin(baud);
+}
+
+/*
+ *  ======== setModule ========
+ *  Move this port to another UART_config[] instance. An open port is
+ *  flushed and re-opened at the same baud rate; unread rx chars are lost.
+ */
 void HardwareSerial::setModule(unsigned long module)
 {
-    /* Change which pins UART is on */
-    /* need to implement */
+    bool reopen = begun;
+
+    if (module >= SERIAL_MAX_PORTS || module == uartModule) {
+        return;
+    }
+
+    if (reopen) {
+        flush();
+        end();
+    }
+
+    uartModule = module;
+
+    if (reopen) {
+        begin(baudRate);
+    }
 }
 
+/*
+ *  ======== setPins ========
+ *  pins is SERIAL_PINS(rxPin, txPin)
+ */
 void HardwareSerial::setPins(unsigned long pins)
 {
-    /* almost same functionality as above */
+    setPins(pins & 0xff, (pins >> 8) & 0xff);
+}
+
+/*
+ *  ======== setPins ========
+ *  Route this port's RXD/TXD to the given Energia pins, using the port
+ *  mapper on ports 2, 3 and 7. Pins that can't reach the module are
+ *  ignored. An open port is flushed and re-opened on the new pins.
+ */
+void HardwareSerial::setPins(uint8_t rxPin, uint8_t txPin)
+{
+    UARTMSP432_HWAttrsV1 *hwAttrs = &uartMSP432HWAttrs[uartModule];
+    bool reopen = begun;
+    uint32_t rx, tx;
+    int i;
+
+    i = findUartModule(hwAttrs->baseAddr);
+    if (i < 0) {
+        return;
+    }
+
+    rx = encodeUartPin(rxPin, uartModules[i].pmapRx, uartModules[i].fixedRx);
+    tx = encodeUartPin(txPin, uartModules[i].pmapTx, uartModules[i].fixedTx);
+
+    if (rx == 0 || tx == 0) {
+        return;
+    }
+
+    if (reopen) {
+        flush();
+        end();
+    }
+
+    if (rx != hwAttrs->rxPin) {
+        releaseUartPin(hwAttrs->rxPin);
+        hwAttrs->rxPin = rx;
+    }
+
+    if (tx != hwAttrs->txPin) {
+        releaseUartPin(hwAttrs->txPin);
+        hwAttrs->txPin = tx;
+    }
+
+    if (reopen) {
+        begin(baudRate);
+    }
+}
+
+/*
+ *  ======== ucbrsTable ========
+ *  UCBRSx settings by fractional part of N = fBRCLK / baud, in units
+ *  of 1/10000 (MSP432P4xx TRM, "eUSCI_A UART Baud-Rate Generation").
+ *  The entry with the largest fraction <= frac(N) is used.
+ */
+static const struct {
+    uint16_t frac;
+    uint8_t ucbrs;
+} ucbrsTable[] = {
+    {   0, 0x00}, { 529, 0x01}, { 715, 0x02}, { 835, 0x04},
+    {1001, 0x08}, {1252, 0x10}, {1430, 0x20}, {1670, 0x11},
+    {2147, 0x21}, {2224, 0x22}, {2503, 0x44}, {3000, 0x25},
+    {3335, 0x49}, {3575, 0x4A}, {3753, 0x52}, {4003, 0x92},
+    {4286, 0x53}, {4378, 0x55}, {5002, 0xAA}, {5715, 0x6B},
+    {6003, 0xAD}, {6254, 0xB5}, {6432, 0xB6}, {6667, 0xD6},
+    {7001, 0xB7}, {7147, 0xBB}, {7503, 0xDD}, {7861, 0xED},
+    {8004, 0xEE}, {8333, 0xBF}, {8464, 0xDF}, {8572, 0xEF},
+    {8751, 0xF7}, {9004, 0xFB}, {9170, 0xFD}, {9288, 0xFE},
+};
+
+/*
+ *  ======== uartClockFreq ========
+ *  Frequency of the clock feeding this module's baud-rate generator
+ *  at performance level perfLevel.
+ */
+static uint32_t uartClockFreq(UARTMSP432_HWAttrsV1 const *hwAttrs,
+    unsigned int perfLevel)
+{
+    PowerMSP432_Freqs powerFreqs;
+
+    PowerMSP432_getFreqs(perfLevel, &powerFreqs);
+
+    if (hwAttrs->clockSource == EUSCI_A_UART_CLOCKSOURCE_ACLK) {
+        return (powerFreqs.ACLK);
+    }
+    return (powerFreqs.SMCLK);
+}
+
+/*
+ *  ======== findBaudDividers ========
+ *  Compute UCAxBRW and UCAxMCTLW values for baud from clk. Entries in
+ *  the board's baud-rate table win; other rates are computed with the
+ *  TRM algorithm. Returns false if clk is too slow for baud.
+ */
+static bool findBaudDividers(UARTMSP432_HWAttrsV1 const *hwAttrs,
+    uint32_t clk, uint32_t baud, uint16_t *brw, uint16_t *mctlw)
+{
+    UARTMSP432_BaudrateConfig const *lut = hwAttrs->baudrateLUT;
+    uint32_t n, frac;
+    unsigned int i;
+
+    for (i = 0; i < hwAttrs->numBaudrateEntries; i++) {
+        if (lut[i].outputBaudrate == baud && lut[i].inputClockFreq == clk) {
+            *brw = lut[i].prescalar;
+            *mctlw = (lut[i].hwRegUCBRSx << EUSCI_A_MCTLW_BRS_OFS)
+                | (lut[i].hwRegUCBRFx << EUSCI_A_MCTLW_BRF_OFS)
+                | (lut[i].oversampling ? EUSCI_A_MCTLW_OS16 : 0);
+            return (true);
+        }
+    }
+
+    if (baud == 0 || clk / baud < 3) {
+        return (false);
+    }
+
+    n = clk / baud;
+    frac = (uint32_t)(((uint64_t)(clk % baud) * 10000) / baud);
+
+    for (i = sizeof(ucbrsTable) / sizeof(ucbrsTable[0]) - 1; i > 0; i--) {
+        if (ucbrsTable[i].frac <= frac) {
+            break;
+        }
+    }
+    *mctlw = ucbrsTable[i].ucbrs << EUSCI_A_MCTLW_BRS_OFS;
+
+    if (n >= 16) {
+        /* oversampling: UCBRFx is the fractional part of N / 16 */
+        *brw = n / 16;
+        *mctlw |= ((n % 16) << EUSCI_A_MCTLW_BRF_OFS) | EUSCI_A_MCTLW_OS16;
+    }
+    else {
+        *brw = n;
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== perfLevelChanged ========
+ *  Runs with interrupts disabled, after the driver's notify. The
+ *  driver re-initializes the module from its baud-rate table, which
+ *  knows nothing of updateBaudRate()/autoBaud() rates, and leaves just
+ *  the rx interrupts enabled; redo the dividers for a custom rate, keep
+ *  the rx uDMA the only RXBUF reader and resume a write in flight.
+ */
+void HardwareSerial::perfLevelChanged(unsigned int perfLevel)
+{
+    UARTMSP432_HWAttrsV1 const *hwAttrs =
+        (UARTMSP432_HWAttrsV1 const *)UART_config[uartModule].hwAttrs;
+    UARTMSP432_Object *object =
+        (UARTMSP432_Object *)UART_config[uartModule].object;
+    EUSCI_A_Type *regs = EUSCI_A_CMSIS(hwAttrs->baseAddr);
+    uint16_t brw, mctlw, ie;
+
+    ie = regs->IE;  /* UCSWRST clears the interrupt enables */
+
+    if (baudCustom && findBaudDividers(hwAttrs,
+            uartClockFreq(hwAttrs, perfLevel), baudRate, &brw, &mctlw)) {
+        regs->CTLW0 |= EUSCI_A_CTLW0_SWRST;
+        regs->BRW = brw;
+        regs->MCTLW = mctlw;
+        regs->CTLW0 &= ~EUSCI_A_CTLW0_SWRST;
+    }
+
+    if (rxDmaMode) {
+        ie &= ~EUSCI_A_IE_RXIE;
+    }
+    if (object->writeCount != 0) {
+        ie |= EUSCI_A_IE_TXIE;
+    }
+    regs->IE = ie;
+}
+
+/*
+ *  ======== lockBaudLevels ========
+ *  Hold DISALLOW_PERFLEVEL_n for the performance levels whose clock
+ *  can't make baud, releasing the ones held for the previous rate;
+ *  0 releases them all.
+ */
+void HardwareSerial::lockBaudLevels(unsigned long baud)
+{
+    UARTMSP432_HWAttrsV1 const *hwAttrs =
+        (UARTMSP432_HWAttrsV1 const *)UART_config[uartModule].hwAttrs;
+    uint16_t brw, mctlw;
+    uint8_t mask = 0;
+    unsigned int i;
+
+    for (i = 0; baud != 0 && i < PowerMSP432_getNumPerfLevels() && i < 8;
+        i++) {
+        if (!findBaudDividers(hwAttrs, uartClockFreq(hwAttrs, i), baud,
+                &brw, &mctlw)) {
+            mask |= 1 << i;
+        }
+    }
+
+    for (i = 0; i < 8; i++) {
+        if ((mask & ~baudLevelMask) & (1 << i)) {
+            Power_setConstraint(PowerMSP432_DISALLOW_PERFLEVEL_0 + i);
+        }
+        else if ((baudLevelMask & ~mask) & (1 << i)) {
+            Power_releaseConstraint(PowerMSP432_DISALLOW_PERFLEVEL_0 + i);
+        }
+    }
+    baudLevelMask = mask;
+}
+
+/*
+ *  ======== updateBaudRate ========
+ *  Reprogram the baud-rate generator of an open port in place. Pending
+ *  tx chars are sent at the old rate first; rx state and buffered chars
+ *  are kept. Rates not in the board's table are computed, and
+ *  recomputed on performance level changes; levels whose clock is too
+ *  slow for baud are disallowed until end().
+ */
+bool HardwareSerial::updateBaudRate(unsigned long baud)
+{
+    UARTMSP432_HWAttrsV1 const *hwAttrs;
+    EUSCI_A_Type *regs;
+    uint16_t brw, mctlw, ie;
+    uintptr_t key;
+
+    if (begun == false || blockingModeEnabled == true) {
+        return (false);
+    }
+
+    hwAttrs = (UARTMSP432_HWAttrsV1 const *)UART_config[uartModule].hwAttrs;
+
+    if (!findBaudDividers(hwAttrs, uartClockFreq(hwAttrs,
+            Power_getPerformanceLevel()), baud, &brw, &mctlw)) {
+        return (false);
+    }
+
+    flush();
+    regs = EUSCI_A_CMSIS(hwAttrs->baseAddr);
+    while (regs->STATW & EUSCI_A_STATW_BUSY) {
+    }
+
+    lockBaudLevels(baud);
+
+    key = Hwi_disable();
+    ie = regs->IE;  /* UCSWRST clears the interrupt enables */
+    regs->CTLW0 |= EUSCI_A_CTLW0_SWRST;
+    regs->BRW = brw;
+    regs->MCTLW = mctlw;
+    regs->CTLW0 &= ~EUSCI_A_CTLW0_SWRST;
+    regs->IE = ie;
+    ((UARTMSP432_Object *)UART_config[uartModule].object)->baudRate = baud;
+    baudRate = baud;
+    baudCustom = true;
+    Hwi_restore(key);
+
+    return (true);
+}
+
+/*
+ *  ======== autoBaud ========
+ *  Let the eUSCI measure the baud rate from a break followed by a 0x55
+ *  sync char (UCMODE 3, as used by LIN) and adopt it. Waits up to
+ *  timeout ms for the peer to send the pattern. Returns the new rate
+ *  or 0 on timeout, in which case the old rate is restored. The clock
+ *  is held at its performance level while measuring.
+ */
+unsigned long HardwareSerial::autoBaud(unsigned long timeout)
+{
+    UARTMSP432_HWAttrsV1 const *hwAttrs;
+    EUSCI_A_Type *regs;
+    uint16_t brw, mctlw, ie;
+    uint32_t clk, ticks;
+    uintptr_t key;
+    bool measured;
+
+    if (begun == false || blockingModeEnabled == true) {
+        return (0);
+    }
+
+    hwAttrs = (UARTMSP432_HWAttrsV1 const *)UART_config[uartModule].hwAttrs;
+    clk = uartClockFreq(hwAttrs, Power_getPerformanceLevel());
+
+    flush();
+    regs = EUSCI_A_CMSIS(hwAttrs->baseAddr);
+    while (regs->STATW & EUSCI_A_STATW_BUSY) {
+    }
+
+    Power_setConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    /* UCBRx == 0 until the hardware has measured a sync field */
+    key = Hwi_disable();
+    brw = regs->BRW;
+    mctlw = regs->MCTLW;
+    ie = regs->IE;
+    regs->CTLW0 |= EUSCI_A_CTLW0_SWRST;
+    regs->CTLW0 = (regs->CTLW0 & ~EUSCI_A_CTLW0_MODE_MASK)
+        | EUSCI_A_CTLW0_MODE_3;
+    regs->ABCTL = EUSCI_A_ABCTL_ABDEN | EUSCI_A_ABCTL_DELIM_0;
+    regs->BRW = 0;
+    regs->MCTLW = mctlw & EUSCI_A_MCTLW_OS16;
+    regs->CTLW0 &= ~EUSCI_A_CTLW0_SWRST;
+    regs->IE = ie;
+    Hwi_restore(key);
+
+    for (ticks = 0; regs->BRW == 0 && ticks < timeout; ticks++) {
+        delay(1);
+    }
+
+    key = Hwi_disable();
+    ie = regs->IE;
+    regs->CTLW0 |= EUSCI_A_CTLW0_SWRST;
+    regs->ABCTL = 0;
+    regs->CTLW0 = (regs->CTLW0 & ~EUSCI_A_CTLW0_MODE_MASK)
+        | EUSCI_A_CTLW0_MODE_0;
+    measured = (regs->BRW != 0);
+    if (measured) {
+        brw = regs->BRW;
+        mctlw = regs->MCTLW;
+    }
+    else {
+        regs->BRW = brw;
+        regs->MCTLW = mctlw;
+    }
+    regs->CTLW0 &= ~EUSCI_A_CTLW0_SWRST;
+    regs->IE = ie;
+    Hwi_restore(key);
+
+    if (measured == false) {
+        Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+        return (0);
+    }
+
+    if (mctlw & EUSCI_A_MCTLW_OS16) {
+        baudRate = clk / (brw * 16 +
+            ((mctlw & EUSCI_A_MCTLW_BRF_MASK) >> EUSCI_A_MCTLW_BRF_OFS));
+    }
+    else {
+        baudRate = clk / brw;
+    }
+    ((UARTMSP432_Object *)UART_config[uartModule].object)->baudRate = baudRate;
+    baudCustom = true;
+
+    lockBaudLevels(baudRate);
+    Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    return (baudRate);
+}
+
+void HardwareSerial::enableRxDma(bool enable)
+{
+    useRxDma = enable;
+}
+
+unsigned long HardwareSerial::rxOverruns(void)
+{
+    return (rxDmaOverruns);
 }
 
 void HardwareSerial::acquire(void)
 {
-    GateMutex_enter(GateMutex_handle(&gate));
+    gate.lock();
 }
 
 void HardwareSerial::release(void)
 {
-    GateMutex_leave(GateMutex_handle(&gate), 0);
+    gate.unlock(0);
 }
 
 void HardwareSerial::end(void)
 {
     begun = false;
+    if (rxDmaMode == true) {
+        endRxDma();
+    }
+    Power_unregisterNotify(&perfNotify);
+    lockBaudLevels(0);
+    baudCustom = false;
     UART_close(uart);
     uart = NULL;
+    Semaphore_destruct(&txSem);
+    Semaphore_destruct(&rxSem);
+    Semaphore_destruct(&frameSem);
 }
 
 int HardwareSerial::available(void)
@@ -194,9 +1041,11 @@ int HardwareSerial::available(void)
 
         key = Hwi_disable();
 
-        numChars = (rxWriteIndex >= rxReadIndex) ?
-            (rxWriteIndex - rxReadIndex)
-            : SERIAL_RX_BUFFER_SIZE - (rxReadIndex - rxWriteIndex);
+        if (rxDmaMode == true) {
+            rxWriteIndex = rxDmaPosition();
+        }
+
+        numChars = (rxWriteIndex - rxReadIndex) & rxMask;
 
         Hwi_restore(key);
 
@@ -229,56 +1078,210 @@ int HardwareSerial::peek(void)
         /* Read a character from the buffer. */
         iChar = (int)rxBuffer[rxReadIndex];
 
-        /* Return the character to the caller. */
-        return (iChar);
+        /* Return the character to the caller. */
+        return (iChar);
+    }
+}
+
+int HardwareSerial::read(void)
+{
+    int iChar;
+
+    if (uart == NULL) {
+        return (0);
+    }
+
+    if (blockingModeEnabled == true) {
+        UART_read(uart, &iChar, 1);
+        return (iChar);
+    }
+    else {
+        unsigned int hwiKey;
+
+        hwiKey = Hwi_disable();
+
+        iChar = peek();
+
+        /* if a character is available, update buffer ptrs */
+        if (iChar != -1) {
+            if (continuousReadMode == true) {
+                /* rx chars are fetched from rxBuffer */
+                rxReadIndex = (rxReadIndex + 1) & rxMask;
+            }
+            else {
+                /* rxBuffer not used. Fetch from UART's ring buffer */
+                /*
+                 * UART_read() will ALWAYS be satisfied because we never ask
+                 * for more chars than there are available in the ring buffer.
+                 */
+                UART_read(uart, &iChar, 1);
+            }
+        }
+
+        Hwi_restore(hwiKey);
+
+        return (iChar);
+    }
+}
+
+/*
+ *  ======== read ========
+ *  Copy up to size chars that have already arrived into buffer and
+ *  return how many were copied. Blocks for all size chars only when
+ *  blocking mode is enabled.
+ */
+size_t HardwareSerial::read(uint8_t *buffer, size_t size)
+{
+    unsigned int hwiKey;
+    size_t count, span;
+    int numChars;
+
+    if (uart == NULL || size == 0) {
+        return (0);
+    }
+
+    if (blockingModeEnabled == true) {
+        return (UART_read(uart, buffer, size));
+    }
+
+    hwiKey = Hwi_disable();
+
+    if (continuousReadMode == true) {
+        if (rxDmaMode == true) {
+            rxWriteIndex = rxDmaPosition();
+        }
+
+        count = (rxWriteIndex - rxReadIndex) & rxMask;
+        if (count > size) {
+            count = size;
+        }
+
+        /* at most two spans: up to the end of rxBuffer, then from the start */
+        span = (rxMask + 1) - rxReadIndex;
+        if (span > count) {
+            span = count;
+        }
+        fastMemcpy(buffer, &rxBuffer[rxReadIndex], span);
+        fastMemcpy(buffer + span, rxBuffer, count - span);
+
+        rxReadIndex = (rxReadIndex + count) & rxMask;
+    }
+    else {
+        /* UART_read() is satisfied at once from the UART's ring buffer */
+        if (UART_control(uart, UART_CMD_GETRXCOUNT, (void *)&numChars)
+         != UART_STATUS_SUCCESS) {
+            numChars = 0;
+        }
+
+        count = ((size_t)numChars > size) ? size : (size_t)numChars;
+        if (count) {
+            UART_read(uart, buffer, count);
+        }
+    }
+
+    Hwi_restore(hwiKey);
+
+    return (count);
+}
+
+/*
+ *  ======== readBytes ========
+ *  Stream::readBytes() with whole spans moved per call rather than
+ *  a virtual read() per char. Same per-char timeout semantics.
+ */
+size_t HardwareSerial::readBytes(char *buffer, size_t length)
+{
+    unsigned long startMillis;
+    size_t count = 0;
+    size_t n;
+
+    startMillis = millis();
+
+    while (count < length) {
+        n = read((uint8_t *)buffer + count, length - count);
+        if (n) {
+            count += n;
+            startMillis = millis();
+        }
+        else {
+            unsigned long elapsed = millis() - startMillis;
+
+            if (elapsed >= getTimeout() ||
+                !waitForData(getTimeout() - elapsed)) {
+                break;
+            }
+        }
     }
+
+    return (count);
 }
 
-int HardwareSerial::read(void)
+/*
+ *  ======== waitForData ========
+ *  Tasks pend on rxSem, which readCallback() posts for each char while
+ *  someone waits. With the uDMA or the driver's own ring moving the
+ *  chars there is no per char interrupt, so those modes (and non-task
+ *  callers) check back every Clock tick instead of spinning.
+ */
+bool HardwareSerial::waitForData(unsigned long timeout)
 {
-    int iChar;
+    unsigned long start = millis();
+    unsigned long elapsed;
+    unsigned int hwiKey;
+    bool sleep;
 
     if (uart == NULL) {
-        return (0);
+        return (false);
     }
 
-    if (blockingModeEnabled == true) {
-        UART_read(uart, &iChar, 1);
-        return (iChar);
-    }
-    else {
-        unsigned int hwiKey;
+    sleep = continuousReadMode && !rxDmaMode &&
+        BIOS_getThreadType() == BIOS_ThreadType_Task;
 
+    rxDemandAdjust(1);
+
+    for (;;) {
         hwiKey = Hwi_disable();
+        if (available() > 0) {
+            rxDemand--;
+            rxListenUpdate();
+            Hwi_restore(hwiKey);
+            return (true);
+        }
 
-        iChar = peek();
+        elapsed = millis() - start;
+        if (elapsed >= timeout) {
+            rxDemand--;
+            rxListenUpdate();
+            Hwi_restore(hwiKey);
+            return (false);
+        }
 
-        /* if a character is available, update buffer ptrs */
-        if (iChar != -1) {
-            if (continuousReadMode == true) {
-                /* rx chars are fetched from rxBuffer */
-                rxReadIndex = ((rxReadIndex) + 1) % SERIAL_RX_BUFFER_SIZE;
-            }
-            else {
-                /* rxBuffer not used. Fetch from UART's ring buffer */
-                /*
-                 * UART_read() will ALWAYS be satisfied because we never ask
-                 * for more chars than there are available in the ring buffer.
-                 */
-                UART_read(uart, &iChar, 1);
+        if (!sleep) {
+            Hwi_restore(hwiKey);
+            if (BIOS_getThreadType() == BIOS_ThreadType_Task) {
+                Task_sleep(1);
             }
+            continue;
         }
 
+        rxWaiters++;
         Hwi_restore(hwiKey);
 
-        return (iChar);
+        /* ticks are a little shorter than ms, millis() has the last word */
+        Semaphore_pend(Semaphore_handle(&rxSem), timeout - elapsed);
+
+        hwiKey = Hwi_disable();
+        rxWaiters--;
+        Hwi_restore(hwiKey);
     }
 }
 
 void HardwareSerial::flush()
 {
     if (blockingModeEnabled == false) {
-        while (txActive) ;
+        while (txActive) {
+            txWait();
+        }
     }
 }
 
@@ -298,35 +1301,95 @@ size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
         return (0);
     }
 
+    PROFILE_SCOPE("Serial.write");
+
+    /* the end event shows how long the caller waited for ring space */
+    traceEvent(TRACE_SERIAL_WRITE, uartModule, size);
+
     if (blockingModeEnabled == true) {
         IArg key;
-        key = GateMutex_enter(GateMutex_handle(&gate));
+        key = gate.lock();
         UART_write(uart, (char *)buffer, size);
-        GateMutex_leave(GateMutex_handle(&gate), key);
+        gate.unlock(key);
     }
     else {
         unsigned int hwiKey;
-        while (size) {
-            while (TX_BUFFER_FULL) {
+        size_t remaining = size;
+        size_t count;
+
+        while (remaining) {
+            while (txRing.isFull()) {
                 if (txActive == false) {
                     primeTx();
                 }
+                else {
+                    txWait();
+                }
             }
+            /*
+             * writeCallback() is the ring's only consumer; the Hwi
+             * gate only keeps concurrent writers' chunks apart.
+             */
             hwiKey = Hwi_disable();
-            txBuffer[txWriteIndex] = *buffer++;
-            txWriteIndex = (txWriteIndex + 1) % SERIAL_TX_BUFFER_SIZE;
-            size--;
+            count = txRing.push(buffer, remaining);
             Hwi_restore(hwiKey);
+            buffer += count;
+            remaining -= count;
         }
-        if ((txActive == false) && (!TX_BUFFER_EMPTY)) {
+        if ((txActive == false) && (!txRing.isEmpty())) {
             primeTx();
         }
     }
 
+    traceEvent(TRACE_SERIAL_WRITE | TRACE_END, uartModule, size);
+
     return (size);
 }
 
+/*
+ *  ======== writeAsync ========
+ *  Hand buffer straight to UART_write() without copying it into txBuffer.
+ *  Chars already queued by write() are sent first; chars queued after
+ *  this call follow the buffer. buffer must stay valid until callback
+ *  (which runs in the UART's Hwi context, and may be NULL) is called
+ *  with it. Returns false if the port is not open in callback mode.
+ */
+bool HardwareSerial::writeAsync(const uint8_t *buffer, size_t size,
+    SerialTxCallback callback)
+{
+    unsigned int hwiKey;
+
+    if (uart == NULL || size == 0 || blockingModeEnabled == true) {
+        return (false);
+    }
+
+    for (;;) {
+        /* drain the ring, or a preceding writeAsync(), first */
+        flush();
+
+        hwiKey = Hwi_disable();
+
+        /* another writer may have restarted tx since flush() returned */
+        if (txActive == false) {
+            break;
+        }
+
+        Hwi_restore(hwiKey);
+    }
+
+    txActive = true;
+    txAsyncBuffer = buffer;
+    txAsyncCallback = callback;
+
+    Hwi_restore(hwiKey);
+
+    UART_write(uart, buffer, size);
+
+    return (true);
+}
+
 void HardwareSerial::primeTx(void) {
+    const uint8_t *span;
     unsigned int hwiKey;
     size_t size;
 
@@ -342,68 +1405,452 @@ void HardwareSerial::primeTx(void) {
         return;
     }
 
-    if (txWriteIndex > txReadIndex) {
-        size = txWriteIndex - txReadIndex;
-    }
-    else {
-        size = SERIAL_TX_BUFFER_SIZE - txReadIndex;
+    span = txRing.readSpan(&size);
+
+    if (size == 0) {
+        Hwi_restore(hwiKey);
+        return;
     }
 
     txActive = true;
 
     Hwi_restore(hwiKey);
 
-    UART_write(uart, &txBuffer[txReadIndex], size);
+    UART_write(uart, span, size);
 }
 
-void HardwareSerial::readCallback(UART_Handle uart, void *buf, size_t count)
+RAMFUNC void HardwareSerial::readCallback(UART_Handle uart, void *buf, size_t count)
 {
     /*
      * The CC26XX UART driver's receiver is disabled
      * unless UART_read() is called.
      */
     if (continuousReadMode) {
-        uint8_t volatile full = RX_BUFFER_FULL;
+        if (frameMode != SERIAL_FRAME_NONE) {
+            frameRx();
+        }
+        else {
+            uint8_t volatile full = RX_BUFFER_FULL;
 
-        rxWriteIndex = ((rxWriteIndex) + 1) % SERIAL_RX_BUFFER_SIZE;
+            rxWriteIndex = (rxWriteIndex + 1) & rxMask;
 
-        if (full) {
-            rxReadIndex = ((rxReadIndex) + 1) % SERIAL_RX_BUFFER_SIZE;
+            if (full) {
+                rxReadIndex = (rxReadIndex + 1) & rxMask;
+            }
         }
 
         UART_read(uart, &rxBuffer[rxWriteIndex], 1);
+
+        if (rxWaiters) {
+            Semaphore_post(Semaphore_handle(&rxSem));
+        }
+        if (rxEvent != NULL && frameMode == SERIAL_FRAME_NONE) {
+            Event_post(rxEvent, rxEventIds);
+        }
+    }
+}
+
+/*
+ *  ======== frameRx ========
+ *  Called from readCallback() with the char just stored at
+ *  rxBuffer[rxWriteIndex]. Delimiters are not kept in rxBuffer.
+ *  Frames that do not fit in rxBuffer or the frame queue are dropped
+ *  whole rather than dropping the oldest chars as the byte stream does,
+ *  so readFrame() never returns a partial frame.
+ */
+RAMFUNC void HardwareSerial::frameRx(void)
+{
+    unsigned char c = rxBuffer[rxWriteIndex];
+    bool store = true;
+    bool end = false;
+
+    switch (frameMode) {
+        case SERIAL_FRAME_TERMINATOR:
+            if (c == frameTerminator) {
+                store = false;
+                end = true;
+            }
+            break;
+
+        case SERIAL_FRAME_LENGTH:
+            if (frameRemaining == 0) {
+                frameRemaining = c;
+                store = false;
+            }
+            else if (--frameRemaining == 0) {
+                end = true;
+            }
+            break;
+
+        case SERIAL_FRAME_SLIP:
+            if (c == 0xc0) {            /* END */
+                store = false;
+                end = true;
+            }
+            else if (c == 0xdb) {       /* ESC */
+                frameEscape = true;
+                store = false;
+            }
+            else if (frameEscape) {
+                frameEscape = false;
+                if (c == 0xdc) {        /* ESC_END */
+                    rxBuffer[rxWriteIndex] = 0xc0;
+                }
+                else if (c == 0xdd) {   /* ESC_ESC */
+                    rxBuffer[rxWriteIndex] = 0xdb;
+                }
+            }
+            break;
+    }
+
+    if (store) {
+        if (RX_BUFFER_FULL) {
+            frameDiscard = true;
+        }
+        else {
+            rxWriteIndex = (rxWriteIndex + 1) & rxMask;
+        }
+    }
+
+    if (end) {
+        if ((frameDiscard == true) ||
+            (((frameHead + 1) & (SERIAL_FRAME_QUEUE_SIZE - 1)) == frameTail)) {
+            /* rewind over the frame */
+            rxWriteIndex = frameStart;
+            frameDrops++;
+        }
+        else if (rxWriteIndex != frameStart) {
+            frameEnds[frameHead] = rxWriteIndex;
+            frameHead = (frameHead + 1) & (SERIAL_FRAME_QUEUE_SIZE - 1);
+            Semaphore_post(Semaphore_handle(&frameSem));
+            if (rxEvent != NULL) {
+                Event_post(rxEvent, rxEventIds);
+            }
+        }
+        frameStart = rxWriteIndex;
+        frameDiscard = false;
+    }
+}
+
+/*
+ *  ======== setFrameMode ========
+ */
+void HardwareSerial::setFrameMode(uint8_t mode, uint8_t terminator)
+{
+    frameMode = mode;
+    frameTerminator = terminator;
+}
+
+/*
+ *  ======== setFrameCheck ========
+ *  Each frame ends in a CRC of the bytes before it, SERIAL_FRAME_CHECK_CRC16
+ *  or SERIAL_FRAME_CHECK_CRC32. readFrame() checks it on the CRC32 module
+ *  and drops frames that do not match; the CRC is not returned. With
+ *  SERIAL_FRAME_TERMINATOR the CRC bytes could be taken for the
+ *  terminator, SLIP or length framing does not have that problem.
+ */
+void HardwareSerial::setFrameCheck(uint8_t check)
+{
+    frameCheck = check;
+}
+
+/*
+ *  ======== frameValid ========
+ *  Check the CRC of the frame from rxReadIndex to end. The ISR does not
+ *  write there until rxReadIndex moves, so the module is fed straight
+ *  from rxBuffer, with Hwis enabled.
+ */
+bool HardwareSerial::frameValid(unsigned long end)
+{
+    unsigned long start = rxReadIndex;
+    size_t count = (end - start) & rxMask;
+    size_t span;
+    uint8_t tail[4];
+    uint32_t received;
+    unsigned int i;
+
+    if (count < frameCheck) {
+        return (false);
+    }
+    count -= frameCheck;
+
+    for (i = 0; i < frameCheck; i++) {
+        tail[i] = rxBuffer[(start + count + i) & rxMask];
+    }
+
+    span = (rxMask + 1) - start;
+    if (span > count) {
+        span = count;
+    }
+
+    if (frameCheck == SERIAL_FRAME_CHECK_CRC16) {
+        Crc16 crc;
+
+        crc.update(&rxBuffer[start], span);
+        crc.update(rxBuffer, count - span);
+        received = (tail[0] << 8) | tail[1];
+
+        return (crc.value() == received);
+    }
+    else {
+        Crc32 crc;
+
+        crc.update(&rxBuffer[start], span);
+        crc.update(rxBuffer, count - span);
+        received = tail[0] | (tail[1] << 8) | (tail[2] << 16)
+            | ((uint32_t)tail[3] << 24);
+
+        return (crc.value() == received);
     }
 }
 
-void HardwareSerial::writeCallback(UART_Handle uart, void *buf, size_t txCount)
+/*
+ *  ======== readFrame ========
+ *  Wait up to timeout ms for a complete frame and copy it into buffer.
+ *  Returns the frame length or -1 on timeout. A frame longer than size
+ *  is discarded, nothing copied, and its length returned, so a result
+ *  above size says the buffer was too small. The frame may wrap the end of rxBuffer so it is copied in at most two
+ *  spans. Callers outside task context do not wait; with a frame check
+ *  they get nothing, as the CRC32 module is only shared among tasks.
+ */
+int HardwareSerial::readFrame(uint8_t *buffer, size_t size, unsigned long timeout)
 {
     unsigned int hwiKey;
-    size_t size;
+    unsigned long end;
+    size_t count, span;
+    UInt32 start = Clock_getTicks();
+    UInt32 wait = timeout;
+
+    if (uart == NULL || frameMode == SERIAL_FRAME_NONE) {
+        return (-1);
+    }
+
+    if (BIOS_getThreadType() != BIOS_ThreadType_Task) {
+        if (frameCheck != SERIAL_FRAME_CHECK_NONE) {
+            return (-1);
+        }
+        timeout = 0;
+        wait = 0;
+    }
+
+    for (;;) {
+        rxDemandAdjust(1);
+        if (!Semaphore_pend(Semaphore_handle(&frameSem), wait)) {
+            rxDemandAdjust(-1);
+            return (-1);
+        }
+        rxDemandAdjust(-1);
+
+        /* only this reader moves frameTail and rxReadIndex */
+        end = frameEnds[frameTail];
+
+        if (frameCheck == SERIAL_FRAME_CHECK_NONE || frameValid(end)) {
+            break;
+        }
+
+        hwiKey = Hwi_disable();
+        frameTail = (frameTail + 1) & (SERIAL_FRAME_QUEUE_SIZE - 1);
+        rxReadIndex = end;
+        Hwi_restore(hwiKey);
+        frameCrcErrors++;
+
+        /* wait for the next frame out of what is left of timeout */
+        if (timeout != (unsigned long)BIOS_WAIT_FOREVER) {
+            UInt32 elapsed = Clock_getTicks() - start;
+
+            wait = elapsed < timeout ? timeout - elapsed : 0;
+        }
+    }
 
     hwiKey = Hwi_disable();
 
-    /*
-     * advance txReadIndex by the number of bytes
-     * sent by the last call to UART_write().
-     */
-    txReadIndex = (txReadIndex + txCount) % SERIAL_TX_BUFFER_SIZE;
+    frameTail = (frameTail + 1) & (SERIAL_FRAME_QUEUE_SIZE - 1);
 
-    if (TX_BUFFER_EMPTY) {
-        txActive = false;
+    count = ((end - rxReadIndex) & rxMask) - frameCheck;
+    if (count > size) {
+        rxReadIndex = end;
         Hwi_restore(hwiKey);
+
+        return (count);
+    }
+
+    span = (rxMask + 1) - rxReadIndex;
+    if (span > count) {
+        span = count;
+    }
+    fastMemcpy(buffer, &rxBuffer[rxReadIndex], span);
+    fastMemcpy(buffer + span, rxBuffer, count - span);
+
+    rxReadIndex = end;
+
+    Hwi_restore(hwiKey);
+
+    traceEvent(TRACE_SERIAL_FRAME, uartModule, count);
+
+    return (count);
+}
+
+/*
+ *  ======== frameErrors ========
+ *  Frames dropped for want of room, plus those failing the frame check
+ */
+unsigned long HardwareSerial::frameErrors(void)
+{
+    return (frameDrops + frameCrcErrors);
+}
+
+/*
+ *  ======== setRxEvent ========
+ *  Post eventIds to event whenever chars arrive: for each char, each
+ *  complete frame in a frame mode, or each filled half of rxBuffer
+ *  with enableRxDma(). NULL stops it.
+ */
+void HardwareSerial::setRxEvent(Event_Handle event, UInt eventIds)
+{
+    unsigned int hwiKey;
+
+    hwiKey = Hwi_disable();
+    rxEvent = event;
+    rxEventIds = eventIds;
+    rxListenUpdate();
+    Hwi_restore(hwiKey);
+}
+
+/*
+ *  ======== setRxOnDemand ========
+ *  Keep the receiver off except while a task waits in waitForData()
+ *  or readFrame(), or an rx event is set. The UART driver holds
+ *  DISALLOW_DEEPSLEEP_0 for as long as it receives on MSP432P401x,
+ *  i.e. from begin() on, which keeps the idle loop out of LPM3; chars
+ *  sent while nobody listens are lost. Not with blocking mode or
+ *  enableRxDma().
+ */
+void HardwareSerial::setRxOnDemand(bool onDemand)
+{
+    unsigned int hwiKey;
+
+    hwiKey = Hwi_disable();
+    rxOnDemand = onDemand;
+    rxListenUpdate();
+    Hwi_restore(hwiKey);
+}
+
+/*
+ *  ======== rxListenUpdate ========
+ *  Enable or disable the receiver to match the demand for it. Called
+ *  with interrupts disabled.
+ */
+void HardwareSerial::rxListenUpdate(void)
+{
+    bool listen = !rxOnDemand || rxDemand != 0 || rxEvent != NULL;
+
+    if (uart == NULL || blockingModeEnabled || rxDmaMode
+        || listen == rxListening) {
         return;
     }
 
-    if (txWriteIndex > txReadIndex) {
-        size = txWriteIndex - txReadIndex;
+    UART_control(uart, listen ? UART_CMD_RXENABLE : UART_CMD_RXDISABLE,
+        NULL);
+    rxListening = listen;
+}
+
+/*
+ *  ======== rxDemandAdjust ========
+ */
+void HardwareSerial::rxDemandAdjust(int delta)
+{
+    unsigned int hwiKey;
+
+    hwiKey = Hwi_disable();
+    rxDemand += delta;
+    rxListenUpdate();
+    Hwi_restore(hwiKey);
+}
+
+/*
+ *  ======== rxDmaCallback ========
+ *  Called from the DMA_INT0 Hwi each time a half of rxBuffer fills
+ */
+void HardwareSerial::rxDmaCallback(void)
+{
+    uint32_t ch = rxDmaChannel & 0x0f;
+    unsigned long next = rxWriteIndex;
+
+    if (MAP_DMA_getChannelMode(ch | UDMA_PRI_SELECT) == UDMA_MODE_STOP) {
+        armRxDma(UDMA_PRI_SELECT);
+        next = RX_DMA_HALF_SIZE;
+    }
+
+    if (MAP_DMA_getChannelMode(ch | UDMA_ALT_SELECT) == UDMA_MODE_STOP) {
+        armRxDma(UDMA_ALT_SELECT);
+        next = 0;
+    }
+
+    /* the channel disables itself if both halves filled before we got here */
+    MAP_DMA_enableChannel(ch);
+
+    /*
+     * Unread chars in the half the uDMA is moving into are about to be
+     * overwritten. Drop them by moving the reader to the oldest chars
+     * still intact, as readCallback() does when rxBuffer is full.
+     */
+    if ((rxReadIndex != next) &&
+        ((rxReadIndex / RX_DMA_HALF_SIZE) == (next / RX_DMA_HALF_SIZE))) {
+        rxReadIndex = (next + RX_DMA_HALF_SIZE) & rxMask;
+        rxDmaOverruns++;
+    }
+
+    rxWriteIndex = next;
+
+    if (rxEvent != NULL) {
+        Event_post(rxEvent, rxEventIds);
+    }
+}
+
+RAMFUNC void HardwareSerial::writeCallback(UART_Handle uart, void *buf, size_t txCount)
+{
+    SerialTxCallback asyncCallback = NULL;
+    const uint8_t *asyncBuffer = NULL;
+    const uint8_t *span;
+    unsigned int hwiKey;
+    size_t size;
+
+    hwiKey = Hwi_disable();
+
+    if (txAsyncBuffer != NULL) {
+        /* the last UART_write() sent a writeAsync() buffer, not the ring */
+        asyncCallback = txAsyncCallback;
+        asyncBuffer = txAsyncBuffer;
+        txAsyncBuffer = NULL;
     }
     else {
-        size = SERIAL_TX_BUFFER_SIZE - txReadIndex;
+        /*
+         * release the number of bytes sent by
+         * the last call to UART_write().
+         */
+        txRing.consume(txCount);
     }
 
-    Hwi_restore(hwiKey);
+    /* space has been freed (or the ring drained) for blocked writers */
+    if (txWaiters) {
+        Semaphore_post(Semaphore_handle(&txSem));
+    }
+
+    span = txRing.readSpan(&size);
+
+    if (size == 0) {
+        txActive = false;
+        Hwi_restore(hwiKey);
+    }
+    else {
+        Hwi_restore(hwiKey);
+
+        UART_write(uart, span, size);
+    }
 
-    UART_write(uart, &txBuffer[txReadIndex], size);
+    if (asyncCallback != NULL) {
+        asyncCallback(asyncBuffer, txCount);
+    }
 }
 
 void serialEvent() __attribute__((weak));
@@ -425,3 +1872,23 @@ void serialEventRun1(void)
         serialEvent1();
     }
 }
+
+void serialEvent2() __attribute__((weak));
+void serialEvent2() { }
+
+void serialEvent3() __attribute__((weak));
+void serialEvent3() { }
+
+void serialEventRun2(void)
+{
+    if (Serial2.available()) {
+        serialEvent2();
+    }
+}
+
+void serialEventRun3(void)
+{
+    if (Serial3.available()) {
+        serialEvent3();
+    }
+}
@@ -35,15 +35,51 @@
 
 #include <inttypes.h>
 #include "Stream.h"
+#include "RingBuffer.h"
 
 #include <ti/drivers/UART.h>
+#include <ti/drivers/Power.h>
+#include <ti/drivers/dma/UDMAMSP432.h>
 
 #include <ti/sysbios/knl/Semaphore.h>
 #include <ti/sysbios/knl/Clock.h>
-#include <ti/sysbios/gates/GateMutex.h>
+#include <ti/sysbios/knl/Event.h>
 
+#include "Mutex.h"
+
+/*
+ * default ring sizes, must be powers of 2; see begin(baud, rxSize, txSize).
+ * boards.txt raises them on boards with more SRAM.
+ */
+#ifndef SERIAL_RX_BUFFER_SIZE
 #define SERIAL_RX_BUFFER_SIZE  128
+#endif
+#ifndef SERIAL_TX_BUFFER_SIZE
 #define SERIAL_TX_BUFFER_SIZE  128
+#endif
+
+/* number of UART_config[] instances HardwareSerial can dispatch to */
+#define SERIAL_MAX_PORTS  4
+
+/* setPins() argument encoding */
+#define SERIAL_PINS(rxPin, txPin) ((rxPin) | ((txPin) << 8))
+
+/* frame delimiting modes, see setFrameMode() */
+#define SERIAL_FRAME_NONE        0  /* plain byte stream */
+#define SERIAL_FRAME_TERMINATOR  1  /* frames end with a terminator byte */
+#define SERIAL_FRAME_LENGTH      2  /* each frame is preceded by a length byte */
+#define SERIAL_FRAME_SLIP        3  /* RFC 1055 SLIP framing */
+
+/* frame checks, see setFrameCheck() */
+#define SERIAL_FRAME_CHECK_NONE   0
+#define SERIAL_FRAME_CHECK_CRC16  2  /* CRC-16/CCITT-FALSE, MSB first */
+#define SERIAL_FRAME_CHECK_CRC32  4  /* zlib CRC-32, LSB first */
+
+/* number of complete frames that can be queued; must be a power of 2 */
+#define SERIAL_FRAME_QUEUE_SIZE  8
+
+/* called from Hwi context when a writeAsync() buffer has been sent */
+typedef void (*SerialTxCallback)(const uint8_t *buffer, size_t count);
 
 class HardwareSerial : public Stream
 {
@@ -53,22 +89,66 @@ class HardwareSerial : public Stream
         bool blockingModeEnabled;
         bool continuousReadMode;
         bool useContinuousRead;
-        unsigned char rxBuffer[SERIAL_RX_BUFFER_SIZE];
+        bool useRxDma;
+        bool rxDmaMode;
+        uint32_t rxDmaChannel;
+        UDMAMSP432_Handle rxDmaHandle;
+        volatile unsigned long rxDmaOverruns;
+        unsigned char rxDefaultBuffer[SERIAL_RX_BUFFER_SIZE];
+        unsigned char *rxBuffer;
+        unsigned long rxMask;       /* rx ring size - 1, size is a power of 2 */
         volatile unsigned long rxWriteIndex;
         volatile unsigned long rxReadIndex;
-        unsigned char txBuffer[SERIAL_TX_BUFFER_SIZE];
-        volatile unsigned long txWriteIndex;
-        volatile unsigned long txReadIndex;
+        unsigned char txDefaultBuffer[SERIAL_TX_BUFFER_SIZE];
+        unsigned char *txBuffer;
+        RingBufferBase txRing;      /* over txBuffer */
         volatile bool txActive;
+        volatile unsigned int txWaiters;
+        Semaphore_Struct txSem;
+        volatile unsigned int rxWaiters;
+        Semaphore_Struct rxSem;     /* posted by readCallback() for them */
+        Event_Handle rxEvent;       /* posted with rxEventIds on receive */
+        UInt rxEventIds;
+        bool rxOnDemand;            /* see setRxOnDemand() */
+        bool rxListening;           /* receiver enabled in the driver */
+        unsigned int rxDemand;      /* waiters that need it enabled */
+        const uint8_t * volatile txAsyncBuffer;
+        SerialTxCallback txAsyncCallback;
+        uint8_t frameMode;
+        uint8_t frameTerminator;
+        uint8_t frameCheck;         /* trailing CRC bytes, 0 for none */
+        bool frameEscape;
+        bool frameDiscard;
+        unsigned int frameRemaining;
+        unsigned long frameStart;
+        unsigned long frameEnds[SERIAL_FRAME_QUEUE_SIZE];
+        volatile unsigned int frameHead;
+        volatile unsigned int frameTail;
+        volatile unsigned long frameDrops;
+        unsigned long frameCrcErrors;
+        Semaphore_Struct frameSem;
         unsigned long baudRate;
+        bool baudCustom;            /* set by updateBaudRate()/autoBaud() */
+        uint8_t baudLevelMask;      /* DISALLOW_PERFLEVEL_n held for it */
+        Power_NotifyObj perfNotify;
         uint8_t uartModule;
         UART_Handle uart;
         UART_Callback rxCallback;
         UART_Callback txCallback;
-        GateMutex_Struct gate;
+        Mutex gate;
         void init(unsigned long module, UART_Callback rxCallback, UART_Callback txCallback);
         void flushAll(void);
         void primeTx(void);
+        void txWait(void);
+        bool beginRxDma(void);
+        void endRxDma(void);
+        void armRxDma(uint32_t select);
+        unsigned long rxDmaPosition(void);
+        void frameRx(void);
+        bool frameValid(unsigned long end);
+        void lockBaudLevels(unsigned long baud);
+        void rxListenUpdate(void);
+        void rxDemandAdjust(int delta);
 
     public:
         operator bool();// Arduino compatibility (see StringLength example)
@@ -76,31 +156,56 @@ class HardwareSerial : public Stream
         HardwareSerial(unsigned long);
         HardwareSerial(unsigned long, UART_Callback, UART_Callback);
         HardwareSerial(unsigned long, UART_Callback, UART_Callback, bool);
+        void perfLevelChanged(unsigned int perfLevel);
         void begin(unsigned long);
         void begin(unsigned long, bool);
+        void begin(unsigned long, unsigned long, unsigned long);
         void setModule(unsigned long);
         void setPins(unsigned long);
+        void setPins(uint8_t rxPin, uint8_t txPin);
+        bool updateBaudRate(unsigned long baud);
+        unsigned long autoBaud(unsigned long timeout);
+        void enableRxDma(bool);  /* must be called before begin() */
+        unsigned long rxOverruns(void);
+        void setFrameMode(uint8_t mode, uint8_t terminator = '\n');  /* call before begin() */
+        void setFrameCheck(uint8_t check);  /* call before begin() */
+        int readFrame(uint8_t *buffer, size_t size, unsigned long timeout);  /* > size: too long, dropped */
+        unsigned long frameErrors(void);
+        void setRxEvent(Event_Handle event, UInt eventIds);
+        void setRxOnDemand(bool onDemand);
         void acquire(void);  /* acquire serial port for this thread */
         void release(void);  /* release serial port */
         void end(void);
         virtual int available(void);
         virtual int peek(void);
         virtual int read(void);
+        size_t read(uint8_t *buffer, size_t size);
+        virtual size_t readBytes(char *buffer, size_t length);
+        using Stream::readBytes; // pull in readBytes(uint8_t *, size_t)
         virtual void flush(void);
+        virtual bool waitForData(unsigned long timeout);
         void readCallback(UART_Handle uart, void *buf, size_t count);
         void writeCallback(UART_Handle uart, void *buf, size_t count);
+        void rxDmaCallback(void);
         virtual size_t write(uint8_t c);
         virtual size_t write(const uint8_t *buffer, size_t size);
+        bool writeAsync(const uint8_t *buffer, size_t size, SerialTxCallback callback);
         using Print::write; // pull in write(str) from Print
 };
 
 extern HardwareSerial Serial;
 extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+extern HardwareSerial Serial3;
 
 extern void serialEventRun(void) __attribute__((weak));
 extern void serialEventRun1(void) __attribute__((weak));
+extern void serialEventRun2(void) __attribute__((weak));
+extern void serialEventRun3(void) __attribute__((weak));
 
 extern void serialEvent() __attribute__((weak));
 extern void serialEvent1() __attribute__((weak));
+extern void serialEvent2() __attribute__((weak));
+extern void serialEvent3() __attribute__((weak));
 
 #endif
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== MessageQueue.h ========
+ *  Passing messages between sketch loops, and from interrupts to them,
+ *  without polling globals. The receiver blocks until a message comes.
+ *
+ *  MessageQueue copies small messages through a Mailbox:
+ *
+ *      struct Sample { uint32_t time; uint16_t value; };
+ *      MessageQueue<Sample, 8> samples;
+ *
+ *      void loopAcquire() { Sample s = { millis(), analogRead(A0) };
+ *                           samples.send(s); delay(10); }
+ *      void loopProcess() { Sample s; samples.receive(s); ... }
+ *
+ *  For large messages MessagePool and MessageChannel pass pointers
+ *  instead: a producer takes a buffer from a pool, fills it and sends
+ *  it down a channel, each stage works on it in place and the last one
+ *  puts it back, so a block is never copied on its way from acquire to
+ *  process to transmit:
+ *
+ *      MessagePool<Frame, 4> frames;
+ *      MessageChannel<Frame> toProcess, toTransmit;
+ *
+ *      Frame *f = frames.alloc();   ...   toProcess.send(f);
+ *      Frame *f = toProcess.receive();  ...  toTransmit.send(f);
+ *      Frame *f = toTransmit.receive();  ...  frames.release(f);
+ *
+ *  A channel takes only buffers from a MessagePool of the same type.
+ *  Timeouts are Clock ticks, BIOS_WAIT_FOREVER by default; a Hwi or
+ *  Swi may send() and release(), and receive() or alloc() only with
+ *  BIOS_NO_WAIT, nothing ever blocks there. Messages are copied with
+ *  memcpy and pool buffers are never destructed: T must be plain data.
+ */
+
+#ifndef MessageQueue_h
+#define MessageQueue_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Mailbox.h>
+#include <ti/sysbios/knl/Queue.h>
+#include <ti/sysbios/knl/Semaphore.h>
+
+/*
+ *  ======== MessageQueue ========
+ *  Up to N messages of type T, copied in by send() and out by receive()
+ */
+template <typename T, size_t N>
+class MessageQueue
+{
+    public:
+        MessageQueue(void)
+        {
+            Mailbox_Params params;
+
+            Mailbox_Params_init(&params);
+            params.buf = storage;
+            params.bufSize = sizeof(storage);
+            Mailbox_construct(&mbx, sizeof(Slot), N, &params, NULL);
+        }
+        ~MessageQueue() { Mailbox_destruct(&mbx); }
+
+        /* false if the queue stayed full for timeout ticks */
+        bool send(const T &msg, uint32_t timeout = BIOS_WAIT_FOREVER)
+        {
+            Slot slot;
+
+            if (sizeof(Slot) == sizeof(T)) {
+                return (Mailbox_post(handle(), (Ptr)&msg, timeout));
+            }
+            memcpy(&slot, &msg, sizeof(T));
+            return (Mailbox_post(handle(), &slot, timeout));
+        }
+
+        /* false if no message came in timeout ticks */
+        bool receive(T &msg, uint32_t timeout = BIOS_WAIT_FOREVER)
+        {
+            Slot slot;
+
+            if (sizeof(Slot) == sizeof(T)) {
+                return (Mailbox_pend(handle(), &msg, timeout));
+            }
+            if (!Mailbox_pend(handle(), &slot, timeout)) {
+                return (false);
+            }
+            memcpy(&msg, &slot, sizeof(T));
+            return (true);
+        }
+
+        size_t available(void)
+        {
+            return (Mailbox_getNumPendingMsgs(handle()));
+        }
+        size_t space(void) { return (Mailbox_getNumFreeMsgs(handle())); }
+
+        /* for an Event to wait on alongside other sources */
+        Mailbox_Handle handle(void) { return (Mailbox_handle(&mbx)); }
+
+    private:
+        MessageQueue(const MessageQueue &);
+        MessageQueue &operator=(const MessageQueue &);
+
+        /* whole words, so the Mailbox's links after each stay aligned */
+        union Slot {
+            uint8_t bytes[sizeof(T)];
+            uint32_t align;
+        };
+
+        Mailbox_Struct mbx;
+        uint32_t storage[N * (sizeof(Mailbox_MbxElem) + sizeof(Slot)) /
+            sizeof(uint32_t)];
+};
+
+/*
+ *  ======== MessageBlock ========
+ *  A pool buffer with the link it is queued by
+ */
+template <typename T>
+struct MessageBlock
+{
+    Queue_Elem elem;
+    T data;
+
+    static MessageBlock *of(T *msg)
+    {
+        return ((MessageBlock *)((char *)msg - offsetof(MessageBlock, data)));
+    }
+};
+
+/*
+ *  ======== MessagePool ========
+ *  N buffers of type T; alloc() waits for one to be released
+ */
+template <typename T, size_t N>
+class MessagePool
+{
+    public:
+        MessagePool(void)
+        {
+            Semaphore_construct(&sem, N, NULL);
+            Queue_construct(&freeQueue, NULL);
+            for (size_t i = 0; i < N; i++) {
+                Queue_put(Queue_handle(&freeQueue), &blocks[i].elem);
+            }
+        }
+        ~MessagePool()
+        {
+            Queue_destruct(&freeQueue);
+            Semaphore_destruct(&sem);
+        }
+
+        /* NULL if none was released in timeout ticks */
+        T *alloc(uint32_t timeout = BIOS_WAIT_FOREVER)
+        {
+            if (!Semaphore_pend(Semaphore_handle(&sem), timeout)) {
+                return (NULL);
+            }
+            return (&((MessageBlock<T> *)
+                Queue_get(Queue_handle(&freeQueue)))->data);
+        }
+
+        void release(T *msg)
+        {
+            Queue_put(Queue_handle(&freeQueue),
+                &MessageBlock<T>::of(msg)->elem);
+            Semaphore_post(Semaphore_handle(&sem));
+        }
+
+        size_t available(void)
+        {
+            return (Semaphore_getCount(Semaphore_handle(&sem)));
+        }
+
+    private:
+        MessagePool(const MessagePool &);
+        MessagePool &operator=(const MessagePool &);
+
+        MessageBlock<T> blocks[N];
+        Queue_Struct freeQueue;
+        Semaphore_Struct sem;           /* counts the free blocks */
+};
+
+/*
+ *  ======== MessageChannel ========
+ *  Pool buffers in the order they were sent, of any number
+ */
+template <typename T>
+class MessageChannel
+{
+    public:
+        MessageChannel(void)
+        {
+            Semaphore_construct(&sem, 0, NULL);
+            Queue_construct(&queue, NULL);
+        }
+        ~MessageChannel()
+        {
+            Queue_destruct(&queue);
+            Semaphore_destruct(&sem);
+        }
+
+        void send(T *msg)
+        {
+            Queue_put(Queue_handle(&queue), &MessageBlock<T>::of(msg)->elem);
+            Semaphore_post(Semaphore_handle(&sem));
+        }
+
+        /* NULL if nothing was sent in timeout ticks */
+        T *receive(uint32_t timeout = BIOS_WAIT_FOREVER)
+        {
+            if (!Semaphore_pend(Semaphore_handle(&sem), timeout)) {
+                return (NULL);
+            }
+            return (&((MessageBlock<T> *)
+                Queue_get(Queue_handle(&queue)))->data);
+        }
+
+        size_t available(void)
+        {
+            return (Semaphore_getCount(Semaphore_handle(&sem)));
+        }
+
+    private:
+        MessageChannel(const MessageChannel &);
+        MessageChannel &operator=(const MessageChannel &);
+
+        Queue_Struct queue;
+        Semaphore_Struct sem;           /* counts the queued buffers */
+};
+
+#endif
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== Mutex.h ========
+ *  A task mutex, for resources that tasks of different priorities
+ *  share:
+ *
+ *      Mutex busLock;
+ *
+ *      void update()
+ *      {
+ *          MutexLock lock(busLock);    // released when lock goes
+ *          ...
+ *      }
+ *
+ *  Only the tasks waiting for it are held off, unlike with
+ *  Task_disable(); they get it in the order they asked. The holder
+ *  keeps its own priority, so keep what it does while holding it
+ *  short. The holder may lock it again; only the outermost unlock()
+ *  releases it.
+ *
+ *  Only tasks may lock a Mutex. Before BIOS_start() locking always
+ *  succeeds, with nothing to exclude.
+ */
+
+#ifndef Mutex_h
+#define Mutex_h
+
+#include <ti/sysbios/gates/GateMutex.h>
+
+class Mutex
+{
+    public:
+        Mutex(void) { GateMutex_construct(&gate, NULL); }
+        ~Mutex() { GateMutex_destruct(&gate); }
+
+        /* the key to unlock() with */
+        IArg lock(void) { return (GateMutex_enter(handle())); }
+        void unlock(IArg key) { GateMutex_leave(handle(), key); }
+
+        GateMutex_Handle handle(void)
+        {
+            return (GateMutex_handle(&gate));
+        }
+
+    private:
+        Mutex(const Mutex &);
+        Mutex &operator=(const Mutex &);
+
+        GateMutex_Struct gate;
+};
+
+/*
+ *  ======== MutexLock ========
+ *  Holds a Mutex for the lifetime of the object
+ */
+class MutexLock
+{
+    public:
+        MutexLock(Mutex &mutex) : mutex(mutex), key(mutex.lock()) {}
+        ~MutexLock() { mutex.unlock(key); }
+
+    private:
+        MutexLock(const MutexLock &);
+        MutexLock &operator=(const MutexLock &);
+
+        Mutex &mutex;
+        IArg key;
+};
+
+#endif
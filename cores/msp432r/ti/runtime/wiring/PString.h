@@ -74,7 +74,7 @@ public:
     { print(arg); return *this; }
 
     // Safe access to sprintf-like formatting, e.g. str.format("Hi, my name is %s and I'm %d years old", name, age);
-    int format(const char *str, ...);
+    int format(const char *str, ...) __attribute__((format(printf, 2, 3)));
 };
 
 #endif
@@ -30,6 +30,7 @@ int PString::format(const char *str, ...)
     va_list argptr;  
     va_start(argptr, str); 
     int ret = vsnprintf(_cur, _size - (_cur - _buf), str, argptr);
+    va_end(argptr);
     if (_size) {
         while (*_cur) {
             ++_cur;
@@ -37,4 +38,3 @@ int PString::format(const char *str, ...)
     }
     return ret;
 }
-
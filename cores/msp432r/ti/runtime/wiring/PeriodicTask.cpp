@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+#include "PeriodicTask.h"
+
+#include <xdc/runtime/Types.h>
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Swi.h>
+
+/*
+ * Clock ticks are 32 ACLK counts, not the nominal 1ms, and millis() is
+ * floor(ticks * tickUs / 1000). Release times are kept in ms and turned
+ * into the first tick at or after them.
+ */
+static uint32_t tickCounts;         /* Clock timer counts per tick */
+static uint32_t tickHz;             /* Clock timer frequency */
+
+static inline uint64_t msToTicks(uint64_t ms)
+{
+    uint64_t scaled = ms * tickHz;
+    uint64_t per = (uint64_t)1000 * tickCounts;
+
+    return ((scaled + per - 1) / per);
+}
+
+PeriodicTask::PeriodicTask(void)
+{
+    begun = false;
+    periodMs = 0;
+    releaseCount = 0;
+    overrunCount = 0;
+    waitedOverruns = 0;
+}
+
+/*
+ *  ======== clockFxn ========
+ *  Clock (Swi) context: release the loop and arm the next one
+ */
+void PeriodicTask::clockFxn(UArg arg)
+{
+    PeriodicTask *task = (PeriodicTask *)arg;
+
+    if (Semaphore_getCount(Semaphore_handle(&task->sem)) != 0) {
+        task->overrunCount++;
+    }
+    task->releaseCount++;
+    Semaphore_post(Semaphore_handle(&task->sem));
+
+    task->nextMs += task->periodMs;
+    task->arm();
+}
+
+/*
+ *  ======== arm ========
+ *  Start the one-shot Clock for nextMs. Called from clockFxn() or with
+ *  Swis disabled.
+ */
+void PeriodicTask::arm(void)
+{
+    /* Clock_getTicks() is the tick count mod 2^32, so is the difference */
+    int32_t timeout = (uint32_t)msToTicks(nextMs) - Clock_getTicks();
+
+    if (timeout <= 0) {
+        timeout = 1;
+    }
+
+    Clock_setTimeout(Clock_handle(&clock), timeout);
+    Clock_start(Clock_handle(&clock));
+}
+
+/*
+ *  ======== begin ========
+ *  periodMs from 1ms; the first release is the next millis() that is
+ *  phaseMs past a multiple of periodMs.
+ */
+bool PeriodicTask::begin(uint32_t periodMs, uint32_t phaseMs)
+{
+    Clock_Params clockParams;
+    Semaphore_Params semParams;
+    Types_FreqHz freq;
+    uint64_t now;
+    uint32_t swiKey;
+
+    if (begun || periodMs == 0) {
+        return (false);
+    }
+
+    if (tickHz == 0) {
+        Clock_TimerProxy_getFreq(Clock_getTimerHandle(), &freq);
+        tickCounts = Clock_TimerProxy_getPeriod(Clock_getTimerHandle());
+        tickHz = freq.lo;
+    }
+
+    this->periodMs = periodMs;
+    releaseCount = 0;
+    overrunCount = 0;
+    waitedOverruns = 0;
+
+    Semaphore_Params_init(&semParams);
+    semParams.mode = Semaphore_Mode_BINARY;
+    Semaphore_construct(&sem, 0, &semParams);
+
+    Clock_Params_init(&clockParams);
+    clockParams.arg = (UArg)this;
+    Clock_construct(&clock, clockFxn, 1, &clockParams);
+
+    swiKey = Swi_disable();
+
+    now = millis() + 1;
+    nextMs = now + (phaseMs % periodMs + periodMs - now % periodMs) %
+        periodMs;
+    arm();
+
+    Swi_restore(swiKey);
+
+    begun = true;
+
+    return (true);
+}
+
+/*
+ *  ======== end ========
+ */
+void PeriodicTask::end(void)
+{
+    if (!begun) {
+        return;
+    }
+
+    Clock_stop(Clock_handle(&clock));
+    Clock_destruct(&clock);
+    Semaphore_destruct(&sem);
+    begun = false;
+}
+
+/*
+ *  ======== wait ========
+ *  Block until the next release. Returns false if the loop overran
+ *  since the previous wait(), i.e. it is running late.
+ */
+bool PeriodicTask::wait(void)
+{
+    bool onTime;
+
+    if (!begun) {
+        return (false);
+    }
+
+    Semaphore_pend(Semaphore_handle(&sem), BIOS_WAIT_FOREVER);
+
+    onTime = (overrunCount == waitedOverruns);
+    waitedOverruns = overrunCount;
+
+    return (onTime);
+}
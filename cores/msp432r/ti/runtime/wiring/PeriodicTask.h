@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== PeriodicTask.h ========
+ *  Releases a sketch loop at fixed periods instead of delay() at the
+ *  end of loop(), which drifts by the loop's own execution time:
+ *
+ *      PeriodicTask control;
+ *
+ *      void setup() { control.begin(10); }
+ *      void loop()  { control.wait(); ... }
+ *
+ *  Release times are absolute, phaseMs + n * periodMs in millis(), so
+ *  a late loop doesn't push the following releases back, and loops in
+ *  different sketch tabs with commensurate periods release together.
+ *  A release that comes while the previous one hasn't been waited for
+ *  yet counts as an overrun; the loop then runs once for both.
+ *
+ *  Each release is a one-shot Clock timeout, so between releases the
+ *  board can stay in tickless deep sleep, and a release is up to one
+ *  Clock tick (~1ms) late.
+ */
+
+#ifndef PeriodicTask_h
+#define PeriodicTask_h
+
+#include <stdint.h>
+
+#include <ti/sysbios/knl/Clock.h>
+#include <ti/sysbios/knl/Semaphore.h>
+
+class PeriodicTask
+{
+    public:
+        PeriodicTask(void);
+
+        bool begin(uint32_t periodMs, uint32_t phaseMs = 0);
+        void end(void);
+
+        bool wait(void);            /* false if releases were missed */
+
+        uint32_t releases(void) { return (releaseCount); }
+        uint32_t overruns(void) { return (overrunCount); }
+        uint32_t period(void) { return (periodMs); }
+
+    private:
+        static void clockFxn(UArg arg);
+
+        void arm(void);
+
+        Clock_Struct clock;
+        Semaphore_Struct sem;
+        bool begun;
+
+        uint32_t periodMs;
+        uint64_t nextMs;            /* millis() of the next release */
+        volatile uint32_t releaseCount;
+        volatile uint32_t overrunCount;
+        uint32_t waitedOverruns;    /* overrunCount at the last wait() */
+};
+
+#endif
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+#include "PinGroup.h"
+
+/*
+ *  ======== PinGroup ========
+ *  Works out which ports the pins are on and whether they happen to
+ *  be consecutive bits of one port, the common wiring for a parallel
+ *  bus, so write() can shift instead of remapping bit by bit. Pins
+ *  without a GPIO are dropped from port updates.
+ */
+PinGroup::PinGroup(const uint8_t *pinList, uint8_t count)
+{
+    uint8_t i, j;
+
+    numPins = count > PIN_GROUP_MAX ? PIN_GROUP_MAX : count;
+    numPorts = 0;
+
+    for (i = 0; i < numPins; i++) {
+        uint8_t p = digitalPinToPort(pinList[i]);
+
+        pins[i] = pinList[i];
+        pinMask[i] = digitalPinToBitMask(pinList[i]);
+
+        for (j = 0; j < numPorts; j++) {
+            if (port[j] == p) {
+                break;
+            }
+        }
+        if (j == numPorts) {
+            port[j] = p;
+            portMask[j] = 0;
+            numPorts++;
+        }
+        pinPort[i] = j;
+        portMask[j] |= pinMask[i];
+    }
+
+    shift = -1;
+    if (numPorts == 1 && numPins != 0 && port[0] != 0) {
+        shift = __builtin_ctz(pinMask[0]);
+        for (i = 0; i < numPins; i++) {
+            if (pinMask[i] != (1 << (shift + i))) {
+                shift = -1;
+                break;
+            }
+        }
+    }
+}
+
+void PinGroup::pinMode(uint8_t mode)
+{
+    uint8_t i;
+
+    for (i = 0; i < numPins; i++) {
+        ::pinMode(pins[i], mode);
+    }
+}
+
+/*
+ *  ======== write ========
+ *  Bit i of value to pins[i], one portWrite() per port.
+ */
+void PinGroup::write(uint16_t value)
+{
+    uint8_t bits[PIN_GROUP_MAX];
+    uint8_t i;
+
+    if (shift >= 0) {
+        portWrite(port[0], portMask[0], (uint8_t)(value << shift));
+        return;
+    }
+
+    memset(bits, 0, numPorts);
+    for (i = 0; i < numPins; i++) {
+        if (value & (1 << i)) {
+            bits[pinPort[i]] |= pinMask[i];
+        }
+    }
+
+    for (i = 0; i < numPorts; i++) {
+        if (port[i] != 0) {
+            portWrite(port[i], portMask[i], bits[i]);
+        }
+    }
+}
+
+/*
+ *  ======== read ========
+ *  pins[i] as bit i, one portRead() per port.
+ */
+uint16_t PinGroup::read(void)
+{
+    uint8_t in[PIN_GROUP_MAX];
+    uint16_t value = 0;
+    uint8_t i;
+
+    if (shift >= 0) {
+        return ((portRead(port[0]) & portMask[0]) >> shift);
+    }
+
+    for (i = 0; i < numPorts; i++) {
+        in[i] = port[i] != 0 ? portRead(port[i]) : 0;
+    }
+
+    for (i = 0; i < numPins; i++) {
+        if (in[pinPort[i]] & pinMask[i]) {
+            value |= 1 << i;
+        }
+    }
+
+    return (value);
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== PinGroup.h ========
+ *  Up to 16 pins read and written as one value, bit i being pins[i].
+ *  Pins sharing a port are updated with a single portWrite(), so an
+ *  8-bit bus on one port costs one register store per write(); pins
+ *  spread over several ports take one store per port.
+ *
+ *      const uint8_t bus[] = {24, 5, 25, 6, 26, 27, 8, 28};
+ *      PinGroup data(bus, 8);
+ *
+ *      data.pinMode(OUTPUT);
+ *      data.write(0xa5);
+ */
+
+#ifndef PinGroup_h
+#define PinGroup_h
+
+#include <stdint.h>
+
+#define PIN_GROUP_MAX   16
+
+class PinGroup
+{
+    public:
+        PinGroup(const uint8_t *pins, uint8_t count);
+
+        void pinMode(uint8_t mode);
+        void write(uint16_t value);
+        uint16_t read(void);
+
+    private:
+        uint8_t numPins;
+        uint8_t numPorts;
+        uint8_t pins[PIN_GROUP_MAX];
+        uint8_t pinPort[PIN_GROUP_MAX];     /* index into port/portMask */
+        uint8_t pinMask[PIN_GROUP_MAX];
+        uint8_t port[PIN_GROUP_MAX];
+        uint8_t portMask[PIN_GROUP_MAX];
+
+        /* >= 0: the group is port[0] bits shift.. in order, no remapping */
+        int8_t shift;
+};
+
+#endif
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "Energia.h"
+#include "PortCapture.h"
+#include "wiring_fast.h"
+#include "wiring_dma.h"
+
+#include <ti/drivers/Power.h>
+#include <ti/drivers/power/PowerMSP432.h>
+#include <ti/drivers/timer/TimerMSP432.h>
+
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+#include <driverlib/rom.h>
+#include <driverlib/rom_map.h>
+#include <driverlib/dma.h>
+#include <driverlib/timer_a.h>
+
+#define NUM_PINS (sizeof(digital_pin_to_port_pin) / sizeof(digital_pin_to_port_pin[0]))
+
+#define NO_PIN          0xff
+#define CAPTURE_TIMERS  3
+
+/* the uDMA trigger of each capture timer's CCR0, as for pwmWaveformBegin() */
+static const uint32_t captureDmaSources[CAPTURE_TIMERS] = {
+    DMA_CH0_TIMERA0CCR0,
+    DMA_CH2_TIMERA1CCR0,
+    DMA_CH4_TIMERA2CCR0
+};
+
+PortCapture::PortCapture(void)
+{
+    begun = false;
+    isRunning = false;
+    blockCount = 0;
+    actualRate = 0;
+    startPin = NO_PIN;
+    stopPin = NO_PIN;
+    startArmed = false;
+    stopArmed = false;
+}
+
+/*
+ *  ======== begin ========
+ *  Sets up sampling of port (1-10) at rate samples per second into
+ *  buf0 and buf1, samples bytes each, stopped until start() or the
+ *  startOn() edge. Returns false if the rate can't be paced from
+ *  SMCLK, or no Timer_A with a free uDMA channel is left.
+ */
+bool PortCapture::begin(uint8_t port, uint32_t rate, uint8_t *buf0,
+    uint8_t *buf1, uint16_t samples, PortCaptureCallback fxn, void *arg)
+{
+    PowerMSP432_Freqs freqs;
+    Timer_A_Type *timer;
+    uint32_t counts, div;
+    uint8_t tmr;
+
+    end();
+
+    if (port < 1 || port > 10 || rate == 0 ||
+        rate > PORT_CAPTURE_MAX_RATE || buf0 == NULL || buf1 == NULL ||
+        samples == 0 || samples > PORT_CAPTURE_MAX_SAMPLES || fxn == NULL) {
+        return (false);
+    }
+
+    /* Timer_A's 16 bit period times its largest prescaler, 64 */
+    PowerMSP432_getFreqs(Power_getPerformanceLevel(), &freqs);
+    counts = freqs.SMCLK / rate;
+    for (div = 1; counts / div > 0xffff; div <<= 1) {
+        ;
+    }
+    if (div > 64 || counts / div < 2) {
+        return (false);
+    }
+
+    for (tmr = 0; tmr < CAPTURE_TIMERS; tmr++) {
+        timerBase = TIMER_A0_BASE + tmr * 0x400;
+        if (!TimerMSP432_allocateTimerResource(timerBase)) {
+            continue;
+        }
+        dmaCh = dmaAllocate(captureDmaSources[tmr]);
+        if (dmaCh >= 0) {
+            break;
+        }
+        TimerMSP432_freeTimerResource(timerBase);
+    }
+    if (tmr == CAPTURE_TIMERS) {
+        return (false);
+    }
+
+    /* SMCLK paces the samples */
+    Power_setConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    timerCtl = TIMER_A_CTL_SSEL__SMCLK | ((div > 8) ? TIMER_A_CTL_ID__8 :
+        (__builtin_ctz(div) << TIMER_A_CTL_ID_OFS));
+
+    timer = TIMER_A_CMSIS(timerBase);
+    timer->CTL = 0;
+    timer->CCTL[0] = 0;
+    timer->CCR[0] = counts / div - 1;
+    timer->EX0 = (div > 8) ? div / 8 - 1 : 0;
+    timer->CTL = timerCtl | TIMER_A_CTL_CLR;
+
+    portIn = fastPortReg(port, FAST_PIN_IN);
+    buf[0] = buf0;
+    buf[1] = buf1;
+    blockSamples = samples;
+    blockFxn = fxn;
+    blockArg = arg;
+    actualRate = freqs.SMCLK / (counts / div * div);
+    blockCount = 0;
+    isRunning = false;
+    begun = true;
+
+    flush();
+
+    return (true);
+}
+
+/*
+ *  ======== end ========
+ *  Stops sampling and gives the timer and uDMA channel back; samples
+ *  of a partial block are dropped.
+ */
+void PortCapture::end(void)
+{
+    if (!begun) {
+        return;
+    }
+
+    detachTriggers();
+    stop();
+
+    dmaStreamEnd(dmaCh);
+    dmaFree(dmaCh);
+
+    TIMER_A_CMSIS(timerBase)->CTL = 0;
+    TimerMSP432_freeTimerResource(timerBase);
+
+    Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    begun = false;
+}
+
+/*
+ *  ======== start ========
+ *  The first sample is taken one period from now. Can be called from
+ *  a Hwi.
+ */
+RAMFUNC void PortCapture::start(void)
+{
+    Timer_A_Type *timer;
+
+    if (!begun || isRunning) {
+        return;
+    }
+
+    timer = TIMER_A_CMSIS(timerBase);
+    timer->CTL = timerCtl | TIMER_A_CTL_CLR;
+    timer->CCTL[0] &= ~TIMER_A_CCTLN_CCIFG;
+    timer->CTL = timerCtl | TIMER_A_CTL_MC__UP;
+    isRunning = true;
+}
+
+/*
+ *  ======== stop ========
+ *  Can be called from a Hwi.
+ */
+RAMFUNC void PortCapture::stop(void)
+{
+    if (!begun) {
+        return;
+    }
+
+    TIMER_A_CMSIS(timerBase)->CTL = timerCtl;
+    isRunning = false;
+}
+
+/*
+ *  ======== startOn ========
+ *  start() at the next mode (RISING, FALLING, CHANGE) edge on pin
+ */
+bool PortCapture::startOn(uint8_t pin, int mode)
+{
+    detachTrigger(startPin, stopPin);
+    startPin = NO_PIN;
+
+    if (!attachTrigger(pin, mode)) {
+        return (false);
+    }
+
+    startPin = pin;
+    startArmed = true;
+
+    return (true);
+}
+
+/*
+ *  ======== stopOn ========
+ *  stop() at the next mode edge on pin, once sampling runs
+ */
+bool PortCapture::stopOn(uint8_t pin, int mode)
+{
+    detachTrigger(stopPin, startPin);
+    stopPin = NO_PIN;
+
+    if (!attachTrigger(pin, mode)) {
+        return (false);
+    }
+
+    stopPin = pin;
+    stopArmed = true;
+
+    return (true);
+}
+
+/*
+ *  ======== flush ========
+ *  Hand the block in progress to the callback and start over in buf0;
+ *  returns its sample count. Does nothing while sampling runs.
+ */
+uint16_t PortCapture::flush(void)
+{
+    uint32_t half;
+    uint16_t count;
+
+    if (!begun || isRunning) {
+        return (0);
+    }
+
+    /* an unstarted half reads back full size, a finished one 0 */
+    half = (filling == buf[0]) ? UDMA_PRI_SELECT : UDMA_ALT_SELECT;
+    count = 0;
+    if (dmaBusy(dmaCh)) {
+        count = blockSamples - MAP_DMA_getChannelSize(dmaCh | half);
+    }
+    dmaStreamEnd(dmaCh);
+
+    if (count != 0) {
+        blockFxn(filling, count, blockArg);
+    }
+
+    /* a sample period that ended since stop() must not fire the uDMA */
+    TIMER_A_CMSIS(timerBase)->CCTL[0] &= ~TIMER_A_CCTLN_CCIFG;
+    filling = buf[0];
+    dmaStreamBegin(dmaCh, portIn, false, buf[0], buf[1], blockSamples, 1,
+        dmaFxn, (uintptr_t)this);
+
+    return (count);
+}
+
+/*
+ *  ======== attachTrigger ========
+ *  The direct port Hwi if the pin's port has none yet, else the GPIO
+ *  driver's dispatch
+ */
+bool PortCapture::attachTrigger(uint8_t pin, int mode)
+{
+    if (!begun || pin >= NUM_PINS || digital_pin_to_port_pin[pin] == 0) {
+        return (false);
+    }
+
+    /* the other trigger's pin, now with this mode */
+    detachTrigger(pin, NO_PIN);
+
+    if (!attachInterruptDirect(pin, triggerFxn, this, mode)) {
+        attachInterruptArg(pin, triggerFxn, this, mode);
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== detachTrigger ========
+ *  Take pin's trigger off, unless the other trigger still uses it
+ */
+void PortCapture::detachTrigger(uint8_t pin, uint8_t other)
+{
+    if (pin != NO_PIN && pin != other &&
+        (pin == startPin || pin == stopPin)) {
+        disablePinInterrupt(pin);
+        detachInterrupt(pin);
+    }
+}
+
+/*
+ *  ======== detachTriggers ========
+ */
+void PortCapture::detachTriggers(void)
+{
+    startArmed = false;
+    stopArmed = false;
+
+    detachTrigger(startPin, stopPin);
+    detachTrigger(stopPin, NO_PIN);
+
+    startPin = NO_PIN;
+    stopPin = NO_PIN;
+}
+
+/*
+ *  ======== triggerFxn ========
+ *  A trigger pin's edge: the armed start while stopped, the armed
+ *  stop while running
+ */
+RAMFUNC void PortCapture::triggerFxn(void *arg)
+{
+    PortCapture *capture = (PortCapture *)arg;
+
+    if (!capture->isRunning) {
+        if (capture->startArmed) {
+            capture->startArmed = false;
+            capture->start();
+        }
+    }
+    else if (capture->stopArmed) {
+        capture->stopArmed = false;
+        capture->stop();
+    }
+}
+
+/*
+ *  ======== dmaFxn ========
+ *  DMA_INT0 Hwi, a buffer is full; the uDMA already fills the other
+ */
+void PortCapture::dmaFxn(void *buffer, uintptr_t arg)
+{
+    PortCapture *capture = (PortCapture *)arg;
+
+    capture->filling = (buffer == capture->buf[0]) ?
+        capture->buf[1] : capture->buf[0];
+    capture->blockCount++;
+
+    capture->blockFxn((const uint8_t *)buffer, capture->blockSamples,
+        capture->blockArg);
+}
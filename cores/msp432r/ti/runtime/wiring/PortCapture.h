@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *  ======== PortCapture.h ========
+ *  Logic analyzer style sampling of a whole 8 bit port into ping-pong
+ *  buffers at a fixed rate, delivered a block at a time.
+ *
+ *  A free Timer_A (TA0-TA2) counts up from SMCLK, and each CCR0 event
+ *  triggers the uDMA channel routed to it, which copies PxIN into the
+ *  next byte of the buffer. The CPU only sees one DMA_INT0 interrupt
+ *  per block, to hand it over and re-arm it:
+ *
+ *      uint8_t buf0[512], buf1[512];
+ *      PortCapture capture;
+ *
+ *      capture.begin(4, 1000000, buf0, buf1, 512, gotBlock);
+ *      capture.startOn(PUSH1, FALLING);   // or start() right away
+ *      capture.stopOn(PUSH2, FALLING);    // or stop()
+ *      ...
+ *      if (!capture.running()) {
+ *          capture.flush();               // the last, partial block
+ *      }
+ *
+ *  The callback gets each full block in the DMA_INT0 Hwi, and has
+ *  until the other buffer fills to return. Sampling runs until stop()
+ *  or the stop edge; flush() then hands over the samples of the block
+ *  in progress, from the calling Task, and re-arms the buffers so the
+ *  next start() begins a fresh block.
+ *
+ *  Start and stop edges are taken in the pin's port Hwi, a few us
+ *  after the edge; the direct port Hwi is used when the port has none
+ *  yet. Each trigger fires once per startOn() or stopOn() call. The
+ *  two may share a pin, with the mode of the later call.
+ *
+ *  begin() leaves the port's pins as they are: make them inputs first.
+ *  The timer's uDMA channel (0, 2 or 4) must be free, which SPI, Wire
+ *  or Serial may hold on some boards. While begun, performance level
+ *  changes and DEEPSLEEP_0 are disallowed.
+ */
+
+#ifndef PortCapture_h
+#define PortCapture_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* what the uDMA keeps up with while the rest of the bus is quiet */
+#ifndef PORT_CAPTURE_MAX_RATE
+#define PORT_CAPTURE_MAX_RATE       4000000
+#endif
+
+#define PORT_CAPTURE_MAX_SAMPLES    1024    /* one uDMA transfer */
+
+/* block holds count samples, count < the block size only from flush() */
+typedef void (*PortCaptureCallback)(const uint8_t *block, uint16_t count,
+    void *arg);
+
+class PortCapture
+{
+    public:
+        PortCapture(void);
+
+        bool begin(uint8_t port, uint32_t rate, uint8_t *buf0,
+            uint8_t *buf1, uint16_t samples, PortCaptureCallback fxn,
+            void *arg = NULL);
+        void end(void);
+
+        void start(void);
+        void stop(void);
+        bool startOn(uint8_t pin, int mode);
+        bool stopOn(uint8_t pin, int mode);
+        uint16_t flush(void);
+
+        bool running(void) { return (isRunning); }
+        uint32_t rate(void) { return (actualRate); }    /* samples/s */
+        uint32_t blocks(void) { return (blockCount); }  /* full ones */
+
+    private:
+        static void dmaFxn(void *buffer, uintptr_t arg);
+        static void triggerFxn(void *arg);
+
+        bool attachTrigger(uint8_t pin, int mode);
+        void detachTrigger(uint8_t pin, uint8_t other);
+        void detachTriggers(void);
+
+        uint32_t timerBase;
+        uint16_t timerCtl;          /* TAxCTL with the timer stopped */
+        int dmaCh;
+        volatile uint8_t *portIn;
+
+        uint8_t *buf[2];
+        uint16_t blockSamples;
+        PortCaptureCallback blockFxn;
+        void *blockArg;
+        bool begun;
+
+        uint8_t * volatile filling; /* the buffer the uDMA writes */
+        volatile bool isRunning;
+        volatile uint32_t blockCount;
+        uint32_t actualRate;
+
+        uint8_t startPin;           /* 0xff if none */
+        uint8_t stopPin;
+        volatile bool startArmed;
+        volatile bool stopArmed;
+};
+
+#endif
@@ -20,11 +20,13 @@
  Modified for msp430 2012 by Robert Wessels
  */
 
+#include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include "Energia.h"
 #include "Print.h"
+#include "itoa.h"
 
 // Public Methods //////////////////////////////////////////////////////////////
 
@@ -77,8 +79,7 @@ size_t Print::print(long n, int base)
     } else if (base == 10) {
         if (n < 0) {
             int t = print('-');
-            n = -n;
-            return (printNumber(n, 10) + t);
+            return (printNumber(0UL - (unsigned long)n, 10) + t);
         }
         return (printNumber(n, 10));
     } else {
@@ -92,6 +93,27 @@ size_t Print::print(unsigned long n, int base)
     else return printNumber(n, base);
 }
 
+size_t Print::print(int64_t n, int base)
+{
+    if (base == 0) {
+        return (write(n));
+    } else if (base == 10) {
+        if (n < 0) {
+            int t = print('-');
+            return (printNumber64(0ULL - (uint64_t)n, 10) + t);
+        }
+        return (printNumber64(n, 10));
+    } else {
+        return (printNumber64(n, base));
+    }
+}
+
+size_t Print::print(uint64_t n, int base)
+{
+    if (base == 0) return write(n);
+    else return printNumber64(n, base);
+}
+
 size_t Print::print(float n, int digits)
 {
     return (printFloat(n, digits));
@@ -102,6 +124,180 @@ size_t Print::print(const Printable& x)
     return (x.printTo(*this));
 }
 
+/*
+ * Each conversion is formatted into a field buffer with the same
+ * helpers as print() and written with its padding; the text between
+ * conversions goes out as is, one write() per run.
+ */
+size_t Print::printf(const char *format, ...)
+{
+    va_list ap;
+    size_t n;
+
+    va_start(ap, format);
+    n = vprintf(format, ap);
+    va_end(ap);
+
+    return (n);
+}
+
+size_t Print::vprintf(const char *format, va_list ap)
+{
+    size_t n = 0;
+
+    while (*format != '\0') {
+        const char *text = format;
+        char buf[32];
+        char *end = &buf[sizeof(buf)];
+        char *str;
+        size_t len;
+        char sign = 0;
+        bool left = false, zero = false, numeric = true;
+        int width = 0, precision = -1, size = 0, zeros = 0, pad;
+
+        while (*format != '\0' && *format != '%') format++;
+        if (format != text) {
+            n += write((const uint8_t *)text, format - text);
+        }
+        if (*format++ == '\0') break;
+
+        // flags, width, precision, length
+        for (;; format++) {
+            if (*format == '-') left = true;
+            else if (*format == '0') zero = true;
+            else if (*format == '+') sign = '+';
+            else if (*format == ' ') { if (sign == 0) sign = ' '; }
+            else break;
+        }
+        if (*format == '*') {
+            width = va_arg(ap, int);
+            if (width < 0) {
+                left = true;
+                width = -width;
+            }
+            format++;
+        }
+        while (*format >= '0' && *format <= '9') {
+            width = width * 10 + *format++ - '0';
+        }
+        if (*format == '.') {
+            precision = 0;
+            if (*++format == '*') {
+                precision = va_arg(ap, int);
+                format++;
+            }
+            while (*format >= '0' && *format <= '9') {
+                precision = precision * 10 + *format++ - '0';
+            }
+        }
+        for (;; format++) {
+            if (*format == 'h') size--;
+            else if (*format == 'l') size++;
+            else if (*format != 'z' && *format != 't') break;
+        }
+
+        switch (*format) {
+            case 'd':
+            case 'i': {
+                int64_t v = size >= 2 ? va_arg(ap, long long) :
+                    size == 1 ? va_arg(ap, long) : va_arg(ap, int);
+
+                if (size == -1) v = (short)v;
+                if (size <= -2) v = (signed char)v;
+                if (v < 0) sign = '-';
+                str = formatUnsigned64(v < 0 ? 0ULL - (uint64_t)v : v, 10, 1, end);
+                if (precision == 0 && v == 0) str = end;
+                break;
+            }
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+            case 'p': {
+                uint64_t v;
+
+                if (*format == 'p') v = (uintptr_t)va_arg(ap, void *);
+                else if (size >= 2) v = va_arg(ap, unsigned long long);
+                else if (size == 1) v = va_arg(ap, unsigned long);
+                else v = va_arg(ap, unsigned int);
+
+                if (size == -1) v = (unsigned short)v;
+                if (size <= -2) v = (unsigned char)v;
+                sign = 0;
+                str = formatUnsigned64(v, *format == 'u' ? 10 :
+                    *format == 'o' ? 8 : 16, *format == 'X', end);
+                if (*format == 'p') {
+                    *--str = 'x';
+                    *--str = '0';
+                }
+                if (precision == 0 && v == 0) str = end;
+                break;
+            }
+            case 'f':
+            case 'F':
+            case 'e':       // no separate exponent and shortest forms,
+            case 'E':       // large values switch to d.ddde+XX anyway
+            case 'g':
+            case 'G':
+                str = formatDouble(va_arg(ap, double),
+                    precision < 0 ? 6 : precision, end);
+                if (*str == '-') {
+                    sign = *str++;
+                }
+                if (*str == 'n' || *str == 'i') {
+                    zero = false;
+                }
+                precision = -1;
+                break;
+            case 'c':
+                buf[0] = va_arg(ap, int);
+                str = buf;
+                end = &buf[1];
+                numeric = false;
+                break;
+            case 's':
+                str = va_arg(ap, char *);
+                if (str == NULL) str = (char *)"(null)";
+                end = str + (precision < 0 ? strlen(str) :
+                    strnlen(str, precision));
+                numeric = false;
+                break;
+            case '\0':     // a lone % at the end
+                format--;
+                str = end;
+                numeric = false;
+                break;
+            default:        // %% and anything unknown print as is
+                str = (char *)format;
+                end = str + 1;
+                numeric = false;
+                break;
+        }
+        format++;
+
+        len = end - str;
+        if (!numeric) {
+            sign = 0;
+        }
+        else if (precision > (int)len) {
+            zeros = precision - len;
+        }
+        pad = width - (int)len - zeros - (sign != 0);
+        if (pad > 0 && zero && !left && numeric && precision < 0) {
+            zeros += pad;
+            pad = 0;
+        }
+
+        for (; !left && pad > 0; pad--) n += write(' ');
+        if (sign != 0) n += write(sign);
+        for (; zeros > 0; zeros--) n += write('0');
+        n += write((const uint8_t *)str, len);
+        for (; pad > 0; pad--) n += write(' ');
+    }
+
+    return (n);
+}
+
 size_t Print::println(void)
 {
     size_t n = print('\r');
@@ -165,6 +361,20 @@ size_t Print::println(unsigned long num, int base)
     return (n);
 }
 
+size_t Print::println(int64_t num, int base)
+{
+    size_t n = print(num, base);
+    n += println();
+    return (n);
+}
+
+size_t Print::println(uint64_t num, int base)
+{
+    size_t n = print(num, base);
+    n += println();
+    return (n);
+}
+
 size_t Print::println(float num, int digits)
 {
     size_t n = print(num, digits);
@@ -183,61 +393,30 @@ size_t Print::println(const Printable& x)
 
 size_t Print::printNumber(unsigned long n, uint8_t base)
 {
-    char buf[8 * sizeof(long) + 1]; // Assumes 8-bit chars plus zero byte.
-    char *str = &buf[sizeof(buf) - 1];
+    char buf[8 * sizeof(long)]; // Assumes 8-bit chars
+    char *end = &buf[sizeof(buf)];
+    char *str;
 
-    *str = '\0';
+    if (base < 2) base = 10;    // prevent crash if called with base == 1
+    str = formatUnsigned64(n, base, 1, end);
 
-    // prevent crash if called with base == 1
-    if (base < 2) base = 10;
+    return (write((const uint8_t *)str, end - str));
+}
 
-    do {
-        unsigned long m = n;
-        n /= base;
-        char c = m - base * n;
-        *--str = c < 10 ? c + '0' : c + 'A' - 10;
-    } while(n);
+size_t Print::printNumber64(uint64_t n, uint8_t base)
+{
+    char buf[8 * sizeof(uint64_t)];
+    char *end = &buf[sizeof(buf)];
+    char *str = formatUnsigned64(n, base, 1, end);
 
-    return (write(str));
+    return (write((const uint8_t *)str, end - str));
 }
 
-
 size_t Print::printFloat(float number, uint8_t digits)
 {
-    size_t n = 0;
-
-    // Handle negative numbers
-    if (number < 0.0)
-    {
-        n += print('-');
-        number = -number;
-    }
+    char buf[32];
+    char *end = &buf[sizeof(buf)];
+    char *str = formatFloat(number, digits, end);
 
-    // Round correctly so that print(1.999, 2) prints as "2.00"
-    float rounding = 0.5;
-    for (uint8_t i=0; i<digits; ++i)
-        rounding /= 10.0f;
-
-    number += rounding;
-
-    // Extract the integer part of the number and print it
-    unsigned long int_part = (unsigned long)number;
-    float remainder = number - (float)int_part;
-    n += print(int_part);
-
-    // Print the decimal point, but only if there are digits beyond
-    if (digits > 0) {
-        n += print(".");
-    }
-
-    // Extract digits from the remainder one at a time
-    while (digits-- > 0)
-    {
-        remainder *= 10.0;
-        int toPrint = int(remainder);
-        n += print(toPrint);
-        remainder -= toPrint;
-    }
-
-    return (n);
+    return (write((const uint8_t *)str, end - str));
 }
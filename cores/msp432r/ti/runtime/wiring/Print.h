@@ -21,6 +21,7 @@
 #define Print_h
 
 #include <inttypes.h>
+#include <stdarg.h>
 #include <stddef.h>    // for size_t
 #include <string.h>    // for strlen
 
@@ -32,11 +33,15 @@
 #define OCT 8
 #define BIN 2
 
+// fraction digits print(float/double) goes up to
+#define PRINT_FLOAT_DIGITS 9
+
 class Print
 {
     private:
         int write_error;
         size_t printNumber(unsigned long, uint8_t);
+        size_t printNumber64(uint64_t, uint8_t);
         size_t printFloat(double, uint8_t);
         size_t printFloat(float, uint8_t);
 
@@ -67,10 +72,22 @@ class Print
         size_t print(unsigned int, int = DEC);
         size_t print(long, int = DEC);
         size_t print(unsigned long, int = DEC);
+        size_t print(int64_t, int = DEC);
+        size_t print(uint64_t, int = DEC);
         size_t print(double, int = 2);
         size_t print(float, int = 2);
         size_t print(const Printable&);
 
+        // printf() without the C library's formatter or any buffer beyond
+        // one field: flags -+ 0, width, precision, h hh l ll z, and the
+        // conversions d i u x X o c s p f %, with e and g printed as f.
+        // Format strings are checked against the arguments at compile
+        // time.
+        size_t printf(const char *format, ...)
+            __attribute__((format(printf, 2, 3)));
+        size_t vprintf(const char *format, va_list ap)
+            __attribute__((format(printf, 2, 0)));
+
         size_t println(const String &s);
         size_t println(const char[]);
         size_t println(char);
@@ -79,6 +96,8 @@ class Print
         size_t println(unsigned int, int = DEC);
         size_t println(long, int = DEC);
         size_t println(unsigned long, int = DEC);
+        size_t println(int64_t, int = DEC);
+        size_t println(uint64_t, int = DEC);
         size_t println(double, int = 2);
         size_t println(float, int = 2);
         size_t println(const Printable&);
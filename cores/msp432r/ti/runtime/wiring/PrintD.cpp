@@ -20,7 +20,10 @@
  Modified for msp403 2012 by Robert Wessels
  */
 
+#include <math.h>
+#include <string.h>
 #include "Print.h"
+#include "avr/dtostrf.h"
 
 /**********************************************/
 /* (double-precision) methods                 */
@@ -45,40 +48,9 @@ size_t Print::println(double num, int digits)
 
 size_t Print::printFloat(double number, uint8_t digits)
 {
-    size_t n = 0;
+    char buf[32];
+    char *end = &buf[sizeof(buf)];
+    char *str = formatDouble(number, digits, end);
 
-    // Handle negative numbers
-    if (number < 0.0)
-    {
-        n += print('-');
-        number = -number;
-    }
-
-    // Round correctly so that print(1.999, 2) prints as "2.00"
-    double rounding = 0.5;
-    for (uint8_t i = 0; i < digits; ++i)
-        rounding /= 10.0;
-
-    number += rounding;
-
-    // Extract the integer part of the number and print it
-    unsigned long int_part = (unsigned long)number;
-    double remainder = number - (double)int_part;
-    n += print(int_part);
-
-    // Print the decimal point, but only if there are digits beyond
-    if (digits > 0) {
-        n += print(".");
-    }
-
-    // Extract digits from the remainder one at a time
-    while (digits-- > 0)
-    {
-        remainder *= 10.0;
-        int toPrint = int(remainder);
-        n += print(toPrint);
-        remainder -= toPrint;
-    }
-
-    return (n);
+    return (write((const uint8_t *)str, end - str));
 }
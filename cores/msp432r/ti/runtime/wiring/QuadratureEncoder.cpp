@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "Energia.h"
+#include "QuadratureEncoder.h"
+#include "wiring_fast.h"
+
+#include <ti/drivers/Power.h>
+#include <ti/drivers/power/PowerMSP432.h>
+
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+#define NUM_PINS (sizeof(digital_pin_to_port_pin) / sizeof(digital_pin_to_port_pin[0]))
+
+/*
+ * X4 count steps by (previous state << 2) | state, a state being
+ * A << 1 | B. A leading B counts up: 00, 10, 11, 01. Entries where
+ * both inputs changed are missed edges and count nothing.
+ */
+static const int8_t quadratureSteps[16] = {
+     0, -1,  1,  0,
+     1,  0,  0, -1,
+    -1,  0,  0,  1,
+     0,  1, -1,  0
+};
+
+QuadratureEncoder::QuadratureEncoder(void)
+{
+    begun = false;
+    count = 0;
+    missed = 0;
+}
+
+/*
+ *  ======== begin ========
+ *  Inputs get pull-ups, for open collector encoders. Returns false if
+ *  either pin is not on an interrupt port (P1-P6). MCLK has to run
+ *  for the edge timestamps, so DEEPSLEEP_0 is disallowed until end().
+ */
+bool QuadratureEncoder::begin(uint8_t pinA, uint8_t pinB,
+    uint8_t resolution)
+{
+    uint16_t portA, portB;
+
+    end();
+
+    if (pinA >= NUM_PINS || pinB >= NUM_PINS) {
+        return (false);
+    }
+
+    portA = digital_pin_to_port_pin[pinA];
+    portB = digital_pin_to_port_pin[pinB];
+    if ((portA >> 8) == 0 || (portA >> 8) > 6
+        || (portB >> 8) == 0 || (portB >> 8) > 6) {
+        return (false);
+    }
+
+    this->pinA = pinA;
+    this->pinB = pinB;
+    this->resolution = resolution;
+
+    pinMode(pinA, INPUT_PULLUP);
+    pinMode(pinB, INPUT_PULLUP);
+    inA = fastPinAlias(portA, FAST_PIN_IN);
+    inB = fastPinAlias(portB, FAST_PIN_IN);
+
+    Power_setConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+
+    state = (*inA << 1) | *inB;
+    direction = 1;
+    edgeTime = cycles();
+    edgeInterval = 0;
+    lastCount = count;
+    lastEdgeTime = edgeTime;
+
+    if (resolution == QUADRATURE_X1) {
+        attach(pinA, x1Fxn);
+    }
+    else if (resolution == QUADRATURE_X2) {
+        attach(pinA, x2Fxn);
+    }
+    else {
+        this->resolution = QUADRATURE_X4;
+        attach(pinA, x4Fxn);
+        attach(pinB, x4Fxn);
+    }
+
+    begun = true;
+
+    return (true);
+}
+
+/*
+ *  ======== attach ========
+ *  The direct port Hwi if the pin's port has none yet, else the GPIO
+ *  driver's dispatch
+ */
+void QuadratureEncoder::attach(uint8_t pin, void (*fxn)(void *))
+{
+    int mode = (resolution == QUADRATURE_X1) ? RISING : CHANGE;
+
+    if (!attachInterruptDirect(pin, fxn, this, mode)) {
+        attachInterruptArg(pin, fxn, this, mode);
+    }
+}
+
+/*
+ *  ======== end ========
+ *  The position is kept
+ */
+void QuadratureEncoder::end(void)
+{
+    if (!begun) {
+        return;
+    }
+
+    disablePinInterrupt(pinA);
+    detachInterrupt(pinA);
+    if (resolution == QUADRATURE_X4) {
+        disablePinInterrupt(pinB);
+        detachInterrupt(pinB);
+    }
+
+    Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+
+    begun = false;
+}
+
+/*
+ *  ======== setPosition ========
+ */
+void QuadratureEncoder::setPosition(int32_t position)
+{
+    uint32_t hwiKey;
+
+    hwiKey = Hwi_disable();
+    lastCount += position - count;
+    count = position;
+    Hwi_restore(hwiKey);
+}
+
+/*
+ *  ======== step ========
+ *  Count one edge in direction dir and timestamp it
+ */
+inline __attribute__((always_inline)) void QuadratureEncoder::step(
+    int32_t dir)
+{
+    uint32_t now = cycles();
+
+    count += dir;
+    direction = dir;
+    edgeInterval = now - edgeTime;
+    edgeTime = now;
+}
+
+/*
+ *  ======== x1Fxn ========
+ *  A rose: B is still low if A leads
+ */
+RAMFUNC void QuadratureEncoder::x1Fxn(void *arg)
+{
+    QuadratureEncoder *enc = (QuadratureEncoder *)arg;
+
+    enc->step(*enc->inB ? -1 : 1);
+}
+
+/*
+ *  ======== x2Fxn ========
+ *  A changed: A and B differ right after an edge of A if A leads
+ */
+RAMFUNC void QuadratureEncoder::x2Fxn(void *arg)
+{
+    QuadratureEncoder *enc = (QuadratureEncoder *)arg;
+
+    enc->step((*enc->inA != *enc->inB) ? 1 : -1);
+}
+
+/*
+ *  ======== x4Fxn ========
+ *  A or B changed. An edge undone before the Hwi read the pins finds
+ *  the state unchanged and counts nothing.
+ */
+RAMFUNC void QuadratureEncoder::x4Fxn(void *arg)
+{
+    QuadratureEncoder *enc = (QuadratureEncoder *)arg;
+    uint32_t state = (*enc->inA << 1) | *enc->inB;
+    uint32_t index = (enc->state << 2) | state;
+
+    enc->state = state;
+
+    if (quadratureSteps[index] != 0) {
+        enc->step(quadratureSteps[index]);
+    }
+    else if (((index >> 2) ^ state) == 3) {
+        enc->missed++;
+    }
+}
+
+/*
+ *  ======== velocity ========
+ *  Counts per second. Several edges since the previous call: their
+ *  count over the time from the last edge then to the last edge now.
+ *  One or none: the last edge interval, or the time since the last
+ *  edge if that is longer already.
+ */
+float QuadratureEncoder::velocity(void)
+{
+    uint32_t hwiKey;
+    uint32_t now, since, interval, stop, t;
+    int32_t c, delta;
+    int8_t dir;
+    float hz = getCpuFrequency();
+    float v;
+
+    if (!begun) {
+        return (0);
+    }
+
+    hwiKey = Hwi_disable();
+    c = count;
+    t = edgeTime;
+    interval = edgeInterval;
+    dir = direction;
+    now = cycles();
+
+    /* keep since from wrapping while the encoder stands still */
+    stop = (uint32_t)(hz / 1000 * QUADRATURE_STOP_MS);
+    since = now - t;
+    if (since > stop) {
+        edgeTime = t = now - stop;
+        since = stop;
+    }
+    Hwi_restore(hwiKey);
+
+    delta = c - lastCount;
+
+    if (since >= stop) {
+        v = 0;
+    }
+    else if ((delta > 1 || delta < -1) && t != lastEdgeTime) {
+        v = delta * hz / (t - lastEdgeTime);
+    }
+    else {
+        if (since > interval) {
+            interval = since;
+        }
+        v = (interval != 0) ? dir * hz / interval : 0;
+    }
+
+    lastCount = c;
+    lastEdgeTime = t;
+
+    return (v);
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *  ======== QuadratureEncoder.h ========
+ *  Position and velocity of an incremental encoder's A/B outputs.
+ *
+ *  The MSP432 has no quadrature decoder, so edges are decoded in the
+ *  pins' port Hwi, through attachInterruptDirect(): no GPIO driver
+ *  dispatch, a RAMFUNC handler that reads both inputs through their
+ *  bit-band aliases and counts up or down. The resolution picks how
+ *  many edges interrupt per encoder cycle:
+ *
+ *      QUADRATURE_X1   A rising, direction from B          1 per cycle
+ *      QUADRATURE_X2   both edges of A                     2 per cycle
+ *      QUADRATURE_X4   both edges of A and B (state table) 4 per cycle
+ *
+ *  X4 needs A and B on different ports for both to get the direct
+ *  path (one direct pin per port); otherwise B goes through the
+ *  driver's dispatch, which is slower but still correct. X1 and X2
+ *  ignore bounce on B, so they also suit mechanical encoders.
+ *
+ *      QuadratureEncoder wheel;
+ *
+ *      wheel.begin(PIN_A, PIN_B, QUADRATURE_X4);
+ *      ...
+ *      rpm = wheel.velocity() * 60 / COUNTS_PER_REV;
+ *
+ *  Velocity is taken between edge timestamps, so it is exact at speed
+ *  and at one count per call interval alike; with no edges it decays
+ *  as 1/(time since the last edge) and reads 0 after the stop time.
+ */
+
+#ifndef QuadratureEncoder_h
+#define QuadratureEncoder_h
+
+#include <stdint.h>
+
+/* begin() resolutions, counts per encoder cycle */
+#define QUADRATURE_X1   1
+#define QUADRATURE_X2   2
+#define QUADRATURE_X4   4
+
+/* velocity() reads 0 after this long without an edge */
+#ifndef QUADRATURE_STOP_MS
+#define QUADRATURE_STOP_MS  250
+#endif
+
+class QuadratureEncoder
+{
+    public:
+        QuadratureEncoder(void);
+
+        bool begin(uint8_t pinA, uint8_t pinB,
+            uint8_t resolution = QUADRATURE_X4);
+        void end(void);
+
+        int32_t position(void) { return (count); }
+        void setPosition(int32_t position);
+
+        float velocity(void);       /* counts per second, signed */
+        uint32_t errors(void) { return (missed); }  /* X4 skipped states */
+
+    private:
+        static void x1Fxn(void *arg);
+        static void x2Fxn(void *arg);
+        static void x4Fxn(void *arg);
+
+        void step(int32_t dir);
+        void attach(uint8_t pin, void (*fxn)(void *));
+
+        uint8_t pinA;
+        uint8_t pinB;
+        uint8_t resolution;
+        bool begun;
+
+        volatile uint32_t *inA;     /* bit-band aliases of PxIN */
+        volatile uint32_t *inB;
+        uint8_t state;              /* X4: A << 1 | B at the last edge */
+
+        volatile int32_t count;
+        volatile uint32_t missed;
+        volatile int8_t direction;  /* of the last edge, 1 or -1 */
+        volatile uint32_t edgeTime; /* Timestamp_get32() of the last edge */
+        volatile uint32_t edgeInterval; /* between the last two edges */
+
+        int32_t lastCount;          /* at the previous velocity() */
+        uint32_t lastEdgeTime;
+};
+
+#endif
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+#include "RTC.h"
+#include "wiring_private.h"
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Clock.h>
+
+#include <driverlib/rom.h>
+#include <driverlib/rom_map.h>
+#include <driverlib/cs.h>
+#include <driverlib/rtc_c.h>
+
+/* how long begin() waits for the crystal to start */
+#define RTC_LFXT_TIMEOUT_MS 1000
+
+#define RTC_CALENDAR_INTS (RTC_C_TIME_EVENT_INTERRUPT | \
+    RTC_C_CLOCK_ALARM_INTERRUPT | RTC_C_CLOCK_READ_READY_INTERRUPT)
+
+RTCClass RTC;
+
+/*
+ * Civil date <-> days since 1970-01-01 for years 0 - 4095, counting
+ * years from March so the leap day is the last day of a year
+ */
+#define RTC_DAYS_0000_TO_1970   719468
+
+/*
+ *  ======== daysFromDate ========
+ */
+static int32_t daysFromDate(uint32_t year, uint32_t month, uint32_t day)
+{
+    uint32_t yoe, doy;
+
+    if (month <= 2) {
+        year--;
+        month += 12;
+    }
+    yoe = (year + 400) % 400;       /* year 0 Jan/Feb is year -1 */
+    doy = (153 * (month - 3) + 2) / 5 + day - 1;
+
+    return ((int32_t)((year + 400) / 400 - 1) * 146097 +
+        yoe * 365 + yoe / 4 - yoe / 100 + doy - RTC_DAYS_0000_TO_1970);
+}
+
+/*
+ *  ======== dateFromDays ========
+ *  Inverse of daysFromDate() for days >= 0
+ */
+static void dateFromDays(uint32_t days, RTCTime *time)
+{
+    uint32_t era, doe, yoe, doy, mp;
+
+    days += RTC_DAYS_0000_TO_1970;
+    era = days / 146097;
+    doe = days % 146097;
+    yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    mp = (5 * doy + 2) / 153;
+
+    time->day = doy - (153 * mp + 2) / 5 + 1;
+    time->month = mp < 10 ? mp + 3 : mp - 9;
+    time->year = era * 400 + yoe + (time->month <= 2);
+}
+
+RTCClass::RTCClass(void)
+{
+    begun = false;
+    onCrystal = false;
+    alarmFxn = NULL;
+    periodicFxn = NULL;
+}
+
+/*
+ *  ======== hwiFxn ========
+ *  Calendar part of the INT_RTC_C Hwi, see rtcAttach()
+ */
+void RTCClass::hwiFxn(void)
+{
+    uint_fast8_t status;
+    void (*fxn)(void);
+
+    status = MAP_RTC_C_getEnabledInterruptStatus() & RTC_CALENDAR_INTS;
+    MAP_RTC_C_clearInterruptFlag(status);
+
+    if (status & RTC_C_CLOCK_ALARM_INTERRUPT) {
+        Semaphore_post(Semaphore_handle(&RTC.alarmSem));
+        if ((fxn = RTC.alarmFxn) != NULL) {
+            fxn();
+        }
+    }
+
+    if (status & (RTC_C_TIME_EVENT_INTERRUPT |
+        RTC_C_CLOCK_READ_READY_INTERRUPT)) {
+        if ((fxn = RTC.periodicFxn) != NULL) {
+            fxn();
+        }
+    }
+}
+
+/*
+ *  ======== init ========
+ *  Everything the calendar calls need, without touching the clocks
+ */
+void RTCClass::init(void)
+{
+    Semaphore_Params params;
+
+    if (begun) {
+        return;
+    }
+
+    Semaphore_Params_init(&params);
+    params.mode = Semaphore_Mode_BINARY;
+    Semaphore_construct(&alarmSem, 0, &params);
+
+    rtcAttach(hwiFxn);
+    begun = true;
+}
+
+/*
+ *  ======== begin ========
+ *  Start LFXT and run RTC_C from it. The calendar keeps its contents,
+ *  so a warm reset doesn't lose the time.
+ */
+bool RTCClass::begin(void)
+{
+    uint32_t waited;
+
+    init();
+
+    for (waited = 0; waited < RTC_LFXT_TIMEOUT_MS; waited++) {
+        /* each try clears the fault flags a few times and reports */
+        if (MAP_CS_startLFXTWithTimeout(CS_LFXT_DRIVE3, 1000)) {
+            break;
+        }
+        delay(1);
+    }
+
+    onCrystal = (waited < RTC_LFXT_TIMEOUT_MS);
+    if (onCrystal) {
+        MAP_CS_initClockSignal(CS_BCLK, CS_LFXTCLK_SELECT, CS_CLOCK_DIVIDER_1);
+    }
+
+    return (onCrystal);
+}
+
+/*
+ *  ======== setTime ========
+ *  Sets the calendar and fills in time->dayOfWeek. Holding RTC_C for
+ *  the update also holds the idle policy's prescalers, briefly.
+ */
+bool RTCClass::setTime(RTCTime *time)
+{
+    RTC_C_Calendar cal;
+
+    if (time->year > 4095 ||
+        time->month < 1 || time->month > 12 ||
+        time->day < 1 || time->day > 31 ||
+        time->hour > 23 || time->minute > 59 || time->second > 59) {
+        return (false);
+    }
+
+    init();
+
+    /* 1970-01-01 was a Thursday */
+    time->dayOfWeek =
+        (daysFromDate(time->year, time->month, time->day) % 7 + 11) % 7;
+
+    cal.seconds = time->second;
+    cal.minutes = time->minute;
+    cal.hours = time->hour;
+    cal.dayOfWeek = time->dayOfWeek;
+    cal.dayOfmonth = time->day;
+    cal.month = time->month;
+    cal.year = time->year;
+
+    MAP_RTC_C_initCalendar(&cal, RTC_C_FORMAT_BINARY);
+    MAP_RTC_C_startClock();
+
+    return (true);
+}
+
+/*
+ *  ======== getTime ========
+ *  The calendar registers are read while RDY is set; read until two
+ *  reads agree in case a second ticks in between.
+ */
+void RTCClass::getTime(RTCTime *time)
+{
+    RTC_C_Calendar cal, again;
+
+    again = MAP_RTC_C_getCalendarTime();
+    do {
+        cal = again;
+        again = MAP_RTC_C_getCalendarTime();
+    } while (cal.seconds != again.seconds || cal.minutes != again.minutes ||
+        cal.hours != again.hours || cal.dayOfmonth != again.dayOfmonth ||
+        cal.month != again.month || cal.year != again.year);
+
+    time->second = cal.seconds;
+    time->minute = cal.minutes;
+    time->hour = cal.hours;
+    time->dayOfWeek = cal.dayOfWeek;
+    time->day = cal.dayOfmonth;
+    time->month = cal.month;
+    time->year = cal.year;
+}
+
+/*
+ *  ======== setEpoch ========
+ *  Unix time in seconds
+ */
+bool RTCClass::setEpoch(uint32_t seconds)
+{
+    RTCTime time;
+    uint32_t days = seconds / 86400;
+    uint32_t rest = seconds % 86400;
+
+    dateFromDays(days, &time);
+    time.hour = rest / 3600;
+    time.minute = rest / 60 % 60;
+    time.second = rest % 60;
+
+    return (setTime(&time));
+}
+
+/*
+ *  ======== getEpoch ========
+ */
+uint32_t RTCClass::getEpoch(void)
+{
+    RTCTime time;
+
+    getTime(&time);
+    if (time.year < 1970) {
+        return (0);     /* calendar never set */
+    }
+
+    return ((uint32_t)daysFromDate(time.year, time.month, time.day) * 86400 +
+        time.hour * 3600 + time.minute * 60 + time.second);
+}
+
+/*
+ *  ======== setAlarm ========
+ *  Fires when all fields that aren't RTC_ANY match, at second 0 of
+ *  the minute. fxn runs in Hwi context and may be NULL when the sketch
+ *  uses waitAlarm().
+ */
+bool RTCClass::setAlarm(int hour, int minute, void (*fxn)(void),
+    int dayOfWeek, int day)
+{
+    if (hour > 23 || minute > 59 || dayOfWeek > 6 || day > 31 ||
+        day == 0 || (hour < 0 && minute < 0 && dayOfWeek < 0 && day < 0)) {
+        return (false);
+    }
+
+    init();
+    clearAlarm();
+
+    alarmFxn = fxn;
+    MAP_RTC_C_setCalendarAlarm(
+        minute < 0 ? RTC_C_ALARMCONDITION_OFF : minute,
+        hour < 0 ? RTC_C_ALARMCONDITION_OFF : hour,
+        dayOfWeek < 0 ? RTC_C_ALARMCONDITION_OFF : dayOfWeek,
+        day < 0 ? RTC_C_ALARMCONDITION_OFF : day);
+
+    Semaphore_pend(Semaphore_handle(&alarmSem), BIOS_NO_WAIT);
+    MAP_RTC_C_clearInterruptFlag(RTC_C_CLOCK_ALARM_INTERRUPT);
+    MAP_RTC_C_enableInterrupt(RTC_C_CLOCK_ALARM_INTERRUPT);
+
+    return (true);
+}
+
+/*
+ *  ======== clearAlarm ========
+ */
+void RTCClass::clearAlarm(void)
+{
+    MAP_RTC_C_disableInterrupt(RTC_C_CLOCK_ALARM_INTERRUPT);
+    MAP_RTC_C_setCalendarAlarm(RTC_C_ALARMCONDITION_OFF,
+        RTC_C_ALARMCONDITION_OFF, RTC_C_ALARMCONDITION_OFF,
+        RTC_C_ALARMCONDITION_OFF);
+    alarmFxn = NULL;
+}
+
+/*
+ *  ======== waitAlarm ========
+ *  Sleep until the alarm fires. Returns false on timeout or if no
+ *  alarm has been set.
+ */
+bool RTCClass::waitAlarm(uint32_t timeoutMs)
+{
+    uint32_t start;
+
+    if (!begun || !(RTC_C->CTL0 & RTC_C_CTL0_AIE)) {
+        return (false);
+    }
+
+    if (timeoutMs == 0xffffffff) {
+        return (Semaphore_pend(Semaphore_handle(&alarmSem),
+            BIOS_WAIT_FOREVER));
+    }
+
+    /* ticks are a little shorter than 1ms, so top up until millis() agrees */
+    start = millis();
+    do {
+        uint32_t left = timeoutMs - (millis() - start);
+
+        if (Semaphore_pend(Semaphore_handle(&alarmSem),
+            left * 1000 / Clock_tickPeriod + 1)) {
+            return (true);
+        }
+    } while (millis() - start < timeoutMs);
+
+    return (false);
+}
+
+/*
+ *  ======== attachPeriodic ========
+ *  Call fxn every second, minute, hour, noon or midnight, in Hwi
+ *  context. Replaces an earlier periodic callback.
+ */
+bool RTCClass::attachPeriodic(uint8_t every, void (*fxn)(void))
+{
+    static const uint16_t events[] = {
+        RTC_C_CALENDAREVENT_MINUTECHANGE,
+        RTC_C_CALENDAREVENT_HOURCHANGE,
+        RTC_C_CALENDAREVENT_NOON,
+        RTC_C_CALENDAREVENT_MIDNIGHT
+    };
+
+    if (every > RTC_EVERY_MIDNIGHT || fxn == NULL) {
+        return (false);
+    }
+
+    init();
+    detachPeriodic();
+
+    periodicFxn = fxn;
+    if (every == RTC_EVERY_SECOND) {
+        MAP_RTC_C_clearInterruptFlag(RTC_C_CLOCK_READ_READY_INTERRUPT);
+        MAP_RTC_C_enableInterrupt(RTC_C_CLOCK_READ_READY_INTERRUPT);
+    }
+    else {
+        MAP_RTC_C_setCalendarEvent(events[every - 1]);
+        MAP_RTC_C_clearInterruptFlag(RTC_C_TIME_EVENT_INTERRUPT);
+        MAP_RTC_C_enableInterrupt(RTC_C_TIME_EVENT_INTERRUPT);
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== detachPeriodic ========
+ */
+void RTCClass::detachPeriodic(void)
+{
+    MAP_RTC_C_disableInterrupt(RTC_C_TIME_EVENT_INTERRUPT |
+        RTC_C_CLOCK_READ_READY_INTERRUPT);
+    periodicFxn = NULL;
+}
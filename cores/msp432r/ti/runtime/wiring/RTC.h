@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== RTC.h ========
+ *  Calendar, alarm and periodic events of the RTC_C peripheral:
+ *
+ *      RTC.begin();
+ *      RTC.setTime(&now);
+ *      RTC.setAlarm(7, 30, wakeUp);
+ *
+ *  begin() starts the 32768Hz crystal and moves BCLK (RTC_C) onto it;
+ *  ACLK follows on its own, which makes the Clock tick crystal accurate
+ *  too. Without a working crystal RTC_C keeps running from REFO.
+ *
+ *  RTC_C stays clocked in the idle policy's deep sleep (LPM3), so alarms
+ *  and periodic events wake the board from any idle state. Alarms have
+ *  minute resolution; callbacks run in Hwi context.
+ */
+
+#ifndef RTC_h
+#define RTC_h
+
+#include <stdint.h>
+
+#include <ti/sysbios/knl/Semaphore.h>
+
+/* wildcard for setAlarm() fields */
+#define RTC_ANY             (-1)
+
+/* attachPeriodic() intervals */
+#define RTC_EVERY_SECOND    0
+#define RTC_EVERY_MINUTE    1
+#define RTC_EVERY_HOUR      2
+#define RTC_EVERY_NOON      3
+#define RTC_EVERY_MIDNIGHT  4
+
+typedef struct RTCTime {
+    uint16_t year;              /* 0 - 4095 */
+    uint8_t month;              /* 1 - 12 */
+    uint8_t day;                /* 1 - 31 */
+    uint8_t hour;               /* 0 - 23 */
+    uint8_t minute;             /* 0 - 59 */
+    uint8_t second;             /* 0 - 59 */
+    uint8_t dayOfWeek;          /* 0 - 6, Sunday is 0; set by setTime() */
+} RTCTime;
+
+class RTCClass
+{
+    public:
+        RTCClass(void);
+
+        bool begin(void);       /* false if running from REFO */
+
+        bool setTime(RTCTime *time);
+        void getTime(RTCTime *time);
+        bool setEpoch(uint32_t seconds);
+        uint32_t getEpoch(void);
+
+        bool setAlarm(int hour, int minute, void (*fxn)(void) = NULL,
+            int dayOfWeek = RTC_ANY, int day = RTC_ANY);
+        void clearAlarm(void);
+        bool waitAlarm(uint32_t timeoutMs = 0xffffffff);
+
+        bool attachPeriodic(uint8_t every, void (*fxn)(void));
+        void detachPeriodic(void);
+
+        bool crystal(void) { return (onCrystal); }
+
+    private:
+        static void hwiFxn(void);
+
+        void init(void);
+
+        bool begun;
+        bool onCrystal;
+        Semaphore_Struct alarmSem;
+        void (*volatile alarmFxn)(void);
+        void (*volatile periodicFxn)(void);
+};
+
+extern RTCClass RTC;
+
+#endif
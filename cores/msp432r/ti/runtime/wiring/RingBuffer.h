@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== RingBuffer.h ========
+ *  Lock-free single-producer/single-consumer byte ring.
+ *
+ *  head is only written by the producer and tail only by the consumer,
+ *  so one side may run in a Hwi while the other runs in a task without
+ *  disabling interrupts. Both indices run freely and are masked on
+ *  access, so all size() bytes are usable. A 32-bit aligned store is
+ *  atomic on Cortex-M; the barrier keeps the compiler from moving
+ *  buffer accesses across the index store that publishes them.
+ *
+ *  More than one producer (or consumer) must serialize among themselves.
+ */
+
+#ifndef RingBuffer_h
+#define RingBuffer_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define RINGBUFFER_BARRIER() __asm volatile ("" ::: "memory")
+
+class RingBufferBase
+{
+    public:
+        /* size must be a power of 2 */
+        void init(uint8_t *buf, size_t size)
+        {
+            buffer = buf;
+            mask = size - 1;
+            head = 0;
+            tail = 0;
+        }
+
+        /* the storage moved, contents and all, e.g. with its owner */
+        void rebase(uint8_t *buf) { buffer = buf; }
+
+        size_t size(void) const { return (mask + 1); }
+        size_t available(void) const { return (head - tail); }
+        size_t space(void) const { return (size() - available()); }
+        bool isEmpty(void) const { return (head == tail); }
+        bool isFull(void) const { return (available() == size()); }
+
+        /* consumer side: discard everything queued */
+        void clear(void) { tail = head; }
+
+        /* empty and rewind to the start; only when neither side is active */
+        void reset(void) { head = 0; tail = 0; }
+
+        /* producer side */
+        bool push(uint8_t c)
+        {
+            if (isFull()) {
+                return (false);
+            }
+            buffer[head & mask] = c;
+            RINGBUFFER_BARRIER();
+            head = head + 1;
+            return (true);
+        }
+
+        size_t push(const uint8_t *data, size_t len)
+        {
+            size_t span;
+            uint8_t *dst;
+
+            if (len > space()) {
+                len = space();
+            }
+            dst = writeSpan(&span);
+            if (span > len) {
+                span = len;
+            }
+            memcpy(dst, data, span);
+            memcpy(buffer, data + span, len - span);
+            commit(len);
+            return (len);
+        }
+
+        /* contiguous free space at head; fill it then commit() */
+        uint8_t *writeSpan(size_t *len)
+        {
+            size_t index = head & mask;
+            size_t room = space();
+
+            *len = (room < size() - index) ? room : size() - index;
+            return (&buffer[index]);
+        }
+
+        void commit(size_t len)
+        {
+            RINGBUFFER_BARRIER();
+            head = head + len;
+        }
+
+        /* consumer side */
+        int peek(void) const
+        {
+            if (isEmpty()) {
+                return (-1);
+            }
+            return (buffer[tail & mask]);
+        }
+
+        int pop(void)
+        {
+            int c;
+
+            if (isEmpty()) {
+                return (-1);
+            }
+            c = buffer[tail & mask];
+            RINGBUFFER_BARRIER();
+            tail = tail + 1;
+            return (c);
+        }
+
+        size_t pop(uint8_t *data, size_t len)
+        {
+            const uint8_t *src;
+            size_t span;
+
+            if (len > available()) {
+                len = available();
+            }
+            src = readSpan(&span);
+            if (span > len) {
+                span = len;
+            }
+            memcpy(data, src, span);
+            memcpy(data + span, buffer, len - span);
+            consume(len);
+            return (len);
+        }
+
+        /* contiguous queued data at tail; use it then consume() */
+        const uint8_t *readSpan(size_t *len) const
+        {
+            size_t index = tail & mask;
+            size_t used = available();
+
+            *len = (used < size() - index) ? used : size() - index;
+            return (&buffer[index]);
+        }
+
+        void consume(size_t len)
+        {
+            RINGBUFFER_BARRIER();
+            tail = tail + len;
+        }
+
+    protected:
+        uint8_t *buffer;
+        size_t mask;
+        volatile size_t head;   /* written only by the producer */
+        volatile size_t tail;   /* written only by the consumer */
+};
+
+/*
+ *  ======== RingBuffer ========
+ *  RingBufferBase with N bytes of embedded storage
+ */
+template <size_t N>
+class RingBuffer : public RingBufferBase
+{
+    typedef char sizeMustBePowerOf2[((N >= 2) && ((N & (N - 1)) == 0)) ? 1 : -1];
+
+    public:
+        RingBuffer(void) { init(storage, N); }
+
+        RingBuffer(const RingBuffer &other)
+        {
+            *this = other;
+        }
+
+        RingBuffer &operator=(const RingBuffer &other)
+        {
+            memcpy(storage, other.storage, N);
+            buffer = storage;
+            mask = N - 1;
+            head = other.head;
+            tail = other.tail;
+            return (*this);
+        }
+
+    private:
+        uint8_t storage[N];
+};
+
+#endif
@@ -30,17 +30,33 @@
  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <ti/sysbios/BIOS.h>
 #include <ti/sysbios/family/arm/m3/Hwi.h>
 
+#include <ti/drivers/Power.h>
+#include <ti/drivers/power/PowerMSP432.h>
+#include <ti/drivers/spi/SPIMSP432DMA.h>
+
+#include <driverlib/eusci.h>
+#include <driverlib/spi.h>
+
 #include "wiring_private.h"
 #include "SPI.h"
 
 extern "C" {
 extern void setSpiXferMode(SPI_Handle handle, SPI_TransferMode xferMode);
+extern const SPI_Config SPI_config[];
+extern void SPIMSP432DMA_transferCancel(SPI_Handle handle);
 }
 
 void spiTransferCallback(SPI_Handle handle,
                                         SPI_Transaction * transaction);
+
+/* SPIClass instance owning each SPI_config[] entry */
+static SPIClass *spiPorts[SPI_MAX_PORTS];
+/* key of a lockBus() that claimed nothing */
+#define SPI_BUS_UNLOCKED ((IArg)-1)
+
 SPIClass::SPIClass(void)
 {
     init(0);
@@ -56,47 +72,308 @@ SPIClass::SPIClass(unsigned long module)
  */
 void SPIClass::init(unsigned long module)
 {
+    Semaphore_Params semParams;
+
     spiModule = module;
     begun = FALSE;
     dataMode = SPI_MODE0;
     bitOrder = MSBFIRST;
     clockDivider = SPI_CLOCK_DIV4;
+    clockHz = 0;
     numUsingInterrupts = 0;
+    asyncHead = NULL;
+    asyncTail = NULL;
+    slaveMode = false;
+
+    Semaphore_Params_init(&semParams);
+    semParams.mode = Semaphore_Mode_BINARY;
+    Semaphore_construct(&transferDone, 0, &semParams);
 }
 
 /*
- * Public Methods
+ *  ======== configureHw ========
+ *  Program clock phase/polarity and bit order straight into the EUSCI_B
+ *  module. The registers are only touched when they differ from what
+ *  is asked for, so this is cheap to call before every transaction.
  */
-void SPIClass::begin(uint8_t ssPin)
+void SPIClass::configureHw(uint8_t mode, uint8_t order)
 {
-    /* return if SPI already started */
-    if (begun == TRUE) {
-        return;
+    EUSCI_B_Type *regs = EUSCI_B_CMSIS(spiBase);
+    uint16_t mask = EUSCI_B_CTLW0_CKPH | EUSCI_B_CTLW0_CKPL | EUSCI_B_CTLW0_MSB;
+    uint16_t bits = 0;
+
+    /* SPI_FrameFormat: bit 0 is phase, bit 1 is polarity */
+    if (mode & 1) {
+        bits |= EUSCI_B_CTLW0_CKPH;
+    }
+    if (mode & 2) {
+        bits |= EUSCI_B_CTLW0_CKPL;
+    }
+    if (order == MSBFIRST) {
+        bits |= EUSCI_B_CTLW0_MSB;
+    }
+
+    if ((regs->CTLW0 & mask) != bits) {
+        regs->CTLW0 |= EUSCI_B_CTLW0_SWRST;
+        regs->CTLW0 = (regs->CTLW0 & ~mask) | bits;
+        regs->CTLW0 &= ~EUSCI_B_CTLW0_SWRST;
+    }
+}
+
+/*
+ *  ======== clockFreq ========
+ *  Frequency of the clock feeding the EUSCI_B bit clock generator at
+ *  the given (by default the current) performance level.
+ */
+uint32_t SPIClass::clockFreq(unsigned int perfLevel)
+{
+    SPIMSP432DMA_HWAttrsV1 const *hwAttrs =
+        (SPIMSP432DMA_HWAttrsV1 const *)spi->hwAttrs;
+    PowerMSP432_Freqs powerFreqs;
+
+    PowerMSP432_getFreqs(perfLevel, &powerFreqs);
+
+    if (hwAttrs->clockSource == EUSCI_B_SPI_CLOCKSOURCE_ACLK) {
+        return (powerFreqs.ACLK);
+    }
+    return (powerFreqs.SMCLK);
+}
+
+uint32_t SPIClass::clockFreq(void)
+{
+    return (clockFreq(Power_getPerformanceLevel()));
+}
+
+/*
+ *  ======== configureClock ========
+ *  Reprogram the EUSCI_B bit clock prescaler in place. The driver's
+ *  copy of the bit rate is updated too so a performance level change
+ *  re-initializes the module at (about) the same rate.
+ */
+void SPIClass::configureClock(uint16_t brw, uint32_t clk)
+{
+    SPIMSP432DMA_Object *object = (SPIMSP432DMA_Object *)spi->object;
+    EUSCI_B_Type *regs = EUSCI_B_CMSIS(spiBase);
+
+    if (regs->BRW != brw) {
+        regs->CTLW0 |= EUSCI_B_CTLW0_SWRST;
+        regs->BRW = brw;
+        regs->CTLW0 &= ~EUSCI_B_CTLW0_SWRST;
+    }
+
+    object->bitRate = clk / brw;
+    params.bitRate = object->bitRate;
+}
+
+/*
+ *  ======== spiPrescaler ========
+ *  Smallest prescaler that does not exceed the requested bit rate.
+ */
+static uint16_t spiPrescaler(uint32_t clk, uint32_t hz)
+{
+    uint32_t brw;
+
+    if (hz == 0) {
+        return (0xffff);
     }
 
+    brw = (clk + hz - 1) / hz;
+    if (brw < 1) {
+        brw = 1;
+    }
+    else if (brw > 0xffff) {
+        brw = 0xffff;
+    }
+
+    return ((uint16_t)brw);
+}
+
+/*
+ *  ======== spiPerfChangeNotifyFxn ========
+ *  Registered after the driver's own notify function, so it runs once
+ *  the driver has re-initialized the module at the new performance
+ *  level, and re-derives the prescaler for the requested setClock()
+ *  rate from the new clock.
+ */
+static int spiPerfChangeNotifyFxn(unsigned int eventType, uintptr_t eventArg,
+    uintptr_t clientArg)
+{
+    ((SPIClass *)clientArg)->perfLevelChanged((unsigned int)eventArg);
+
+    return (Power_NOTIFYDONE);
+}
+
+void SPIClass::perfLevelChanged(unsigned int perfLevel)
+{
+    uint32_t clk = clockFreq(perfLevel);
+
+    if (clockHz != 0) {
+        configureClock(spiPrescaler(clk, clockHz), clk);
+    }
+}
+
+/*
+ * Public Methods
+ */
+/*
+ *  ======== openDriver ========
+ *  Open this port's SPI_config[] entry in callback mode as master or
+ *  slave and cache what the fast paths need from the driver.
+ */
+bool SPIClass::openDriver(SPI_Mode mode)
+{
     SPI_init();
 
     SPI_Params_init(&params);
 
+    params.mode = mode;
     params.bitRate = SPI_CLOCK_MAX / clockDivider;
     params.frameFormat = (SPI_FrameFormat) dataMode;
     params.transferMode = SPI_MODE_CALLBACK;
     params.transferCallbackFxn = spiTransferCallback;
 
+    if (spiModule >= SPI_MAX_PORTS) {
+        return (false);
+    }
+
+    /* route the shared driver callback to this instance */
+    spiPorts[spiModule] = this;
+
     spi = SPI_open(spiModule, &params);
 
     if (spi != NULL) {
+        SPIMSP432DMA_HWAttrsV1 const *hwAttrs =
+            (SPIMSP432DMA_HWAttrsV1 const *)spi->hwAttrs;
         SpiInfo spiInfo;
     /* 6/18/2015 no support for pin profiles, just save for now */
         getSpiInfo(spi, &spiInfo);
         minDmaTransferSize = spiInfo.minDmaTransferSize;
         spiTransferModePtr = (SPI_TransferMode *)(spiInfo.transferModePtr);
+        spiBase = hwAttrs->baseAddr;
+        fillValue = hwAttrs->defaultTxBufValue;
+
+        /*
+         * The driver programs its channels whenever it transfers; hold
+         * them so no other core user or dmaAllocate() takes them. One
+         * already taken (a UART receiving by DMA) stays with its owner.
+         */
+        dmaClaimed = 0;
+        if (dmaAttach(hwAttrs->txDMAChannelIndex & 0x0f, NULL, 0, ~0)) {
+            dmaClaimed |= 1 << (hwAttrs->txDMAChannelIndex & 0x0f);
+        }
+        if (dmaAttach(hwAttrs->rxDMAChannelIndex & 0x0f, NULL, 0, ~0)) {
+            dmaClaimed |= 1 << (hwAttrs->rxDMAChannelIndex & 0x0f);
+        }
+
+        Power_registerNotify(&perfChangeNotify,
+            PowerMSP432_DONE_CHANGE_PERF_LEVEL, spiPerfChangeNotifyFxn,
+            (uintptr_t)this);
+
+        if (clockHz != 0) {
+            uint32_t clk = clockFreq();
+
+            configureClock(spiPrescaler(clk, clockHz), clk);
+        }
+        return (true);
+    }
+
+    return (false);
+}
+
+void SPIClass::begin(uint8_t ssPin)
+{
+    /* return if SPI already started */
+    if (begun == TRUE) {
+        return;
+    }
+
+    if (openDriver(SPI_MASTER)) {
         slaveSelect = ssPin;
-        GateMutex_construct(&gate, NULL);
         begun = TRUE;
     }
 }
 
+/*
+ *  ======== beginSlave ========
+ *  Open the port as an SPI slave clocked by the host. rxBuf and txBuf
+ *  (either may be NULL, not both) hold two frames of frameSize bytes
+ *  each. While the host clocks one frame through DMA, the other
+ *  belongs to callback: it is called from Hwi context with the frame
+ *  just completed, right after the driver has been armed with the
+ *  next one, and may consume its rx half and refill its tx half until
+ *  the following frame completes.
+ */
+bool SPIClass::beginSlave(uint8_t mode, uint8_t *rxBuf, uint8_t *txBuf,
+    size_t frameSize, SPISlaveCallback callback)
+{
+    if (begun == TRUE || frameSize == 0 || (rxBuf == NULL && txBuf == NULL)) {
+        return (false);
+    }
+
+    dataMode = mode;
+
+    if (!openDriver(SPI_SLAVE)) {
+        return (false);
+    }
+
+    slaveRx = rxBuf;
+    slaveTx = txBuf;
+    slaveFrameSize = frameSize;
+    slaveCallback = callback;
+    slaveFrames = 0;
+    slaveStopping = false;
+    slaveMode = true;
+    begun = TRUE;
+
+    configureHw(dataMode, bitOrder);
+    armSlave(0);
+
+    return (true);
+}
+
+/*
+ *  ======== armSlave ========
+ *  Hand frame half of the slave buffers to the driver.
+ */
+void SPIClass::armSlave(uint8_t half)
+{
+    SPI_Transaction *t = &slaveTransaction[half];
+
+    t->txBuf = (slaveTx != NULL) ? slaveTx + half * slaveFrameSize : NULL;
+    t->rxBuf = (slaveRx != NULL) ? slaveRx + half * slaveFrameSize : NULL;
+    t->count = slaveFrameSize;
+    t->arg = NULL;
+
+    SPI_transfer(spi, t);
+}
+
+/*
+ *  ======== slaveComplete ========
+ *  Hwi context. Re-arm the driver with the other frame first, so the
+ *  host only sees the gap of this ISR, then pass the frame on.
+ */
+void SPIClass::slaveComplete(SPI_Transaction *t)
+{
+    uint8_t half = (t == &slaveTransaction[1]) ? 1 : 0;
+
+    if (slaveStopping) {
+        return;
+    }
+
+    armSlave(half ^ 1);
+
+    slaveFrames++;
+
+    if (slaveCallback != NULL) {
+        slaveCallback((uint8_t *)t->rxBuf, (uint8_t *)t->txBuf, slaveFrameSize);
+    }
+}
+
+unsigned long SPIClass::slaveFrameCount(void)
+{
+    return (slaveFrames);
+}
+
 void SPIClass::begin()
 {
     /* default CS is under user control */
@@ -104,9 +381,28 @@ void SPIClass::begin()
 }
 
 void SPIClass::end(uint8_t ssPin) {
+    if (slaveMode) {
+        /* the armed frame only completes when the host clocks it */
+        slaveStopping = true;
+        SPIMSP432DMA_transferCancel(spi);
+        slaveMode = false;
+    }
+
+    /* let queued transfers drain */
+    while (asyncHead != NULL) {
+        ;
+    }
+
     begun = FALSE;
     numUsingInterrupts = 0;
+    Power_unregisterNotify(&perfChangeNotify);
     SPI_close(spi);
+
+    for (uint32_t ch = 0; dmaClaimed != 0; ch++, dmaClaimed >>= 1) {
+        if (dmaClaimed & 1) {
+            dmaDetach(ch);
+        }
+    }
 }
 
 void SPIClass::end()
@@ -126,99 +422,236 @@ void SPIClass::setBitOrder(uint8_t bitOrder)
     setBitOrder(0, bitOrder);
 }
 
+/*
+ *  ======== setDataMode ========
+ *  Applied to the module by the next transfer, see configureHw().
+ */
 void SPIClass::setDataMode(uint8_t mode)
 {
     dataMode = mode;
-
-    if (begun == TRUE) {
-        SPI_close(spi);
-        params.frameFormat = (SPI_FrameFormat) dataMode;
-        spi = SPI_open(spiModule, &params);
-    }
+    params.frameFormat = (SPI_FrameFormat) dataMode;
 }
 
+/*
+ *  ======== setClockDivider ========
+ *  Legacy interface, divides the fixed SPI_CLOCK_MAX; see setClock().
+ */
 void SPIClass::setClockDivider(uint8_t divider)
 {
     clockDivider = divider;
+    setClock(SPI_CLOCK_MAX / clockDivider);
+}
+
+/*
+ *  ======== setClock ========
+ *  Run the bus at the fastest rate not above hz that the module clock
+ *  (SMCLK for the board's ports) can be divided down to. The divider
+ *  is recomputed whenever the performance level changes.
+ */
+void SPIClass::setClock(uint32_t hz)
+{
+    uint32_t clk;
+
+    if (hz == 0) {
+        return;
+    }
+
+    clockHz = hz;
 
     if (begun == TRUE) {
-        SPI_close(spi);
-        params.bitRate = SPI_CLOCK_MAX / clockDivider;
-        spi = SPI_open(spiModule, &params);
+        while (asyncHead != NULL) {
+            ;
+        }
+        clk = clockFreq();
+        configureClock(spiPrescaler(clk, clockHz), clk);
     }
 }
 
-uint8_t SPIClass::reverseBits(uint8_t rxtxData)
+/*
+ *  ======== getClock ========
+ *  The bit rate actually generated, or the requested one if the port
+ *  is not open.
+ */
+uint32_t SPIClass::getClock(void)
 {
-#if (defined(xdc_target__isaCompatible_v7M) || defined(xdc_target__isaCompatible_v7A))  \
-     &&  defined(__TI_COMPILER_VERSION__)
-    rxtxData = __rbit(rxtxData);
-        rxtxData = __rev(rxtxData);
-#elif (defined(xdc_target__isaCompatible_v7M) || defined(xdc_target__isaCompatible_v7A))  \
-     && defined(__GNUC__)
-        /* reverse order of 32 bits */
-        asm("rbit %0, %1" : "=r" (rxtxData) : "r" (rxtxData));
-        /* reverse order of bytes to get original bits into lowest byte */
-        asm("rev %0, %1" : "=r" (rxtxData) : "r" (rxtxData));
-#else
-    static  const uint8_t reverse_data[] =
-        { 0x0, 0x8, 0x4, 0xC,
-          0x2, 0xA, 0x6, 0xE,
-          0x1, 0x9, 0x5, 0xD,
-          0x3, 0xB, 0x7, 0xF
-        };
-
-    uint8_t b = 0;
+    if (begun == FALSE) {
+        return (clockHz);
+    }
 
-    b  = reverse_data[x & 0xF] << 4;
-    b |= reverse_data[(x & 0xF0) >> 4];
-    rxtxData = b;
-#endif
-    return (rxtxData);
+    return (clockFreq() / EUSCI_B_CMSIS(spiBase)->BRW);
 }
 
-uint8_t *SPIClass::transfer(uint8_t *buffer, size_t size)
+/*
+ *  ======== beginTransaction ========
+ *  Take the bus for the calling task and switch it to settings. Only
+ *  the EUSCI_B prescaler, phase/polarity and bit order are touched,
+ *  the driver stays open.
+ */
+void SPIClass::beginTransaction(const SPISettings &settings)
 {
-    uint32_t taskKey, hwiKey;
-    uint8_t i;
+    uint32_t clk;
 
-    if (spi == NULL) {
-        return (0);
+    if (begun == FALSE) {
+        return;
     }
 
-    /* protect single 'transaction' content from re-rentrancy */
-    taskKey = Task_disable();
+    transactionKey = lockBus();
 
-    hwiKey = Hwi_disable();
+    /* transfers queued by the previous owner may still be running */
+    while (asyncHead != NULL) {
+        ;
+    }
 
-    /* disable all interrupts registered with SPI.usingInterrupt() */
-    for (i = 0; i < numUsingInterrupts; i++) {
-        disablePinInterrupt(usingInterruptPins[i]);
+    clk = clockFreq();
+    if (settings.brwClock != clk) {
+        settings.brw = spiPrescaler(clk, settings.clock);
+        settings.brwClock = clk;
     }
+    clockHz = settings.clock;
+    configureClock(settings.brw, clk);
 
-    Hwi_restore(hwiKey);
+    dataMode = settings.dataMode;
+    params.frameFormat = (SPI_FrameFormat) dataMode;
+    bitOrder = settings.bitOrder;
+}
 
-    if (bitOrder == LSBFIRST) {
-        for (i = 0; i < size; i++) {
-            buffer[i] = reverseBits(buffer[i]);
+void SPIClass::endTransaction(void)
+{
+    if (begun == FALSE) {
+        return;
+    }
+
+    unlockBus(transactionKey);
+}
+
+/*
+ *  ======== pollTransfer ========
+ *  Exchange count bytes by polling the EUSCI_B flags directly; used
+ *  for transfers too short to be worth the driver and DMA setup.
+ */
+static inline void pollTransfer(EUSCI_B_Type *regs, const uint8_t *tx,
+    uint8_t *rx, size_t count, uint8_t fill)
+{
+    uint8_t in;
+
+    while (count--) {
+        while (!(regs->IFG & EUSCI_B_IFG_TXIFG0)) {
+            ;
         }
+        regs->TXBUF = (tx != NULL) ? *tx++ : fill;
+
+        while (!(regs->IFG & EUSCI_B_IFG_RXIFG0)) {
+            ;
+        }
+        in = regs->RXBUF;
+        if (rx != NULL) {
+            *rx++ = in;
+        }
+    }
+}
+
+/*
+ *  ======== lockBus ========
+ *  Claims the module for the calling task until unlockBus(). The owner
+ *  runs at the priority of the most urgent task waiting for the bus,
+ *  and only those tasks are held off. The owner may claim it again, as
+ *  transfers inside beginTransaction() do. Outside task context there
+ *  is nobody to wait for and nothing is claimed.
+ */
+IArg SPIClass::lockBus(void)
+{
+    if (BIOS_getThreadType() != BIOS_ThreadType_Task) {
+        return (SPI_BUS_UNLOCKED);
+    }
+
+    return (bus.lock());
+}
+
+/*
+ *  ======== unlockBus ========
+ */
+void SPIClass::unlockBus(IArg key)
+{
+    if (key != SPI_BUS_UNLOCKED) {
+        bus.unlock(key);
+    }
+}
+
+/*
+ *  ======== fastTransfer ========
+ *  Polled transfer for count < minDmaTransferSize when no pin
+ *  interrupts have to be masked. Only other users of the bus are held
+ *  off, for exclusive use of the module. Returns false if the
+ *  driver is busy with queued transfers and the caller must take the
+ *  regular path.
+ */
+bool SPIClass::fastTransfer(const uint8_t *txBuf, uint8_t *rxBuf,
+    size_t count, uint8_t ssPin, uint8_t transferMode)
+{
+    IArg busKey;
+
+    if (numUsingInterrupts != 0 || count >= minDmaTransferSize) {
+        return (false);
+    }
+
+    busKey = lockBus();
+
+    if (asyncHead != NULL) {
+        unlockBus(busKey);
+        return (false);
+    }
+
+    if (ssPin != 0) {
+        digitalWriteFast(ssPin, LOW);
     }
 
-    transaction.txBuf = buffer;
-    transaction.rxBuf = buffer;
-    transaction.count = size;
+    configureHw(dataMode, bitOrder);
+    pollTransfer(EUSCI_B_CMSIS(spiBase), txBuf, rxBuf, count, fillValue);
+
+    if (transferMode == SPI_LAST && ssPin != 0) {
+        digitalWriteFast(ssPin, HIGH);
+    }
+
+    unlockBus(busKey);
+
+    return (true);
+}
+
+/*
+ *  ======== transact ========
+ *  Run one driver transaction and wait for it to complete. Short
+ *  transfers are polled by the driver, longer ones use DMA.
+ */
+void SPIClass::transact(const void *txBuf, void *rxBuf, size_t count)
+{
+    traceEvent(TRACE_SPI, spiModule, count);
+
+    configureHw(dataMode, bitOrder);
+
+    transaction.arg = NULL;
+    transaction.txBuf = (void *)txBuf;
+    transaction.rxBuf = rxBuf;
+    transaction.count = count;
     transferComplete = 0;
 
-    if (size < minDmaTransferSize) {
+    if (count < minDmaTransferSize) {
         *spiTransferModePtr = SPI_MODE_BLOCKING;
     }
+    else {
+        /* drop a post from a transfer that was waited for by spinning */
+        Semaphore_reset(Semaphore_handle(&transferDone), 0);
+    }
 
     /* kick off the SPI transaction */
     SPI_transfer(spi, &transaction);
 
-    if (size < minDmaTransferSize) {
+    if (count < minDmaTransferSize) {
         *spiTransferModePtr = SPI_MODE_CALLBACK;
     }
+    else if (BIOS_getThreadType() == BIOS_ThreadType_Task) {
+        /* a task sleeps until the DMA is done, leaving the CPU to others */
+        Semaphore_pend(Semaphore_handle(&transferDone), BIOS_WAIT_FOREVER);
+    }
     else {
         /* wait for transfer to complete (ie for callback to be called) */
         while (transferComplete == 0) {
@@ -226,6 +659,72 @@ uint8_t *SPIClass::transfer(uint8_t *buffer, size_t size)
         }
     }
 
+    traceEvent(TRACE_SPI | TRACE_END, spiModule, count);
+}
+
+/*
+ *  ======== transfer ========
+ *  Full-duplex transfer of count bytes from txBuf into rxBuf. A NULL
+ *  rxBuf discards the received bytes, a NULL txBuf clocks out the
+ *  driver's fill value. txBuf and rxBuf may be the same buffer.
+ */
+void SPIClass::transfer(const void *txBuf, void *rxBuf, size_t count)
+{
+    PROFILE_SCOPE("SPI.transfer");
+
+    transferBurst(0, txBuf, rxBuf, count);
+}
+
+/*
+ *  ======== transferBurst ========
+ *  transfer(txBuf, rxBuf, count) as a single transaction framed by
+ *  ssPin: it is driven LOW before the first byte and HIGH after the
+ *  last one, without other tasks getting onto the bus in between.
+ */
+void SPIClass::transferBurst(uint8_t ssPin, const void *txBuf, void *rxBuf,
+    size_t count)
+{
+    uint32_t hwiKey;
+    IArg busKey;
+    size_t i;
+
+    if (spi == NULL || slaveMode || count == 0
+        || (txBuf == NULL && rxBuf == NULL)) {
+        return;
+    }
+
+    if (fastTransfer((const uint8_t *)txBuf, (uint8_t *)rxBuf, count,
+        ssPin, SPI_LAST)) {
+        return;
+    }
+
+    /* protect single 'transaction' content from re-rentrancy */
+    busKey = lockBus();
+
+    /* queued transfers own the driver until they have drained */
+    while (asyncHead != NULL) {
+        ;
+    }
+
+    hwiKey = Hwi_disable();
+
+    /* disable all interrupts registered with SPI.usingInterrupt() */
+    for (i = 0; i < numUsingInterrupts; i++) {
+        disablePinInterrupt(usingInterruptPins[i]);
+    }
+
+    Hwi_restore(hwiKey);
+
+    if (ssPin != 0) {
+        digitalWriteFast(ssPin, LOW);
+    }
+
+    transact(txBuf, rxBuf, count);
+
+    if (ssPin != 0) {
+        digitalWriteFast(ssPin, HIGH);
+    }
+
     /* now that the transaction is finished, allow other threads to pre-empt */
 
     hwiKey = Hwi_disable();
@@ -237,13 +736,16 @@ uint8_t *SPIClass::transfer(uint8_t *buffer, size_t size)
 
     Hwi_restore(hwiKey);
 
-    if (bitOrder == LSBFIRST) {
-        for (i = 0; i < size; i++) {
-            buffer[i] = reverseBits(buffer[i]);
-        }
+    unlockBus(busKey);
+}
+
+uint8_t *SPIClass::transfer(uint8_t *buffer, size_t size)
+{
+    if (spi == NULL) {
+        return (0);
     }
 
-    Task_restore(taskKey);
+    transfer(buffer, buffer, size);
 
     return (buffer);
 }
@@ -252,18 +754,26 @@ uint8_t SPIClass::transfer(uint8_t ssPin, uint8_t data_out, uint8_t transferMode
 {
     uint8_t data_in;
     uint8_t i;
-    uint32_t taskKey, hwiKey;
+    uint32_t hwiKey;
+    IArg busKey;
 
-    if (spi == NULL) {
+    if (spi == NULL || slaveMode) {
         return (0);
     }
 
-    if (bitOrder == LSBFIRST) {
-        data_out = reverseBits(data_out);
+    PROFILE_SCOPE("SPI.transfer byte");
+
+    if (fastTransfer(&data_out, &data_in, 1, ssPin, transferMode)) {
+        return (data_in);
     }
 
     /* protect single 'transaction' content from re-rentrancy */
-    taskKey = Task_disable();
+    busKey = lockBus();
+
+    /* queued transfers own the driver until they have drained */
+    while (asyncHead != NULL) {
+        ;
+    }
 
     hwiKey = Hwi_disable();
 
@@ -276,9 +786,12 @@ uint8_t SPIClass::transfer(uint8_t ssPin, uint8_t data_out, uint8_t transferMode
 
     /* select SPI peripheral if ssPin was provided */
     if (ssPin != 0) {
-        digitalWrite(ssPin, LOW);
+        digitalWriteFast(ssPin, LOW);
     }
 
+    configureHw(dataMode, bitOrder);
+
+    transaction.arg = NULL;
     transaction.txBuf = &data_out;
     transaction.rxBuf = &data_in;
     transaction.count = 1;
@@ -293,7 +806,7 @@ uint8_t SPIClass::transfer(uint8_t ssPin, uint8_t data_out, uint8_t transferMode
 
     /* deselect SPI peripheral if ssPin was provided */
     if (transferMode == SPI_LAST && ssPin != 0) {
-        digitalWrite(ssPin, HIGH);
+        digitalWriteFast(ssPin, HIGH);
     }
 
     /* now that the transaction is finished, allow other threads to pre-empt */
@@ -307,11 +820,7 @@ uint8_t SPIClass::transfer(uint8_t ssPin, uint8_t data_out, uint8_t transferMode
 
     Hwi_restore(hwiKey);
 
-    Task_restore(taskKey);
-
-    if (bitOrder == LSBFIRST) {
-        data_in = reverseBits(data_in);
-    }
+    unlockBus(busKey);
 
     return ((uint8_t)data_in);
 }
@@ -326,6 +835,108 @@ uint8_t SPIClass::transfer(uint8_t data)
     return (transfer(0, data, SPI_LAST));
 }
 
+/*
+ *  ======== transferAsync ========
+ *  Queue xfer and return immediately. Queued transfers always use DMA,
+ *  run in order, and each is framed by its own ssPin and settings.
+ *  Completion is reported through xfer->done, xfer->callback (from Hwi
+ *  context) and xfer->sem. Pin interrupts registered with
+ *  usingInterrupt() are not masked for queued transfers.
+ */
+bool SPIClass::transferAsync(SPIAsyncTransfer *xfer)
+{
+    uintptr_t key;
+
+    if (spi == NULL || slaveMode || xfer->count == 0
+        || (xfer->txBuf == NULL && xfer->rxBuf == NULL)) {
+        return (false);
+    }
+
+    xfer->done = false;
+    xfer->owner = this;
+    xfer->next = NULL;
+
+    key = Hwi_disable();
+
+    if (asyncTail != NULL) {
+        asyncTail->next = xfer;
+        asyncTail = xfer;
+    }
+    else {
+        asyncHead = xfer;
+        asyncTail = xfer;
+        startAsync(xfer);
+    }
+
+    Hwi_restore(key);
+
+    return (true);
+}
+
+bool SPIClass::asyncBusy(void)
+{
+    return (asyncHead != NULL);
+}
+
+/*
+ *  ======== startAsync ========
+ *  Put xfer on the wire. Called with interrupts disabled.
+ */
+void SPIClass::startAsync(SPIAsyncTransfer *xfer)
+{
+    configureHw(
+        (xfer->dataMode == SPI_DEFAULT_SETTING) ? dataMode : xfer->dataMode,
+        (xfer->bitOrder == SPI_DEFAULT_SETTING) ? bitOrder : xfer->bitOrder);
+
+    if (xfer->ssPin != 0) {
+        digitalWriteFast(xfer->ssPin, LOW);
+    }
+
+    xfer->transaction.txBuf = (void *)xfer->txBuf;
+    xfer->transaction.rxBuf = xfer->rxBuf;
+    xfer->transaction.count = xfer->count;
+    xfer->transaction.arg = xfer;
+
+    SPI_transfer(spi, &xfer->transaction);
+}
+
+/*
+ *  ======== asyncComplete ========
+ *  Hwi context. Retire the transfer at the head of the queue and start
+ *  the next one before notifying the caller.
+ */
+void SPIClass::asyncComplete(SPIAsyncTransfer *xfer)
+{
+    uintptr_t key;
+
+    xfer->status = xfer->transaction.status;
+
+    if (xfer->ssPin != 0 && xfer->transferMode == SPI_LAST) {
+        digitalWriteFast(xfer->ssPin, HIGH);
+    }
+
+    key = Hwi_disable();
+
+    asyncHead = xfer->next;
+    if (asyncHead == NULL) {
+        asyncTail = NULL;
+    }
+    else {
+        startAsync(asyncHead);
+    }
+
+    Hwi_restore(key);
+
+    xfer->done = true;
+
+    if (xfer->callback != NULL) {
+        xfer->callback(xfer);
+    }
+    if (xfer->sem != NULL) {
+        Semaphore_post(xfer->sem);
+    }
+}
+
 void SPIClass::setModule(uint8_t module)
 {
     spiModule = module;
@@ -339,8 +950,30 @@ void SPIClass::usingInterrupt(uint8_t pin)
     }
 }
 
+/*
+ *  ======== transferCallback ========
+ *  Hwi context, driver callback for this port.
+ */
+void SPIClass::transferCallback(SPI_Transaction *transaction)
+{
+    SPIAsyncTransfer *xfer = (SPIAsyncTransfer *)transaction->arg;
+
+    if (slaveMode) {
+        slaveComplete(transaction);
+    }
+    else if (xfer != NULL) {
+        asyncComplete(xfer);
+    }
+    else {
+        transferComplete = 1;
+        Semaphore_post(Semaphore_handle(&transferDone));
+    }
+}
+
 /* C type function */
 void spiTransferCallback(SPI_Handle spi, SPI_Transaction * transaction)
 {
-    SPI.transferComplete = 1;
+    SPIClass *port = spiPorts[(SPI_Config const *)spi - SPI_config];
+
+    port->transferCallback(transaction);
 }
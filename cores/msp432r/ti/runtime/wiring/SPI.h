@@ -36,16 +36,24 @@
 #include <inttypes.h>
 
 #include <ti/drivers/SPI.h>
-#include <ti/sysbios/gates/GateMutex.h>
+#include <ti/drivers/Power.h>
+#include <ti/sysbios/knl/Semaphore.h>
 
+#include "Mutex.h"
+
+/*
+ * Arduino CPOL/CPHA modes. The driver's PHA1 sets UCCKPH, which on the
+ * EUSCI_B means data is captured on the first clock edge, i.e. CPHA 0.
+ */
 #define SPI_MODE0 SPI_POL0_PHA1
 #define SPI_MODE1 SPI_POL0_PHA0
-#define SPI_MODE2 SPI_POL0_PHA1
-#define SPI_MODE3 SPI_POL0_PHA0
+#define SPI_MODE2 SPI_POL1_PHA1
+#define SPI_MODE3 SPI_POL1_PHA0
 
 #define MSBFIRST 1
 #define LSBFIRST 0
 
+/* reference for setClockDivider() only; setClock() uses the live clock */
 #define SPI_CLOCK_MAX 16000000L
 #define SPI_CLOCK_DIV1 1
 #define SPI_CLOCK_DIV2 2
@@ -56,6 +64,76 @@
 
 #define MAX_USING_INTERRUPTS 16
 
+/* number of SPI_config[] instances SPIClass can dispatch to */
+#define SPI_MAX_PORTS 4
+
+/* called from Hwi context for every frame received in slave mode */
+typedef void (*SPISlaveCallback)(uint8_t *rxFrame, uint8_t *txFrame, size_t count);
+
+/*
+ *  Bus settings for one device, see SPIClass::beginTransaction(). The
+ *  EUSCI_B prescaler is cached in the object the first time it is used
+ *  and only recomputed when the module's clock changes.
+ */
+class SPISettings
+{
+    public:
+        SPISettings(void) :
+            clock(4000000), bitOrder(MSBFIRST), dataMode(SPI_MODE0),
+            brw(0), brwClock(0) {}
+        SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) :
+            clock(clock), bitOrder(bitOrder), dataMode(dataMode),
+            brw(0), brwClock(0) {}
+
+    private:
+        uint32_t clock;
+        uint8_t bitOrder;
+        uint8_t dataMode;
+        mutable uint16_t brw;       /* prescaler for brwClock */
+        mutable uint32_t brwClock;  /* module clock brw was computed for */
+
+        friend class SPIClass;
+};
+
+/* SPIAsyncTransfer dataMode/bitOrder value: use the SPIClass setting */
+#define SPI_DEFAULT_SETTING 0xff
+
+class SPIClass;
+struct SPIAsyncTransfer;
+
+/* called from Hwi context when a queued transfer has completed */
+typedef void (*SPIAsyncCallback)(SPIAsyncTransfer *xfer);
+
+/*
+ *  A transfer queued by SPIClass::transferAsync(). The caller owns the
+ *  struct and its buffers and must keep them valid until done is set.
+ */
+struct SPIAsyncTransfer {
+    const void *txBuf;          /* NULL: clock out the fill byte */
+    void *rxBuf;                /* NULL: discard received bytes */
+    size_t count;
+    uint8_t ssPin;              /* driven LOW for the transfer, 0: none */
+    uint8_t transferMode;       /* SPI_LAST releases ssPin when done */
+    uint8_t dataMode;           /* SPI_MODEx or SPI_DEFAULT_SETTING */
+    uint8_t bitOrder;           /* MSBFIRST, LSBFIRST or SPI_DEFAULT_SETTING */
+    SPIAsyncCallback callback;  /* optional */
+    Semaphore_Handle sem;       /* optional, posted when done */
+    void *arg;                  /* for the caller's use */
+
+    /* maintained by SPIClass */
+    volatile bool done;
+    SPI_Status status;
+    SPIClass *owner;
+    SPIAsyncTransfer *next;
+    SPI_Transaction transaction;
+
+    SPIAsyncTransfer(void) :
+        txBuf(NULL), rxBuf(NULL), count(0), ssPin(0), transferMode(0),
+        dataMode(SPI_DEFAULT_SETTING), bitOrder(SPI_DEFAULT_SETTING),
+        callback(NULL), sem(NULL), arg(NULL), done(true),
+        status(SPI_TRANSFER_COMPLETED), owner(NULL), next(NULL) {}
+};
+
 class SPIClass
 {
     private:
@@ -65,6 +143,8 @@ class SPIClass
         uint8_t bitOrder;
         uint8_t dataMode;
         uint8_t clockDivider;
+        uint32_t clockHz;           /* setClock() rate, 0: driver default */
+        Power_NotifyObj perfChangeNotify;
 
         uint8_t usingInterruptPins[MAX_USING_INTERRUPTS];
         uint8_t numUsingInterrupts;
@@ -75,13 +155,44 @@ class SPIClass
 
         SPI_TransferMode *spiTransferModePtr;
         uint32_t minDmaTransferSize;
-
-        GateMutex_Struct gate;
+        uint32_t spiBase;           /* EUSCI_B module base address */
+        uint8_t fillValue;          /* clocked out when there's no txBuf */
+        uint8_t dmaClaimed;         /* uDMA channels held for the driver */
+
+        /* transferAsync() queue, asyncHead is on the wire */
+        SPIAsyncTransfer *volatile asyncHead;
+        SPIAsyncTransfer *asyncTail;
+
+        /* beginSlave() state; slaveTransaction[i] covers frame i */
+        bool slaveMode;
+        volatile bool slaveStopping;
+        uint8_t *slaveRx;
+        uint8_t *slaveTx;
+        size_t slaveFrameSize;
+        SPISlaveCallback slaveCallback;
+        volatile unsigned long slaveFrames;
+        SPI_Transaction slaveTransaction[2];
+
+        Mutex bus;
+        Semaphore_Struct transferDone;  /* posted with transferComplete */
+        IArg transactionKey;
+        IArg lockBus(void);
+        void unlockBus(IArg);
         void init(unsigned long);
-        uint8_t reverseBits(uint8_t);
+        bool openDriver(SPI_Mode);
+        void armSlave(uint8_t);
+        void slaveComplete(SPI_Transaction *);
+        void transact(const void *, void *, size_t);
+        bool fastTransfer(const uint8_t *, uint8_t *, size_t, uint8_t, uint8_t);
+        void configureHw(uint8_t, uint8_t);
+        uint32_t clockFreq(unsigned int);
+        uint32_t clockFreq(void);
+        void configureClock(uint16_t, uint32_t);
+        void startAsync(SPIAsyncTransfer *);
 
     public:
         volatile bool transferComplete;
+        void transferCallback(SPI_Transaction *);
 
         SPIClass(void);
         SPIClass(unsigned long);
@@ -90,16 +201,31 @@ class SPIClass
         void end();
         void end(uint8_t);
 
+        bool beginSlave(uint8_t dataMode, uint8_t *rxBuf, uint8_t *txBuf,
+            size_t frameSize, SPISlaveCallback callback);
+        unsigned long slaveFrameCount(void);
+
         void setBitOrder(uint8_t);
         void setBitOrder(uint8_t, uint8_t);
 
         void setDataMode(uint8_t);
         void setClockDivider(uint8_t);
+        void setClock(uint32_t hz);
+        uint32_t getClock(void);
+        void perfLevelChanged(unsigned int);
+
+        void beginTransaction(const SPISettings &);
+        void endTransaction(void);
 
         uint8_t transfer(uint8_t);
         uint8_t transfer(uint8_t, uint8_t);
         uint8_t transfer(uint8_t, uint8_t, uint8_t);
         uint8_t *transfer(uint8_t *, size_t);
+        void transfer(const void *txBuf, void *rxBuf, size_t count);
+        void transferBurst(uint8_t ssPin, const void *txBuf, void *rxBuf, size_t count);
+        bool transferAsync(SPIAsyncTransfer *xfer);
+        bool asyncBusy(void);
+        void asyncComplete(SPIAsyncTransfer *xfer);
 
         void setModule(uint8_t);
         void usingInterrupt(uint8_t);
@@ -107,5 +233,7 @@ class SPIClass
 
 extern SPIClass SPI;
 extern SPIClass SPI1;
+extern SPIClass SPI2;
+extern SPIClass SPI3;
 
 #endif
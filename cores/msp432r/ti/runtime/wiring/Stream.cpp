@@ -22,36 +22,165 @@
 
 #include "Energia.h"
 #include "Stream.h"
+#include "PString.h"
 
 #define PARSE_TIMEOUT 1000  // default number of milli-seconds to wait
 #define NO_SKIP_CHAR  1  // a magic char not found in a valid ASCII numeric field
+#define STRING_CHUNK  32 // chars readString() reads per String append
+#define NUMBER_MAX    24 // chars of a number parsed from the stream
+
+#define NUMBER_DECIMAL 0 // kinds of number readNumber() reads
+#define NUMBER_FLOAT   1
+#define NUMBER_HEX     2
+
+// value of a hex digit, > 15 for any other char
+static inline unsigned int hexValue(int c)
+{
+    if (c >= '0' && c <= '9') return (c - '0');
+    if (c >= 'a' && c <= 'f') return (c - 'a' + 10);
+    if (c >= 'A' && c <= 'F') return (c - 'A' + 10);
+    return (16);
+}
+
+/*
+ *  ======== StreamMatcher ========
+ */
+StreamMatcher::StreamMatcher(const char *target)
+{
+    build(target, target ? strlen(target) : 0);
+}
+
+StreamMatcher::StreamMatcher(const char *target, size_t length)
+{
+    build(target, length);
+}
+
+StreamMatcher::~StreamMatcher()
+{
+    if (prefix != local) {
+        free(prefix);
+    }
+}
+
+void StreamMatcher::build(const char *target, size_t length)
+{
+    size_t i, k;
+
+    this->target = target;
+    matched = 0;
+    len = 0;
+    prefix = local;
+
+    if (length > 0xffff) {
+        return;    // table entries are 16 bit, the target never matches
+    }
+    if (length > sizeof(local) / sizeof(local[0])) {
+        prefix = (uint16_t *)malloc(length * sizeof(uint16_t));
+        if (prefix == NULL) {
+            prefix = local;
+            return;    // no memory, the target never matches
+        }
+    }
+    if (length == 0) {
+        return;
+    }
+
+    prefix[0] = 0;
+    for (i = 1, k = 0; i < length; i++) {
+        while (k > 0 && target[i] != target[k]) {
+            k = prefix[k - 1];
+        }
+        if (target[i] == target[k]) {
+            k++;
+        }
+        prefix[i] = k;
+    }
+    len = length;
+}
+
+bool StreamMatcher::match(char c)
+{
+    if (len == 0) {
+        return (false);
+    }
+
+    while (matched > 0 && c != target[matched]) {
+        matched = prefix[matched - 1];
+    }
+    if (c == target[matched] && ++matched == len) {
+        matched = prefix[len - 1];    // a following match may overlap this one
+        return (true);
+    }
+
+    return (false);
+}
+
+size_t StreamMatcher::match(const char *buf, size_t length)
+{
+    size_t i;
+
+    for (i = 0; i < length; i++) {
+        if (match(buf[i])) {
+            return (i + 1);
+        }
+    }
+
+    return (0);
+}
+
+// default waitForData(): poll available()
+bool Stream::waitForData(unsigned long timeout)
+{
+    unsigned long start = millis();
+
+    do {
+        if (available() > 0) return (true);
+    }
+    while (millis() - start < timeout);
+
+    return (false);
+}
 
 // private method to read stream with timeout
 int Stream::timedRead()
 {
     int c;
+    unsigned long elapsed;
+
+    c = read();
+    if (c >= 0) return (c);    // don't take the time if it's not needed
+
     _startMillis = millis();
-    do {
+    for (;;) {
         c = read();
         if (c >= 0) return (c);
-    }
-    while (millis() - _startMillis < _timeout);
 
-    return (-1);     // -1 indicates timeout
+        elapsed = millis() - _startMillis;
+        if (elapsed >= _timeout || !waitForData(_timeout - elapsed)) {
+            return (-1);     // -1 indicates timeout
+        }
+    }
 }
 
 // private method to peek stream with timeout
 int Stream::timedPeek()
 {
     int c;
+    unsigned long elapsed;
+
+    c = peek();
+    if (c >= 0) return (c);
+
     _startMillis = millis();
-    do {
+    for (;;) {
         c = peek();
         if (c >= 0) return (c);
-    }
-    while (millis() - _startMillis < _timeout);
 
-    return (-1);     // -1 indicates timeout
+        elapsed = millis() - _startMillis;
+        if (elapsed >= _timeout || !waitForData(_timeout - elapsed)) {
+            return (-1);     // -1 indicates timeout
+        }
+    }
 }
 
 // returns peek of the next digit in the stream or -1 if timeout
@@ -79,7 +208,7 @@ void Stream::setTimeout(unsigned long timeout)  // sets the maximum number of mi
 // find returns true if the target string is found
 bool  Stream::find(char *target)
 {
-    return (findUntil(target, NULL));
+    return (findUntil(target, strlen(target), NULL, 0));
 }
 
 // reads data from the stream until the target string of given length is found
@@ -92,7 +221,14 @@ bool Stream::find(char *target, size_t length)
 // as find but search ends if the terminator string is found
 bool  Stream::findUntil(char *target, char *terminator)
 {
-    return (findUntil(target, strlen(target), terminator, strlen(terminator)));
+    StreamMatcher targetMatcher(target);
+    StreamMatcher termMatcher(terminator);
+
+    if (*target == 0) {
+        return (true);   // return true if target is a null string
+    }
+
+    return (findUntil(targetMatcher, termMatcher));
 }
 
 // reads data from the stream until the target string of the given length is found
@@ -100,34 +236,39 @@ bool  Stream::findUntil(char *target, char *terminator)
 // returns true if target string is found, false if terminated or timed out
 bool Stream::findUntil(char *target, size_t targetLen, char *terminator, size_t termLen)
 {
-    size_t index = 0;  // maximum target string length is 64k bytes!
-    size_t termIndex = 0;
-    int c;
+    StreamMatcher targetMatcher(target, targetLen);   // maximum target string length is 64k bytes!
+    StreamMatcher termMatcher(terminator, termLen);
 
-    if (*target == 0) {
+    if (targetLen == 0) {
         return (true);   // return true if target is a null string
     }
 
-    while ((c = timedRead()) > 0)
-    {
-        if (c != target[index]) {
-            index = 0; // reset index if any char does not match
-        }
+    return (findUntil(targetMatcher, termMatcher));
+}
 
-        if (c == target[index]) {
-            //////Serial.print("found "); Serial.write(c); Serial.print("index now"); Serial.println(index+1);
-            if (++index >= targetLen) { // return true if all chars in the target match
-                return (true);
-            }
-        }
+bool Stream::find(StreamMatcher &target)
+{
+    StreamMatcher none(NULL, 0);
 
-        if(termLen > 0 && c == terminator[termIndex]){
-            if (++termIndex >= termLen) {
-                return (false);       // return false if terminate string found before target string
-            }
+    return (findUntil(target, none));
+}
+
+// the stream has no way to push back chars read past a match, so this
+// reads one char at a time; callers that own a buffer of received data
+// can run StreamMatcher::match() over it a chunk at a time instead
+bool Stream::findUntil(StreamMatcher &target, StreamMatcher &terminator)
+{
+    int c;
+
+    target.reset();
+    terminator.reset();
+
+    while ((c = timedRead()) >= 0) {
+        if (target.match(c)) {
+            return (true);
         }
-        else {
-            termIndex = 0;
+        if (terminator.match(c)) {
+            return (false);       // return false if terminate string found before target string
         }
     }
     return (false);
@@ -146,90 +287,241 @@ long Stream::parseInt()
 // this allows format characters (typically commas) in values to be ignored
 long Stream::parseInt(char skipChar)
 {
-    boolean isNegative = false;
+    char buf[NUMBER_MAX];
     long value = 0;
+
+    parseInt(buf, readNumber(buf, sizeof(buf), skipChar, NUMBER_DECIMAL), value);
+    return (value); // zero returned if timeout
+}
+
+int64_t Stream::parseInt64()
+{
+    char buf[NUMBER_MAX];
+    int64_t value = 0;
+
+    parseInt64(buf, readNumber(buf, sizeof(buf), NO_SKIP_CHAR, NUMBER_DECIMAL), value);
+    return (value);
+}
+
+uint32_t Stream::parseHex()
+{
+    char buf[NUMBER_MAX];
+    uint32_t value = 0;
+
+    parseHex(buf, readNumber(buf, sizeof(buf), NO_SKIP_CHAR, NUMBER_HEX), value);
+    return (value);
+}
+
+// as parseInt but returns a floating point value
+float Stream::parseFloat()
+{
+    return (parseFloat(NO_SKIP_CHAR));
+}
+
+// as above but the given skipChar is ignored
+// this allows format characters (typically commas) in values to be ignored
+float Stream::parseFloat(char skipChar)
+{
+    char buf[NUMBER_MAX];
+    float value = 0;
+
+    parseFloat(buf, readNumber(buf, sizeof(buf), skipChar, NUMBER_FLOAT), value);
+    return (value);
+}
+
+// reads the run of chars that makes up a number of the given kind into
+// buffer, without the skipChars, so the parsers can convert it in one
+// pass; digits past the end of buffer are consumed and dropped
+size_t Stream::readNumber(char *buffer, size_t size, char skipChar, int kind)
+{
+    size_t n = 0;
+    bool isFraction = false;
     int c;
 
-    c = peekNextDigit();
+    if (kind == NUMBER_HEX) {
+        while ((c = timedPeek()) >= 0 && hexValue(c) > 15) {
+            read();  // discard non-hex characters
+        }
+    }
+    else {
+        c = peekNextDigit();
+    }
     // ignore non numeric leading characters
     if (c < 0) {
         return (0); // zero returned if timeout
     }
 
-    do {
-        if (c == skipChar) {
-            ; // ignore this character
-        }
-        else if (c == '-') {
-            isNegative = true;
+    for (;;) {
+        if (c == '.') {
+            isFraction = true;
         }
-        else if (c >= '0' && c <= '9') {    // is c a digit?
-            value = value * 10 + c - '0';
+        if (c != skipChar && n < size) {
+            buffer[n++] = c;
         }
         read();  // consume the character we got with peek
         c = timedPeek();
+
+        if (c < 0) break;
+        if (c == skipChar) continue;
+        if (kind == NUMBER_HEX) {
+            if (hexValue(c) <= 15) continue;
+            if ((c == 'x' || c == 'X') && n == 1 && buffer[0] == '0') continue;
+        }
+        else {
+            if (c >= '0' && c <= '9') continue;
+            if (c == '.' && kind == NUMBER_FLOAT && !isFraction) continue;
+        }
+        break;
+    }
+    return (n);
+}
+
+/*
+ *  ======== parseDecimal ========
+ *  Skip to the first digit or '-' and accumulate the digits after it
+ *  into magnitude, the type of which the digits wrap at.
+ */
+template<class T>
+static size_t parseDecimal(const char *buffer, size_t length, T &magnitude, bool &isNegative)
+{
+    const char *p = buffer;
+    const char *end = buffer + length;
+    T value = 0;
+
+    while (p < end && *p != '-' && (*p < '0' || *p > '9')) {
+        p++;
+    }
+    if (p == end) {
+        return (0);
     }
-    while ((c >= '0' && c <= '9') || c == skipChar);
 
+    isNegative = (*p == '-');
     if (isNegative) {
-        value = -value;
+        p++;
     }
-    return (value);
+    while (p < end && *p >= '0' && *p <= '9') {
+        value = value * 10 + (*p++ - '0');
+    }
+
+    magnitude = value;
+    return (p - buffer);
 }
 
+size_t Stream::parseInt(const char *buffer, size_t length, long &value)
+{
+    uint32_t magnitude;
+    bool isNegative;
+    size_t n = parseDecimal(buffer, length, magnitude, isNegative);
 
-// as parseInt but returns a floating point value
-float Stream::parseFloat()
+    if (n > 0) {
+        value = isNegative ? -(long)magnitude : (long)magnitude;
+    }
+    return (n);
+}
+
+size_t Stream::parseInt64(const char *buffer, size_t length, int64_t &value)
 {
-    return (parseFloat(NO_SKIP_CHAR));
+    uint64_t magnitude;
+    bool isNegative;
+    size_t n = parseDecimal(buffer, length, magnitude, isNegative);
+
+    if (n > 0) {
+        value = isNegative ? -(int64_t)magnitude : (int64_t)magnitude;
+    }
+    return (n);
 }
 
-// as above but the given skipChar is ignored
-// this allows format characters (typically commas) in values to be ignored
-float Stream::parseFloat(char skipChar)
+size_t Stream::parseHex(const char *buffer, size_t length, uint32_t &value)
 {
-    boolean isNegative = false;
-    boolean isFraction = false;
-    long value = 0;
-    char c;
-    float fraction = 1.0;
+    const char *p = buffer;
+    const char *end = buffer + length;
+    uint32_t v = 0;
 
-    c = peekNextDigit();
-    // ignore non numeric leading characters
-    if ((int)c < 0) {
-        return 0; // zero returned if timeout
+    while (p < end && hexValue(*p) > 15) {
+        p++;
+    }
+    if (p == end) {
+        return (0);
     }
 
-    do {
-        if(c == skipChar) {
-            ; // ignore
-        }
-        else if (c == '-') {
-            isNegative = true;
-        }
-        else if (c == '.') {
+    if (end - p > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X') && hexValue(p[2]) <= 15) {
+        p += 2;
+    }
+    while (p < end && hexValue(*p) <= 15) {
+        v = (v << 4) | hexValue(*p++);
+    }
+
+    value = v;
+    return (p - buffer);
+}
+
+// the digits are accumulated as an integer, the first 9 significant ones
+// exactly, and scaled by a power of ten once at the end
+size_t Stream::parseFloat(const char *buffer, size_t length, float &value)
+{
+    static const float powersOf10[11] = {
+        1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+    };
+    const char *p = buffer;
+    const char *end = buffer + length;
+    bool isNegative = false;
+    bool isFraction = false;
+    uint32_t mantissa = 0;
+    int digits = 0;     // significant digits in mantissa
+    int exp10 = 0;      // value is mantissa * 10^exp10
+    float f;
+
+    while (p < end && *p != '-' && (*p < '0' || *p > '9')) {
+        p++;
+    }
+    if (p == end) {
+        return (0);
+    }
+
+    if (*p == '-') {
+        isNegative = true;
+        p++;
+    }
+    for (; p < end; p++) {
+        if (*p == '.' && !isFraction) {
             isFraction = true;
+            continue;
+        }
+        if (*p < '0' || *p > '9') {
+            break;
         }
-        else if (c >= '0' && c <= '9')  {      // is c a digit?
-            value = value * 10 + c - '0';
+        if (digits < 9) {
+            mantissa = mantissa * 10 + (*p - '0');
+            if (mantissa != 0) {
+                digits++;
+            }
             if (isFraction) {
-                fraction *= 0.1;
+                exp10--;
             }
         }
-        read();  // consume the character we got with peek
-        c = timedPeek();
+        else if (!isFraction) {
+            exp10++;    // integer digits past the precision still count
+        }
     }
-    while ((c >= '0' && c <= '9') || (c == '.') || (c == skipChar));
 
-    if (isNegative) {
-        value = -value;
+    f = (float)mantissa;
+    while (exp10 < -10) {
+        f /= powersOf10[10];
+        exp10 += 10;
+    }
+    while (exp10 > 10) {
+        f *= powersOf10[10];
+        exp10 -= 10;
     }
-    if (isFraction) {
-        return (value * fraction);
+    if (exp10 < 0) {
+        f /= powersOf10[-exp10];
     }
     else {
-        return (value);
+        f *= powersOf10[exp10];
     }
+
+    value = isNegative ? -f : f;
+    return (p - buffer);
 }
 
 // read characters from stream into buffer
@@ -267,25 +559,61 @@ size_t Stream::readBytesUntil(char terminator, char *buffer, size_t length)
     return index; // return number of characters, not including null terminator
 }
 
+// readString() and readStringUntil() read in chunks and append each one
+// to the String in one go, starting with room for what's already received
 String Stream::readString()
 {
     String ret;
-    int c = timedRead();
-    while (c >= 0) {
-        ret += (char)c;
-        c = timedRead();
-    }
+    char chunk[STRING_CHUNK + 1];
+    size_t n;
+    int avail = available();
+
+    if (avail > 0) ret.reserve(avail);
+    do {
+        n = readBytes(chunk, STRING_CHUNK);
+        chunk[n] = '\0';
+        ret += chunk;
+    } while (n == STRING_CHUNK);    // a short chunk means a timeout
     return ret;
 }
 
 String Stream::readStringUntil(char terminator)
 {
     String ret;
-    int c = timedRead();
-    while (c >= 0 && c != terminator) {
-        ret += (char)c;
+    char chunk[STRING_CHUNK + 1];
+    size_t n;
+    int avail = available();
+
+    if (avail > 0) ret.reserve(avail);
+    do {
+        n = readBytesUntil(terminator, chunk, STRING_CHUNK);
+        chunk[n] = '\0';
+        ret += chunk;
+    } while (n == STRING_CHUNK);    // a short chunk means a terminator or timeout
+    return ret;
+}
+
+size_t Stream::readStringUntil(char terminator, char *buffer, size_t size)
+{
+    size_t n;
+
+    if (size == 0) return (0);
+    n = readBytesUntil(terminator, buffer, size - 1);
+    buffer[n] = '\0';
+    return (n);
+}
+
+size_t Stream::readStringUntil(char terminator, PString &str)
+{
+    size_t count = 0;
+    int c;
+
+    while (str.length() + 1 < str.capacity()) {
         c = timedRead();
+        if (c < 0 || c == terminator) break;
+        str.write((uint8_t)c);
+        count++;
     }
-    return ret;
+    return (count);
 }
 
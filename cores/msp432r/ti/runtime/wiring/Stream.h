@@ -25,6 +25,43 @@
 #include <inttypes.h>
 #include "Print.h"
 
+class PString;
+
+// matches a target string against data as it arrives, one char or one
+// chunk at a time, in O(n) over the data: a partial match that fails
+// falls back along the target's prefix table rather than starting over,
+// so overlapping prefixes (e.g. "\r\n\r\n" in "\r\n\r\r\n\r\n") are
+// found. Build one per target and reuse it; the target isn't copied.
+class StreamMatcher
+{
+    public:
+        StreamMatcher(const char *target);
+        StreamMatcher(const char *target, size_t length);
+        ~StreamMatcher();
+
+        void reset() { matched = 0; }   // forget a partial match
+
+        bool match(char c);     // returns true if c completes the target
+
+        size_t match(const char *buf, size_t length);
+        // returns the number of chars up to and including the end of the
+        // first match in buf, 0 if none; a partial match at the end of buf
+        // carries over to the next call
+
+        size_t length() { return len; }  // 0 if the prefix table couldn't be allocated
+
+    private:
+        StreamMatcher(const StreamMatcher &);
+        StreamMatcher &operator=(const StreamMatcher &);
+        void build(const char *target, size_t length);
+
+        const char *target;
+        size_t len;
+        size_t matched;         // chars of target matched so far
+        uint16_t *prefix;       // longest proper prefix that is also a suffix of target[0..i]
+        uint16_t local[16];     // prefix table of short targets, longer ones are malloc()ed
+};
+
 // compatability macros for testing
 /*
 #define   getInt()            parseInt()
@@ -43,6 +80,7 @@ class Stream : public Print
         int timedRead();    // private method to read stream with timeout
         int timedPeek();    // private method to peek stream with timeout
         int peekNextDigit(); // returns the next numeric digit in the stream or -1 if timeout
+        size_t readNumber(char *buffer, size_t size, char skipChar, int kind); // reads the number at the stream position into buffer for the parsers below
 
     public:
         virtual int available() = 0;
@@ -50,11 +88,17 @@ class Stream : public Print
         virtual int peek() = 0;
         virtual void flush() = 0;
 
+        // wait up to timeout ms until available() > 0, returns false on
+        // timeout; the timed reads below wait with it. This default
+        // polls, streams that can wake a waiting task override it.
+        virtual bool waitForData(unsigned long timeout);
+
         Stream() {_timeout=1000;}
 
         // parsing methods
 
         void setTimeout(unsigned long timeout);  // sets maximum milliseconds to wait for stream data, default is 1 second
+        unsigned long getTimeout(void) { return _timeout; }
 
         bool find(char *target);   // reads data from the stream until the target string is found
         // returns true if target string is found, false if timed out (see setTimeout)
@@ -66,6 +110,9 @@ class Stream : public Print
 
         bool findUntil(char *target, size_t targetLen, char *terminate, size_t termLen);   // as above but search ends if the terminate string is found
 
+        bool find(StreamMatcher &target);   // as find() with a prebuilt matcher
+        bool findUntil(StreamMatcher &target, StreamMatcher &terminator);   // as findUntil() with prebuilt matchers
+
 
         long parseInt(); // returns the first valid (long) integer value from the current position.
         // initial characters that are not digits (or the minus sign) are skipped
@@ -73,9 +120,21 @@ class Stream : public Print
 
         float parseFloat();               // float version of parseInt
 
-        size_t readBytes( char *buffer, size_t length); // read chars from stream into buffer
+        int64_t parseInt64();            // 64 bit version of parseInt
+        uint32_t parseHex();             // as parseInt for hex digits, with or without a leading 0x
+
+        // the parsers above on data already in memory, e.g. from readBytes():
+        // skip leading chars that can't start a number, convert the number
+        // and return the number of chars used, 0 if there was no number
+        static size_t parseInt(const char *buffer, size_t length, long &value);
+        static size_t parseInt64(const char *buffer, size_t length, int64_t &value);
+        static size_t parseHex(const char *buffer, size_t length, uint32_t &value);
+        static size_t parseFloat(const char *buffer, size_t length, float &value);
+
+        virtual size_t readBytes( char *buffer, size_t length); // read chars from stream into buffer
         // terminates if length characters have been read or timeout (see setTimeout)
         // returns the number of characters placed in the buffer (0 means no valid data found)
+        size_t readBytes( uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
 
         size_t readBytesUntil( char terminator, char *buffer, size_t length); // as readBytes with terminator character
         // terminates if length characters have been read, timeout, or if the terminator character  detected
@@ -85,6 +144,12 @@ class Stream : public Print
         String readString();
         String readStringUntil(char terminator);
 
+        // as readStringUntil() without allocating: store at most size - 1
+        // chars and a '\0' in buffer, or append to str until it is full;
+        // return the number of chars stored
+        size_t readStringUntil(char terminator, char *buffer, size_t size);
+        size_t readStringUntil(char terminator, PString &str);
+
     protected:
         long parseInt(char skipChar); // as above but the given skipChar is ignored
                                       // this allows format characters (typically commas) in values to be ignored
@@ -0,0 +1,551 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+#include "TaskAttrs.h"
+
+#include <xdc/runtime/Error.h>
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/utils/Load.h>
+
+#define TASK_REPORT_MAX 16          /* tasks a report shows */
+#define TASK_REPORT_STACK 1024      /* taskReportBegin()'s task */
+#define TASK_STARTUP_STACK 512      /* taskAttrsStartup()'s task */
+
+TaskAttrs *TaskAttrs::list = NULL;
+
+static Task_Struct startupTask;
+static uint64_t startupStack[TASK_STARTUP_STACK / sizeof(uint64_t)];
+
+/*
+ *  ======== startupFxn ========
+ *  First to run after BIOS_start(): it is at the highest priority and
+ *  ahead of the sketch tasks, all created later by main()
+ */
+static void startupFxn(UArg arg0, UArg arg1)
+{
+    taskAttrsStartup();
+}
+
+/*
+ *  ======== TaskAttrs ========
+ *  Static constructors run after the kernel's startup and before
+ *  main() creates the sketch tasks, so the list is complete by
+ *  BIOS_start(). The first one also constructs the task that applies
+ *  them.
+ */
+TaskAttrs::TaskAttrs(void (*loop)(void), const char *name,
+    size_t stackSize, int priority, bool events) :
+    loop(loop), name(name), stackSize(stackSize), priority(priority),
+    events(events)
+{
+    task = NULL;
+    memset(pins, 0, sizeof(pins));
+
+    if (list == NULL) {
+        Task_Params params;
+
+        Task_Params_init(&params);
+        params.stack = startupStack;
+        params.stackSize = sizeof(startupStack);
+        params.priority = Task_numPriorities - 1;
+        params.instance->name = (xdc_String)"taskAttrs";
+        Task_construct(&startupTask, startupFxn, &params, NULL);
+    }
+
+    next = list;
+    list = this;
+}
+
+/*
+ *  ======== find ========
+ *  Sketch tasks run setup() and loop() given as their arg0 and arg1
+ */
+TaskAttrs *TaskAttrs::find(Task_Handle task)
+{
+    TaskAttrs *attrs;
+    UArg arg0, arg1;
+
+    Task_getFunc(task, &arg0, &arg1);
+    for (attrs = list; attrs != NULL; attrs = attrs->next) {
+        if ((UArg)attrs->loop == arg1) {
+            return (attrs);
+        }
+    }
+
+    return (NULL);
+}
+
+/*
+ *  ======== eventLoopFxn ========
+ *  An EVENT_LOOP task: setup(), then loop() each time something the
+ *  last pass declared has come
+ */
+static void eventLoopFxn(UArg setupFxn, UArg loopFxn)
+{
+    TaskAttrs *attrs = TaskAttrs::find(Task_self());
+
+    ((void (*)(void))setupFxn)();
+
+    for (;;) {
+        attrs->waitBits = 0;
+        attrs->waitTicks = BIOS_WAIT_FOREVER;
+
+        ((void (*)(void))loopFxn)();
+
+        if (attrs->waitBits != 0) {
+            attrs->woke = Event_pend(Event_handle(&attrs->event),
+                Event_Id_NONE, attrs->waitBits, attrs->waitTicks);
+        }
+        else if (attrs->waitTicks != (uint32_t)BIOS_WAIT_FOREVER) {
+            Task_sleep(attrs->waitTicks);
+            attrs->woke = 0;
+        }
+        else {
+            attrs->woke = 0;
+        }
+    }
+}
+
+/*
+ *  ======== current ========
+ *  The calling task's EVENT_LOOP, NULL from any other
+ */
+static TaskAttrs *current(void)
+{
+    TaskAttrs *attrs = TaskAttrs::find(Task_self());
+
+    return (attrs != NULL && attrs->events && attrs->task != NULL ?
+        attrs : NULL);
+}
+
+/*
+ *  ======== loopWaitSerial ========
+ *  Chars already received end the wait at once
+ */
+void loopWaitSerial(HardwareSerial &serial)
+{
+    TaskAttrs *attrs = current();
+
+    if (attrs == NULL) {
+        return;
+    }
+
+    serial.setRxEvent(Event_handle(&attrs->event), LOOP_EVENT_SERIAL);
+    attrs->waitBits |= LOOP_EVENT_SERIAL;
+    if (serial.available()) {
+        attrs->waitTicks = 0;
+    }
+}
+
+/*
+ *  ======== loopWaitPin ========
+ *  The pin stays attached to the loop's event until a pass asks for
+ *  another mode; posts while no pass waits on it end the next wait
+ *  that does.
+ */
+void loopWaitPin(uint8_t pin, int mode)
+{
+    TaskAttrs *attrs = current();
+    int free = -1;
+    int i;
+
+    if (attrs == NULL || pin == 0) {
+        return;
+    }
+
+    for (i = 0; i < LOOP_PINS_MAX; i++) {
+        if (attrs->pins[i] == pin) {
+            break;
+        }
+        if (attrs->pins[i] == 0 && free < 0) {
+            free = i;
+        }
+    }
+    if (i == LOOP_PINS_MAX) {
+        if (free < 0) {
+            return;
+        }
+        i = free;
+        attrs->pinModes[i] = -1;
+    }
+
+    if (attrs->pinModes[i] != mode) {
+        attachInterruptEvent(pin, Event_handle(&attrs->event),
+            LOOP_EVENT_PIN, mode);
+        attrs->pins[i] = pin;
+        attrs->pinModes[i] = mode;
+    }
+    attrs->waitBits |= LOOP_EVENT_PIN;
+}
+
+/*
+ *  ======== loopWaitMs ========
+ *  The shortest of a pass's timeouts wins; Clock ticks are ms, as for
+ *  delay()
+ */
+void loopWaitMs(uint32_t ms)
+{
+    TaskAttrs *attrs = current();
+
+    if (attrs != NULL && ms < attrs->waitTicks) {
+        attrs->waitTicks = ms;
+    }
+}
+
+void loopWaitBits(uint32_t bits)
+{
+    TaskAttrs *attrs = current();
+
+    if (attrs != NULL) {
+        attrs->waitBits |= bits & LOOP_EVENT_USER;
+    }
+}
+
+uint32_t loopEvents(void)
+{
+    TaskAttrs *attrs = current();
+
+    return (attrs != NULL ? attrs->woke : 0);
+}
+
+/*
+ *  ======== loopPost ========
+ */
+void loopPost(void (*loop)(void), uint32_t bits)
+{
+    TaskAttrs *attrs;
+
+    for (attrs = TaskAttrs::list; attrs != NULL; attrs = attrs->next) {
+        if (attrs->loop == loop) {
+            if (attrs->events && attrs->task != NULL) {
+                Event_post(Event_handle(&attrs->event),
+                    bits & LOOP_EVENT_USER);
+            }
+            return;
+        }
+    }
+}
+
+/*
+ *  ======== recreate ========
+ *  Create the task again with its attributes, then drop the original.
+ *  Both stacks are allocated for a moment; if the new one doesn't fit
+ *  the original stays, an ordinary loop. An EVENT_LOOP's task runs
+ *  eventLoopFxn() with the same setup() and loop().
+ */
+static void recreate(TaskAttrs *attrs, Task_Handle task)
+{
+    Task_Params params;
+    Task_FuncPtr fxn;
+    Task_Handle fresh;
+    Task_Stat stat;
+
+    Task_stat(task, &stat);
+
+    Task_Params_init(&params);
+    fxn = Task_getFunc(task, &params.arg0, &params.arg1);
+    params.instance->name = Task_Handle_name(task);
+    params.env = stat.env;
+    params.stackSize = attrs->stackSize != 0 ?
+        attrs->stackSize : stat.stackSize;
+    params.priority = attrs->priority != 0 ?
+        attrs->priority : stat.priority;
+    if (params.priority >= (int)Task_numPriorities) {
+        params.priority = Task_numPriorities - 1;
+    }
+    else if (params.priority < 1) {
+        params.priority = 1;
+    }
+
+    if (attrs->events) {
+        Event_construct(&attrs->event, NULL);
+        fxn = eventLoopFxn;
+    }
+
+    fresh = Task_create(fxn, &params, Error_IGNORE);
+    if (fresh == NULL) {
+        if (attrs->events) {
+            Event_destruct(&attrs->event);
+        }
+        return;
+    }
+    Task_delete(&task);
+    attrs->task = fresh;
+}
+
+/*
+ *  ======== taskAttrsStartup ========
+ *  Runs from startupFxn(), after main() has created the sketch tasks
+ *  and before the scheduler has run any of them
+ */
+void taskAttrsStartup(void)
+{
+    Task_Handle task, following;
+    TaskAttrs *attrs;
+
+    for (task = Task_Object_first(); task != NULL; task = following) {
+        following = Task_Object_next(task);
+        attrs = TaskAttrs::find(task);
+        if (attrs != NULL && attrs->task == NULL) {
+            recreate(attrs, task);
+        }
+    }
+}
+
+/*
+ *  ======== taskStackUnused ========
+ */
+size_t taskStackUnused(Task_Handle task)
+{
+    Task_Stat stat;
+
+    Task_stat(task != NULL ? task : Task_self(), &stat);
+
+    return (stat.stackSize - stat.used);
+}
+
+typedef struct TaskReport {
+    Task_Handle task;
+    const char *name;
+    Task_Stat stat;
+} TaskReport;
+
+/*
+ *  ======== taskName ========
+ */
+const char *taskName(Task_Handle task)
+{
+    TaskAttrs *attrs = TaskAttrs::find(task);
+    const char *name;
+
+    if (attrs != NULL) {
+        return (attrs->name);
+    }
+    name = Task_Handle_name(task);
+
+    return (name != NULL && name[0] != '\0' ? name : NULL);
+}
+
+/*
+ *  ======== taskSnapshot ========
+ *  Static tasks, then created ones. Taken with the scheduler off, so no
+ *  task is deleted while the list is walked; printing comes after.
+ */
+static int taskSnapshot(TaskReport *report, int max)
+{
+    Task_Handle task;
+    UInt key;
+    int i, count = 0;
+
+    key = Task_disable();
+    for (i = 0; i < Task_Object_count() && count < max; i++) {
+        report[count++].task = Task_Object_get(NULL, i);
+    }
+    task = Task_Object_first();
+    for (; task != NULL && count < max; task = Task_Object_next(task)) {
+        report[count++].task = task;
+    }
+    for (i = 0; i < count; i++) {
+        report[i].name = taskName(report[i].task);
+        Task_stat(report[i].task, &report[i].stat);
+    }
+    Task_restore(key);
+
+    return (count);
+}
+
+/*
+ *  ======== taskStacksPrint ========
+ */
+void taskStacksPrint(Print &out)
+{
+    TaskReport report[TASK_REPORT_MAX];
+    Hwi_StackInfo info;
+    int i, count;
+
+    count = taskSnapshot(report, TASK_REPORT_MAX);
+    for (i = 0; i < count; i++) {
+        Task_Stat *stat = &report[i].stat;
+
+        if (report[i].name != NULL) {
+            out.printf("%-16s", report[i].name);
+        }
+        else {
+            out.printf("task %-11p", (void *)report[i].task);
+        }
+        out.printf(" prio %2d stack %5u used %5u free %5u\r\n",
+            stat->priority, (unsigned)stat->stackSize, (unsigned)stat->used,
+            (unsigned)(stat->stackSize - stat->used));
+    }
+
+    Hwi_getStackInfo(&info, TRUE);
+    out.printf("%-16s         stack %5u used %5u free %5u\r\n", "hwi",
+        (unsigned)info.hwiStackSize, (unsigned)info.hwiStackPeak,
+        (unsigned)(info.hwiStackSize - info.hwiStackPeak));
+}
+
+/*
+ *  ======== cpuLoad ========
+ */
+uint32_t cpuLoad(void)
+{
+    return (Load_getCPULoad());
+}
+
+/*
+ *  ======== taskLoadsPrint ========
+ *  Load_Stat times are Timestamp counts of the last window; they are
+ *  shown in ms at the current CPU frequency.
+ */
+void taskLoadsPrint(Print &out)
+{
+    TaskReport report[TASK_REPORT_MAX];
+    Types_FreqHz freq;
+    int i, count;
+
+    Timestamp_getFreq(&freq);
+
+    count = taskSnapshot(report, TASK_REPORT_MAX);
+    for (i = 0; i < count; i++) {
+        Load_Stat load;
+        uint32_t tenths = 0, ms = 0;
+
+        if (!Load_getTaskLoad(report[i].task, &load)) {
+            continue;           /* created after Load last updated */
+        }
+        if (load.totalTime != 0) {
+            tenths = (uint64_t)load.threadTime * 1000 / load.totalTime;
+        }
+        if (freq.lo != 0) {
+            ms = (uint64_t)load.threadTime * 1000 / freq.lo;
+        }
+
+        if (report[i].name != NULL) {
+            out.printf("%-16s", report[i].name);
+        }
+        else {
+            out.printf("task %-11p", (void *)report[i].task);
+        }
+        out.printf(" prio %2d load %3lu.%lu%% %6lums\r\n",
+            report[i].stat.priority, (unsigned long)(tenths / 10),
+            (unsigned long)(tenths % 10), (unsigned long)ms);
+    }
+}
+
+static Task_Struct reportTask;
+static uint64_t reportStack[TASK_REPORT_STACK / sizeof(uint64_t)];
+static Semaphore_Struct reportSem;
+static Print *volatile reportOut;
+static volatile uint32_t reportMs;      /* 0 while ended */
+static bool reportClaimed;
+
+/*
+ *  ======== reportFxn ========
+ */
+static void reportFxn(UArg arg0, UArg arg1)
+{
+    for (;;) {
+        if (reportMs == 0) {
+            Semaphore_pend(Semaphore_handle(&reportSem), BIOS_WAIT_FOREVER);
+            continue;
+        }
+
+        delay(reportMs);
+
+        if (reportMs != 0) {
+            Print &out = *reportOut;
+
+            out.printf("cpu load %lu%%\r\n", (unsigned long)cpuLoad());
+            taskLoadsPrint(out);
+            taskStacksPrint(out);
+            out.println();
+        }
+    }
+}
+
+/*
+ *  ======== taskReportBegin ========
+ *  The task is constructed on the first call, in static memory that
+ *  only sketches using the report link in.
+ */
+bool taskReportBegin(uint32_t periodMs, Print &out)
+{
+    Semaphore_Params semParams;
+    Task_Params params;
+    bool first;
+    UInt key;
+
+    if (periodMs == 0) {
+        return (false);
+    }
+
+    reportOut = &out;
+    reportMs = periodMs;
+
+    key = Hwi_disable();
+    first = !reportClaimed;
+    reportClaimed = true;
+    Hwi_restore(key);
+
+    if (!first) {
+        Semaphore_post(Semaphore_handle(&reportSem));
+        return (true);
+    }
+
+    Semaphore_Params_init(&semParams);
+    semParams.mode = Semaphore_Mode_BINARY;
+    Semaphore_construct(&reportSem, 0, &semParams);
+
+    Task_Params_init(&params);
+    params.stack = reportStack;
+    params.stackSize = sizeof(reportStack);
+    params.priority = Task_numPriorities - 1;
+    params.instance->name = (xdc_String)"taskReport";
+    Task_construct(&reportTask, reportFxn, &params, NULL);
+
+    return (true);
+}
+
+/*
+ *  ======== taskReportEnd ========
+ *  The task finishes the report it may be printing, then waits
+ */
+void taskReportEnd(void)
+{
+    reportMs = 0;
+}
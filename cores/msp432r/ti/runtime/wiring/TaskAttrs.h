@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== TaskAttrs.h ========
+ *  Stack size and priority of a sketch's setup()/loop() task. Each
+ *  pair runs in its own TI-RTOS task, created with the same stack and
+ *  priority as every other one; a tab can size its own:
+ *
+ *      TASK_ATTRS(loopWiFi, 4096, 2);   // deep network stack
+ *      TASK_ATTRS(loopBlink, 512, 0);   // 0: keep the priority
+ *
+ *      void setupWiFi() { ... }
+ *      void loopWiFi() { ... }
+ *
+ *  loopName is the tab's loop function, a stack or priority of 0
+ *  keeps the one it was created with. At BIOS_start(), before any of
+ *  them runs, each task named by a TASK_ATTRS is created again with
+ *  its attributes and the original is deleted; if that fails the task
+ *  keeps running with the original ones.
+ *
+ *  EVENT_LOOP() takes the same arguments and also makes the loop event
+ *  driven: loop() runs again only once something it declared, on its
+ *  last pass, has come, and the task sleeps meanwhile:
+ *
+ *      EVENT_LOOP(loop, 0, 0);
+ *
+ *      void loop() {
+ *          while (Serial.available()) { ... }
+ *          loopWaitSerial(Serial);         // chars
+ *          loopWaitPin(PUSH1, FALLING);    // or a press
+ *          loopWaitMs(1000);               // or a second at most
+ *      }
+ *
+ *  A pass that declares nothing is followed by the next one at once,
+ *  as in an ordinary loop. loopWaitBits() waits for loopPost() of the
+ *  bits from anywhere, an interrupt or another task, e.g. next to a
+ *  Semaphore_post(); loopEvents() says what woke the current pass.
+ *  loopWaitSerial() takes over the port's setRxEvent().
+ *
+ *  taskStacksPrint() shows how much of its stack each task has used
+ *  so far, from the fill pattern left in the part never written.
+ *
+ *  cpuLoad() and taskLoadsPrint() show where the CPU time of the last
+ *  Load window (500ms) went, as the Load module measures it from the
+ *  idle loop. Timestamp counts stop in deep sleep, so the shares are
+ *  of the time the CPU was awake. taskReportBegin() prints both
+ *  reports every periodMs from a task at the highest priority, which
+ *  gets through even while a loop never blocks.
+ */
+
+#ifndef TaskAttrs_h
+#define TaskAttrs_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ti/sysbios/knl/Event.h>
+#include <ti/sysbios/knl/Task.h>
+
+/* loopEvents() bits of the core's own sources; loopPost() takes the rest */
+#define LOOP_EVENT_SERIAL   0x80000000
+#define LOOP_EVENT_PIN      0x40000000
+#define LOOP_EVENT_USER     0x3fffffff
+
+#define LOOP_PINS_MAX       4           /* pins an EVENT_LOOP waits on */
+
+class HardwareSerial;
+class Print;
+
+class TaskAttrs
+{
+    public:
+        TaskAttrs(void (*loop)(void), const char *name, size_t stackSize,
+            int priority, bool events = false);
+
+        static TaskAttrs *find(Task_Handle task);
+
+        void (*const loop)(void);
+        const char *const name;
+        const size_t stackSize;
+        const int priority;
+        const bool events;              /* an EVENT_LOOP */
+
+        Task_Handle task;               /* once recreated */
+        TaskAttrs *next;
+
+        /* EVENT_LOOP state */
+        Event_Struct event;
+        uint32_t waitBits;              /* declared by this pass */
+        uint32_t waitTicks;
+        uint32_t woke;                  /* what ended the last wait */
+        uint8_t pins[LOOP_PINS_MAX];    /* attached to event, 0: none */
+        int8_t pinModes[LOOP_PINS_MAX];
+
+        static TaskAttrs *list;
+};
+
+#define TASK_ATTRS(loopName, stack, prio) \
+    static TaskAttrs loopName##Attrs(loopName, #loopName, (stack), (prio))
+
+#define EVENT_LOOP(loopName, stack, prio) \
+    static TaskAttrs loopName##Attrs(loopName, #loopName, (stack), (prio), \
+        true)
+
+/* from an EVENT_LOOP's loop(): what the next pass waits for */
+void loopWaitSerial(HardwareSerial &serial);
+void loopWaitPin(uint8_t pin, int mode);
+void loopWaitMs(uint32_t ms);
+void loopWaitBits(uint32_t bits);
+
+/* the bits that ended the wait before this pass, 0 on timeout */
+uint32_t loopEvents(void);
+
+/* wake loopName's task if it waits for any of bits; any context */
+void loopPost(void (*loop)(void), uint32_t bits);
+
+/* its TASK_ATTRS or instance name, NULL if it has neither */
+const char *taskName(Task_Handle task);
+
+/* stack bytes the task never used, NULL for the calling task */
+size_t taskStackUnused(Task_Handle task = NULL);
+
+/* stack use of every task and of the Hwi stack */
+void taskStacksPrint(Print &out);
+
+/* percent of the last Load window the CPU was not idle */
+uint32_t cpuLoad(void);
+
+/* share of the last Load window each task ran */
+void taskLoadsPrint(Print &out);
+
+/* both reports every periodMs, to out, until taskReportEnd() */
+bool taskReportBegin(uint32_t periodMs, Print &out);
+void taskReportEnd(void);
+
+extern "C" void taskAttrsStartup(void);    /* before the sketch tasks run */
+
+#endif
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+#include "TaskMonitor.h"
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+#include <ti/drivers/Watchdog.h>
+#include "TaskAttrs.h"
+
+#define MONITOR_STACK 768
+
+typedef struct MonitorEntry {
+    Task_Handle task;               /* NULL if the entry is free */
+    uint32_t deadlineMs;
+    volatile uint32_t lastBeat;     /* millis() */
+} MonitorEntry;
+
+typedef struct MonitorFault {
+    Task_Handle task;               /* NULL for the Hwi stack */
+    bool stack;                     /* else a missed deadline */
+    uint32_t free;
+    uint32_t size;
+    uint32_t lateMs;
+} MonitorFault;
+
+static MonitorEntry entries[MONITOR_TASKS_MAX];
+
+static Task_Struct monitorTask;
+static uint64_t monitorStack[MONITOR_STACK / sizeof(uint64_t)];
+static Watchdog_Handle watchdog;
+static Print *monitorOut;
+static uint32_t monitorPeriodMs;
+static size_t monitorMargin;
+static bool monitorClaimed;
+
+/*
+ *  ======== findEntry ========
+ */
+static MonitorEntry *findEntry(Task_Handle task)
+{
+    int i;
+
+    for (i = 0; i < MONITOR_TASKS_MAX; i++) {
+        if (entries[i].task == task) {
+            return (&entries[i]);
+        }
+    }
+
+    return (NULL);
+}
+
+/*
+ *  ======== stackLow ========
+ */
+static bool stackLow(Task_Handle task, MonitorFault *fault)
+{
+    Task_Stat stat;
+
+    Task_stat(task, &stat);
+    if (stat.stackSize - stat.used >= monitorMargin) {
+        return (false);
+    }
+    fault->task = task;
+    fault->stack = true;
+    fault->free = stat.stackSize - stat.used;
+    fault->size = stat.stackSize;
+
+    return (true);
+}
+
+/*
+ *  ======== check ========
+ *  false with the first problem found in fault
+ */
+static bool check(MonitorFault *fault)
+{
+    Hwi_StackInfo info;
+    Task_Handle task;
+    bool low = false;
+    UInt key;
+    int i;
+
+    for (i = 0; i < MONITOR_TASKS_MAX; i++) {
+        uint32_t beat = entries[i].lastBeat;        /* before millis() */
+        uint32_t late = millis() - beat;
+
+        if (entries[i].task != NULL && late > entries[i].deadlineMs) {
+            fault->task = entries[i].task;
+            fault->stack = false;
+            fault->lateMs = late - entries[i].deadlineMs;
+            fault->size = entries[i].deadlineMs;
+            return (false);
+        }
+    }
+
+    /* no task is deleted while the list is walked */
+    key = Task_disable();
+    for (i = 0; i < Task_Object_count() && !low; i++) {
+        low = stackLow(Task_Object_get(NULL, i), fault);
+    }
+    task = Task_Object_first();
+    for (; task != NULL && !low; task = Task_Object_next(task)) {
+        low = stackLow(task, fault);
+    }
+    Task_restore(key);
+    if (low) {
+        return (false);
+    }
+
+    Hwi_getStackInfo(&info, TRUE);
+    if (info.hwiStackSize - info.hwiStackPeak < monitorMargin) {
+        fault->task = NULL;
+        fault->stack = true;
+        fault->free = info.hwiStackSize - info.hwiStackPeak;
+        fault->size = info.hwiStackSize;
+        return (false);
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== report ========
+ */
+static void report(MonitorFault *fault)
+{
+    Print &out = *monitorOut;
+    const char *name;
+
+    name = fault->task != NULL ? taskName(fault->task) : "hwi";
+    if (name != NULL) {
+        out.printf("monitor: %s", name);
+    }
+    else {
+        out.printf("monitor: task %p", (void *)fault->task);
+    }
+    if (fault->stack) {
+        out.printf(" stack %lu of %lu bytes free", (unsigned long)fault->free,
+            (unsigned long)fault->size);
+    }
+    else {
+        out.printf(" %lums past its %lums deadline",
+            (unsigned long)fault->lateMs, (unsigned long)fault->size);
+    }
+    out.println(watchdog != NULL ? ", resetting" : "");
+}
+
+/*
+ *  ======== monitorFxn ========
+ *  Reports a problem once, until things are healthy again
+ */
+static void monitorFxn(UArg arg0, UArg arg1)
+{
+    MonitorFault fault;
+    bool reported = false;
+
+    for (;;) {
+        delay(monitorPeriodMs);
+
+        if (check(&fault)) {
+            if (watchdog != NULL) {
+                Watchdog_clear(watchdog);
+            }
+            reported = false;
+        }
+        else if (!reported && monitorOut != NULL) {
+            report(&fault);
+            reported = true;
+        }
+    }
+}
+
+/*
+ *  ======== taskMonitorBegin ========
+ */
+bool taskMonitorBegin(uint32_t periodMs, Print *report, bool useWatchdog,
+    size_t stackMargin)
+{
+    Watchdog_Params watchdogParams;
+    Task_Params params;
+    bool first;
+    UInt key;
+
+    if (periodMs == 0) {
+        return (false);
+    }
+
+    key = Hwi_disable();
+    first = !monitorClaimed;
+    monitorClaimed = true;
+    Hwi_restore(key);
+
+    if (!first) {
+        return (false);
+    }
+
+    monitorPeriodMs = periodMs;
+    monitorOut = report;
+    monitorMargin = stackMargin;
+
+    if (useWatchdog) {
+        Watchdog_init();
+        Watchdog_Params_init(&watchdogParams);
+        watchdogParams.resetMode = Watchdog_RESET_ON;
+        watchdog = Watchdog_open(Board_WATCHDOG, &watchdogParams);
+    }
+
+    Task_Params_init(&params);
+    params.stack = monitorStack;
+    params.stackSize = sizeof(monitorStack);
+    params.priority = Task_numPriorities - 1;
+    params.instance->name = (xdc_String)"taskMonitor";
+    Task_construct(&monitorTask, monitorFxn, &params, NULL);
+
+    return (!useWatchdog || watchdog != NULL);
+}
+
+/*
+ *  ======== taskMonitorWatch ========
+ */
+bool taskMonitorWatch(uint32_t deadlineMs)
+{
+    Task_Handle self = Task_self();
+    MonitorEntry *entry;
+    UInt key;
+
+    key = Hwi_disable();
+    entry = findEntry(self);
+    if (entry == NULL) {
+        entry = findEntry(NULL);
+    }
+    if (entry != NULL) {
+        entry->deadlineMs = deadlineMs;
+        entry->lastBeat = millis();
+        entry->task = self;
+    }
+    Hwi_restore(key);
+
+    return (entry != NULL);
+}
+
+/*
+ *  ======== taskMonitorUnwatch ========
+ */
+void taskMonitorUnwatch(void)
+{
+    MonitorEntry *entry;
+    UInt key;
+
+    key = Hwi_disable();
+    entry = findEntry(Task_self());
+    if (entry != NULL) {
+        entry->task = NULL;
+    }
+    Hwi_restore(key);
+}
+
+/*
+ *  ======== taskMonitorBeat ========
+ */
+void taskMonitorBeat(void)
+{
+    MonitorEntry *entry = findEntry(Task_self());
+
+    if (entry != NULL) {
+        entry->lastBeat = millis();
+    }
+}
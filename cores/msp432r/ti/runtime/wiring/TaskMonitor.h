@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== TaskMonitor.h ========
+ *  Catches a task about to overflow its stack or a loop that stopped
+ *  making progress, reports it, and lets the watchdog reset the board:
+ *
+ *      void setup()
+ *      {
+ *          Serial.begin(115200);
+ *          taskMonitorBegin(100, &Serial);
+ *          taskMonitorWatch(500);          // this loop, every 500ms
+ *      }
+ *
+ *      void loop()
+ *      {
+ *          taskMonitorBeat();
+ *          ...
+ *      }
+ *
+ *  Every periodMs a task at the highest priority checks that every
+ *  task, and the Hwi stack, has at least stackMargin bytes of stack
+ *  never used, and that every watched task has called taskMonitorBeat()
+ *  within its deadline. It clears the watchdog only while all of that
+ *  holds. Otherwise it prints the culprit once to report, and the
+ *  watchdog resets the board unless the culprit recovers first.
+ *
+ *  The watchdog period is set by the board's Watchdog_config, about
+ *  0.7s at SMCLK 12MHz and longer at lower performance levels, so
+ *  periodMs must be well below it. Without the watchdog the monitor
+ *  only reports.
+ */
+
+#ifndef TaskMonitor_h
+#define TaskMonitor_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MONITOR_TASKS_MAX       8       /* tasks taskMonitorWatch() takes */
+#define MONITOR_STACK_MARGIN    64      /* default bytes never used */
+
+class Print;
+
+bool taskMonitorBegin(uint32_t periodMs, Print *report = NULL,
+    bool watchdog = true, size_t stackMargin = MONITOR_STACK_MARGIN);
+
+/* the calling task must beat at least every deadlineMs from now on */
+bool taskMonitorWatch(uint32_t deadlineMs);
+void taskMonitorUnwatch(void);
+
+void taskMonitorBeat(void);
+
+#endif
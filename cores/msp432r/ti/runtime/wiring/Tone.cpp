@@ -31,86 +31,220 @@
  */
 
 #include "Energia.h"
+#include "wiring_private.h"
 
-#include <ti/sysbios/hal/Timer.h>
-#include <xdc/runtime/Types.h>
-#include <xdc/runtime/Error.h>
+#include <ti/sysbios/knl/Clock.h>
+#include <ti/sysbios/knl/Swi.h>
 
-extern uint32_t toneTimerId;
+/*
+ * Tones on pins with a Timer_A output are generated by the timer in
+ * toggle mode (see timerToneBegin()), one timer per tone, so several
+ * can play at once and none costs an interrupt. Other pins, or when
+ * no timer is free, get the old software tone: a MicroTimer toggling
+ * the pin at twice the frequency, one such tone at a time. Durations
+ * of all tones run off a single one-shot Clock, armed for whichever
+ * tone ends first.
+ */
+#define TONE_MAX 4      /* three timer tones and one software tone */
+
+typedef struct ToneSlot {
+    uint8_t pin;
+    bool active;
+    bool hardware;
+    bool timed;
+    uint32_t end;       /* Clock_getTicks() when the tone stops */
+} ToneSlot;
+
+static ToneSlot tones[TONE_MAX];
 
-static Timer_Params timerParams;
-static Timer_Handle timerHandle;
+static Clock_Struct toneClock;
+static bool toneClockConstructed = false;
 
-static bool initTimer = true;
-static bool playing = false;
+static MicroTimer toneTimer;
+static FastPin toneOut;
 static bool togglePin = true;
-static uint8_t tonePin;
-static bool toneState;
-static unsigned long toneDuration;
-static unsigned long mark;
 
-static void ToneIntHandler(UArg arg0)
+static void ToneIntHandler(uintptr_t arg0)
 {
-    if (millis() - mark > toneDuration && toneDuration != 0) {
-        Timer_stop(timerHandle);
-        digitalWrite(tonePin, LOW);
-        playing = false;
-        return;
+    if (togglePin) {
+        toneOut.toggle();
     }
+}
 
-    if (togglePin) {
-        digitalWrite(tonePin, toneState);
+/*
+ *  ======== toneStop ========
+ *  Called with Swis disabled.
+ */
+static void toneStop(ToneSlot *t)
+{
+    if (t->hardware) {
+        timerToneEnd(t->pin);
     }
-    toneState = !toneState;
+    else {
+        microTimerStop(&toneTimer);
+        toneOut.low();
+    }
+    t->active = false;
+}
+
+/*
+ *  ======== toneArm ========
+ *  (Re)start the Clock for the next tone to end. Called with Swis
+ *  disabled.
+ */
+static void toneArm(void)
+{
+    Clock_Handle clock = Clock_handle(&toneClock);
+    uint32_t now = Clock_getTicks();
+    uint32_t next = ~0;
+    uint8_t i;
+
+    Clock_stop(clock);
+
+    for (i = 0; i < TONE_MAX; i++) {
+        if (tones[i].active && tones[i].timed &&
+            tones[i].end - now < next) {
+            next = tones[i].end - now;
+        }
+    }
+
+    if (next != (uint32_t)~0) {
+        Clock_setTimeout(clock, next ? next : 1);
+        Clock_start(clock);
+    }
+}
+
+/*
+ *  ======== toneClockFxn ========
+ */
+static void toneClockFxn(UArg arg)
+{
+    uint32_t now = Clock_getTicks();
+    UInt key;
+    uint8_t i;
+
+    key = Swi_disable();
+
+    for (i = 0; i < TONE_MAX; i++) {
+        if (tones[i].active && tones[i].timed &&
+            (int32_t)(tones[i].end - now) <= 0) {
+            toneStop(&tones[i]);
+        }
+    }
+    toneArm();
+
+    Swi_restore(key);
 }
 
 void tone(uint8_t _pin, unsigned int frequency, unsigned long duration)
 {
-    if (playing && tonePin != _pin) {
+    ToneSlot *t = NULL;
+    ToneSlot *software = NULL;
+    uint32_t halfPeriod;
+    UInt key;
+    uint8_t i;
+
+    if (frequency > 20000) {
         return;
     }
 
-    if (frequency > 20000) {
+    if (!toneClockConstructed) {
+        Clock_Params params;
+
+        Clock_Params_init(&params);
+        Clock_construct(&toneClock, toneClockFxn, 0, &params);
+        toneClockConstructed = true;
+    }
+
+    if (!checkPinMode(_pin, OUTPUT)) {
+        pinMode(_pin, OUTPUT);
+    }
+
+    key = Swi_disable();
+
+    for (i = 0; i < TONE_MAX; i++) {
+        if (tones[i].active && tones[i].pin == _pin) {
+            t = &tones[i];
+        }
+        if (tones[i].active && !tones[i].hardware) {
+            software = &tones[i];
+        }
+    }
+    if (t == NULL) {
+        for (i = 0; i < TONE_MAX && tones[i].active; i++) {
+            ;
+        }
+        if (i == TONE_MAX) {
+            Swi_restore(key);
+            return;
+        }
+        t = &tones[i];
+    }
+    else if (!t->hardware || frequency == 0) {
+        /* restart this pin's software tone, maybe on a timer now */
+        if (!t->hardware) {
+            software = NULL;
+        }
+        toneStop(t);
+    }
+
+    t->pin = _pin;
+    t->timed = (duration != 0);
+    t->end = Clock_getTicks() + duration * 1000 / Clock_tickPeriod + 1;
+
+    if (frequency != 0 && timerToneBegin(_pin, frequency)) {
+        t->hardware = true;
+        t->active = true;
+        toneArm();
+        Swi_restore(key);
         return;
     }
 
-    playing = true;
-    toneDuration = duration;
+    if (t->active) {
+        /* timer tone that could not be retuned, already stopped */
+        t->active = false;
+    }
 
-    togglePin = true;
+    /* one software tone at a time */
+    if (software != NULL) {
+        Swi_restore(key);
+        return;
+    }
 
+    togglePin = true;
     if (frequency == 0) {
         togglePin = false;
         frequency = 1000;
     }
 
-    if (_pin != tonePin) {
-        pinMode(tonePin, OUTPUT);
-        tonePin = _pin;
-    }
+    toneOut = fastPin(_pin);
+    toneOut.low();
 
-    if (initTimer) {
-        Error_Block eb;
-        Error_init(&eb);
-        Timer_Params_init(&timerParams);
-        timerParams.period = (1000000L / frequency) / 2;
-        timerParams.runMode = Timer_RunMode_CONTINUOUS;
-        timerHandle = Timer_create(toneTimerId, ToneIntHandler, &timerParams, &eb);
-        initTimer = false;
+    /* on the shared microsecond timer service, no Timer_A of its own */
+    halfPeriod = (1000000L / frequency) / 2;
+    if (microTimerStart(&toneTimer, ToneIntHandler, 0, halfPeriod,
+        halfPeriod)) {
+        t->hardware = false;
+        t->active = true;
+        toneArm();
     }
 
-    Timer_stop(timerHandle);
-    Timer_setPeriodMicroSecs(timerHandle, (1000000L / frequency) / 2);
-    Timer_start(timerHandle);
-
-    mark = millis();
+    Swi_restore(key);
 }
 
 void noTone(uint8_t _pin)
 {
-    if (!initTimer) {
-        Timer_stop(timerHandle);
-        digitalWrite(tonePin, LOW);
-        playing = false;
+    UInt key;
+    uint8_t i;
+
+    key = Swi_disable();
+
+    for (i = 0; i < TONE_MAX; i++) {
+        if (tones[i].active && tones[i].pin == _pin) {
+            toneStop(&tones[i]);
+            toneArm();
+        }
     }
+
+    Swi_restore(key);
 }
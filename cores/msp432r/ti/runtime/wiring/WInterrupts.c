@@ -32,7 +32,80 @@
 
 #include "Energia.h"
 #include <ti/sysbios/family/arm/m3/Hwi.h>
+#include <ti/sysbios/knl/Event.h>
+#include <ti/sysbios/knl/Swi.h>
 #include <ti/drivers/GPIO.h>
+#include <xdc/runtime/Timestamp.h>
+
+#include <driverlib/interrupt.h>
+
+#define NUM_PINS (sizeof(digital_pin_to_port_pin) / sizeof(digital_pin_to_port_pin[0]))
+
+/* ports 1-6 have interrupts */
+#define NUM_INTERRUPT_PORTS 6
+
+/* PxIES/PxIE/PxIFG offsets, next to FAST_PIN_IN etc. */
+#define PORT_IES    0x18
+#define PORT_IE     0x1A
+#define PORT_IFG    0x1C
+
+typedef void (*InterruptArgFxn)(void *arg);
+
+/* the driver's port Hwi, wrapped by directPortHwi() */
+extern void GPIO_hwiIntFxn(uintptr_t portIndex);
+
+/* attachInterruptArg() handlers, by pin, and when they last ran */
+static struct {
+    InterruptArgFxn fxn;
+    void *arg;
+    volatile uint32_t time;
+} pinHandlers[NUM_PINS];
+
+/* what attachInterruptSemaphore() etc. post for each pin */
+typedef struct Deferral {
+    void *handle;
+    UInt eventIds;
+} Deferral;
+
+static Deferral deferred[NUM_PINS];
+
+/*
+ * attachInterruptDirect() handler of each port; the flag and edge
+ * select bits are bit-band aliases so the Hwi updates them with one
+ * store each.
+ */
+typedef struct DirectPort {
+    InterruptArgFxn fxn;
+    void *arg;
+    uint8_t pin;
+    volatile uint32_t *ifg;
+    volatile uint32_t *ies;     /* NULL unless emulating CHANGE */
+    volatile uint32_t *in;
+} DirectPort;
+
+static DirectPort directPorts[NUM_INTERRUPT_PORTS];
+
+/* edge log ring, see wiring_edgelog.h */
+static struct {
+    EdgeLogRecord *ring;
+    uint32_t mask;
+    volatile uint32_t head;     /* written only by edgeLogHwi() */
+    volatile uint32_t tail;     /* written only by edgeLogRead() */
+    volatile uint32_t dropped;
+} edgeLog;
+
+/* the logged pins of each port, by bit */
+typedef struct EdgeLogPort {
+    uint8_t mask;
+    uint8_t change;             /* logged on both edges */
+    uint8_t enabled;            /* interrupts edgeLogPin() turned on */
+    uint8_t pins[8];
+} EdgeLogPort;
+
+static EdgeLogPort edgeLogPorts[NUM_INTERRUPT_PORTS];
+
+static void directPortHwi(UArg portIndex);
+static void edgeLogHwi(UArg portIndex);
 
 void interrupts(void)
 {
@@ -44,36 +117,279 @@ void noInterrupts(void)
     Hwi_disable();
 }
 
-void attachInterrupt(uint8_t pin, void (*userFunc)(void), int mode)
+static GPIO_PinConfig modeToIntType(int mode)
 {
-    GPIO_PinConfig intType;
-
     switch(mode) {
         case LOW:
-            intType = GPIO_CFG_IN_INT_LOW;
-            break;
+            return (GPIO_CFG_IN_INT_LOW);
         case CHANGE:
-            intType = GPIO_CFG_IN_INT_BOTH_EDGES;
-            break;
+            return (GPIO_CFG_IN_INT_BOTH_EDGES);
         case RISING:
-            intType = GPIO_CFG_IN_INT_RISING;
-            break;
+            return (GPIO_CFG_IN_INT_RISING);
         case FALLING:
-            intType = GPIO_CFG_IN_INT_FALLING;
-            break;
+            return (GPIO_CFG_IN_INT_FALLING);
         case HIGH:
-            intType = GPIO_CFG_IN_INT_HIGH;
-            break;
+            return (GPIO_CFG_IN_INT_HIGH);
     }
 
-    GPIO_setConfig(pin, GPIO_CFG_IN_INT_ONLY | intType);
+    return (GPIO_CFG_IN_INT_NONE);
+}
+
+void attachInterrupt(uint8_t pin, void (*userFunc)(void), int mode)
+{
+    GPIO_setConfig(pin, GPIO_CFG_IN_INT_ONLY | modeToIntType(mode));
 
     GPIO_setCallback(pin, (GPIO_CallbackFxn)userFunc);
 
     GPIO_enableInt(pin);
 }
 
+/*
+ *  ======== argDispatch ========
+ *  GPIO driver callback for attachInterruptArg(); the driver passes
+ *  the pin index, which is our pin number.
+ */
+static void argDispatch(uint_least8_t pin)
+{
+    pinHandlers[pin].time = Timestamp_get32();
+    pinHandlers[pin].fxn(pinHandlers[pin].arg);
+}
+
+/*
+ *  ======== attachInterruptArg ========
+ *  attachInterrupt() for handlers that take a context pointer, so one
+ *  function can serve several pins or object instances.
+ */
+void attachInterruptArg(uint8_t pin, void (*userFunc)(void *), void *arg,
+    int mode)
+{
+    uintptr_t key;
+
+    if (pin >= NUM_PINS) {
+        return;
+    }
+
+    key = Hwi_disable();
+    pinHandlers[pin].fxn = userFunc;
+    pinHandlers[pin].arg = arg;
+    Hwi_restore(key);
+
+    GPIO_setConfig(pin, GPIO_CFG_IN_INT_ONLY | modeToIntType(mode));
+
+    GPIO_setCallback(pin, argDispatch);
+
+    GPIO_enableInt(pin);
+}
+
+/*
+ *  ======== directPortHwi ========
+ *  Replaces the driver's port Hwi while the port has a direct pin: that
+ *  pin's handler runs without the driver's scan of the port flags and
+ *  callback table lookup. Any other pending pin of the port is still
+ *  handed to the driver.
+ */
+static RAMFUNC void directPortHwi(UArg portIndex)
+{
+    DirectPort *dp = &directPorts[portIndex];
+    volatile uint8_t *regs = fastPortReg(portIndex + 1, 0);
+
+    if (*dp->ifg) {
+        pinHandlers[dp->pin].time = Timestamp_get32();
+
+        /* CHANGE: wait for the opposite of the level just reached */
+        if (dp->ies != NULL) {
+            *dp->ies = *dp->in;
+        }
+        *dp->ifg = 0;
+        dp->fxn(dp->arg);
+    }
+
+    if (regs[PORT_IFG] & regs[PORT_IE]) {
+        GPIO_hwiIntFxn(portIndex);
+    }
+}
+
+/*
+ *  ======== setPortHwi ========
+ *  Point the port's Hwi at the edge logger, the direct handler or the
+ *  driver, in that order; each chains to the next. Interrupts must be
+ *  disabled.
+ */
+static void setPortHwi(uint32_t portIndex)
+{
+    Hwi_Handle hwi = Hwi_getHandle(INT_PORT1 + portIndex);
+    Hwi_FuncPtr fxn = (Hwi_FuncPtr)GPIO_hwiIntFxn;
+
+    /* not created until the driver's first interrupt config on the port */
+    if (hwi == NULL) {
+        return;
+    }
+
+    if (edgeLogPorts[portIndex].mask != 0) {
+        fxn = edgeLogHwi;
+    }
+    else if (directPorts[portIndex].fxn != NULL) {
+        fxn = directPortHwi;
+    }
+
+    Hwi_setFunc(hwi, fxn, (UArg)portIndex);
+}
+
+/*
+ *  ======== attachInterruptDirect ========
+ *  attachInterruptArg() with the pin's port Hwi dispatching straight
+ *  to userFunc, for high rate inputs such as encoders. One direct pin
+ *  per port (ports 1-6); CHANGE is supported by flipping the edge in
+ *  the Hwi. Returns false if the pin has no interrupt or its port
+ *  already has a direct pin.
+ */
+bool attachInterruptDirect(uint8_t pin, void (*userFunc)(void *), void *arg,
+    int mode)
+{
+    uint16_t portPin;
+    uint32_t portIndex;
+    DirectPort *dp;
+    uintptr_t key;
+
+    if (pin >= NUM_PINS) {
+        return (false);
+    }
+
+    portPin = digital_pin_to_port_pin[pin];
+    portIndex = (portPin >> 8) - 1;
+    if ((portPin >> 8) == 0 || portIndex >= NUM_INTERRUPT_PORTS) {
+        return (false);
+    }
+
+    dp = &directPorts[portIndex];
+    if (dp->fxn != NULL && dp->pin != pin) {
+        return (false);
+    }
+
+    /* the driver configures the pin and creates the port's Hwi */
+    attachInterruptArg(pin, userFunc, arg, mode);
+
+    key = Hwi_disable();
+
+    dp->fxn = userFunc;
+    dp->arg = arg;
+    dp->pin = pin;
+    dp->ifg = fastPinAlias(portPin, PORT_IFG);
+    dp->in = fastPinAlias(portPin, FAST_PIN_IN);
+    dp->ies = NULL;
+    if (mode == CHANGE) {
+        dp->ies = fastPinAlias(portPin, PORT_IES);
+        *dp->ies = *dp->in;
+        *dp->ifg = 0;
+    }
+
+    setPortHwi(portIndex);
+
+    Hwi_restore(key);
+
+    return (true);
+}
+
+/*
+ *  ======== deferral handlers ========
+ *  attachInterruptArg() handlers for the task deferral variants; arg
+ *  is the pin's deferred[] entry.
+ */
+static void postSemaphore(void *arg)
+{
+    Semaphore_post((Semaphore_Handle)((Deferral *)arg)->handle);
+}
+
+static void postEvent(void *arg)
+{
+    Deferral *d = (Deferral *)arg;
+
+    Event_post((Event_Handle)d->handle, d->eventIds);
+}
+
+static void postSwi(void *arg)
+{
+    Swi_post((Swi_Handle)((Deferral *)arg)->handle);
+}
+
+static void attachDeferred(uint8_t pin, InterruptArgFxn fxn, void *handle,
+    UInt eventIds, int mode)
+{
+    if (pin >= NUM_PINS) {
+        return;
+    }
+
+    deferred[pin].handle = handle;
+    deferred[pin].eventIds = eventIds;
+
+    attachInterruptArg(pin, fxn, &deferred[pin], mode);
+}
+
+/*
+ *  ======== attachInterruptSemaphore ========
+ *  On each edge, post sem from the Hwi; a task pending on it then does
+ *  the work at task priority. interruptTime() has the time of the edge.
+ */
+void attachInterruptSemaphore(uint8_t pin, Semaphore_Handle sem, int mode)
+{
+    attachDeferred(pin, postSemaphore, sem, 0, mode);
+}
+
+/*
+ *  ======== attachInterruptEvent ========
+ *  On each edge, post eventIds to event, e.g. one bit per pin for a
+ *  task waiting on several inputs with Event_pend().
+ */
+void attachInterruptEvent(uint8_t pin, Event_Handle event, UInt eventIds,
+    int mode)
+{
+    attachDeferred(pin, postEvent, event, eventIds, mode);
+}
+
+/*
+ *  ======== attachInterruptSwi ========
+ *  On each edge, post swi; edges arriving before it runs are merged.
+ */
+void attachInterruptSwi(uint8_t pin, Swi_Handle swi, int mode)
+{
+    attachDeferred(pin, postSwi, swi, 0, mode);
+}
+
+/*
+ *  ======== interruptTime ========
+ *  Timestamp_get32() at the pin's last interrupt, taken in the Hwi
+ *  just before its handler or post; for the attachInterruptArg(),
+ *  attachInterruptDirect() and deferral variants.
+ */
+uint32_t interruptTime(uint8_t pin)
+{
+    if (pin >= NUM_PINS) {
+        return (0);
+    }
+
+    return (pinHandlers[pin].time);
+}
+
 void detachInterrupt(uint8_t pin) {
+    uint16_t portPin;
+    uint32_t portIndex;
+    uintptr_t key;
+
+    if (pin < NUM_PINS) {
+        portPin = digital_pin_to_port_pin[pin];
+        portIndex = (portPin >> 8) - 1;
+
+        key = Hwi_disable();
+        if ((portPin >> 8) != 0 && portIndex < NUM_INTERRUPT_PORTS
+            && directPorts[portIndex].fxn != NULL
+            && directPorts[portIndex].pin == pin) {
+            directPorts[portIndex].fxn = NULL;
+            setPortHwi(portIndex);
+        }
+        pinHandlers[pin].fxn = NULL;
+        Hwi_restore(key);
+    }
+
     GPIO_setCallback(pin, NULL);
 }
 
@@ -85,3 +401,200 @@ void enablePinInterrupt(uint8_t pin) {
     GPIO_enableInt(pin);
 }
 
+/*
+ *  ======== edgeLogHwi ========
+ *  Port Hwi while the port has logged pins: one record per pending
+ *  logged pin, all with the same time, then on to the direct handler
+ *  or the driver, which clear the flags.
+ */
+static RAMFUNC void edgeLogHwi(UArg portIndex)
+{
+    EdgeLogPort *lp = &edgeLogPorts[portIndex];
+    volatile uint8_t *regs = fastPortReg(portIndex + 1, 0);
+    uint32_t now = Timestamp_get32();
+    uint8_t pending = regs[PORT_IFG] & regs[PORT_IE] & lp->mask;
+    uint8_t in = regs[FAST_PIN_IN];
+    uint8_t change = pending & lp->change;
+    uint32_t head = edgeLog.head;
+    EdgeLogRecord *r;
+    unsigned int bit;
+
+    /* CHANGE: wait for the opposite of the level just reached */
+    if (change) {
+        regs[PORT_IES] = (regs[PORT_IES] & ~change) | (in & change);
+    }
+
+    while (pending) {
+        bit = __builtin_ctz(pending);
+        pending &= pending - 1;
+
+        if (head - edgeLog.tail > edgeLog.mask) {
+            edgeLog.dropped++;
+            continue;
+        }
+
+        r = &edgeLog.ring[head & edgeLog.mask];
+        r->time = now;
+        r->pin = lp->pins[bit];
+        r->level = (in >> bit) & 1;
+        head++;
+    }
+
+    /* publish the records before the index */
+    __asm volatile ("" ::: "memory");
+    edgeLog.head = head;
+
+    if (directPorts[portIndex].fxn != NULL) {
+        directPortHwi(portIndex);
+    }
+    else {
+        GPIO_hwiIntFxn(portIndex);
+    }
+}
+
+/*
+ *  ======== edgeLogBegin ========
+ *  Start (or restart, emptied) logging into ring; count must be a
+ *  power of 2.
+ */
+bool edgeLogBegin(EdgeLogRecord *ring, unsigned int count)
+{
+    uintptr_t key;
+
+    if (ring == NULL || count < 2 || (count & (count - 1)) != 0) {
+        return (false);
+    }
+
+    key = Hwi_disable();
+    edgeLog.ring = ring;
+    edgeLog.mask = count - 1;
+    edgeLog.head = 0;
+    edgeLog.tail = 0;
+    edgeLog.dropped = 0;
+    Hwi_restore(key);
+
+    return (true);
+}
+
+/*
+ *  ======== edgeLogPin ========
+ *  Log pin's RISING, FALLING or CHANGE edges. The pin must be an input
+ *  on ports 1-6; an interrupt handler attached to it keeps running.
+ */
+bool edgeLogPin(uint8_t pin, int mode)
+{
+    uint16_t portPin;
+    uint32_t portIndex;
+    uint8_t bitMask;
+    EdgeLogPort *lp;
+    uintptr_t key;
+    bool enabled;
+
+    if (edgeLog.ring == NULL || pin >= NUM_PINS) {
+        return (false);
+    }
+
+    portPin = digital_pin_to_port_pin[pin];
+    portIndex = (portPin >> 8) - 1;
+    if ((portPin >> 8) == 0 || portIndex >= NUM_INTERRUPT_PORTS) {
+        return (false);
+    }
+
+    lp = &edgeLogPorts[portIndex];
+    bitMask = portPin & 0xff;
+    enabled = (*fastPortReg(portIndex + 1, PORT_IE) & bitMask) != 0;
+
+    /* the driver sets the edge and creates the port's Hwi */
+    GPIO_setConfig(pin, GPIO_CFG_IN_INT_ONLY | modeToIntType(mode));
+
+    key = Hwi_disable();
+
+    lp->pins[__builtin_ctz(bitMask)] = pin;
+    lp->mask |= bitMask;
+    lp->change &= ~bitMask;
+    if (mode == CHANGE) {
+        lp->change |= bitMask;
+        *fastPinAlias(portPin, PORT_IES) = *fastPinAlias(portPin, FAST_PIN_IN);
+        *fastPinAlias(portPin, PORT_IFG) = 0;
+    }
+    if (!enabled) {
+        lp->enabled |= bitMask;
+    }
+
+    setPortHwi(portIndex);
+
+    Hwi_restore(key);
+
+    GPIO_enableInt(pin);
+
+    return (true);
+}
+
+/*
+ *  ======== edgeLogEnd ========
+ *  Stop logging; interrupts that only edgeLogPin() enabled are turned
+ *  off again. Records still queued can be read until edgeLogBegin().
+ */
+void edgeLogEnd(void)
+{
+    EdgeLogPort *lp;
+    uint32_t portIndex;
+    uintptr_t key;
+
+    key = Hwi_disable();
+
+    for (portIndex = 0; portIndex < NUM_INTERRUPT_PORTS; portIndex++) {
+        lp = &edgeLogPorts[portIndex];
+        if (lp->mask == 0) {
+            continue;
+        }
+
+        *fastPortReg(portIndex + 1, PORT_IE) &= ~lp->enabled;
+        lp->mask = 0;
+        lp->change = 0;
+        lp->enabled = 0;
+        setPortHwi(portIndex);
+    }
+
+    Hwi_restore(key);
+}
+
+/*
+ *  ======== edgeLogAvailable ========
+ */
+unsigned int edgeLogAvailable(void)
+{
+    return (edgeLog.head - edgeLog.tail);
+}
+
+/*
+ *  ======== edgeLogRead ========
+ *  Copy out up to max of the oldest records; the consumer side, call
+ *  from one task only.
+ */
+unsigned int edgeLogRead(EdgeLogRecord *records, unsigned int max)
+{
+    uint32_t tail = edgeLog.tail;
+    uint32_t head = edgeLog.head;
+    unsigned int n = 0;
+
+    while (n < max && tail != head) {
+        records[n++] = edgeLog.ring[tail & edgeLog.mask];
+        tail++;
+    }
+
+    /* done with the slots before handing them back */
+    __asm volatile ("" ::: "memory");
+    edgeLog.tail = tail;
+
+    return (n);
+}
+
+/*
+ *  ======== edgeLogDropped ========
+ *  Edges lost to a full ring since edgeLogBegin().
+ */
+uint32_t edgeLogDropped(void)
+{
+    return (edgeLog.dropped);
+}
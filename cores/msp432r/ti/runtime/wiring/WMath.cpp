@@ -23,44 +23,117 @@
   $Id$
  */
 
-extern "C" {
-#include "stdlib.h"
+#include "wiring_fixed.h"
+#include "wiring_random.h"
+
+#include <ti/sysbios/hal/Hwi.h>
+
+/* PCG32's own default state, the sequence before any randomSeed() */
+static Rng randomState = { 0x853c49e6748fea9bULL };
+
+void randomSeed(unsigned int seed)
+{
+    uint32_t hwiKey;
+
+    if (seed != 0) {
+        hwiKey = Hwi_disable();
+        rngSeed(&randomState, seed);
+        Hwi_restore(hwiKey);
+    }
+}
+
 /*
- * Using internal random and srandom in file random.c
- * until msp430-libc adds supports for random and srandom
+ * rngBelow() on the shared state. Only each step is done with
+ * interrupts disabled, the multiply and the rare rejection are not.
  */
-extern long random(void);
-extern void srandom(unsigned __seed);
+static uint32_t randomNext(void)
+{
+    uint32_t hwiKey = Hwi_disable();
+    uint32_t r = rngNext(&randomState);
+
+    Hwi_restore(hwiKey);
+
+    return (r);
 }
 
-void randomSeed(unsigned int seed)
+static uint32_t randomBelow(uint32_t bound)
 {
-    if (seed != 0) {
-        srandom(seed);
+    uint64_t m = (uint64_t)randomNext() * bound;
+    uint32_t threshold;
+
+    if ((uint32_t)m < bound) {
+        threshold = -bound % bound;
+        while ((uint32_t)m < threshold) {
+            m = (uint64_t)randomNext() * bound;
+        }
     }
+
+    return ((uint32_t)(m >> 32));
 }
 
 long random(long howbig)
 {
-    if (howbig == 0) {
+    if (howbig <= 0) {
         return (0);
     }
-    return (random() % howbig);
+
+    return ((long)randomBelow((uint32_t)howbig));
 }
 
+/* the difference may not fit a long, it does fit 32 bits unsigned */
 long random(long howsmall, long howbig)
 {
     if (howsmall >= howbig) {
         return (howsmall);
     }
-    long diff = howbig - howsmall;
-    return (random(diff) + howsmall);
-}
 
+    return ((long)((uint32_t)howsmall +
+        randomBelow((uint32_t)howbig - (uint32_t)howsmall)));
+}
 
+/*
+ * The product is formed in 64 bits only when it would overflow 32,
+ * which keeps the common case to one 32 bit divide
+ */
 long map(long x, long in_min, long in_max, long out_min, long out_max)
 {
-    return ((x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min);
+    long product;
+
+    if (__builtin_mul_overflow(x - in_min, out_max - out_min, &product)) {
+        return ((long)(((int64_t)x - in_min) * ((int64_t)out_max - out_min) /
+            ((int64_t)in_max - in_min) + out_min));
+    }
+
+    return (product / (in_max - in_min) + out_min);
+}
+
+/*
+ * The slope is kept below 2^30 at the finest shift that allows, so
+ * mapFast()'s product stays within 64 bits for any long input
+ */
+void mapFastInit(MapFast *m, long in_min, long in_max, long out_min,
+    long out_max)
+{
+    int64_t range = (int64_t)out_max - out_min;
+    int64_t domain = (int64_t)in_max - in_min;
+    int64_t slope = 0;
+    uint8_t shift = 30;
+
+    if (domain != 0) {
+        for (;;) {
+            slope = range * ((int64_t)1 << shift) / domain;
+            if ((slope < (1LL << 30) && slope > -(1LL << 30)) || shift == 0) {
+                break;
+            }
+            shift--;
+        }
+    }
+
+    m->inMin = in_min;
+    m->outMin = out_min;
+    m->slope = (int32_t)(slope > INT32_MAX ? INT32_MAX :
+        slope < -INT32_MAX ? -INT32_MAX : slope);
+    m->shift = shift;
 }
 
 unsigned int makeWord(unsigned int w) { return w; }
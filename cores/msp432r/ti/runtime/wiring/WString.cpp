@@ -21,6 +21,7 @@
 
 #include "WString.h"
 #include "itoa.h"
+#include "Arena.h"
 
 /* double-precision floating point operations were moved to StringD.cpp */
 
@@ -110,16 +111,23 @@ String::String(unsigned long value, unsigned char base)
 
 String::~String()
 {
-	free(buffer);
+	if (!isInline()) freeBuffer(buffer);
 }
 
 /*********************************************/
 /*  Memory Management                        */
 /*********************************************/
 
+// heap buffers come from the calling task's open Arena, if any; buffers
+// in an arena are only released when its scope ends
+void String::freeBuffer(char *buf)
+{
+	if (buf && !Arena::owner(buf)) free(buf);
+}
+
 void String::invalidate(void)
 {
-	if (buffer) free(buffer);
+	if (buffer && !isInline()) freeBuffer(buffer);
 	buffer = NULL;
 	capacity = len = 0;
 }
@@ -136,7 +144,41 @@ unsigned char String::reserve(unsigned int size)
 
 unsigned char String::changeBuffer(unsigned int maxStrLen)
 {
-	char *newbuffer = (char *)realloc(buffer, maxStrLen + 1);
+	if (maxStrLen <= STRING_INLINE_LEN && (!buffer || isInline())) {
+		buffer = sbuf;
+		capacity = STRING_INLINE_LEN;
+		return 1;
+	}
+
+	// a string that is growing likely grows again: take half again
+	// the current capacity, unless that doesn't fit in the heap
+	unsigned int grown = capacity + capacity / 2;
+	if (len > 0 && grown > maxStrLen && changeBuffer(grown, len)) return 1;
+
+	return changeBuffer(maxStrLen, len);
+}
+
+unsigned char String::changeBuffer(unsigned int maxStrLen, unsigned int keep)
+{
+	char *newbuffer = NULL;
+	Arena *owner = buffer && !isInline() ? Arena::owner(buffer) : NULL;
+	bool onHeap = buffer && !isInline() && !owner;
+	Arena *arena;
+
+	if (owner) {
+		newbuffer = (char *)owner->resize(buffer, keep + 1, maxStrLen + 1);
+	} else if (!onHeap && (arena = Arena::current()) != NULL) {
+		newbuffer = (char *)arena->alloc(maxStrLen + 1);
+		if (newbuffer && buffer) memcpy(newbuffer, sbuf, keep + 1);
+	}
+	if (!newbuffer) {
+		if (onHeap) {
+			newbuffer = (char *)realloc(buffer, maxStrLen + 1);
+		} else {
+			newbuffer = (char *)malloc(maxStrLen + 1);
+			if (newbuffer && buffer) memcpy(newbuffer, buffer, keep + 1);
+		}
+	}
 	if (newbuffer) {
 		buffer = newbuffer;
 		capacity = maxStrLen;
@@ -174,16 +216,18 @@ String & String::copy(const __FlashStringHelper *pstr, unsigned int length)
 #ifdef __GXX_EXPERIMENTAL_CXX0X__
 void String::move(String &rhs)
 {
-	if (buffer) {
-		if (capacity >= rhs.len) {
-			strcpy(buffer, rhs.buffer);
-			len = rhs.len;
-			rhs.len = 0;
-			return;
-		} else {
-			free(buffer);
-		}
+	if (!rhs.buffer) {
+		invalidate();
+		return;
+	}
+	if (rhs.isInline()) {
+		// short strings have nothing to steal, copy them
+		copy(rhs.buffer, rhs.len);
+		rhs.len = 0;
+		rhs.buffer[0] = 0;
+		return;
 	}
+	if (buffer && !isInline()) freeBuffer(buffer);
 	buffer = rhs.buffer;
 	capacity = rhs.capacity;
 	len = rhs.len;
@@ -247,8 +291,16 @@ unsigned char String::concat(const char *cstr, unsigned int length)
 	unsigned int newlen = len + length;
 	if (!cstr) return 0;
 	if (length == 0) return 1;
-	if (!reserve(newlen)) return 0;
-	strcpy(buffer + len, cstr);
+	if (buffer && cstr >= buffer && cstr <= buffer + len) {
+		// appending (part of) itself: the buffer may move in reserve()
+		unsigned int offset = cstr - buffer;
+		if (!reserve(newlen)) return 0;
+		cstr = buffer + offset;
+	} else if (!reserve(newlen)) {
+		return 0;
+	}
+	memcpy(buffer + len, cstr, length);
+	buffer[newlen] = 0;
 	len = newlen;
 	return 1;
 }
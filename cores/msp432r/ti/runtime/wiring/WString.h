@@ -35,6 +35,11 @@
 //     -felide-constructors
 //     -std=c++0x
 
+// Strings of up to STRING_INLINE_LEN chars are held in the String object
+// itself, longer ones on the heap.  Heap buffers grow by half again as
+// they fill, so appending a char at a time doesn't realloc() every time.
+#define STRING_INLINE_LEN 11
+
 class __FlashStringHelper;
 #define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(PSTR(string_literal)))
 
@@ -192,6 +197,7 @@ protected:
 	char *buffer;	        // the actual char array
 	unsigned int capacity;  // the array length minus one (for the '\0')
 	unsigned int len;       // the String length (not counting the '\0')
+	char sbuf[STRING_INLINE_LEN + 1];  // buffer of short strings
 protected:
 	inline void init(void) {
             buffer = NULL;
@@ -199,8 +205,11 @@ protected:
 	    len = 0;
         }
         
-	void invalidate(void);
+        void invalidate(void);
+	static void freeBuffer(char *buf);
+	inline bool isInline(void) const {return buffer == sbuf;}
 	unsigned char changeBuffer(unsigned int maxStrLen);
+	unsigned char changeBuffer(unsigned int maxStrLen, unsigned int keep);
 	unsigned char concat(const char *cstr, unsigned int length);
 
 	// copy and move
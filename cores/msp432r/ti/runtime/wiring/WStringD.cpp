@@ -38,7 +38,7 @@ String::String(float value, unsigned char decimalPlaces)
 {
 	init();
 	char buf[33];
-	*this = dtostrf(value, (decimalPlaces + 2), decimalPlaces, buf);
+	*this = dtostrff(value, (decimalPlaces + 2), decimalPlaces, buf);
 }
 
 String::String(double value, unsigned char decimalPlaces)
@@ -55,7 +55,7 @@ String::String(double value, unsigned char decimalPlaces)
 unsigned char String::concat(float num)
 {
 	char buf[20];
-	char* string = dtostrf(num, 4, 2, buf);
+	char* string = dtostrff(num, 4, 2, buf);
 	return concat(string, strlen(string));
 }
 
@@ -36,21 +36,73 @@
 #include "Wire.h"
 
 #include <xdc/runtime/Memory.h>
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
 
+#include <ti/drivers/Power.h>
+#include <ti/drivers/power/PowerMSP432.h>
+#include <ti/drivers/i2c/I2CMSP432.h>
+#include <ti/drivers/i2cslave/I2CSlaveMSP432.h>
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Clock.h>
 #include <ti/sysbios/knl/Task.h>
+#include <ti/sysbios/family/arm/m3/Hwi.h>
 
+#include <driverlib/rom.h>
+#include <driverlib/rom_map.h>
+#include <driverlib/dma.h>
+#include <driverlib/gpio.h>
+#include <driverlib/i2c.h>
 
-#define TX_BUFFER_EMPTY    (wc->txReadIndex == wc->txWriteIndex)
-#define TX_BUFFER_FULL     (((wc->txWriteIndex + 1) % BUFFER_LENGTH) == wc->txReadIndex)
 
-#define RX_BUFFER_EMPTY    (wc->rxReadIndex == wc->rxWriteIndex)
-#define RX_BUFFER_FULL     (((wc->rxWriteIndex + 1) % BUFFER_LENGTH) == wc->rxReadIndex)
+/*
+ * The buffers are linear, not rings: I2C_transfer() needs the write
+ * data and read space contiguous from index 0, and both are rewound
+ * at the end of every transfer.
+ */
+#define TX_BUFFER_FULL     (wc->txWriteIndex >= wc->txSize)
+
+#define RX_BUFFER_EMPTY    (wc->rxReadIndex >= wc->rxWriteIndex)
+
+/* longest transfers the uDMA path takes: one basic uDMA transfer and
+ * the 8 bit byte counter that generates the STOP after a read */
+#define DMA_MAX_WRITE   1024
+#define DMA_MAX_READ    255
+
+/* uDMA triggers of each eUSCI_B module */
+static const struct {
+    uint32_t baseAddr;
+    uint32_t txChannel;
+    uint32_t rxChannel;
+} i2cDmaChannels[] = {
+    {EUSCI_B0_BASE, DMA_CH0_EUSCIB0TX0, DMA_CH1_EUSCIB0RX0},
+    {EUSCI_B1_BASE, DMA_CH2_EUSCIB1TX0, DMA_CH3_EUSCIB1RX0},
+    {EUSCI_B2_BASE, DMA_CH4_EUSCIB2TX0, DMA_CH5_EUSCIB2RX0},
+    {EUSCI_B3_BASE, DMA_CH6_EUSCIB3TX0, DMA_CH7_EUSCIB3RX0},
+};
+
+/* ports that can be open in slave mode, see slavePorts[] */
+#define WIRE_MAX_PORTS  4
 
 #define RUN_BIT     0x1
 #define START_BIT   0x2
 #define STOP_BIT    0x4
 #define ACK_BIT     0x8
 
+extern "C" {
+extern const I2C_Config I2C_config[];
+/* the driver's Hwi, wrapped by wireMasterHwiFxn() */
+extern void I2CMSP432_hwiIntFxn(uintptr_t arg);
+extern const I2CSlave_Config I2CSlave_config[];
+/* the driver's Hwi, wrapped by wireSlaveHwiFxn() */
+extern void I2CSlaveMSP432_hwiIntFxn(uintptr_t arg);
+}
+
+/* TwoWire instance on each I2C_config[] and I2CSlave_config[] entry */
+static TwoWire *masterPorts[WIRE_MAX_PORTS];
+static TwoWire *slavePorts[WIRE_MAX_PORTS];
+
 TwoWire::TwoWire()
 {
     init(0);
@@ -68,40 +120,892 @@ void TwoWire::init(unsigned long module)
 {
     i2cModule = module;
     begun = FALSE;
+    asyncPending = 0;
+    clockHz = WIRE_CLOCK_DEFAULT;
+    minDmaTransferSize = WIRE_MIN_DMA_TRANSFER_SIZE;
+    dmaHandle = NULL;
+    transferTimeout = WIRE_TRANSFER_TIMEOUT;
+    resetStats();
+    slaveMode = false;
+    slave = NULL;
+    user_onReceive = NULL;
+    user_onRequest = NULL;
+    defaultContext.owner = NULL;
+    lastContext = NULL;
 }
 
-WireContext *TwoWire::getWireContext(void)
+/*
+ *  ======== initWireContext ========
+ */
+static void initWireContext(WireContext *wc, TwoWire *bus, Task_Handle owner,
+    bool allocated)
 {
-    WireContext *wc;
+    wc->idle = true;
 
-    wc = (WireContext *)Task_getEnv(Task_self());
+    wc->rxBuffer = wc->rxStorage;
+    wc->rxSize = BUFFER_LENGTH;
+    wc->txBuffer = wc->txStorage;
+    wc->txSize = BUFFER_LENGTH;
 
-    if (wc == NULL) {
-        wc = (WireContext *)Memory_alloc(NULL, sizeof(WireContext), 4, NULL);
+    wc->rxReadIndex = 0;
+    wc->rxWriteIndex = 0;
+    wc->txReadIndex = 0;
+    wc->txWriteIndex = 0;
 
-        wc->idle = true;
+    /* I2C Transfer initial params */
+    wc->i2cTransaction.slaveAddress = 0;
+    wc->i2cTransaction.writeBuf = wc->txBuffer;
+    wc->i2cTransaction.readBuf = wc->rxBuffer;
+    wc->i2cTransaction.readCount = 0;
+    wc->i2cTransaction.writeCount = 0;
 
-        wc->rxReadIndex = 0;
-        wc->rxWriteIndex = 0;
-        wc->txReadIndex = 0;
-        wc->txWriteIndex = 0;
+    wc->owner = owner;
+    wc->allocated = allocated;
+    wc->bus = bus;
+    wc->next = NULL;
+}
 
-        /* I2C Transfer initial params */
-        wc->i2cTransaction.slaveAddress = 0;
-        wc->i2cTransaction.writeBuf = wc->txBuffer;
-        wc->i2cTransaction.readBuf = wc->rxBuffer;
-        wc->i2cTransaction.readCount = 0;
-        wc->i2cTransaction.writeCount = 0;
+/*
+ *  ======== findContext ========
+ *  The task's context for this bus from the list kept in its task env,
+ *  NULL if there is none. Called with the scheduler disabled.
+ */
+WireContext *TwoWire::findContext(Task_Handle self)
+{
+    WireContext *wc = (WireContext *)Task_getEnv(self);
 
-        Task_setEnv(Task_self(), (void *)wc);
+    while (wc != NULL && wc->bus != this) {
+        wc = wc->next;
     }
 
     return (wc);
 }
 
-void TwoWire::forceStop(void)
+/*
+ *  ======== getWireContext ========
+ *  The calling task's context. The common case, the same task using
+ *  the bus again, is answered from lastContext without touching the
+ *  task env; owner never changes while a context is in use, so the
+ *  single pointer read needs no lock.
+ */
+WireContext *TwoWire::getWireContext(void)
+{
+    Task_Handle self;
+    WireContext *wc = lastContext;
+    unsigned int key;
+
+    /* slave callbacks run in Hwi context, there is no task to look up */
+    if (slaveMode) {
+        return (&defaultContext);
+    }
+
+    self = Task_self();
+
+    if (wc != NULL && wc->owner == self) {
+        return (wc);
+    }
+
+    key = Task_disable();
+
+    if (defaultContext.owner == self) {
+        wc = &defaultContext;
+    }
+    else {
+        /* a heap or setContext() context of the task for this bus */
+        wc = findContext(self);
+
+        if (wc == NULL && defaultContext.owner == NULL) {
+            initWireContext(&defaultContext, this, self, false);
+            wc = &defaultContext;
+        }
+        else if (wc == NULL) {
+            wc = (WireContext *)Memory_alloc(NULL, sizeof(WireContext), 4, NULL);
+            initWireContext(wc, this, self, true);
+            wc->next = (WireContext *)Task_getEnv(self);
+            Task_setEnv(self, (void *)wc);
+        }
+    }
+
+    lastContext = wc;
+
+    Task_restore(key);
+
+    return (wc);
+}
+
+/*
+ *  ======== wireTransferCallback ========
+ *  Hwi context. Every transaction's arg is the WireAsyncTransfer that
+ *  owns it, blocking ones included.
+ */
+static void wireTransferCallback(I2C_Handle handle,
+    I2C_Transaction *transaction, bool status)
+{
+    WireAsyncTransfer *xfer = (WireAsyncTransfer *)transaction->arg;
+
+    xfer->owner->transferCallback(transaction, status);
+}
+
+void TwoWire::transferCallback(I2C_Transaction *transaction, bool status)
+{
+    WireAsyncTransfer *xfer = (WireAsyncTransfer *)transaction->arg;
+
+    if (status) {
+        xfer->error = WIRE_SUCCESS;
+    }
+    else if (xfer->error == WIRE_SUCCESS) {
+        xfer->error = WIRE_OTHER_ERROR;
+    }
+    recordTransfer(transaction, xfer->error,
+        Timestamp_get32() - xfer->startTime);
+
+    xfer->status = status;
+    xfer->done = true;
+
+    if (xfer->queued) {
+        asyncPending--;
+
+        if (xfer->callback != NULL) {
+            xfer->callback(xfer);
+        }
+    }
+    if (xfer->sem != NULL) {
+        Semaphore_post(xfer->sem);
+    }
+}
+
+/*
+ *  ======== wireMasterHwiFxn ========
+ *  Replaces the driver's Hwi function: the driver clears the status
+ *  flags and only reports pass/fail, masterInterrupt() gets to look
+ *  at them first.
+ */
+static void wireMasterHwiFxn(UArg arg)
+{
+    I2C_Handle handle = (I2C_Handle)arg;
+
+    masterPorts[(I2C_Config const *)handle - I2C_config]->masterInterrupt();
+
+    I2CMSP432_hwiIntFxn((uintptr_t)arg);
+}
+
+/*
+ *  ======== masterInterrupt ========
+ *  Hwi context, ahead of the driver's handler. Note why the current
+ *  transfer is about to fail: a NACK before the byte counter has
+ *  counted a data byte is the address being refused.
+ */
+void TwoWire::masterInterrupt(void)
+{
+    I2CMSP432_Object *object = (I2CMSP432_Object *)i2c->object;
+    EUSCI_B_Type *regs = EUSCI_B_CMSIS(i2cBase);
+    uint16_t flags = regs->IFG & regs->IE;
+    WireAsyncTransfer *xfer;
+
+    if (object->currentTransaction == NULL
+        || !(flags & (EUSCI_B_IFG_NACKIFG | EUSCI_B_IFG_ALIFG))) {
+        return;
+    }
+
+    xfer = (WireAsyncTransfer *)object->currentTransaction->arg;
+    if (xfer == NULL || xfer->error != WIRE_SUCCESS) {
+        return;
+    }
+
+    if (flags & EUSCI_B_IFG_ALIFG) {
+        xfer->error = WIRE_OTHER_ERROR;
+    }
+    else if ((regs->STATW & EUSCI_B_STATW_BCNT_MASK) == 0) {
+        xfer->error = WIRE_NACK_ADDRESS;
+    }
+    else {
+        xfer->error = WIRE_NACK_DATA;
+    }
+}
+
+/*
+ *  ======== recordTransfer ========
+ *  Account for a finished transfer in stats; task or Hwi context.
+ */
+void TwoWire::recordTransfer(I2C_Transaction *transaction, uint8_t error,
+    uint32_t ticks)
+{
+    uintptr_t key;
+
+    traceEvent(TRACE_WIRE | TRACE_END, error,
+        transaction->writeCount + transaction->readCount);
+
+    key = Hwi_disable();
+
+    switch (error) {
+        case WIRE_SUCCESS:
+            stats.transfers++;
+            stats.bytes += transaction->writeCount + transaction->readCount;
+            break;
+        case WIRE_NACK_ADDRESS:
+        case WIRE_NACK_DATA:
+            stats.nacks++;
+            break;
+        case WIRE_TIMEOUT:
+            stats.timeouts++;
+            break;
+        default:
+            stats.errors++;
+            break;
+    }
+
+    if (ticks < minTicks) {
+        minTicks = ticks;
+    }
+    if (ticks > maxTicks) {
+        maxTicks = ticks;
+    }
+    totalTicks += ticks;
+
+    Hwi_restore(key);
+}
+
+/*
+ *  ======== transact ========
+ *  Blocking transfer on top of the callback mode driver; the caller
+ *  holds gate, so syncDone has a single waiter. Returns WIRE_SUCCESS
+ *  or why the transfer failed.
+ */
+uint8_t TwoWire::transact(I2C_Transaction *transaction)
+{
+    WireAsyncTransfer sync;
+    uint32_t txChannel, rxChannel;
+    uint32_t start;
+    uint8_t error;
+    uintptr_t key;
+    bool stuck;
+
+    traceEvent(TRACE_WIRE, transaction->slaveAddress,
+        transaction->writeCount + transaction->readCount);
+
+    if (useDma(transaction, &txChannel, &rxChannel)) {
+        start = Timestamp_get32();
+        error = dmaTransfer(transaction, txChannel, rxChannel);
+        dmaRelease(txChannel, rxChannel);
+        recordTransfer(transaction, error, Timestamp_get32() - start);
+        if (error == WIRE_TIMEOUT) {
+            recover();
+        }
+        return (error);
+    }
+
+    sync.owner = this;
+    sync.sem = Semaphore_handle(&syncDone);
+    sync.done = false;
+    sync.error = WIRE_SUCCESS;
+    sync.startTime = Timestamp_get32();
+    transaction->arg = &sync;
+
+    /* fails up front only for an empty transaction */
+    if (!I2C_transfer(i2c, transaction)) {
+        return (WIRE_OTHER_ERROR);
+    }
+
+    if (Semaphore_pend(sync.sem, transferTimeout == 0 ?
+        BIOS_WAIT_FOREVER : transferTimeout)) {
+        return (sync.error);
+    }
+
+    /* timed out, unless it completed just now */
+    key = Hwi_disable();
+    stuck = !sync.done;
+    if (stuck) {
+        sync.error = WIRE_TIMEOUT;
+    }
+    Hwi_restore(key);
+
+    if (stuck) {
+        recover();
+    }
+
+    /* the callback has posted by now, one way or the other */
+    Semaphore_pend(sync.sem, BIOS_WAIT_FOREVER);
+
+    return (sync.error);
+}
+
+/*
+ *  ======== recover ========
+ *  Called with gate held after a transfer timed out: fail everything
+ *  the driver has queued (their callbacks run from here), free the
+ *  bus and put back our clock setting, which the driver's re-init
+ *  replaced with its own.
+ */
+bool TwoWire::recover(void)
+{
+    bool released;
+
+    I2C_cancel(i2c);
+    released = forceStop();
+    configureClock(clockFreq(Power_getPerformanceLevel()));
+
+    return (released);
+}
+
+/*
+ *  ======== probe ========
+ *  Whether a device answers at address. The driver can't send just an
+ *  address, so this reads one byte, which every I2C device accepts.
+ */
+uint8_t TwoWire::probe(uint8_t address)
+{
+    I2C_Transaction xfer;
+    uint8_t data;
+
+    xfer.slaveAddress = address;
+    xfer.writeBuf = NULL;
+    xfer.writeCount = 0;
+    xfer.readBuf = &data;
+    xfer.readCount = 1;
+
+    return (transact(&xfer));
+}
+
+/*
+ *  ======== useDma ========
+ *  Whether transaction can go through dmaTransfer(), and on which uDMA
+ *  channels; if so, they are claimed until dmaRelease(). The byte
+ *  counter that ends a read also counts the write bytes before the
+ *  repeated START, so those must be fewer.
+ */
+bool TwoWire::useDma(I2C_Transaction *transaction, uint32_t *txChannel,
+    uint32_t *rxChannel)
+{
+    size_t wc = transaction->writeCount;
+    size_t rc = transaction->readCount;
+    unsigned int i;
+
+    if (minDmaTransferSize == 0 || wc + rc < minDmaTransferSize
+        || wc > DMA_MAX_WRITE || rc > DMA_MAX_READ
+        || (rc != 0 && wc >= rc)) {
+        return (false);
+    }
+
+    /* the driver must be idle, queued transfers are its business */
+    if (asyncPending != 0) {
+        return (false);
+    }
+
+    for (i = 0; i < sizeof(i2cDmaChannels) / sizeof(i2cDmaChannels[0]); i++) {
+        if (i2cDmaChannels[i].baseAddr == i2cBase) {
+            break;
+        }
+    }
+    if (i == sizeof(i2cDmaChannels) / sizeof(i2cDmaChannels[0])) {
+        return (false);
+    }
+
+    *txChannel = i2cDmaChannels[i].txChannel;
+    *rxChannel = i2cDmaChannels[i].rxChannel;
+
+    /* SPI, a UART or a sketch's dmaAllocate() may have the channels */
+    if (MAP_DMA_isChannelEnabled(*txChannel & 0x0f)
+        || MAP_DMA_isChannelEnabled(*rxChannel & 0x0f)) {
+        return (false);
+    }
+
+    if (dmaHandle == NULL) {
+        UDMAMSP432_init();
+        dmaHandle = UDMAMSP432_open();
+        if (dmaHandle == NULL) {
+            return (false);
+        }
+    }
+
+    if (!dmaAttach(*txChannel & 0x0f, NULL, 0, ~0)) {
+        return (false);
+    }
+    if (!dmaAttach(*rxChannel & 0x0f, NULL, 0, ~0)) {
+        dmaDetach(*txChannel & 0x0f);
+        return (false);
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== dmaRelease ========
+ *  Give back the channels useDma() claimed
+ */
+void TwoWire::dmaRelease(uint32_t txChannel, uint32_t rxChannel)
+{
+    dmaDetach(txChannel & 0x0f);
+    dmaDetach(rxChannel & 0x0f);
+}
+
+/*
+ *  ======== dmaWait ========
+ *  Wait for the uDMA channel to move count bytes. Sleeps through most
+ *  of their bus time and polls for the rest, so neither the driver's
+ *  Hwi nor a uDMA interrupt runs. Fails on NACK, lost arbitration or
+ *  if the bus takes far longer than it should (a stuck slave).
+ */
+uint8_t TwoWire::dmaWait(uint32_t channel, size_t count)
+{
+    EUSCI_B_Type *regs = EUSCI_B_CMSIS(i2cBase);
+    uint32_t ms = (uint32_t)(((uint64_t)count * 9 * 1000) / clockHz);
+    uint32_t start;
+
+    if (ms > 1) {
+        Task_sleep(ms - 1);
+    }
+
+    start = Clock_getTicks();
+    while (MAP_DMA_isChannelEnabled(channel & 0x0f)) {
+        if (regs->IFG & EUSCI_B_IFG_NACKIFG) {
+            return ((regs->STATW & EUSCI_B_STATW_BCNT_MASK) == 0 ?
+                WIRE_NACK_ADDRESS : WIRE_NACK_DATA);
+        }
+        if (regs->IFG & EUSCI_B_IFG_ALIFG) {
+            return (WIRE_OTHER_ERROR);
+        }
+        if (Clock_getTicks() - start > 10 * ms + 10) {
+            return (WIRE_TIMEOUT);
+        }
+    }
+
+    return (WIRE_SUCCESS);
+}
+
+/*
+ *  ======== dmaTransfer ========
+ *  Run a blocking transfer with the eUSCI_B module driven directly and
+ *  uDMA feeding TXBUF/draining RXBUF, instead of one driver Hwi per
+ *  byte. The driver's interrupts are masked for the duration and its
+ *  register setup restored afterwards. A read ends with the byte
+ *  counter's automatic STOP, a write with a STOP queued behind the
+ *  last byte.
+ */
+uint8_t TwoWire::dmaTransfer(I2C_Transaction *transaction, uint32_t txChannel,
+    uint32_t rxChannel)
+{
+    EUSCI_B_Type *regs = EUSCI_B_CMSIS(i2cBase);
+    size_t wc = transaction->writeCount;
+    size_t rc = transaction->readCount;
+    uint16_t ie = regs->IE;
+    uint32_t start;
+    uint8_t error = WIRE_SUCCESS;
+
+    Power_setConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+    Power_setConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+
+    regs->CTLW0 |= EUSCI_B_CTLW0_SWRST;
+    regs->CTLW1 = (regs->CTLW1 & ~EUSCI_B_CTLW1_ASTP_MASK)
+        | (rc != 0 ? EUSCI_B_CTLW1_ASTP_2 : 0);
+    regs->TBCNT = rc;
+    regs->CTLW0 &= ~EUSCI_B_CTLW0_SWRST;
+    regs->IE = 0;
+    regs->I2CSA = transaction->slaveAddress;
+
+    if (wc != 0) {
+        MAP_DMA_assignChannel(txChannel);
+        MAP_DMA_disableChannelAttribute(txChannel, UDMA_ATTR_ALTSELECT |
+            UDMA_ATTR_USEBURST | UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+        MAP_DMA_setChannelControl(txChannel | UDMA_PRI_SELECT,
+            UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+        MAP_DMA_setChannelTransfer(txChannel | UDMA_PRI_SELECT,
+            UDMA_MODE_BASIC, transaction->writeBuf, (void *)&regs->TXBUF, wc);
+        MAP_DMA_enableChannel(txChannel & 0x0f);
+
+        regs->CTLW0 |= EUSCI_B_CTLW0_TR | EUSCI_B_CTLW0_TXSTT;
+
+        error = dmaWait(txChannel, wc + 1);
+
+        /* TXBUF empty again: the last byte is on its way */
+        start = Clock_getTicks();
+        while (error == WIRE_SUCCESS && !(regs->IFG & EUSCI_B_IFG_TXIFG0)) {
+            if (regs->IFG & EUSCI_B_IFG_NACKIFG) {
+                error = WIRE_NACK_DATA;
+            }
+            else if (Clock_getTicks() - start > 10) {
+                error = WIRE_TIMEOUT;
+            }
+        }
+    }
+
+    if (error == WIRE_SUCCESS && rc != 0) {
+        MAP_DMA_assignChannel(rxChannel);
+        MAP_DMA_disableChannelAttribute(rxChannel, UDMA_ATTR_ALTSELECT |
+            UDMA_ATTR_USEBURST | UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+        MAP_DMA_setChannelControl(rxChannel | UDMA_PRI_SELECT,
+            UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 | UDMA_ARB_1);
+        MAP_DMA_setChannelTransfer(rxChannel | UDMA_PRI_SELECT,
+            UDMA_MODE_BASIC, (void *)&regs->RXBUF, transaction->readBuf, rc);
+        MAP_DMA_enableChannel(rxChannel & 0x0f);
+
+        /* (repeated) START as receiver; the byte counter sends the STOP */
+        regs->CTLW0 = (regs->CTLW0 & ~EUSCI_B_CTLW0_TR) | EUSCI_B_CTLW0_TXSTT;
+
+        error = dmaWait(rxChannel, rc + (wc != 0 ? 1 : 0) + 1);
+    }
+    else {
+        regs->CTLW0 |= EUSCI_B_CTLW0_TXSTP;
+    }
+
+    if (error != WIRE_SUCCESS) {
+        MAP_DMA_disableChannel(txChannel & 0x0f);
+        MAP_DMA_disableChannel(rxChannel & 0x0f);
+        regs->CTLW0 |= EUSCI_B_CTLW0_TXSTP;
+    }
+
+    /* let the STOP go out before the module is reset */
+    start = Clock_getTicks();
+    while ((regs->STATW & EUSCI_B_STATW_BBUSY)
+        && Clock_getTicks() - start <= 10) {
+        ;
+    }
+
+    /* back to the driver's setup: no automatic STOP, its interrupts */
+    regs->CTLW0 |= EUSCI_B_CTLW0_SWRST;
+    regs->CTLW1 &= ~EUSCI_B_CTLW1_ASTP_MASK;
+    regs->TBCNT = 0;
+    regs->CTLW0 &= ~EUSCI_B_CTLW0_SWRST;
+    regs->IFG = 0;
+    regs->IE = ie;
+
+    Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+    Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    return (error);
+}
+
+/*
+ *  ======== clockFreq ========
+ *  Frequency of the clock feeding the EUSCI_B bit clock generator at
+ *  the given performance level.
+ */
+uint32_t TwoWire::clockFreq(unsigned int perfLevel)
+{
+    I2CMSP432_HWAttrsV1 const *hwAttrs =
+        (I2CMSP432_HWAttrsV1 const *)i2c->hwAttrs;
+    PowerMSP432_Freqs powerFreqs;
+
+    PowerMSP432_getFreqs(perfLevel, &powerFreqs);
+
+    if (hwAttrs->clockSource == EUSCI_B_I2C_CLOCKSOURCE_ACLK) {
+        return (powerFreqs.ACLK);
+    }
+    return (powerFreqs.SMCLK);
+}
+
+/*
+ *  ======== configureClock ========
+ *  Reprogram the EUSCI_B prescaler for clockHz, rounding the divider up
+ *  so the bus never runs faster than requested. The driver only knows
+ *  100 and 400 kHz, so its bit rate setting is left alone; the bus must
+ *  be idle.
+ */
+void TwoWire::configureClock(uint32_t clk)
+{
+    EUSCI_B_Type *regs = EUSCI_B_CMSIS(i2cBase);
+    uint32_t brw = (clk + clockHz - 1) / clockHz;
+    uint16_t ie;
+
+    if (brw < 1) {
+        brw = 1;
+    }
+    else if (brw > 0xffff) {
+        brw = 0xffff;
+    }
+
+    if (regs->BRW != brw) {
+        /* UCSWRST clears IE; the driver's interrupt enables must survive */
+        ie = regs->IE;
+        regs->CTLW0 |= EUSCI_B_CTLW0_SWRST;
+        regs->BRW = brw;
+        regs->CTLW0 &= ~EUSCI_B_CTLW0_SWRST;
+        regs->IE = ie;
+    }
+}
+
+/*
+ *  ======== i2cPerfChangeNotifyFxn ========
+ *  Registered after the driver's own notify function, so it runs once
+ *  the driver has re-initialized the module at its fixed bit rate, and
+ *  re-applies the setClock() rate from the new clock.
+ */
+static int i2cPerfChangeNotifyFxn(unsigned int eventType, uintptr_t eventArg,
+    uintptr_t clientArg)
+{
+    ((TwoWire *)clientArg)->perfLevelChanged((unsigned int)eventArg);
+
+    return (Power_NOTIFYDONE);
+}
+
+void TwoWire::perfLevelChanged(unsigned int perfLevel)
+{
+    configureClock(clockFreq(perfLevel));
+}
+
+/*
+ *  ======== wireSlaveCallbackFxn ========
+ *  I2CSlave completion callback, Hwi context.
+ */
+static void wireSlaveCallbackFxn(I2CSlave_Handle handle, bool status)
+{
+    TwoWire *wire = slavePorts[(I2CSlave_Config const *)handle - I2CSlave_config];
+
+    wire->slaveCallback(status);
+}
+
+/*
+ *  ======== wireSlaveHwiFxn ========
+ *  Replaces the driver's Hwi function so TwoWire can look at the bus
+ *  before the driver does; see slaveInterrupt().
+ */
+static void wireSlaveHwiFxn(UArg arg)
+{
+    I2CSlave_Handle handle = (I2CSlave_Handle)arg;
+
+    slavePorts[(I2CSlave_Config const *)handle - I2CSlave_config]->slaveInterrupt();
+
+    I2CSlaveMSP432_hwiIntFxn((uintptr_t)arg);
+}
+
+/*
+ *  ======== onReceiveService ========
+ *  Hand a complete message from the master to onReceive() in one go.
+ */
+void TwoWire::onReceiveService(uint8_t *buffer, int numBytes)
+{
+    WireContext *wc = &defaultContext;
+
+    wc->rxReadIndex = buffer - wc->rxBuffer;
+    wc->rxWriteIndex = wc->rxReadIndex + numBytes;
+
+    if (user_onReceive != NULL && numBytes > 0) {
+        user_onReceive(numBytes);
+    }
+}
+
+/*
+ *  ======== onRequestService ========
+ *  Let onRequest() write() the whole reply before it goes out.
+ */
+void TwoWire::onRequestService(void)
+{
+    defaultContext.txWriteIndex = 0;
+
+    if (user_onRequest != NULL) {
+        user_onRequest();
+    }
+}
+
+/*
+ *  ======== armSlaveReceive ========
+ *  Receive the next message into rxBuffer; the driver completes it on
+ *  a STOP, a repeated START or when rxBuffer is full (it then NAKs).
+ */
+void TwoWire::armSlaveReceive(void)
+{
+    slaveTransmitting = false;
+    I2CSlave_read(slave, defaultContext.rxBuffer, defaultContext.rxSize);
+}
+
+/*
+ *  ======== armSlaveTransmit ========
+ *  The master wants to read: collect the reply from onRequest() and
+ *  give it to the driver. The driver can't arm an empty transfer, so a
+ *  missing reply reads as a single 0xff.
+ */
+void TwoWire::armSlaveTransmit(void)
+{
+    static const uint8_t noData = 0xff;
+    WireContext *wc = &defaultContext;
+
+    slaveTransmitting = true;
+
+    onRequestService();
+
+    if (wc->txWriteIndex != 0) {
+        I2CSlave_write(slave, wc->txBuffer, wc->txWriteIndex);
+    }
+    else {
+        I2CSlave_write(slave, &noData, 1);
+    }
+}
+
+/*
+ *  ======== slaveCallback ========
+ *  Hwi context. A receive or transmit has ended; status is false for a
+ *  repeated START as well as for errors. The bus direction after a
+ *  repeated START decides what is armed next.
+ */
+void TwoWire::slaveCallback(bool status)
+{
+    I2CSlaveMSP432_Object *object = (I2CSlaveMSP432_Object *)slave->object;
+    EUSCI_B_Type *regs = EUSCI_B_CMSIS(i2cBase);
+    bool restart = (object->mode == I2CSLAVE_START_MODE);
+
+    if (!slaveTransmitting) {
+        onReceiveService(defaultContext.rxBuffer,
+            defaultContext.rxSize - object->countIdx);
+    }
+
+    if (restart && (regs->CTLW0 & EUSCI_B_CTLW0_TR)) {
+        armSlaveTransmit();
+    }
+    else {
+        armSlaveReceive();
+    }
+}
+
+/*
+ *  ======== slaveInterrupt ========
+ *  Hwi context, ahead of the driver's handler. A master read that is
+ *  not preceded by a write finds the driver armed to receive, with the
+ *  transmit interrupt disabled, and would stretch SCL forever; arm the
+ *  transmit here so the driver's handler sends the first byte.
+ */
+void TwoWire::slaveInterrupt(void)
+{
+    I2CSlaveMSP432_Object *object = (I2CSlaveMSP432_Object *)slave->object;
+    EUSCI_B_Type *regs = EUSCI_B_CMSIS(i2cBase);
+
+    if (!slaveTransmitting && !object->transferInProgress
+        && (regs->IFG & EUSCI_B_IFG_STTIFG)
+        && (regs->CTLW0 & EUSCI_B_CTLW0_TR)) {
+        armSlaveTransmit();
+    }
+}
+
+/*
+ *  ======== beginSlave ========
+ *  Open this module's I2CSlave_config[] entry in callback mode at
+ *  address and start listening.
+ */
+void TwoWire::beginSlave(uint8_t address)
+{
+    I2CSlave_Params params;
+    I2CSlaveMSP432_Object *object;
+    EUSCI_B_Type *regs;
+
+    if (i2cModule >= WIRE_MAX_PORTS) {
+        return;
+    }
+
+    /* the slave data lives in defaultContext, claim it if it's free */
+    if (defaultContext.owner == NULL) {
+        initWireContext(&defaultContext, this, Task_self(), false);
+    }
+
+    I2CSlave_init();
+
+    I2CSlave_Params_init(&params);
+    params.transferMode = I2CSLAVE_MODE_CALLBACK;
+    params.transferCallbackFxn = wireSlaveCallbackFxn;
+
+    slavePorts[i2cModule] = this;
+
+    slave = I2CSlave_open(i2cModule, &params);
+    if (slave == NULL) {
+        return;
+    }
+
+    i2cBase = ((I2CSlaveMSP432_HWAttrs const *)slave->hwAttrs)->baseAddr;
+    slaveAddress = address;
+
+    /* the driver takes its address from the const board attributes */
+    regs = EUSCI_B_CMSIS(i2cBase);
+    regs->CTLW0 |= EUSCI_B_CTLW0_SWRST;
+    regs->I2COA0 = (address & 0x7f) | EUSCI_B_I2COA0_OAEN;
+    regs->CTLW0 &= ~EUSCI_B_CTLW0_SWRST;
+
+    object = (I2CSlaveMSP432_Object *)slave->object;
+    Hwi_setFunc((Hwi_Handle)object->hwiHandle, wireSlaveHwiFxn, (UArg)slave);
+
+    defaultContext.rxReadIndex = 0;
+    defaultContext.rxWriteIndex = 0;
+    defaultContext.txWriteIndex = 0;
+    slaveMode = true;
+
+    /* clearing SWRST disabled the interrupts, arming re-enables them */
+    armSlaveReceive();
+}
+
+/*
+ *  ======== busLow/busRelease ========
+ *  Open drain by hand for forceStop(): drive low, or let the pull-ups
+ *  take the line high.
+ */
+static void busLow(uint_fast8_t port, uint_fast16_t pin)
 {
-    //this has been removed so i can remove the pin map that used to be at the top of this file
+    MAP_GPIO_setOutputLowOnPin(port, pin);
+    MAP_GPIO_setAsOutputPin(port, pin);
+}
+
+static void busRelease(uint_fast8_t port, uint_fast16_t pin)
+{
+    MAP_GPIO_setAsInputPinWithPullUpResistor(port, pin);
+}
+
+/*
+ *  ======== forceStop ========
+ *  Free a bus a slave is holding low by being stuck mid-byte: with the
+ *  module in reset and its pins as GPIO, clock SCL up to nine times at
+ *  about 100 kHz until the slave lets go of SDA, then send a STOP.
+ *  Returns whether SDA is high afterwards.
+ */
+bool TwoWire::forceStop(void)
+{
+    I2CMSP432_HWAttrsV1 const *hwAttrs =
+        (I2CMSP432_HWAttrsV1 const *)i2c->hwAttrs;
+    EUSCI_B_Type *regs = EUSCI_B_CMSIS(i2cBase);
+    uint_fast8_t sclPort = (hwAttrs->clkPin >> 4) & 0xf;
+    uint_fast16_t sclPin = 1 << (hwAttrs->clkPin & 0xf);
+    uint_fast8_t sdaPort = (hwAttrs->dataPin >> 4) & 0xf;
+    uint_fast16_t sdaPin = 1 << (hwAttrs->dataPin & 0xf);
+    uint16_t ie = regs->IE;
+    bool released;
+    int i;
+
+    regs->CTLW0 |= EUSCI_B_CTLW0_SWRST;
+
+    busRelease(sclPort, sclPin);
+    busRelease(sdaPort, sdaPin);
+    delayMicroseconds(5);
+
+    for (i = 0; i < 9; i++) {
+        if (MAP_GPIO_getInputPinValue(sdaPort, sdaPin) == GPIO_INPUT_PIN_HIGH) {
+            break;
+        }
+        busLow(sclPort, sclPin);
+        delayMicroseconds(5);
+        busRelease(sclPort, sclPin);
+        delayMicroseconds(5);
+    }
+
+    /* STOP: SDA rises while SCL is high */
+    busLow(sclPort, sclPin);
+    delayMicroseconds(5);
+    busLow(sdaPort, sdaPin);
+    delayMicroseconds(5);
+    busRelease(sclPort, sclPin);
+    delayMicroseconds(5);
+    busRelease(sdaPort, sdaPin);
+    delayMicroseconds(5);
+
+    released =
+        MAP_GPIO_getInputPinValue(sdaPort, sdaPin) == GPIO_INPUT_PIN_HIGH;
+
+    /* back to the module, without the pull-ups */
+    MAP_GPIO_setAsInputPin(sclPort, sclPin);
+    MAP_GPIO_setAsInputPin(sdaPort, sdaPin);
+    MAP_GPIO_setAsPeripheralModuleFunctionInputPin(sclPort, sclPin,
+        (hwAttrs->clkPin >> 8) & 0x3);
+    MAP_GPIO_setAsPeripheralModuleFunctionInputPin(sdaPort, sdaPin,
+        (hwAttrs->dataPin >> 8) & 0x3);
+
+    /* entering reset cleared IE */
+    regs->CTLW0 &= ~EUSCI_B_CTLW0_SWRST;
+    regs->IE = ie;
+
+    return (released);
 }
 
 /*
@@ -116,29 +1020,67 @@ void TwoWire::begin(void)
     /* return if I2C already started */
     if (begun == TRUE) return;
 
+    /* master and slave share the module */
+    if (slaveMode) {
+        end();
+    }
+
     I2C_init();
 
+    /* callback mode lets the driver queue transferAsync() requests */
     I2C_Params_init(&params);
-    params.transferMode = I2C_MODE_BLOCKING;
+    params.transferMode = I2C_MODE_CALLBACK;
+    params.transferCallbackFxn = wireTransferCallback;
     params.bitRate = I2C_400kHz;
 
     i2c = I2C_open(i2cModule, &params);
 
     if (i2c != NULL) {
-        GateMutex_construct(&gate, NULL);
+        Semaphore_Params semParams;
+
+        i2cBase = ((I2CMSP432_HWAttrsV1 const *)i2c->hwAttrs)->baseAddr;
+
+        /* error codes for endTransmission() and the stats */
+        if (i2cModule < WIRE_MAX_PORTS) {
+            I2CMSP432_Object *object = (I2CMSP432_Object *)i2c->object;
+
+            masterPorts[i2cModule] = this;
+            Hwi_setFunc((Hwi_Handle)object->hwiHandle, wireMasterHwiFxn,
+                (UArg)i2c);
+        }
+
+        Power_registerNotify(&perfChangeNotify,
+            PowerMSP432_DONE_CHANGE_PERF_LEVEL, i2cPerfChangeNotifyFxn,
+            (uintptr_t)this);
+
+        configureClock(clockFreq(Power_getPerformanceLevel()));
+
         gateEnterCount = 0;
+
+        Semaphore_Params_init(&semParams);
+        semParams.mode = Semaphore_Mode_BINARY;
+        Semaphore_construct(&syncDone, 0, &semParams);
+
+        asyncPending = 0;
         begun = TRUE;
     }
 }
 
-//Save slave address for use in I2C_Transaction
+/*
+ *  ======== begin ========
+ *  Join the bus as a slave at address. onReceive() gets each message
+ *  from the master once it has ended, with the data ready for read();
+ *  onRequest() write()s the whole reply before it is sent. Both run in
+ *  Hwi context and must not block; received data is only valid until
+ *  the callback returns.
+ */
 void TwoWire::begin(uint8_t address)
 {
-    WireContext *wc = getWireContext();
-
-    wc->i2cTransaction.slaveAddress = address;
+    if (begun == TRUE || slaveMode) {
+        end();
+    }
 
-    begin();
+    beginSlave(address);
 }
 
 void TwoWire::begin(int address)
@@ -148,15 +1090,44 @@ void TwoWire::begin(int address)
 
 void TwoWire::end()
 {
+    if (slaveMode) {
+        slaveMode = false;
+        I2CSlave_close(slave);
+        slave = NULL;
+        slavePorts[i2cModule] = NULL;
+        return;
+    }
+
+    if (begun == false) {
+        return;
+    }
+
+    /* the driver must be idle when it is closed */
+    while (asyncPending != 0) {
+        Task_sleep(1);
+    }
+
     begun = false;
+    Power_unregisterNotify(&perfChangeNotify);
     I2C_close(i2c);
+    i2c = NULL;
+    if (i2cModule < WIRE_MAX_PORTS) {
+        masterPorts[i2cModule] = NULL;
+    }
+
+    if (dmaHandle != NULL) {
+        UDMAMSP432_close(dmaHandle);
+        dmaHandle = NULL;
+    }
+
+    Semaphore_destruct(&syncDone);
 }
 
 void TwoWire::beginTransmission(uint8_t address)
 {
     WireContext *wc = getWireContext();
 
-    GateMutex_enter(GateMutex_handle(&gate));
+    gate.lock();
     gateEnterCount++;
 
     if (wc->idle) {
@@ -172,14 +1143,23 @@ void TwoWire::beginTransmission(int address)
 
 uint8_t TwoWire::endTransmission(uint8_t sendStop)
 {
-    bool ret;
+    uint8_t ret;
     WireContext *wc = getWireContext();
 
     if (i2c == NULL) {
-        return (4); /* 4 = 'other error' */
+        return (WIRE_OTHER_ERROR);
     }
 
-    ret = I2C_transfer(i2c, &(wc->i2cTransaction));
+    PROFILE_SCOPE("Wire.endTransmission");
+
+    /* the usual bus scan: beginTransmission() + endTransmission() */
+    if (wc->i2cTransaction.writeCount == 0
+        && wc->i2cTransaction.readCount == 0) {
+        ret = probe(wc->i2cTransaction.slaveAddress);
+    }
+    else {
+        ret = transact(&(wc->i2cTransaction));
+    }
 
     wc->txWriteIndex = 0;
 
@@ -194,11 +1174,10 @@ uint8_t TwoWire::endTransmission(uint8_t sendStop)
     }
 
     if (gateEnterCount) {
-        GateMutex_leave(GateMutex_handle(&gate), --gateEnterCount);
+        gate.unlock(--gateEnterCount);
     }
 
-    /* success = 0; 4 = other error */
-    return (ret ? 0 : 4);
+    return (ret);
 }
 
 //  This provides backwards compatibility with the original
@@ -209,15 +1188,21 @@ uint8_t TwoWire::endTransmission(void)
     return (endTransmission(true));
 }
 
-uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, uint8_t sendStop)
+/*
+ *  ======== request ========
+ *  Read up to rxSize bytes from address in one I2C_transfer(); returns
+ *  the number of bytes read, 0 on error.
+ */
+size_t TwoWire::request(uint8_t address, size_t quantity, bool sendStop)
 {
-    if (quantity > BUFFER_LENGTH) {
-        quantity = BUFFER_LENGTH;
+    WireContext *wc = getWireContext();
+
+    if (quantity > wc->rxSize) {
+        quantity = wc->rxSize;
     }
     if (!quantity) {
         return (0);
     }
-    WireContext *wc = getWireContext();
 
     beginTransmission(address);
 
@@ -227,17 +1212,104 @@ uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, uint8_t sendStop
     return (endTransmission(sendStop) ? 0 : quantity);
 }
 
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, uint8_t sendStop)
+{
+    return ((uint8_t)request(address, quantity, sendStop));
+}
+
 uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity)
 {
-    return (requestFrom((uint8_t)address, (uint8_t)quantity, (uint8_t)true));
+    return ((uint8_t)request(address, quantity, true));
+}
+
+size_t TwoWire::requestFrom(int address, int quantity)
+{
+    return (request((uint8_t)address, quantity < 0 ? 0 : quantity, true));
 }
-uint8_t TwoWire::requestFrom(int address, int quantity)
+
+size_t TwoWire::requestFrom(int address, int quantity, int sendStop)
 {
-    return (requestFrom((uint8_t)address, (uint8_t)quantity, (uint8_t)true));
+    return (request((uint8_t)address, quantity < 0 ? 0 : quantity,
+        sendStop != 0));
 }
-uint8_t TwoWire::requestFrom(int address, int quantity, int sendStop)
+
+/*
+ *  ======== readRegisters ========
+ *  Write reg to address then, after a repeated start, read len bytes
+ *  straight into buf: one I2C_transfer() and no context buffers.
+ *  Returns 0 on success like endTransmission(), a WIRE_xxx error
+ *  otherwise.
+ */
+uint8_t TwoWire::readRegisters(uint8_t address, uint8_t reg, uint8_t *buf,
+    size_t len)
 {
-    return (requestFrom((uint8_t)address, (uint8_t)quantity, (uint8_t)sendStop));
+    I2C_Transaction xfer;
+    IArg key;
+    uint8_t ret;
+
+    if (i2c == NULL) {
+        return (WIRE_OTHER_ERROR);
+    }
+
+    xfer.slaveAddress = address;
+    xfer.writeBuf = &reg;
+    xfer.writeCount = 1;
+    xfer.readBuf = buf;
+    xfer.readCount = len;
+
+    /* keep out of another task's beginTransmission() sequence */
+    key = gate.lock();
+    ret = transact(&xfer);
+    gate.unlock(key);
+
+    return (ret);
+}
+
+/*
+ *  ======== writeRegisters ========
+ *  Write reg followed by len bytes of buf in one I2C_transfer(). The
+ *  payload has to follow reg contiguously, so it is staged on the stack
+ *  up to WIRE_REG_WRITE_MAX bytes and in the calling task's tx buffer
+ *  beyond that. Returns 0 on success, WIRE_DATA_TOO_LONG if buf does
+ *  not fit, another WIRE_xxx error if the transfer fails.
+ */
+uint8_t TwoWire::writeRegisters(uint8_t address, uint8_t reg,
+    const uint8_t *buf, size_t len)
+{
+    uint8_t local[WIRE_REG_WRITE_MAX + 1];
+    uint8_t *data = local;
+    I2C_Transaction xfer;
+    IArg key;
+    uint8_t ret;
+
+    if (i2c == NULL) {
+        return (WIRE_OTHER_ERROR);
+    }
+
+    if (len > WIRE_REG_WRITE_MAX) {
+        WireContext *wc = getWireContext();
+
+        /* don't clobber a transmission that is being built */
+        if (len + 1 > wc->txSize || wc->txWriteIndex != 0) {
+            return (WIRE_DATA_TOO_LONG);
+        }
+        data = wc->txBuffer;
+    }
+
+    data[0] = reg;
+    memcpy(&data[1], buf, len);
+
+    xfer.slaveAddress = address;
+    xfer.writeBuf = data;
+    xfer.writeCount = len + 1;
+    xfer.readBuf = NULL;
+    xfer.readCount = 0;
+
+    key = gate.lock();
+    ret = transact(&xfer);
+    gate.unlock(key);
+
+    return (ret);
 }
 
 // must be called in:
@@ -256,8 +1328,7 @@ size_t TwoWire::write(uint8_t data)
     }
 
     // put byte in tx buffer
-    wc->txBuffer[wc->txWriteIndex] = data;
-    wc->txWriteIndex = (wc->txWriteIndex + 1) % BUFFER_LENGTH;
+    wc->txBuffer[wc->txWriteIndex++] = data;
     wc->i2cTransaction.writeCount = wc->txWriteIndex;
 
     return (1);
@@ -268,9 +1339,18 @@ size_t TwoWire::write(uint8_t data)
 // or after beginTransmission(address)
 size_t TwoWire::write(const uint8_t *data, size_t quantity)
 {
-    for (size_t i = 0; i < quantity; i++) {
-        write(data[i]);
+    WireContext *wc = getWireContext();
+    size_t room = wc->txSize - wc->txWriteIndex;
+
+    if (quantity > room) {
+        setWriteError();
+        quantity = room;
     }
+
+    memcpy(&wc->txBuffer[wc->txWriteIndex], data, quantity);
+    wc->txWriteIndex += quantity;
+    wc->i2cTransaction.writeCount = wc->txWriteIndex;
+
     return (quantity);
 }
 
@@ -281,8 +1361,7 @@ int TwoWire::available(void)
 {
     WireContext *wc = getWireContext();
 
-    return ((wc->rxWriteIndex >= wc->rxReadIndex) ?
-        (wc->rxWriteIndex - wc->rxReadIndex) : BUFFER_LENGTH - (wc->rxReadIndex - wc->rxWriteIndex));
+    return (RX_BUFFER_EMPTY ? 0 : wc->rxWriteIndex - wc->rxReadIndex);
 }
 
 // must be called in:
@@ -297,12 +1376,40 @@ int TwoWire::read(void)
         return -1;
     }
 
-    value = wc->rxBuffer[wc->rxReadIndex];
-    wc->rxReadIndex = (wc->rxReadIndex + 1) % BUFFER_LENGTH;
+    value = wc->rxBuffer[wc->rxReadIndex++];
 
     return (value);
 }
 
+// must be called in:
+// slave rx event callback
+// or after requestFrom(address, numBytes)
+size_t TwoWire::read(uint8_t *buffer, size_t length)
+{
+    WireContext *wc = getWireContext();
+    size_t avail = RX_BUFFER_EMPTY ? 0 : wc->rxWriteIndex - wc->rxReadIndex;
+
+    if (length > avail) {
+        length = avail;
+    }
+
+    memcpy(buffer, &wc->rxBuffer[wc->rxReadIndex], length);
+    wc->rxReadIndex += length;
+
+    return (length);
+}
+
+/*
+ *  ======== readBytes ========
+ *  Everything a transfer returns is already in rxBuffer, so there is
+ *  nothing to wait for: copy what is there instead of timing out
+ *  byte by byte like Stream::readBytes().
+ */
+size_t TwoWire::readBytes(char *buffer, size_t length)
+{
+    return (read((uint8_t *)buffer, length));
+}
+
 // must be called in:
 // slave rx event callback
 // or after requestFrom(address, numBytes)
@@ -338,15 +1445,334 @@ void TwoWire::onRequest( void (*function)(void) )
     user_onRequest = function;
 }
 
+/*
+ *  ======== setContext ========
+ *  Have the calling task use wc (e.g. statically allocated) instead
+ *  of a context from the heap.
+ */
+void TwoWire::setContext(WireContext *wc)
+{
+    Task_Handle self = Task_self();
+    unsigned int key;
+
+    releaseContext();
+
+    key = Task_disable();
+
+    initWireContext(wc, this, self, false);
+    wc->next = (WireContext *)Task_getEnv(self);
+    Task_setEnv(self, (void *)wc);
+    lastContext = wc;
+
+    Task_restore(key);
+}
+
+/*
+ *  ======== releaseContext ========
+ *  Give back the calling task's context; call before a task that used
+ *  the bus exits, the heap context would otherwise leak.
+ */
+void TwoWire::releaseContext(void)
+{
+    Task_Handle self = Task_self();
+    WireContext *wc;
+    unsigned int key;
+
+    key = Task_disable();
+
+    if (lastContext != NULL && lastContext->owner == self) {
+        lastContext = NULL;
+    }
+
+    if (defaultContext.owner == self) {
+        defaultContext.owner = NULL;
+    }
+    else {
+        WireContext *prev = NULL;
+
+        wc = (WireContext *)Task_getEnv(self);
+        while (wc != NULL && wc->bus != this) {
+            prev = wc;
+            wc = wc->next;
+        }
+
+        if (wc != NULL) {
+            /* unlink, the task's contexts for other buses stay */
+            if (prev != NULL) {
+                prev->next = wc->next;
+            }
+            else {
+                Task_setEnv(self, (void *)wc->next);
+            }
+            wc->owner = NULL;
+            if (wc->allocated) {
+                Memory_free(NULL, wc, sizeof(WireContext));
+            }
+        }
+    }
+
+    Task_restore(key);
+}
+
 void TwoWire::setModule(unsigned long _i2cModule)
 {
-    WireContext *wc = getWireContext();
+    bool wasSlave = slaveMode;
+
+    end();
 
     i2cModule = _i2cModule;
-    if (wc->i2cTransaction.slaveAddress != 0) {
-        begin(wc->i2cTransaction.slaveAddress);
+    if (wasSlave) {
+        begin(slaveAddress);
     }
     else {
         begin();
     }
 }
+
+/*
+ *  ======== setBuffers ========
+ *  Give the calling task's context its own rx and tx buffers, e.g. to
+ *  read a whole 256 byte EEPROM page with one requestFrom(). A NULL
+ *  buffer goes back to the built-in BUFFER_LENGTH one. Buffered data
+ *  is discarded.
+ */
+void TwoWire::setBuffers(uint8_t *rxBuf, size_t rxLen, uint8_t *txBuf,
+    size_t txLen)
+{
+    WireContext *wc = getWireContext();
+
+    if (rxBuf != NULL && rxLen != 0) {
+        wc->rxBuffer = rxBuf;
+        wc->rxSize = rxLen;
+    }
+    else {
+        wc->rxBuffer = wc->rxStorage;
+        wc->rxSize = BUFFER_LENGTH;
+    }
+
+    if (txBuf != NULL && txLen != 0) {
+        wc->txBuffer = txBuf;
+        wc->txSize = txLen;
+    }
+    else {
+        wc->txBuffer = wc->txStorage;
+        wc->txSize = BUFFER_LENGTH;
+    }
+
+    wc->rxReadIndex = 0;
+    wc->rxWriteIndex = 0;
+    wc->txWriteIndex = 0;
+    wc->i2cTransaction.writeBuf = wc->txBuffer;
+    wc->i2cTransaction.readBuf = wc->rxBuffer;
+    wc->i2cTransaction.writeCount = 0;
+    wc->i2cTransaction.readCount = 0;
+}
+
+/*
+ *  ======== transferAsync ========
+ *  Queue xfer and return immediately; the driver runs queued transfers
+ *  in order. Completion is reported through xfer->done, xfer->callback
+ *  (from Hwi context) and xfer->sem. Call from a task or from another
+ *  transfer's completion callback.
+ */
+bool TwoWire::transferAsync(WireAsyncTransfer *xfer)
+{
+    uintptr_t key;
+
+    if (i2c == NULL || (xfer->txCount == 0 && xfer->rxCount == 0)) {
+        return (false);
+    }
+
+    xfer->transaction.slaveAddress = xfer->address;
+    xfer->transaction.writeBuf = (void *)xfer->txBuf;
+    xfer->transaction.writeCount = xfer->txCount;
+    xfer->transaction.readBuf = xfer->rxBuf;
+    xfer->transaction.readCount = xfer->rxCount;
+    xfer->transaction.arg = xfer;
+
+    xfer->owner = this;
+    xfer->queued = true;
+    xfer->done = false;
+    xfer->error = WIRE_SUCCESS;
+    xfer->startTime = Timestamp_get32();
+
+    traceEvent(TRACE_WIRE, xfer->address, xfer->txCount + xfer->rxCount);
+
+    key = Hwi_disable();
+    asyncPending++;
+    Hwi_restore(key);
+
+    return (I2C_transfer(i2c, &xfer->transaction));
+}
+
+bool TwoWire::asyncBusy(void)
+{
+    return (asyncPending != 0);
+}
+
+/*
+ *  ======== setClock ========
+ *  Run the bus at the fastest rate not above hz (at most WIRE_CLOCK_MAX)
+ *  the module clock can be divided down to, without reopening the
+ *  driver. 1 MHz needs Fast-mode Plus capable devices and pull-ups.
+ *  Waits for transfers in progress to finish.
+ */
+void TwoWire::setClock(uint32_t hz)
+{
+    IArg key;
+
+    if (hz == 0) {
+        return;
+    }
+    if (hz > WIRE_CLOCK_MAX) {
+        hz = WIRE_CLOCK_MAX;
+    }
+
+    clockHz = hz;
+
+    if (begun == TRUE) {
+        /* blocking transfers run under gate; wait out the queued ones */
+        key = gate.lock();
+        while (asyncPending != 0) {
+            Task_sleep(1);
+        }
+        configureClock(clockFreq(Power_getPerformanceLevel()));
+        gate.unlock(key);
+    }
+}
+
+/*
+ *  ======== getClock ========
+ *  The bit rate actually generated, or the requested one if the bus is
+ *  not open.
+ */
+uint32_t TwoWire::getClock(void)
+{
+    if (begun == FALSE) {
+        return (clockHz);
+    }
+
+    return (clockFreq(Power_getPerformanceLevel())
+        / EUSCI_B_CMSIS(i2cBase)->BRW);
+}
+
+/*
+ *  ======== setMinDmaTransferSize ========
+ *  Blocking transfers of at least size bytes (write plus read) use the
+ *  uDMA path; 0 leaves every transfer to the driver. Writes up to
+ *  1024 bytes and reads up to 255 qualify.
+ */
+void TwoWire::setMinDmaTransferSize(size_t size)
+{
+    minDmaTransferSize = size;
+}
+
+/*
+ *  ======== setTransferTimeout ========
+ *  A blocking transfer that is not done after ms milliseconds fails
+ *  with WIRE_TIMEOUT; transfers queued behind it fail too and the bus
+ *  is freed with the nine clock recovery. 0 waits forever.
+ */
+void TwoWire::setTransferTimeout(unsigned long ms)
+{
+    transferTimeout = ms;
+}
+
+unsigned long TwoWire::getTransferTimeout(void)
+{
+    return (transferTimeout);
+}
+
+/*
+ *  ======== recoverBus ========
+ *  Cancel outstanding transfers and run the bus recovery by hand, e.g.
+ *  after a slave was reset mid-transfer. Returns whether SDA is free.
+ */
+bool TwoWire::recoverBus(void)
+{
+    bool released;
+    IArg key;
+
+    if (i2c == NULL) {
+        return (false);
+    }
+
+    key = gate.lock();
+    released = recover();
+    gate.unlock(key);
+
+    return (released);
+}
+
+/*
+ *  ======== getStats ========
+ */
+void TwoWire::getStats(WireStats *out)
+{
+    Types_FreqHz freq;
+    uint32_t minT, maxT;
+    uint64_t total;
+    unsigned long count;
+    uintptr_t key;
+
+    key = Hwi_disable();
+    *out = stats;
+    minT = minTicks;
+    maxT = maxTicks;
+    total = totalTicks;
+    Hwi_restore(key);
+
+    count = out->transfers + out->nacks + out->timeouts + out->errors;
+    if (count == 0) {
+        return;
+    }
+
+    Timestamp_getFreq(&freq);
+    out->minMicros = (unsigned long)(((uint64_t)minT * 1000000) / freq.lo);
+    out->maxMicros = (unsigned long)(((uint64_t)maxT * 1000000) / freq.lo);
+    out->avgMicros = (unsigned long)((total * 1000000) / freq.lo / count);
+}
+
+void TwoWire::resetStats(void)
+{
+    uintptr_t key = Hwi_disable();
+
+    memset(&stats, 0, sizeof(stats));
+    minTicks = 0xffffffff;
+    maxTicks = 0;
+    totalTicks = 0;
+
+    Hwi_restore(key);
+}
+
+/*
+ *  ======== scan ========
+ *  Probe every non-reserved 7 bit address (0x08 - 0x77) and store the
+ *  ones that answer in found, up to max of them. Returns how many
+ *  answered.
+ */
+unsigned int TwoWire::scan(uint8_t *found, unsigned int max)
+{
+    unsigned int count = 0;
+    uint8_t address;
+    IArg key;
+
+    if (i2c == NULL) {
+        return (0);
+    }
+
+    key = gate.lock();
+
+    for (address = 0x08; address <= 0x77; address++) {
+        if (probe(address) == WIRE_SUCCESS) {
+            if (count < max && found != NULL) {
+                found[count] = address;
+            }
+            count++;
+        }
+    }
+
+    gate.unlock(key);
+
+    return (count);
+}
@@ -37,9 +37,52 @@
 #include "Stream.h"
 
 #include <ti/drivers/I2C.h>
-#include <ti/sysbios/gates/GateMutex.h>
+#include <ti/drivers/I2CSlave.h>
+#include <ti/drivers/Power.h>
+#include <ti/drivers/dma/UDMAMSP432.h>
+#include <ti/sysbios/knl/Task.h>
+#include <ti/sysbios/knl/Semaphore.h>
 
+#include "Mutex.h"
+
+/*
+ * Size of each task's built-in rx and tx buffers; override on the
+ * command line, or give a task larger buffers with setBuffers().
+ */
+#ifndef BUFFER_LENGTH
 #define BUFFER_LENGTH     64
+#endif
+
+/* endTransmission(), readRegisters() and writeRegisters() results */
+#define WIRE_SUCCESS        0
+#define WIRE_DATA_TOO_LONG  1
+#define WIRE_NACK_ADDRESS   2
+#define WIRE_NACK_DATA      3
+#define WIRE_OTHER_ERROR    4   /* includes lost arbitration */
+#define WIRE_TIMEOUT        5
+
+/* setClock() limits; 1 MHz is Fast-mode Plus */
+#define WIRE_CLOCK_DEFAULT  400000
+#define WIRE_CLOCK_MAX      1000000
+
+/*
+ * Blocking transfers giving up after this many milliseconds free the
+ * bus with forceStop(); 0 waits forever. See setTransferTimeout().
+ */
+#ifndef WIRE_TRANSFER_TIMEOUT
+#define WIRE_TRANSFER_TIMEOUT       100
+#endif
+
+/*
+ * Blocking transfers of at least this many bytes are moved by uDMA
+ * instead of the driver's per-byte Hwi; see setMinDmaTransferSize().
+ */
+#ifndef WIRE_MIN_DMA_TRANSFER_SIZE
+#define WIRE_MIN_DMA_TRANSFER_SIZE  32
+#endif
+
+/* longest writeRegisters() payload staged on the caller's stack */
+#define WIRE_REG_WRITE_MAX  16
 
 #define IDLE 0
 #define MASTER_TX 1
@@ -50,17 +93,81 @@
 
 typedef struct WireContext {
     I2C_Transaction i2cTransaction;
-    uint8_t rxBuffer[BUFFER_LENGTH];
-    uint8_t rxReadIndex;
-    uint8_t rxWriteIndex;
+    uint8_t *rxBuffer;      /* rxStorage or buffer from setBuffers() */
+    size_t rxSize;
+    size_t rxReadIndex;
+    size_t rxWriteIndex;
 
-    uint8_t txBuffer[BUFFER_LENGTH];
-    uint8_t txReadIndex;
-    uint8_t txWriteIndex;
+    uint8_t *txBuffer;      /* txStorage or buffer from setBuffers() */
+    size_t txSize;
+    size_t txReadIndex;
+    size_t txWriteIndex;
+
+    uint8_t rxStorage[BUFFER_LENGTH];
+    uint8_t txStorage[BUFFER_LENGTH];
 
     bool idle;
+
+    Task_Handle owner;      /* task this context belongs to */
+    bool allocated;         /* from the heap, see releaseContext() */
+
+    /* a task's contexts for all buses are listed in its task env */
+    class TwoWire *bus;
+    struct WireContext *next;
 } WireContext;
 
+/*
+ *  TwoWire::getStats() snapshot; covers blocking and queued transfers
+ *  since begin() or resetStats(). Times run from the transfer being
+ *  handed to the driver (queueing included) to its completion.
+ */
+typedef struct WireStats {
+    unsigned long transfers;    /* completed without error */
+    unsigned long nacks;        /* address or data not acknowledged */
+    unsigned long timeouts;
+    unsigned long errors;       /* lost arbitration, other failures */
+    unsigned long bytes;        /* written and read by good transfers */
+    unsigned long minMicros;
+    unsigned long avgMicros;
+    unsigned long maxMicros;
+} WireStats;
+
+class TwoWire;
+struct WireAsyncTransfer;
+
+/* called from Hwi context when a queued transfer has completed */
+typedef void (*WireAsyncCallback)(WireAsyncTransfer *xfer);
+
+/*
+ *  A transfer queued by TwoWire::transferAsync(): write txCount bytes,
+ *  then read rxCount bytes after a repeated start. The caller owns the
+ *  struct and its buffers and must keep them valid until done is set.
+ */
+struct WireAsyncTransfer {
+    uint8_t address;
+    const void *txBuf;
+    size_t txCount;
+    void *rxBuf;
+    size_t rxCount;
+    WireAsyncCallback callback; /* optional */
+    Semaphore_Handle sem;       /* optional, posted when done */
+    void *arg;                  /* for the caller's use */
+
+    /* maintained by TwoWire */
+    volatile bool done;
+    bool status;                /* true: transfer succeeded */
+    uint8_t error;              /* WIRE_NACK_xxx etc. if it failed */
+    bool queued;                /* false for the internal blocking ones */
+    uint32_t startTime;         /* Timestamp when handed to the driver */
+    TwoWire *owner;
+    I2C_Transaction transaction;
+
+    WireAsyncTransfer(void) :
+        address(0), txBuf(NULL), txCount(0), rxBuf(NULL), rxCount(0),
+        callback(NULL), sem(NULL), arg(NULL), done(true), status(true),
+        error(WIRE_SUCCESS), queued(false), startTime(0), owner(NULL) {}
+};
+
 class TwoWire : public Stream
 {
     private:
@@ -68,19 +175,78 @@ class TwoWire : public Stream
 
         uint8_t i2cModule;
         I2C_Handle i2c;
+        uint32_t i2cBase;           /* EUSCI_B module base address */
+        uint32_t clockHz;           /* setClock() rate */
+        Power_NotifyObj perfChangeNotify;
+
+        /*
+         * begin(address) state. All slave data goes through
+         * defaultContext, whichever task or Hwi touches it.
+         */
+        bool slaveMode;
+        uint8_t slaveAddress;
+        I2CSlave_Handle slave;
+        volatile bool slaveTransmitting;    /* armed with txBuffer */
 
-        GateMutex_Struct gate;
+        Mutex gate;
         uint8_t gateEnterCount;
 
+        /*
+         * The driver runs in callback mode; blocking transfers, which
+         * all happen under gate, wait on syncDone.
+         */
+        Semaphore_Struct syncDone;
+        volatile unsigned int asyncPending;
+        unsigned long transferTimeout;  /* ms, 0 = forever */
+
+        /* getStats() counters; times in Timestamp ticks */
+        WireStats stats;
+        uint32_t minTicks;
+        uint32_t maxTicks;
+        uint64_t totalTicks;
+
+        /* uDMA path for long blocking transfers, see dmaTransfer() */
+        size_t minDmaTransferSize;
+        UDMAMSP432_Handle dmaHandle;
+
+        /*
+         * The first task to use the bus gets defaultContext, others get
+         * a heap context or one passed to setContext(). lastContext
+         * caches the most recently used one.
+         */
+        WireContext defaultContext;
+        WireContext * volatile lastContext;
+
         void (*user_onRequest)(void);
         void (*user_onReceive)(int);
         void onRequestService(void);
         void onReceiveService(uint8_t*, int);
         void init(unsigned long);
-        void forceStop(void);
+        bool forceStop(void);
+        bool recover(void);
         WireContext *getWireContext(void);
+        WireContext *findContext(Task_Handle);
+        size_t request(uint8_t, size_t, bool);
+        uint8_t transact(I2C_Transaction *);
+        uint8_t probe(uint8_t);
+        void recordTransfer(I2C_Transaction *, uint8_t, uint32_t);
+        bool useDma(I2C_Transaction *, uint32_t *, uint32_t *);
+        void dmaRelease(uint32_t, uint32_t);
+        uint8_t dmaTransfer(I2C_Transaction *, uint32_t, uint32_t);
+        uint8_t dmaWait(uint32_t, size_t);
+        uint32_t clockFreq(unsigned int);
+        void configureClock(uint32_t);
+        void beginSlave(uint8_t);
+        void armSlaveReceive(void);
+        void armSlaveTransmit(void);
 
     public:
+        void transferCallback(I2C_Transaction *, bool);
+        void masterInterrupt(void);
+        void perfLevelChanged(unsigned int);
+        void slaveCallback(bool);
+        void slaveInterrupt(void);
+
         TwoWire(void);
         TwoWire(unsigned long);
         void begin();
@@ -93,12 +259,16 @@ class TwoWire : public Stream
         uint8_t endTransmission(uint8_t);
         uint8_t requestFrom(uint8_t, uint8_t);
         uint8_t requestFrom(uint8_t, uint8_t, uint8_t);
-        uint8_t requestFrom(int, int);
-        uint8_t requestFrom(int, int, int);
+        size_t requestFrom(int, int);
+        size_t requestFrom(int, int, int);
         virtual size_t write(uint8_t);
         virtual size_t write(const uint8_t *, size_t);
         virtual int available(void);
         virtual int read(void);
+        size_t read(uint8_t *, size_t);
+        virtual size_t readBytes(char *, size_t);
+        uint8_t readRegisters(uint8_t, uint8_t, uint8_t *, size_t);
+        uint8_t writeRegisters(uint8_t, uint8_t, const uint8_t *, size_t);
         virtual int peek(void);
         virtual void flush(void);
         void onReceive( void (*)(int) );
@@ -110,8 +280,28 @@ class TwoWire : public Stream
         inline size_t write(int n) { return write((uint8_t)n); }
 
         using Print::write;
+        using Stream::readBytes;
 
         void setModule(unsigned long);
+        void setClock(uint32_t);
+        uint32_t getClock(void);
+
+        void setContext(WireContext *);
+        void releaseContext(void);
+        void setBuffers(uint8_t *, size_t, uint8_t *, size_t);
+
+        void setMinDmaTransferSize(size_t);
+
+        void setTransferTimeout(unsigned long);
+        unsigned long getTransferTimeout(void);
+        bool recoverBus(void);
+
+        bool transferAsync(WireAsyncTransfer *);
+        bool asyncBusy(void);
+
+        void getStats(WireStats *);
+        void resetStats(void);
+        unsigned int scan(uint8_t *, unsigned int);
 
 };
 
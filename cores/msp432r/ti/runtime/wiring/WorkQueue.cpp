@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+#include "WorkQueue.h"
+
+#include <xdc/runtime/Error.h>
+#include <xdc/runtime/Types.h>
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+/*
+ *  ======== msToTicks ========
+ *  Clock ticks are 32 ACLK counts, a little under 1ms; round up so a
+ *  delay is never short
+ */
+static uint32_t msToTicks(uint32_t ms)
+{
+    static uint32_t tickCounts, tickHz;
+    Types_FreqHz freq;
+    uint64_t per;
+
+    if (tickHz == 0) {
+        Clock_TimerProxy_getFreq(Clock_getTimerHandle(), &freq);
+        tickCounts = Clock_TimerProxy_getPeriod(Clock_getTimerHandle());
+        tickHz = freq.lo;
+    }
+    per = (uint64_t)1000 * tickCounts;
+
+    return (((uint64_t)ms * tickHz + per - 1) / per + 1);
+}
+
+Work::Work(void (*fxn)(void *arg), void *arg, uint8_t priority)
+{
+    this->fxn = fxn;
+    this->arg = arg;
+    this->priority = priority < WORK_PRIORITIES ?
+        priority : WORK_PRIORITIES - 1;
+    state = WORK_IDLE;
+}
+
+DelayedWork::DelayedWork(void (*fxn)(void *arg), void *arg,
+    uint8_t priority) : Work(fxn, arg, priority)
+{
+    Clock_Params clockParams;
+
+    queue = NULL;
+    Clock_Params_init(&clockParams);
+    clockParams.arg = (UArg)this;
+    Clock_construct(&clock, clockFxn, 1, &clockParams);
+}
+
+DelayedWork::~DelayedWork()
+{
+    Clock_stop(Clock_handle(&clock));
+    Clock_destruct(&clock);
+}
+
+/*
+ *  ======== clockFxn ========
+ *  Clock (Swi) context: the delay is over, queue the work
+ */
+void DelayedWork::clockFxn(UArg arg)
+{
+    DelayedWork *work = (DelayedWork *)arg;
+    UInt key;
+
+    key = Hwi_disable();
+    if (work->state == WORK_DELAYED) {
+        work->queue->enqueue(*work);
+    }
+    Hwi_restore(key);
+}
+
+WorkQueue::WorkQueue(void)
+{
+    int i;
+
+    for (i = 0; i < WORK_PRIORITIES; i++) {
+        Queue_construct(&queues[i], NULL);
+    }
+    Semaphore_construct(&sem, 0, NULL);
+    workerCount = 0;
+}
+
+/*
+ *  ======== begin ========
+ *  Work submitted before begin() waits for it. If not all workers can
+ *  be created, the ones that were run the queue.
+ */
+bool WorkQueue::begin(uint8_t workers, size_t stackSize, int taskPriority)
+{
+    Task_Params params;
+    Task_Handle task;
+
+    if (workerCount != 0 || workers == 0 || workers > WORK_WORKERS_MAX) {
+        return (false);
+    }
+
+    Task_Params_init(&params);
+    params.arg0 = (UArg)this;
+    params.stackSize = stackSize;
+    params.priority = taskPriority;
+    params.instance->name = (xdc_String)"work";
+
+    while (workerCount < workers) {
+        task = Task_create(workerFxn, &params, Error_IGNORE);
+        if (task == NULL) {
+            break;
+        }
+        this->workers[workerCount++] = task;
+    }
+
+    return (workerCount != 0);
+}
+
+/*
+ *  ======== enqueue ========
+ *  Called with interrupts disabled
+ */
+void WorkQueue::enqueue(Work &work)
+{
+    work.state = Work::WORK_QUEUED;
+    Queue_enqueue(Queue_handle(&queues[work.priority]), &work.elem);
+    Semaphore_post(Semaphore_handle(&sem));
+}
+
+/*
+ *  ======== submit ========
+ */
+bool WorkQueue::submit(Work &work)
+{
+    bool idle;
+    UInt key;
+
+    key = Hwi_disable();
+    idle = (work.state == Work::WORK_IDLE);
+    if (idle) {
+        enqueue(work);
+    }
+    Hwi_restore(key);
+
+    return (idle);
+}
+
+/*
+ *  ======== submit ========
+ *  Queue the work delayMs from now; run from the Clock Swi then
+ */
+bool WorkQueue::submit(DelayedWork &work, uint32_t delayMs)
+{
+    Clock_Handle clock = Clock_handle(&work.clock);
+    bool idle;
+    UInt key;
+
+    if (delayMs == 0) {
+        return (submit(work));
+    }
+
+    key = Hwi_disable();
+    idle = (work.state == Work::WORK_IDLE);
+    if (idle) {
+        work.state = Work::WORK_DELAYED;
+        work.queue = this;
+        Clock_setTimeout(clock, msToTicks(delayMs));
+        Clock_start(clock);
+    }
+    Hwi_restore(key);
+
+    return (idle);
+}
+
+/*
+ *  ======== cancel ========
+ *  The Semaphore count of a cancelled item stays; a worker wakes for it
+ *  and finds nothing.
+ */
+bool WorkQueue::cancel(Work &work)
+{
+    bool waiting;
+    UInt key;
+
+    key = Hwi_disable();
+    waiting = (work.state != Work::WORK_IDLE);
+    if (work.state == Work::WORK_QUEUED) {
+        Queue_remove(&work.elem);
+    }
+    else if (work.state == Work::WORK_DELAYED) {
+        Clock_stop(Clock_handle(&((DelayedWork &)work).clock));
+    }
+    work.state = Work::WORK_IDLE;
+    Hwi_restore(key);
+
+    return (waiting);
+}
+
+/*
+ *  ======== pending ========
+ *  Items queued to run now, not counting delayed ones
+ */
+size_t WorkQueue::pending(void)
+{
+    Queue_Elem *elem;
+    size_t count = 0;
+    UInt key;
+    int i;
+
+    key = Hwi_disable();
+    for (i = 0; i < WORK_PRIORITIES; i++) {
+        Queue_Handle queue = Queue_handle(&queues[i]);
+
+        for (elem = (Queue_Elem *)Queue_head(queue);
+            elem != (Queue_Elem *)queue;
+            elem = (Queue_Elem *)Queue_next(elem)) {
+            count++;
+        }
+    }
+    Hwi_restore(key);
+
+    return (count);
+}
+
+/*
+ *  ======== workerFxn ========
+ *  An item is idle again before its fxn runs, so the fxn may submit it
+ *  again or free it
+ */
+void WorkQueue::workerFxn(UArg arg0, UArg arg1)
+{
+    WorkQueue *queue = (WorkQueue *)arg0;
+    Work *work;
+    UInt key;
+    int i;
+
+    for (;;) {
+        Semaphore_pend(Semaphore_handle(&queue->sem), BIOS_WAIT_FOREVER);
+
+        work = NULL;
+        key = Hwi_disable();
+        for (i = WORK_PRIORITIES - 1; i >= 0; i--) {
+            Queue_Handle q = Queue_handle(&queue->queues[i]);
+
+            if (!Queue_empty(q)) {
+                work = (Work *)Queue_dequeue(q);
+                work->state = Work::WORK_IDLE;
+                break;
+            }
+        }
+        Hwi_restore(key);
+
+        if (work != NULL) {
+            work->fxn(work->arg);
+        }
+    }
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== WorkQueue.h ========
+ *  Deferred work run by a few shared worker tasks, instead of a task
+ *  and a stack of its own for every job that can wait a little:
+ *
+ *      WorkQueue work;
+ *      Work flushLog(flushLogFxn);
+ *      DelayedWork retry(retrySendFxn, &client, WORK_PRIORITY_HIGH);
+ *
+ *      void setup() { work.begin(2, 1024); }
+ *
+ *      work.submit(flushLog);          // from a loop, Swi or Hwi
+ *      work.submit(retry, 500);        // in 500ms
+ *
+ *  Work items belong to the caller and are never copied or allocated.
+ *  Higher priority items run first, items of one priority in the order
+ *  they were submitted. An item is run once per submit() that found it
+ *  idle: submitting it again while it waits does nothing, and it may
+ *  be submitted again as soon as it starts running, from its own fxn
+ *  too. Its fxn runs in a worker task and may block there, which
+ *  holds up the other items only if every worker does.
+ */
+
+#ifndef WorkQueue_h
+#define WorkQueue_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ti/sysbios/knl/Clock.h>
+#include <ti/sysbios/knl/Queue.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/knl/Task.h>
+
+#define WORK_PRIORITIES         3
+#define WORK_PRIORITY_LOW       0
+#define WORK_PRIORITY_NORMAL    1
+#define WORK_PRIORITY_HIGH      2
+
+#define WORK_WORKERS_MAX        4
+
+class WorkQueue;
+
+class Work
+{
+    public:
+        Work(void (*fxn)(void *arg), void *arg = NULL,
+            uint8_t priority = WORK_PRIORITY_NORMAL);
+
+        bool pending(void) { return (state != WORK_IDLE); }
+
+    protected:
+        friend class WorkQueue;
+
+        enum State { WORK_IDLE, WORK_QUEUED, WORK_DELAYED };
+
+        Queue_Elem elem;            /* first, to get from elem to Work */
+        void (*fxn)(void *arg);
+        void *arg;
+        uint8_t priority;
+        volatile uint8_t state;
+};
+
+class DelayedWork : public Work
+{
+    public:
+        DelayedWork(void (*fxn)(void *arg), void *arg = NULL,
+            uint8_t priority = WORK_PRIORITY_NORMAL);
+        ~DelayedWork();
+
+    private:
+        friend class WorkQueue;
+
+        static void clockFxn(UArg arg);
+
+        Clock_Struct clock;
+        WorkQueue *queue;
+};
+
+class WorkQueue
+{
+    public:
+        WorkQueue(void);
+
+        /* worker tasks, each with stackSize of stack, at taskPriority */
+        bool begin(uint8_t workers = 1, size_t stackSize = 1024,
+            int taskPriority = 1);
+
+        bool submit(Work &work);                    /* any context */
+        bool submit(DelayedWork &work, uint32_t delayMs);
+        bool cancel(Work &work);    /* false if not waiting to run */
+
+        size_t pending(void);
+
+    private:
+        friend class DelayedWork;
+
+        static void workerFxn(UArg arg0, UArg arg1);
+
+        void enqueue(Work &work);
+
+        Queue_Struct queues[WORK_PRIORITIES];
+        Semaphore_Struct sem;       /* counts submits, some cancelled */
+        Task_Handle workers[WORK_WORKERS_MAX];
+        uint8_t workerCount;
+};
+
+#endif
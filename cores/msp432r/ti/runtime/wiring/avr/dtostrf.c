@@ -18,11 +18,194 @@
   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
-#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include "dtostrf.h"
+#include "../itoa.h"
+
+/* 10^n for the fraction digits, at most FORMAT_FLOAT_DIGITS of them */
+static const uint32_t fracScale[FORMAT_FLOAT_DIGITS + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+/*
+ * Formats [-]intPart.fracPart with digits fraction digits, followed by
+ * e+exp10 unless exp10 is negative, backwards from end; 26 characters
+ * at most. fracPart is already rounded and less than 10^digits.
+ */
+static char *formatFixed(int negative, uint32_t intPart, uint32_t fracPart,
+    uint8_t digits, int exp10, char *end)
+{
+    char *str = end;
+
+    if (exp10 >= 0) {
+        str = formatDecimal(exp10, str);
+        if (exp10 < 10) *--str = '0';
+        *--str = '+';
+        *--str = 'e';
+    }
+    if (digits > 0) {
+        char *point = str - digits;
+
+        str = formatDecimal(fracPart, str);
+        while (str > point) *--str = '0';
+        *--str = '.';
+    }
+    str = formatDecimal(intPart, str);
+    if (negative) *--str = '-';
+
+    return (str);
+}
+
+static char *formatSpecial(int nan, int negative, char *end)
+{
+    const char *text = nan ? "nan" : negative ? "-inf" : "inf";
+    size_t len = strlen(text);
+
+    memcpy(end - len, text, len);
+    return (end - len);
+}
+
+/*
+ * Single precision, all on the FPU: the fraction is scaled to 32-bit
+ * fixed point (exact, it has at most 24 significant bits) and the
+ * digits come from one 32x32->64 multiply, rounded half up. Values
+ * beyond the 32-bit integer part go to exponent notation.
+ */
+char *formatFloat(float number, uint8_t digits, char *end)
+{
+    static const float pow10f[10] = {
+        1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f
+    };
+    int negative = number < 0.0f;
+    int exp10 = -1;
+    uint32_t intPart, fracPart;
+
+    if (isnan(number) || isinf(number)) {
+        return (formatSpecial(isnan(number), negative, end));
+    }
+
+    if (digits > FORMAT_FLOAT_DIGITS) digits = FORMAT_FLOAT_DIGITS;
+    if (negative) number = -number;
+
+    if (number >= 4294967296.0f) {
+        int k = 9;
+
+        for (exp10 = 0; number >= 1e10f; exp10 += 10) {
+            number /= 1e10f;
+        }
+        while (k > 0 && number < pow10f[k]) k--;
+        number /= pow10f[k];
+        exp10 += k;
+    }
+
+    intPart = (uint32_t)number;
+    fracPart = (uint32_t)((number - intPart) * 4294967296.0f);
+    fracPart = ((uint64_t)fracPart * fracScale[digits] + 0x80000000) >> 32;
+    if (fracPart >= fracScale[digits]) {
+        fracPart -= fracScale[digits];
+        intPart++;
+    }
+    if (exp10 >= 0 && intPart >= 10) {
+        intPart /= 10;
+        exp10++;
+    }
+
+    return (formatFixed(negative, intPart, fracPart, digits, exp10, end));
+}
+
+/*
+ * Same scheme as formatFloat(), in software double precision: the
+ * fraction becomes 64-bit fixed point and the rounded digits are the
+ * top of fraction * 10^digits.
+ */
+char *formatDouble(double number, uint8_t digits, char *end)
+{
+    static const double pow10d[10] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9
+    };
+    int negative = number < 0.0;
+    int exp10 = -1;
+    uint32_t intPart, fracPart;
+    uint64_t fixed;
+
+    if (isnan(number) || isinf(number)) {
+        return (formatSpecial(isnan(number), negative, end));
+    }
+
+    if (digits > FORMAT_FLOAT_DIGITS) digits = FORMAT_FLOAT_DIGITS;
+    if (negative) number = -number;
+
+    if (number >= 4294967296.0) {
+        int k = 9;
+
+        for (exp10 = 0; number >= 1e10; exp10 += 10) {
+            number /= 1e10;
+        }
+        while (k > 0 && number < pow10d[k]) k--;
+        number /= pow10d[k];
+        exp10 += k;
+    }
+
+    intPart = (uint32_t)number;
+    fixed = (uint64_t)((number - intPart) * 18446744073709551616.0);
+    fracPart = ((fixed >> 32) * fracScale[digits] +
+        (((fixed & 0xffffffff) * fracScale[digits]) >> 32) + 0x80000000) >> 32;
+    if (fracPart >= fracScale[digits]) {
+        fracPart -= fracScale[digits];
+        intPart++;
+    }
+    if (exp10 >= 0 && intPart >= 10) {
+        intPart /= 10;
+        exp10++;
+    }
+
+    return (formatFixed(negative, intPart, fracPart, digits, exp10, end));
+}
+
+/*
+ * Copies the formatted str..end to sout padded with spaces to width,
+ * on the left or, for a negative width, on the right; precisions past
+ * FORMAT_FLOAT_DIGITS get trailing zeros.
+ */
+static char *padField(const char *str, const char *end, signed char width,
+    unsigned char prec, char *sout)
+{
+    size_t len = end - str;
+    const char *first = *str == '-' ? str + 1 : str;
+    int fixed = *first >= '0' && *first <= '9' && memchr(str, 'e', len) == NULL;
+    size_t zeros = fixed && prec > FORMAT_FLOAT_DIGITS ? prec - FORMAT_FLOAT_DIGITS : 0;
+    size_t field = width < 0 ? -width : width;
+    size_t pad = field > len + zeros ? field - len - zeros : 0;
+    char *p = sout;
+
+    if (width > 0) {
+        memset(p, ' ', pad);
+        p += pad;
+    }
+    memcpy(p, str, len);
+    p += len;
+    memset(p, '0', zeros);
+    p += zeros;
+    if (width < 0) {
+        memset(p, ' ', pad);
+        p += pad;
+    }
+    *p = '\0';
+
+    return (sout);
+}
 
 char *dtostrf (double val, signed char width, unsigned char prec, char *sout) {
-  char fmt[20];
-  sprintf(fmt, "%%%d.%df", width, prec);
-  sprintf(sout, fmt, val);
-  return sout;
+  char buf[32];
+  char *end = &buf[sizeof(buf)];
+
+  return padField(formatDouble(val, prec, end), end, width, prec, sout);
+}
+
+char *dtostrff (float val, signed char width, unsigned char prec, char *sout) {
+  char buf[32];
+  char *end = &buf[sizeof(buf)];
+
+  return padField(formatFloat(val, prec, end), end, width, prec, sout);
 }
@@ -22,8 +22,21 @@
 extern "C" {
 #endif
 
+#include <stdint.h>
+
 char *dtostrf (double val, signed char width, unsigned char prec, char *sout);
 
+/* dtostrf() for single precision, without software double math */
+char *dtostrff (float val, signed char width, unsigned char prec, char *sout);
+
+/* the conversions above and Print's float formatting share these: they
+ * write [-]ddd.ddd, with at most FORMAT_FLOAT_DIGITS fraction digits,
+ * or d.ddde+XX past 2^32, backwards from end without a '\0' and return
+ * the first char; 26 chars at most */
+#define FORMAT_FLOAT_DIGITS 9
+char *formatFloat (float val, uint8_t digits, char *end);
+char *formatDouble (double val, uint8_t digits, char *end);
+
 #ifdef __cplusplus
 }
 #endif
@@ -66,6 +66,119 @@ extern void itoa( int n, char s[] )
 
 #else
 
+/* "00" to "99", for two decimal digits per step */
+static const char decimalPairs[200] = {
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+
+/*
+ * Digits are written backwards from the end of the caller's buffer.
+ * Dividing by the constant 100 compiles to a multiply by its
+ * reciprocal, so the decimal path needs no UDIV; power of two bases
+ * are shifts.
+ */
+char *formatDecimal(uint32_t n, char *str)
+{
+  while (n >= 100)
+  {
+    uint32_t pair = n % 100;
+    n /= 100;
+    str -= 2;
+    str[0] = decimalPairs[pair * 2];
+    str[1] = decimalPairs[pair * 2 + 1];
+  }
+  if (n >= 10)
+  {
+    str -= 2;
+    str[0] = decimalPairs[n * 2];
+    str[1] = decimalPairs[n * 2 + 1];
+  }
+  else
+  {
+    *--str = '0' + n;
+  }
+
+  return str;
+}
+
+static char *formatPow2(uint64_t n, unsigned shift, char alpha, char *str)
+{
+  uint32_t mask = (1 << shift) - 1;
+
+  do
+  {
+    char c = n & mask;
+    *--str = c < 10 ? c + '0' : c + alpha - 10;
+    n >>= shift;
+  } while (n);
+
+  return str;
+}
+
+char *formatUnsigned64(uint64_t n, int base, int upper, char *str)
+{
+  char alpha = upper ? 'A' : 'a';
+
+  switch (base)
+  {
+    case 16: return formatPow2(n, 4, alpha, str);
+    case 8:  return formatPow2(n, 3, alpha, str);
+    case 2:  return formatPow2(n, 1, alpha, str);
+    case 10: break;
+    default:
+      if (base < 2)
+      {
+        break;    /* prevent a divide by 0 if called with base < 2 */
+      }
+      if (n <= 0xffffffffUL)
+      {
+        uint32_t v = n;    /* 32-bit divides while they will do */
+
+        do
+        {
+          uint32_t m = v;
+          v /= base;
+          char c = m - base * v;
+          *--str = c < 10 ? c + '0' : c + alpha - 10;
+        } while (v);
+        return str;
+      }
+      do
+      {
+        uint64_t m = n;
+        n /= base;
+        char c = m - base * n;
+        *--str = c < 10 ? c + '0' : c + alpha - 10;
+      } while (n);
+      return str;
+  }
+
+  /* peel off 9 digit groups with (at most two) 64-bit divides, the
+   * rest is 32-bit */
+  while (n > 0xffffffffULL)
+  {
+    uint64_t q = n / 1000000000;
+    char *group = str - 9;
+
+    str = formatDecimal((uint32_t)(n - q * 1000000000), str);
+    while (str > group)
+    {
+      *--str = '0';
+    }
+    n = q;
+  }
+  return formatDecimal((uint32_t)n, str);
+}
+
 extern char* itoa( int value, char *string, int radix )
 {
   return ltoa( value, string, radix ) ;
@@ -73,11 +186,8 @@ extern char* itoa( int value, char *string, int radix )
 
 extern char* ltoa( long value, char *string, int radix )
 {
-  char tmp[33];
-  char *tp = tmp;
-  long i;
-  unsigned long v;
-  int sign;
+  char tmp[8 * sizeof(long) + 1];
+  char *end = &tmp[sizeof(tmp)];
   char *sp;
 
   if ( string == NULL )
@@ -90,33 +200,18 @@ extern char* ltoa( long value, char *string, int radix )
     return 0 ;
   }
 
-  sign = (radix == 10 && value < 0);
-  if (sign)
+  if (radix == 10 && value < 0)
   {
-    v = -value;
+    sp = formatDecimal(0UL - (unsigned long)value, end);
+    *--sp = '-';
   }
   else
   {
-    v = (unsigned long)value;
+    sp = formatUnsigned64((unsigned long)value, radix, 0, end);
   }
 
-  while (v || tp == tmp)
-  {
-    i = v % radix;
-    v = v / radix;
-    if (i < 10)
-      *tp++ = i+'0';
-    else
-      *tp++ = i + 'a' - 10;
-  }
-
-  sp = string;
-
-  if (sign)
-    *sp++ = '-';
-  while (tp > tmp)
-    *sp++ = *--tp;
-  *sp = 0;
+  memcpy(string, sp, end - sp);
+  string[end - sp] = 0;
 
   return string;
 }
@@ -128,10 +223,8 @@ extern char* utoa( unsigned value, char *string, int radix )
 
 extern char* ultoa( unsigned long value, char *string, int radix )
 {
-  char tmp[33];
-  char *tp = tmp;
-  long i;
-  unsigned long v = value;
+  char tmp[8 * sizeof(long) + 1];
+  char *end = &tmp[sizeof(tmp)];
   char *sp;
 
   if ( string == NULL )
@@ -144,22 +237,9 @@ extern char* ultoa( unsigned long value, char *string, int radix )
     return 0;
   }
 
-  while (v || tp == tmp)
-  {
-    i = v % radix;
-    v = v / radix;
-    if (i < 10)
-      *tp++ = i+'0';
-    else
-      *tp++ = i + 'a' - 10;
-  }
-
-  sp = string;
-
-
-  while (tp > tmp)
-    *sp++ = *--tp;
-  *sp = 0;
+  sp = formatUnsigned64(value, radix, 0, end);
+  memcpy(string, sp, end - sp);
+  string[end - sp] = 0;
 
   return string;
 }
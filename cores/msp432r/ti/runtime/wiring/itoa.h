@@ -19,6 +19,8 @@
 #ifndef _ITOA_
 #define _ITOA_
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C"{
 #endif // __cplusplus
@@ -41,6 +43,12 @@ extern char* itoa( int value, char *string, int radix ) ;
 extern char* ltoa( long value, char *string, int radix ) ;
 extern char* utoa( unsigned value, char *string, int radix ) ;
 extern char* ultoa( unsigned long value, char *string, int radix ) ;
+
+/* the conversions above and Print's number formatting share these: the
+ * digits are written backwards from end, without a '\0', and the first
+ * one is returned; upper selects 'A' rather than 'a' for digits past 9 */
+extern char* formatDecimal( uint32_t value, char *end ) ;
+extern char* formatUnsigned64( uint64_t value, int radix, int upper, char *end ) ;
 #endif /* 0 */
 
 #ifdef __cplusplus
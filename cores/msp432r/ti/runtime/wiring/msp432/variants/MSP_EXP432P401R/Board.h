@@ -90,6 +90,29 @@ typedef enum Board_ADCName {
     Board_ADCCOUNT
 } Board_ADCName;
 
+/*!
+ *  @def    Board_ADCBufName
+ *  @brief  Enum of ADCBuf names on the MSP_EXP432P401R dev board
+ */
+typedef enum Board_ADCBufName {
+    Board_ADCBUF0 = 0,
+
+    Board_ADCBUFCOUNT
+} Board_ADCBufName;
+
+/*!
+ *  @def    Board_CaptureName
+ *  @brief  Enum of Capture names on the MSP_EXP432P401R dev board
+ */
+typedef enum Board_CaptureName {
+    Board_CAPTURE_TA2_P5_6 = 0,
+    Board_CAPTURE_TA2_P5_7,
+    Board_CAPTURE_TA2_P6_6,
+    Board_CAPTURE_TA2_P6_7,
+
+    Board_CAPTURECOUNT
+} Board_CaptureName;
+
 /*!
  *  @def    Board_GPIOName
  *  @brief  Enum of GPIO names on the MSP_EXP432P401R Launch Pad dev board
@@ -116,6 +139,17 @@ typedef enum Board_I2CName {
     Board_I2CCOUNT
 } Board_I2CName;
 
+/*!
+ *  @def    Board_I2CSlaveName
+ *  @brief  Enum of I2CSlave names on the MSP_EXP432P401R Launch Pad dev board
+ */
+typedef enum Board_I2CSlaveName {
+    Board_I2CSLAVEB0 = 0,
+    Board_I2CSLAVEB1,
+
+    Board_I2CSLAVECOUNT
+} Board_I2CSlaveName;
+
 /*!
  *  @def    Board_PWMName
  *  @brief  Enum of PWM names on the MSP_EXP432P401R Launch Pad dev board
@@ -154,6 +188,8 @@ typedef enum Board_SDSPIName {
 typedef enum Board_SPIName {
     Board_SPIB0 = 0,
     Board_SPIB2,
+    Board_SPIB1,
+    Board_SPIB3,
 
     Board_SPICOUNT
 } Board_SPIName;
@@ -179,6 +215,8 @@ typedef enum Board_TimerName {
 typedef enum Board_UARTName {
     Board_UARTA0 = 0,
     Board_UARTA2,
+    Board_UARTA1,
+    Board_UARTA3,
 
     Board_UARTCOUNT
 } Board_UARTName;
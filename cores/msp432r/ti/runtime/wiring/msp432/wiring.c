@@ -35,11 +35,13 @@
 
 #include <xdc/runtime/Timestamp.h>
 #include <xdc/runtime/Types.h>
-#define ti_sysbios_knl_Clock__internalaccess
+#include <ti/sysbios/BIOS.h>
 #include <ti/sysbios/knl/Clock.h>
+#include <ti/sysbios/knl/Swi.h>
 #include <ti/sysbios/knl/Task.h>
 
 #include <ti/sysbios/family/arm/m3/Hwi.h>
+#include <ti/sysbios/family/arm/msp432/Timer.h>
 
 #include <ti/drivers/Power.h>
 #include <ti/drivers/power/PowerMSP432.h>
@@ -49,149 +51,285 @@
 
 #include <driverlib/rom.h>
 #include <driverlib/rom_map.h>
-#include <driverlib/wdt_a.h>
-
-static uint8_t delayMode = 0; /* determines  which tick source is driving Clock_tick */
+#include <driverlib/cpu.h>
+#include <driverlib/interrupt.h>
+#include <driverlib/rtc_c.h>
 
 /*
- *  ======== micros ========
+ * micros() converts Timestamp counts (CPU cycles) with a 0.32 fixed
+ * point multiplier instead of a 64 bit division. Performance level
+ * changes move the Timestamp frequency, so the count and time at the
+ * last change are kept as a base and only counts since then are
+ * scaled with the current multiplier.
  */
-unsigned long micros(void)
+static uint32_t microsScale;        /* us per count * 2^32 */
+static uint64_t microsBaseCount;
+static uint64_t microsBaseUs;
+static uint32_t microsSleepFrac;    /* 1/512 us left over from idle */
+static Power_NotifyObj microsNotifyObj;
+
+static inline uint64_t timestampCount(void)
 {
-    Types_FreqHz freq;
     Types_Timestamp64 time;
-    uint64_t t64;
 
-    Timestamp_getFreq(&freq);
     Timestamp_get64(&time);
-    t64 = ((uint64_t)time.hi << 32) | time.lo;
-    return (t64/(freq.lo/1000000));
+
+    return (((uint64_t)time.hi << 32) | time.lo);
+}
+
+static inline uint64_t countsToMicros(uint64_t counts)
+{
+    return ((((uint64_t)(uint32_t)counts * microsScale) >> 32) +
+        (uint64_t)(uint32_t)(counts >> 32) * microsScale);
+}
+
+/* MCLK cycles per us for delayMicroseconds(), 0 until microsInit() */
+uint32_t delayCyclesPerUs = 0;
+
+static void microsSetScale(void)
+{
+    Types_FreqHz freq;
+
+    Timestamp_getFreq(&freq);
+    microsScale = ((1000000ULL << 32) + freq.lo / 2) / freq.lo;
+
+    BIOS_getCpuFreq(&freq);
+    delayCyclesPerUs = freq.lo / 1000000;
 }
 
 /*
- *  ======== millis ========
+ *  ======== microsPerfChangeNotifyFxn ========
  */
-unsigned long millis(void)
+static int_fast16_t microsPerfChangeNotifyFxn(uint_fast16_t eventType,
+    uintptr_t eventArg, uintptr_t clientArg)
 {
-    return (Clock_getTicks());
+    uint64_t now;
+    uint32_t hwiKey;
+
+    hwiKey = Hwi_disable();
+
+    now = timestampCount();
+    microsBaseUs += countsToMicros(now - microsBaseCount);
+    microsBaseCount = now;
+    microsSetScale();
+
+    Hwi_restore(hwiKey);
+
+    return (Power_NOTIFYDONE);
 }
 
 /*
- *  ======== delayMicroseconds ========
- *  Delay for the given number of microseconds.
+ *  ======== microsInit ========
+ *  Also starts the cycle counter delayMicroseconds() spins on
  */
-void delayMicroseconds(unsigned int us)
+static void microsInit(void)
 {
-    if (us <7) {
-        //The overhead in calling and returning from this function takes about 6us
-    }
-    else if (us <=20) {
-        int time;
-        for (time = 5*(us-6); time > 0; time--) {
-            asm("   nop");
-        }
-    }
-    else if (us < 70) {
-        int time;
-        for (time = 5*us; time > 0; time--) {
-            asm("   nop");
-        }
+    uint32_t hwiKey;
+
+    hwiKey = Hwi_disable();
+
+    if (microsScale == 0) {
+        cyclesEnable();
+        microsSetScale();
+        Power_registerNotify(&microsNotifyObj,
+            PowerMSP432_DONE_CHANGE_PERF_LEVEL, microsPerfChangeNotifyFxn, 0);
     }
-    else {
-        uint32_t t0, deltaT;
-        Types_FreqHz freq;
 
-        Timestamp_getFreq(&freq);
-        deltaT = us * (freq.lo/1000000);
+    Hwi_restore(hwiKey);
+}
+
+/*
+ *  ======== microsAddSleep ========
+ *  Timestamp counts stop with MCLK in DEEPSLEEP_0; credit the 32kHz
+ *  counts the tickless idle slept (1 count = 15625/512 us).
+ *  Called with interrupts disabled.
+ */
+static void microsAddSleep(uint32_t counts)
+{
+    uint32_t scaled = counts * 15625 + microsSleepFrac;
+
+    microsBaseUs += scaled >> 9;
+    microsSleepFrac = scaled & 511;
+}
 
-        t0 = Timestamp_get32();
+/*
+ *  ======== micros64 ========
+ *  Microseconds since boot, without micros()' 71 minute wrap
+ */
+uint64_t micros64(void)
+{
+    uint64_t us;
+    uint32_t hwiKey;
 
-        while ((Timestamp_get32()-t0) < deltaT) {
-            ;
-        }
+    if (microsScale == 0) {
+        microsInit();
     }
+
+    hwiKey = Hwi_disable();
+    us = microsBaseUs + countsToMicros(timestampCount() - microsBaseCount);
+    Hwi_restore(hwiKey);
+
+    return (us);
 }
 
 /*
- *  ======== clockTickFxn ========
- *
- *  250ms Watchdog Timer interrupt handler.
+ *  ======== micros ========
  */
-static void clockTickFxn(uintptr_t arg)
+unsigned long micros(void)
 {
-    /*
-     * Bump Clock tick count by 249.
-     * Clock_tick() will bump it one more
-     */
-    ((ti_sysbios_knl_Clock_Module_State *)(&ti_sysbios_knl_Clock_Module__state__V))->ticks += 249;
+    return ((unsigned long)micros64());
+}
 
-    Clock_tick();
+/*
+ *  ======== cyclesEnable ========
+ *  Start the DWT cycle counter for cycles(); a debugger may have
+ *  started it already.
+ */
+void cyclesEnable(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 }
 
 /*
- *  ======== switchToWatchdogTimer ========
- *
- *  Use 250ms watchdog timer interrupt to drive the Clock tick
- *  Stop the default Timer_A then start the watchdog timer.
+ * Boot trace for bootTraceMark(): the first mark, at Board_init()
+ * entry, starts the cycle counter and is time 0. Later marks are kept
+ * in us from there; the C runtime's own init before main() is not seen.
+ */
+static BootTraceStage bootTrace[BOOT_TRACE_STAGES];
+static uint8_t bootTraceCount;
+static uint32_t bootTraceCycles;
+
+/*
+ *  ======== bootTraceMark ========
+ *  Timestamp the end of a boot stage; marks after the table is full
+ *  are dropped
  */
-static void switchToWatchdogTimer()
+void bootTraceMark(const char *name)
 {
-    Clock_TimerProxy_Handle clockTimer;
-    static Hwi_Handle wdtHwi = NULL;
+    uint32_t now, us = 0;
+    uint32_t hwiKey;
 
-    /* Stop Timer_A currrently being used by Clock */
-    clockTimer = Clock_getTimerHandle();
-    Clock_TimerProxy_stop(clockTimer);
+    hwiKey = Hwi_disable();
 
-    MAP_WDT_A_holdTimer();
+    if (bootTraceCount < BOOT_TRACE_STAGES) {
+        now = cycles();
+        if (bootTraceCount != 0) {
+            us = bootTrace[bootTraceCount - 1].us +
+                (now - bootTraceCycles) / (getCpuFrequency() / 1000000);
+        }
+        bootTraceCycles = now;
+
+        bootTrace[bootTraceCount].name = name;
+        bootTrace[bootTraceCount].us = us;
+        bootTraceCount++;
+    }
+
+    Hwi_restore(hwiKey);
+}
 
-    if (wdtHwi == NULL) {
-        /* Create watchdog Timer Hwi */
-        wdtHwi = Hwi_create(19, clockTickFxn, NULL, NULL);
+/*
+ *  ======== bootTraceGet ========
+ *  Copy up to max marks into stages, returns the number copied
+ */
+uint8_t bootTraceGet(BootTraceStage *stages, uint8_t max)
+{
+    uint8_t i;
 
-        /* set WDT to use 32KHz input, 250ms period */
-        MAP_WDT_A_initIntervalTimer(WDT_A_CLOCKSOURCE_BCLK, WDT_A_CLOCKITERATIONS_8192);
+    for (i = 0; i < max && i < bootTraceCount; i++) {
+        stages[i] = bootTrace[i];
     }
 
-    /* remove DEEPSLEEP0 constraint left from TimerA usage */
-    Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+    return (i);
+}
+
+/*
+ * millis() reads millisCount, which the Clock tick keeps. A tick is 32
+ * ACLK counts, 976.5625us rather than Clock_tickPeriod's 1000us, so
+ * whole milliseconds are carried out of a 1/16us remainder instead of
+ * counting ticks. The tickless idle credits the ticks it skipped.
+ */
+#define MILLIS_FRAC_PER_MS  16000   /* 1/16 us */
 
-    /* don't allow deeper than DEEPSLEEP1 */
-    Power_setConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_1);
+volatile uint32_t millisCount = 0;
+static uint32_t millisFrac;
+static uint32_t millisFracPerTick;
+static Timer_FuncPtr millisClockTickFxn;
+static UArg millisClockTickArg;
 
-    /* Start watchdog Timer */
-    MAP_WDT_A_clearTimer();
-    MAP_WDT_A_startTimer();
+/*
+ *  ======== millisAddTicks ========
+ *  Called with interrupts disabled
+ */
+static void millisAddTicks(uint32_t ticks)
+{
+    uint32_t frac = millisFrac + ticks * millisFracPerTick;
 
-    /* hence, Clock_tick() will be called from 250ms watchdog timer interrupt */
+    millisCount += frac / MILLIS_FRAC_PER_MS;
+    millisFrac = frac % MILLIS_FRAC_PER_MS;
 }
 
 /*
- *  ======== switchToTimerA ========
- *
- *  Use 1ms Timer_A interrupt to drive the Clock tick
- *  By default, the Timer_A Hwi object has already been
- *  statically created and configured to call Clock_tick().
- *  Simply stop the watchdog timer and restart the Timer_A.
+ *  ======== millisTickFxn ========
+ *  Runs in place of the Clock timer's tickFxn, Clock_doTick()
  */
-static void switchToTimerA()
+static void millisTickFxn(UArg arg)
 {
-    Clock_TimerProxy_Handle clockTimer;
+    millisFrac += millisFracPerTick;
+    if (millisFrac >= MILLIS_FRAC_PER_MS) {
+        millisFrac -= MILLIS_FRAC_PER_MS;
+        millisCount++;
+    }
+
+    millisClockTickFxn(arg);
+}
+
+/*
+ *  ======== millisInit ========
+ *  Hook the Clock timer's tick function before the kernel starts it
+ */
+static void millisInit(void)
+{
+    Timer_Handle timer = (Timer_Handle)Clock_getTimerHandle();
+    Types_FreqHz freq;
 
-    /* Stop watchdog Timer */
-    MAP_WDT_A_holdTimer();
+    Timer_getFreq(timer, &freq);
+    millisFracPerTick = (uint32_t)((uint64_t)Timer_getPeriod(timer) *
+        MILLIS_FRAC_PER_MS * 1000 / freq.lo);
 
-    /* remove DEEPSLEEP1 constraint left from watchdog usage */
-    Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_1);
+    millisClockTickFxn = Timer_getFunc(timer, &millisClockTickArg);
+    Timer_setFunc(timer, millisTickFxn, millisClockTickArg);
+}
+
+/*
+ *  ======== delayMicrosecondsSpin ========
+ *  Spin on the DWT cycle counter for us * MCLK/1MHz cycles. Time spent
+ *  in interrupts counts toward the delay. delayMicroseconds() in
+ *  Energia.h calls this for all but small constant arguments.
+ */
+void delayMicrosecondsSpin(unsigned int us)
+{
+    uint32_t start;
+    uint32_t perUs;
 
-    /* don't all the power to be cut in deep sleep */
-    Power_setConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+    if (delayCyclesPerUs == 0) {
+        microsInit();
+    }
+    start = cycles();
+    perUs = delayCyclesPerUs;
 
-    /* Re-start Timer_A */
-    clockTimer = Clock_getTimerHandle();
-    Clock_TimerProxy_start(clockTimer);
+    /* us * perUs overflows 32 bits after ~89s at 48MHz */
+    while (us > 1000000) {
+        while ((cycles() - start) < 1000000 * perUs) {
+            ;
+        }
+        start += 1000000 * perUs;
+        us -= 1000000;
+    }
 
-    /* hence, Clock_tick() will be called from 1ms Timer_A interrupt */
+    while ((cycles() - start) < us * perUs) {
+        ;
+    }
 }
 
 /*
@@ -199,64 +337,434 @@ static void switchToTimerA()
  */
 void delay(uint32_t milliseconds)
 {
+    traceEvent(TRACE_DELAY, 0, milliseconds);
+
     if (milliseconds == 0) {
         Task_yield();
-        return;
     }
-
-    switch (delayMode) {
-        /* using Timer_A, check for opportunity to transition to WDT */
-        case 0:
-            if ( (milliseconds >= 250) && (milliseconds % 250) == 0) {
-                delayMode = 1;
-                switchToWatchdogTimer();
-            }
-            else {
-                delayMode = 2;
-                switchToTimerA();
-            }
-            break;
-        /* using WDT, check for need to transition to Timer_A */
-        case 1:
-            if ( (milliseconds >= 250) && (milliseconds % 250) == 0) {
-                /* stay in mode 1 */
-            }
-            else {
-                /* switch to Timer_A and never look back */
-                delayMode = 2;
-                switchToTimerA();
-            }
-            break;
-        /* always using Timer_A */
-        case 2:
-            break;
+    else {
+        /* timeout is always in milliseconds so that Clock_workFunc() behaves properly */
+        Task_sleep(milliseconds);
     }
 
-    /* timeout is always in milliseconds so that Clock_workFunc() behaves properly */
-    Task_sleep(milliseconds);
+    traceEvent(TRACE_DELAY | TRACE_END, 0, milliseconds);
 }
 
 /*
  *  ======== setDelayResolution ========
  *
- *  For now, only two resolutions are supported: 1ms and 250ms
+ *  Idle is tickless for any delay() length, see wiringIdlePolicy();
+ *  kept for sketches written for the old 250ms watchdog tick.
  */
 void setDelayResolution(uint32_t milliseconds)
 {
-    if (milliseconds == 250) {
-        if ((delayMode == 0) || (delayMode == 2)) {
-            switchToWatchdogTimer();
-            delayMode = 1;
-        }
+}
+
+/*
+ *  ======== setPerformanceLevel ========
+ *  Switch MCLK/SMCLK to one of PowerMSP432_perfLevels[] (0: 12/3MHz,
+ *  1: 24/6MHz, 2: 48/12MHz). micros(), delayMicroseconds(), the
+ *  microTimer service, SPI, Wire, Serial and analogWrite() re-derive
+ *  their dividers from DONE_CHANGE_PERF_LEVEL notifications. Must be
+ *  called from a Task; fails if a driver holds a constraint against
+ *  the change, e.g. a Serial baud rate the new SMCLK can't make.
+ */
+bool setPerformanceLevel(uint8_t level)
+{
+    if (level >= PowerMSP432_getNumPerfLevels()) {
+        return (false);
+    }
+
+    return (Power_setPerformanceLevel(level) == Power_SOK);
+}
+
+/*
+ *  ======== getPerformanceLevel ========
+ */
+uint8_t getPerformanceLevel(void)
+{
+    return ((uint8_t)Power_getPerformanceLevel());
+}
+
+/*
+ * Tickless idle. The Clock tick is TA3 on ACLK, but DEEPSLEEP_0 (LPM3)
+ * only keeps RTC_C and WDT_A clocked. When no Clock timeout is due for
+ * IDLE_MIN_TICKS, the idle policy stops TA3 and sleeps in DEEPSLEEP_0
+ * until an RTC_C prescaler interrupt that comes no later than that
+ * timeout, or until any other wakeup. The RTC_C prescale counter
+ * (RTCPS, 32kHz like ACLK) then says how long it slept: the Clock is
+ * advanced by the whole ticks with Clock_setTicks() and the tick
+ * restarted. Clock_tickStart() starts a whole tick period, so the
+ * counts left over are carried to the next sleep.
+ */
+
+#define IDLE_MIN_TICKS      2
+#define IDLE_MAX_SHIFT      15      /* at most 2^15 counts (1s) per sleep */
+
+/*
+ *  ======== idleRtcCount ========
+ *  RTCPS runs on BCLK, asynchronous to MCLK; read until stable.
+ */
+static uint16_t idleRtcCount(void)
+{
+    uint16_t ps;
+
+    do {
+        ps = RTC_C->PS;
+    } while (ps != RTC_C->PS);
+
+    return (ps);
+}
+
+/*
+ *  ======== idleRtcArm ========
+ *  Interrupt on the next 2^shift count boundary of RTCPS: bit shift-1
+ *  of RT0PS for shifts up to 8, of RT1PS (RTCPS / 256) beyond.
+ */
+static void idleRtcArm(uint32_t shift)
+{
+    if (shift <= 8) {
+        RTC_C->PS0CTL = ((shift - 1) << RTC_C_PS0CTL_RT0IP_OFS) |
+            RTC_C_PS0CTL_RT0PSIE;
     }
     else {
-        if (delayMode == 1) {
-            switchToTimerA();
-            delayMode = 2;
+        RTC_C->PS1CTL = ((shift - 9) << RTC_C_PS1CTL_RT1IP_OFS) |
+            RTC_C_PS1CTL_RT1PSIE;
+    }
+}
+
+/*
+ *  ======== idleRtcDisarm ========
+ */
+static void idleRtcDisarm(void)
+{
+    RTC_C->PS0CTL &= ~(RTC_C_PS0CTL_RT0PSIE | RTC_C_PS0CTL_RT0PSIFG);
+    RTC_C->PS1CTL &= ~(RTC_C_PS1CTL_RT1PSIE | RTC_C_PS1CTL_RT1PSIFG);
+}
+
+/* calendar interrupts of RTC_C, see rtcAttach() */
+static void (*rtcCalendarFxn)(void);
+
+/*
+ *  ======== idleRtcHwiFxn ========
+ *  The prescaler interrupts are only there to wake the CPU; calendar
+ *  events, alarms and ready interrupts go to the RTC class.
+ */
+static void idleRtcHwiFxn(uintptr_t arg)
+{
+    idleRtcDisarm();
+
+    if (rtcCalendarFxn != NULL) {
+        rtcCalendarFxn();
+    }
+    else {
+        /* left enabled across a reset or powerShutdown(), before RTC.init() */
+        MAP_RTC_C_clearInterruptFlag(RTC_C_CLOCK_ALARM_INTERRUPT |
+            RTC_C_TIME_EVENT_INTERRUPT | RTC_C_CLOCK_READ_READY_INTERRUPT |
+            RTC_C_OSCILLATOR_FAULT_INTERRUPT);
+    }
+}
+
+/*
+ *  ======== rtcAttach ========
+ *  Share INT_RTC_C with the tickless idle; fxn clears its own flags.
+ */
+void rtcAttach(void (*fxn)(void))
+{
+    rtcCalendarFxn = fxn;
+}
+
+/* counts of the tick period slept but not yet credited as a tick */
+static uint32_t idleCarry;
+
+/*
+ *  ======== idleTickless ========
+ *  Called with interrupts, Swis and Tasks disabled. Returns false,
+ *  without sleeping, if a Clock timeout or tick is too close.
+ */
+static bool idleTickless(void)
+{
+    Timer_Handle timer = (Timer_Handle)Clock_getTimerHandle();
+    uint32_t skip, period, since, target, shift, ticks, elapsed;
+    uint16_t ps;
+
+    period = Timer_getPeriod(timer);
+
+    /* a tick is already due, let the Clock have it */
+    if (Timer_getExpiredCounts(timer) >= period) {
+        return (false);
+    }
+
+    skip = Clock_getTicksUntilTimeout();
+    if (skip < IDLE_MIN_TICKS) {
+        return (false);
+    }
+
+    /*
+     * Stopping clears a tick that came since, but the counts since the
+     * last one still show it.
+     */
+    Clock_tickStop();
+    ps = idleRtcCount();
+    since = Timer_getExpiredCounts(timer) + idleCarry;
+
+    /* counts until the tick that makes the timeout due */
+    if (skip > (1 << IDLE_MAX_SHIFT) / period + 1) {
+        target = 1 << IDLE_MAX_SHIFT;
+    }
+    else if (since < skip * period) {
+        target = skip * period - since;
+    }
+    else {
+        target = 0;
+    }
+
+    elapsed = 0;
+    if (target >= 2) {
+        /* the largest boundary interval that can't overshoot the target */
+        shift = 31 - __builtin_clz(target);
+        if (shift > IDLE_MAX_SHIFT) {
+            shift = IDLE_MAX_SHIFT;
+        }
+
+        idleRtcArm(shift);
+        Power_sleep(PowerMSP432_DEEPSLEEP_0);
+        idleRtcDisarm();
+
+        elapsed = (uint16_t)(idleRtcCount() - ps);
+    }
+
+    since += elapsed;
+    ticks = since / period;
+    if (ticks > skip) {
+        ticks = skip;
+    }
+    idleCarry = since - ticks * period;
+
+    /*
+     * Account for all but the last tick here and deliver that one
+     * through the Clock's tick function: Clock_workFunc() only services
+     * the ticks the tick function posts it for.
+     */
+    if (ticks > 0) {
+        Clock_setTicks(Clock_getTicks() + ticks - 1);
+        millisAddTicks(ticks - 1);
+    }
+    Clock_tickStart();
+    if (ticks > 0) {
+        millisTickFxn(millisClockTickArg);
+    }
+
+    microsAddSleep(elapsed);
+
+    return (true);
+}
+
+/* set if this boot is powerShutdown()'s wakeup */
+static bool idleFromShutdown;
+
+/*
+ *  ======== wiringIdleInitPolicy ========
+ *  Power policy init, see PowerMSP432_config in Board_init.c. Starts
+ *  RTC_C's prescalers; the calendar registers are left alone. Runs
+ *  from Board_init() before BIOS_start(), so it is also where the
+ *  millis() tick hook goes in. The LPM3.5 reset flag is sticky, so
+ *  it is latched here and cleared for the next boot.
+ */
+void wiringIdleInitPolicy(void)
+{
+    millisInit();
+
+    idleFromShutdown =
+        (RSTCTL->PCMRESET_STAT & RSTCTL_PCMRESET_STAT_LPM35) != 0;
+    RSTCTL->PCMRESET_CLR = RSTCTL_PCMRESET_CLR_CLR;
+
+    RTC_C->CTL0 = RTC_C_KEY;
+    RTC_C->CTL13 &= ~RTC_C_CTL13_HOLD;
+    RTC_C->CTL0 = 0;
+
+    Hwi_create(INT_RTC_C, idleRtcHwiFxn, NULL, NULL);
+}
+
+/*
+ * Idle accounting for powerStatsGet(): time and entries per idle state
+ * since powerStatsReset(), and the interrupt that ended each one. The
+ * wakeup is still pending in the NVIC when the policy looks, as PRIMASK
+ * holds it off until CPU_cpsie().
+ */
+static PowerStats powerStats;
+static uint64_t powerStatsStart;
+
+/*
+ *  ======== powerStatsWake ========
+ *  Called with interrupts disabled
+ */
+static void powerStatsWake(uint32_t state, uint64_t start)
+{
+    uint32_t i, pending;
+
+    powerStats.stateUs[state] += micros64() - start;
+    powerStats.stateCount[state]++;
+
+    for (i = 0; i < 2; i++) {
+        pending = NVIC->ISPR[i] & NVIC->ISER[i];
+        if (pending != 0) {
+            powerStats.wakeups[i * 32 + __builtin_ctz(pending)]++;
+            return;
         }
     }
 }
 
+/*
+ * \brief           Reads the idle state residency counters.
+ * \param[out] stats Time and entries per POWER_STATS_* state and wakeups
+ *                   per interrupt number since powerStatsReset(); the
+ *                   rest of elapsedUs was spent running.
+ */
+void powerStatsGet(PowerStats *stats)
+{
+    uint32_t hwiKey;
+    uint64_t now = micros64();
+
+    hwiKey = Hwi_disable();
+    *stats = powerStats;
+    stats->elapsedUs = now - powerStatsStart;
+    Hwi_restore(hwiKey);
+}
+
+/*
+ * \brief           Clears the idle state residency counters.
+ */
+void powerStatsReset(void)
+{
+    uint32_t hwiKey;
+    uint64_t now = micros64();
+
+    hwiKey = Hwi_disable();
+    memset(&powerStats, 0, sizeof(powerStats));
+    powerStatsStart = now;
+    Hwi_restore(hwiKey);
+}
+
+/*
+ * The idle mode caps how deep wiringIdlePolicy() goes. It is held as
+ * a Power constraint like any driver's, so a driver that needs the
+ * CPU shallower still wins; IDLE_DEEPSLEEP holds none.
+ */
+static const uint8_t idleModeConstraints[] = {
+    PowerMSP432_DISALLOW_SLEEP,         /* IDLE_WFI */
+    PowerMSP432_DISALLOW_DEEPSLEEP_0    /* IDLE_SLEEP */
+};
+
+static uint8_t idleMode = IDLE_DEEPSLEEP;
+
+/*
+ *  ======== setIdleMode ========
+ *  IDLE_WFI, IDLE_SLEEP (LPM0) or IDLE_DEEPSLEEP (tickless LPM3, the
+ *  default): the deepest state the idle loop may enter
+ */
+bool setIdleMode(uint8_t mode)
+{
+    uint32_t hwiKey;
+
+    if (mode > IDLE_DEEPSLEEP) {
+        return (false);
+    }
+
+    hwiKey = Hwi_disable();
+
+    if (mode != idleMode) {
+        if (mode != IDLE_DEEPSLEEP) {
+            Power_setConstraint(idleModeConstraints[mode]);
+        }
+        if (idleMode != IDLE_DEEPSLEEP) {
+            Power_releaseConstraint(idleModeConstraints[idleMode]);
+        }
+        idleMode = mode;
+    }
+
+    Hwi_restore(hwiKey);
+
+    return (true);
+}
+
+/*
+ *  ======== getIdleMode ========
+ */
+uint8_t getIdleMode(void)
+{
+    return (idleMode);
+}
+
+/*
+ *  ======== powerShutdown ========
+ *  Enter LPM3.5. Only RTC_C keeps running: an RTC.setAlarm() alarm
+ *  or attachPeriodic() event wakes the board through a reset, and
+ *  the sketch starts over with powerWokeFromShutdown() true. SRAM is
+ *  not kept. Only returns, with false, if a Power client holds
+ *  DISALLOW_SHUTDOWN_0 or fails the ENTERING_SHUTDOWN notification.
+ */
+bool powerShutdown(void)
+{
+    idleRtcDisarm();
+
+    return (Power_shutdown(PowerMSP432_SHUTDOWN_0, 0) == Power_SOK);
+}
+
+/*
+ *  ======== powerWokeFromShutdown ========
+ */
+bool powerWokeFromShutdown(void)
+{
+    return (idleFromShutdown);
+}
+
+/*
+ *  ======== wiringIdlePolicy ========
+ *  Power policy run from the idle loop: tickless DEEPSLEEP_0 when the
+ *  constraints allow it, else SLEEP, else WFI. DEEPSLEEP_1 (LPM4)
+ *  would stop RTC_C too, so it is never used.
+ */
+void wiringIdlePolicy(void)
+{
+    uint32_t constraints;
+    bool slept = false;
+    uint32_t swiKey;
+    uint32_t taskKey;
+    uint64_t start;
+
+    /* PRIMASK rather than BASEPRI, so pending interrupts end the WFI */
+    CPU_cpsid();
+    swiKey = Swi_disable();
+    taskKey = Task_disable();
+
+    constraints = Power_getConstraintMask();
+    start = micros64();
+
+    if ((constraints & ((1 << PowerMSP432_DISALLOW_SLEEP) |
+                        (1 << PowerMSP432_DISALLOW_DEEPSLEEP_0))) == 0) {
+        slept = idleTickless();
+        if (slept) {
+            powerStatsWake(POWER_STATS_DEEPSLEEP_0, start);
+        }
+    }
+
+    if (!slept && (constraints & (1 << PowerMSP432_DISALLOW_SLEEP)) == 0) {
+        Power_sleep(PowerMSP432_SLEEP);
+        powerStatsWake(POWER_STATS_SLEEP, start);
+        slept = true;
+    }
+
+    if (!slept) {
+        __asm(" wfi");
+        powerStatsWake(POWER_STATS_WFI, start);
+    }
+
+    CPU_cpsie();
+    Swi_restore(swiKey);
+    Task_restore(taskKey);
+}
+
 /*
  *  ======== getSpiInfo ========
  *
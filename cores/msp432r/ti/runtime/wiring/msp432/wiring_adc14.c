@@ -0,0 +1,641 @@
+/*
+ * Copyright (c) 2015, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * analogRead() extensions that program ADC14 directly: the ADCMSP432
+ * driver converts one channel through MEM0 per call, these use the
+ * 32 conversion memories and the sequence modes.
+ *
+ * Pins go through analogRead() once to get plumbed and opened, the
+ * ADC is then left the way ADCMSP432's initHw() configured it:
+ * single-sample MEM0, manual iteration, ADC14SC trigger.
+ */
+
+#include <ti/runtime/wiring/wiring_private.h>
+
+#include <ti/drivers/Power.h>
+#include <ti/drivers/power/PowerMSP432.h>
+
+#include <ti/drivers/ADC.h>
+#include <ti/drivers/adc/ADCMSP432.h>
+
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+#include <xdc/runtime/Timestamp.h>
+
+#include <driverlib/rom.h>
+#include <driverlib/rom_map.h>
+#include <driverlib/adc14.h>
+#include <driverlib/ref_a.h>
+#include <driverlib/interrupt.h>
+
+#define ADC_MEMORIES    32
+
+/* channel field of an ADCMSP432_Px_y_An pin encoding */
+#define PinConfigChannel(config) (((config) >> 10) & 0x1F)
+
+extern ADCMSP432_HWAttrsV1 adcMSP432HWAttrs[];
+
+/*
+ *  ======== adcReference ========
+ *  The conversion memory reference selection for analogReference()'s
+ *  setting, turning on the internal reference if that is used.
+ */
+static uint32_t adcReference(void)
+{
+    uint_fast16_t refVoltage = adcMSP432HWAttrs[0].refVoltage;
+
+    switch (refVoltage) {
+        case ADCMSP432_REF_VOLTAGE_INT_1_2V:
+        case ADCMSP432_REF_VOLTAGE_INT_1_45V:
+        case ADCMSP432_REF_VOLTAGE_INT_2_5V:
+            MAP_REF_A_setReferenceVoltage(refVoltage);
+            MAP_REF_A_enableReferenceVoltage();
+            return (ADC_VREFPOS_INTBUF_VREFNEG_VSS);
+
+        case ADCMSP432_REF_VOLTAGE_EXT:
+            return (ADC_VREFPOS_EXTPOS_VREFNEG_EXTNEG);
+
+        case ADCMSP432_REF_VOLTAGE_EXT_BUF:
+            return (ADC_VREFPOS_EXTBUF_VREFNEG_EXTNEG);
+
+        default:
+            return (ADC_VREFPOS_AVCC_VREFNEG_VSS);
+    }
+}
+
+/*
+ *  ======== adcScale ========
+ *  A 14 bit sample at analogReadResolution()'s width.
+ */
+static inline uint16_t adcScale(uint16_t sample)
+{
+    if (analogReadShift >= 0) {
+        return (sample >> analogReadShift);
+    }
+    else {
+        return (sample << -analogReadShift);
+    }
+}
+
+/*
+ *  ======== adcPrepare ========
+ *  ADC channel of pin, plumbing it through analogRead() first if it
+ *  isn't in analog input mode yet; -1 if the pin has no channel.
+ */
+static int adcPrepare(uint8_t pin)
+{
+    uint8_t adcIndex = digital_pin_to_adc_index[pin];
+
+    if (adcIndex == NOT_ON_ADC) {
+        return (-1);
+    }
+
+    if (digital_pin_to_pin_function[pin] != PIN_FUNC_ANALOG_INPUT) {
+        analogRead(pin);
+        if (digital_pin_to_pin_function[pin] != PIN_FUNC_ANALOG_INPUT) {
+            return (-1);
+        }
+    }
+
+    return (PinConfigChannel(adcMSP432HWAttrs[adcIndex].adcPin));
+}
+
+/*
+ *  ======== adcSingleMode ========
+ *  Back to the single-sample MEM0 setup ADCMSP432_convert() expects.
+ */
+static void adcSingleMode(void)
+{
+    MAP_ADC14_configureSingleSampleMode(ADC_MEM0, false);
+    MAP_ADC14_enableSampleTimer(ADC_MANUAL_ITERATION);
+}
+
+/*
+ *  ======== adcSequence ========
+ *  MEM0..MEM(count - 1) as a single sequence, one trigger each.
+ */
+static void adcSequence(uint8_t count)
+{
+    if (count == 1) {
+        MAP_ADC14_configureSingleSampleMode(ADC_MEM0, false);
+    }
+    else {
+        MAP_ADC14_configureMultiSequenceMode(ADC_MEM0,
+            ADC_MEM0 << (count - 1), false);
+    }
+
+    MAP_ADC14_enableSampleTimer(ADC_AUTOMATIC_ITERATION);
+}
+
+/*
+ *  ======== adcConvert ========
+ *  Runs the sequence set up by adcSequence() once.
+ */
+static void adcConvert(uint8_t count)
+{
+    uint32_t done = ADC_INT0 << (count - 1);
+
+    MAP_ADC14_clearInterruptFlag(done);
+    MAP_ADC14_enableConversion();
+    MAP_ADC14_toggleConversionTrigger();
+
+    while (!(MAP_ADC14_getInterruptStatus() & done)) {
+        ;
+    }
+    MAP_ADC14_clearInterruptFlag(done);
+}
+
+/*
+ * \brief           Reads several analog pins with one conversion trigger.
+ * \param[in] pins  The pin numbers to read, in sequence order.
+ * \param[out] out  One sample per pin, as analogRead() would return it;
+ *                  0 for pins without an ADC channel.
+ * \param[in] count The number of pins.
+ *
+ * The pins are programmed into consecutive conversion memories and
+ * converted back to back as one sequence, up to 32 per trigger.
+ */
+void analogReadMulti(const uint8_t *pins, uint16_t *out, uint8_t count)
+{
+    uint8_t index[ADC_MEMORIES];
+    uint32_t reference;
+    uint8_t first, i, n, used;
+
+    for (first = 0; first < count; first += n) {
+        n = count - first;
+        if (n > ADC_MEMORIES) {
+            n = ADC_MEMORIES;
+        }
+
+        /* plumb the pins before the ADC is taken over */
+        used = 0;
+        for (i = 0; i < n; i++) {
+            int channel = adcPrepare(pins[first + i]);
+
+            out[first + i] = 0;
+            if (channel >= 0) {
+                index[used++] = first + i;
+            }
+        }
+
+        if (used == 0) {
+            continue;
+        }
+
+        Power_setConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+        Power_setConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+        reference = adcReference();
+        MAP_ADC14_setResolution(ADC_14BIT);
+
+        adcSequence(used);
+        for (i = 0; i < used; i++) {
+            uint8_t adcIndex = digital_pin_to_adc_index[pins[index[i]]];
+
+            MAP_ADC14_configureConversionMemory(ADC_MEM0 << i, reference,
+                PinConfigChannel(adcMSP432HWAttrs[adcIndex].adcPin), false);
+        }
+
+        adcConvert(used);
+        MAP_ADC14_disableConversion();
+
+        for (i = 0; i < used; i++) {
+            out[index[i]] = adcScale(MAP_ADC14_getResult(ADC_MEM0 << i));
+        }
+
+        adcSingleMode();
+
+        Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+        Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+    }
+}
+
+/*
+ * \brief           Prepares an AnalogPin for analogPinRead().
+ * \param[out] ap   The pin handle.
+ * \param[in] pin   The pin number.
+ * \return          false if the pin has no ADC channel.
+ *
+ * Opens the pin through analogRead() and caches MEM0's control word
+ * (channel and analogReference() setting) and analogReadResolution()'s
+ * shift; call it again after changing either.
+ */
+bool analogPinBegin(AnalogPin *ap, uint8_t pin)
+{
+    int channel = adcPrepare(pin);
+
+    if (channel < 0) {
+        ap->mctl = 0;
+        ap->rshift = 14;
+        ap->lshift = 0;
+        return (false);
+    }
+
+    ap->mctl = adcReference() | channel;
+    ap->rshift = analogReadShift >= 0 ? analogReadShift : 0;
+    ap->lshift = analogReadShift >= 0 ? 0 : -analogReadShift;
+
+    MAP_ADC14_setResolution(ADC_14BIT);
+
+    return (true);
+}
+
+/*
+ *  ======== adcPinSample ========
+ *  A 14 bit sample of an AnalogPin
+ */
+static inline uint16_t adcPinSample(const AnalogPin *ap)
+{
+    uint16_t sample;
+
+    ADC14->MCTL[0] = ap->mctl;
+    ADC14->CLRIFGR0 = ADC14_CLRIFGR0_CLRIFG0;
+    ADC14->CTL0 |= ADC14_CTL0_ENC | ADC14_CTL0_SC;
+
+    while (!(ADC14->IFGR0 & ADC14_IFGR0_IFG0)) {
+        ;
+    }
+
+    /* reading MEM0 clears IFG0 */
+    sample = ADC14->MEM[0];
+    ADC14->CTL0 &= ~ADC14_CTL0_ENC;
+
+    return (sample);
+}
+
+/*
+ * \brief           Reads an AnalogPin: load MEM0, trigger, wait, read.
+ * \param[in] ap    A handle set up by analogPinBegin().
+ * \return          The sample, as analogRead() would return it.
+ *
+ * Relies on the single-sample MEM0 setup analogRead() leaves, so it
+ * can be mixed with analogRead() but not used while an AnalogStream
+ * runs. Like ADCMSP432_convert() it polls, the task never blocks.
+ */
+uint16_t analogPinRead(const AnalogPin *ap)
+{
+    uint16_t sample = adcPinSample(ap);
+
+    return ((sample >> ap->rshift) << ap->lshift);
+}
+
+/*
+ * \brief           Reads an AnalogPin as a Q15 fraction of full scale.
+ * \param[in] ap    A handle set up by analogPinBegin().
+ * \return          0 to just under Q15_ONE, whatever analogReadResolution()
+ *                  is; see wiring_fixed.h.
+ */
+int32_t analogPinReadQ15(const AnalogPin *ap)
+{
+    return (q15FromCounts(adcPinSample(ap), 14));
+}
+
+/*
+ * \brief           analogRead() as a Q15 fraction of full scale.
+ * \param[in] pin   The pin number to read from.
+ * \return          0 to just under Q15_ONE.
+ */
+int32_t analogReadQ15(uint8_t pin)
+{
+    return (q15FromCounts(analogRead(pin), 14 - analogReadShift));
+}
+
+/* analogRead() goes through analogReadOversampled() when non 0 */
+uint8_t analogReadAverage = 0;
+
+/*
+ * \brief           Reads an analog pin averaged over 2^log2Samples samples.
+ * \param[in] pin   The pin number to read from.
+ * \param[in] log2Samples  0 to 12.
+ * \return          The average at analogReadResolution()'s width.
+ *
+ * The samples are taken in bursts of up to 32, every conversion memory
+ * loaded with the pin's channel and one trigger per burst, and summed.
+ * Each 4x of samples adds a bit to the 14 the ADC converts (oversampling
+ * and decimation, the noise has to span at least an LSB), so e.g. 16
+ * samples give a real 16 bit result with analogReadResolution(16).
+ */
+uint16_t analogReadOversampled(uint8_t pin, uint8_t log2Samples)
+{
+    uint32_t reference, sum = 0, value;
+    uint16_t bursts;
+    uint8_t burst, extra, i;
+    int channel, shift;
+
+    channel = adcPrepare(pin);
+    if (channel < 0) {
+        return (0);
+    }
+
+    if (log2Samples > 12) {
+        log2Samples = 12;
+    }
+    burst = log2Samples >= 5 ? ADC_MEMORIES : 1 << log2Samples;
+    bursts = (1 << log2Samples) / burst;
+
+    Power_setConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+    Power_setConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    reference = adcReference();
+    MAP_ADC14_setResolution(ADC_14BIT);
+
+    adcSequence(burst);
+    for (i = 0; i < burst; i++) {
+        MAP_ADC14_configureConversionMemory(ADC_MEM0 << i, reference,
+            channel, false);
+    }
+
+    while (bursts--) {
+        adcConvert(burst);
+        for (i = 0; i < burst; i++) {
+            sum += ADC14->MEM[i];
+        }
+    }
+    MAP_ADC14_disableConversion();
+
+    adcSingleMode();
+
+    Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+    Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    /* the average with extra fractional bits, 14 + extra wide */
+    extra = log2Samples / 2;
+    value = sum >> (log2Samples - extra);
+
+    shift = 14 + extra - (14 - analogReadShift);
+    if (shift >= 0) {
+        return (value >> shift);
+    }
+    else {
+        return (value << -shift);
+    }
+}
+
+/*
+ * \brief           Makes analogRead() average 2^log2Samples samples.
+ * \param[in] log2Samples  0 (single samples, the default) to 12.
+ */
+void analogReadAveraging(uint8_t log2Samples)
+{
+    analogReadAverage = log2Samples > 12 ? 12 : log2Samples;
+}
+
+/* FNV-1a, one 32 bit word at a time */
+static inline uint32_t entropyMix(uint32_t hash, uint32_t word)
+{
+    return ((hash ^ word) * 0x01000193);
+}
+
+/*
+ * \brief           Gathers a random seed from ADC noise.
+ * \return          32 bits for randomSeed() or rngSeed().
+ *
+ * Converts AVCC / 2 (the battery monitor channel, no pin needed)
+ * ENTROPY_SAMPLES times against AVCC and mixes in each 14 bit result,
+ * whose low bits are noise, and the Timestamp after it, on top of the
+ * device's TLV random number. Powers ADC14 up if nothing has yet and
+ * leaves it set up as it was. Call it before an AnalogStream starts,
+ * and not while another task uses the ADC.
+ */
+#define ENTROPY_SAMPLES 64
+
+uint32_t randomEntropy(void)
+{
+    uint32_t ctl0 = ADC14->CTL0 & ~(ADC14_CTL0_ENC | ADC14_CTL0_SC);
+    uint32_t ctl1 = ADC14->CTL1;
+    uint32_t mctl0 = ADC14->MCTL[0];
+    uint32_t hash = 0x811c9dc5;
+    int i;
+
+    hash = entropyMix(hash, TLV->RANDOM_NUM_1);
+    hash = entropyMix(hash, TLV->RANDOM_NUM_2);
+    hash = entropyMix(hash, TLV->RANDOM_NUM_3);
+    hash = entropyMix(hash, TLV->RANDOM_NUM_4);
+
+    Power_setConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+    Power_setConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    ADC14->CTL0 = ctl0;
+    if (!(ctl0 & ADC14_CTL0_ON)) {
+        ADC14->CTL0 = ADC14_CTL0_ON | ADC14_CTL0_SHP | ADC14_CTL0_SHT0__32;
+    }
+    ADC14->CTL1 = (ctl1 & ~ADC14_CTL1_RES_MASK) | ADC14_CTL1_RES__14BIT |
+        ADC14_CTL1_BATMAP;
+    ADC14->MCTL[0] = ADC14_MCTLN_INCH_23;       /* VRSEL 0: AVCC */
+
+    for (i = 0; i < ENTROPY_SAMPLES; i++) {
+        ADC14->CLRIFGR0 = ADC14_CLRIFGR0_CLRIFG0;
+        ADC14->CTL0 |= ADC14_CTL0_ENC | ADC14_CTL0_SC;
+        while (!(ADC14->IFGR0 & ADC14_IFGR0_IFG0)) {
+            ;
+        }
+        hash = entropyMix(hash, ADC14->MEM[0]);
+        hash = entropyMix(hash, Timestamp_get32());
+        ADC14->CTL0 &= ~ADC14_CTL0_ENC;
+    }
+
+    ADC14->CTL1 = ctl1;
+    ADC14->MCTL[0] = mctl0;
+    ADC14->CTL0 = ctl0;
+
+    Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+    Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    /* murmur3's finalizer, so every input bit reaches every output bit */
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+
+    return (hash);
+}
+
+/*
+ * analogWatch() support: ADC14 converts one channel in repeat mode off
+ * ACLK with the longest sample time, 32768 / (192 + 16) = ~157 samples
+ * per second without a timer or the CPU, and window comparator 0
+ * interrupts only when the result leaves or reenters [low, high].
+ */
+#define WATCH_EVENTS    (ADC_HI_INT | ADC_LO_INT | ADC_IN_INT)
+
+static Hwi_Struct watchHwiStruct;
+static AnalogWatchCallback watchFxn = NULL;
+static uint8_t watchPin;
+static bool watching = false;
+
+/*
+ *  ======== adcUnscale ========
+ *  A value at analogReadResolution()'s width as a 14 bit sample.
+ */
+static uint16_t adcUnscale(uint16_t value)
+{
+    uint32_t sample;
+
+    if (analogReadShift >= 0) {
+        sample = (uint32_t)value << analogReadShift;
+    }
+    else {
+        sample = value >> -analogReadShift;
+    }
+
+    return (sample > 0x3fff ? 0x3fff : sample);
+}
+
+/*
+ *  ======== watchHwi ========
+ *  Leaving the window arms the interrupt for coming back, and the
+ *  other way round, so a steady excursion interrupts once.
+ */
+static void watchHwi(UArg arg)
+{
+    uint_fast64_t status = MAP_ADC14_getEnabledInterruptStatus();
+    uint16_t sample = ADC14->MEM[0];
+    int state;
+
+    if (status & ADC_HI_INT) {
+        state = ANALOG_WATCH_ABOVE;
+    }
+    else if (status & ADC_LO_INT) {
+        state = ANALOG_WATCH_BELOW;
+    }
+    else {
+        state = ANALOG_WATCH_INSIDE;
+    }
+
+    /* the flags track every conversion, clear before enabling */
+    MAP_ADC14_disableInterrupt(WATCH_EVENTS);
+    MAP_ADC14_clearInterruptFlag(WATCH_EVENTS);
+    if (state == ANALOG_WATCH_INSIDE) {
+        MAP_ADC14_enableInterrupt(ADC_HI_INT | ADC_LO_INT);
+    }
+    else {
+        MAP_ADC14_enableInterrupt(ADC_IN_INT);
+    }
+
+    if (watchFxn != NULL) {
+        watchFxn(watchPin, adcScale(sample), state);
+    }
+}
+
+/*
+ * \brief           Watches an analog pin for excursions from [low, high].
+ * \param[in] pin   The pin number.
+ * \param[in] low   Lower bound, at analogReadResolution()'s width.
+ * \param[in] high  Upper bound, likewise.
+ * \param[in] fxn   Called in Hwi context with the sample and state
+ *                  (ANALOG_WATCH_ABOVE/BELOW) when the pin leaves the
+ *                  window, and with ANALOG_WATCH_INSIDE when it returns.
+ * \return          false if the pin has no ADC channel or the ADC is
+ *                  streaming.
+ *
+ * The ADC is taken over until analogWatchEnd(): analogRead() and the
+ * other readers must not be used meanwhile. It keeps the device out of
+ * LPM3 (the ADC does not run there) but needs no CPU between events.
+ * One pin at a time; a new call replaces the previous watch.
+ */
+bool analogWatch(uint8_t pin, uint16_t low, uint16_t high,
+    AnalogWatchCallback fxn)
+{
+    Hwi_Params params;
+    uint32_t reference;
+    int channel;
+
+    analogWatchEnd();
+
+    /* an AnalogStream keeps conversions enabled */
+    if (MAP_ADC14_isBusy() || (ADC14->CTL0 & ADC14_CTL0_ENC)) {
+        return (false);
+    }
+
+    channel = adcPrepare(pin);
+    if (channel < 0) {
+        return (false);
+    }
+
+    Power_setConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+
+    reference = adcReference();
+    MAP_ADC14_initModule(ADC_CLOCKSOURCE_ACLK, ADC_PREDIVIDER_1,
+        ADC_DIVIDER_1, 0);
+    MAP_ADC14_setSampleHoldTime(ADC_PULSE_WIDTH_192, ADC_PULSE_WIDTH_192);
+    MAP_ADC14_setResolution(ADC_14BIT);
+    MAP_ADC14_configureSingleSampleMode(ADC_MEM0, true);
+    MAP_ADC14_configureConversionMemory(ADC_MEM0, reference, channel, false);
+    MAP_ADC14_setComparatorWindowValue(ADC_COMP_WINDOW0, adcUnscale(low),
+        adcUnscale(high));
+    MAP_ADC14_enableComparatorWindow(ADC_MEM0, ADC_COMP_WINDOW0);
+
+    watchPin = pin;
+    watchFxn = fxn;
+    watching = true;
+
+    Hwi_Params_init(&params);
+    Hwi_construct(&watchHwiStruct, INT_ADC14, watchHwi, &params, NULL);
+
+    MAP_ADC14_clearInterruptFlag(WATCH_EVENTS);
+    MAP_ADC14_enableInterrupt(ADC_HI_INT | ADC_LO_INT);
+
+    /* free running: one trigger, then back to back conversions */
+    MAP_ADC14_enableSampleTimer(ADC_AUTOMATIC_ITERATION);
+    MAP_ADC14_enableConversion();
+    MAP_ADC14_toggleConversionTrigger();
+
+    return (true);
+}
+
+/*
+ * \brief           Stops analogWatch() and hands the ADC back to analogRead().
+ */
+void analogWatchEnd(void)
+{
+    if (!watching) {
+        return;
+    }
+
+    MAP_ADC14_disableInterrupt(WATCH_EVENTS);
+    Hwi_destruct(&watchHwiStruct);
+    watchFxn = NULL;
+    watching = false;
+
+    /* repeat mode stops at the end of the conversion in progress */
+    MAP_ADC14_disableConversion();
+    while (MAP_ADC14_isBusy()) {
+        ;
+    }
+    MAP_ADC14_clearInterruptFlag(WATCH_EVENTS);
+    MAP_ADC14_disableComparatorWindow(ADC_MEM0);
+    restoreAnalogRead();
+
+    Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+}
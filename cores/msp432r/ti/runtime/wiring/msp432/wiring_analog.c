@@ -43,6 +43,7 @@
 
 #include <ti/drivers/PWM.h>
 #include <ti/drivers/pwm/PWMTimerMSP432.h>
+#include <ti/drivers/dma/UDMAMSP432.h>
 
 #include <ti/drivers/ADC.h>
 #include <ti/drivers/adc/ADCMSP432.h>
@@ -53,6 +54,7 @@
 #include <driverlib/rom.h>
 #include <driverlib/rom_map.h>
 #include <driverlib/timer_a.h>
+#include <driverlib/dma.h>
 #include <driverlib/adc14.h>
 #include <driverlib/ref_a.h>
 #include <driverlib/pmap.h>
@@ -153,134 +155,1957 @@ void stopDigitalRead(uint8_t pin)
 }
 
 /*
- * For the MSP432, the timers used for PWM are clocked at 12MHz.
- * The period is set to 2.04ms in the PWM_open() call.
+ * For the MSP432, the timers used for PWM are clocked from SMCLK (12MHz).
+ * The period is set to 1/pwmFrequency in the PWM_open() call, 490Hz like
+ * Arduino unless analogFrequency() changed it; all PWM timers share it.
  * The PWM objects are configured for PWM_DUTY_COUNTS mode to minimize
- * the PWM_setDuty() processing overhead.
- * The 2.04ms period yields a period count of 24480.
- * The Arduino analogWrite() API takes a value of 0-255 for the duty cycle.
- * The PWM scale factor is then 24480 / 255 = 96
+ * the PWM_setDuty() processing overhead: analogWrite() scales its
+ * 0-pwmMaxValue value (0-255 unless analogWriteResolution() changed it)
+ * to the pwmPeriodCounts SMCLK counts of a period.
+ *
+ * On a performance level change the driver recomputes the period from
+ * the new SMCLK but reloads the old duty counts; pwmPerfChangeNotifyFxn()
+ * runs after it and rescales the analogWrite() values.
+ */
+
+static uint32_t pwmFrequency = 490;
+static uint32_t pwmPeriodCounts;
+static uint32_t pwmMaxValue = 255;
+
+/* pins and values of the open PWMs, for analogFrequency() */
+static uint8_t pwm_index_to_pin[PWM_AVAILABLE_PWMS];
+static uint16_t pwm_values[PWM_AVAILABLE_PWMS];
+
+/* timers running motorPwmBegin() pairs, bit per timer */
+static uint8_t motorPwmTimers;
+
+/*
+ * timers running servoPwmBegin() outputs, tone() or a
+ * pwmChannelBeginTimer() output, bit per timer
+ */
+static uint8_t servoPwmTimers;
+static uint8_t toneTimers;
+static uint8_t pwmOwnTimers;
+
+static inline uint8_t outputTimers(void)
+{
+    return (servoPwmTimers | toneTimers | pwmOwnTimers);
+}
+
+static Power_NotifyObj pwmPerfChangeNotify;
+static bool pwmPerfChangeRegistered;
+
+static inline uint32_t pwmDutyCounts(uint32_t val)
+{
+    if (pwmPeriodCounts <= 0xffff) {
+        return (val * pwmPeriodCounts / pwmMaxValue);
+    }
+
+    return ((uint64_t)val * pwmPeriodCounts / pwmMaxValue);
+}
+
+/*
+ *  ======== pwmPerfChangeNotifyFxn ========
+ *  eventArg is the new performance level
+ */
+static int_fast16_t pwmPerfChangeNotifyFxn(uint_fast16_t eventType,
+    uintptr_t eventArg, uintptr_t clientArg)
+{
+    PowerMSP432_Freqs freqs;
+    uint8_t i;
+
+    PowerMSP432_getFreqs((unsigned int)eventArg, &freqs);
+    pwmPeriodCounts = freqs.SMCLK / pwmFrequency;
+
+    for (i = 0; i < PWM_AVAILABLE_PWMS; i++) {
+        if (used_pwm_port_pins[i] != PWM_NOT_IN_USE &&
+            used_pwm_port_pins[i] != PWM_IN_USE &&
+            !(motorPwmTimers & (1 << (i >> 2)))) {
+            PWM_setDuty((PWM_Handle)&(PWM_config[i]),
+                pwmDutyCounts(pwm_values[i]));
+        }
+    }
+
+    return (Power_NOTIFYDONE);
+}
+
+/*
+ *  ======== pwmPerfChangeRegister ========
+ *  (Re)queue pwmPerfChangeNotifyFxn() behind the notification the PWM
+ *  driver registered when it opened the first CCR of a timer. Called
+ *  with interrupts disabled.
+ */
+static void pwmPerfChangeRegister(void)
+{
+    if (pwmPerfChangeRegistered) {
+        Power_unregisterNotify(&pwmPerfChangeNotify);
+    }
+    Power_registerNotify(&pwmPerfChangeNotify,
+        PowerMSP432_DONE_CHANGE_PERF_LEVEL, pwmPerfChangeNotifyFxn, 0);
+    pwmPerfChangeRegistered = true;
+}
+
+/* TA0 and TA1 CCRs, the ones PMAP can route to any mappable pin */
+#define PWM_MAPPABLE_PWMS   8
+
+#define PWM_TIMERS          4
+
+/* timerReserve() owner of each Timer_A, TIMER_OWNER_NONE if not reserved */
+static uint8_t timerOwners[PWM_TIMERS];
+
+/* timers handed to Timer_create() by timerCreateId() */
+static uint8_t timersCreated;
+
+/*
+ *  ======== pwmFindFree ========
+ *  First unused mappable PWM index, on a timer reserved for PWM if
+ *  there are any and not on a timer in skipTimers. Called with
+ *  interrupts disabled.
+ */
+static uint8_t pwmFindFree(uint8_t skipTimers)
+{
+    uint8_t pwmTimers = 0;
+    uint8_t pwmIndex, timerId;
+
+    for (timerId = 0; timerId < PWM_TIMERS; timerId++) {
+        if (timerOwners[timerId] == TIMER_OWNER_PWM) {
+            pwmTimers |= 1 << timerId;
+        }
+    }
+    if (pwmTimers != 0) {
+        skipTimers |= ~pwmTimers;
+    }
+
+    for (pwmIndex = 0; pwmIndex < PWM_MAPPABLE_PWMS; pwmIndex++) {
+        if (used_pwm_port_pins[pwmIndex] == PWM_NOT_IN_USE &&
+            !(skipTimers & (1 << (pwmIndex >> 2)))) {
+            break;
+        }
+    }
+
+    return (pwmIndex);
+}
+
+/*
+ *  ======== pwmOpen ========
+ *  PWM_open() at analogFrequency(), NULL if the timer's CCR is
+ *  already in use
+ */
+static PWM_Handle pwmOpen(uint8_t pwmIndex)
+{
+    static bool pwmInitialized = false;
+    PWM_Params pwmParams;
+
+    /* not done by Board_init(), most sketches never analogWrite() */
+    if (pwmInitialized == false) {
+        PWM_init();
+        pwmInitialized = true;
+        bootTraceMark("PWM_init");
+    }
+
+    PWM_Params_init(&pwmParams);
+
+    /* Open the PWM port */
+    pwmParams.periodUnits = PWM_PERIOD_HZ;
+    pwmParams.periodValue = pwmFrequency;
+    pwmParams.dutyUnits = PWM_DUTY_COUNTS;
+
+    return (PWM_open(pwmIndex, &pwmParams));
+}
+
+void analogWrite(uint8_t pin, int val)
+{
+    uint16_t pinId, pinNum;
+    uint8_t pwmIndex, timerId;
+    uint_fast8_t port;
+    uint32_t hwiKey;
+    uint32_t pwmPin;
+
+    hwiKey = Hwi_disable();
+
+    if (digital_pin_to_pin_function[pin] == PIN_FUNC_ANALOG_OUTPUT) {
+        pwmIndex = digital_pin_to_pwm_index[pin];
+
+        /* the PWM driver would put a motorPwmBegin() timer back in up mode */
+        if (motorPwmTimers & (1 << (pwmIndex >> 2))) {
+            Hwi_restore(hwiKey);
+            return;
+        }
+    }
+    else {
+        /* re-configure pin if possible */
+        PWM_Handle pwmHandle;
+        uint8_t skipTimers;
+
+        /*
+         * The pwmIndex fetched from the pin_to_pwm_index[] table
+         * is either an actual index into the PWM instance table
+         * if the pin has already been mapped to a PWM resource,
+         * or a mappable port/pin ID, or NOT_MAPPABLE.
+         */
+        pwmIndex = digital_pin_to_pwm_index[pin];
+
+        if (pwmIndex == PWM_NOT_MAPPABLE) {
+            Hwi_restore(hwiKey);
+            return; /* can't get there from here */
+        }
+
+        /* GPIOMSP432_Px_y coded, from flash rather than pinConfigs[] */
+        pinId = digital_pin_to_port_pin[pin];
+        port = pinId >> 8;
+        pinNum = __builtin_ctz(pinId & 0xff);
+
+        if (pwmIndex < PWM_AVAILABLE_PWMS) { /* fixed mapping */
+            if (used_pwm_port_pins[pwmIndex] != PWM_NOT_IN_USE) {
+                Hwi_restore(hwiKey);
+                return; /* PWM port already in use */
+            }
+            /*
+             * encode port/pin to inform stopAnalogWrite() that
+             * this is a fixed mapped pin
+             */
+
+            used_pwm_port_pins[pwmIndex] = pwmIndex;
+
+            /* plug pwmPin in HwAttrs with corresponding encoded pin identifier */
+            pwmTimerMSP432HWAttrs[pwmIndex].pwmPin = fixed_map_pwm_pins[pwmIndex-8];
+
+            pwmHandle = pwmOpen(pwmIndex);
+            if (pwmHandle == NULL) {
+                /* timer taken by someone else, it may be free next time */
+                used_pwm_port_pins[pwmIndex] = PWM_NOT_IN_USE;
+                Hwi_restore(hwiKey);
+                return;
+            }
+        }
+        else {
+            /*
+             * Find an unused PWM resource and port map it. PWM_open()
+             * fails if the timer is already running for someone else
+             * (eg tone() or Servo); skip that timer's CCRs for this
+             * call only.
+             */
+            skipTimers = 0;
+            do {
+                pwmIndex = pwmFindFree(skipTimers);
+                if (pwmIndex >= PWM_MAPPABLE_PWMS) {
+                    Hwi_restore(hwiKey);
+                    return; /* no unused PWM ports */
+                }
+
+                /* remember which pinId is being used by this PWM resource */
+                used_pwm_port_pins[pwmIndex] = pinId; /* save port/pin info */
+                /* remember which PWM resource is being used by this pin */
+                digital_pin_to_pwm_index[pin] = pwmIndex; /* save pwm index */
+
+                /* encode pwmPin field with port/pin/TAxCCRyA info */
+                pwmPin = port << 4 | pinNum;
+                pwmPin = pwmPin | mapped_pwm_pin_ccrs[pwmIndex];
+                pwmTimerMSP432HWAttrs[pwmIndex].pwmPin = pwmPin;
+
+                pwmHandle = pwmOpen(pwmIndex);
+                if (pwmHandle == NULL) {
+                    used_pwm_port_pins[pwmIndex] = PWM_NOT_IN_USE;
+                    digital_pin_to_pwm_index[pin] = PWM_MAPPABLE;
+                    skipTimers |= 1 << (pwmIndex >> 2);
+                }
+            } while (pwmHandle == NULL);
+        }
+
+        /* start the timer */
+        PWM_start(pwmHandle);
+        pwmPerfChangeRegister();
+
+        /* remove timer from pool of available timers if not in use */
+        timerId = pwmIndex >> 2;
+        timer_ccrs_in_use[timerId] += 1;
+        if (timer_ccrs_in_use[timerId] == 1) {
+            Timer_setAvailMask(Timer_getAvailMask() & ~(1 << timerId));
+        }
+
+        if (pwmPeriodCounts == 0) {
+            PowerMSP432_Freqs freqs;
+
+            PowerMSP432_getFreqs(Power_getPerformanceLevel(), &freqs);
+            pwmPeriodCounts = freqs.SMCLK / pwmFrequency;
+        }
+
+        pwm_index_to_pin[pwmIndex] = pin;
+        digital_pin_to_pin_function[pin] = PIN_FUNC_ANALOG_OUTPUT;
+    }
+
+    if (val < 0) {
+        val = 0;
+    }
+    else if ((uint32_t)val > pwmMaxValue) {
+        val = pwmMaxValue;
+    }
+    pwm_values[pwmIndex] = val;
+
+    Hwi_restore(hwiKey);
+
+    PWM_setDuty((PWM_Handle)&(PWM_config[pwmIndex]), pwmDutyCounts(val));
+}
+
+/*
+ * \brief           Sets the PWM frequency of analogWrite().
+ * \param hz        3Hz to SMCLK / 2; the default is 490Hz.
+ *
+ * Every timer's CCRs share one period, so the frequency is global:
+ * running PWMs are closed and reopened at the new frequency with their
+ * value, which glitches their outputs once. The effective resolution
+ * is log2(SMCLK / hz) bits, e.g. ~9 bits at 20kHz from 12MHz.
+ */
+void analogFrequency(uint32_t hz)
+{
+    uint8_t pins[PWM_AVAILABLE_PWMS];
+    uint16_t values[PWM_AVAILABLE_PWMS];
+    PowerMSP432_Freqs freqs;
+    uint8_t i, count = 0;
+
+    /* Timer_A's 16 bit period times its largest prescaler, 64 */
+    PowerMSP432_getFreqs(Power_getPerformanceLevel(), &freqs);
+    if (hz == 0 || hz > freqs.SMCLK / 2 || freqs.SMCLK / hz > 0xffff * 64 ||
+        hz == pwmFrequency) {
+        return;
+    }
+
+    for (i = 0; i < PWM_AVAILABLE_PWMS; i++) {
+        if (used_pwm_port_pins[i] != PWM_NOT_IN_USE &&
+            used_pwm_port_pins[i] != PWM_IN_USE &&
+            !(motorPwmTimers & (1 << (i >> 2)))) {
+            pins[count] = pwm_index_to_pin[i];
+            values[count++] = pwm_values[i];
+        }
+    }
+
+    for (i = 0; i < count; i++) {
+        stopAnalogWrite(pins[i]);
+        digital_pin_to_pin_function[pins[i]] = PIN_FUNC_UNUSED;
+    }
+
+    pwmFrequency = hz;
+    pwmPeriodCounts = freqs.SMCLK / hz;
+
+    for (i = 0; i < count; i++) {
+        analogWrite(pins[i], values[i]);
+    }
+}
+
+/*
+ * \brief           Sets the range of analogWrite() values to 0 - 2^bits-1.
+ * \param bits      1 to 16, 8 by default.
+ *
+ * Values are scaled to the period, so more bits than log2(SMCLK /
+ * analogFrequency()) only add steps that map to the same duty.
+ */
+void analogWriteResolution(uint16_t bits)
+{
+    if (bits < 1 || bits > 16) {
+        return;
+    }
+
+    pwmMaxValue = (1UL << bits) - 1;
+}
+
+/*
+ * \brief           analogWrite() with a Q15 duty.
+ * \param pin       The pin.
+ * \param duty      0 (off) to Q15_ONE (on), see wiring_fixed.h; scaled to
+ *                  analogWriteResolution()'s range with a shift.
+ */
+void analogWriteQ15(uint8_t pin, int32_t duty)
+{
+    analogWrite(pin, q15ToCounts(duty, 32 - __builtin_clz(pwmMaxValue)));
+}
+
+/*
+ * \brief           Opens a PWM channel handle for pwmChannelWrite().
+ * \param[out] ch   The handle.
+ * \param[in] pin   The pin; it is started with analogWrite(pin, 0).
+ * \return          false if the pin can't do PWM or no timer is free.
+ *
+ * The handle caches the pin's TAxCCRn and analogWriteResolution()'s
+ * range; open it again after changing the resolution, or after
+ * analogWrite() on another pin remapped it. Writes scale to the live
+ * period, so analogFrequency() and performance level changes carry
+ * over.
+ */
+bool pwmChannelBegin(PwmChannel *ch, uint8_t pin)
+{
+    uint8_t pwmIndex;
+    Timer_A_Type *timer;
+
+    analogWrite(pin, 0);
+    if (digital_pin_to_pin_function[pin] != PIN_FUNC_ANALOG_OUTPUT) {
+        return (false);
+    }
+
+    /* PWM indexes 0-3 are TA0 CCR1-4, 4-7 TA1 CCR1-4, 8-11 TA2 CCR1-4 */
+    pwmIndex = digital_pin_to_pwm_index[pin];
+    if (motorPwmTimers & (1 << (pwmIndex >> 2))) {
+        return (false);
+    }
+    timer = TIMER_A_CMSIS(TIMER_A0_BASE + (pwmIndex >> 2) * 0x400);
+
+    ch->timer = timer;
+    ch->ccr = &timer->CCR[(pwmIndex & 3) + 1];
+    ch->period = timer->CCR[0];
+    ch->max = pwmMaxValue;
+
+    return (true);
+}
+
+/*
+ *  ======== pwmCompare ========
+ *  CCR value for val; above the period keeps a full duty output high,
+ *  as PWMTimerMSP432_setDuty() does.
+ */
+static inline uint16_t pwmCompare(const PwmChannel *ch, uint32_t val)
+{
+    uint32_t period = ((Timer_A_Type *)ch->timer)->CCR[0];
+
+    if (val >= ch->max) {
+        return (period < 0xffff ? period + 1 : 0xffff);
+    }
+
+    return (val * period / ch->max);
+}
+
+/*
+ * \brief           Sets a PWM channel's duty with a single CCR store.
+ * \param[in] ch    A handle opened by pwmChannelBegin().
+ * \param[in] val   0 to 2^analogWriteResolution()-1.
+ *
+ * The new compare value applies from the moment it is written, which
+ * may cut the current period short; see pwmChannelWriteSync().
+ */
+void pwmChannelWrite(const PwmChannel *ch, uint32_t val)
+{
+    *ch->ccr = pwmCompare(ch, val);
+}
+
+/*
+ * \brief           pwmChannelWrite() with a Q15 duty.
+ * \param[in] ch    A handle opened by pwmChannelBegin().
+ * \param[in] duty  0 (off) to Q15_ONE (on), see wiring_fixed.h.
+ *
+ * The compare value is the duty times the live period, shifted: no
+ * divide, unlike the analogWriteResolution() scaling.
+ */
+void pwmChannelWriteQ15(const PwmChannel *ch, int32_t duty)
+{
+    uint32_t period = ((Timer_A_Type *)ch->timer)->CCR[0];
+
+    if (duty <= 0) {
+        *ch->ccr = 0;
+    }
+    else if (duty >= Q15_ONE) {
+        *ch->ccr = period < 0xffff ? period + 1 : 0xffff;
+    }
+    else {
+        *ch->ccr = ((uint32_t)duty * period) >> 15;
+    }
+}
+
+/*
+ * \brief           Sets several channels of one Timer_A in the same period.
+ * \param[in] chs   Handles on the same timer.
+ * \param[in] vals  One value per handle.
+ * \param[in] count The number of handles, up to 4.
+ * \return          false if the handles are on different timers.
+ *
+ * Waits for the start of the next period (the CCR0 flag, the PWM
+ * driver does not use it), then writes all CCRs before the counter
+ * reaches the smallest old or new compare value, so no output sees a
+ * mix of old and new duties. Waits at most two periods unless
+ * interrupts keep landing in that window.
+ */
+bool pwmChannelWriteSync(const PwmChannel *chs, const uint32_t *vals,
+    uint8_t count)
+{
+    Timer_A_Type *timer;
+    uint16_t compares[4];
+    uint16_t limit = 0xffff;
+    uint32_t hwiKey;
+    uint8_t i;
+
+    if (count == 0 || count > 4) {
+        return (false);
+    }
+
+    timer = chs[0].timer;
+    for (i = 0; i < count; i++) {
+        if (chs[i].timer != timer) {
+            return (false);
+        }
+        compares[i] = pwmCompare(&chs[i], vals[i]);
+        if (compares[i] < limit) {
+            limit = compares[i];
+        }
+        if (*chs[i].ccr < limit) {
+            limit = *chs[i].ccr;
+        }
+    }
+
+    /* stopped timer, no period to align to */
+    if ((timer->CTL & TIMER_A_CTL_MC_MASK) == 0) {
+        for (i = 0; i < count; i++) {
+            *chs[i].ccr = compares[i];
+        }
+        return (true);
+    }
+
+    for (;;) {
+        timer->CCTL[0] &= ~TIMER_A_CCTLN_CCIFG;
+        while (!(timer->CCTL[0] & TIMER_A_CCTLN_CCIFG)) {
+            ;
+        }
+
+        hwiKey = Hwi_disable();
+        if (limit == 0 || timer->R < limit) {
+            for (i = 0; i < count; i++) {
+                *chs[i].ccr = compares[i];
+            }
+            Hwi_restore(hwiKey);
+            return (true);
+        }
+        Hwi_restore(hwiKey);
+    }
+}
+
+/*
+ * \brief           CCR value pwmChannelWrite() would store for val.
+ * \param[in] ch    A handle opened by pwmChannelBegin().
+ * \param[in] val   0 to 2^analogWriteResolution()-1.
+ * \return          The compare value, for pwmWaveformBegin() buffers.
+ */
+uint16_t pwmChannelCompare(const PwmChannel *ch, uint32_t val)
+{
+    return (pwmCompare(ch, val));
+}
+
+/*
+ * Waveform playback: the CCR0 event of the timer requests uDMA
+ * channel 0, 2 or 4 (TA0, TA1, TA2), which moves the next compare
+ * value into the output's CCRn at the start of each period. Buffers
+ * longer than one uDMA transfer, and looping, use ping-pong mode
+ * re-armed from the DMA_INT0 callback once per PWM_WAVEFORM_MAX_XFER
+ * periods.
+ */
+#define PWM_WAVEFORM_TIMERS     3
+#define PWM_WAVEFORM_MAX_XFER   1024
+
+typedef struct PwmWaveform {
+    const uint16_t *counts;
+    uint32_t length;
+    uint32_t chunk;             /* values per uDMA transfer */
+    uint32_t next;              /* index of the next chunk to load */
+    uint32_t last;              /* index of the chunk loaded last */
+    PwmWaveformCallback fxn;    /* pwmWaveformStream() refill callback */
+    uintptr_t arg;
+    volatile uint16_t *ccr;
+    UDMAMSP432_Handle dma;      /* non-NULL while the channel is claimed */
+    bool loop;
+    volatile bool active;
+} PwmWaveform;
+
+static PwmWaveform pwmWaveforms[PWM_WAVEFORM_TIMERS];
+
+static const uint32_t pwmWaveformDmaSources[PWM_WAVEFORM_TIMERS] = {
+    DMA_CH0_TIMERA0CCR0,
+    DMA_CH2_TIMERA1CCR0,
+    DMA_CH4_TIMERA2CCR0
+};
+
+/*
+ *  ======== pwmWaveformArm ========
+ *  Load the primary or alternate structure with the next chunk of the
+ *  buffer, or leave it stopped at the end of a one-shot waveform.
+ */
+static bool pwmWaveformArm(uint32_t tmr, uint32_t select)
+{
+    PwmWaveform *wave = &pwmWaveforms[tmr];
+    uint32_t dmaCh = pwmWaveformDmaSources[tmr];
+    uint32_t count;
+
+    if (wave->next >= wave->length) {
+        if (!wave->loop) {
+            MAP_DMA_setChannelTransfer(dmaCh | select, UDMA_MODE_STOP,
+                (void *)wave->counts, (void *)wave->ccr, 1);
+            return (false);
+        }
+        wave->next = 0;
+    }
+
+    count = wave->length - wave->next;
+    if (count > wave->chunk) {
+        count = wave->chunk;
+    }
+
+    MAP_DMA_setChannelTransfer(dmaCh | select, UDMA_MODE_PINGPONG,
+        (void *)&wave->counts[wave->next], (void *)wave->ccr, count);
+    wave->last = wave->next;
+    wave->next += count;
+
+    return (true);
+}
+
+/*
+ *  ======== pwmWaveformHwiFxn ========
+ *  dmaAttach() callback, arg is the timer number
+ */
+static void pwmWaveformHwiFxn(uintptr_t arg)
+{
+    PwmWaveform *wave = &pwmWaveforms[arg];
+    uint32_t ch = pwmWaveformDmaSources[arg] & 0x0f;
+    bool armed = false;
+
+    /* a streamed chunk is free for new values once it is loaded again */
+    if (MAP_DMA_getChannelMode(ch | UDMA_PRI_SELECT) == UDMA_MODE_STOP) {
+        if (pwmWaveformArm(arg, UDMA_PRI_SELECT)) {
+            armed = true;
+            if (wave->fxn != NULL) {
+                wave->fxn(wave->arg, wave->last);
+            }
+        }
+    }
+
+    if (MAP_DMA_getChannelMode(ch | UDMA_ALT_SELECT) == UDMA_MODE_STOP) {
+        if (pwmWaveformArm(arg, UDMA_ALT_SELECT)) {
+            armed = true;
+            if (wave->fxn != NULL) {
+                wave->fxn(wave->arg, wave->last);
+            }
+        }
+    }
+
+    if (MAP_DMA_isChannelEnabled(ch)) {
+        return;
+    }
+
+    /* both structures ran out before we got here, or the end was reached */
+    if (armed) {
+        MAP_DMA_enableChannel(ch);
+    }
+    else {
+        pwmWaveforms[arg].active = false;
+    }
+}
+
+/*
+ *  ======== pwmWaveformStop ========
+ */
+static void pwmWaveformStop(uint32_t tmr)
+{
+    PwmWaveform *wave = &pwmWaveforms[tmr];
+    uint32_t ch = pwmWaveformDmaSources[tmr] & 0x0f;
+    uint32_t hwiKey;
+
+    if (wave->dma == NULL) {
+        return;
+    }
+
+    hwiKey = Hwi_disable();
+
+    MAP_DMA_disableChannel(ch);
+    wave->active = false;
+
+    Hwi_restore(hwiKey);
+
+    dmaDetach(ch);
+    UDMAMSP432_close(wave->dma);
+    wave->dma = NULL;
+
+    Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+}
+
+/*
+ *  ======== pwmWaveformTimer ========
+ *  0-2 for a handle on TA0-TA2
+ */
+static inline uint32_t pwmWaveformTimer(const PwmChannel *ch)
+{
+    return (((uint32_t)ch->timer - TIMER_A0_BASE) >> 10);
+}
+
+/*
+ *  ======== pwmWaveformStart ========
+ *  Common part of pwmWaveformBegin() and pwmWaveformStream()
+ */
+static bool pwmWaveformStart(const PwmChannel *ch, const uint16_t *counts,
+    uint32_t length, bool loop, uint32_t chunk, PwmWaveformCallback fxn,
+    uintptr_t arg)
+{
+    uint32_t tmr = pwmWaveformTimer(ch);
+    PwmWaveform *wave;
+    uint32_t dmaCh;
+    uint32_t hwiKey;
+
+    if (tmr >= PWM_WAVEFORM_TIMERS || length == 0) {
+        return (false);
+    }
+
+    wave = &pwmWaveforms[tmr];
+    dmaCh = pwmWaveformDmaSources[tmr];
+
+    if (wave->dma != NULL) {
+        if (wave->active && wave->ccr != ch->ccr) {
+            return (false);
+        }
+        pwmWaveformStop(tmr);
+    }
+
+    /* the channel may already be in use by SPI, Wire or a UART */
+    if (MAP_DMA_isChannelEnabled(dmaCh & 0x0f)) {
+        return (false);
+    }
+
+    UDMAMSP432_init();
+    wave->dma = UDMAMSP432_open();
+    if (wave->dma == NULL) {
+        return (false);
+    }
+
+    if (!dmaAttach(dmaCh & 0x0f, pwmWaveformHwiFxn, tmr, ~0)) {
+        UDMAMSP432_close(wave->dma);
+        wave->dma = NULL;
+        return (false);
+    }
+
+    /* released with the uDMA channel in pwmWaveformStop() */
+    Power_setConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    hwiKey = Hwi_disable();
+
+    wave->counts = counts;
+    wave->length = length;
+    wave->chunk = chunk;
+    wave->next = 0;
+    wave->fxn = fxn;
+    wave->arg = arg;
+    wave->ccr = ch->ccr;
+    wave->loop = loop;
+    wave->active = true;
+
+    MAP_DMA_assignChannel(dmaCh);
+    MAP_DMA_disableChannelAttribute(dmaCh, UDMA_ATTR_ALTSELECT |
+        UDMA_ATTR_USEBURST | UDMA_ATTR_REQMASK);
+    MAP_DMA_enableChannelAttribute(dmaCh, UDMA_ATTR_HIGH_PRIORITY);
+
+    MAP_DMA_setChannelControl(dmaCh | UDMA_PRI_SELECT,
+        UDMA_SIZE_16 | UDMA_SRC_INC_16 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+    MAP_DMA_setChannelControl(dmaCh | UDMA_ALT_SELECT,
+        UDMA_SIZE_16 | UDMA_SRC_INC_16 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+
+    pwmWaveformArm(tmr, UDMA_PRI_SELECT);
+    pwmWaveformArm(tmr, UDMA_ALT_SELECT);
+
+    /* the first value goes out at the next period boundary */
+    ((Timer_A_Type *)ch->timer)->CCTL[0] &= ~TIMER_A_CCTLN_CCIFG;
+    MAP_DMA_clearInterruptFlag(dmaCh & 0x0f);
+    MAP_DMA_enableChannel(dmaCh & 0x0f);
+
+    Hwi_restore(hwiKey);
+
+    return (true);
+}
+
+/*
+ * \brief           Plays a buffer of compare values on a PWM output.
+ * \param[in] ch     A handle opened by pwmChannelBegin().
+ * \param[in] counts One CCR value per PWM period, 0 to ch->period + 1;
+ *                   see pwmChannelCompare(). Must stay valid, and is
+ *                   read live, until playback ends.
+ * \param[in] length The number of values.
+ * \param[in] loop   Restart from counts[0] after the last value.
+ * \return           false if the channel's uDMA channel is busy, or
+ *                   another output of the same timer is playing.
+ *
+ * Each CCR0 event of the timer moves the next value into the output's
+ * CCRn through the uDMA, so the duty changes exactly on period
+ * boundaries without the CPU. The CPU is only interrupted once every
+ * 1024 periods to re-arm the transfer, and not at all for a one-shot
+ * waveform of up to 1024 values. After a one-shot waveform the output
+ * keeps the last value.
+ *
+ * The buffer holds counts for the current period, so performance
+ * level changes are disallowed until pwmWaveformEnd().
+ *
+ * One output per Timer_A can play at a time. TA0 and TA2 use uDMA
+ * channels 0 and 4, which are also EUSCI_B0 and EUSCI_B2 SPI transmit;
+ * TA1 (channel 2) is the one to pick next to SPI DMA transfers.
+ */
+bool pwmWaveformBegin(const PwmChannel *ch, const uint16_t *counts,
+    uint32_t length, bool loop)
+{
+    return (pwmWaveformStart(ch, counts, length, loop,
+        PWM_WAVEFORM_MAX_XFER, NULL, 0));
+}
+
+/*
+ * \brief           Streams compare values through a two half buffer.
+ * \param[in] ch     A handle opened by pwmChannelBegin() or
+ *                   pwmChannelBeginTimer().
+ * \param[in] counts Two halves of length / 2 values, played in turn,
+ *                   endlessly.
+ * \param[in] length Even, up to 2 * PWM_WAVEFORM_MAX_XFER.
+ * \param[in] fxn    Called in Hwi context with the index of a half
+ *                   that has played out.
+ * \param[in] arg    Passed to fxn.
+ * \return           As pwmWaveformBegin().
+ *
+ * Playback is as with pwmWaveformBegin(), looping. Once a half has
+ * been moved out, fxn(arg, index) tells where it starts; it can be
+ * refilled with new values for as long as the other half plays, after
+ * which it is played again whether refilled or not. Stop with
+ * pwmWaveformEnd().
+ */
+bool pwmWaveformStream(const PwmChannel *ch, uint16_t *counts,
+    uint32_t length, PwmWaveformCallback fxn, uintptr_t arg)
+{
+    if ((length & 1) || length > 2 * PWM_WAVEFORM_MAX_XFER) {
+        return (false);
+    }
+
+    return (pwmWaveformStart(ch, counts, length, true, length / 2, fxn,
+        arg));
+}
+
+/*
+ * \brief           Stops pwmWaveformBegin() playback on an output.
+ * \param[in] ch    The handle playback was started with.
+ *
+ * The output keeps the last value moved into its CCR.
+ */
+void pwmWaveformEnd(const PwmChannel *ch)
+{
+    uint32_t tmr = pwmWaveformTimer(ch);
+
+    if (tmr < PWM_WAVEFORM_TIMERS && pwmWaveforms[tmr].ccr == ch->ccr) {
+        pwmWaveformStop(tmr);
+    }
+}
+
+/*
+ * \brief           Tells whether an output is still playing a waveform.
+ * \param[in] ch    The handle playback was started with.
+ * \return          false once a one-shot waveform has been moved out.
+ */
+bool pwmWaveformActive(const PwmChannel *ch)
+{
+    uint32_t tmr = pwmWaveformTimer(ch);
+
+    return (tmr < PWM_WAVEFORM_TIMERS && pwmWaveforms[tmr].active &&
+        pwmWaveforms[tmr].ccr == ch->ccr);
+}
+
+/*
+ * Motor PWM: complementary output pairs on one Timer_A counting up
+ * and down to CCR0. The high side is in toggle/reset mode and is on
+ * while TAR < CCRa, the low side in toggle/set mode and is on while
+ * TAR > CCRb = CCRa + dead, so both outputs are off for dead counts
+ * around each edge and the pulses are centered on the bottom and top
+ * of the count. CCRs of 0xffff never match: high side off, low side
+ * on. CCR0 and TAIFG mark the top and bottom of the count; updates
+ * happen between those and the first compare, where every output
+ * still has both of its toggles ahead (or behind) it.
+ */
+
+/*
+ *  ======== motorPwmCompares ========
+ *  CCR values of a pair for val; the high side is kept below the top
+ *  update window, so the low side always has a short pulse there.
+ */
+static void motorPwmCompares(const MotorPwm *m, uint32_t val,
+    uint16_t *high, uint16_t *low)
+{
+    uint32_t counts;
+    uint32_t limit = m->period - m->window - m->dead;
+
+    if (val == 0) {
+        *high = 0xffff;
+        *low = 0xffff;
+        return;
+    }
+
+    if (val > m->max) {
+        val = m->max;
+    }
+
+    counts = val * m->period / m->max;
+    if (counts == 0) {
+        counts = 1;
+    }
+    else if (counts > limit) {
+        counts = limit;
+    }
+
+    *high = counts;
+    *low = counts + m->dead;
+}
+
+/*
+ *  ======== motorPwmOpen ========
+ *  Open the n pins on one timer and work out the timing. Returns the
+ *  timer clock divider, or 0 with *opened set to the number of pins
+ *  to hand back.
+ */
+static uint16_t motorPwmOpen(MotorPwm *m, const uint8_t *pins, uint8_t n,
+    uint32_t hz, uint32_t deadNs, uint8_t *opened)
+{
+    PowerMSP432_Freqs freqs;
+    PwmChannel ch;
+    Timer_A_Type *timer = NULL;
+    uint32_t counts, clk, div;
+    uint64_t dead;
+    uint8_t i;
+
+    for (i = 0; i < n; i++) {
+        if (!pwmChannelBegin(&ch, pins[i])) {
+            return (0);
+        }
+        *opened = i + 1;
+        if (timer != NULL && ch.timer != timer) {
+            return (0);
+        }
+        timer = ch.timer;
+        m->pins[i] = pins[i];
+        m->ccrs[i] = ch.ccr;
+    }
+
+    /* another analogWrite() output on the timer would be garbled */
+    if (timer_ccrs_in_use[((uint32_t)timer - TIMER_A0_BASE) >> 10] != n) {
+        return (0);
+    }
+
+    /* CCR0 is half the period, 0xffff is reserved for "never matches" */
+    PowerMSP432_getFreqs(Power_getPerformanceLevel(), &freqs);
+    counts = freqs.SMCLK / hz / 2;
+    for (div = 1; counts / div > 0xfffe; div <<= 1) {
+        ;
+    }
+    if (div > 64) {
+        return (0);
+    }
+
+    clk = freqs.SMCLK / div;
+    dead = ((uint64_t)deadNs * clk + 999999999) / 1000000000;
+    m->timer = timer;
+    m->period = counts / div;
+    m->max = pwmMaxValue;
+
+    /* room to get from CCR0's flag to the CCR writes, ~64 CPU cycles */
+    m->window = ((uint64_t)64 * clk + freqs.MCLK - 1) / freqs.MCLK + 2;
+
+    if (m->period < dead + 2 * m->window + 2) {
+        return (0);
+    }
+    m->dead = dead;
+
+    return (div);
+}
+
+/*
+ * \brief           Starts complementary PWM pairs with dead-time.
+ * \param[out] m    The handle to initialize.
+ * \param[in] pins  High side, low side pin for each pair.
+ * \param[in] pairs 1 or 2, e.g. 2 for a full H-bridge.
+ * \param[in] hz    The PWM frequency.
+ * \param[in] deadNs The minimum time both outputs of a pair are off
+ *                  around each switch, in ns.
+ * \return          false if the pins are not all on one otherwise
+ *                  unused Timer_A, or hz/deadNs can't be generated.
+ *
+ * The pins are opened with analogWrite() and must land on the same
+ * timer: open them before other analogWrite() pins, or use the fixed
+ * TA2 pins P5.6, P5.7, P6.6 and P6.7. The timer then runs center
+ * aligned at hz (up/down, so the PWM resolution is half that of
+ * analogWrite() at the same frequency); its other CCRs are kept from
+ * analogWrite(), analogFrequency() leaves it alone, and performance
+ * level changes are disallowed until motorPwmEnd(). All pairs start
+ * with the high side off and the low side on. On failure the pins
+ * are left as low digital outputs.
+ */
+bool motorPwmBegin(MotorPwm *m, const uint8_t *pins, uint8_t pairs,
+    uint32_t hz, uint32_t deadNs)
+{
+    Timer_A_Type *timer;
+    uint32_t hwiKey;
+    uint8_t i, n, tmr, opened = 0;
+    uint16_t div;
+
+    m->pairs = 0;
+    n = pairs * 2;
+    if (pairs == 0 || pairs > MOTOR_PWM_MAX_PAIRS || hz == 0) {
+        return (false);
+    }
+
+    div = motorPwmOpen(m, pins, n, hz, deadNs, &opened);
+    if (div == 0) {
+        for (i = 0; i < opened; i++) {
+            pinMode(pins[i], OUTPUT);
+        }
+        return (false);
+    }
+
+    timer = m->timer;
+    tmr = ((uint32_t)timer - TIMER_A0_BASE) >> 10;
+
+    Power_setConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    hwiKey = Hwi_disable();
+
+    /* keep analogWrite() off the timer's remaining CCRs */
+    for (i = 0; i < 4; i++) {
+        if (used_pwm_port_pins[tmr * 4 + i] == PWM_NOT_IN_USE) {
+            used_pwm_port_pins[tmr * 4 + i] = PWM_IN_USE;
+        }
+    }
+    motorPwmTimers |= 1 << tmr;
+
+    timer->CTL = 0;
+    for (i = 0; i < n; i++) {
+        timer->CCTL[m->ccrs[i] - timer->CCR] = TIMER_A_CCTLN_OUTMOD_0;
+        *m->ccrs[i] = 0xffff;
+    }
+    timer->CCR[0] = m->period;
+    timer->EX0 = (div > 8) ? div / 8 - 1 : 0;
+    timer->CTL = TIMER_A_CTL_SSEL__SMCLK | TIMER_A_CTL_CLR |
+        ((div > 8) ? TIMER_A_CTL_ID__8 :
+        (__builtin_ctz(div) << TIMER_A_CTL_ID_OFS));
+    for (i = 0; i < n; i++) {
+        timer->CCTL[m->ccrs[i] - timer->CCR] = (i & 1) ?
+            TIMER_A_CCTLN_OUTMOD_6 : TIMER_A_CCTLN_OUTMOD_2;
+    }
+    timer->CTL |= TIMER_A_CTL_MC__UPDOWN;
+
+    m->pairs = pairs;
+
+    Hwi_restore(hwiKey);
+
+    return (true);
+}
+
+/*
+ * \brief           Sets the duty of every pair of a motorPwmBegin() handle.
+ * \param[in] m     The handle.
+ * \param[in] vals  High side duty per pair, 0 to
+ *                  2^analogWriteResolution()-1; 0 turns the high side
+ *                  off and the low side fully on.
+ *
+ * All pairs change in the same PWM period, and no output ever misses
+ * or doubles an edge, so the dead band holds through the update.
+ * Waits at most a period unless interrupts keep landing in the
+ * update windows. The high side duty is capped a few timer counts
+ * short of 100%.
+ */
+void motorPwmWrite(const MotorPwm *m, const uint32_t *vals)
+{
+    Timer_A_Type *timer = m->timer;
+    uint16_t compares[2 * MOTOR_PWM_MAX_PAIRS];
+    uint16_t top = 0, bottom = 0xffff;
+    uint16_t ctl, cctl, r;
+    bool finite = true;
+    uint32_t hwiKey;
+    uint8_t i, n = m->pairs * 2;
+
+    for (i = 0; i < m->pairs; i++) {
+        motorPwmCompares(m, vals[i], &compares[i * 2], &compares[i * 2 + 1]);
+    }
+
+    /* the window after the bottom only works if nothing is turned off */
+    for (i = 0; i < n; i++) {
+        uint16_t c[2] = {compares[i], *m->ccrs[i]};
+        uint8_t j;
+
+        for (j = 0; j < 2; j++) {
+            if (c[j] == 0xffff) {
+                finite = false;
+                continue;
+            }
+            if (c[j] > top) {
+                top = c[j];
+            }
+            if (c[j] < bottom) {
+                bottom = c[j];
+            }
+        }
+    }
+    if (bottom < m->window) {
+        finite = false;
+    }
+
+    for (;;) {
+        timer->CCTL[0] &= ~TIMER_A_CCTLN_CCIFG;
+        timer->CTL &= ~TIMER_A_CTL_IFG;
+        do {
+            cctl = timer->CCTL[0];
+            ctl = timer->CTL;
+        } while (!(cctl & TIMER_A_CCTLN_CCIFG) &&
+            !(finite && (ctl & TIMER_A_CTL_IFG)));
+
+        hwiKey = Hwi_disable();
+        r = timer->R;
+        if (((cctl & TIMER_A_CCTLN_CCIFG) && r > top) ||
+            (finite && (ctl & TIMER_A_CTL_IFG) && r < bottom)) {
+            for (i = 0; i < n; i++) {
+                *m->ccrs[i] = compares[i];
+            }
+            Hwi_restore(hwiKey);
+            return;
+        }
+        Hwi_restore(hwiKey);
+    }
+}
+
+/*
+ * \brief           Stops motorPwmBegin() outputs.
+ * \param[in] m     The handle.
+ *
+ * Turns every output off at once, then hands the pins back as low
+ * digital outputs and the timer back to analogWrite().
+ */
+void motorPwmEnd(MotorPwm *m)
+{
+    Timer_A_Type *timer = m->timer;
+    uint32_t hwiKey;
+    uint8_t i, n = m->pairs * 2;
+    uint8_t tmr;
+
+    if (m->pairs == 0) {
+        return;
+    }
+
+    tmr = ((uint32_t)timer - TIMER_A0_BASE) >> 10;
+
+    hwiKey = Hwi_disable();
+
+    for (i = 0; i < n; i++) {
+        timer->CCTL[m->ccrs[i] - timer->CCR] = TIMER_A_CCTLN_OUTMOD_0;
+    }
+    timer->CTL &= ~TIMER_A_CTL_MC_MASK;
+
+    for (i = 0; i < 4; i++) {
+        if (used_pwm_port_pins[tmr * 4 + i] == PWM_IN_USE) {
+            used_pwm_port_pins[tmr * 4 + i] = PWM_NOT_IN_USE;
+        }
+    }
+    motorPwmTimers &= ~(1 << tmr);
+    m->pairs = 0;
+
+    Hwi_restore(hwiKey);
+
+    Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    for (i = 0; i < n; i++) {
+        pinMode(m->pins[i], OUTPUT);
+    }
+}
+
+/*
+ * Dedicated timer outputs: servoPwmBegin(), timerToneBegin() and
+ * pwmChannelBeginTimer() take a whole Timer_A, count it up from SMCLK and drive pins straight from
+ * its CCRs. The PWM driver is not involved (it would open the timer at
+ * analogFrequency()); the timer's CCRs are marked PWM_IN_USE to keep
+ * analogWrite() off it. Only TA0-TA2 have output pins: TA0/TA1 are
+ * port mapped to any mappable pin, TA2 has the fixed pins P5.6, P5.7,
+ * P6.6 and P6.7.
+ *
+ * A servo timer runs at the servo period and each of its CCRs drives
+ * one servo in reset/set mode, so a pulse starts at the top of the
+ * period and ends when the count reaches the CCR; servos with the same
+ * period share a timer. A tone timer runs at half the tone period and
+ * toggles its one output every period. pwmChannelBeginTimer() runs
+ * one reset/set output at a frequency of its own.
+ */
+#define OUTPUT_TIMERS       3
+
+/* CCRn of each servo or tone timer driving a pin, bit n-1 */
+static uint8_t outputCcrs[OUTPUT_TIMERS];
+static uint32_t servoPwmPeriodUs[OUTPUT_TIMERS];
+
+/* pin of each tone or pwmChannelBeginTimer() timer */
+static uint8_t outputPins[OUTPUT_TIMERS];
+
+static void timerReserveCcrs(uint8_t timer, bool reserve);
+
+/*
+ *  ======== outputPinDecode ========
+ */
+static void outputPinDecode(uint8_t pin, uint_fast8_t *port,
+    uint_fast16_t *pinMask, uint16_t *pinNum)
+{
+    uint16_t pinId = digital_pin_to_port_pin[pin];
+
+    *port = pinId >> 8;
+    *pinMask = pinId & 0xff;
+    *pinNum = __builtin_ctz(*pinMask);
+}
+
+/*
+ *  ======== outputTimerFree ========
+ *  Whether a timer can be taken for owner's outputs: reserved for
+ *  owner, or not reserved and unused. Called with interrupts disabled.
+ */
+static bool outputTimerFree(uint8_t tmr, uint8_t owner, bool reserved)
+{
+    Timer_A_Type *timer = TIMER_A_CMSIS(TIMER_A0_BASE + tmr * 0x400);
+
+    if (outputTimers() & (1 << tmr)) {
+        return (false);
+    }
+
+    if (reserved) {
+        return (timerOwners[tmr] == owner &&
+            !(timersCreated & (1 << tmr)) && timer_ccrs_in_use[tmr] == 0);
+    }
+
+    return (timerOwners[tmr] == TIMER_OWNER_NONE &&
+        (Timer_getAvailMask() & (1 << tmr)) &&
+        timer_ccrs_in_use[tmr] == 0 &&
+        (timer->CTL & TIMER_A_CTL_MC_MASK) == 0);
+}
+
+/*
+ *  ======== outputTimerFind ========
+ *  PWM index (timer * 4 + CCRn - 1) of a free timer pin can be driven
+ *  from, one reserved for owner first; a mappable pin gets CCR1.
+ *  PWM_NOT_MAPPABLE if there is none. Called with interrupts disabled.
+ */
+static uint8_t outputTimerFind(uint8_t pin, uint8_t owner)
+{
+    uint8_t pwmIndex = digital_pin_to_pwm_index[pin];
+    uint8_t tmr, pass;
+
+    for (pass = 0; pass < 2; pass++) {
+        if (pwmIndex == PWM_MAPPABLE) {
+            for (tmr = 0; tmr < 2; tmr++) {
+                if (outputTimerFree(tmr, owner, pass == 0)) {
+                    return (tmr * 4);
+                }
+            }
+        }
+        else if (pwmIndex > PWM_MAX_MAPPABLE_INDEX &&
+            pwmIndex < PWM_AVAILABLE_PWMS) {
+            if (outputTimerFree(pwmIndex >> 2, owner, pass == 0)) {
+                return (pwmIndex);
+            }
+        }
+    }
+
+    return (PWM_NOT_MAPPABLE);
+}
+
+/*
+ *  ======== outputTimerProgram ========
+ *  (Re)start the timer counting up with a period of counts SMCLK
+ *  cycles; false if Timer_A can't count that far. Called with
+ *  interrupts disabled.
+ */
+static bool outputTimerProgram(Timer_A_Type *timer, uint64_t counts)
+{
+    uint32_t div;
+
+    /* Timer_A's 16 bit period times its largest prescaler, 64 */
+    for (div = 1; counts / div > 0xffff; div <<= 1) {
+        ;
+    }
+    if (div > 64 || counts / div < 2) {
+        return (false);
+    }
+
+    timer->CTL = 0;
+    timer->CCTL[0] = 0;
+    timer->CCR[0] = counts / div - 1;
+    timer->EX0 = (div > 8) ? div / 8 - 1 : 0;
+    timer->CTL = TIMER_A_CTL_SSEL__SMCLK | TIMER_A_CTL_CLR |
+        ((div > 8) ? TIMER_A_CTL_ID__8 :
+        (__builtin_ctz(div) << TIMER_A_CTL_ID_OFS)) |
+        TIMER_A_CTL_MC__UP;
+
+    return (true);
+}
+
+/*
+ *  ======== outputTimerTake ========
+ *  Keep everyone else off a timer found by outputTimerFind(). SMCLK
+ *  must not change under it and Timer_A stops in DEEPSLEEP_0. Called
+ *  with interrupts disabled.
+ */
+static void outputTimerTake(uint8_t tmr)
+{
+    timerReserveCcrs(tmr, true);
+    Timer_setAvailMask(Timer_getAvailMask() & ~(1 << tmr));
+
+    Power_setConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+    Power_setConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+}
+
+/*
+ *  ======== outputTimerGive ========
+ *  Stop a taken timer and hand it back; its outputTimers() bit must be
+ *  clear. A timerReserve() reservation keeps the timer, and for tone()
+ *  or Servo its CCRs. Called with interrupts disabled.
+ */
+static void outputTimerGive(uint8_t tmr)
+{
+    Timer_A_Type *timer = TIMER_A_CMSIS(TIMER_A0_BASE + tmr * 0x400);
+
+    timer->CTL = 0;
+    outputCcrs[tmr] = 0;
+
+    if (timerOwners[tmr] == TIMER_OWNER_NONE ||
+        timerOwners[tmr] == TIMER_OWNER_PWM) {
+        timerReserveCcrs(tmr, false);
+    }
+    if (timerOwners[tmr] == TIMER_OWNER_NONE &&
+        !(timersCreated & (1 << tmr))) {
+        Timer_setAvailMask(Timer_getAvailMask() | (1 << tmr));
+    }
+
+    Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+    Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+}
+
+/*
+ *  ======== outputPinAttach ========
+ *  Route the CCR at pwmIndex to pin. Called with interrupts disabled.
+ */
+static void outputPinAttach(uint8_t pin, uint8_t pwmIndex)
+{
+    uint_fast8_t port;
+    uint_fast16_t pinMask;
+    uint16_t pinNum;
+
+    outputPinDecode(pin, &port, &pinMask, &pinNum);
+
+    if (pwmIndex <= PWM_MAX_MAPPABLE_INDEX) {
+        /* the following code was extracted from PMAP_configurePort() */
+        PMAP->KEYID = PMAP_KEYID_VAL;
+        PMAP->CTL = (PMAP->CTL & ~PMAP_CTL_PRECFG) | PMAP_ENABLE_RECONFIGURATION;
+        HWREG8(PMAP_BASE + pinNum + pxmap[port]) =
+            (mapped_pwm_pin_ccrs[pwmIndex] >> 10) & 0x1f;
+        PMAP->KEYID = 0;
+    }
+    MAP_GPIO_setAsPeripheralModuleFunctionOutputPin(port, pinMask,
+        GPIO_PRIMARY_MODULE_FUNCTION);
+}
+
+/*
+ *  ======== outputPinDetach ========
+ *  Make pin a low digital output again and undo its port mapping.
+ *  Called with interrupts disabled.
+ */
+static void outputPinDetach(uint8_t pin, uint8_t tmr)
+{
+    uint_fast8_t port;
+    uint_fast16_t pinMask;
+    uint16_t pinNum;
+
+    outputPinDecode(pin, &port, &pinMask, &pinNum);
+
+    MAP_GPIO_setOutputLowOnPin(port, pinMask);
+    MAP_GPIO_setAsOutputPin(port, pinMask);
+
+    if (tmr < 2) {
+        PMAP->KEYID = PMAP_KEYID_VAL;
+        PMAP->CTL = (PMAP->CTL & ~PMAP_CTL_PRECFG) | PMAP_ENABLE_RECONFIGURATION;
+        HWREG8(PMAP_BASE + pinNum + pxmap[port]) = PMAP_NONE;
+        PMAP->KEYID = 0;
+    }
+}
+
+/*
+ *  ======== servoPwmFind ========
+ *  PWM index for a servo on pin: a free CCR of a servo timer already
+ *  running at periodUs, else the first CCR of a timer that can be
+ *  started. PWM_NOT_MAPPABLE if there is none. Called with interrupts
+ *  disabled.
+ */
+static uint8_t servoPwmFind(uint8_t pin, uint32_t periodUs)
+{
+    uint8_t pwmIndex = digital_pin_to_pwm_index[pin];
+    uint8_t tmr, ccr;
+
+    if (pwmIndex == PWM_MAPPABLE) {
+        for (tmr = 0; tmr < 2; tmr++) {
+            if ((servoPwmTimers & (1 << tmr)) &&
+                servoPwmPeriodUs[tmr] == periodUs &&
+                outputCcrs[tmr] != 0xf) {
+                return (tmr * 4 + __builtin_ctz(~outputCcrs[tmr]));
+            }
+        }
+    }
+    else if (pwmIndex > PWM_MAX_MAPPABLE_INDEX &&
+        pwmIndex < PWM_AVAILABLE_PWMS) {
+        /* a fixed TA2 pin only has its own CCR */
+        tmr = pwmIndex >> 2;
+        ccr = 1 << (pwmIndex & 3);
+        if (servoPwmTimers & (1 << tmr)) {
+            if (servoPwmPeriodUs[tmr] == periodUs &&
+                !(outputCcrs[tmr] & ccr)) {
+                return (pwmIndex);
+            }
+            return (PWM_NOT_MAPPABLE);
+        }
+    }
+
+    return (outputTimerFind(pin, TIMER_OWNER_SERVO));
+}
+
+/*
+ * \brief           Starts hardware servo pulses on a pin.
+ * \param[out] s    The handle to initialize.
+ * \param[in] pin   A PWM capable pin, not in analogWrite() use.
+ * \param[in] periodUs The pulse period in us, usually 20000.
+ * \param[in] us    The first pulse width in us.
+ * \return          false if the pin can't do PWM or no timer is free.
+ *
+ * Servos with the same period share a timer, up to four per timer: a
+ * mappable pin lands on TA0 or TA1, P5.6, P5.7, P6.6 and P6.7 on TA2.
+ * A timer is only started if no one else uses it, one reserved with
+ * timerReserve(timer, TIMER_OWNER_SERVO) first. While a servo timer
+ * runs, performance level changes and DEEPSLEEP_0 are disallowed.
+ */
+bool servoPwmBegin(ServoPwm *s, uint8_t pin, uint32_t periodUs, uint32_t us)
+{
+    PowerMSP432_Freqs freqs;
+    Timer_A_Type *timer;
+    uint32_t hwiKey;
+    uint8_t pwmIndex, tmr, ccr;
+
+    s->timer = NULL;
+    if (periodUs == 0 ||
+        digital_pin_to_pin_function[pin] == PIN_FUNC_ANALOG_OUTPUT) {
+        return (false);
+    }
+
+    hwiKey = Hwi_disable();
+
+    pwmIndex = servoPwmFind(pin, periodUs);
+    if (pwmIndex == PWM_NOT_MAPPABLE) {
+        Hwi_restore(hwiKey);
+        return (false);
+    }
+
+    tmr = pwmIndex >> 2;
+    ccr = (pwmIndex & 3) + 1;
+    timer = TIMER_A_CMSIS(TIMER_A0_BASE + tmr * 0x400);
+
+    if (!(servoPwmTimers & (1 << tmr))) {
+        PowerMSP432_getFreqs(Power_getPerformanceLevel(), &freqs);
+        if (!outputTimerProgram(timer,
+            (uint64_t)freqs.SMCLK * periodUs / 1000000)) {
+            Hwi_restore(hwiKey);
+            return (false);
+        }
+        outputTimerTake(tmr);
+        servoPwmTimers |= 1 << tmr;
+        servoPwmPeriodUs[tmr] = periodUs;
+    }
+    outputCcrs[tmr] |= 1 << (ccr - 1);
+
+    s->timer = timer;
+    s->ccr = &timer->CCR[ccr];
+    s->period = timer->CCR[0] + 1;
+    s->periodUs = periodUs;
+    s->pin = pin;
+
+    timer->CCTL[ccr] = TIMER_A_CCTLN_OUTMOD_0;
+    servoPwmWrite(s, us);
+    timer->CCTL[ccr] = TIMER_A_CCTLN_OUTMOD_7;
+
+    outputPinAttach(pin, pwmIndex);
+
+    Hwi_restore(hwiKey);
+
+    return (true);
+}
+
+/*
+ * \brief           Sets the pulse width of a servoPwmBegin() output.
+ * \param[in] s     The handle.
+ * \param[in] us    The pulse width in us, capped at the period.
+ *
+ * Takes effect in the current period if its pulse is still ahead or
+ * running and longer than us, else in the next one. A pulse already
+ * past the new width is ended on the spot rather than left to run to
+ * the end of the period, which the compare would otherwise miss.
  */
+void servoPwmWrite(const ServoPwm *s, uint32_t us)
+{
+    Timer_A_Type *timer = s->timer;
+    uint16_t compare, old, r, cctl;
+    uint32_t hwiKey;
+    uint8_t ccr;
+
+    if (timer == NULL) {
+        return;
+    }
+    if (us > s->periodUs) {
+        us = s->periodUs;
+    }
 
-#define PWM_SCALE_FACTOR 24480/255
+    compare = (uint64_t)us * s->period / s->periodUs;
+    ccr = s->ccr - timer->CCR;
 
-void analogWrite(uint8_t pin, int val)
+    hwiKey = Hwi_disable();
+
+    old = *s->ccr;
+    *s->ccr = compare;
+    r = timer->R;
+    if (r >= compare && r < old) {
+        /* OUTMOD_0 with OUT clear drives the output low right away */
+        cctl = timer->CCTL[ccr];
+        timer->CCTL[ccr] = cctl & ~(TIMER_A_CCTLN_OUTMOD_MASK |
+            TIMER_A_CCTLN_OUT);
+        timer->CCTL[ccr] = cctl;
+    }
+
+    Hwi_restore(hwiKey);
+}
+
+/*
+ * \brief           Stops a servoPwmBegin() output.
+ * \param[in] s     The handle.
+ *
+ * Leaves the pin a low digital output; the last servo on a timer
+ * stops it and hands it back.
+ */
+void servoPwmEnd(ServoPwm *s)
 {
-    uint16_t pinId, pinNum;
-    uint8_t pwmIndex, timerId;
-    uint_fast8_t port;
-    uint_fast16_t pinMask;
+    Timer_A_Type *timer = s->timer;
     uint32_t hwiKey;
-    uint32_t pwmPin;
+    uint8_t tmr, ccr;
+
+    if (timer == NULL) {
+        return;
+    }
+
+    tmr = ((uint32_t)timer - TIMER_A0_BASE) >> 10;
+    ccr = s->ccr - timer->CCR;
 
     hwiKey = Hwi_disable();
 
-    if (digital_pin_to_pin_function[pin] == PIN_FUNC_ANALOG_OUTPUT) {
-        pwmIndex = digital_pin_to_pwm_index[pin];
+    timer->CCTL[ccr] = TIMER_A_CCTLN_OUTMOD_0;
+    outputPinDetach(s->pin, tmr);
+
+    outputCcrs[tmr] &= ~(1 << (ccr - 1));
+    if (outputCcrs[tmr] == 0) {
+        servoPwmTimers &= ~(1 << tmr);
+        outputTimerGive(tmr);
     }
-    else {
-        /* re-configure pin if possible */
-        PWM_Params pwmParams;
-        PWM_Handle pwmHandle;
 
-        /*
-         * The pwmIndex fetched from the pin_to_pwm_index[] table
-         * is either an actual index into the PWM instance table
-         * if the pin has already been mapped to a PWM resource,
-         * or a mappable port/pin ID, or NOT_MAPPABLE.
-         */
-        pwmIndex = digital_pin_to_pwm_index[pin];
+    s->timer = NULL;
 
-        if (pwmIndex == PWM_NOT_MAPPABLE) {
-            Hwi_restore(hwiKey);
-            return; /* can't get there from here */
-        }
+    Hwi_restore(hwiKey);
+}
 
-        pinId = GPIOMSP432_config.pinConfigs[pin] & 0xffff;
-        port = pinId >> 8;
-        pinMask = pinId & 0xff;
-        pinNum = 0;
-        while (((1 << pinNum) & pinMask) == 0) pinNum++;
+/*
+ *  ======== timerToneBegin ========
+ *  tone() square wave at hz on pin from a Timer_A of its own; retunes
+ *  a tone already on pin. false if pin has no timer output or no timer
+ *  is free, or hz is out of reach (below ~3Hz at 12MHz SMCLK).
+ */
+bool timerToneBegin(uint8_t pin, uint32_t hz)
+{
+    PowerMSP432_Freqs freqs;
+    Timer_A_Type *timer;
+    uint64_t counts;
+    uint32_t hwiKey;
+    uint8_t pwmIndex, tmr, ccr;
 
-        if (pwmIndex < PWM_AVAILABLE_PWMS) { /* fixed mapping */
-            if (used_pwm_port_pins[pwmIndex] != PWM_NOT_IN_USE) {
-                Hwi_restore(hwiKey);
-                return; /* PWM port already in use */
-            }
-            /*
-             * encode port/pin to inform stopAnalogWrite() that
-             * this is a fixed mapped pin
-             */
+    if (hz == 0 ||
+        digital_pin_to_pin_function[pin] == PIN_FUNC_ANALOG_OUTPUT) {
+        return (false);
+    }
 
-            used_pwm_port_pins[pwmIndex] = pwmIndex;
+    PowerMSP432_getFreqs(Power_getPerformanceLevel(), &freqs);
+    counts = freqs.SMCLK / (2 * (uint64_t)hz);
 
-            /* plug pwmPin in HwAttrs with corresponding encoded pin identifier */
-            pwmTimerMSP432HWAttrs[pwmIndex].pwmPin = fixed_map_pwm_pins[pwmIndex-8];
-        }
-        else {
-            /* find an unused PWM resource and port map it */
-            for (pwmIndex = 0; pwmIndex < PWM_AVAILABLE_PWMS; pwmIndex++) {
-                if (used_pwm_port_pins[pwmIndex] == PWM_NOT_IN_USE) {
-                    /* remember which pinId is being used by this PWM resource */
-                    used_pwm_port_pins[pwmIndex] = pinId; /* save port/pin info */
-                    /* remember which PWM resource is being used by this pin */
-                    digital_pin_to_pwm_index[pin] = pwmIndex; /* save pwm index */
-                    break;
-                }
-            }
+    hwiKey = Hwi_disable();
 
-            if (pwmIndex >= PWM_AVAILABLE_PWMS) {
+    for (tmr = 0; tmr < OUTPUT_TIMERS; tmr++) {
+        if ((toneTimers & (1 << tmr)) && outputPins[tmr] == pin) {
+            timer = TIMER_A_CMSIS(TIMER_A0_BASE + tmr * 0x400);
+            if (!outputTimerProgram(timer, counts)) {
                 Hwi_restore(hwiKey);
-                return; /* no unused PWM ports */
+                timerToneEnd(pin);
+                return (false);
             }
-
-            /* encode pwmPin field with port/pin/TAxCCRyA info */
-            pwmPin = port << 4 | pinNum;
-            pwmPin = pwmPin | mapped_pwm_pin_ccrs[pwmIndex];
-            pwmTimerMSP432HWAttrs[pwmIndex].pwmPin = pwmPin;
+            Hwi_restore(hwiKey);
+            return (true);
         }
+    }
 
-        PWM_Params_init(&pwmParams);
+    pwmIndex = outputTimerFind(pin, TIMER_OWNER_TONE);
+    if (pwmIndex == PWM_NOT_MAPPABLE) {
+        Hwi_restore(hwiKey);
+        return (false);
+    }
 
-        /* Open the PWM port */
-        pwmParams.periodUnits = PWM_PERIOD_US;
-        pwmParams.periodValue = 2040; /* arduino period is 2.04ms (490Hz) */
-        pwmParams.dutyUnits = PWM_DUTY_COUNTS;
+    tmr = pwmIndex >> 2;
+    ccr = (pwmIndex & 3) + 1;
+    timer = TIMER_A_CMSIS(TIMER_A0_BASE + tmr * 0x400);
 
-        /* PWM_open() will fail if the timer's CCR is already in use */
-        pwmHandle = PWM_open(pwmIndex, &pwmParams);
+    timer->CCTL[ccr] = TIMER_A_CCTLN_OUTMOD_0;
+    if (!outputTimerProgram(timer, counts)) {
+        Hwi_restore(hwiKey);
+        return (false);
+    }
+    outputTimerTake(tmr);
+    toneTimers |= 1 << tmr;
+    outputPins[tmr] = pin;
+    outputCcrs[tmr] = 1 << (ccr - 1);
 
-        /*
-         * Assume that the timer was already in use by someone else.
-         * mark all associated CCRs busy so we don't keep re-trying this
-         * timer's pwmIndexes.
-         */
-        if (pwmHandle == NULL) {
-            pwmIndex &= 0xfc; /* start at base of this timer's PWM indexes */
-            used_pwm_port_pins[pwmIndex++] = PWM_IN_USE;
-            used_pwm_port_pins[pwmIndex++] = PWM_IN_USE;
-            used_pwm_port_pins[pwmIndex++] = PWM_IN_USE;
-            used_pwm_port_pins[pwmIndex] = PWM_IN_USE;
-            Hwi_restore(hwiKey);
-            return;
+    timer->CCR[ccr] = 0;
+    timer->CCTL[ccr] = TIMER_A_CCTLN_OUTMOD_4;
+
+    outputPinAttach(pin, pwmIndex);
+
+    Hwi_restore(hwiKey);
+
+    return (true);
+}
+
+/*
+ *  ======== timerToneEnd ========
+ *  Stop a timerToneBegin() tone, leaving pin a low digital output.
+ *  Does nothing if no timer tone is on pin.
+ */
+void timerToneEnd(uint8_t pin)
+{
+    Timer_A_Type *timer;
+    uint32_t hwiKey;
+    uint8_t tmr;
+
+    hwiKey = Hwi_disable();
+
+    for (tmr = 0; tmr < OUTPUT_TIMERS; tmr++) {
+        if ((toneTimers & (1 << tmr)) && outputPins[tmr] == pin) {
+            timer = TIMER_A_CMSIS(TIMER_A0_BASE + tmr * 0x400);
+            timer->CCTL[__builtin_ctz(outputCcrs[tmr]) + 1] =
+                TIMER_A_CCTLN_OUTMOD_0;
+            outputPinDetach(pin, tmr);
+            toneTimers &= ~(1 << tmr);
+            outputTimerGive(tmr);
+            break;
         }
+    }
 
-        /* start the timer */
-        PWM_start(pwmHandle);
+    Hwi_restore(hwiKey);
+}
 
-        /* remove timer from pool of available timers if not in use */
-        timerId = pwmIndex >> 2;
-        timer_ccrs_in_use[timerId] += 1;
-        if (timer_ccrs_in_use[timerId] == 1) {
-            Timer_setAvailMask(Timer_getAvailMask() & ~(1 << timerId));
+/*
+ * \brief           Opens a PWM channel on a Timer_A of its own.
+ * \param[out] ch   The handle, for pwmChannelWrite() and pwmWaveform*().
+ * \param[in] pin   A PWM capable pin, not in analogWrite() use.
+ * \param[in] hz    The PWM frequency, independent of analogFrequency().
+ * \return          false if the pin can't do PWM, no timer is free or
+ *                  hz is out of reach.
+ *
+ * For outputs that need a frequency of their own, e.g. a sample rate.
+ * The timer is taken as for servoPwmBegin(), a timer reserved for
+ * TIMER_OWNER_PWM first, and no other output shares it. The output
+ * starts off; performance level changes and DEEPSLEEP_0 are disallowed
+ * until pwmChannelEndTimer().
+ */
+bool pwmChannelBeginTimer(PwmChannel *ch, uint8_t pin, uint32_t hz)
+{
+    PowerMSP432_Freqs freqs;
+    Timer_A_Type *timer;
+    uint32_t hwiKey;
+    uint8_t pwmIndex, tmr, ccr;
+
+    ch->timer = NULL;
+    if (hz == 0 ||
+        digital_pin_to_pin_function[pin] == PIN_FUNC_ANALOG_OUTPUT) {
+        return (false);
+    }
+
+    PowerMSP432_getFreqs(Power_getPerformanceLevel(), &freqs);
+
+    hwiKey = Hwi_disable();
+
+    pwmIndex = outputTimerFind(pin, TIMER_OWNER_PWM);
+    if (pwmIndex == PWM_NOT_MAPPABLE) {
+        Hwi_restore(hwiKey);
+        return (false);
+    }
+
+    tmr = pwmIndex >> 2;
+    ccr = (pwmIndex & 3) + 1;
+    timer = TIMER_A_CMSIS(TIMER_A0_BASE + tmr * 0x400);
+
+    timer->CCTL[ccr] = TIMER_A_CCTLN_OUTMOD_0;
+    if (!outputTimerProgram(timer, freqs.SMCLK / hz)) {
+        Hwi_restore(hwiKey);
+        return (false);
+    }
+    outputTimerTake(tmr);
+    pwmOwnTimers |= 1 << tmr;
+    outputPins[tmr] = pin;
+    outputCcrs[tmr] = 1 << (ccr - 1);
+
+    timer->CCR[ccr] = 0;
+    timer->CCTL[ccr] = TIMER_A_CCTLN_OUTMOD_7;
+
+    ch->timer = timer;
+    ch->ccr = &timer->CCR[ccr];
+    ch->period = timer->CCR[0];
+    ch->max = pwmMaxValue;
+
+    outputPinAttach(pin, pwmIndex);
+
+    Hwi_restore(hwiKey);
+
+    return (true);
+}
+
+/*
+ * \brief           Closes a pwmChannelBeginTimer() channel.
+ * \param[in] ch    The handle.
+ *
+ * Stops a waveform playing on it and leaves the pin a low digital
+ * output.
+ */
+void pwmChannelEndTimer(PwmChannel *ch)
+{
+    Timer_A_Type *timer = ch->timer;
+    uint32_t hwiKey;
+    uint8_t tmr;
+
+    if (timer == NULL) {
+        return;
+    }
+    tmr = ((uint32_t)timer - TIMER_A0_BASE) >> 10;
+    if (tmr >= OUTPUT_TIMERS || !(pwmOwnTimers & (1 << tmr))) {
+        return;
+    }
+
+    pwmWaveformEnd(ch);
+
+    hwiKey = Hwi_disable();
+
+    timer->CCTL[ch->ccr - timer->CCR] = TIMER_A_CCTLN_OUTMOD_0;
+    outputPinDetach(outputPins[tmr], tmr);
+    pwmOwnTimers &= ~(1 << tmr);
+    outputTimerGive(tmr);
+    ch->timer = NULL;
+
+    Hwi_restore(hwiKey);
+}
+
+/*
+ * Timer_A planning. A timer serves either analogWrite() (all its CCRs
+ * share one period) or one interrupt service like tone() or Servo,
+ * which take it from SYS/BIOS' Timer module. Left alone, who gets
+ * which timer depends on call order; timerReserve() fixes it up front.
+ */
+
+/*
+ *  ======== timerReserveCcrs ========
+ *  Mark the timer's unused CCRs so analogWrite() stays off them, or
+ *  undo that
+ */
+static void timerReserveCcrs(uint8_t timer, bool reserve)
+{
+    uint8_t i;
+
+    /* a running servo or tone timer keeps its CCRs marked */
+    if (!reserve && (outputTimers() & (1 << timer))) {
+        return;
+    }
+
+    for (i = timer * 4; i < timer * 4 + 4 && i < PWM_AVAILABLE_PWMS; i++) {
+        if (reserve && used_pwm_port_pins[i] == PWM_NOT_IN_USE) {
+            used_pwm_port_pins[i] = PWM_IN_USE;
+        }
+        else if (!reserve && used_pwm_port_pins[i] == PWM_IN_USE) {
+            used_pwm_port_pins[i] = PWM_NOT_IN_USE;
         }
+    }
+}
 
-        digital_pin_to_pin_function[pin] = PIN_FUNC_ANALOG_OUTPUT;
+/*
+ * \brief           Reserves a Timer_A for one user ahead of time.
+ * \param timer     0-3 for TA0-TA3.
+ * \param owner     TIMER_OWNER_PWM: analogWrite() and friends map pins
+ *                  only to timers reserved for PWM (the fixed TA2 pins
+ *                  excepted), and no Timer_create() gets them.
+ *                  TIMER_OWNER_TONE, TIMER_OWNER_SERVO: tone() or Servo
+ *                  use this timer instead of the first free one.
+ *                  TIMER_OWNER_SKETCH: kept from all of the above, for
+ *                  the sketch's own use.
+ * \return          false if the timer is already in use or reserved
+ *                  for someone else.
+ *
+ * Call from setup() before starting any of them. TA3 is the Clock
+ * tick timer on these boards and can't be reserved.
+ */
+bool timerReserve(uint8_t timer, uint8_t owner)
+{
+    uint32_t hwiKey;
+    uint8_t current, ccrs;
+
+    if (timer >= PWM_TIMERS || owner == TIMER_OWNER_NONE ||
+        owner >= TIMER_OWNER_UNKNOWN) {
+        return (false);
+    }
+
+    hwiKey = Hwi_disable();
+
+    if (timerOwners[timer] != TIMER_OWNER_NONE) {
+        Hwi_restore(hwiKey);
+        return (timerOwners[timer] == owner);
+    }
+
+    /* PWM, servo or tone outputs already on it are fine for their owner */
+    current = timerOwner(timer, &ccrs);
+    if (current != TIMER_OWNER_NONE && current != owner) {
+        Hwi_restore(hwiKey);
+        return (false);
+    }
+
+    timerOwners[timer] = owner;
+    if (owner != TIMER_OWNER_PWM) {
+        timerReserveCcrs(timer, true);
+    }
+    if (owner == TIMER_OWNER_TONE) {
+        toneTimerId = timer;
+    }
+    else if (owner == TIMER_OWNER_SERVO) {
+        servoTimerId = timer;
+    }
+
+    /* keep Timer_ANY off it; timerCreateId() puts it back for its owner */
+    Timer_setAvailMask(Timer_getAvailMask() & ~(1 << timer));
+
+    Hwi_restore(hwiKey);
+
+    return (true);
+}
+
+/*
+ * \brief           Drops a timerReserve() reservation.
+ * \param timer     0-3 for TA0-TA3.
+ *
+ * A timer tone() or Servo already started on stays theirs.
+ */
+void timerRelease(uint8_t timer)
+{
+    uint32_t hwiKey;
+    uint8_t owner;
+
+    if (timer >= PWM_TIMERS) {
+        return;
+    }
+
+    hwiKey = Hwi_disable();
+
+    owner = timerOwners[timer];
+    timerOwners[timer] = TIMER_OWNER_NONE;
+
+    if (owner != TIMER_OWNER_NONE && owner != TIMER_OWNER_PWM) {
+        timerReserveCcrs(timer, false);
+    }
+    if (owner == TIMER_OWNER_TONE && toneTimerId == timer) {
+        toneTimerId = (~0);
+    }
+    else if (owner == TIMER_OWNER_SERVO && servoTimerId == timer) {
+        servoTimerId = (~0);
+    }
+
+    if (owner != TIMER_OWNER_NONE && timer_ccrs_in_use[timer] == 0 &&
+        !(timersCreated & (1 << timer)) &&
+        !(outputTimers() & (1 << timer))) {
+        Timer_setAvailMask(Timer_getAvailMask() | (1 << timer));
     }
 
     Hwi_restore(hwiKey);
+}
+
+/*
+ * \brief           Reports who is using a Timer_A.
+ * \param timer     0-3 for TA0-TA3.
+ * \param[out] ccrs Bit n-1 set for each CCRn driving an analogWrite(),
+ *                  pwmChannelBegin(), motorPwmBegin(), servoPwmBegin()
+ *                  or tone() output.
+ * \return          The timerReserve() owner if reserved, else
+ *                  TIMER_OWNER_SERVO or TIMER_OWNER_TONE if it runs
+ *                  servoPwmBegin() outputs or a tone(),
+ *                  TIMER_OWNER_PWM if it has PWM outputs,
+ *                  TIMER_OWNER_UNKNOWN if the Timer module, a driver
+ *                  (Capture, ADCBuf) or the Clock tick runs it, and
+ *                  TIMER_OWNER_NONE if it is free.
+ */
+uint8_t timerOwner(uint8_t timer, uint8_t *ccrs)
+{
+    Timer_A_Type *regs;
+    uint8_t i;
+
+    *ccrs = 0;
+    if (timer >= PWM_TIMERS) {
+        return (TIMER_OWNER_UNKNOWN);
+    }
+
+    for (i = 0; i < 4 && timer * 4 + i < PWM_AVAILABLE_PWMS; i++) {
+        if (used_pwm_port_pins[timer * 4 + i] != PWM_NOT_IN_USE &&
+            used_pwm_port_pins[timer * 4 + i] != PWM_IN_USE) {
+            *ccrs |= 1 << i;
+        }
+    }
+    if (timer < OUTPUT_TIMERS) {
+        *ccrs |= outputCcrs[timer];
+    }
+
+    if (timerOwners[timer] != TIMER_OWNER_NONE) {
+        return (timerOwners[timer]);
+    }
+
+    if (servoPwmTimers & (1 << timer)) {
+        return (TIMER_OWNER_SERVO);
+    }
+    if (toneTimers & (1 << timer)) {
+        return (TIMER_OWNER_TONE);
+    }
+    if (pwmOwnTimers & (1 << timer)) {
+        return (TIMER_OWNER_PWM);
+    }
+
+    if (timer_ccrs_in_use[timer] != 0) {
+        return (TIMER_OWNER_PWM);
+    }
+
+    regs = TIMER_A_CMSIS(TIMER_A0_BASE + timer * 0x400);
+    if (!(Timer_getAvailMask() & (1 << timer)) ||
+        (regs->CTL & TIMER_A_CTL_MC_MASK) != 0) {
+        return (TIMER_OWNER_UNKNOWN);
+    }
+
+    return (TIMER_OWNER_NONE);
+}
+
+/*
+ *  ======== timerCreateId ========
+ *  Timer_create() id for tone() or Servo: the timer reserved for
+ *  owner, handed back to the Timer module just for this create, or
+ *  Timer_ANY.
+ */
+uint32_t timerCreateId(uint8_t owner)
+{
+    uint32_t id = (owner == TIMER_OWNER_TONE) ? toneTimerId : servoTimerId;
+    uint32_t hwiKey;
+
+    if (id < PWM_TIMERS && timerOwners[id] == owner) {
+        hwiKey = Hwi_disable();
+        Timer_setAvailMask(Timer_getAvailMask() | (1 << id));
+        timersCreated |= 1 << id;
+        Hwi_restore(hwiKey);
+    }
 
-    PWM_setDuty((PWM_Handle)&(PWM_config[pwmIndex]), (val * PWM_SCALE_FACTOR));
+    return (id);
 }
 
 /*
@@ -294,12 +2119,22 @@ void analogWrite(uint8_t pin, int val)
 void stopAnalogWrite(uint8_t pin)
 {
     uint16_t pwmIndex = digital_pin_to_pwm_index[pin];
+    Timer_A_Type *timer;
     uint8_t timerId;
     uint_fast8_t port;
     uint_fast16_t pinMask;
     uint16_t pinNum;
     uint32_t hwiKey;
 
+    /* a waveform playing on the pin would keep writing its CCR */
+    timerId = pwmIndex >> 2;
+    if (timerId < PWM_WAVEFORM_TIMERS) {
+        timer = TIMER_A_CMSIS(TIMER_A0_BASE + timerId * 0x400);
+        if (pwmWaveforms[timerId].ccr == &timer->CCR[(pwmIndex & 3) + 1]) {
+            pwmWaveformStop(timerId);
+        }
+    }
+
     /* Close PWM port */
     PWM_close((PWM_Handle)&(PWM_config[pwmIndex]));
 
@@ -324,7 +2159,7 @@ void stopAnalogWrite(uint8_t pin)
         PMAP->CTL = (PMAP->CTL & ~PMAP_CTL_PRECFG) | PMAP_ENABLE_RECONFIGURATION;
 
         //Undo Port Mapping for this pin:
-        HWREG8(PMAP_BASE + pinNum + pxmap[port]) = PM_NONE;
+        HWREG8(PMAP_BASE + pinNum + pxmap[port]) = PMAP_NONE;
 
         //Disable write-access to port mapping registers:
         PMAP->KEYID = 0;
@@ -337,11 +2172,10 @@ void stopAnalogWrite(uint8_t pin)
     used_pwm_port_pins[pwmIndex] = PWM_NOT_IN_USE;
 
     /* put timer back in pool of available timers if not in use */
-    timerId = pwmIndex >> 2;
-
     if (timer_ccrs_in_use[timerId]) {
         timer_ccrs_in_use[timerId] -= 1;
-        if (timer_ccrs_in_use[timerId] == 0) {
+        if (timer_ccrs_in_use[timerId] == 0 &&
+            timerOwners[timerId] == TIMER_OWNER_NONE) {
             Timer_setAvailMask(Timer_getAvailMask() | (1 << timerId));
         }
     }
@@ -421,6 +2255,25 @@ void stopAnalogRead(uint8_t pin)
     digital_pin_to_pin_function[pin] = PIN_FUNC_UNUSED;
 }
 
+/*
+ * This internal API puts ADC14 back the way ADCMSP432's initHw()
+ * configured it on the first analogRead().
+ *
+ * It is called once ADCBuf (AnalogStream) is closed: that driver
+ * reprograms the shared module and switches it off, and ADCMSP432
+ * only initializes it when its first instance is opened.
+ */
+void restoreAnalogRead(void)
+{
+    MAP_ADC14_enableModule();
+    MAP_ADC14_initModule(ADC_CLOCKSOURCE_ADCOSC, ADC_PREDIVIDER_1,
+        ADC_DIVIDER_1, 0);
+    MAP_ADC14_setSampleHoldTrigger(ADC_TRIGGER_ADCSC, false);
+    MAP_ADC14_setSampleHoldTime(ADC_PULSE_WIDTH_64, ADC_PULSE_WIDTH_64);
+    MAP_ADC14_configureSingleSampleMode(ADC_MEM0, false);
+    MAP_ADC14_enableSampleTimer(ADC_MANUAL_ITERATION);
+}
+
 /*
  * \brief sets the number of bits to shift the value read by ADCFIFORead()
  */
@@ -0,0 +1,893 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * uDMA channel manager. Every core user of a channel claims it here,
+ * dmaAttach() for the core's own, dmaAllocate() for sketches, so that
+ * no two features program the same channel. The SPI driver routes its
+ * rx channels to DMA_INT1-3; completions of every other channel land
+ * on DMA_INT0, dispatched to the owner's callback.
+ *
+ * On top of that, memcpy() and memset() in blocks of DMA_TASK_MAX_ITEMS,
+ * memory copies as scatter-gather task lists, and ping-pong streams and
+ * single blocks to and from a peripheral register, see wiring_dma.h; and the CPU's
+ * fastMemcpy() and fastMemset() they fall back to.
+ */
+
+#include <ti/runtime/wiring/wiring_private.h>
+
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+#include <ti/sysbios/knl/Semaphore.h>
+
+#include <ti/drivers/Power.h>
+#include <ti/drivers/dma/UDMAMSP432.h>
+#include <ti/drivers/power/PowerMSP432.h>
+
+#include <driverlib/rom.h>
+#include <driverlib/rom_map.h>
+#include <driverlib/dma.h>
+#include <driverlib/interrupt.h>
+
+#define DMA_CHANNELS    8
+
+/* a word load, for the M4's unaligned LDR */
+typedef struct DmaUnaligned {
+    uint32_t word;
+} __attribute__((packed)) DmaUnaligned;
+
+/* a dmaMemcpy() or dmaMemset() in progress, or a dmaCopyStart() list */
+typedef struct DmaJob {
+    uint8_t *dst;
+    const uint8_t *src;         /* NULL: fill with word */
+    size_t units;               /* left, of 1 << shift bytes */
+    uint32_t shift;
+    uint32_t word;
+    bool release;               /* dmaFree() the channel when done */
+    DmaCallback fxn;
+    uintptr_t arg;
+} DmaJob;
+
+typedef struct DmaStream {
+    void *buf[2];
+    uint32_t control;           /* both halves' channel control word */
+    uint32_t next;              /* 0: primary (buf[0]) completes next */
+    volatile void *reg;
+    bool toPeripheral;
+    DmaStreamCallback fxn;
+    uintptr_t arg;
+} DmaStream;
+
+static uint8_t dmaOwned;                /* claimed channels, a bit each */
+static uint8_t dmaConstrained;          /* running copies and streams */
+static DmaCallback dmaCallbacks[DMA_CHANNELS];
+static uintptr_t dmaCallbackArgs[DMA_CHANNELS];
+static DmaStream dmaStreams[DMA_CHANNELS];
+static DmaJob dmaJobs[DMA_CHANNELS];
+
+/* created on first use */
+static Hwi_Handle dmaHwi = NULL;
+static UDMAMSP432_Handle dmaHandle = NULL;
+
+/*
+ *  ======== dmaHwiFxn ========
+ */
+static RAMFUNC void dmaHwiFxn(UArg arg)
+{
+    uint32_t status;
+    uint32_t ch;
+
+    status = MAP_DMA_getInterruptStatus();
+
+    for (ch = 0; ch < DMA_CHANNELS; ch++) {
+        if (status & (1 << ch)) {
+            MAP_DMA_clearInterruptFlag(ch);
+
+            if (dmaCallbacks[ch] != NULL) {
+                dmaCallbacks[ch](dmaCallbackArgs[ch]);
+            }
+        }
+    }
+}
+
+/*
+ *  ======== dmaAttach ========
+ *  Claim uDMA channel ch (0-7) and have fxn(arg) called from the
+ *  DMA_INT0 Hwi each time one of its structures completes; fxn may be
+ *  NULL to only hold the channel. The Hwi is created with the first
+ *  caller's priority. Returns false if the channel already has an
+ *  owner. Must be called from Task context.
+ */
+bool dmaAttach(uint32_t ch, DmaCallback fxn, uintptr_t arg,
+    uint32_t priority)
+{
+    uint32_t hwiKey;
+
+    if (ch >= DMA_CHANNELS) {
+        return (false);
+    }
+
+    if (dmaHwi == NULL) {
+        Hwi_Params hwiParams;
+        Hwi_Handle hwi;
+
+        Hwi_Params_init(&hwiParams);
+        hwiParams.priority = priority;
+        hwi = Hwi_create(INT_DMA_INT0, dmaHwiFxn, &hwiParams, NULL);
+        if (hwi == NULL) {
+            return (false);
+        }
+
+        hwiKey = Hwi_disable();
+        if (dmaHwi == NULL) {
+            dmaHwi = hwi;
+            hwi = NULL;
+        }
+        Hwi_restore(hwiKey);
+
+        /* lost a race with another task */
+        if (hwi != NULL) {
+            Hwi_delete(&hwi);
+        }
+    }
+
+    hwiKey = Hwi_disable();
+
+    if (dmaOwned & (1 << ch)) {
+        Hwi_restore(hwiKey);
+        return (false);
+    }
+
+    dmaOwned |= 1 << ch;
+    dmaCallbackArgs[ch] = arg;
+    dmaCallbacks[ch] = fxn;
+
+    Hwi_restore(hwiKey);
+
+    return (true);
+}
+
+/*
+ *  ======== dmaDetach ========
+ *  Give up a channel claimed with dmaAttach(). The caller disables
+ *  the channel first.
+ */
+void dmaDetach(uint32_t ch)
+{
+    uint32_t hwiKey;
+
+    if (ch >= DMA_CHANNELS) {
+        return;
+    }
+
+    hwiKey = Hwi_disable();
+
+    MAP_DMA_clearInterruptFlag(ch);
+    dmaCallbacks[ch] = NULL;
+    dmaOwned &= ~(1 << ch);
+
+    Hwi_restore(hwiKey);
+}
+
+/*
+ *  ======== dmaSetCallback ========
+ *  Point an owned channel's completions at fxn(arg)
+ */
+static void dmaSetCallback(uint32_t ch, DmaCallback fxn, uintptr_t arg)
+{
+    uint32_t hwiKey;
+
+    hwiKey = Hwi_disable();
+    dmaCallbackArgs[ch] = arg;
+    dmaCallbacks[ch] = fxn;
+    Hwi_restore(hwiKey);
+}
+
+/*
+ *  ======== dmaConstrain ========
+ *  The uDMA stops in DEEPSLEEP_0; keep the idle loop out of it while
+ *  ch runs.
+ */
+static void dmaConstrain(uint32_t ch)
+{
+    uint32_t hwiKey;
+
+    hwiKey = Hwi_disable();
+    if (!(dmaConstrained & (1 << ch))) {
+        dmaConstrained |= 1 << ch;
+        Power_setConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+    }
+    Hwi_restore(hwiKey);
+}
+
+static void dmaUnconstrain(uint32_t ch)
+{
+    uint32_t hwiKey;
+
+    hwiKey = Hwi_disable();
+    if (dmaConstrained & (1 << ch)) {
+        dmaConstrained &= ~(1 << ch);
+        Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+    }
+    Hwi_restore(hwiKey);
+}
+
+/*
+ *  ======== dmaAllocate ========
+ *  Claim a channel: for source DMA_ANY whichever is free, for memory
+ *  copies; for a DMA_CHn_xxx source channel n, routed to that
+ *  peripheral trigger. Returns the channel, or -1 if it is taken.
+ */
+int dmaAllocate(uint32_t source)
+{
+    UDMAMSP432_Handle handle;
+    uint32_t hwiKey;
+    int ch;
+
+    /* the core's own reference keeps the controller on */
+    if (dmaHandle == NULL) {
+        UDMAMSP432_init();
+        handle = UDMAMSP432_open();
+        if (handle == NULL) {
+            return (-1);
+        }
+
+        hwiKey = Hwi_disable();
+        if (dmaHandle == NULL) {
+            dmaHandle = handle;
+            handle = NULL;
+        }
+        Hwi_restore(hwiKey);
+
+        if (handle != NULL) {
+            UDMAMSP432_close(handle);
+        }
+    }
+
+    if (source == DMA_ANY) {
+        /* the high channels are the least used by the board's drivers */
+        for (ch = DMA_CHANNELS - 1; ch >= 0; ch--) {
+            if (!MAP_DMA_isChannelEnabled(ch) && dmaAttach(ch, NULL, 0, ~0)) {
+                break;
+            }
+        }
+        if (ch < 0) {
+            return (-1);
+        }
+        /* source 0 of every channel is reserved: software requests only */
+        source = ch;
+    }
+    else {
+        ch = source & 0x0f;
+        if (MAP_DMA_isChannelEnabled(ch) || !dmaAttach(ch, NULL, 0, ~0)) {
+            return (-1);
+        }
+    }
+
+    MAP_DMA_assignChannel(source);
+    MAP_DMA_disableChannelAttribute(ch, UDMA_ATTR_ALL);
+
+    return (ch);
+}
+
+/*
+ *  ======== dmaFree ========
+ *  Stop whatever ch is doing and give it back
+ */
+void dmaFree(int ch)
+{
+    if (ch < 0 || ch >= DMA_CHANNELS || !(dmaOwned & (1 << ch))) {
+        return;
+    }
+
+    MAP_DMA_disableChannel(ch);
+    dmaStreams[ch].fxn = NULL;
+    dmaUnconstrain(ch);
+    dmaDetach(ch);
+}
+
+/*
+ *  ======== dmaBusy ========
+ */
+bool dmaBusy(int ch)
+{
+    return (ch >= 0 && ch < DMA_CHANNELS && MAP_DMA_isChannelEnabled(ch));
+}
+
+/*
+ *  ======== dmaTask ========
+ *  Fill in a task moving count units of 1 << shift bytes
+ */
+static void dmaTask(DmaTask *task, uint8_t *dst, const uint8_t *src,
+    uint32_t count, uint32_t shift, uint32_t mode)
+{
+    static const uint32_t sizes[3] = {
+        UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_8,
+        UDMA_SIZE_16 | UDMA_SRC_INC_16 | UDMA_DST_INC_16,
+        UDMA_SIZE_32 | UDMA_SRC_INC_32 | UDMA_DST_INC_32
+    };
+
+    /* the end pointers address the last byte */
+    task->srcEnd = (void *)(src + (count << shift) - 1);
+    task->dstEnd = (void *)(dst + (count << shift) - 1);
+    task->control = sizes[shift] | UDMA_ARB_8 | ((count - 1) << 4) | mode;
+    task->spare = 0;
+}
+
+/*
+ *  ======== dmaCopyTasks ========
+ *  Build the task list copying items in order into tasks: bytes up to
+ *  where source and destination are word aligned, words, then the
+ *  remaining bytes, DMA_TASK_MAX_ITEMS units a task. Returns the number
+ *  of tasks, 0 if more than max are needed.
+ */
+unsigned int dmaCopyTasks(DmaTask *tasks, unsigned int max,
+    const DmaCopyItem *items, unsigned int count)
+{
+    unsigned int n = 0;
+    unsigned int i;
+    uint8_t *dst;
+    const uint8_t *src;
+    size_t bytes;
+    uint32_t head;
+    uint32_t units;
+    uint32_t shift;
+
+    for (i = 0; i < count; i++) {
+        dst = (uint8_t *)items[i].dst;
+        src = (const uint8_t *)items[i].src;
+        bytes = items[i].bytes;
+
+        while (bytes != 0) {
+            head = (-(uintptr_t)dst) & 3;
+            if ((((uintptr_t)dst ^ (uintptr_t)src) & 3) != 0) {
+                shift = 0;
+                units = bytes;
+            }
+            else if (head != 0 || bytes < 4) {
+                shift = 0;
+                units = head != 0 && head < bytes ? head : bytes;
+            }
+            else {
+                shift = 2;
+                units = bytes >> 2;
+            }
+            if (units > DMA_TASK_MAX_ITEMS) {
+                units = DMA_TASK_MAX_ITEMS;
+            }
+
+            if (n == max) {
+                return (0);
+            }
+            dmaTask(&tasks[n++], dst, src, units, shift,
+                UDMA_MODE_MEM_SCATTER_GATHER | UDMA_MODE_ALT_SELECT);
+
+            dst += units << shift;
+            src += units << shift;
+            bytes -= units << shift;
+        }
+    }
+
+    /* the last task ends the list */
+    if (n != 0) {
+        tasks[n - 1].control = (tasks[n - 1].control & ~0x7) | UDMA_MODE_AUTO;
+    }
+
+    return (n);
+}
+
+/*
+ *  ======== fastMemcpy ========
+ *  memcpy() for the core's larger buffers; newlib's is a byte loop.
+ *  Equally aligned buffers go 32 bytes a round through LDM/STM, others
+ *  a word at a time with unaligned loads.
+ */
+void *fastMemcpy(void *dst, const void *src, size_t bytes)
+{
+    uint8_t *d = (uint8_t *)dst;
+    const uint8_t *s = (const uint8_t *)src;
+    size_t rounds;
+
+    if (bytes >= 8) {
+        while ((uintptr_t)d & 3) {
+            *d++ = *s++;
+            bytes--;
+        }
+
+        if (((uintptr_t)s & 3) == 0) {
+            rounds = bytes >> 5;
+            if (rounds != 0) {
+                __asm volatile (
+                    "1: ldmia %[s]!, {r3, r4, r5, r12}  \n"
+                    "   stmia %[d]!, {r3, r4, r5, r12}  \n"
+                    "   ldmia %[s]!, {r3, r4, r5, r12}  \n"
+                    "   stmia %[d]!, {r3, r4, r5, r12}  \n"
+                    "   subs  %[r], %[r], #1            \n"
+                    "   bne   1b                        \n"
+                    : [d] "+r" (d), [s] "+r" (s), [r] "+r" (rounds)
+                    :
+                    : "r3", "r4", "r5", "r12", "cc", "memory");
+            }
+            bytes &= 31;
+        }
+
+        /* the M4 takes unaligned LDR, not LDM */
+        while (bytes >= 4) {
+            *(uint32_t *)d = ((const DmaUnaligned *)s)->word;
+            d += 4;
+            s += 4;
+            bytes -= 4;
+        }
+    }
+
+    while (bytes--) {
+        *d++ = *s++;
+    }
+
+    return (dst);
+}
+
+/*
+ *  ======== fastMemset ========
+ */
+void *fastMemset(void *dst, int c, size_t bytes)
+{
+    uint8_t *d = (uint8_t *)dst;
+    uint32_t word = (uint8_t)c * 0x01010101;
+    size_t rounds;
+
+    if (bytes >= 8) {
+        while ((uintptr_t)d & 3) {
+            *d++ = (uint8_t)c;
+            bytes--;
+        }
+
+        rounds = bytes >> 5;
+        if (rounds != 0) {
+            __asm volatile (
+                "   mov   r3, %[w]                  \n"
+                "   mov   r4, %[w]                  \n"
+                "   mov   r5, %[w]                  \n"
+                "   mov   r12, %[w]                 \n"
+                "1: stmia %[d]!, {r3, r4, r5, r12}  \n"
+                "   stmia %[d]!, {r3, r4, r5, r12}  \n"
+                "   subs  %[r], %[r], #1            \n"
+                "   bne   1b                        \n"
+                : [d] "+r" (d), [r] "+r" (rounds)
+                : [w] "r" (word)
+                : "r3", "r4", "r5", "r12", "cc", "memory");
+        }
+        bytes &= 31;
+
+        while (bytes >= 4) {
+            *(uint32_t *)d = word;
+            d += 4;
+            bytes -= 4;
+        }
+    }
+
+    while (bytes--) {
+        *d++ = (uint8_t)c;
+    }
+
+    return (dst);
+}
+
+/*
+ *  ======== dmaJobNext ========
+ *  Start the next AUTO mode block of ch's job, at most
+ *  DMA_TASK_MAX_ITEMS units
+ */
+static void dmaJobNext(uint32_t ch)
+{
+    static const uint32_t sizes[3] = {
+        UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_8,
+        UDMA_SIZE_16 | UDMA_SRC_INC_16 | UDMA_DST_INC_16,
+        UDMA_SIZE_32 | UDMA_SRC_INC_32 | UDMA_DST_INC_32
+    };
+    DmaJob *job = &dmaJobs[ch];
+    uint32_t count;
+
+    count = job->units < DMA_TASK_MAX_ITEMS ? job->units : DMA_TASK_MAX_ITEMS;
+
+    if (job->src != NULL) {
+        MAP_DMA_setChannelControl(ch | UDMA_PRI_SELECT,
+            sizes[job->shift] | UDMA_ARB_8);
+        MAP_DMA_setChannelTransfer(ch | UDMA_PRI_SELECT, UDMA_MODE_AUTO,
+            (void *)job->src, job->dst, count);
+        job->src += count << job->shift;
+    }
+    else {
+        MAP_DMA_setChannelControl(ch | UDMA_PRI_SELECT,
+            UDMA_SIZE_32 | UDMA_SRC_INC_NONE | UDMA_DST_INC_32 | UDMA_ARB_8);
+        MAP_DMA_setChannelTransfer(ch | UDMA_PRI_SELECT, UDMA_MODE_AUTO,
+            &job->word, job->dst, count);
+    }
+    job->dst += count << job->shift;
+    job->units -= count;
+
+    MAP_DMA_enableChannel(ch);
+    MAP_DMA_requestSoftwareTransfer(ch);
+}
+
+/*
+ *  ======== dmaJobHwiFxn ========
+ *  Completion of a dmaCopyStart() list or a dmaMemcpy() block: go on
+ *  with the next block, or hand the channel back and call the owner
+ */
+static RAMFUNC void dmaJobHwiFxn(uintptr_t arg)
+{
+    DmaJob *job = &dmaJobs[arg];
+    DmaCallback fxn;
+    uintptr_t fxnArg;
+
+    if (MAP_DMA_isChannelEnabled(arg)) {
+        return;
+    }
+    if (job->units != 0) {
+        dmaJobNext(arg);
+        return;
+    }
+
+    fxn = job->fxn;
+    fxnArg = job->arg;
+    if (job->release) {
+        dmaFree(arg);
+    }
+    else {
+        dmaUnconstrain(arg);
+    }
+
+    if (fxn != NULL) {
+        fxn(fxnArg);
+    }
+}
+
+/*
+ *  ======== dmaCopyStart ========
+ *  Run a task list from dmaCopyTasks() on a channel from
+ *  dmaAllocate(DMA_ANY). fxn(arg), if not NULL, is called from the
+ *  DMA_INT0 Hwi when the last task is done; tasks must stay valid
+ *  until then. Returns false if ch is busy or not allocated.
+ */
+bool dmaCopyStart(int ch, DmaTask *tasks, unsigned int count,
+    DmaCallback fxn, uintptr_t arg)
+{
+    DmaJob *job;
+
+    if (ch < 0 || ch >= DMA_CHANNELS || !(dmaOwned & (1 << ch))
+        || count == 0 || MAP_DMA_isChannelEnabled(ch)) {
+        return (false);
+    }
+
+    job = &dmaJobs[ch];
+    job->units = 0;
+    job->release = false;
+    job->fxn = fxn;
+    job->arg = arg;
+
+    dmaStreams[ch].fxn = NULL;
+    dmaSetCallback(ch, dmaJobHwiFxn, ch);
+    dmaConstrain(ch);
+
+    MAP_DMA_setChannelScatterGather(ch, count, tasks, 0);
+    MAP_DMA_clearInterruptFlag(ch);
+    MAP_DMA_enableChannel(ch);
+    MAP_DMA_requestSoftwareTransfer(ch);
+
+    return (true);
+}
+
+/*
+ *  ======== dmaJobDone ========
+ *  Completion of a blocking dmaMemcpy() or dmaMemset(), arg is its
+ *  Semaphore
+ */
+static void dmaJobDone(uintptr_t arg)
+{
+    Semaphore_post((Semaphore_Handle)arg);
+}
+
+/*
+ *  ======== dmaJobStart ========
+ *  Copy from src, or fill with word if src is NULL, on a channel of its
+ *  own. The bytes up to word alignment and past the last word are done
+ *  right here on the CPU, the uDMA moves the rest a block at a time.
+ */
+static void dmaJobStart(uint8_t *dst, const uint8_t *src, uint32_t word,
+    size_t bytes, DmaCallback fxn, uintptr_t arg)
+{
+    Semaphore_Struct done;
+    DmaJob *job;
+    size_t head;
+    size_t tail;
+    int ch;
+
+    if (bytes < DMA_MEMCPY_MIN || (ch = dmaAllocate(DMA_ANY)) < 0) {
+        if (src != NULL) {
+            fastMemcpy(dst, src, bytes);
+        }
+        else {
+            fastMemset(dst, word, bytes);
+        }
+        if (fxn != NULL) {
+            fxn(arg);
+        }
+        return;
+    }
+
+    job = &dmaJobs[ch];
+    if (src == NULL || (((uintptr_t)dst ^ (uintptr_t)src) & 3) == 0) {
+        head = (-(uintptr_t)dst) & 3;
+        tail = (bytes - head) & 3;
+        job->shift = 2;
+    }
+    else {
+        head = 0;
+        tail = 0;
+        job->shift = 0;
+    }
+
+    if (src != NULL) {
+        fastMemcpy(dst, src, head);
+        fastMemcpy(dst + bytes - tail, src + bytes - tail, tail);
+        job->src = src + head;
+    }
+    else {
+        fastMemset(dst, word, head);
+        fastMemset(dst + bytes - tail, word, tail);
+        job->src = NULL;
+    }
+    job->dst = dst + head;
+    job->units = (bytes - head - tail) >> job->shift;
+    job->word = word;
+    job->release = true;
+
+    if (fxn == NULL) {
+        Semaphore_construct(&done, 0, NULL);
+        fxn = dmaJobDone;
+        arg = (uintptr_t)Semaphore_handle(&done);
+    }
+    job->fxn = fxn;
+    job->arg = arg;
+
+    dmaSetCallback(ch, dmaJobHwiFxn, ch);
+    dmaConstrain(ch);
+    MAP_DMA_clearInterruptFlag(ch);
+    dmaJobNext(ch);
+
+    if (fxn == dmaJobDone) {
+        Semaphore_pend(Semaphore_handle(&done), BIOS_WAIT_FOREVER);
+        Semaphore_destruct(&done);
+    }
+}
+
+/*
+ *  ======== dmaMemcpy ========
+ *  memcpy() through the uDMA. With fxn NULL the caller sleeps until
+ *  the copy is done; otherwise this returns once it runs and fxn(arg)
+ *  is called from the DMA_INT0 Hwi at the end. Below DMA_MEMCPY_MIN
+ *  bytes, or with no channel free, the CPU copies and fxn(arg) is
+ *  called before this returns. Task context only.
+ */
+void dmaMemcpy(void *dst, const void *src, size_t bytes, DmaCallback fxn,
+    uintptr_t arg)
+{
+    dmaJobStart((uint8_t *)dst, (const uint8_t *)src, 0, bytes, fxn, arg);
+}
+
+/*
+ *  ======== dmaMemset ========
+ *  memset() through the uDMA, as dmaMemcpy()
+ */
+void dmaMemset(void *dst, int c, size_t bytes, DmaCallback fxn,
+    uintptr_t arg)
+{
+    dmaJobStart((uint8_t *)dst, NULL, (uint8_t)c * 0x01010101, bytes,
+        fxn, arg);
+}
+
+/*
+ *  ======== dmaStreamArm ========
+ *  Point half (UDMA_PRI_SELECT or UDMA_ALT_SELECT) at its buffer again
+ */
+static void dmaStreamArm(uint32_t ch, uint32_t half)
+{
+    DmaStream *stream = &dmaStreams[ch];
+    void *buf = stream->buf[half == UDMA_ALT_SELECT];
+
+    MAP_DMA_setChannelControl(ch | half, stream->control);
+    if (stream->toPeripheral) {
+        MAP_DMA_setChannelTransfer(ch | half, UDMA_MODE_PINGPONG, buf,
+            (void *)stream->reg, ((stream->control >> 4) & 0x3ff) + 1);
+    }
+    else {
+        MAP_DMA_setChannelTransfer(ch | half, UDMA_MODE_PINGPONG,
+            (void *)stream->reg, buf, ((stream->control >> 4) & 0x3ff) + 1);
+    }
+}
+
+/*
+ *  ======== dmaStreamHwiFxn ========
+ *  Hand every finished half to the callback, in order, and re-arm it
+ */
+static RAMFUNC void dmaStreamHwiFxn(uintptr_t arg)
+{
+    DmaStream *stream = &dmaStreams[arg];
+    uint32_t half;
+
+    for (;;) {
+        half = stream->next ? UDMA_ALT_SELECT : UDMA_PRI_SELECT;
+        if (MAP_DMA_getChannelMode(arg | half) != UDMA_MODE_STOP
+            || stream->fxn == NULL) {
+            break;
+        }
+        stream->fxn(stream->buf[stream->next], stream->arg);
+        dmaStreamArm(arg, half);
+        stream->next ^= 1;
+    }
+}
+
+/*
+ *  ======== dmaStreamBegin ========
+ *  Ping-pong between buf0 and buf1, count units of size (1, 2 or 4)
+ *  bytes each, from (or, toPeripheral, to) the register reg, on a
+ *  channel from dmaAllocate() routed to the peripheral's trigger.
+ *  fxn(buffer, arg) is called from the DMA_INT0 Hwi as each buffer
+ *  is done; it is re-armed when fxn returns, while the other one runs.
+ */
+bool dmaStreamBegin(int ch, volatile void *reg, bool toPeripheral,
+    void *buf0, void *buf1, uint16_t count, uint8_t size,
+    DmaStreamCallback fxn, uintptr_t arg)
+{
+    DmaStream *stream;
+    uint32_t control;
+
+    if (ch < 0 || ch >= DMA_CHANNELS || !(dmaOwned & (1 << ch))
+        || fxn == NULL || count == 0 || count > DMA_TASK_MAX_ITEMS
+        || MAP_DMA_isChannelEnabled(ch)) {
+        return (false);
+    }
+
+    switch (size) {
+        case 1:
+            control = UDMA_SIZE_8 | (toPeripheral ?
+                UDMA_SRC_INC_8 | UDMA_DST_INC_NONE :
+                UDMA_SRC_INC_NONE | UDMA_DST_INC_8);
+            break;
+        case 2:
+            control = UDMA_SIZE_16 | (toPeripheral ?
+                UDMA_SRC_INC_16 | UDMA_DST_INC_NONE :
+                UDMA_SRC_INC_NONE | UDMA_DST_INC_16);
+            break;
+        case 4:
+            control = UDMA_SIZE_32 | (toPeripheral ?
+                UDMA_SRC_INC_32 | UDMA_DST_INC_NONE :
+                UDMA_SRC_INC_NONE | UDMA_DST_INC_32);
+            break;
+        default:
+            return (false);
+    }
+
+    stream = &dmaStreams[ch];
+    stream->buf[0] = buf0;
+    stream->buf[1] = buf1;
+    stream->control = control | UDMA_ARB_1 | ((uint32_t)(count - 1) << 4);
+    stream->next = 0;
+    stream->reg = reg;
+    stream->toPeripheral = toPeripheral;
+    stream->arg = arg;
+    stream->fxn = fxn;
+
+    dmaStreamArm(ch, UDMA_PRI_SELECT);
+    dmaStreamArm(ch, UDMA_ALT_SELECT);
+
+    dmaSetCallback(ch, dmaStreamHwiFxn, ch);
+    dmaConstrain(ch);
+
+    MAP_DMA_clearInterruptFlag(ch);
+    MAP_DMA_enableChannel(ch);
+
+    return (true);
+}
+
+/*
+ *  ======== dmaStreamEnd ========
+ *  Stop the stream; the channel stays allocated
+ */
+void dmaStreamEnd(int ch)
+{
+    if (ch < 0 || ch >= DMA_CHANNELS || !(dmaOwned & (1 << ch))) {
+        return;
+    }
+
+    MAP_DMA_disableChannel(ch);
+    dmaSetCallback(ch, NULL, 0);
+    dmaStreams[ch].fxn = NULL;
+    dmaUnconstrain(ch);
+}
+
+/*
+ *  ======== dmaTransferStart ========
+ *  Move count bytes of buf to (or, !toPeripheral, from) the register
+ *  reg once, on a channel from dmaAllocate() routed to the peripheral's
+ *  trigger; without increment every byte is buf[0], or goes to it.
+ *  fxn(arg), if not NULL, is called from the DMA_INT0 Hwi when the
+ *  last byte has moved.
+ */
+bool dmaTransferStart(int ch, volatile void *reg, bool toPeripheral,
+    void *buf, uint16_t count, bool increment, DmaCallback fxn,
+    uintptr_t arg)
+{
+    DmaJob *job;
+    uint32_t control;
+
+    if (ch < 0 || ch >= DMA_CHANNELS || !(dmaOwned & (1 << ch))
+        || count == 0 || count > DMA_TASK_MAX_ITEMS
+        || MAP_DMA_isChannelEnabled(ch)) {
+        return (false);
+    }
+
+    if (toPeripheral) {
+        control = UDMA_DST_INC_NONE |
+            (increment ? UDMA_SRC_INC_8 : UDMA_SRC_INC_NONE);
+    }
+    else {
+        control = UDMA_SRC_INC_NONE |
+            (increment ? UDMA_DST_INC_8 : UDMA_DST_INC_NONE);
+    }
+
+    job = &dmaJobs[ch];
+    job->units = 0;
+    job->release = false;
+    job->fxn = fxn;
+    job->arg = arg;
+
+    dmaStreams[ch].fxn = NULL;
+    dmaSetCallback(ch, dmaJobHwiFxn, ch);
+    dmaConstrain(ch);
+
+    MAP_DMA_setChannelControl(ch | UDMA_PRI_SELECT,
+        UDMA_SIZE_8 | UDMA_ARB_1 | control);
+    if (toPeripheral) {
+        MAP_DMA_setChannelTransfer(ch | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+            buf, (void *)reg, count);
+    }
+    else {
+        MAP_DMA_setChannelTransfer(ch | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+            (void *)reg, buf, count);
+    }
+
+    MAP_DMA_clearInterruptFlag(ch);
+    MAP_DMA_enableChannel(ch);
+
+    return (true);
+}
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Microsecond software timers. Any number of MicroTimers share one
+ * hardware timer, Timer32 #2 (T32_INT2): active timers sit in a list
+ * sorted by due time on the micros64() time base, and the Timer32 runs
+ * one-shot at MCLK to the head's due time. Its Hwi dispatches every
+ * timer that is due, requeues the periodic ones and re-arms for the
+ * new head. Timer32 runs off MCLK, so DEEPSLEEP_0 is disallowed while
+ * any timer is active and a performance level change re-arms it.
+ */
+
+#include <ti/runtime/wiring/wiring_private.h>
+
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+#include <ti/drivers/Power.h>
+#include <ti/drivers/power/PowerMSP432.h>
+
+#include <driverlib/interrupt.h>
+
+#define MICRO_TIMER         TIMER32_2
+#define MICRO_TIMER_INT     INT_T32_INT2
+
+/* longest single count, 2^32 MCLK cycles is ~89s at 48MHz */
+#define MICRO_TIMER_MAX_US  60000000
+
+static MicroTimer *microTimerQueue = NULL;
+static bool microTimerConstrained = false;
+
+/* created on first use */
+static Hwi_Handle microTimerHwi = NULL;
+static Power_NotifyObj microTimerNotifyObj;
+
+/*
+ *  ======== microTimerArm ========
+ *  Count down to the queue head, or stop. Called with interrupts
+ *  disabled.
+ */
+static void microTimerArm(uint64_t now)
+{
+    uint64_t us;
+
+    if (microTimerQueue == NULL) {
+        MICRO_TIMER->CONTROL = 0;
+        if (microTimerConstrained) {
+            Power_releaseConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+            microTimerConstrained = false;
+        }
+        return;
+    }
+
+    if (!microTimerConstrained) {
+        Power_setConstraint(PowerMSP432_DISALLOW_DEEPSLEEP_0);
+        microTimerConstrained = true;
+    }
+
+    us = microTimerQueue->due > now ? microTimerQueue->due - now : 0;
+    if (us > MICRO_TIMER_MAX_US) {
+        us = MICRO_TIMER_MAX_US;
+    }
+
+    MICRO_TIMER->CONTROL = TIMER32_CONTROL_ONESHOT | TIMER32_CONTROL_SIZE |
+        TIMER32_CONTROL_IE | TIMER32_CONTROL_ENABLE;
+    MICRO_TIMER->LOAD = us == 0 ? 1 : (uint32_t)us * delayCyclesPerUs;
+}
+
+/*
+ *  ======== microTimerInsert ========
+ *  Behind the timers due at the same time. Called with interrupts
+ *  disabled.
+ */
+static void microTimerInsert(MicroTimer *timer)
+{
+    MicroTimer **link = &microTimerQueue;
+
+    while (*link != NULL && (*link)->due <= timer->due) {
+        link = &(*link)->next;
+    }
+
+    timer->next = *link;
+    *link = timer;
+    timer->active = true;
+}
+
+/*
+ *  ======== microTimerUnlink ========
+ *  Called with interrupts disabled.
+ */
+static void microTimerUnlink(MicroTimer *timer)
+{
+    MicroTimer **link = &microTimerQueue;
+
+    while (*link != NULL && *link != timer) {
+        link = &(*link)->next;
+    }
+
+    if (*link != NULL) {
+        *link = timer->next;
+    }
+    timer->active = false;
+}
+
+/*
+ *  ======== microTimerHwiFxn ========
+ */
+static RAMFUNC void microTimerHwiFxn(UArg arg)
+{
+    MicroTimer *timer;
+    uint64_t now;
+
+    MICRO_TIMER->INTCLR = 0;
+
+    now = micros64();
+
+    while ((timer = microTimerQueue) != NULL && timer->due <= now) {
+        microTimerQueue = timer->next;
+        timer->active = false;
+
+        if (timer->period != 0) {
+            timer->due += timer->period;
+            /* fell more than a period behind, drop the missed ones */
+            if (timer->due <= now) {
+                timer->due = now + timer->period;
+            }
+            microTimerInsert(timer);
+        }
+
+        timer->fxn(timer->arg);
+
+        now = micros64();
+    }
+
+    microTimerArm(now);
+}
+
+/*
+ *  ======== microTimerPerfChangeNotifyFxn ========
+ *  The count in flight is in old MCLK cycles.
+ */
+static int_fast16_t microTimerPerfChangeNotifyFxn(uint_fast16_t eventType,
+    uintptr_t eventArg, uintptr_t clientArg)
+{
+    uint32_t hwiKey;
+
+    hwiKey = Hwi_disable();
+    microTimerArm(micros64());
+    Hwi_restore(hwiKey);
+
+    return (Power_NOTIFYDONE);
+}
+
+/*
+ *  ======== microTimerInit ========
+ */
+static bool microTimerInit(void)
+{
+    Hwi_Handle hwi;
+    uint32_t hwiKey;
+
+    /* also starts micros() and its cycles per us */
+    micros64();
+
+    hwi = Hwi_create(MICRO_TIMER_INT, microTimerHwiFxn, NULL, NULL);
+    if (hwi == NULL) {
+        return (false);
+    }
+
+    hwiKey = Hwi_disable();
+    if (microTimerHwi == NULL) {
+        microTimerHwi = hwi;
+        hwi = NULL;
+        Power_registerNotify(&microTimerNotifyObj,
+            PowerMSP432_DONE_CHANGE_PERF_LEVEL,
+            microTimerPerfChangeNotifyFxn, 0);
+    }
+    Hwi_restore(hwiKey);
+
+    /* lost a race with another task */
+    if (hwi != NULL) {
+        Hwi_delete(&hwi);
+    }
+
+    return (true);
+}
+
+/*
+ * \brief           Starts a microsecond software timer.
+ * \param timer     Caller-owned timer, must stay valid while active.
+ * \param fxn       Called from the timer Hwi each time it expires.
+ * \param arg       Passed to fxn.
+ * \param us        First expiry, microseconds from now.
+ * \param periodUs  Period after that, 0 for a one-shot.
+ * \return          false if the timer Hwi could not be created.
+ *
+ * Restarts the timer if it is already active; the struct needs no
+ * initialization before its first start. The first call must be
+ * made from Task context; later ones, and fxn itself, may start and
+ * stop any timer.
+ */
+bool microTimerStart(MicroTimer *timer, MicroTimerFxn fxn, uintptr_t arg,
+    uint32_t us, uint32_t periodUs)
+{
+    uint32_t hwiKey;
+    uint64_t now;
+
+    if (microTimerHwi == NULL && !microTimerInit()) {
+        return (false);
+    }
+
+    hwiKey = Hwi_disable();
+
+    microTimerUnlink(timer);
+
+    now = micros64();
+    timer->fxn = fxn;
+    timer->arg = arg;
+    timer->period = periodUs;
+    timer->due = now + us;
+    microTimerInsert(timer);
+    microTimerArm(now);
+
+    Hwi_restore(hwiKey);
+
+    return (true);
+}
+
+/*
+ * \brief           Runs a timer again, us after its last expiry.
+ * \param timer     A timer started with microTimerStart().
+ * \param us        Microseconds after the previous due time.
+ *
+ * For chaining one-shots from fxn without the dispatch latency adding
+ * up, e.g. a pulse train with varying widths.
+ */
+void microTimerNext(MicroTimer *timer, uint32_t us)
+{
+    uint32_t hwiKey;
+
+    hwiKey = Hwi_disable();
+
+    microTimerUnlink(timer);
+
+    timer->period = 0;
+    timer->due += us;
+    microTimerInsert(timer);
+    microTimerArm(micros64());
+
+    Hwi_restore(hwiKey);
+}
+
+/*
+ * \brief           Stops a timer; fxn is not called again.
+ * \param timer     An active or inactive timer.
+ */
+void microTimerStop(MicroTimer *timer)
+{
+    uint32_t hwiKey;
+
+    hwiKey = Hwi_disable();
+
+    if (timer->active) {
+        microTimerUnlink(timer);
+        microTimerArm(micros64());
+    }
+
+    Hwi_restore(hwiKey);
+}
+
+/*
+ * \brief           Checks whether a timer is still going to fire.
+ * \param timer     A timer.
+ * \return          true while queued.
+ */
+bool microTimerActive(const MicroTimer *timer)
+{
+    return (timer->active);
+}
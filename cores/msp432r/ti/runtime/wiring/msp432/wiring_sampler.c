@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Sampling profiler, see wiring_sampler.h. The Timer32 interrupt is a
+ * zero latency one: plugged straight into the vector table at priority
+ * 0, above Hwi_disable()'s mask, and not going through the Hwi
+ * dispatcher, so it must not call into the kernel beyond reading
+ * Task_self().
+ */
+
+#include <ti/runtime/wiring/wiring_private.h>
+
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+#include <driverlib/interrupt.h>
+
+#define SAMPLER_TIMER       TIMER32_1
+#define SAMPLER_INT         INT_T32_INT1
+
+/* slots tried from a sample's hash before it is dropped */
+#define SAMPLER_PROBES      8
+
+static struct {
+    SamplerBin *bins;
+    uint32_t mask;
+    uint32_t shift;             /* hash >> shift is the first slot */
+    volatile uint32_t samples;
+    volatile uint32_t dropped;
+} sampler;
+
+void samplerSample(uint32_t *frame, uint32_t excReturn);
+
+/*
+ *  ======== samplerIsr ========
+ *  The exception frame is on the stack the interrupted code was on,
+ *  PSP or MSP as EXC_RETURN bit 2 says; its PC is word 6.
+ */
+static RAMFUNC __attribute__((naked)) void samplerIsr(void)
+{
+    __asm volatile (
+        "    tst     lr, #4\n"
+        "    ite     eq\n"
+        "    mrseq   r0, msp\n"
+        "    mrsne   r0, psp\n"
+        "    mov     r1, lr\n"
+        "    b       samplerSample\n"
+    );
+}
+
+/*
+ *  ======== samplerSample ========
+ *  Returns straight to the interrupted code with the EXC_RETURN still
+ *  in lr. A task was running if the exception returns to thread mode
+ *  (EXC_RETURN bit 3).
+ */
+RAMFUNC void samplerSample(uint32_t *frame, uint32_t excReturn)
+{
+    uint32_t pc = frame[6];
+    uint32_t task = 0;
+    uint32_t slot;
+    SamplerBin *bin;
+    int i;
+
+    SAMPLER_TIMER->INTCLR = 0;
+
+    if (excReturn & 0x8) {
+        task = (uint32_t)Task_self();
+    }
+
+    sampler.samples++;
+
+    slot = ((pc ^ (task << 7)) * 2654435761u) >> sampler.shift;
+    for (i = 0; i < SAMPLER_PROBES; i++) {
+        bin = &sampler.bins[(slot + i) & sampler.mask];
+        if (bin->count == 0) {
+            bin->pc = pc;
+            bin->task = task;
+            bin->count = 1;
+            return;
+        }
+        if (bin->pc == pc && bin->task == task) {
+            bin->count++;
+            return;
+        }
+    }
+
+    sampler.dropped++;
+}
+
+/*
+ *  ======== samplerBegin ========
+ *  Start sampling into bins, cleared first; count must be a power of 2.
+ *  Called from Task context.
+ */
+bool samplerBegin(SamplerBin *bins, unsigned int count, uint32_t rateHz)
+{
+    if (bins == NULL || count < 2 || (count & (count - 1)) != 0 ||
+        rateHz == 0) {
+        return (false);
+    }
+
+    samplerEnd();
+
+    memset(bins, 0, count * sizeof(SamplerBin));
+    sampler.bins = bins;
+    sampler.mask = count - 1;
+    sampler.shift = __builtin_clz(count) + 1;
+    sampler.samples = 0;
+    sampler.dropped = 0;
+
+    /* also starts micros() and its cycles per us */
+    micros64();
+
+    Hwi_plug(SAMPLER_INT, (void *)samplerIsr);
+    Hwi_setPriority(SAMPLER_INT, 0);
+
+    SAMPLER_TIMER->INTCLR = 0;
+    SAMPLER_TIMER->LOAD = delayCyclesPerUs * 1000000 / rateHz;
+    SAMPLER_TIMER->CONTROL = TIMER32_CONTROL_MODE | TIMER32_CONTROL_SIZE |
+        TIMER32_CONTROL_IE | TIMER32_CONTROL_ENABLE;
+
+    Hwi_enableInterrupt(SAMPLER_INT);
+
+    return (true);
+}
+
+/*
+ *  ======== samplerEnd ========
+ *  Stop sampling; the bins keep their counts.
+ */
+void samplerEnd(void)
+{
+    Hwi_disableInterrupt(SAMPLER_INT);
+    SAMPLER_TIMER->CONTROL = 0;
+    SAMPLER_TIMER->INTCLR = 0;
+    Hwi_clearInterrupt(SAMPLER_INT);
+}
+
+/*
+ *  ======== samplerSamples ========
+ *  Samples taken since samplerBegin(), dropped ones included
+ */
+uint32_t samplerSamples(void)
+{
+    return (sampler.samples);
+}
+
+/*
+ *  ======== samplerDropped ========
+ */
+uint32_t samplerDropped(void)
+{
+    return (sampler.dropped);
+}
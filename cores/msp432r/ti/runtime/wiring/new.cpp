@@ -1,4 +1,12 @@
+#include <string.h>
+
 #include "new.h"
+#include "Arena.h"
+#include "Print.h"
+
+#include <xdc/std.h>
+#include <xdc/runtime/Memory.h>
+#include <ti/sysbios/hal/Hwi.h>
 
 #if 1
 static void * smalloc(size_t size)
@@ -14,24 +22,389 @@ static void * smalloc(size_t size)
 #define smalloc malloc
 #endif
 
+/*
+ *  ======== newPoolClasses ========
+ *  Default size classes, 1.5K of heap in all
+ */
+extern "C" const NewPoolClass newPoolClasses[] __attribute__((weak)) = {
+    {16, 32}, {32, 16}, {64, 8}, {0, 0}
+};
+
+/* each free block holds the address of the next one */
+static void *poolFreeList[NEW_POOLS_MAX];
+static uint16_t poolFreeBlocks[NEW_POOLS_MAX];
+static char *poolStart[NEW_POOLS_MAX];
+static char *poolEnd[NEW_POOLS_MAX];
+static uint16_t poolBlockSize[NEW_POOLS_MAX];
+static volatile unsigned int poolsReady;   /* pools[0..poolsReady) are usable */
+static bool poolsClaimed;
+
+/*
+ *  ======== newPoolsInit ========
+ *  Construct the pools on the first new. Whoever claims them first
+ *  builds them; a thread that preempts it meanwhile just uses malloc()
+ *  for the pools not ready yet.
+ */
+static void newPoolsInit(void)
+{
+    unsigned int i, j;
+    bool claimed;
+    UInt key;
+
+    key = Hwi_disable();
+    claimed = poolsClaimed;
+    poolsClaimed = true;
+    Hwi_restore(key);
+
+    if (claimed) {
+        return;
+    }
+
+    for (i = 0; i < NEW_POOLS_MAX && newPoolClasses[i].blockSize != 0; i++) {
+        uint16_t blockSize = (newPoolClasses[i].blockSize + 7) & ~7;
+        size_t bufSize = (size_t)blockSize * newPoolClasses[i].numBlocks;
+        char *buf;
+
+        if (bufSize == 0 || (buf = (char *)malloc(bufSize)) == NULL) {
+            break;
+        }
+
+        /* not yet published by poolsReady, so no one else looks */
+        for (j = 0; j < newPoolClasses[i].numBlocks; j++) {
+            *(void **)(buf + j * blockSize) = poolFreeList[i];
+            poolFreeList[i] = buf + j * blockSize;
+        }
+        poolFreeBlocks[i] = newPoolClasses[i].numBlocks;
+
+        poolStart[i] = buf;
+        poolEnd[i] = buf + bufSize;
+        poolBlockSize[i] = blockSize;
+        poolsReady = i + 1;
+    }
+}
+
+/*
+ *  ======== poolAlloc ========
+ *  Returns a block of the calling task's arena, if it has one open, or
+ *  of the smallest class that fits; NULL if that class is used up or
+ *  size is beyond all classes
+ */
+static void *poolAlloc(size_t size)
+{
+    Arena *arena = Arena::current();
+    unsigned int i;
+
+    if (arena != NULL) {
+        void *ptr = arena->alloc(size);
+
+        if (ptr != NULL) {
+            return (ptr);
+        }
+    }
+
+    if (!poolsClaimed) {
+        newPoolsInit();
+    }
+
+    for (i = 0; i < poolsReady; i++) {
+        if (size <= poolBlockSize[i]) {
+            void *ptr;
+            UInt key;
+
+            key = Hwi_disable();
+            ptr = poolFreeList[i];
+            if (ptr != NULL) {
+                poolFreeList[i] = *(void **)ptr;
+                poolFreeBlocks[i]--;
+            }
+            Hwi_restore(key);
+
+            return (ptr);
+        }
+    }
+
+    return (NULL);
+}
+
+/*
+ *  ======== poolFree ========
+ *  Returns true if ptr was a pool or arena block; arena blocks are
+ *  freed when their scope ends
+ */
+static bool poolFree(void *ptr)
+{
+    unsigned int i;
+
+    if (Arena::owner(ptr) != NULL) {
+        return (true);
+    }
+
+    for (i = 0; i < poolsReady; i++) {
+        if ((char *)ptr >= poolStart[i] && (char *)ptr < poolEnd[i]) {
+            UInt key;
+
+            key = Hwi_disable();
+            *(void **)ptr = poolFreeList[i];
+            poolFreeList[i] = ptr;
+            poolFreeBlocks[i]++;
+            Hwi_restore(key);
+
+            return (true);
+        }
+    }
+
+    return (false);
+}
+
+/*
+ * Live blocks while tracking, an open addressed hash table on the
+ * block address. Deleted entries become TRACK_GONE so probes for
+ * other blocks go on past them.
+ */
+typedef struct TrackEntry {
+    void *ptr;
+    void *caller;
+    size_t size;
+} TrackEntry;
+
+#define TRACK_GONE ((void *)1)
+
+static TrackEntry *track;
+static unsigned int trackSize;          /* power of 2 */
+static HeapStats trackStats;
+
+static inline unsigned int trackHash(void *ptr)
+{
+    return (((uintptr_t)ptr >> 3) * 2654435761U) & (trackSize - 1);
+}
+
+static void trackNew(void *ptr, size_t size, void *caller)
+{
+    unsigned int i, n, c;
+    UInt key;
+
+    for (c = 0; c < HEAP_STATS_CLASSES - 1 && size > (8U << c); c++) {
+    }
+
+    key = Hwi_disable();
+    if (track != NULL) {
+        trackStats.news++;
+        trackStats.sizeClasses[c]++;
+        for (i = trackHash(ptr), n = 0; n < trackSize; i = (i + 1) & (trackSize - 1), n++) {
+            if (track[i].ptr == NULL || track[i].ptr == TRACK_GONE) {
+                track[i].ptr = ptr;
+                track[i].caller = caller;
+                track[i].size = size;
+                trackStats.live++;
+                trackStats.liveBytes += size;
+                if (trackStats.liveBytes > trackStats.peakBytes) {
+                    trackStats.peakBytes = trackStats.liveBytes;
+                }
+                break;
+            }
+        }
+        if (n == trackSize) {
+            trackStats.untracked++;
+        }
+    }
+    Hwi_restore(key);
+}
+
+static void trackDelete(void *ptr)
+{
+    unsigned int i, n;
+    UInt key;
+
+    key = Hwi_disable();
+    if (track != NULL) {
+        trackStats.deletes++;
+        for (i = trackHash(ptr), n = 0; n < trackSize && track[i].ptr != NULL;
+            i = (i + 1) & (trackSize - 1), n++) {
+            if (track[i].ptr == ptr) {
+                track[i].ptr = TRACK_GONE;
+                trackStats.live--;
+                trackStats.liveBytes -= track[i].size;
+                break;
+            }
+        }
+    }
+    Hwi_restore(key);
+}
+
+/*
+ *  ======== heapTrackBegin ========
+ *  Start tracking with room for maxLive live blocks, rounded up to a
+ *  power of 2; 12 bytes each
+ */
+bool heapTrackBegin(unsigned int maxLive)
+{
+    TrackEntry *table;
+    unsigned int size = 8;
+    UInt key;
+
+    heapTrackEnd();
+
+    while (size < maxLive) {
+        size <<= 1;
+    }
+    table = (TrackEntry *)malloc(size * sizeof(TrackEntry));
+    if (table == NULL) {
+        return (false);
+    }
+    memset(table, 0, size * sizeof(TrackEntry));
+
+    key = Hwi_disable();
+    memset(&trackStats, 0, sizeof(trackStats));
+    trackSize = size;
+    track = table;
+    Hwi_restore(key);
+
+    return (true);
+}
+
+void heapTrackEnd(void)
+{
+    TrackEntry *table;
+    UInt key;
+
+    key = Hwi_disable();
+    table = track;
+    track = NULL;
+    Hwi_restore(key);
+
+    free(table);
+}
+
+/*
+ *  ======== heapStatsGet ========
+ */
+void heapStatsGet(HeapStats *stats)
+{
+    Memory_Stats heap;
+    unsigned int i;
+    UInt key;
+
+    key = Hwi_disable();
+    *stats = trackStats;
+    Hwi_restore(key);
+
+    Memory_getStats(NULL, &heap);
+    stats->heapSize = heap.totalSize;
+    stats->heapFree = heap.totalFreeSize;
+    stats->largestFree = heap.largestFreeSize;
+
+    for (i = 0; i < NEW_POOLS_MAX; i++) {
+        stats->poolBlockSize[i] = 0;
+        stats->poolFree[i] = 0;
+        if (i < poolsReady) {
+            stats->poolBlockSize[i] = poolBlockSize[i];
+            stats->poolFree[i] = poolFreeBlocks[i];
+        }
+    }
+}
+
+/*
+ *  ======== heapStatsPrint ========
+ */
+void heapStatsPrint(Print &out)
+{
+    HeapStats stats;
+    unsigned int i, j;
+
+    heapStatsGet(&stats);
+
+    out.printf("heap: %lu of %lu free, largest block %lu\r\n",
+        (unsigned long)stats.heapFree, (unsigned long)stats.heapSize,
+        (unsigned long)stats.largestFree);
+    for (i = 0; i < NEW_POOLS_MAX && stats.poolBlockSize[i] != 0; i++) {
+        out.printf("pool %u: %u free\r\n", stats.poolBlockSize[i],
+            stats.poolFree[i]);
+    }
+    if (track == NULL) {
+        return;
+    }
+
+    out.printf("new: %lu bytes in %lu blocks, peak %lu, %lu news, "
+        "%lu deletes, %lu untracked\r\n", (unsigned long)stats.liveBytes,
+        (unsigned long)stats.live, (unsigned long)stats.peakBytes,
+        (unsigned long)stats.news, (unsigned long)stats.deletes,
+        (unsigned long)stats.untracked);
+    out.print("sizes:");
+    for (i = 0; i < HEAP_STATS_CLASSES; i++) {
+        out.printf(i < HEAP_STATS_CLASSES - 1 ? " <=%u:%lu" : " >%u:%lu",
+            i < HEAP_STATS_CLASSES - 1 ? 8U << i : 8U << (i - 1),
+            (unsigned long)stats.sizeClasses[i]);
+    }
+    out.println();
+
+    /* live blocks per caller, each caller once, from a snapshot */
+    for (i = 0; i < trackSize; i++) {
+        TrackEntry entry;
+        unsigned long blocks = 0, bytes = 0;
+        bool seen = false;
+        UInt key;
+
+        key = Hwi_disable();
+        if (track == NULL) {
+            Hwi_restore(key);
+            break;      /* tracking ended meanwhile */
+        }
+        entry = track[i];
+        Hwi_restore(key);
+        if (entry.ptr == NULL || entry.ptr == TRACK_GONE) {
+            continue;
+        }
+
+        key = Hwi_disable();
+        for (j = 0; track != NULL && j < trackSize; j++) {
+            if (track[j].ptr == NULL || track[j].ptr == TRACK_GONE ||
+                track[j].caller != entry.caller) {
+                continue;
+            }
+            if (j < i) {
+                seen = true;
+                break;
+            }
+            blocks++;
+            bytes += track[j].size;
+        }
+        Hwi_restore(key);
+
+        if (!seen && blocks > 0) {
+            out.printf("  from %p: %lu blocks, %lu bytes\r\n", entry.caller,
+                blocks, bytes);
+        }
+    }
+}
+
 void * operator new(size_t size)
 {
-    return smalloc(size);
+  void *ptr = poolAlloc(size);
+
+  if (!ptr) ptr = smalloc(size);
+  if (track) trackNew(ptr, size, __builtin_return_address(0));
+  return ptr;
 }
 
 void operator delete(void * ptr)
 {
-  free(ptr);
+  if (track && ptr) trackDelete(ptr);
+  if (ptr && !poolFree(ptr)) free(ptr);
 }
 
 void * operator new[](size_t size)
 {
-  return smalloc(size);
+  void *ptr = poolAlloc(size);
+
+  if (!ptr) ptr = smalloc(size);
+  if (track) trackNew(ptr, size, __builtin_return_address(0));
+  return ptr;
 }
 
 void operator delete[](void * ptr)
 {
-  free(ptr);
+  if (track && ptr) trackDelete(ptr);
+  if (ptr && !poolFree(ptr)) free(ptr);
 }
 
 int __cxa_guard_acquire(__guard *g) {return !*(char *)(g);};
@@ -6,6 +6,7 @@
 #define NEW_H
 
 #include <stdlib.h>
+#include <stdint.h>
 
 void * operator new(size_t size);
 void operator delete(void * ptr);
@@ -20,5 +21,53 @@ extern "C" void __cxa_guard_abort (__guard *);
 
 extern "C" void __cxa_pure_virtual(void);
 
+/*
+ * operator new serves sizes up to the largest blockSize from fixed size
+ * block pools, O(1) and without fragmenting the heap, and the rest, or
+ * a request a full pool can't take, from malloc(). The pools are carved
+ * out of the heap on the first new. A sketch replaces the default table
+ * by defining its own, in ascending blockSize order and ended by
+ * {0, 0}; {{0, 0}} turns the pools off:
+ *
+ *     const NewPoolClass newPoolClasses[] = {{16, 64}, {48, 16}, {0, 0}};
+ */
+typedef struct NewPoolClass {
+    uint16_t blockSize;     /* bytes, rounded up to a multiple of 8 */
+    uint16_t numBlocks;
+} NewPoolClass;
+
+extern "C" const NewPoolClass newPoolClasses[];
+
+#define NEW_POOLS_MAX       8   /* size classes beyond these are ignored */
+#define HEAP_STATS_CLASSES  8   /* new sizes <= 8, 16, ... 512 and larger */
+
+/*
+ * Heap usage: the heap's own figures always, and, between
+ * heapTrackBegin() and heapTrackEnd(), every new and delete with the
+ * address it was called from. The blocks still live per caller, in
+ * heapStatsPrint(), are where leaks show up.
+ */
+typedef struct HeapStats {
+    uint32_t heapSize;          /* bytes, the default heap malloc() uses */
+    uint32_t heapFree;
+    uint32_t largestFree;       /* well below heapFree when fragmented */
+    uint32_t liveBytes;         /* tracked new'ed and not deleted yet */
+    uint32_t peakBytes;
+    uint32_t live;              /* tracked blocks */
+    uint32_t untracked;         /* news the full live table couldn't hold */
+    uint32_t news;
+    uint32_t deletes;
+    uint32_t sizeClasses[HEAP_STATS_CLASSES];  /* news per size class */
+    uint16_t poolBlockSize[NEW_POOLS_MAX];     /* 0 for no pool */
+    uint16_t poolFree[NEW_POOLS_MAX];          /* free blocks per pool */
+} HeapStats;
+
+class Print;
+
+bool heapTrackBegin(unsigned int maxLive = 128);   /* false if out of memory */
+void heapTrackEnd(void);
+void heapStatsGet(HeapStats *stats);
+void heapStatsPrint(Print &out);
+
 #endif
 
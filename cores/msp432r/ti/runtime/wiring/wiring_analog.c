@@ -70,6 +70,7 @@ uint16_t analogRead(uint8_t pin)
         if (adcInitialized == false) {
             ADC_init();
             adcInitialized = true;
+            bootTraceMark("ADC_init");
         }
 
         ADC_Params_init(&adcParams);
@@ -84,13 +85,24 @@ uint16_t analogRead(uint8_t pin)
         digital_pin_to_pin_function[pin] = PIN_FUNC_ANALOG_INPUT;
     }
 
-    ADC_convert((ADC_Handle)&(ADC_config[adcIndex]), &sample);
+    PROFILE_BEGIN("analogRead");
 
-    if (analogReadShift >= 0) {
-        return (sample >> analogReadShift);
+    if (analogReadAverage != 0) {
+        sample = analogReadOversampled(pin, analogReadAverage);
     }
     else {
-        return (sample << -analogReadShift);
+        ADC_convert((ADC_Handle)&(ADC_config[adcIndex]), &sample);
+
+        if (analogReadShift >= 0) {
+            sample >>= analogReadShift;
+        }
+        else {
+            sample <<= -analogReadShift;
+        }
     }
+
+    PROFILE_END();
+
+    return (sample);
 }
 
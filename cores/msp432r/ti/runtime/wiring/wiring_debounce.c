@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Debounced inputs on one shared 1 ms Clock: each tick reads every
+ * registered pin through its bit-band alias and steps an integrator
+ * towards the raw level. The debounced level only changes once the
+ * integrator has run all the way to the other end, i.e. after the
+ * debounce time of net agreement, so contact bounce averages out
+ * instead of restarting a timer on every chattering edge.
+ */
+
+#include "wiring_private.h"
+
+#include <ti/sysbios/knl/Clock.h>
+#include <ti/sysbios/knl/Swi.h>
+
+#define DEBOUNCE_MAX_PINS   16
+
+/* default debounce time, ms */
+#ifndef DEBOUNCE_TIME
+#define DEBOUNCE_TIME       20
+#endif
+
+typedef struct Debounce {
+    volatile uint32_t *in;
+    DebounceCallback fxn;
+    uint8_t pin;
+    uint8_t mode;
+    uint8_t level;          /* debounced level */
+    uint8_t count;          /* integrator, 0 .. limit */
+} Debounce;
+
+static Debounce debounced[DEBOUNCE_MAX_PINS];
+static unsigned int numDebounced;
+static uint8_t limit = DEBOUNCE_TIME;
+
+static Clock_Struct debounceClock;
+static bool clockConstructed = false;
+
+/*
+ *  ======== debounceScan ========
+ *  Clock function, Swi context, every ms while any pin is registered.
+ */
+static void debounceScan(UArg arg)
+{
+    unsigned int i;
+    Debounce *d;
+
+    for (i = 0; i < numDebounced; i++) {
+        d = &debounced[i];
+
+        if (*d->in) {
+            if (d->count < limit) {
+                d->count++;
+            }
+            if (d->count >= limit && !d->level) {
+                d->level = HIGH;
+                if (d->fxn != NULL && d->mode != FALLING) {
+                    d->fxn(d->pin, HIGH);
+                }
+            }
+        }
+        else {
+            if (d->count > 0) {
+                d->count--;
+            }
+            if (d->count == 0 && d->level) {
+                d->level = LOW;
+                if (d->fxn != NULL && d->mode != RISING) {
+                    d->fxn(d->pin, LOW);
+                }
+            }
+        }
+    }
+}
+
+/*
+ *  ======== attachDebounce ========
+ *  Debounce pin and call fxn(pin, level) from the Clock Swi on its
+ *  stable RISING, FALLING or CHANGE edges; fxn may be NULL to only use
+ *  debouncedRead(). Set the pin up with pinMode() first (for the
+ *  LaunchPad buttons INPUT_PULLUP), otherwise it is made an INPUT.
+ *  Returns false when DEBOUNCE_MAX_PINS pins are already registered.
+ */
+bool attachDebounce(uint8_t pin, DebounceCallback fxn, int mode)
+{
+    unsigned int i;
+    Debounce *d;
+    UInt key;
+
+    if (digital_pin_to_pin_function[pin] != PIN_FUNC_DIGITAL_INPUT) {
+        pinMode(pin, INPUT);
+    }
+
+    if (!clockConstructed) {
+        Clock_Params params;
+
+        Clock_Params_init(&params);
+        params.period = 1;
+        Clock_construct(&debounceClock, debounceScan, 1, &params);
+        clockConstructed = true;
+    }
+
+    key = Swi_disable();
+
+    for (i = 0; i < numDebounced; i++) {
+        if (debounced[i].pin == pin) {
+            break;
+        }
+    }
+
+    if (i == DEBOUNCE_MAX_PINS) {
+        Swi_restore(key);
+        return (false);
+    }
+
+    d = &debounced[i];
+    d->in = fastPinAlias(digital_pin_to_port_pin[pin], FAST_PIN_IN);
+    d->fxn = fxn;
+    d->pin = pin;
+    d->mode = mode;
+    d->level = *d->in ? HIGH : LOW;
+    d->count = d->level ? limit : 0;
+
+    if (i == numDebounced) {
+        numDebounced++;
+    }
+
+    Swi_restore(key);
+
+    if (numDebounced == 1) {
+        Clock_start(Clock_handle(&debounceClock));
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== detachDebounce ========
+ */
+void detachDebounce(uint8_t pin)
+{
+    unsigned int i;
+    UInt key;
+
+    key = Swi_disable();
+
+    for (i = 0; i < numDebounced; i++) {
+        if (debounced[i].pin == pin) {
+            debounced[i] = debounced[--numDebounced];
+            break;
+        }
+    }
+
+    if (numDebounced == 0 && clockConstructed) {
+        Clock_stop(Clock_handle(&debounceClock));
+    }
+
+    Swi_restore(key);
+}
+
+/*
+ *  ======== debouncedRead ========
+ *  The debounced level of a registered pin, else digitalRead().
+ */
+int debouncedRead(uint8_t pin)
+{
+    unsigned int i;
+
+    for (i = 0; i < numDebounced; i++) {
+        if (debounced[i].pin == pin) {
+            return (debounced[i].level);
+        }
+    }
+
+    return (digitalRead(pin));
+}
+
+/*
+ *  ======== setDebounceTime ========
+ *  Milliseconds (1-255) a new level must win by before it is reported.
+ */
+void setDebounceTime(uint32_t milliseconds)
+{
+    unsigned int i;
+    UInt key;
+
+    if (milliseconds < 1) {
+        milliseconds = 1;
+    }
+    else if (milliseconds > 255) {
+        milliseconds = 255;
+    }
+
+    key = Swi_disable();
+
+    limit = milliseconds;
+    for (i = 0; i < numDebounced; i++) {
+        if (debounced[i].count > limit) {
+            debounced[i].count = limit;
+        }
+    }
+
+    Swi_restore(key);
+}
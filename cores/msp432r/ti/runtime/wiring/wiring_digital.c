@@ -33,6 +33,30 @@
 #include "wiring_private.h"
 #include <xdc/runtime/Types.h>
 #include <ti/drivers/GPIO.h>
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+/*
+ * digitalRead()/digitalWrite() go through the bit-band alias of the
+ * pin, looked up in the flash table digital_pin_to_port_pin[], rather
+ * than GPIO_read()/GPIO_write() and the driver's RAM pinConfigs[]: a
+ * single load or store, with no interrupts to lock out.
+ *
+ * Build with -DSTRICT_PIN_MODE=1 to drop the pin function check from
+ * digitalRead()/digitalWrite() altogether; otherwise strictPinMode()
+ * turns it off at run time.
+ */
+#ifndef STRICT_PIN_MODE
+#define STRICT_PIN_MODE 0
+#endif
+
+/* digitalWriteFast() target for pins without a GPIO */
+volatile uint32_t fastPinScratch;
+
+#if STRICT_PIN_MODE
+#define strictPinModeOn true
+#else
+static bool strictPinModeOn = false;
+#endif
 
 /* device specific routine */
 GPIO_PinConfig mode2gpioConfig(uint8_t pin, uint8_t mode)
@@ -81,26 +105,81 @@ void pinMode(uint8_t pin, uint8_t mode)
     }
 }
 
-int digitalRead(uint8_t pin)
+/*
+ *  ======== strictPinMode ========
+ *  With enable, digitalRead()/digitalWrite() no longer configure the pin
+ *  on first use nor undo analogRead()/analogWrite(): the sketch calls
+ *  pinMode() itself, once, and checkPinMode() can verify that. Saves a
+ *  table load and branch per call in tight loops.
+ */
+void strictPinMode(bool enable)
 {
-    if (digital_pin_to_pin_function[pin] != PIN_FUNC_DIGITAL_INPUT) {
-        pinMode(pin, INPUT);
+#if STRICT_PIN_MODE
+    (void)enable;
+#else
+    strictPinModeOn = enable;
+#endif
+}
+
+/*
+ *  ======== checkPinMode ========
+ *  Whether pin is currently set up as mode's direction: INPUT,
+ *  INPUT_PULLUP and INPUT_PULLDOWN all count as input.
+ */
+bool checkPinMode(uint8_t pin, uint8_t mode)
+{
+    if (mode == OUTPUT) {
+        return (digital_pin_to_pin_function[pin] == PIN_FUNC_DIGITAL_OUTPUT);
     }
 
-    if (GPIO_read(pin)) {
-        return (HIGH);
+    return (digital_pin_to_pin_function[pin] == PIN_FUNC_DIGITAL_INPUT);
+}
+
+int digitalRead(uint8_t pin)
+{
+    if (!strictPinModeOn
+        && digital_pin_to_pin_function[pin] != PIN_FUNC_DIGITAL_INPUT) {
+        pinMode(pin, INPUT);
     }
 
-    return (LOW);
+    return (*fastPinAlias(digital_pin_to_port_pin[pin], FAST_PIN_IN)
+        ? HIGH : LOW);
 }
 
 void digitalWrite(uint8_t pin, uint8_t val)
 {
-    if (digital_pin_to_pin_function[pin] != PIN_FUNC_DIGITAL_OUTPUT) {
+    if (!strictPinModeOn
+        && digital_pin_to_pin_function[pin] != PIN_FUNC_DIGITAL_OUTPUT) {
         pinMode(pin, OUTPUT);
     }
 
-    GPIO_write(pin, val ? 1 : 0);
+    *fastPinAlias(digital_pin_to_port_pin[pin], FAST_PIN_OUT) = val ? 1 : 0;
+}
+
+/*
+ *  ======== portRead ========
+ *  All eight inputs of port (1-10, 0xb for J) in one read.
+ */
+uint8_t portRead(uint8_t port)
+{
+    return (*portInputRegister(port));
+}
+
+/*
+ *  ======== portWrite ========
+ *  Set the mask bits of port to those of value in a single store; the
+ *  pins must already be outputs. The read-modify-write runs with
+ *  interrupts off so pins of the same port written from an ISR or
+ *  other task are not lost.
+ */
+void portWrite(uint8_t port, uint8_t mask, uint8_t value)
+{
+    volatile uint8_t *out = portOutputRegister(port);
+    uintptr_t key;
+
+    key = Hwi_disable();
+    *out = (*out & ~mask) | (value & mask);
+    Hwi_restore(key);
 }
 
 /*
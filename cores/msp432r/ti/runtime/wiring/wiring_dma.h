@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * uDMA channels for sketches and libraries. The eight channels are
+ * shared with the core's own DMA users (SPI, Wire, Serial receive,
+ * PWM waveforms); dmaAllocate() hands out one nobody holds:
+ *
+ *     dmaMemcpy(frame, background, sizeof(frame), NULL, 0);  // blocking
+ *     dmaMemset(frame, 0, sizeof(frame), cleared, 0);         // cleared()
+ *
+ *     ch = dmaAllocate(DMA_ANY);                     // for a copy list
+ *     n = dmaCopyTasks(tasks, 8, items, 3);          // scatter-gather
+ *     dmaCopyStart(ch, tasks, n, done, 0);           // done() when finished
+ *
+ *     ch = dmaAllocate(DMA_CH7_ADC14);               // a peripheral's
+ *     dmaStreamBegin(ch, &ADC14->MEM[0], false, buf0, buf1, 256, 2,
+ *         blockFull, 0);                             // ping-pong
+ *
+ *     ch = dmaAllocate(DMA_CH0_EUSCIB0TX0);          // one block out
+ *     dmaTransferStart(ch, &EUSCI_B0->TXBUF, true, block, 512, true,
+ *         sent, 0);
+ *
+ * Memory copies move words when source and destination are equally
+ * aligned, bytes otherwise. The uDMA is no faster than the CPU's
+ * LDM/STM loop, and setting it up costs a few microseconds; what it
+ * buys is the CPU, free for other tasks meanwhile. dmaMemcpy() and
+ * dmaMemset() therefore leave anything below DMA_MEMCPY_MIN bytes to
+ * fastMemcpy() and fastMemset(), which the core also uses for its own
+ * larger buffers in place of newlib's byte loops.
+ *
+ * Callbacks run in the DMA_INT0 Hwi. Channels are allocated and freed,
+ * and transfers started, from Task context.
+ */
+
+#ifndef WiringDma_h
+#define WiringDma_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DMA_ANY             0xffffffff  /* dmaAllocate(): a memory channel */
+#define DMA_TASK_MAX_ITEMS  1024        /* items one DmaTask moves */
+
+/* smallest dmaMemcpy() or dmaMemset() the uDMA does */
+#ifndef DMA_MEMCPY_MIN
+#define DMA_MEMCPY_MIN      1024
+#endif
+
+typedef void (*DmaCallback)(uintptr_t arg);
+
+/* buffer is the one just filled or emptied, it is re-armed on return */
+typedef void (*DmaStreamCallback)(void *buffer, uintptr_t arg);
+
+/* one piece of a scatter-gather copy */
+typedef struct DmaCopyItem {
+    void *dst;
+    const void *src;
+    size_t bytes;
+} DmaCopyItem;
+
+/* a uDMA channel control structure (driverlib's DMA_ControlTable) */
+typedef struct DmaTask {
+    volatile void *srcEnd;
+    volatile void *dstEnd;
+    volatile uint32_t control;
+    uint32_t spare;
+} DmaTask;
+
+extern int dmaAllocate(uint32_t source);
+extern void dmaFree(int ch);
+extern bool dmaBusy(int ch);
+
+extern void *fastMemcpy(void *dst, const void *src, size_t bytes);
+extern void *fastMemset(void *dst, int c, size_t bytes);
+
+extern void dmaMemcpy(void *dst, const void *src, size_t bytes,
+    DmaCallback fxn, uintptr_t arg);
+extern void dmaMemset(void *dst, int c, size_t bytes, DmaCallback fxn,
+    uintptr_t arg);
+extern unsigned int dmaCopyTasks(DmaTask *tasks, unsigned int max,
+    const DmaCopyItem *items, unsigned int count);
+extern bool dmaCopyStart(int ch, DmaTask *tasks, unsigned int count,
+    DmaCallback fxn, uintptr_t arg);
+
+extern bool dmaStreamBegin(int ch, volatile void *reg, bool toPeripheral,
+    void *buf0, void *buf1, uint16_t count, uint8_t size,
+    DmaStreamCallback fxn, uintptr_t arg);
+extern void dmaStreamEnd(int ch);
+
+extern bool dmaTransferStart(int ch, volatile void *reg, bool toPeripheral,
+    void *buf, uint16_t count, bool increment, DmaCallback fxn,
+    uintptr_t arg);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
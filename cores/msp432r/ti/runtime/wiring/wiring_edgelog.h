@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * GPIO edge logger: the port Hwi timestamps each edge of the logged
+ * pins into a caller supplied ring, a task drains it with
+ * edgeLogRead(). Logging an edge costs the Timestamp read and three
+ * stores, no call and no lock: the Hwi is the only producer and the
+ * reader the only consumer. Edges arriving with the ring full are
+ * counted by edgeLogDropped().
+ *
+ *     EdgeLogRecord ring[256];
+ *
+ *     edgeLogBegin(ring, 256);
+ *     edgeLogPin(PUSH1, CHANGE);
+ *     ...
+ *     n = edgeLogRead(out, 16);
+ *
+ * Logged pins work alongside attachInterrupt() and friends on the
+ * same pins. CHANGE is handled by the logger flipping the edge select
+ * after each edge, so level alternates as expected.
+ */
+
+#ifndef WiringEdgeLog_h
+#define WiringEdgeLog_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct EdgeLogRecord {
+    uint32_t time;          /* Timestamp_get32() in the port Hwi */
+    uint8_t pin;
+    uint8_t level;          /* pin level just after the edge */
+} EdgeLogRecord;
+
+extern bool edgeLogBegin(EdgeLogRecord *ring, unsigned int count);
+extern bool edgeLogPin(uint8_t pin, int mode);
+extern void edgeLogEnd(void);
+extern unsigned int edgeLogAvailable(void);
+extern unsigned int edgeLogRead(EdgeLogRecord *records, unsigned int max);
+extern uint32_t edgeLogDropped(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
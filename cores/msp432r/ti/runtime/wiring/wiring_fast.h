@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Single store GPIO access through the Cortex-M4 peripheral bit-band
+ * alias, for bit-banged protocols and scope timing.
+ *
+ * None of this configures the pin: call pinMode() first. With a
+ * constant pin, digitalWriteFast()/digitalReadFast() compile to one
+ * store/load; FastPin resolves the alias once for pins chosen at run
+ * time.
+ *
+ * Pins without a GPIO (digital_pin_to_port_pin[] entry 0) are mapped
+ * to a scratch word, so writing them is harmless.
+ */
+
+#ifndef WiringFast_h
+#define WiringFast_h
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* DIO register offsets within a port, see the PxIN/PxOUT/PxDIR layout */
+#define FAST_PIN_IN     0x00
+#define FAST_PIN_OUT    0x02
+#define FAST_PIN_DIR    0x04
+
+extern volatile uint32_t fastPinScratch;
+
+/*
+ *  ======== fastPortReg ========
+ *  Register reg of port (1-10, 0xb for J). Ports 1-10 are paired into
+ *  16 bit registers 0x20 apart from DIO_BASE, odd ports in the low
+ *  byte; port J sits at DIO_BASE + 0x120.
+ */
+static inline volatile uint8_t *fastPortReg(uint32_t port, uint32_t reg)
+{
+    if (port == 0xb) {
+        return ((volatile uint8_t *)(0x40004C00 + 0x120 + reg));
+    }
+
+    return ((volatile uint8_t *)(0x40004C00 + ((port - 1) >> 1) * 0x20
+        + ((port - 1) & 1) + reg));
+}
+
+/*
+ *  ======== fastPinAlias ========
+ *  Bit-band alias word of the pin's bit in register reg.
+ */
+static inline volatile uint32_t *fastPinAlias(uint16_t portPin,
+    uint32_t reg)
+{
+    uint32_t addr;
+
+    if ((portPin >> 8) == 0) {
+        return (&fastPinScratch);
+    }
+
+    addr = (uint32_t)fastPortReg(portPin >> 8, reg);
+
+    return ((volatile uint32_t *)(0x42000000 + (addr - 0x40000000) * 32
+        + __builtin_ctz(portPin & 0xff) * 4));
+}
+
+/* AVR style lookups for libraries that poke port registers directly */
+#define digitalPinToPort(pin)       (digital_pin_to_port_pin[pin] >> 8)
+#define digitalPinToBitMask(pin)    (digital_pin_to_port_pin[pin] & 0xff)
+#define portOutputRegister(port)    (fastPortReg((port), FAST_PIN_OUT))
+#define portInputRegister(port)     (fastPortReg((port), FAST_PIN_IN))
+#define portModeRegister(port)      (fastPortReg((port), FAST_PIN_DIR))
+
+static inline void digitalWriteFast(uint8_t pin, uint8_t val)
+{
+    *fastPinAlias(digital_pin_to_port_pin[pin], FAST_PIN_OUT) = val ? 1 : 0;
+}
+
+static inline int digitalReadFast(uint8_t pin)
+{
+    return ((int)*fastPinAlias(digital_pin_to_port_pin[pin], FAST_PIN_IN));
+}
+
+#ifdef __cplusplus
+} // extern "C"
+
+/*
+ *  ======== FastPin ========
+ *  A pin with its bit-band aliases looked up once:
+ *
+ *      FastPin p = fastPin(RED_LED);
+ *      pinMode(RED_LED, OUTPUT);
+ *      p.high();
+ */
+class FastPin
+{
+    public:
+        FastPin(void) : out(&fastPinScratch), in(&fastPinScratch) {}
+        FastPin(uint8_t pin) :
+            out(fastPinAlias(digital_pin_to_port_pin[pin], FAST_PIN_OUT)),
+            in(fastPinAlias(digital_pin_to_port_pin[pin], FAST_PIN_IN)) {}
+
+        void high(void) { *out = 1; }
+        void low(void) { *out = 0; }
+        void write(uint8_t val) { *out = val ? 1 : 0; }
+        void toggle(void) { *out = *out ^ 1; }
+        int read(void) { return ((int)*in); }
+
+    private:
+        volatile uint32_t *out;
+        volatile uint32_t *in;
+};
+
+static inline FastPin fastPin(uint8_t pin)
+{
+    return (FastPin(pin));
+}
+
+#endif
+
+#endif
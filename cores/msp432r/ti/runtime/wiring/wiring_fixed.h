@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Fixed point helpers for tight loops, without floats or divides.
+ *
+ * A Q15 value is an int32_t holding value * 2^15, like IQmath's _iq15:
+ * 1.0 is Q15_ONE and the range is about +-65536. A Q31 value holds
+ * value * 2^31 and is below 1 in magnitude. Products go through a 64
+ * bit intermediate, a single SMULL on the Cortex-M4, so they cannot
+ * overflow before the shift. (TI's IQmathLib.h is not used: its
+ * functions live in a library this core does not ship.)
+ *
+ * analogReadQ15() and analogPinReadQ15() return 0 to just under
+ * Q15_ONE for 0 to full scale, and analogWriteQ15() and
+ * pwmChannelWriteQ15() take a duty on that scale, so a control loop
+ * can go from sample to duty without knowing the resolutions.
+ *
+ * mapFast() is map() with the slope worked out once by mapFastInit():
+ * a multiply and a shift per call instead of a divide.
+ */
+
+#ifndef WiringFixed_h
+#define WiringFixed_h
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define Q15_ONE         32768
+#define Q31_MAX         0x7fffffff
+
+/* constant conversions, rounded: Q15(0.25) is 8192 */
+#define Q15(x)          ((int32_t)((x) * 32768.0 + ((x) < 0 ? -0.5 : 0.5)))
+#define Q31(x)          ((int32_t)((x) >= 1.0 ? Q31_MAX : \
+                            (x) * 2147483648.0 + ((x) < 0 ? -0.5 : 0.5)))
+
+static inline int32_t q15FromFloat(float x)
+{
+    return ((int32_t)(x * 32768.0f));
+}
+
+static inline float q15ToFloat(int32_t q)
+{
+    return (q * (1.0f / 32768.0f));
+}
+
+static inline int32_t q15Mul(int32_t a, int32_t b)
+{
+    return ((int32_t)(((int64_t)a * b) >> 15));
+}
+
+static inline int32_t q31Mul(int32_t a, int32_t b)
+{
+    return ((int32_t)(((int64_t)a * b) >> 31));
+}
+
+/* a divide, for setup rather than the loop */
+static inline int32_t q15Div(int32_t a, int32_t b)
+{
+    return ((int32_t)(((int64_t)a << 15) / b));
+}
+
+static inline int32_t qClamp(int32_t x, int32_t low, int32_t high)
+{
+    return (x < low ? low : x > high ? high : x);
+}
+
+/* a + (b - a) * t, t from 0 to Q15_ONE */
+static inline int32_t q15Lerp(int32_t a, int32_t b, int32_t t)
+{
+    return (a + q15Mul(b - a, t));
+}
+
+/*
+ *  First order low pass: *state moves alpha of the way to x per call,
+ *  alpha = Q15(1 - exp(-2 pi fc / fs)) for a cutoff fc at rate fs
+ */
+static inline int32_t q15LowPass(int32_t *state, int32_t x, int32_t alpha)
+{
+    *state += q15Mul(alpha, x - *state);
+    return (*state);
+}
+
+/* a count of an ADC or PWM of the given bits to Q15, and back */
+static inline int32_t q15FromCounts(uint32_t counts, uint8_t bits)
+{
+    return (bits <= 15 ? (int32_t)(counts << (15 - bits)) :
+        (int32_t)(counts >> (bits - 15)));
+}
+
+static inline uint32_t q15ToCounts(int32_t q, uint8_t bits)
+{
+    uint32_t max = (1UL << bits) - 1;
+
+    if (q <= 0) {
+        return (0);
+    }
+    q = (int32_t)(((int64_t)q << bits) >> 15);
+    return ((uint32_t)q > max ? max : (uint32_t)q);
+}
+
+/*
+ *  PI controller in Q15. The integral is clamped to the output range,
+ *  so it does not wind up while the output saturates.
+ */
+typedef struct PIControl {
+    int32_t kp;
+    int32_t ki;                 /* per update, i.e. Ki * the period */
+    int32_t integral;
+    int32_t min;
+    int32_t max;
+} PIControl;
+
+static inline void piControlInit(PIControl *pi, int32_t kp, int32_t ki,
+    int32_t min, int32_t max)
+{
+    pi->kp = kp;
+    pi->ki = ki;
+    pi->integral = 0;
+    pi->min = min;
+    pi->max = max;
+}
+
+static inline int32_t piControlUpdate(PIControl *pi, int32_t error)
+{
+    pi->integral = qClamp(pi->integral + q15Mul(pi->ki, error), pi->min,
+        pi->max);
+
+    return (qClamp(q15Mul(pi->kp, error) + pi->integral, pi->min, pi->max));
+}
+
+/* map() with a precomputed slope, see mapFastInit() */
+typedef struct MapFast {
+    int32_t inMin;
+    int32_t outMin;
+    int32_t slope;              /* (out range / in range) << shift */
+    uint8_t shift;
+} MapFast;
+
+void mapFastInit(MapFast *m, long in_min, long in_max, long out_min,
+    long out_max);
+
+/* rounds down where map() truncates toward 0: within 1 of map() */
+static inline long mapFast(const MapFast *m, long x)
+{
+    return (m->outMin +
+        (int32_t)((((int64_t)x - m->inMin) * m->slope) >> m->shift));
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "Energia.h"
+
+#include <stdio.h>
+
+#include <xdc/runtime/Error.h>
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+#include <ti/sysbios/knl/Clock.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/knl/Task.h>
+
+volatile bool logOn = false;
+
+/* log ring, see wiring_log.h */
+static struct {
+    LogRecord *ring;
+    uint32_t mask;
+    volatile uint32_t head;     /* written with Hwis disabled */
+    volatile uint32_t tail;     /* written only by the log task */
+    volatile uint32_t dropped;
+    LogSinkFxn fxn;
+    uintptr_t arg;
+    Task_Handle task;
+    Semaphore_Struct readySem;  /* posted when the ring leaves empty */
+} logQueue;
+
+static void logTaskFxn(UArg arg0, UArg arg1);
+
+/*
+ *  ======== logBegin ========
+ *  Start (or restart, emptied) logging into ring to fxn, drained by a
+ *  task at priority; count must be a power of 2. The task is created
+ *  on the first call and stays.
+ */
+bool logBegin(LogRecord *ring, unsigned int count, LogSinkFxn fxn,
+    uintptr_t arg, int priority)
+{
+    Semaphore_Params semParams;
+    Task_Params params;
+    uintptr_t key;
+
+    if (ring == NULL || count < 2 || (count & (count - 1)) != 0 ||
+        fxn == NULL) {
+        return (false);
+    }
+
+    logEnd();
+
+    if (logQueue.task == NULL) {
+        Semaphore_Params_init(&semParams);
+        semParams.mode = Semaphore_Mode_BINARY;
+        Semaphore_construct(&logQueue.readySem, 0, &semParams);
+
+        Task_Params_init(&params);
+        params.stackSize = 1024;
+        params.priority = priority;
+        params.instance->name = (xdc_String)"log";
+
+        logQueue.task = Task_create(logTaskFxn, &params, Error_IGNORE);
+        if (logQueue.task == NULL) {
+            Semaphore_destruct(&logQueue.readySem);
+            return (false);
+        }
+    }
+    else {
+        Task_setPri(logQueue.task, priority);
+    }
+
+    key = Hwi_disable();
+    logQueue.ring = ring;
+    logQueue.mask = count - 1;
+    logQueue.head = 0;
+    logQueue.tail = 0;
+    logQueue.dropped = 0;
+    logQueue.fxn = fxn;
+    logQueue.arg = arg;
+    logOn = true;
+    Hwi_restore(key);
+
+    return (true);
+}
+
+/*
+ *  ======== logEnd ========
+ *  Stop logging; records queued before are still written, see
+ *  logFlush().
+ */
+void logEnd(void)
+{
+    logOn = false;
+}
+
+/*
+ *  ======== logWrite ========
+ *  Hwis, Swis and tasks all produce, so a slot is claimed and filled
+ *  with Hwis disabled; the task only needs waking for the first record
+ *  after it found the ring empty.
+ */
+RAMFUNC void logWrite(const char *fmt, uint32_t a0, uint32_t a1,
+    uint32_t a2, uint32_t a3)
+{
+    LogRecord *r;
+    uint32_t head;
+    uintptr_t key;
+    bool wake = false;
+
+    key = Hwi_disable();
+
+    head = logQueue.head;
+    if (!logOn) {
+        /* not logging: before logBegin() or after logEnd() */
+    }
+    else if (head - logQueue.tail > logQueue.mask) {
+        logQueue.dropped++;
+    }
+    else {
+        r = &logQueue.ring[head & logQueue.mask];
+        r->fmt = fmt;
+        r->args[0] = a0;
+        r->args[1] = a1;
+        r->args[2] = a2;
+        r->args[3] = a3;
+        wake = (head == logQueue.tail);
+        logQueue.head = head + 1;
+    }
+
+    Hwi_restore(key);
+
+    if (wake) {
+        Semaphore_post(Semaphore_handle(&logQueue.readySem));
+    }
+}
+
+/*
+ *  ======== logFlush ========
+ *  Wait up to timeout Clock ticks (ms) for the task to write out what
+ *  is queued; false if it hasn't by then. From a task other than the
+ *  log task.
+ */
+bool logFlush(uint32_t timeout)
+{
+    uint32_t start = Clock_getTicks();
+
+    while (logQueue.tail != logQueue.head) {
+        if (Clock_getTicks() - start >= timeout) {
+            return (false);
+        }
+        Task_sleep(1);
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== logDropped ========
+ *  Records lost to a full ring since logBegin().
+ */
+uint32_t logDropped(void)
+{
+    return (logQueue.dropped);
+}
+
+/*
+ *  ======== logTaskFxn ========
+ *  The consumer: format and write the oldest record, then hand its
+ *  slot back, so logFlush() returns only once the sink has the line.
+ *  head is re-read after each record, so one queued meanwhile is seen
+ *  without a post.
+ */
+static void logTaskFxn(UArg arg0, UArg arg1)
+{
+    static char line[LOG_LINE_MAX];
+    const LogRecord *r;
+    uint32_t tail;
+    int len;
+
+    for (;;) {
+        Semaphore_pend(Semaphore_handle(&logQueue.readySem),
+            BIOS_WAIT_FOREVER);
+
+        while ((tail = logQueue.tail) != logQueue.head) {
+            r = &logQueue.ring[tail & logQueue.mask];
+
+            len = snprintf(line, sizeof(line), r->fmt,
+                r->args[0], r->args[1], r->args[2], r->args[3]);
+            if (len >= (int)sizeof(line)) {
+                len = sizeof(line) - 1;
+            }
+
+            if (len > 0) {
+                logQueue.fxn(line, len, logQueue.arg);
+            }
+
+            /* done with the slot before handing it back */
+            __asm volatile ("" ::: "memory");
+            logQueue.tail = tail + 1;
+        }
+    }
+}
+
+/*
+ *  ======== logPrintFxn ========
+ *  LogSinkFxn for a Print
+ */
+static void logPrintFxn(const char *line, size_t len, uintptr_t arg)
+{
+    ((Print *)arg)->write((const uint8_t *)line, len);
+}
+
+/*
+ *  ======== logBegin ========
+ */
+bool logBegin(LogRecord *ring, unsigned int count, Print &out, int priority)
+{
+    return (logBegin(ring, count, logPrintFxn, (uintptr_t)&out, priority));
+}
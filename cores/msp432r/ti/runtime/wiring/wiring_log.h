@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * Deferred logging: logPrintf() stores the format pointer and up to
+ * four arguments into a caller supplied ring, and a low priority task
+ * formats and writes them out later, so a Hwi or a time critical task
+ * pays for a few stores instead of a print:
+ *
+ *     LogRecord ring[64];
+ *
+ *     logBegin(ring, 64, Serial);
+ *     ...
+ *     logPrintf("pos %ld err %d\n", pos, err);
+ *
+ * A record costs about a hundred cycles with Hwis off briefly, plus a
+ * Semaphore_post() when the ring was empty; while logging is off a
+ * logPrintf() costs a load and a branch. Build with -DWIRING_LOG=0 to
+ * compile them out. Records arriving with the ring full are counted
+ * by logDropped().
+ *
+ * Since formatting happens later, the format and any %s argument must
+ * still be there then: string literals and other constant strings,
+ * not buffers on the caller's stack. Arguments are passed on as 32
+ * bit words, so integers, characters and pointers format as usual;
+ * %f and 64 bit conversions don't work, scale to an integer instead.
+ *
+ * The task writes each formatted line to the sink: a Print, such as
+ * Serial, whose buffered writes block only the task, or a LogSinkFxn,
+ * e.g. one that hands lines to Display_printf() on a board with a
+ * Display configured.
+ */
+
+#ifndef WiringLog_h
+#define WiringLog_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef WIRING_LOG
+#define WIRING_LOG 1
+#endif
+
+#define LOG_MAX_ARGS    4
+
+/* longest formatted line, longer ones are cut */
+#ifndef LOG_LINE_MAX
+#define LOG_LINE_MAX    128
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct LogRecord {
+    const char *fmt;
+    uint32_t args[LOG_MAX_ARGS];
+} LogRecord;
+
+/* called in the log task with each formatted line, len chars */
+typedef void (*LogSinkFxn)(const char *line, size_t len, uintptr_t arg);
+
+extern volatile bool logOn;
+
+extern bool logBegin(LogRecord *ring, unsigned int count, LogSinkFxn fxn,
+    uintptr_t arg, int priority);
+extern void logEnd(void);
+extern void logWrite(const char *fmt, uint32_t a0, uint32_t a1, uint32_t a2,
+    uint32_t a3);
+extern bool logFlush(uint32_t timeout);
+extern uint32_t logDropped(void);
+
+/*
+ *  ======== logRecord ========
+ *  Queue a record if logging; from any thread
+ */
+static inline void logRecord(const char *fmt, uint32_t a0, uint32_t a1,
+    uint32_t a2, uint32_t a3)
+{
+#if WIRING_LOG
+    if (logOn) {
+        logWrite(fmt, a0, a1, a2, a3);
+    }
+#endif
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/* logPrintf(fmt, ...) with up to LOG_MAX_ARGS arguments */
+#define logPrintf(...)          LOG_RECORD_(__VA_ARGS__, 0, 0, 0, 0, 0)
+#define LOG_RECORD_(fmt, a0, a1, a2, a3, ...) \
+    logRecord((fmt), (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2), \
+        (uint32_t)(a3))
+
+#ifdef __cplusplus
+
+class Print;
+
+/* log to out, e.g. Serial, from a task at priority */
+bool logBegin(LogRecord *ring, unsigned int count, Print &out,
+    int priority = 1);
+
+#endif
+
+#endif
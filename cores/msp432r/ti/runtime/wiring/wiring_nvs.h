@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Reading an NVS region in place. The MSP432 flash is directly
+ * addressable, so instead of copying a range out with NVS_read() a
+ * read-mostly table (a calibration curve, a font, a lookup table) can
+ * be used where it is:
+ *
+ *     size_t size = 0;                        // the rest of the region
+ *     const uint8_t *font = (const uint8_t *)nvsMap(nvs, 0, &size);
+ *
+ * *size is the bytes wanted from offset, 0 for all the region has
+ * after it, and is set to the bytes mapped. NULL if the range is not
+ * within the region, or the region is not memory mapped (an external
+ * SPI flash).
+ *
+ * The pointer is good for as long as the region is open. What it
+ * points at changes with NVS_write() and NVS_erase() of the range:
+ * reading it while another task writes or erases it takes
+ * NVS_lock()/NVS_unlock() around the use.
+ */
+
+#ifndef WiringNvs_h
+#define WiringNvs_h
+
+#include <stddef.h>
+
+#include <ti/drivers/NVS.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const void *nvsMap(NVS_Handle handle, size_t offset, size_t *size);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
@@ -45,12 +45,16 @@ extern "C" {
 #define PIN_FUNC_ANALOG_INPUT       4
 #define PIN_FUNC_INVALID            5
 
-#define NOT_ON_ADC      0xff
-
 extern void stopAnalogWrite(uint8_t pin);
 extern void stopAnalogRead(uint8_t pin);
+extern void restoreAnalogRead(void);
 extern void stopDigitalWrite(uint8_t pin);
 extern void stopDigitalRead(uint8_t pin);
+extern uint32_t timerCreateId(uint8_t owner);
+
+/* tone() square waves from a Timer_A output, see msp432/wiring_analog.c */
+extern bool timerToneBegin(uint8_t pin, uint32_t hz);
+extern void timerToneEnd(uint8_t pin);
 
 typedef struct SpiInfo {
     uint16_t minDmaTransferSize;
@@ -59,10 +63,18 @@ typedef struct SpiInfo {
 
 extern void getSpiInfo(void *spi, SpiInfo *spiInfo);
 
+/* uDMA channel completions on DMA_INT0, see msp432/wiring_dma.c */
+extern bool dmaAttach(uint32_t ch, DmaCallback fxn, uintptr_t arg,
+    uint32_t priority);
+extern void dmaDetach(uint32_t ch);
+
+/* RTC_C calendar interrupts, shared with the idle policy's prescalers */
+extern void rtcAttach(void (*fxn)(void));
+
 extern int8_t analogReadShift;
+extern uint8_t analogReadAverage;
 
 extern uint8_t digital_pin_to_pin_function[];
-extern const uint8_t digital_pin_to_adc_index[];
 
 
 #ifdef __cplusplus
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Energia.h"
+
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+volatile bool profileOn = false;
+
+/* sites that have run a span; a site stays linked once it has */
+static ProfileSite *sites = NULL;
+
+/*
+ *  ======== profileBegin ========
+ *  Start profiling, the sites' figures cleared
+ */
+void profileBegin(void)
+{
+    profileReset();
+    profileOn = true;
+}
+
+/*
+ *  ======== profileEnd ========
+ *  Stop profiling; the figures stay for profileDump()
+ */
+void profileEnd(void)
+{
+    profileOn = false;
+}
+
+/*
+ *  ======== profileReset ========
+ */
+void profileReset(void)
+{
+    ProfileSite *site;
+    uintptr_t key;
+
+    for (site = profileSites(); site != NULL; site = site->next) {
+        key = Hwi_disable();
+        site->count = 0;
+        site->total = 0;
+        site->max = 0;
+        memset(site->histogram, 0, sizeof(site->histogram));
+        Hwi_restore(key);
+    }
+}
+
+/*
+ *  ======== profileRecord ========
+ *  Account for a span of cycles at site; from any thread
+ */
+void profileRecord(ProfileSite *site, uint32_t cycles)
+{
+    uint32_t bucket = 31 - __builtin_clz(cycles | 1);
+    uintptr_t key;
+
+    if (bucket >= PROFILE_BUCKETS) {
+        bucket = PROFILE_BUCKETS - 1;
+    }
+
+    key = Hwi_disable();
+
+    if (!site->linked) {
+        site->linked = true;
+        site->next = sites;
+        sites = site;
+    }
+
+    if (site->count == 0 || cycles < site->min) {
+        site->min = cycles;
+    }
+    if (cycles > site->max) {
+        site->max = cycles;
+    }
+    site->count++;
+    site->total += cycles;
+    site->histogram[bucket]++;
+
+    Hwi_restore(key);
+}
+
+/*
+ *  ======== profileSites ========
+ */
+ProfileSite *profileSites(void)
+{
+    return (sites);
+}
+
+/*
+ *  ======== profileDump ========
+ *  The figures are in MCLK cycles; a site is copied out with Hwis
+ *  disabled so its line is consistent, then printed from the copy.
+ */
+void profileDump(Print &out)
+{
+    ProfileSite *site;
+    ProfileSite copy;
+    uintptr_t key;
+    int b;
+
+    out.println("site                    count       min      mean       max");
+
+    for (site = profileSites(); site != NULL; site = site->next) {
+        key = Hwi_disable();
+        copy = *site;
+        Hwi_restore(key);
+
+        if (copy.count == 0) {
+            continue;
+        }
+
+        out.printf("%-20s %8lu %9lu %9lu %9lu\r\n", copy.name,
+            (unsigned long)copy.count, (unsigned long)copy.min,
+            (unsigned long)(copy.total / copy.count),
+            (unsigned long)copy.max);
+
+        out.print("   ");
+        for (b = 0; b < PROFILE_BUCKETS; b++) {
+            if (copy.histogram[b] != 0) {
+                out.printf(" 2^%d:%lu", b, (unsigned long)copy.histogram[b]);
+            }
+        }
+        out.println();
+    }
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Hot path profiling: a PROFILE_SCOPE("name") at the top of a block
+ * times it in MCLK cycles (the DWT cycle counter, cycles()) each time
+ * it runs, into a static ProfileSite of that call site with the count,
+ * min, mean, max and a histogram of powers of two:
+ *
+ *     void loop()
+ *     {
+ *         PROFILE_SCOPE("loop");
+ *         ...
+ *     }
+ *
+ *     profileBegin();
+ *     ...
+ *     profileDump(Serial);
+ *
+ * C code brackets the span with PROFILE_BEGIN("name") and
+ * PROFILE_END(). The core has sites of its own in SPI.transfer(),
+ * Wire.endTransmission(), analogRead(), Serial.write() and the WiFi
+ * library's sl_Send(), sl_Recv(), sl_SendTo() and sl_RecvFrom() calls.
+ *
+ * A site costs a load and a branch until profileBegin(), and a few dozen
+ * cycles per span after, which the figures include. Spans measure wall
+ * time: a task preempted inside one is charged for the preemption.
+ * Build with -DWIRING_PROFILE=0 to compile the sites out.
+ */
+
+#ifndef WiringProfile_h
+#define WiringProfile_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef WIRING_PROFILE
+#define WIRING_PROFILE 1
+#endif
+
+#define PROFILE_BUCKETS 24      /* 2^0 to 2^23 cycles, the last open ended */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ProfileSite {
+    const char *name;
+    struct ProfileSite *next;   /* linked in on its first span */
+    bool linked;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t histogram[PROFILE_BUCKETS];
+} ProfileSite;
+
+typedef struct ProfileSpan {
+    ProfileSite *site;          /* NULL if not profiling at the start */
+    uint32_t start;
+} ProfileSpan;
+
+extern volatile bool profileOn;
+
+extern void profileBegin(void);
+extern void profileEnd(void);
+extern void profileReset(void);
+extern void profileRecord(ProfileSite *site, uint32_t cycles);
+
+/* the sites that have run a span, most recent first */
+extern ProfileSite *profileSites(void);
+
+/*
+ *  ======== profileStart ========
+ */
+static inline ProfileSpan profileStart(ProfileSite *site)
+{
+    ProfileSpan span;
+
+    span.site = profileOn ? site : NULL;
+    span.start = span.site != NULL ? cycles() : 0;
+
+    return (span);
+}
+
+/*
+ *  ======== profileStop ========
+ */
+static inline void profileStop(ProfileSpan span)
+{
+    if (span.site != NULL) {
+        profileRecord(span.site, cycles() - span.start);
+    }
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#define PROFILE_CAT_(a, b)      a##b
+#define PROFILE_CAT(a, b)       PROFILE_CAT_(a, b)
+
+#if WIRING_PROFILE
+
+/* every field, for -Wmissing-field-initializers */
+#define PROFILE_SITE_INIT(name) \
+    {(name), NULL, false, 0, 0, 0, 0, {0}}
+
+#define PROFILE_BEGIN(name) \
+    static ProfileSite profileSite_ = PROFILE_SITE_INIT(name); \
+    ProfileSpan profileSpan_ = profileStart(&profileSite_)
+#define PROFILE_END()           profileStop(profileSpan_)
+
+#ifdef __cplusplus
+#define PROFILE_SCOPE(name) \
+    static ProfileSite PROFILE_CAT(profileSite_, __LINE__) = \
+        PROFILE_SITE_INIT(name); \
+    ProfileScope PROFILE_CAT(profileScope_, __LINE__)( \
+        &PROFILE_CAT(profileSite_, __LINE__))
+#endif
+
+#else
+
+#define PROFILE_BEGIN(name)
+#define PROFILE_END()
+#define PROFILE_SCOPE(name)
+
+#endif
+
+#ifdef __cplusplus
+
+class Print;
+
+/* one span, from construction to the end of the enclosing scope */
+class ProfileScope
+{
+    public:
+        ProfileScope(ProfileSite *site) : span(profileStart(site)) {}
+        ~ProfileScope(void) { profileStop(span); }
+
+    private:
+        ProfileSpan span;
+};
+
+/* a line per site, then its non-empty histogram buckets */
+void profileDump(Print &out);
+
+#endif
+
+#endif
@@ -33,13 +33,34 @@
 #include "wiring_private.h"
 
 #include <ti/drivers/GPIO.h>
+#include <ti/drivers/Capture.h>
+#include <ti/drivers/capture/CaptureMSP432.h>
+#include <ti/drivers/Power.h>
+#include <ti/drivers/power/PowerMSP432.h>
 
-/* Measures the length (in microseconds) of a pulse on the pin; state is HIGH
- * or LOW, the type of pulse to measure.  Works on pulses from 2-3 microseconds
- * to 3 minutes in length, but must be called at least a few dozen microseconds
- * before the start of the pulse. */
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
 
-unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeout)
+#include <driverlib/rom.h>
+#include <driverlib/rom_map.h>
+#include <driverlib/timer_a.h>
+
+extern const Capture_Config Capture_config[];
+extern const uint_least8_t Capture_count;
+
+/* open capture of each Capture_config[] entry and who is waiting on it */
+static Capture_Handle captures[PULSE_CAPTURES_MAX];
+static PulseCapture *volatile active[PULSE_CAPTURES_MAX];
+
+static uint32_t timestampHz;
+
+/* Polled fallback for pins without a capture input. Works on pulses from
+ * 2-3 microseconds to 3 minutes in length, but must be called at least a
+ * few dozen microseconds before the start of the pulse. */
+
+static unsigned long pulseInPolled(uint8_t pin, uint8_t state,
+    unsigned long timeout)
 {
     uint8_t stateMask;
     uint32_t start, end, result;
@@ -92,3 +113,216 @@ unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeout)
 
     return (result);
 }
+
+/*
+ *  ======== digitalPinToCapture ========
+ *  Capture_config[] entry whose input is pin, -1 if none.
+ */
+int digitalPinToCapture(uint8_t pin)
+{
+    uint16_t portPin = digital_pin_to_port_pin[pin];
+    CaptureMSP432_HWAttrs const *hwAttrs;
+    unsigned int i;
+
+    if ((portPin >> 8) == 0) {
+        return (-1);
+    }
+
+    for (i = 0; i < Capture_count && i < PULSE_CAPTURES_MAX; i++) {
+        hwAttrs = (CaptureMSP432_HWAttrs const *)Capture_config[i].hwAttrs;
+        if (((hwAttrs->capturePort >> 4) & 0xf) == (portPin >> 8)
+            && (1 << (hwAttrs->capturePort & 0xf)) == (portPin & 0xff)) {
+            return (i);
+        }
+    }
+
+    return (-1);
+}
+
+/*
+ *  ======== pulseCaptureFxn ========
+ *  Capture callback, Hwi context, on every edge. The timer is only 16
+ *  bits; the wraps between the two edges are recovered from the
+ *  Timestamp taken at each edge, which only has to be right to half a
+ *  wrap (a few ms at SMCLK).
+ */
+static void pulseCaptureFxn(Capture_Handle handle, uint32_t interval)
+{
+    unsigned int index = handle - (Capture_Handle)Capture_config;
+    CaptureMSP432_HWAttrs const *hwAttrs = handle->hwAttrs;
+    PulseCapture *pc = active[index];
+    uint32_t now = Timestamp_get32();
+    uint32_t elapsed;
+    uint16_t count;
+
+    (void)interval;
+
+    if (pc == NULL) {
+        return;
+    }
+
+    count = MAP_Timer_A_getCaptureCompareCount(hwAttrs->timerBaseAddress,
+        (hwAttrs->capturePort >> CAPTUREMSP432_CCR_OFS) & 0xf);
+
+    /* the edge ending a pulse already under way when we started */
+    if (pc->skip) {
+        pc->skip = false;
+        return;
+    }
+
+    if (pc->edges++ == 0) {
+        pc->startCount = count;
+        pc->startTime = now;
+        return;
+    }
+
+    Capture_stop(handle);
+    active[index] = NULL;
+
+    pc->counts = (uint16_t)(count - pc->startCount);
+    elapsed = (uint32_t)(((uint64_t)(now - pc->startTime) * pc->countHz)
+        / timestampHz);
+    if (elapsed > pc->counts) {
+        pc->counts += ((elapsed - pc->counts + 0x8000) >> 16) << 16;
+    }
+    pc->width = (unsigned long)(((uint64_t)pc->counts * 1000000)
+        / pc->countHz);
+    pc->done = true;
+
+    if (pc->callback != NULL) {
+        pc->callback(pc);
+    }
+    if (pc->sem != NULL) {
+        Semaphore_post(pc->sem);
+    }
+}
+
+/*
+ *  ======== pulseInAsync ========
+ *  Start timing the next state pulse on pc->pin with the timer's
+ *  capture hardware: the task is free meanwhile, the result has the
+ *  timer clock's resolution (1/SMCLK) and is not skewed by preemption.
+ *  A pulse in progress at the call is skipped, as pulseIn() does.
+ *  Returns false if the pin has no capture input or its timer is busy.
+ *  Must be called from a task; end it early with pulseInCancel().
+ */
+bool pulseInAsync(PulseCapture *pc)
+{
+    CaptureMSP432_HWAttrs const *hwAttrs;
+    PowerMSP432_Freqs freqs;
+    Capture_Params params;
+    Types_FreqHz freq;
+    Capture_Handle handle;
+    int index = digitalPinToCapture(pc->pin);
+    uintptr_t key;
+
+    if (index < 0 || active[index] != NULL) {
+        return (false);
+    }
+
+    /* still open from a previous measurement that ran to completion */
+    if (captures[index] != NULL) {
+        Capture_close(captures[index]);
+        captures[index] = NULL;
+        pinMode(pc->pin, INPUT);
+    }
+
+    if (timestampHz == 0) {
+        Capture_init();
+        Timestamp_getFreq(&freq);
+        timestampHz = freq.lo;
+    }
+
+    Capture_Params_init(&params);
+    params.mode = Capture_ANY_EDGE;
+    params.callbackFxn = pulseCaptureFxn;
+    params.periodUnit = Capture_PERIOD_COUNTS;
+
+    handle = Capture_open(index, &params);
+    if (handle == NULL) {
+        return (false);
+    }
+    captures[index] = handle;
+
+    /* the pin is the timer's now; digitalRead() etc. must configure it */
+    digital_pin_to_pin_function[pc->pin] = PIN_FUNC_UNUSED;
+
+    hwAttrs = (CaptureMSP432_HWAttrs const *)handle->hwAttrs;
+    PowerMSP432_getFreqs(Power_getPerformanceLevel(), &freqs);
+    pc->countHz = (hwAttrs->clockSource == TIMER_A_CLOCKSOURCE_SMCLK ?
+        freqs.SMCLK : freqs.ACLK) / hwAttrs->clockDivider;
+
+    pc->capture = index;
+    pc->done = false;
+    pc->width = 0;
+    pc->counts = 0;
+    pc->edges = 0;
+
+    key = Hwi_disable();
+    active[index] = pc;
+    Capture_start(handle);
+    pc->skip = (*fastPinAlias(digital_pin_to_port_pin[pc->pin],
+        FAST_PIN_IN) == (pc->state ? 1 : 0));
+    Hwi_restore(key);
+
+    return (true);
+}
+
+/*
+ *  ======== pulseInCancel ========
+ *  Stop pc if it is still waiting and release the timer; pc->done
+ *  tells whether it completed first. Task context.
+ */
+void pulseInCancel(PulseCapture *pc)
+{
+    uintptr_t key;
+
+    key = Hwi_disable();
+    if (active[pc->capture] == pc) {
+        active[pc->capture] = NULL;
+        Capture_stop(captures[pc->capture]);
+    }
+    Hwi_restore(key);
+
+    if (captures[pc->capture] != NULL) {
+        Capture_close(captures[pc->capture]);
+        captures[pc->capture] = NULL;
+
+        /* Capture_close() leaves the pin driven low */
+        pinMode(pc->pin, INPUT);
+    }
+}
+
+/* Measures the length (in microseconds) of a pulse on the pin; state is HIGH
+ * or LOW, the type of pulse to measure. Capture pins sleep the task while
+ * waiting and resolve to the timer clock; timeout is in microseconds. */
+
+unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeout)
+{
+    Semaphore_Params params;
+    Semaphore_Struct done;
+    PulseCapture pc;
+
+    Semaphore_Params_init(&params);
+    params.mode = Semaphore_Mode_BINARY;
+    Semaphore_construct(&done, 0, &params);
+
+    pc.pin = pin;
+    pc.state = state;
+    pc.callback = NULL;
+    pc.sem = Semaphore_handle(&done);
+    pc.arg = NULL;
+
+    if (!pulseInAsync(&pc)) {
+        Semaphore_destruct(&done);
+        return (pulseInPolled(pin, state, timeout));
+    }
+
+    /* 1 ms Clock ticks, rounded up */
+    Semaphore_pend(pc.sem, timeout / 1000 + 1);
+    pulseInCancel(&pc);
+
+    Semaphore_destruct(&done);
+
+    return (pc.done ? pc.width : 0);
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Timer_A capture based pulse measurement, see pulseInAsync(). Only
+ * the pins with an entry in the board's Capture_config[] qualify;
+ * pulseIn() falls back to polling on the others.
+ */
+
+#ifndef WiringPulse_h
+#define WiringPulse_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <ti/sysbios/knl/Semaphore.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Capture_config[] entries pulseInAsync() will use; the rest are ignored */
+#define PULSE_CAPTURES_MAX 8
+
+typedef struct PulseCapture {
+    /* set by the caller */
+    uint8_t pin;
+    uint8_t state;                  /* HIGH or LOW pulse */
+    void (*callback)(struct PulseCapture *);    /* Hwi context, or NULL */
+    Semaphore_Handle sem;           /* posted when done, or NULL */
+    void *arg;
+
+    /* maintained by pulseInAsync() */
+    volatile bool done;
+    unsigned long width;            /* microseconds */
+    uint32_t counts;                /* width in timer counts... */
+    uint32_t countHz;               /* ...of this frequency */
+
+    /* private */
+    uint8_t capture;
+    uint8_t edges;
+    bool skip;
+    uint16_t startCount;
+    uint32_t startTime;
+} PulseCapture;
+
+extern int digitalPinToCapture(uint8_t pin);
+extern bool pulseInAsync(PulseCapture *pc);
+extern void pulseInCancel(PulseCapture *pc);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * A small, fast pseudo random generator: PCG32 (O'Neill's XSH RR
+ * variant) on 64 bits of state, one 64 bit multiply-add per 32 bit
+ * output, no divide and no lock.
+ *
+ * An Rng belongs to whoever calls it: a task that wants its own stream
+ * (backoff jitter, Monte Carlo) keeps one and needs no locking, an Rng
+ * shared with Hwis needs them disabled around the call. random() and
+ * randomSeed() keep one shared Rng, updated with interrupts disabled
+ * for the few cycles of a step.
+ *
+ * rngBelow() maps a 32 bit output to [0, bound) with Lemire's multiply
+ * and shift, rejecting the few outputs that would bias the result; the
+ * modulo that finds them runs only for outputs in the low sliver of
+ * the range, so most calls take no divide. The streams are not
+ * cryptographic.
+ *
+ * randomEntropy() (msp432/wiring_adc14.c) gathers a seed from ADC
+ * noise and the device's TLV random number, so boards that boot the
+ * same way still get different sequences.
+ */
+
+#ifndef WiringRandom_h
+#define WiringRandom_h
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RNG_MULTIPLIER  6364136223846793005ULL
+#define RNG_INCREMENT   1442695040888963407ULL
+
+typedef struct Rng {
+    uint64_t state;
+} Rng;
+
+static inline uint32_t rngNext(Rng *r)
+{
+    uint64_t old = r->state;
+    uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    uint32_t rot = (uint32_t)(old >> 59);
+
+    r->state = old * RNG_MULTIPLIER + RNG_INCREMENT;
+
+    return ((xorshifted >> rot) | (xorshifted << (-rot & 31)));
+}
+
+static inline void rngSeed(Rng *r, uint64_t seed)
+{
+    r->state = 0;
+    rngNext(r);
+    r->state += seed;
+    rngNext(r);
+}
+
+/* uniform in [0, bound), 0 for a bound of 0 */
+static inline uint32_t rngBelow(Rng *r, uint32_t bound)
+{
+    uint64_t m = (uint64_t)rngNext(r) * bound;
+
+    if ((uint32_t)m < bound) {
+        /* 2^32 mod bound outputs are rejected */
+        uint32_t threshold = -bound % bound;
+
+        while ((uint32_t)m < threshold) {
+            m = (uint64_t)rngNext(r) * bound;
+        }
+    }
+
+    return ((uint32_t)(m >> 32));
+}
+
+/* uniform in [low, high), low if the range is empty */
+static inline int32_t rngRange(Rng *r, int32_t low, int32_t high)
+{
+    if (low >= high) {
+        return (low);
+    }
+
+    return ((int32_t)((uint32_t)low +
+        rngBelow(r, (uint32_t)high - (uint32_t)low)));
+}
+
+/* uniform in [0, 1), 24 bits */
+static inline float rngFloat(Rng *r)
+{
+    return ((rngNext(r) >> 8) * (1.0f / 16777216.0f));
+}
+
+uint32_t randomEntropy(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
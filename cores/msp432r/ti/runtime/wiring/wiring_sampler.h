@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Sampling profiler: Timer32 #1 interrupts rateHz times a second at
+ * the highest priority, above Hwi_disable(), and counts the PC it
+ * interrupted, with the task that was running, into a caller supplied
+ * hash table of SamplerBins. It sees everything, the prebuilt driver
+ * and kernel libraries and newlib included, and critical sections:
+ * only code running with all interrupts masked (PRIMASK) is missed.
+ *
+ *     SamplerBin bins[1024];
+ *
+ *     samplerBegin(bins, 1024, 4000);
+ *     ...
+ *     samplerEnd();
+ *     // print the bins with count != 0
+ *
+ * libraries/Interrupts/tools/sampler_report.py symbolizes the printed
+ * bins against the sketch's ELF or .map file. A sample costs a few
+ * dozen cycles, about 0.2% of the CPU at 4kHz.
+ *
+ * task is the Task_self() of the interrupted thread, NULL when the PC
+ * is in a Hwi or Swi. A PC/task pair not finding a bin within a few
+ * slots of its hash is counted by samplerDropped(). The rate is set
+ * from MCLK at samplerBegin(); the timer runs off MCLK, so it follows
+ * performance level changes and stops in deep sleep, where nothing
+ * runs to be sampled. The timer is the one the board's Timer driver
+ * has as Board_TIMER_T32_0, which the sketch must not open meanwhile.
+ */
+
+#ifndef WiringSampler_h
+#define WiringSampler_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct SamplerBin {
+    uint32_t pc;
+    uint32_t task;          /* Task_Handle, 0 for a Hwi or Swi */
+    uint32_t count;         /* 0 if the bin is free */
+} SamplerBin;
+
+extern bool samplerBegin(SamplerBin *bins, unsigned int count,
+    uint32_t rateHz);
+extern void samplerEnd(void);
+extern uint32_t samplerSamples(void);
+extern uint32_t samplerDropped(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
@@ -32,36 +32,95 @@
 
 #include "wiring_private.h"
 
-uint8_t shiftIn(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder)
+/*
+ * The pins are configured once per call, the way digitalWrite() and
+ * digitalRead() would on first use, then every bit is a single
+ * bit-band store or load (see wiring_fast.h) instead of a driver call.
+ */
+
+static void shiftPrepare(uint8_t dataPin, uint8_t dataFunction,
+    uint8_t clockPin)
 {
-    uint8_t value = 0;
+    if (digital_pin_to_pin_function[dataPin] != dataFunction) {
+        pinMode(dataPin, dataFunction == PIN_FUNC_DIGITAL_OUTPUT ?
+            OUTPUT : INPUT);
+    }
+    if (digital_pin_to_pin_function[clockPin] != PIN_FUNC_DIGITAL_OUTPUT) {
+        pinMode(clockPin, OUTPUT);
+    }
+}
+
+/*
+ *  ======== shiftInBuffer ========
+ */
+void shiftInBuffer(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder,
+    uint8_t *buf, size_t len)
+{
+    volatile uint32_t *data;
+    volatile uint32_t *clock;
+    uint8_t value;
     uint8_t i;
 
-    for (i = 0; i < 8; ++i) {
-        digitalWrite(clockPin, HIGH);
-        if (bitOrder == LSBFIRST) {
-            value |= digitalRead(dataPin) << i;
-        }
-        else {
-            value |= digitalRead(dataPin) << (7 - i);
+    shiftPrepare(dataPin, PIN_FUNC_DIGITAL_INPUT, clockPin);
+    data = fastPinAlias(digital_pin_to_port_pin[dataPin], FAST_PIN_IN);
+    clock = fastPinAlias(digital_pin_to_port_pin[clockPin], FAST_PIN_OUT);
+
+    while (len-- != 0) {
+        value = 0;
+        for (i = 0; i < 8; ++i) {
+            *clock = 1;
+            if (bitOrder == LSBFIRST) {
+                value |= *data << i;
+            }
+            else {
+                value |= *data << (7 - i);
+            }
+            *clock = 0;
         }
-        digitalWrite(clockPin, LOW);
+        *buf++ = value;
     }
-    return (value);
 }
 
-void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t val)
+/*
+ *  ======== shiftOutBuffer ========
+ */
+void shiftOutBuffer(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder,
+    const uint8_t *buf, size_t len)
 {
+    volatile uint32_t *data;
+    volatile uint32_t *clock;
+    uint8_t value;
     uint8_t i;
 
-    for (i = 0; i < 8; i++) {
-        if (bitOrder == LSBFIRST) {
-            digitalWrite(dataPin, !!(val & (1 << i)));
-        }
-        else {
-            digitalWrite(dataPin, !!(val & (1 << (7 - i))));
+    shiftPrepare(dataPin, PIN_FUNC_DIGITAL_OUTPUT, clockPin);
+    data = fastPinAlias(digital_pin_to_port_pin[dataPin], FAST_PIN_OUT);
+    clock = fastPinAlias(digital_pin_to_port_pin[clockPin], FAST_PIN_OUT);
+
+    while (len-- != 0) {
+        value = *buf++;
+        for (i = 0; i < 8; i++) {
+            if (bitOrder == LSBFIRST) {
+                *data = (value >> i) & 1;
+            }
+            else {
+                *data = (value >> (7 - i)) & 1;
+            }
+            *clock = 1;
+            *clock = 0;
         }
-        digitalWrite(clockPin, HIGH);
-        digitalWrite(clockPin, LOW);
     }
 }
+
+uint8_t shiftIn(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder)
+{
+    uint8_t value;
+
+    shiftInBuffer(dataPin, clockPin, bitOrder, &value, 1);
+
+    return (value);
+}
+
+void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t val)
+{
+    shiftOutBuffer(dataPin, clockPin, bitOrder, &val, 1);
+}
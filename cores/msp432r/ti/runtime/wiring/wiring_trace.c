@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "wiring_private.h"
+
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+#include <ti/sysbios/knl/Task.h>
+#include <xdc/runtime/Timestamp.h>
+
+volatile bool traceOn = false;
+
+/* trace ring, see wiring_trace.h */
+static struct {
+    TraceRecord *ring;
+    uint32_t mask;
+    volatile uint32_t head;     /* written with Hwis disabled */
+    volatile uint32_t tail;     /* written only by traceRead() */
+    volatile uint32_t dropped;
+} trace;
+
+/*
+ *  ======== traceBegin ========
+ *  Start (or restart, emptied) tracing into ring; count must be a
+ *  power of 2.
+ */
+bool traceBegin(TraceRecord *ring, unsigned int count)
+{
+    uintptr_t key;
+
+    if (ring == NULL || count < 2 || (count & (count - 1)) != 0) {
+        return (false);
+    }
+
+    key = Hwi_disable();
+    trace.ring = ring;
+    trace.mask = count - 1;
+    trace.head = 0;
+    trace.tail = 0;
+    trace.dropped = 0;
+    traceOn = true;
+    Hwi_restore(key);
+
+    return (true);
+}
+
+/*
+ *  ======== traceEnd ========
+ *  Stop tracing; records still queued can be read until traceBegin().
+ */
+void traceEnd(void)
+{
+    traceOn = false;
+}
+
+/*
+ *  ======== traceWrite ========
+ *  Hwis, Swis and tasks all produce, so a slot is claimed with Hwis
+ *  disabled; the time is taken inside too, so records are in order.
+ */
+RAMFUNC void traceWrite(uint16_t event, uint16_t arg, uint32_t data)
+{
+    TraceRecord *r;
+    uint32_t head;
+    uintptr_t key;
+
+    key = Hwi_disable();
+
+    head = trace.head;
+    if (!traceOn) {
+        /* not tracing: before traceBegin() or after traceEnd() */
+    }
+    else if (head - trace.tail > trace.mask) {
+        trace.dropped++;
+    }
+    else {
+        r = &trace.ring[head & trace.mask];
+        r->time = Timestamp_get32();
+        r->event = event;
+        r->arg = arg;
+        r->data = data;
+        trace.head = head + 1;
+    }
+
+    Hwi_restore(key);
+}
+
+/*
+ *  ======== traceAvailable ========
+ */
+unsigned int traceAvailable(void)
+{
+    return (trace.head - trace.tail);
+}
+
+/*
+ *  ======== traceRead ========
+ *  Copy out up to max of the oldest records; the consumer side, call
+ *  from one task only.
+ */
+unsigned int traceRead(TraceRecord *records, unsigned int max)
+{
+    uint32_t tail = trace.tail;
+    uint32_t head = trace.head;
+    unsigned int n = 0;
+
+    while (n < max && tail != head) {
+        records[n++] = trace.ring[tail & trace.mask];
+        tail++;
+    }
+
+    /* done with the slots before handing them back */
+    __asm volatile ("" ::: "memory");
+    trace.tail = tail;
+
+    return (n);
+}
+
+/*
+ *  ======== traceDropped ========
+ *  Events lost to a full ring since traceBegin().
+ */
+uint32_t traceDropped(void)
+{
+    return (trace.dropped);
+}
+
+/*
+ *  ======== __wrap_ti_sysbios_utils_Load_taskSwitchHook__E ========
+ *  The kernel configuration is prebuilt, with the Load module's task
+ *  switch hook as the only one; platform.txt links with --wrap for it
+ *  so task switches are traced on the way to the Load module.
+ */
+extern void __real_ti_sysbios_utils_Load_taskSwitchHook__E(Task_Handle prev,
+    Task_Handle next);
+
+RAMFUNC void __wrap_ti_sysbios_utils_Load_taskSwitchHook__E(Task_Handle prev,
+    Task_Handle next)
+{
+    traceEvent(TRACE_TASK_SWITCH, 0, (uint32_t)next);
+
+    __real_ti_sysbios_utils_Load_taskSwitchHook__E(prev, next);
+}
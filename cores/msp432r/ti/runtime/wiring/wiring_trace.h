@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2015-2017, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Binary trace: the core records what Serial, SPI, Wire, delay() and
+ * the scheduler are doing into a caller supplied ring, twelve bytes
+ * per event with a Timestamp_get32() time, for a task to drain with
+ * traceRead() and send off in binary (or for a debugger to read out
+ * of RAM, the ring being an ordinary array):
+ *
+ *     TraceRecord ring[512];
+ *
+ *     traceBegin(ring, 512);
+ *     ...
+ *     n = traceRead(out, 32);
+ *     Serial1.write((const uint8_t *)out, n * sizeof(TraceRecord));
+ *
+ * An event costs the Timestamp read and four stores with Hwis off
+ * briefly, well under a microsecond; while no ring is set the trace
+ * points cost a load and a branch. Build with -DWIRING_TRACE=0 to
+ * compile them out. Events arriving with the ring full are counted
+ * by traceDropped(). Sketches can add their own events from
+ * TRACE_USER up with traceEvent().
+ *
+ * Operations that take time are traced twice, the second time with
+ * TRACE_END ORed into the event.
+ */
+
+#ifndef WiringTrace_h
+#define WiringTrace_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef WIRING_TRACE
+#define WIRING_TRACE 1
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRACE_TASK_SWITCH   0x01    /* data: Task_Handle switched to */
+#define TRACE_DELAY         0x02    /* data: milliseconds */
+#define TRACE_SERIAL_WRITE  0x03    /* arg: UART, data: bytes */
+#define TRACE_SERIAL_FRAME  0x04    /* arg: UART, data: frame length */
+#define TRACE_SPI           0x05    /* arg: SPI module, data: bytes */
+#define TRACE_WIRE          0x06    /* arg: address, data: bytes; end
+                                       arg: error, see WIRE_SUCCESS */
+#define TRACE_USER          0x100   /* first id for sketch events */
+#define TRACE_END           0x8000  /* the operation has finished */
+
+typedef struct TraceRecord {
+    uint32_t time;          /* Timestamp_get32() */
+    uint16_t event;
+    uint16_t arg;
+    uint32_t data;
+} TraceRecord;
+
+extern volatile bool traceOn;
+
+extern bool traceBegin(TraceRecord *ring, unsigned int count);
+extern void traceEnd(void);
+extern void traceWrite(uint16_t event, uint16_t arg, uint32_t data);
+extern unsigned int traceAvailable(void);
+extern unsigned int traceRead(TraceRecord *records, unsigned int max);
+extern uint32_t traceDropped(void);
+
+/*
+ *  ======== traceEvent ========
+ *  Record an event if tracing; from any thread
+ */
+static inline void traceEvent(uint16_t event, uint16_t arg, uint32_t data)
+{
+#if WIRING_TRACE
+    if (traceOn) {
+        traceWrite(event, arg, data);
+    }
+#endif
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
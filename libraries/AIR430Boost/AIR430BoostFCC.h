@@ -27,4 +27,19 @@
  *  Note: This file is part of AIR430Boost.
  */
 #include "utility/A110x2500Radio.h"
+
+#ifdef AIR_430BOOST_ETSI_H
+#error "AIR430Boost: include either AIR430BoostFCC.h or AIR430BoostETSI.h"
+#endif
+
+extern "C" {
+  #include "utility/A110LR09.h"
+}
+
+// Select the FCC/IC certified settings. Weak, so the header may be included
+// from more than one file of a sketch.
+extern "C" const struct sA110LR09Region gA110LR09Region __attribute__((weak)) = {
+  gA110LR09FccLookup,
+  &gA110LR09FccLookupSize
+};
 #endif  /* AIR_430BOOST_FCC_H */
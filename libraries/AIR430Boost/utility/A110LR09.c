@@ -104,8 +104,8 @@ const struct sA110x2500ChannelList gA110LR09ChannelLookup[] = {
 // -----------------------------------------------------------------------------
 // A110LR09 certified configuration definitions
 
-const struct sA110x2500Lookup gA110LR09Lookup[] = {
-  // FCC/IC approved configurations
+// FCC/IC approved configurations
+const struct sA110x2500Lookup gA110LR09FccLookup[] = {
   // 2-FSK, 1.2kBaud, 7dBm max output power, 902MHz
   #ifdef A110LR09_FCC_2FSK_1_2_KBAUD
 	#define	A110LR09_FCC
@@ -358,8 +358,12 @@ const struct sA110x2500Lookup gA110LR09Lookup[] = {
     1000                                // No duty cycle requirements
   },
   #endif
+};
+const unsigned char gA110LR09FccLookupSize = 
+  sizeof(gA110LR09FccLookup) / sizeof(struct sA110x2500Lookup);
 
-  // ETSI approved configurations
+// ETSI approved configurations
+const struct sA110x2500Lookup gA110LR09EtsiLookup[] = {
   // M4, 2-FSK, 1.2kBaud, 868MHz
   #ifdef A110LR09_ETSI_M4_2FSK_1_2_KBAUD
 	#define	A110LR09_ETSI
@@ -1117,10 +1121,8 @@ const struct sA110x2500Lookup gA110LR09Lookup[] = {
   },
   #endif
 };
-
-#if defined( A110LR09_ETSI) && defined( A110LR09_FCC )
-#error "A110LR09 Error: ETSI and FCC configurations may not be selected at the same time"
-#endif
+const unsigned char gA110LR09EtsiLookupSize = 
+  sizeof(gA110LR09EtsiLookup) / sizeof(struct sA110x2500Lookup);
 
 // -----------------------------------------------------------------------------
 // A110LR09 power lookup table
@@ -1296,9 +1298,9 @@ bool A110LR09Init(struct sA110LR09PhyInfo *phyInfo,
 
 const struct sA110x2500Lookup* A110LR09GetLookup(unsigned char entry)
 {
-  if (entry < sizeof(gA110LR09Lookup) / sizeof(struct sA110x2500Lookup))
+  if (entry < *gA110LR09Region.size)
   {
-    return &gA110LR09Lookup[entry];
+    return &gA110LR09Region.lookup[entry];
   }
   
   return NULL;
@@ -1306,7 +1308,7 @@ const struct sA110x2500Lookup* A110LR09GetLookup(unsigned char entry)
 
 unsigned char A110LR09GetLookupSize()
 {
-  return sizeof(gA110LR09Lookup) / sizeof(struct sA110x2500Lookup);
+  return *gA110LR09Region.size;
 }
 
 const struct sA110x2500PowerLookup* A110LR09GetPowerLookup(unsigned char entry)
@@ -305,6 +305,30 @@ bool A110LR09Init(struct sA110LR09PhyInfo *phyInfo,
                   const struct sCC1101Spi *spi,
                   const struct sCC1101Gdo *gdo[3]);
 
+/**
+ *  sA110LR09Region - certified settings lookup table of a region.
+ */
+struct sA110LR09Region
+{
+  const struct sA110x2500Lookup *lookup;
+  const unsigned char *size;
+};
+
+/**
+ *  Certified settings of each region, as selected in A110LR09Config.h.
+ */
+extern const struct sA110x2500Lookup gA110LR09FccLookup[];
+extern const unsigned char gA110LR09FccLookupSize;
+extern const struct sA110x2500Lookup gA110LR09EtsiLookup[];
+extern const unsigned char gA110LR09EtsiLookupSize;
+
+/**
+ *  gA110LR09Region - region used by the lookup functions below. It is defined
+ *  by AIR430BoostFCC.h or AIR430BoostETSI.h, so only that region's table is 
+ *  referenced and the linker drops the other one.
+ */
+extern const struct sA110LR09Region gA110LR09Region;
+
 /**
  *  A110LR09GetLookup - get an entry from the certified settings lookup table.
  *
@@ -23,13 +23,13 @@
  *	trying to accomplish.
  */
 
-// Configuration settings (FCC/IC)
+// Configuration settings (FCC/IC), linked by including AIR430BoostFCC.h
 //#define A110LR09_FCC_2FSK_1_2_KBAUD         // 2FSK, 1.2kBaud, 902MHz
-//#define A110LR09_FCC_2FSK_38_KBAUD          // 2FSK, 38kBaud, 902MHz
+#define A110LR09_FCC_2FSK_38_KBAUD          // 2FSK, 38kBaud, 902MHz
 //#define A110LR09_FCC_2FSK_100_KBAUD         // 2FSK, 100kBaud, 902MHz
 //#define A110LR09_FCC_2FSK_250_KBAUD         // 2FSK, 250kBaud, 902MHz
 
-// Configuration settings (ETSI)
+// Configuration settings (ETSI), linked by including AIR430BoostETSI.h
 //#define A110LR09_ETSI_M4_2FSK_1_2_KBAUD     // M4, 2FSK, 1.2kBaud, 868MHz
 //#define A110LR09_ETSI_M5_2FSK_10_KBAUD      // M5, 2FSK, 10kBaud, 868MHz
 //#define A110LR09_ETSI_M6_GFSK_10_KBAUD      // M6, GFSK, 10kBaud, 868MHz
@@ -0,0 +1,733 @@
+/**
+ *  ----------------------------------------------------------------------------
+ *  A110x2500Radio.cpp - AIR430Boost A110x2500 radio implementation.
+ *  Copyright (C) 2012-2013 Anaren Microwave, Inc.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ * 
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ * 
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ *  This example demonstrates usage of the AIR430BoostETSI library which uses
+ *  the 430Boost-CC110L AIR Module BoosterPack created by Anaren Microwave, Inc.
+ *  and available through the TI eStore, for the European Union.
+ *  ----------------------------------------------------------------------------
+ *
+ *  Note: This file is part of AIR430Boost.
+ */
+#include <Energia.h>
+#include "A110x2500Radio.h"
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+#include <ti/sysbios/knl/Clock.h>
+#include "Platform.h"     // 430Boost-CC110L and EXP430G2 Launchpad support
+
+extern "C" { 
+  #include "A110LR09.h"   // Module driver
+}
+
+// ----------------------------------------------------------------------------
+// CC110L device driver
+
+const struct sCC1101Spi gSpi = { 
+  A110x2500SpiInit, 
+  A110x2500SpiRead, 
+  A110x2500SpiWrite 
+};
+const struct sCC1101Gdo gGdo0 = {
+  A110x2500Gdo0Init,
+  NULL,    // Not used
+  NULL,    // Not used
+  NULL,    // Not used
+  NULL,    // Not used
+  NULL     // Not used
+};
+const struct sCC1101Gdo *gGdo[3] = { &gGdo0, NULL, NULL };
+
+// ----------------------------------------------------------------------------
+// A110LR09 module driver
+
+struct sA110LR09PhyInfo gPhyInfo;
+volatile boolean gDataTransmitting = false;
+volatile boolean gDataReceived = false;
+A110x2500Radio Radio;
+GateMutex_Struct mygate;
+Semaphore_Handle sem;
+Event_Handle receiveEvent = NULL;
+UInt receiveEventIds = 0;
+Semaphore_Handle receivedSem;
+
+// receiverStart() queue: serviceInterrupt() stores at gQueueHead, receive()
+// takes from gQueueTail. RECEIVE_QUEUE_SIZE must be a power of two for the
+// indexes to wrap around.
+struct sQueuedStream
+{
+  struct sDataStream stream;
+  uint8_t dataField[CC1101_RXFIFO_SIZE - 3];  // FIFO less length, RSSI, LQI
+};
+struct sQueuedStream gQueue[RECEIVE_QUEUE_SIZE];
+volatile uint8_t gQueueHead = 0;
+volatile uint8_t gQueueTail = 0;
+volatile unsigned long gQueueDropped = 0;
+volatile unsigned long gQueueCrcErrors = 0;
+volatile boolean gReceiving = false;
+Semaphore_Handle queueSem;
+
+// transmitAsync() queue: transmitAsync() adds at gTxHead, serviceInterrupt()
+// sends and completes from gTxTail. Both run with mygate entered.
+struct sQueuedTransmit
+{
+  uint8_t address;
+  uint8_t length;
+  uint8_t dataField[CC1101_TXFIFO_SIZE - 2];  // FIFO less length, address
+  transmitCallback_t callback;
+  void *arg;
+};
+struct sQueuedTransmit gTxQueue[TRANSMIT_QUEUE_SIZE];
+uint8_t gTxHead = 0;
+uint8_t gTxTail = 0;
+boolean gTxQueued = false;  // the data stream on air is gTxQueue[gTxTail]
+
+// wakeOnRadio() state: the radio polls on its own, or the radio task opens
+// a SNIFF_WINDOW every gSniffPeriod ms
+#define A110LR09_XOSC_KHZ  27000  // A110LR09 crystal
+boolean gWakeOnRadio = false;
+uint16_t gSniffPeriod = 0;
+boolean gSniffListening = false;
+volatile boolean gServiceKick = false;  // sem posted to retime, not an EOP
+
+/**
+ *  msToTicks - Semaphore_pend() timeout for a period in milliseconds, 0 for
+ *  no limit.
+ */
+static UInt32 msToTicks(uint16_t timeout)
+{
+  if (timeout == 0)
+  {
+    return BIOS_WAIT_FOREVER;
+  }
+  return ((UInt32)timeout * 1000 + Clock_tickPeriod - 1) / Clock_tickPeriod;
+}
+
+// ----------------------------------------------------------------------------
+/**
+ *  Public interface
+ */
+
+void A110x2500Radio::begin(uint8_t address, channel_t channel, power_t power)
+{
+  gDataTransmitting = false;
+  gDataReceived = false;
+  Task_Params taskParams;
+  Error_Block eb;
+  Error_init(&eb);
+  GateMutex_construct(&mygate, NULL);
+
+  sem = Semaphore_create(0, NULL, &eb);
+  receivedSem = Semaphore_create(0, NULL, &eb);
+  queueSem = Semaphore_create(0, NULL, &eb);
+  // Configure the radio and set the default address, channel, and TX power.
+  A110LR09Init(&gPhyInfo, &gSpi, gGdo);
+  setAddress(address);
+  setChannel(channel);
+  setPower(power);
+
+  Task_Params_init(&taskParams);
+  taskParams.priority = Task_numPriorities - 1;
+
+  taskParams.stackSize = 0x800;
+  Task_create(serviceInterrupt, &taskParams, &eb);
+
+  attachInterrupt(RF_GDO0, gdo0Isr, FALLING);
+  sleep();
+}
+
+void A110x2500Radio::end()
+{
+  // Wait until all operations complete.
+  while (busy());
+
+  detachInterrupt(RF_GDO0);
+  pinMode (RF_SPI_CSN, INPUT);
+}
+
+boolean A110x2500Radio::busy()
+{
+  if (gDataTransmitting)
+  {
+    return true;
+  }
+  return false;
+}
+
+void A110x2500Radio::setAddress(uint8_t address)
+{
+  struct sA110LR09PhyInfo *phyInfo = &gPhyInfo;
+  A110LR09SetAddr(phyInfo, address);
+}
+
+void A110x2500Radio::setChannel(channel_t channel)
+{
+  struct sA110LR09PhyInfo *phyInfo = &gPhyInfo;
+  A110LR09SetChannr(phyInfo, channel);
+}
+
+void A110x2500Radio::setPower(power_t power)
+{
+  unsigned char paTable[A110LR09_PA_TABLE_SIZE];
+  memset(paTable, power, A110LR09_PA_TABLE_SIZE);
+  A110LR09SetPaTable(&gPhyInfo, paTable);
+}
+
+int8_t A110x2500Radio::getRssi()
+{
+  int8_t rssi = Radio._dataStream.rssi;
+  Radio._dataStream.rssi = (int16_t)(A110LR09ConvertRssiToDbm(&gPhyInfo, rssi) + 1) >> 1;
+  return Radio._dataStream.rssi;
+}
+
+uint8_t A110x2500Radio::getLqi()
+{
+  return (Radio._dataStream.status & 0x7F);
+}
+
+uint8_t A110x2500Radio::getCrcBit()
+{
+  return ((Radio._dataStream.status & 0x80) >> 7);
+}
+
+void A110x2500Radio::transmit(uint8_t address,
+															uint8_t *dataField,
+															uint8_t length)
+{
+  if (!busy())
+  {
+    // Bring the radio out of a low power state.
+    wakeup();
+
+    // Set the transmit buffer.
+    Radio._dataStream.length = 0;
+    Radio._dataStream.address = 0;
+    Radio._dataStream.dataField = dataField;
+
+    // Build and transmit a data stream.
+    CC1101Idle(&gPhyInfo.cc1101);
+    buildDataStream(address, Radio._dataStream.dataField, length);
+    CC1101Transmit(&gPhyInfo.cc1101);
+    gDataTransmitting = true;
+  }
+}
+
+uint8_t A110x2500Radio::listen(uint8_t *dataField, uint8_t length)
+{
+  if (busy() || gReceiving)
+  {
+    return false;
+  }
+
+  // Bring the radio out of a low power state.
+  wakeup();
+
+  // Set the receive buffer.
+  Radio._dataStream.length = 0;
+  Radio._dataStream.address = 0;
+  Radio._dataStream.dataField = dataField;
+  gDataReceived = false;
+
+  // Listen until a data stream comes; serviceInterrupt() stores it.
+  CC1101Idle(&gPhyInfo.cc1101);
+  CC1101FlushRxFifo(&gPhyInfo.cc1101);
+  CC1101ReceiverOn(&gPhyInfo.cc1101);
+  return true;
+}
+
+unsigned char A110x2500Radio::received(void)
+{
+  if (!gDataReceived)
+  {
+    return 0;
+  }
+  gDataReceived = false;
+  return Radio._dataStream.length;
+}
+
+void A110x2500Radio::setReceiveEvent(Event_Handle event, UInt eventIds)
+{
+  unsigned int key = Hwi_disable();
+
+  receiveEvent = event;
+  receiveEventIds = eventIds;
+  Hwi_restore(key);
+}
+
+unsigned char A110x2500Radio::receiverOn(uint8_t *dataField,
+																				 uint8_t length,
+																				 uint16_t timeout)
+{
+  if (!busy() && !gReceiving)
+  {
+    // Bring the radio out of a low power state.
+    wakeup();
+    
+    // Set the receive buffer.
+    Radio._dataStream.length = 0;
+    Radio._dataStream.address = 0;
+    Radio._dataStream.dataField = dataField;
+    gDataReceived = false;
+    Semaphore_reset(receivedSem, 0);
+
+    // Listen for a data stream.
+    CC1101Idle(&gPhyInfo.cc1101);
+    CC1101FlushRxFifo(&gPhyInfo.cc1101);
+    CC1101ReceiverOn(&gPhyInfo.cc1101);
+    
+    // Sleep for at most the timeout period, forever if 0, or until
+    // serviceInterrupt() has stored a message.
+    if (Semaphore_pend(receivedSem, msToTicks(timeout)) && gDataReceived)
+    {
+      gDataReceived = false;
+      return Radio._dataStream.length;
+    }
+  }
+  
+  return 0;    // No data stream received
+}
+
+uint8_t A110x2500Radio::receiverStart(void)
+{
+  if (busy())
+  {
+    return false;
+  }
+
+  // Bring the radio out of a low power state.
+  wakeup();
+
+  for (uint8_t i = 0; i < RECEIVE_QUEUE_SIZE; i++)
+  {
+    gQueue[i].stream.dataField = gQueue[i].dataField;
+  }
+  gReceiving = true;
+  receiverRestart();
+  return true;
+}
+
+uint8_t A110x2500Radio::wakeOnRadio(uint16_t period)
+{
+  if (period == 0)
+  {
+    receiverStop();
+    return true;
+  }
+  if (busy())
+  {
+    return false;
+  }
+
+  // Event0 in 750 / fXOSC periods, coarser resolutions for long periods.
+  uint32_t event0 = (uint32_t)period * A110LR09_XOSC_KHZ / 750;
+  uint8_t worRes = 0;
+  while (event0 > 0xFFFF && worRes < 3)
+  {
+    event0 >>= 5;
+    worRes++;
+  }
+  if (event0 > 0xFFFF)
+  {
+    event0 = 0xFFFF;
+  }
+
+  GateMutex_enter(GateMutex_handle(&mygate));
+
+  // Bring the radio out of a low power state.
+  wakeup();
+
+  for (uint8_t i = 0; i < RECEIVE_QUEUE_SIZE; i++)
+  {
+    gQueue[i].stream.dataField = gQueue[i].dataField;
+  }
+  gReceiving = true;
+  gSniffListening = false;
+
+  if (CC1101SetWakeOnRadio(&gPhyInfo.cc1101, event0, worRes, 0))
+  {
+    gWakeOnRadio = true;
+    gSniffPeriod = 0;
+  }
+  else
+  {
+    gWakeOnRadio = false;
+    gSniffPeriod = (period > SNIFF_WINDOW) ? period : SNIFF_WINDOW + 1;
+
+    // Have serviceInterrupt() take up the timing of the windows.
+    gServiceKick = true;
+    Semaphore_post(sem);
+  }
+  receiverResume();
+
+  GateMutex_leave(GateMutex_handle(&mygate), 0);
+  return true;
+}
+
+void A110x2500Radio::receiverStop(void)
+{
+  // Not while serviceInterrupt() is reading a message.
+  GateMutex_enter(GateMutex_handle(&mygate));
+  gReceiving = false;
+  gWakeOnRadio = false;
+  gSniffPeriod = 0;
+  gSniffListening = false;
+  wakeup();
+  CC1101Idle(&gPhyInfo.cc1101);
+  sleep();
+  GateMutex_leave(GateMutex_handle(&mygate), 0);
+}
+
+unsigned char A110x2500Radio::receive(uint8_t *dataField,
+                                      uint8_t length,
+                                      uint16_t timeout)
+{
+  if (!Semaphore_pend(queueSem, msToTicks(timeout)))
+  {
+    return 0;
+  }
+
+  struct sDataStream *stream = &gQueue[gQueueTail % RECEIVE_QUEUE_SIZE].stream;
+  uint8_t count = stream->length - 1;
+
+  if (count > length)
+  {
+    count = length;
+  }
+  memcpy(dataField, stream->dataField, count);
+
+  // Make it the last received data stream for getRssi() and the like.
+  Radio._dataStream.length = stream->length;
+  Radio._dataStream.address = stream->address;
+  Radio._dataStream.dataField = dataField;
+  Radio._dataStream.rssi = stream->rssi;
+  Radio._dataStream.status = stream->status;
+
+  // Hand the entry back to serviceInterrupt().
+  gQueueTail = gQueueTail + 1;
+  return Radio._dataStream.length;
+}
+
+uint8_t A110x2500Radio::available(void)
+{
+  return (uint8_t)(gQueueHead - gQueueTail);
+}
+
+unsigned long A110x2500Radio::dropped(void)
+{
+  return gQueueDropped;
+}
+
+unsigned long A110x2500Radio::crcErrors(void)
+{
+  return gQueueCrcErrors;
+}
+
+uint8_t A110x2500Radio::transmitAsync(uint8_t address,
+                                      uint8_t *dataField,
+                                      uint8_t length,
+                                      transmitCallback_t callback,
+                                      void *arg)
+{
+  GateMutex_enter(GateMutex_handle(&mygate));
+
+  if ((uint8_t)(gTxHead - gTxTail) >= TRANSMIT_QUEUE_SIZE)
+  {
+    GateMutex_leave(GateMutex_handle(&mygate), 0);
+    return false;
+  }
+
+  struct sQueuedTransmit *entry = &gTxQueue[gTxHead % TRANSMIT_QUEUE_SIZE];
+  if (length > sizeof(entry->dataField))
+  {
+    length = sizeof(entry->dataField);
+  }
+  entry->address = address;
+  entry->length = length;
+  memcpy(entry->dataField, dataField, length);
+  entry->callback = callback;
+  entry->arg = arg;
+  gTxHead = gTxHead + 1;
+
+  // Otherwise serviceInterrupt() starts it after the one on air.
+  if (!busy())
+  {
+    transmitNext();
+  }
+
+  GateMutex_leave(GateMutex_handle(&mygate), 0);
+  return true;
+}
+
+// ----------------------------------------------------------------------------
+/**
+ *  Private interface
+ */
+
+void A110x2500Radio::wakeup()
+{
+  struct sA110LR09PhyInfo *phyInfo = &gPhyInfo;
+  
+  // Wakeup and write registers that aren't retained in low power mode.
+  A110LR09Wakeup(phyInfo);
+}
+
+void A110x2500Radio::sleep()
+{
+  CC1101Sleep(&gPhyInfo.cc1101);
+}
+
+void A110x2500Radio::buildDataStream(uint8_t address, 
+                                     uint8_t *dataField, 
+                                     uint8_t length)
+{
+  uint8_t frame[CC1101_TXFIFO_SIZE];
+
+  /**
+   *  Note: The length of the data stream is the address and the data field. 
+   *  Length does not include itself into the total! The address is required
+   *  as this physical implementation uses this for filtering. The broadcast
+   *  addresse may be used at any time (0x00).
+   */
+  if (length > CC1101_TXFIFO_SIZE - 2)
+  {
+    length = CC1101_TXFIFO_SIZE - 2;
+  }
+  Radio._dataStream.length = length + 1;  // Include address
+  Radio._dataStream.address = address;
+  Radio._dataStream.dataField = dataField;
+
+  // Length, address and data fields, written to the TX FIFO in one burst.
+  frame[0] = Radio._dataStream.length;
+  frame[1] = Radio._dataStream.address;
+  memcpy(&frame[2], dataField, length);
+
+  // Flush the TX FIFO before writing any new data to it.
+  CC1101FlushTxFifo(&gPhyInfo.cc1101);
+  CC1101WriteTxFifo(&gPhyInfo.cc1101, frame, length + 2);
+}
+
+void A110x2500Radio::receiverRestart(void)
+{
+  CC1101Idle(&gPhyInfo.cc1101);
+  CC1101FlushRxFifo(&gPhyInfo.cc1101);
+  CC1101ReceiverOn(&gPhyInfo.cc1101);
+}
+
+void A110x2500Radio::receiverResume(void)
+{
+  if (gWakeOnRadio)
+  {
+    wakeup();
+    CC1101WakeOnRadio(&gPhyInfo.cc1101);
+  }
+  else if (gSniffPeriod != 0)
+  {
+    // Asleep until the next window.
+    sleep();
+  }
+  else
+  {
+    receiverRestart();
+  }
+}
+
+void A110x2500Radio::transmitNext(void)
+{
+  struct sQueuedTransmit *entry = &gTxQueue[gTxTail % TRANSMIT_QUEUE_SIZE];
+
+  // Bring the radio out of a low power state.
+  wakeup();
+
+  // Build and transmit a data stream; the GDO0 End-of-Packet completes it.
+  gTxQueued = true;
+  gDataTransmitting = true;
+  CC1101Idle(&gPhyInfo.cc1101);
+  buildDataStream(entry->address, entry->dataField, entry->length);
+  CC1101Transmit(&gPhyInfo.cc1101);
+}
+
+void A110x2500Radio::readDataStream(struct sDataStream *stream)
+{
+  uint8_t frame[CC1101_RXFIFO_SIZE];
+
+  // Read the whole RX FIFO in one burst: length, address, data field, then
+  // the RSSI and CRC/LQI status appended by the radio.
+  unsigned char rxBytes = CC1101ReadRxFifo(&gPhyInfo.cc1101, 
+                                           frame, 
+                                           CC1101_RXFIFO_SIZE);
+  
+  // Check if the RX FIFO holds a whole data stream. If not, a bogus
+  // interrupt has occurred and the RX FIFO does not have any useful data.
+  if ((rxBytes > 0) && (frame[0] > 0) && (frame[0] + 3 <= rxBytes))
+  {
+    stream->length = frame[0];
+    stream->address = frame[1];
+    memcpy(stream->dataField, &frame[2], frame[0] - 1);
+    stream->rssi = (int8_t)frame[frame[0] + 1];
+    stream->status = frame[frame[0] + 2];
+  }
+  else
+  {
+    stream->length = 0;
+  }
+}
+
+xdc_Void A110x2500Radio::serviceInterrupt(xdc_UArg arg0, xdc_UArg arg1) {
+  while(1) {
+    // A transmission gets TRANSMIT_TIMEOUT to signal its End-of-Packet, and
+    // wakeOnRadio() on a CC110L opens and closes its windows on time outs.
+    UInt32 timeout = BIOS_WAIT_FOREVER;
+    if (gDataTransmitting)
+    {
+      timeout = msToTicks(TRANSMIT_TIMEOUT);
+    }
+    else if (gSniffPeriod != 0)
+    {
+      timeout = msToTicks(gSniffListening ? SNIFF_WINDOW : gSniffPeriod - SNIFF_WINDOW);
+    }
+    Bool eop = Semaphore_pend(sem, timeout);
+    transmitCallback_t callback = NULL;
+    void *callbackArg = NULL;
+
+    GateMutex_enter(GateMutex_handle(&mygate));
+
+    // Note: It is assumed that interrupts are disabled.
+
+    // The GDO0 ISR will only look for the EOP edge. Therefore, if the radio
+    // is not transmitting the EOP, it must be receiving an EOP signal.
+    if (gDataTransmitting)
+    {
+      /**
+       *  Note: GDO0 is issued prior to the transmitter being completely
+       *  finished. The state machine remains in TX_END for a short while;
+       *  the SIDLE strobe of sleep(), receiverRestart() or transmitNext()
+       *  takes it from there, so MARCSTATE is not polled.
+       */ 
+      if (!eop)
+      {
+        // No End-of-Packet: drop whatever is left in the TX FIFO.
+        CC1101Idle(&gPhyInfo.cc1101);
+        CC1101FlushTxFifo(&gPhyInfo.cc1101);
+      }
+      gDataTransmitting = false;
+
+      if (gTxQueued)
+      {
+        struct sQueuedTransmit *entry = &gTxQueue[gTxTail % TRANSMIT_QUEUE_SIZE];
+        callback = entry->callback;
+        callbackArg = entry->arg;
+        gTxQueued = false;
+        gTxTail = gTxTail + 1;
+      }
+    }
+    else if (!eop || gServiceKick)
+    {
+      gServiceKick = false;
+      if (gSniffPeriod == 0)
+      {
+        // Nothing to time.
+      }
+      else if (!gSniffListening)
+      {
+        // Open the window.
+        wakeup();
+        receiverRestart();
+        gSniffListening = true;
+      }
+      else if (!digitalRead(RF_GDO0))
+      {
+        // No sync word in the window: close it. Otherwise GDO0 is asserted
+        // until the End-of-Packet of the message being received.
+        gSniffListening = false;
+      }
+    }
+    else if (gReceiving)
+    {
+      uint8_t head = gQueueHead;
+      struct sDataStream *stream = &gQueue[head % RECEIVE_QUEUE_SIZE].stream;
+
+      // Out of the wake-on-radio polling sequence to read the RX FIFO.
+      wakeup();
+      gSniffListening = false;
+
+      // A full queue keeps its messages; receiverResume() flushes the new one.
+      if ((uint8_t)(head - gQueueTail) >= RECEIVE_QUEUE_SIZE)
+      {
+        gQueueDropped++;
+      }
+      else
+      {
+        readDataStream(stream);
+        // The radio has checked the CRC as the data stream came in; one that
+        // failed is not queued, so receive() only gets intact messages.
+        if ((stream->length > 0) && !(stream->status & 0x80))
+        {
+          gQueueCrcErrors++;
+        }
+        else if (stream->length > 0)
+        {
+          gQueueHead = head + 1;
+          Semaphore_post(queueSem);
+          if (receiveEvent != NULL)
+          {
+            Event_post(receiveEvent, receiveEventIds);
+          }
+        }
+      }
+    }
+    else
+    {
+      readDataStream(&Radio._dataStream);
+      gDataReceived = true;
+      Semaphore_post(receivedSem);
+      if (receiveEvent != NULL)
+      {
+        Event_post(receiveEvent, receiveEventIds);
+      }
+    }
+
+    // Send the next queued data stream, else go back to sleep, or straight
+    // back to receiving for receiverStart() and wakeOnRadio().
+    if (gTxHead != gTxTail)
+    {
+      transmitNext();
+    }
+    else if (gSniffListening)
+    {
+      // The wakeOnRadio() window stays open.
+    }
+    else if (gReceiving)
+    {
+      receiverResume();
+    }
+    else
+    {
+      sleep();
+    }
+    GateMutex_leave(GateMutex_handle(&mygate), 0);
+
+    if (callback != NULL)
+    {
+      callback(callbackArg, eop);
+    }
+  }
+}
+
+void A110x2500Radio::gdo0Isr()
+{
+  Semaphore_post(sem);
+}
@@ -28,6 +28,7 @@
 #include <inttypes.h>
 #include <xdc/std.h>
 #include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/knl/Event.h>
 #include <ti/sysbios/BIOS.h>
 #include <xdc/runtime/Error.h>
 #include <ti/sysbios/gates/GateMutex.h>
@@ -49,6 +50,25 @@ struct sDataStream
 // Address aliases
 #define ADDRESS_BROADCAST  0x00
 
+// Data streams receiverStart() queues until receive() takes them
+#define RECEIVE_QUEUE_SIZE  4
+
+// Data streams transmitAsync() queues until they are sent
+#define TRANSMIT_QUEUE_SIZE  4
+
+// Milliseconds after which a transmission without End-of-Packet has failed
+#define TRANSMIT_TIMEOUT  100
+
+// Milliseconds wakeOnRadio() listens per period on a CC110L: enough for the
+// calibration, preamble and sync word at the configured data rate
+#define SNIFF_WINDOW  5
+
+/**
+ *  transmitCallback_t - called from the radio task when a data stream queued
+ *  by transmitAsync() has been sent (true) or has failed (false).
+ */
+typedef void (*transmitCallback_t)(void *arg, uint8_t sent);
+
 /**
  *  eChannel - frequency (channel).
  *
@@ -173,6 +193,26 @@ public:
    */
   static void transmit(uint8_t address, uint8_t *dataField, uint8_t length);
 
+  /**
+   *  transmitAsync - queue a data stream, as transmit() builds it, and return
+   *  at once. Queued data streams are sent one after the other by the radio
+   *  task, each as soon as the End-of-Packet of the previous one.
+   *
+   *    @param  address     The device address of the receiving node.
+   *    @param  dataField   Payload for the data stream, copied into the queue.
+   *    @param  length      Number of bytes in the data field buffer.
+   *    @param  callback    Called once the data stream is sent or has failed;
+   *                        NULL for none.
+   *    @param  arg         Passed to callback.
+   *
+   *    @return	False (0) if the queue is full; true otherwise.
+   */
+  static uint8_t transmitAsync(uint8_t address,
+                               uint8_t *dataField,
+                               uint8_t length,
+                               transmitCallback_t callback = NULL,
+                               void *arg = NULL);
+
   /**
    *  receiverOn - turn on the radio receiver and listen until a timeout occurs.
    *  
@@ -192,6 +232,99 @@ public:
 																	uint8_t length,
 																	uint16_t timeout);
 
+  /**
+   *  listen - turn on the radio receiver and return at once. The data field
+   *  of the next message received is stored in dataField, then the receive
+   *  event is posted and received() returns its length.
+   *
+   *    @param	dataField   Buffer that stores the data field, as for
+   *                        receiverOn().
+   *	  @param	length      Size of the data field buffer in bytes.
+   *
+   *    @return	False (0) if the radio is busy transmitting; true otherwise.
+   */
+  static uint8_t listen(uint8_t *dataField, uint8_t length);
+
+  /**
+   *  received - check for a message received since listen().
+   *
+   *    @return	Number of bytes in the data field, 0 if none came yet.
+   */
+  static unsigned char received(void);
+
+  /**
+   *  setReceiveEvent - post eventIds to event each time a message has been
+   *  received, so a task can wait for it along with other sources.
+   *
+   *    @param  event     Event to post to, NULL to stop posting.
+   *    @param  eventIds  Event bits posted.
+   */
+  static void setReceiveEvent(Event_Handle event, UInt eventIds);
+
+  /**
+   *  receiverStart - keep the radio receiver on. Each message received is
+   *  queued with its RSSI and CRC/LQI status, up to RECEIVE_QUEUE_SIZE, and
+   *  the receiver is turned back on at once. Messages that fail the radio's
+   *  CRC check are not queued, see crcErrors(). listen() and receiverOn() do
+   *  nothing until receiverStop().
+   *
+   *    @return	False (0) if the radio is busy transmitting; true otherwise.
+   */
+  static uint8_t receiverStart(void);
+
+  /**
+   *  wakeOnRadio - listen with a low duty cycle. The receiver is only on for
+   *  a short while every period and the radio sleeps in between; messages
+   *  are queued as for receiverStart(). A CC1101 times this on its own RC 
+   *  oscillator (wake-on-radio), so the MCU sleeps until a message comes. 
+   *  The CC110L of the A110LR09 has no such timer: the radio task turns the
+   *  receiver on for SNIFF_WINDOW every period instead. Either way, senders
+   *  must repeat a message for longer than period to be heard.
+   *
+   *    @param  period    Milliseconds between two receive windows; 0 stops 
+   *                      as receiverStop().
+   *
+   *    @return	False (0) if the radio is busy transmitting; true otherwise.
+   */
+  static uint8_t wakeOnRadio(uint16_t period);
+
+  /**
+   *  receiverStop - stop queuing messages, and wakeOnRadio(), and put the
+   *  radio to sleep. Queued messages can still be taken with receive().
+   */
+  static void receiverStop(void);
+
+  /**
+   *  receive - take the oldest queued message, waiting for one if the queue
+   *  is empty. getRssi(), getLqi() and getCrcBit() then refer to it.
+   *
+   *    @param	dataField   Buffer that stores the data field.
+   *	  @param	length      Size of the data field buffer in bytes; the rest of
+   *                        a longer data field is dropped.
+   *	  @param	timeout     Period to wait for (maximum) in milliseconds, 0 to
+   *                        wait until a message comes.
+   *
+   *    @return Length of the data stream as for receiverOn(), 0 on timeout.
+   */
+  static unsigned char receive(uint8_t *dataField,
+                               uint8_t length,
+                               uint16_t timeout = 0);
+
+  /**
+   *  available - number of queued messages receive() returns at once.
+   */
+  static uint8_t available(void);
+
+  /**
+   *  dropped - number of messages received while the queue was full.
+   */
+  static unsigned long dropped(void);
+
+  /**
+   *  crcErrors - number of messages not queued because their CRC was wrong.
+   */
+  static unsigned long crcErrors(void);
+
 // -----------------------------------------------------------------------------
 /**
  *  Private interface
@@ -218,9 +351,26 @@ private:
    
   /**
    *  readDataStream - strip off the physical radio header/footer information
-   *  and retrieve the data field.
+   *  and retrieve the data field into stream.
+   */
+  static void readDataStream(struct sDataStream *stream);
+
+  /**
+   *  receiverRestart - flush the RX FIFO and turn the receiver back on.
+   */
+  static void receiverRestart(void);
+
+  /**
+   *  receiverResume - back to receiving for receiverStart() or wakeOnRadio()
+   *  after a message. Called with the radio gate entered.
+   */
+  static void receiverResume(void);
+
+  /**
+   *  transmitNext - start sending the oldest data stream of the transmit
+   *  queue. Called with the radio gate entered.
    */
-  static void readDataStream(void);
+  static void transmitNext(void);
   
   /**
    *  gdo0Isr - GDO0 interrupt service routine. Issued when the End-of-Packet
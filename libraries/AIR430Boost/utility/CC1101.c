@@ -639,6 +639,54 @@ bool CC1101Sleep(struct sCC1101PhyInfo *phyInfo)
   return true;
 }
 
+bool CC1101SetWakeOnRadio(struct sCC1101PhyInfo *phyInfo,
+                          unsigned short event0,
+                          unsigned char worRes,
+                          unsigned char rxTime)
+{
+  enum eCC1101Chip chip = CC1101GetChip(phyInfo);
+  unsigned char worevt[2];
+
+  if (chip != eCC1101Chip1101 && chip != eCC1101Chip2500)
+  {
+    return false;
+  }
+
+  // Event0 period, then the RC oscillator kept on and calibrated, with the
+  // default Event1 crystal start-up time.
+  worevt[0] = event0 >> 8;
+  worevt[1] = event0 & 0xFF;
+  CC1101WriteRegisters(phyInfo, CC1101_REG_WOREVT1, worevt, 2);
+  CC1101SetRegister(phyInfo, 
+                    CC1101_REG_WORCTRL, 
+                    CC1101_EVENT1 | CC1101_RC_CAL | (worRes & CC1101_WOR_RES));
+  
+  // Sync word search timeout, cut short when no carrier is sensed.
+  CC1101SetRegister(phyInfo, 
+                    CC1101_REG_MCSM2, 
+                    CC1101_RX_TIME_RSSI | (rxTime & CC1101_RX_TIME));
+  
+  return true;
+}
+
+bool CC1101WakeOnRadio(struct sCC1101PhyInfo *phyInfo)
+{
+  if (!phyInfo->sleep)
+  {
+    // The polling sequence starts from IDLE, with the timer from Event1.
+    if (!CC1101SetAndVerifyState(phyInfo, CC1101_SIDLE, eCC1101MarcStateIdle))
+    {
+      return false;
+    }
+    CC1101FlushRxFifo(phyInfo);
+    CC1101ResetWakeOnRadio(phyInfo);
+    CC1101StartWakeOnRadio(phyInfo);
+    phyInfo->sleep = true;
+  }
+  
+  return true;
+}
+
 void CC1101Wakeup(struct sCC1101PhyInfo *phyInfo, 
                   const unsigned char agctest,
                   const unsigned char test[3],
@@ -1181,6 +1181,45 @@ bool CC1101Calibrate(struct sCC1101PhyInfo *phyInfo);
  */
 bool CC1101Sleep(struct sCC1101PhyInfo *phyInfo);
 
+/**
+ *  CC1101SetWakeOnRadio - configure the automatic RX polling sequence started
+ *  by CC1101WakeOnRadio. The radio sleeps, wakes up every Event0 period on its
+ *  RC oscillator and searches for a sync word for the RX_TIME part of the 
+ *  period. It goes back to sleep unless a packet comes, which leaves it in the
+ *  MCSM1.RXOFF_MODE state.
+ *
+ *  Note: The wake-on-radio timer is only present in the CC1101 (and CC2500). 
+ *  The CC110L has no RC oscillator; nothing is written to it.
+ *
+ *    @param  phyInfo CC1101 interface state information used by the interface
+ *                    for all chip interaction.
+ *    @param  event0  WOREVT1:WOREVT0. The period is 750 / fXOSC * event0 *
+ *                    2^(5 * worRes) seconds.
+ *    @param  worRes  WORCTRL.WOR_RES, 0 to 3.
+ *    @param  rxTime  MCSM2.RX_TIME, 0 (longest) to 6. RX is also left as soon
+ *                    as no carrier is sensed (MCSM2.RX_TIME_RSSI).
+ *
+ *    @return False if the chip has no wake-on-radio timer.
+ */
+bool CC1101SetWakeOnRadio(struct sCC1101PhyInfo *phyInfo,
+                          unsigned short event0,
+                          unsigned char worRes,
+                          unsigned char rxTime);
+
+/**
+ *  CC1101WakeOnRadio - start the RX polling sequence set by 
+ *  CC1101SetWakeOnRadio from IDLE with an empty RX FIFO.
+ *
+ *  Note: As for CC1101Sleep, the radio is between sleeps from then on, so the
+ *  driver blocks SPI read/write operations until CC1101Wakeup.
+ *
+ *    @param  phyInfo CC1101 interface state information used by the interface
+ *                    for all chip interaction.
+ *
+ *    @return Success of the operation.
+ */
+bool CC1101WakeOnRadio(struct sCC1101PhyInfo *phyInfo);
+
 /**
  *  CC1101Wakeup - bring the CC1101 out of a low power state into idle.
  *
@@ -26,10 +26,17 @@
  */
 #include "Platform.h"
 
+// CSn and MISO bit-band aliases, looked up once by A110x2500SpiInit().
+static FastPin gCsn;
+static FastPin gMiso;
+
 void A110x2500SpiInit()
 {
   // Setup CSn line.
   pinMode (RF_SPI_CSN, OUTPUT);
+  digitalWrite(RF_SPI_CSN, HIGH);
+  gCsn = fastPin(RF_SPI_CSN);
+  gMiso = fastPin(RF_SPI_MISO);
 
 #if defined(PART_TM4C1233H6PM) || defined (PART_LM4F120H5QR) || defined (PART_TM4C129XNCZAD) || defined (PART_TM4C1294NCPDT)
   // Select the correct SPI port to interface with AIR Booster Pack.
@@ -49,59 +56,63 @@ void A110x2500SpiInit()
   SPI.begin();
 }
 
+/**
+ *  A110x2500SpiBurst - one CSn frame of the address byte followed by count
+ *  bytes, exchanged in place in frame. The frame goes to the SPI driver in
+ *  as few transfers as RF_SPI_BURST allows, so a FIFO access is a single
+ *  DMA transaction.
+ */
+static void A110x2500SpiBurst(unsigned char *frame, unsigned int length)
+{
+  gCsn.low();
+
+  // Look for CHIP_RDYn from radio. The port input follows the pin while it
+  // is assigned to the EUSCI, so MISO is left to the SPI module.
+  while (gMiso.read());
+
+  SPI.transfer(frame, frame, length);
+
+  // Note: It is assumed that the Energia SPI driver waits until the EUSCI
+  // peripheral is done being busy before returning to the caller.
+
+  gCsn.high();
+}
+
 void A110x2500SpiRead(unsigned char address,
                       unsigned char *buffer,
                       unsigned char count)
 {
-  digitalWrite(RF_SPI_CSN,LOW);
-
-  // Look for CHIP_RDYn from radio.
-  pinMode(RF_SPI_MISO, INPUT);
-  while (digitalRead(RF_SPI_MISO));
-  MAP_GPIO_setAsPeripheralModuleFunctionInputPin(GPIO_PORT_P1, GPIO_PIN7, GPIO_PRIMARY_MODULE_FUNCTION);
-  SPI_enableModule(EUSCI_B0_BASE);
-  // Write the address/command byte.
-  SPI.transfer(address);
-  
-  // Write dummy byte(s) and read response(s).
-  for (unsigned char i = 0; i < count; i++)
+  unsigned char frame[RF_SPI_BURST];
+
+  // Longer reads are not issued by the driver: registers and FIFOs are
+  // at most 64 bytes.
+  if (count > RF_SPI_BURST - 1)
   {
-    buffer[i] = SPI.transfer(0x00);
+    count = RF_SPI_BURST - 1;
   }
 
-  // Note: It is assumed that the Energia SPI driver waits until the USCIB0
-  // peripheral is done being busy before returning to the caller.
-
-  digitalWrite(RF_SPI_CSN,HIGH);
-  SPI_disableModule(EUSCI_B0_BASE);
+  // Address/command byte, then dummy byte(s) clocking out the response(s).
+  frame[0] = address;
+  memset(&frame[1], 0, count);
+  A110x2500SpiBurst(frame, count + 1);
+  memcpy(buffer, &frame[1], count);
 }
 
 void A110x2500SpiWrite(unsigned char address,
                        const unsigned char *buffer,
                        unsigned char count)
 {
-  digitalWrite(RF_SPI_CSN,LOW);
-
-  // Look for CHIP_RDYn from radio.
-  pinMode(RF_SPI_MISO, INPUT);
-  while (digitalRead(RF_SPI_MISO));
-  MAP_GPIO_setAsPeripheralModuleFunctionInputPin(GPIO_PORT_P1, GPIO_PIN7, GPIO_PRIMARY_MODULE_FUNCTION);
-  SPI_enableModule(EUSCI_B0_BASE);
-  
-  // Write the address/command byte.
-  SPI.transfer(address);
-  
-  // Write dummy byte(s) and read response(s).
-  for (unsigned char i = 0; i < count; i++)
+  unsigned char frame[RF_SPI_BURST];
+
+  if (count > RF_SPI_BURST - 1)
   {
-    SPI.transfer(buffer[i]);
+    count = RF_SPI_BURST - 1;
   }
 
-  // Note: It is assumed that the Energia SPI driver waits until the USCIB0
-  // peripheral is done being busy before returning to the caller.
-
-  digitalWrite(RF_SPI_CSN,HIGH);
-  SPI_disableModule(EUSCI_B0_BASE);
+  // Address/command byte, then the data byte(s).
+  frame[0] = address;
+  memcpy(&frame[1], buffer, count);
+  A110x2500SpiBurst(frame, count + 1);
 }
 
 void A110x2500Gdo0Init()
@@ -28,9 +28,7 @@
  */
 #include <Energia.h>
 #include <SPI.h>
-#include <driverlib/rom_map.h>
-#include <driverlib/gpio.h>
-#include <driverlib/spi.h>
+#include <string.h>
 
 extern "C" { 
   #include "CC1101.h"
@@ -44,6 +42,9 @@ extern "C" {
 #define RF_GDO0       19
 #endif
 
+// Address byte plus the 64 byte TX/RX FIFO, the longest SPI frame.
+#define RF_SPI_BURST  65
+
 extern "C" void A110x2500SpiInit();
 extern "C" void A110x2500SpiRead(unsigned char address, unsigned char *buffer, unsigned char count);
 extern "C" void A110x2500SpiWrite(unsigned char address, const unsigned char *buffer, unsigned char count);
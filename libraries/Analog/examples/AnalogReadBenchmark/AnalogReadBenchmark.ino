@@ -0,0 +1,163 @@
+/*
+  Analog Read Benchmark
+
+  Times one sample of each of CHANNELS analog pins taken three ways and
+  prints the average time per sample in microseconds:
+
+    read    analogRead(), one ADC_convert() per call
+    pin     analogPinRead() on AnalogPins set up once with
+            analogPinBegin(), MEM0 load + trigger + wait + read
+    multi   analogReadMulti(), all pins as one ADC14 sequence
+
+  along with the speedup over analogRead() and the values of the last
+  round, which should agree between the three. It then compares a
+  software average of 2^OVERSAMPLE analogRead() calls with
+  analogReadOversampled() per averaged result. Times come from
+  Timestamp_get32().
+
+  Nothing needs to be connected; tie the pins to known voltages to
+  compare the values.
+
+  This example code is in the public domain.
+*/
+
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
+
+#define CHANNELS  4
+#define ROUNDS    1000
+#define OVERSAMPLE 8       // log2 of the samples averaged
+
+const uint8_t pins[CHANNELS] = { A0, A1, A2, A3 };
+
+AnalogPin analogPins[CHANNELS];
+uint16_t values[CHANNELS];
+
+float ticksPerUs;
+
+float timeRead(void)
+{
+  uint32_t start = Timestamp_get32();
+
+  for (int r = 0; r < ROUNDS; r++) {
+    for (int c = 0; c < CHANNELS; c++) {
+      values[c] = analogRead(pins[c]);
+    }
+  }
+
+  return (Timestamp_get32() - start) / ticksPerUs / ROUNDS / CHANNELS;
+}
+
+float timePin(void)
+{
+  uint32_t start = Timestamp_get32();
+
+  for (int r = 0; r < ROUNDS; r++) {
+    for (int c = 0; c < CHANNELS; c++) {
+      values[c] = analogPinRead(&analogPins[c]);
+    }
+  }
+
+  return (Timestamp_get32() - start) / ticksPerUs / ROUNDS / CHANNELS;
+}
+
+float timeMulti(void)
+{
+  uint32_t start = Timestamp_get32();
+
+  for (int r = 0; r < ROUNDS; r++) {
+    analogReadMulti(pins, values, CHANNELS);
+  }
+
+  return (Timestamp_get32() - start) / ticksPerUs / ROUNDS / CHANNELS;
+}
+
+float timeAverage(void)
+{
+  uint32_t start = Timestamp_get32();
+
+  for (int r = 0; r < ROUNDS / 10; r++) {
+    uint32_t sum = 0;
+
+    for (int i = 0; i < (1 << OVERSAMPLE); i++) {
+      sum += analogRead(pins[0]);
+    }
+    values[0] = sum >> OVERSAMPLE;
+  }
+
+  return (Timestamp_get32() - start) / ticksPerUs / (ROUNDS / 10);
+}
+
+float timeOversampled(void)
+{
+  uint32_t start = Timestamp_get32();
+
+  for (int r = 0; r < ROUNDS / 10; r++) {
+    values[0] = analogReadOversampled(pins[0], OVERSAMPLE);
+  }
+
+  return (Timestamp_get32() - start) / ticksPerUs / (ROUNDS / 10);
+}
+
+void report(const char *name, float us, float base)
+{
+  Serial.print(name);
+  Serial.print(" us/sample=");
+  Serial.print(us, 2);
+  Serial.print(" speedup=");
+  Serial.print(base / us, 1);
+  Serial.print(" values=");
+  for (int c = 0; c < CHANNELS; c++) {
+    Serial.print(values[c]);
+    Serial.print(c < CHANNELS - 1 ? "," : "");
+  }
+  Serial.println();
+}
+
+void setup()
+{
+  Types_FreqHz freq;
+
+  Serial.begin(115200);
+  delay(1000);
+
+  Timestamp_getFreq(&freq);
+  ticksPerUs = freq.lo / 1000000.0;
+
+  for (int c = 0; c < CHANNELS; c++) {
+    analogPinBegin(&analogPins[c], pins[c]);
+  }
+
+  Serial.print("analogRead benchmark, ");
+  Serial.print(CHANNELS);
+  Serial.println(" channels");
+}
+
+void loop()
+{
+  float read = timeRead();
+  report("read ", read, read);
+
+  float pin = timePin();
+  report("pin  ", pin, read);
+
+  float multi = timeMulti();
+  report("multi", multi, read);
+
+  float average = timeAverage();
+  Serial.print("average     us/result=");
+  Serial.print(average, 1);
+  Serial.print(" value=");
+  Serial.println(values[0]);
+
+  float oversampled = timeOversampled();
+  Serial.print("oversampled us/result=");
+  Serial.print(oversampled, 1);
+  Serial.print(" speedup=");
+  Serial.print(average / oversampled, 1);
+  Serial.print(" value=");
+  Serial.println(values[0]);
+
+  Serial.println();
+  delay(5000);
+}
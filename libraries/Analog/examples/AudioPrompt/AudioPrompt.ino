@@ -0,0 +1,62 @@
+/*
+  Audio Prompt
+
+  Plays a chime stored LZ4 compressed in flash with AudioPlayer, then
+  a sweep made in RAM, on a piezo buzzer or, through an RC low-pass
+  filter (1 kOhm, 100 nF), a small amplifier. The pin runs a PWM
+  carrier of its own at 32 kHz, four periods per 8 kHz sample, and a
+  task decompresses the clip half a buffer ahead of the uDMA.
+
+  chime_lz4.h was made with tools/audio_compress.py chime.wav
+  chime_lz4.h --lz4, from a mono 8 kHz WAV file.
+
+  Hardware: buzzer or filter on pin 19 (P2.5).
+
+  This example code is in the public domain.
+*/
+
+#include <AudioPlayer.h>
+#include "chime_lz4.h"
+
+#define AUDIO_PIN   19
+#define SWEEP_SIZE  4000
+
+AudioPlayer player;
+uint8_t sweep[SWEEP_SIZE];
+
+void setup()
+{
+  Serial.begin(115200);
+
+  if (!player.begin(AUDIO_PIN, CHIME_RATE)) {
+    Serial.println("no free timer for this pin");
+    for (;;);
+  }
+
+  // half a second from 200 Hz to 2 kHz, 8 bit unsigned
+  float phase = 0;
+  for (int i = 0; i < SWEEP_SIZE; i++) {
+    phase += 2 * PI * (200 + 1800.0 * i / SWEEP_SIZE) / CHIME_RATE;
+    sweep[i] = (uint8_t)(127.5 + 100 * sin(phase));
+  }
+}
+
+void loop()
+{
+  player.playCompressed(lz4_chime);
+  while (player.playing()) {
+    delay(10);
+  }
+
+  delay(500);
+
+  player.play(sweep, SWEEP_SIZE, 8);
+  while (player.playing()) {
+    delay(10);
+  }
+
+  Serial.print("underruns: ");
+  Serial.println(player.underruns());
+
+  delay(2000);
+}
@@ -0,0 +1,284 @@
+// chime, 4800 samples of 8 bits at 8000 Hz, 4429 bytes
+// Generated by audio_compress.py for AudioPlayer::playCompressed(lz4_chime)
+
+#define CHIME_RATE 8000
+
+static const uint8_t lz4_chime[] = {
+    0xc0, 0x12, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x03, 0x02, 0xf0, 0xff, 0xf2, 0x80, 0xa9, 0xbf,
+    0xb8, 0x98, 0x6c, 0x4a, 0x41, 0x54, 0x7c, 0xa5, 0xbe, 0xb9, 0x9b, 0x70, 0x4d, 0x41, 0x52, 0x78,
+    0xa2, 0xbc, 0xbb, 0x9e, 0x74, 0x4f, 0x41, 0x4f, 0x74, 0x9e, 0xba, 0xbc, 0xa2, 0x78, 0x52, 0x41,
+    0x4d, 0x70, 0x9b, 0xb9, 0xbc, 0xa5, 0x7c, 0x55, 0x42, 0x4b, 0x6d, 0x97, 0xb6, 0xbd, 0xa8, 0x80,
+    0x58, 0x43, 0x4a, 0x69, 0x93, 0xb4, 0xbd, 0xaa, 0x84, 0x5c, 0x44, 0x48, 0x66, 0x8f, 0xb2, 0xbd,
+    0xad, 0x88, 0x5f, 0x46, 0x47, 0x63, 0x8b, 0xaf, 0xbd, 0xaf, 0x8b, 0x63, 0x47, 0x46, 0x5f, 0x88,
+    0xac, 0xbd, 0xb1, 0x8f, 0x66, 0x49, 0x45, 0x5c, 0x84, 0xa9, 0xbc, 0xb3, 0x93, 0x6a, 0x4b, 0x45,
+    0x5a, 0x80, 0xa6, 0xbb, 0xb5, 0x96, 0x6d, 0x4d, 0x45, 0x57, 0x7c, 0xa3, 0xba, 0xb6, 0x99, 0x71,
+    0x50, 0x45, 0x55, 0x79, 0xa0, 0xb8, 0xb7, 0x9d, 0x75, 0x52, 0x45, 0x52, 0x75, 0x9c, 0xb7, 0xb8,
+    0xa0, 0x79, 0x55, 0x45, 0x50, 0x71, 0x99, 0xb5, 0xb9, 0xa2, 0x7c, 0x58, 0x46, 0x4f, 0x6e, 0x96,
+    0xb3, 0xb9, 0xa5, 0x80, 0x5b, 0x47, 0x4d, 0x6b, 0x92, 0xb1, 0xba, 0xa8, 0x84, 0x5e, 0x48, 0x4c,
+    0x67, 0x8e, 0xaf, 0xba, 0xaa, 0x87, 0x61, 0x49, 0x4b, 0x64, 0x8b, 0xac, 0xb9, 0xac, 0x8b, 0x64,
+    0x4b, 0x4a, 0x61, 0x87, 0xaa, 0xb9, 0xae, 0x8e, 0x68, 0x4d, 0x49, 0x5f, 0x84, 0xa7, 0xb8, 0xb0,
+    0x92, 0x6b, 0x4e, 0x48, 0x5c, 0x80, 0xa4, 0xb7, 0xb1, 0x95, 0x6f, 0x50, 0x48, 0x5a, 0x7c, 0xa1,
+    0xb6, 0xb3, 0x98, 0x72, 0x53, 0x48, 0x57, 0x79, 0x9e, 0xb5, 0xb4, 0x9b, 0x76, 0x55, 0x48, 0x55,
+    0x76, 0x9b, 0xb4, 0xb5, 0x9e, 0x79, 0x58, 0x49, 0x53, 0x72, 0x97, 0xb2, 0xb5, 0xa0, 0x7d, 0x5a,
+    0x49, 0x52, 0x6f, 0x94, 0xb0, 0xb6, 0xa3, 0x80, 0x5d, 0x4a, 0x50, 0x6c, 0x91, 0xae, 0xb6, 0xa5,
+    0x83, 0x60, 0x4b, 0x4f, 0x69, 0x8d, 0xac, 0xb6, 0xa7, 0x87, 0x63, 0x4d, 0x4e, 0x66, 0x8a, 0xaa,
+    0xb6, 0xa9, 0x8a, 0x66, 0x4e, 0x4d, 0x63, 0x87, 0xa7, 0xb5, 0xab, 0x8d, 0x69, 0x50, 0x4c, 0x61,
+    0x83, 0xa5, 0xb5, 0xad, 0x90, 0x6c, 0x51, 0x4c, 0x5e, 0x80, 0xa2, 0xb4, 0xae, 0x93, 0x70, 0x53,
+    0x4c, 0x5c, 0x7d, 0x9f, 0xb3, 0xb0, 0x96, 0x73, 0x55, 0x4c, 0x5a, 0x79, 0x9c, 0xb2, 0xb1, 0x99,
+    0x76, 0x58, 0x4c, 0x58, 0x76, 0x99, 0xb0, 0xb2, 0x9c, 0x79, 0x5a, 0x4c, 0x56, 0x73, 0x96, 0xaf,
+    0xb2, 0x9e, 0x7d, 0x5d, 0x4d, 0x54, 0x70, 0x93, 0xad, 0xb3, 0xa1, 0x80, 0x5f, 0x4e, 0x53, 0x6d,
+    0x90, 0xab, 0xb3, 0xa3, 0x83, 0x62, 0x4f, 0x52, 0x6a, 0x8d, 0xa9, 0xb3, 0xa5, 0x86, 0x65, 0x50,
+    0x51, 0x68, 0x89, 0xa7, 0xb3, 0xa7, 0x89, 0x68, 0x51, 0x50, 0x65, 0x86, 0xa5, 0xb2, 0xa9, 0x8d,
+    0x6b, 0x53, 0x4f, 0x63, 0x83, 0xa2, 0xb2, 0xaa, 0x8f, 0x6e, 0x54, 0x4f, 0x60, 0x80, 0xa0, 0xb1,
+    0xac, 0x92, 0x71, 0x56, 0x4f, 0x5e, 0x7d, 0x9d, 0xb0, 0xad, 0x95, 0x74, 0x58, 0x4f, 0x5c, 0x7a,
+    0x9a, 0xaf, 0xae, 0x98, 0x77, 0x5a, 0x4f, 0x5a, 0x77, 0x98, 0xae, 0xaf, 0x9a, 0x7a, 0x5c, 0x4f,
+    0x59, 0x74, 0x95, 0xac, 0xaf, 0x9d, 0x7d, 0x5f, 0x50, 0x57, 0x71, 0x92, 0xaa, 0xb0, 0x9f, 0x80,
+    0x61, 0x51, 0x56, 0x6e, 0x8f, 0xa9, 0xb0, 0xa1, 0x83, 0x64, 0x52, 0x55, 0x6c, 0x8c, 0xa7, 0xb0,
+    0xa3, 0x86, 0x66, 0x53, 0x54, 0x69, 0x89, 0xa5, 0xb0, 0xa5, 0x89, 0x69, 0x54, 0x53, 0x67, 0x86,
+    0xa2, 0xaf, 0xa6, 0x8c, 0x6c, 0x55, 0x52, 0x64, 0x83, 0xa0, 0xaf, 0xa8, 0x8f, 0x6f, 0x57, 0x52,
+    0x62, 0x80, 0x9e, 0xae, 0xa9, 0x91, 0x72, 0x59, 0x52, 0x60, 0x7d, 0x9b, 0xad, 0x03, 0x02, 0xf0,
+    0xff, 0xf2, 0xaa, 0x94, 0x74, 0x5a, 0x52, 0x5e, 0x7a, 0x99, 0xac, 0xab, 0x96, 0x77, 0x5c, 0x52,
+    0x5d, 0x77, 0x96, 0xab, 0xac, 0x99, 0x7a, 0x5f, 0x52, 0x5b, 0x75, 0x93, 0xa9, 0xac, 0x9b, 0x7d,
+    0x61, 0x53, 0x5a, 0x72, 0x91, 0xa8, 0xad, 0x9d, 0x80, 0x63, 0x53, 0x58, 0x6f, 0x8e, 0xa6, 0xad,
+    0x9f, 0x83, 0x65, 0x54, 0x57, 0x6d, 0x8b, 0xa4, 0xad, 0xa1, 0x86, 0x68, 0x55, 0x56, 0x6a, 0x88,
+    0xa2, 0xad, 0xa2, 0x88, 0x6b, 0x57, 0x56, 0x68, 0x86, 0xa0, 0xac, 0xa4, 0x8b, 0x6d, 0x58, 0x55,
+    0x66, 0x83, 0x9e, 0xac, 0xa5, 0x8e, 0x70, 0x59, 0x55, 0x64, 0x80, 0x9c, 0xab, 0xa6, 0x90, 0x72,
+    0x5b, 0x55, 0x62, 0x7d, 0x9a, 0xaa, 0xa8, 0x93, 0x75, 0x5d, 0x55, 0x60, 0x7b, 0x97, 0xa9, 0xa8,
+    0x95, 0x78, 0x5f, 0x55, 0x5f, 0x78, 0x95, 0xa8, 0xa9, 0x97, 0x7b, 0x61, 0x55, 0x5d, 0x75, 0x92,
+    0xa7, 0xaa, 0x99, 0x7d, 0x63, 0x56, 0x5c, 0x73, 0x90, 0xa5, 0xaa, 0x9b, 0x80, 0x65, 0x56, 0x5b,
+    0x70, 0x8d, 0xa4, 0xaa, 0x9d, 0x83, 0x67, 0x57, 0x5a, 0x6e, 0x8b, 0xa2, 0xaa, 0x9f, 0x85, 0x69,
+    0x58, 0x59, 0x6c, 0x88, 0xa0, 0xaa, 0xa0, 0x88, 0x6c, 0x59, 0x58, 0x6a, 0x85, 0x9e, 0xaa, 0xa2,
+    0x8a, 0x6e, 0x5a, 0x58, 0x68, 0x83, 0x9c, 0xa9, 0xa3, 0x8d, 0x71, 0x5c, 0x57, 0x66, 0x80, 0x9a,
+    0xa9, 0xa4, 0x8f, 0x73, 0x5d, 0x57, 0x64, 0x7d, 0x98, 0xa8, 0xa5, 0x91, 0x76, 0x5f, 0x57, 0x62,
+    0x7b, 0x96, 0xa7, 0xa6, 0x94, 0x78, 0x61, 0x57, 0x61, 0x78, 0x94, 0xa6, 0xa7, 0x96, 0x7b, 0x62,
+    0x58, 0x5f, 0x76, 0x91, 0xa5, 0xa7, 0x98, 0x7d, 0x64, 0x58, 0x5e, 0x74, 0x8f, 0xa3, 0xa7, 0x9a,
+    0x80, 0x66, 0x59, 0x5d, 0x71, 0x8c, 0xa2, 0xa8, 0x9b, 0x83, 0x69, 0x59, 0x5c, 0x6f, 0x8a, 0xa0,
+    0xa8, 0x9d, 0x85, 0x6b, 0x5a, 0x5b, 0x6d, 0x87, 0x9e, 0xa7, 0x9e, 0x87, 0x6d, 0x5b, 0x5b, 0x6b,
+    0x85, 0x9d, 0xa7, 0xa0, 0x8a, 0x6f, 0x5d, 0x5a, 0x69, 0x82, 0x9b, 0xa7, 0xa1, 0x8c, 0x72, 0x5e,
+    0x5a, 0x67, 0x80, 0x99, 0xa6, 0xa2, 0x8e, 0x74, 0x5f, 0x5a, 0x66, 0x7e, 0x97, 0xa5, 0xa3, 0x90,
+    0x76, 0x61, 0x5a, 0x64, 0x7b, 0x95, 0xa4, 0xa4, 0x92, 0x79, 0x63, 0x5a, 0x63, 0x79, 0x92, 0xa3,
+    0xa4, 0x94, 0x7b, 0x64, 0x5a, 0x61, 0x77, 0x90, 0xa2, 0xa5, 0x96, 0x7e, 0x66, 0x5b, 0x60, 0x74,
+    0x8e, 0xa1, 0xa5, 0x98, 0x80, 0x68, 0x5b, 0x5f, 0x72, 0x8c, 0xa0, 0xa5, 0x9a, 0x82, 0x6a, 0x5c,
+    0x5e, 0x70, 0x89, 0x9e, 0xa5, 0x9b, 0x85, 0x6c, 0x5d, 0x5d, 0x6e, 0x87, 0x9d, 0xa5, 0x9d, 0x87,
+    0x6e, 0x5e, 0x5d, 0x6c, 0x85, 0x9b, 0xa5, 0x9e, 0x89, 0x70, 0x5f, 0x5c, 0x6a, 0x82, 0x99, 0xa4,
+    0x9f, 0x8b, 0x73, 0x60, 0x5c, 0x69, 0x80, 0x97, 0xa4, 0xa0, 0x8d, 0x75, 0x61, 0x5c, 0x67, 0x7e,
+    0x95, 0xa3, 0xa1, 0x8f, 0x77, 0x63, 0x5c, 0x66, 0x7b, 0x93, 0xa2, 0xa1, 0x91, 0x79, 0x64, 0x5c,
+    0x64, 0x79, 0x91, 0xa1, 0xa2, 0x93, 0x7c, 0x66, 0x5c, 0x63, 0x77, 0x8f, 0xa0, 0xa2, 0x95, 0x7e,
+    0x68, 0x5d, 0x62, 0x75, 0x8d, 0x9f, 0xa3, 0x97, 0x80, 0x69, 0x5d, 0x61, 0x73, 0x8b, 0x9e, 0xa3,
+    0x98, 0x82, 0x6b, 0x5e, 0x60, 0x71, 0x89, 0x9c, 0xa3, 0x99, 0x84, 0x6d, 0x5f, 0x60, 0x6f, 0x87,
+    0x9b, 0xa3, 0x9b, 0x87, 0x6f, 0x60, 0x5f, 0x6d, 0x84, 0x99, 0xa3, 0x9c, 0x89, 0x71, 0x61, 0x5f,
+    0x6c, 0x82, 0x98, 0xa2, 0x9d, 0x8b, 0x73, 0x62, 0x5e, 0x6a, 0x80, 0x96, 0xa2, 0x9e, 0x8d, 0x75,
+    0x63, 0x5e, 0x69, 0x7e, 0x94, 0xa1, 0x9f, 0x8e, 0x78, 0x65, 0x5e, 0x67, 0x7c, 0x92, 0xa0, 0x9f,
+    0x90, 0x7a, 0x02, 0x02, 0xf0, 0xff, 0x28, 0x66, 0x5e, 0x66, 0x7a, 0x90, 0x9f, 0xa0, 0x92, 0x7c,
+    0x68, 0x5f, 0x65, 0x78, 0x8e, 0x9e, 0xa0, 0x94, 0x7e, 0x69, 0x5f, 0x64, 0x76, 0x8c, 0x9d, 0xa1,
+    0x95, 0x80, 0x6b, 0x5f, 0x63, 0x74, 0x8a, 0x9c, 0xa1, 0x97, 0x82, 0x6d, 0x60, 0x62, 0x72, 0x88,
+    0x9b, 0xa1, 0x98, 0x84, 0x6e, 0x61, 0x62, 0x70, 0x86, 0x99, 0xa1, 0x99, 0x86, 0x70, 0x62, 0x61,
+    0x6f, 0x84, 0x98, 0xa0, 0x9a, 0x88, 0x72, 0x63, 0x61, 0x6d, 0x82, 0x96, 0xa0, 0x9b, 0x8a, 0x74,
+    0x64, 0x60, 0x6b, 0x80, 0x94, 0xa0, 0x9c, 0x8c, 0x76, 0x65, 0x60, 0x6a, 0x7e, 0x93, 0x9f, 0x9d,
+    0x8e, 0x78, 0x66, 0x60, 0x69, 0x7c, 0x91, 0x9e, 0x9e, 0x8f, 0x7a, 0x68, 0x60, 0x68, 0x7a, 0x8f,
+    0x9d, 0x9e, 0x91, 0x7c, 0x69, 0x61, 0x67, 0x78, 0x8d, 0x9c, 0x9e, 0x92, 0x7e, 0x6b, 0x61, 0x66,
+    0x76, 0x8c, 0x9b, 0x9f, 0x94, 0x80, 0x6c, 0x61, 0x65, 0x75, 0x8a, 0x9a, 0x9f, 0x95, 0x82, 0x6e,
+    0x62, 0x64, 0x73, 0x88, 0x99, 0x9f, 0x96, 0x84, 0x6f, 0x63, 0x63, 0x71, 0x86, 0x98, 0x9f, 0x98,
+    0x86, 0x71, 0x64, 0x63, 0x70, 0x84, 0x96, 0x9e, 0x99, 0x88, 0x73, 0x64, 0x63, 0x6e, 0x82, 0x95,
+    0x9e, 0x9a, 0x89, 0x75, 0x65, 0x62, 0x6d, 0x80, 0xa3, 0xae, 0x9b, 0x7c, 0x67, 0x65, 0x71, 0x7c,
+    0x80, 0x83, 0x8d, 0x99, 0x9b, 0x89, 0x6b, 0x54, 0x59, 0x79, 0x9d, 0xad, 0xa0, 0x81, 0x69, 0x65,
+    0x6f, 0x7a, 0x7f, 0x82, 0x8a, 0x97, 0x9c, 0x8e, 0x70, 0x57, 0x57, 0x72, 0x97, 0xac, 0xa4, 0x87,
+    0x6d, 0x64, 0x6d, 0x79, 0x7f, 0x81, 0x88, 0x94, 0x9c, 0x92, 0x76, 0x5b, 0x55, 0x6c, 0x91, 0xaa,
+    0xa7, 0x8d, 0x70, 0x65, 0x6b, 0x77, 0x7e, 0x81, 0x86, 0x92, 0x9b, 0x95, 0x7c, 0x5f, 0x54, 0x66,
+    0x8a, 0xa7, 0xa9, 0x92, 0x75, 0x66, 0x69, 0x75, 0x7e, 0x80, 0x85, 0x8f, 0x9a, 0x97, 0x81, 0x64,
+    0x55, 0x61, 0x83, 0xa3, 0xaa, 0x97, 0x7a, 0x67, 0x68, 0x73, 0x7d, 0x80, 0x83, 0x8d, 0x98, 0x99,
+    0x86, 0x69, 0x56, 0x5d, 0x7d, 0x9e, 0xab, 0x9c, 0x7f, 0x69, 0x67, 0x71, 0x7b, 0x80, 0x82, 0x8b,
+    0x96, 0x9a, 0x8b, 0x6f, 0x58, 0x5a, 0x76, 0x99, 0xaa, 0xa0, 0x84, 0x6c, 0x66, 0x6d, 0x00, 0xf0,
+    0x11, 0x89, 0x94, 0x9a, 0x8f, 0x74, 0x5b, 0x58, 0x70, 0x93, 0xa9, 0xa3, 0x89, 0x6f, 0x66, 0x6d,
+    0x78, 0x7f, 0x81, 0x87, 0x92, 0x9a, 0x92, 0x7a, 0x5f, 0x57, 0x6a, 0x8d, 0xa6, 0xa6, 0x8e, 0x73,
+    0x67, 0x6d, 0x00, 0xf0, 0x38, 0x85, 0x90, 0x99, 0x95, 0x7f, 0x63, 0x57, 0x65, 0x86, 0xa3, 0xa7,
+    0x93, 0x78, 0x68, 0x6a, 0x75, 0x7d, 0x80, 0x84, 0x8d, 0x98, 0x97, 0x84, 0x68, 0x58, 0x61, 0x80,
+    0x9f, 0xa8, 0x98, 0x7c, 0x6a, 0x69, 0x73, 0x7c, 0x80, 0x83, 0x8b, 0x96, 0x98, 0x88, 0x6d, 0x59,
+    0x5e, 0x7a, 0x9a, 0xa8, 0x9c, 0x81, 0x6c, 0x68, 0x71, 0x7b, 0x7f, 0x82, 0x89, 0x94, 0x98, 0x8c,
+    0x72, 0x5c, 0x5b, 0x74, 0x95, 0xa7, 0x9f, 0x86, 0x6f, 0x68, 0x6f, 0x7a, 0x5b, 0x00, 0xc0, 0x98,
+    0x90, 0x77, 0x5f, 0x5a, 0x6e, 0x8f, 0xa5, 0xa2, 0x8b, 0x72, 0x68, 0x6d, 0x00, 0xf0, 0x11, 0x86,
+    0x90, 0x98, 0x92, 0x7c, 0x63, 0x59, 0x69, 0x89, 0xa2, 0xa4, 0x90, 0x76, 0x69, 0x6c, 0x76, 0x7e,
+    0x80, 0x84, 0x8e, 0x97, 0x94, 0x81, 0x67, 0x5a, 0x65, 0x83, 0x9f, 0xa5, 0x94, 0x7a, 0x6a, 0x6d,
+    0x00, 0xf0, 0x14, 0x83, 0x8b, 0x95, 0x96, 0x86, 0x6c, 0x5b, 0x61, 0x7d, 0x9b, 0xa6, 0x98, 0x7f,
+    0x6c, 0x6a, 0x73, 0x7c, 0x80, 0x82, 0x89, 0x94, 0x97, 0x8a, 0x71, 0x5d, 0x5f, 0x77, 0x96, 0xa5,
+    0x9c, 0x83, 0x6e, 0x69, 0x71, 0x7b, 0x00, 0x02, 0xf0, 0x5e, 0x7f, 0x81, 0x88, 0x92, 0x97, 0x8d,
+    0x76, 0x60, 0x5d, 0x72, 0x91, 0xa4, 0x9f, 0x88, 0x71, 0x69, 0x6f, 0x79, 0x7f, 0x81, 0x86, 0x90,
+    0x97, 0x90, 0x7a, 0x63, 0x5c, 0x6d, 0x8b, 0xa2, 0xa1, 0x8d, 0x75, 0x6a, 0x6e, 0x78, 0x7e, 0x80,
+    0x85, 0x8e, 0x96, 0x92, 0x7f, 0x67, 0x5c, 0x69, 0x86, 0x9f, 0xa3, 0x91, 0x79, 0x6b, 0x6c, 0x76,
+    0x7e, 0x80, 0x83, 0x8c, 0x95, 0x94, 0x83, 0x6b, 0x5c, 0x65, 0x80, 0x9b, 0xa3, 0x95, 0x7d, 0x6c,
+    0x6b, 0x74, 0x7d, 0x80, 0x82, 0x8a, 0x93, 0x95, 0x87, 0x6f, 0x5e, 0x62, 0x7a, 0x97, 0xa3, 0x99,
+    0x81, 0x6e, 0x6b, 0x73, 0x7c, 0x80, 0x82, 0x88, 0x92, 0x96, 0x8b, 0x74, 0x60, 0x60, 0x75, 0x92,
+    0xa2, 0x9c, 0x85, 0x71, 0x6a, 0x71, 0x7a, 0x5b, 0x00, 0xc0, 0x96, 0x8e, 0x78, 0x63, 0x5e, 0x70,
+    0x8d, 0xa1, 0x9e, 0x8a, 0x74, 0x6b, 0x6d, 0x00, 0xf0, 0x25, 0x85, 0x8e, 0x95, 0x90, 0x7d, 0x66,
+    0x5e, 0x6c, 0x88, 0x9e, 0xa0, 0x8e, 0x77, 0x6b, 0x6e, 0x77, 0x7e, 0x80, 0x84, 0x8c, 0x94, 0x92,
+    0x81, 0x6a, 0x5e, 0x68, 0x83, 0x9b, 0xa1, 0x92, 0x7b, 0x6d, 0x6d, 0x76, 0x7d, 0x80, 0x83, 0x8a,
+    0x93, 0x93, 0x85, 0x6e, 0x5f, 0x65, 0x7d, 0x98, 0xa1, 0x96, 0x7f, 0x6e, 0x6c, 0x74, 0x5b, 0x00,
+    0xf0, 0x10, 0x91, 0x94, 0x88, 0x72, 0x61, 0x63, 0x78, 0x93, 0xa1, 0x99, 0x83, 0x71, 0x6c, 0x73,
+    0x7b, 0x7f, 0x81, 0x87, 0x90, 0x94, 0x8c, 0x77, 0x63, 0x61, 0x74, 0x8f, 0xa0, 0x9b, 0x87, 0x73,
+    0x6c, 0x6d, 0x00, 0xf0, 0x48, 0x85, 0x8e, 0x94, 0x8e, 0x7b, 0x66, 0x60, 0x6f, 0x8a, 0x9e, 0x9d,
+    0x8b, 0x76, 0x6c, 0x70, 0x79, 0x7f, 0x80, 0x84, 0x8c, 0x93, 0x90, 0x7f, 0x6a, 0x60, 0x6b, 0x85,
+    0x9b, 0x9f, 0x8f, 0x7a, 0x6d, 0x6f, 0x77, 0x7e, 0x80, 0x83, 0x8a, 0x92, 0x92, 0x83, 0x6d, 0x61,
+    0x68, 0x80, 0x98, 0x9f, 0x93, 0x7d, 0x6f, 0x6e, 0x76, 0x7d, 0x80, 0x82, 0x89, 0x91, 0x93, 0x86,
+    0x71, 0x62, 0x65, 0x7b, 0x94, 0x9f, 0x96, 0x81, 0x70, 0x6d, 0x74, 0x7c, 0x80, 0x81, 0x87, 0x90,
+    0x93, 0x89, 0x75, 0x64, 0x64, 0x76, 0x90, 0x9e, 0x98, 0x85, 0x73, 0x6d, 0x6d, 0x00, 0xe0, 0x86,
+    0x8e, 0x93, 0x8c, 0x79, 0x66, 0x62, 0x72, 0x8c, 0x9d, 0x9b, 0x89, 0x75, 0x6d, 0x6d, 0x00, 0xf0,
+    0x11, 0x84, 0x8c, 0x93, 0x8e, 0x7d, 0x69, 0x62, 0x6e, 0x87, 0x9b, 0x9c, 0x8c, 0x78, 0x6e, 0x70,
+    0x78, 0x7e, 0x80, 0x83, 0x8b, 0x92, 0x90, 0x81, 0x6d, 0x62, 0x6b, 0x82, 0x98, 0x9d, 0x90, 0x7c,
+    0x6f, 0x6d, 0x00, 0xf0, 0x00, 0x82, 0x89, 0x91, 0x91, 0x84, 0x70, 0x63, 0x68, 0x7e, 0x95, 0x9d,
+    0x93, 0x7f, 0x70, 0x6f, 0x6d, 0x00, 0xf0, 0x11, 0x87, 0x8f, 0x92, 0x87, 0x74, 0x65, 0x66, 0x79,
+    0x91, 0x9d, 0x96, 0x83, 0x72, 0x6e, 0x74, 0x7c, 0x7f, 0x81, 0x86, 0x8e, 0x92, 0x8a, 0x78, 0x67,
+    0x65, 0x75, 0x8d, 0x9c, 0x98, 0x86, 0x75, 0x6e, 0x6d, 0x00, 0xf0, 0x12, 0x85, 0x8c, 0x92, 0x8c,
+    0x7c, 0x69, 0x64, 0x71, 0x89, 0x9a, 0x9a, 0x8a, 0x77, 0x6f, 0x72, 0x7a, 0x7f, 0x80, 0x84, 0x8b,
+    0x91, 0x8e, 0x7f, 0x6c, 0x64, 0x6e, 0x84, 0x98, 0x9b, 0x8d, 0x7a, 0x6f, 0x71, 0x6d, 0x00, 0xf0,
+    0x10, 0x89, 0x90, 0x90, 0x83, 0x70, 0x64, 0x6b, 0x80, 0x95, 0x9c, 0x90, 0x7d, 0x71, 0x70, 0x77,
+    0x7d, 0x80, 0x82, 0x88, 0x8f, 0x90, 0x86, 0x73, 0x65, 0x69, 0x7c, 0x92, 0x9c, 0x93, 0x81, 0x72,
+    0x6d, 0x00, 0xf0, 0x05, 0x81, 0x86, 0x8e, 0x91, 0x88, 0x77, 0x67, 0x67, 0x78, 0x8e, 0x9b, 0x96,
+    0x84, 0x74, 0x6f, 0x74, 0x7c, 0x7f, 0x81, 0x85, 0xf5, 0x01, 0xf0, 0x6d, 0x8c, 0x91, 0x8b, 0x7a,
+    0x69, 0x66, 0x74, 0x8a, 0x9a, 0x98, 0x88, 0x77, 0x6f, 0x73, 0x7b, 0x7f, 0x80, 0x84, 0x8b, 0x90,
+    0x8d, 0x7e, 0x6c, 0x65, 0x70, 0x86, 0x98, 0x99, 0x8b, 0x79, 0x70, 0x72, 0x79, 0x7f, 0x80, 0x83,
+    0x89, 0x90, 0x8e, 0x81, 0x6f, 0x66, 0x6d, 0x82, 0x95, 0x9a, 0x8e, 0x7c, 0x71, 0x71, 0x78, 0x7e,
+    0x80, 0x82, 0x88, 0x8f, 0x8f, 0x84, 0x72, 0x66, 0x6b, 0x7e, 0x92, 0x9a, 0x91, 0x7f, 0x72, 0x71,
+    0x77, 0x7d, 0x80, 0x81, 0x86, 0x8e, 0x90, 0x87, 0x75, 0x68, 0x69, 0x7a, 0x8f, 0x9a, 0x93, 0x82,
+    0x74, 0x70, 0x76, 0x7c, 0x80, 0x81, 0x85, 0x8c, 0x90, 0x89, 0x79, 0x6a, 0x68, 0x76, 0x8c, 0x99,
+    0x95, 0x86, 0x76, 0x70, 0x74, 0x7b, 0x7f, 0x81, 0x84, 0x8b, 0x90, 0x8b, 0x7c, 0x6c, 0x67, 0x73,
+    0x88, 0x97, 0x97, 0x89, 0x78, 0x71, 0x73, 0x7a, 0x5b, 0x00, 0xe0, 0x8f, 0x8d, 0x7f, 0x6f, 0x67,
+    0x70, 0x84, 0x95, 0x98, 0x8c, 0x7b, 0x71, 0x72, 0x79, 0x5b, 0x00, 0xd0, 0x8e, 0x8e, 0x82, 0x71,
+    0x68, 0x6d, 0x80, 0x93, 0x98, 0x8e, 0x7e, 0x72, 0x72, 0x6d, 0x00, 0xd1, 0x87, 0x8d, 0x8e, 0x85,
+    0x75, 0x69, 0x6b, 0x7c, 0x90, 0x98, 0x91, 0x81, 0x74, 0x6d, 0x00, 0xf0, 0x01, 0x85, 0x8c, 0x8f,
+    0x87, 0x78, 0x6a, 0x6a, 0x79, 0x8d, 0x98, 0x93, 0x84, 0x76, 0x71, 0x76, 0x7c, 0x5b, 0x00, 0xf0,
+    0x10, 0x8f, 0x89, 0x7b, 0x6c, 0x69, 0x75, 0x89, 0x97, 0x95, 0x87, 0x78, 0x71, 0x75, 0x7b, 0x7f,
+    0x80, 0x83, 0x8a, 0x8e, 0x8b, 0x7e, 0x6e, 0x69, 0x72, 0x85, 0x95, 0x96, 0x8a, 0x7a, 0x72, 0x74,
+    0x6d, 0x00, 0xe0, 0x88, 0x8e, 0x8c, 0x81, 0x71, 0x69, 0x70, 0x82, 0x93, 0x97, 0x8c, 0x7d, 0x73,
+    0x73, 0x6d, 0x00, 0xd0, 0x87, 0x8d, 0x8d, 0x83, 0x74, 0x69, 0x6d, 0x7e, 0x90, 0x97, 0x8f, 0x7f,
+    0x74, 0x6d, 0x00, 0xf0, 0x00, 0x81, 0x86, 0x8c, 0x8e, 0x86, 0x77, 0x6b, 0x6c, 0x7b, 0x8d, 0x97,
+    0x91, 0x82, 0x75, 0x72, 0xda, 0x00, 0xe1, 0x85, 0x8b, 0x8e, 0x88, 0x7a, 0x6c, 0x6b, 0x77, 0x8a,
+    0x96, 0x93, 0x85, 0x77, 0x72, 0x6d, 0x00, 0xd1, 0x8a, 0x8e, 0x8a, 0x7d, 0x6e, 0x6a, 0x74, 0x87,
+    0x94, 0x94, 0x88, 0x79, 0x72, 0x6d, 0x00, 0xd0, 0x88, 0x8d, 0x8b, 0x7f, 0x71, 0x6a, 0x72, 0x83,
+    0x93, 0x95, 0x8a, 0x7c, 0x73, 0x6d, 0x00, 0xe0, 0x82, 0x87, 0x8d, 0x8c, 0x82, 0x73, 0x6a, 0x70,
+    0x80, 0x90, 0x96, 0x8d, 0x7e, 0x74, 0x6d, 0x00, 0xf0, 0x36, 0x81, 0x86, 0x8c, 0x8d, 0x84, 0x76,
+    0x6b, 0x6e, 0x7d, 0x8e, 0x95, 0x8f, 0x81, 0x75, 0x73, 0x78, 0x7d, 0x80, 0x81, 0x85, 0x8b, 0x8d,
+    0x86, 0x79, 0x6d, 0x6c, 0x79, 0x8b, 0x95, 0x91, 0x83, 0x77, 0x73, 0x77, 0x7d, 0x7f, 0x81, 0x84,
+    0x8a, 0x8d, 0x88, 0x7b, 0x6e, 0x6c, 0x76, 0x88, 0x94, 0x92, 0x86, 0x79, 0x73, 0x76, 0x7c, 0x7f,
+    0x80, 0x83, 0x88, 0x8d, 0x8a, 0x7e, 0x70, 0x6b, 0x74, 0x85, 0x92, 0x93, 0x88, 0x7b, 0x74, 0x6d,
+    0x00, 0xf0, 0x14, 0x82, 0x87, 0x8c, 0x8b, 0x81, 0x73, 0x6b, 0x72, 0x82, 0x91, 0x94, 0x8b, 0x7d,
+    0x74, 0x74, 0x7a, 0x7e, 0x80, 0x82, 0x86, 0x8b, 0x8c, 0x83, 0x75, 0x6c, 0x70, 0x7e, 0x8e, 0x94,
+    0x8d, 0x7f, 0x75, 0x74, 0x79, 0x7e, 0x5b, 0x00, 0xc0, 0x8c, 0x85, 0x78, 0x6d, 0x6e, 0x7b, 0x8c,
+    0x94, 0x8f, 0x82, 0x77, 0x74, 0x6d, 0x00, 0xf0, 0x07, 0x84, 0x8a, 0x8c, 0x87, 0x7a, 0x6f, 0x6d,
+    0x78, 0x89, 0x93, 0x91, 0x84, 0x78, 0x74, 0x77, 0x7c, 0x7f, 0x80, 0x83, 0x88, 0x8c, 0x89, 0xe8,
+    0x01, 0xf2, 0x69, 0x7d, 0x70, 0x6d, 0x76, 0x86, 0x92, 0x92, 0x87, 0x7a, 0x74, 0x76, 0x7c, 0x7f,
+    0x80, 0x82, 0x87, 0x8c, 0x8a, 0x7f, 0x72, 0x6d, 0x73, 0x83, 0x90, 0x93, 0x89, 0x7c, 0x75, 0x75,
+    0x7b, 0x7f, 0x80, 0x82, 0x86, 0x8b, 0x8b, 0x82, 0x75, 0x6d, 0x71, 0x80, 0x8f, 0x93, 0x8b, 0x7e,
+    0x75, 0x75, 0x7a, 0x7e, 0x80, 0x81, 0x85, 0x8a, 0x8b, 0x84, 0x77, 0x6e, 0x70, 0x7d, 0x8c, 0x93,
+    0x8d, 0x81, 0x77, 0x75, 0x79, 0x7e, 0x80, 0x81, 0x84, 0x89, 0x8c, 0x86, 0x7a, 0x6f, 0x6f, 0x7a,
+    0x8a, 0x92, 0x8f, 0x83, 0x78, 0x74, 0x78, 0x7d, 0x80, 0x81, 0x83, 0x88, 0x8c, 0x87, 0x7c, 0x70,
+    0x6e, 0x78, 0x87, 0x92, 0x90, 0x85, 0x7a, 0x75, 0x77, 0x7c, 0x7f, 0x80, 0x83, 0x87, 0x8b, 0x89,
+    0x7e, 0x72, 0x6e, 0x75, 0x84, 0x90, 0x91, 0x87, 0x7b, 0x75, 0x76, 0x5b, 0x00, 0xb0, 0x8a, 0x81,
+    0x74, 0x6e, 0x73, 0x81, 0x8f, 0x92, 0x8a, 0x7d, 0x76, 0x12, 0x00, 0xe1, 0x81, 0x85, 0x8a, 0x8a,
+    0x83, 0x76, 0x6e, 0x72, 0x7f, 0x8d, 0x92, 0x8c, 0x7f, 0x77, 0x6d, 0x00, 0xf1, 0x13, 0x84, 0x89,
+    0x8b, 0x85, 0x79, 0x6f, 0x70, 0x7c, 0x8a, 0x92, 0x8d, 0x82, 0x78, 0x75, 0x79, 0x7d, 0x80, 0x81,
+    0x84, 0x88, 0x8b, 0x86, 0x7b, 0x71, 0x6f, 0x79, 0x88, 0x91, 0x8f, 0x84, 0x79, 0x75, 0x78, 0x7d,
+    0x5b, 0x00, 0xa1, 0x88, 0x7d, 0x72, 0x6f, 0x77, 0x85, 0x90, 0x90, 0x86, 0x7b, 0x6d, 0x00, 0xf1,
+    0x00, 0x82, 0x87, 0x8a, 0x89, 0x80, 0x74, 0x6f, 0x75, 0x83, 0x8f, 0x90, 0x88, 0x7d, 0x76, 0x77,
+    0x6d, 0x00, 0xe0, 0x8a, 0x89, 0x82, 0x76, 0x6f, 0x73, 0x80, 0x8d, 0x91, 0x8a, 0x7e, 0x77, 0x76,
+    0x7b, 0xc8, 0x00, 0xd0, 0x89, 0x8a, 0x83, 0x78, 0x70, 0x72, 0x7d, 0x8b, 0x91, 0x8c, 0x80, 0x78,
+    0x76, 0xda, 0x00, 0xe0, 0x84, 0x88, 0x8a, 0x85, 0x7a, 0x71, 0x71, 0x7b, 0x89, 0x90, 0x8d, 0x83,
+    0x79, 0x76, 0x6d, 0x00, 0xe0, 0x83, 0x87, 0x8a, 0x86, 0x7c, 0x72, 0x70, 0x79, 0x86, 0x8f, 0x8e,
+    0x85, 0x7a, 0x76, 0x6d, 0x00, 0xf0, 0x00, 0x82, 0x87, 0x8a, 0x88, 0x7f, 0x74, 0x70, 0x77, 0x84,
+    0x8e, 0x8f, 0x87, 0x7c, 0x76, 0x78, 0x35, 0x01, 0xd0, 0x86, 0x8a, 0x89, 0x81, 0x76, 0x70, 0x75,
+    0x81, 0x8d, 0x90, 0x88, 0x7e, 0x77, 0x6d, 0x00, 0xf2, 0x00, 0x81, 0x85, 0x89, 0x89, 0x82, 0x78,
+    0x71, 0x73, 0x7f, 0x8b, 0x90, 0x8a, 0x80, 0x78, 0x77, 0x5b, 0x00, 0xb1, 0x89, 0x84, 0x7a, 0x71,
+    0x72, 0x7c, 0x89, 0x90, 0x8c, 0x81, 0x79, 0x6d, 0x00, 0xd0, 0x83, 0x87, 0x8a, 0x85, 0x7c, 0x72,
+    0x71, 0x7a, 0x87, 0x8f, 0x8d, 0x83, 0x7a, 0x6d, 0x00, 0xf1, 0x00, 0x80, 0x82, 0x87, 0x89, 0x87,
+    0x7e, 0x74, 0x71, 0x78, 0x85, 0x8e, 0x8e, 0x85, 0x7b, 0x77, 0x6d, 0x00, 0xd0, 0x86, 0x89, 0x88,
+    0x80, 0x75, 0x71, 0x76, 0x82, 0x8d, 0x8e, 0x87, 0x7d, 0x77, 0x6d, 0x00, 0xe1, 0x81, 0x85, 0x89,
+    0x88, 0x81, 0x77, 0x71, 0x75, 0x80, 0x8b, 0x8f, 0x89, 0x7f, 0x78, 0x6d, 0x00, 0xd1, 0x84, 0x88,
+    0x89, 0x83, 0x79, 0x72, 0x73, 0x7e, 0x8a, 0x8f, 0x8a, 0x80, 0x79, 0x6d, 0x00, 0xd0, 0x83, 0x87,
+    0x89, 0x84, 0x7b, 0x73, 0x73, 0x7b, 0x88, 0x8e, 0x8c, 0x82, 0x7a, 0x12, 0x00, 0xf0, 0x0b, 0x80,
+    0x83, 0x87, 0x89, 0x86, 0x7d, 0x74, 0x72, 0x79, 0x86, 0x8e, 0x8d, 0x84, 0x7b, 0x77, 0x79, 0x7d,
+    0x7f, 0x80, 0x82, 0x86, 0x89, 0x87, 0x7f, 0x75, 0x72, 0xba, 0x01, 0xf1, 0x31, 0x78, 0x83, 0x8d,
+    0x8d, 0x86, 0x7c, 0x77, 0x79, 0x7c, 0x7f, 0x80, 0x82, 0x85, 0x88, 0x88, 0x80, 0x77, 0x72, 0x76,
+    0x81, 0x8b, 0x8e, 0x87, 0x7e, 0x78, 0x78, 0x7c, 0x7f, 0x80, 0x81, 0x84, 0x88, 0x88, 0x82, 0x79,
+    0x72, 0x75, 0x7f, 0x8a, 0x8e, 0x89, 0x80, 0x79, 0x78, 0x7b, 0x7f, 0x80, 0x81, 0x83, 0x87, 0x88,
+    0x84, 0x7a, 0x73, 0x74, 0x7d, 0x88, 0x8e, 0x8a, 0x81, 0x7a, 0x78, 0x7a, 0x7e, 0x12, 0x00, 0xa0,
+    0x85, 0x7c, 0x74, 0x73, 0x7b, 0x86, 0x8d, 0x8b, 0x83, 0x7b, 0x12, 0x00, 0xf1, 0x02, 0x80, 0x82,
+    0x86, 0x88, 0x86, 0x7e, 0x75, 0x73, 0x79, 0x84, 0x8c, 0x8c, 0x85, 0x7c, 0x78, 0x79, 0x7d, 0x5b,
+    0x00, 0xb0, 0x87, 0x80, 0x77, 0x73, 0x77, 0x82, 0x8b, 0x8d, 0x86, 0x7d, 0x78, 0x6d, 0x00, 0xe2,
+    0x81, 0x84, 0x88, 0x87, 0x81, 0x78, 0x73, 0x76, 0x80, 0x8a, 0x8d, 0x88, 0x7f, 0x79, 0x6d, 0x00,
+    0x91, 0x87, 0x88, 0x83, 0x7a, 0x73, 0x75, 0x7e, 0x88, 0x8d, 0x6d, 0x00, 0x02, 0x5b, 0x00, 0x91,
+    0x84, 0x7c, 0x74, 0x74, 0x7c, 0x87, 0x8d, 0x8a, 0x82, 0x6d, 0x00, 0x00, 0x5b, 0x00, 0xe0, 0x85,
+    0x7d, 0x75, 0x74, 0x7a, 0x85, 0x8c, 0x8b, 0x84, 0x7c, 0x78, 0x7a, 0x7d, 0x80, 0xb6, 0x00, 0xa1,
+    0x86, 0x7f, 0x77, 0x73, 0x79, 0x83, 0x8b, 0x8c, 0x85, 0x7d, 0x6d, 0x00, 0xe2, 0x81, 0x84, 0x87,
+    0x87, 0x80, 0x78, 0x74, 0x77, 0x81, 0x8a, 0x8c, 0x87, 0x7e, 0x79, 0x6d, 0x00, 0xb2, 0x87, 0x87,
+    0x82, 0x79, 0x74, 0x76, 0x7f, 0x89, 0x8c, 0x88, 0x80, 0x12, 0x00, 0xf2, 0x10, 0x83, 0x86, 0x87,
+    0x83, 0x7b, 0x75, 0x75, 0x7d, 0x87, 0x8c, 0x89, 0x81, 0x7a, 0x79, 0x7b, 0x7e, 0x80, 0x80, 0x82,
+    0x86, 0x87, 0x84, 0x7d, 0x75, 0x75, 0x7b, 0x85, 0x8c, 0x8a, 0x83, 0x7b, 0x12, 0x00, 0xf0, 0x00,
+    0x85, 0x87, 0x85, 0x7e, 0x77, 0x74, 0x7a, 0x84, 0x8b, 0x8b, 0x84, 0x7c, 0x79, 0x7a, 0x7d, 0x11,
+    0x01, 0xb5, 0x87, 0x86, 0x80, 0x78, 0x74, 0x78, 0x82, 0x8a, 0x8b, 0x86, 0x7e, 0x12, 0x00, 0xa1,
+    0x81, 0x79, 0x74, 0x77, 0x80, 0x89, 0x8c, 0x87, 0x7f, 0x7a, 0x6d, 0x00, 0xc5, 0x83, 0x86, 0x87,
+    0x82, 0x7b, 0x75, 0x76, 0x7e, 0x87, 0x8b, 0x88, 0x80, 0x12, 0x00, 0x95, 0x83, 0x7c, 0x76, 0x76,
+    0x7c, 0x86, 0x8b, 0x89, 0x82, 0x5b, 0x00, 0xa5, 0x84, 0x7e, 0x77, 0x75, 0x7b, 0x84, 0x8b, 0x8a,
+    0x83, 0x7c, 0x6d, 0x00, 0x95, 0x7f, 0x78, 0x75, 0x79, 0x83, 0x8a, 0x8a, 0x85, 0x7d, 0x5b, 0x00,
+    0xa1, 0x80, 0x79, 0x75, 0x78, 0x81, 0x89, 0x8b, 0x86, 0x7e, 0x7a, 0x7f, 0x00, 0xe0, 0x83, 0x86,
+    0x86, 0x82, 0x7a, 0x75, 0x77, 0x7f, 0x88, 0x8b, 0x87, 0x80, 0x7a, 0x7a, 0xa2, 0x01, 0x00, 0xc8,
+    0x00, 0xb0, 0x7c, 0x76, 0x76, 0x7d, 0x86, 0x8b, 0x88, 0x81, 0x7b, 0x79, 0x7c, 0xc8, 0x00, 0xb6,
+    0x85, 0x87, 0x84, 0x7d, 0x77, 0x76, 0x7c, 0x85, 0x8a, 0x89, 0x82, 0x5b, 0x00, 0xa0, 0x7e, 0x78,
+    0x76, 0x7b, 0x83, 0x8a, 0x8a, 0x84, 0x7d, 0x7a, 0xec, 0x00, 0xa0, 0x81, 0x84, 0x86, 0x85, 0x80,
+    0x79, 0x76, 0x79, 0x82, 0x89, 0x98, 0x01, 0xf5, 0x06, 0x8a, 0x85, 0x7e, 0x7a, 0x7a, 0x7d, 0x7f,
+    0x80, 0x81, 0x83, 0x86, 0x86, 0x81, 0x7a, 0x76, 0x78, 0x80, 0x88, 0x8a, 0x86, 0x7f, 0x12, 0x00,
+    0xf1, 0x10, 0x82, 0x7b, 0x76, 0x77, 0x7e, 0x87, 0x8a, 0x87, 0x80, 0x7b, 0x7a, 0x7c, 0x7f, 0x80,
+    0x80, 0x82, 0x85, 0x86, 0x83, 0x7d, 0x77, 0x77, 0x7d, 0x85, 0x8a, 0x88, 0x82, 0x7c, 0x7a, 0x7c,
+    0x7e, 0x12, 0x00, 0xf1, 0x10, 0x84, 0x7e, 0x78, 0x76, 0x7c, 0x84, 0x89, 0x89, 0x83, 0x7d, 0x7a,
+    0x7b, 0x7e, 0x80, 0x80, 0x81, 0x84, 0x86, 0x85, 0x7f, 0x79, 0x76, 0x7a, 0x82, 0x89, 0x89, 0x84,
+    0x7e, 0x7a, 0x7b, 0x7e, 0x5b, 0x00, 0xc1, 0x85, 0x80, 0x7a, 0x76, 0x79, 0x81, 0x88, 0x89, 0x85,
+    0x7f, 0x7a, 0x7b, 0x6d, 0x00, 0xc1, 0x85, 0x86, 0x81, 0x7b, 0x77, 0x78, 0x7f, 0x87, 0x8a, 0x86,
+    0x80, 0x7b, 0x7f, 0x00, 0xd6, 0x82, 0x85, 0x86, 0x82, 0x7c, 0x77, 0x78, 0x7e, 0x86, 0x89, 0x87,
+    0x81, 0x7c, 0x6d, 0x00, 0x55, 0x78, 0x77, 0x7c, 0x84, 0x89, 0x6d, 0x00, 0xa4, 0x84, 0x86, 0x84,
+    0x7f, 0x79, 0x77, 0x7b, 0x83, 0x89, 0x88, 0x6d, 0x00, 0xd3, 0x83, 0x86, 0x85, 0x80, 0x7a, 0x77,
+    0x7a, 0x81, 0x88, 0x89, 0x84, 0x7e, 0x7b, 0x5b, 0x00, 0xa2, 0x85, 0x81, 0x7b, 0x77, 0x79, 0x80,
+    0x87, 0x89, 0x85, 0x7f, 0x12, 0x00, 0x30, 0x82, 0x85, 0x85, 0x5b, 0x00, 0x60, 0x7f, 0x86, 0x89,
+    0x86, 0x80, 0x7c, 0x24, 0x00, 0xa0, 0x80, 0x82, 0x84, 0x85, 0x83, 0x7d, 0x78, 0x78, 0x7d, 0x85,
+    0x6d, 0x00, 0x11, 0x7b, 0xda, 0x00, 0xd0, 0x84, 0x85, 0x83, 0x7e, 0x79, 0x78, 0x7c, 0x83, 0x88,
+    0x88, 0x82, 0x7d, 0x7b, 0xda, 0x00, 0xb0, 0x81, 0x84, 0x85, 0x84, 0x7f, 0x7a, 0x77, 0x7b, 0x82,
+    0x88, 0x88, 0x5b, 0x00, 0x00, 0xda, 0x00, 0x22, 0x83, 0x85, 0x6d, 0x00, 0x24, 0x87, 0x88, 0x5b,
+    0x00, 0xb6, 0x83, 0x85, 0x85, 0x81, 0x7c, 0x78, 0x79, 0x7f, 0x86, 0x88, 0x85, 0x5b, 0x00, 0x96,
+    0x82, 0x7d, 0x78, 0x79, 0x7e, 0x85, 0x88, 0x86, 0x81, 0x6d, 0x00, 0x70, 0x7e, 0x79, 0x78, 0x7d,
+    0x84, 0x88, 0x87, 0x5b, 0x00, 0x10, 0x7f, 0x23, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x6d, 0x00, 0x32,
+    0x87, 0x83, 0x7e, 0x6d, 0x00, 0x90, 0x83, 0x85, 0x84, 0x80, 0x7a, 0x78, 0x7b, 0x81, 0x87, 0x6d,
+    0x00, 0x11, 0x7c, 0x35, 0x01, 0xb1, 0x85, 0x84, 0x81, 0x7b, 0x78, 0x7a, 0x80, 0x86, 0x88, 0x85,
+    0x7f, 0x49, 0x00, 0x50, 0x81, 0x82, 0x84, 0x85, 0x82, 0x6d, 0x00, 0x1a, 0x85, 0x6d, 0x00, 0x81,
+    0x79, 0x79, 0x7e, 0x84, 0x88, 0x86, 0x81, 0x7d, 0xda, 0x00, 0x10, 0x81, 0xc8, 0x00, 0x51, 0x7a,
+    0x79, 0x7d, 0x83, 0x87, 0x6d, 0x00, 0x02, 0xb6, 0x00, 0x76, 0x84, 0x7f, 0x7a, 0x78, 0x7c, 0x82,
+    0x87, 0x6d, 0x00, 0xb0, 0x84, 0x84, 0x80, 0x7b, 0x78, 0x7b, 0x81, 0x86, 0x87, 0x84, 0x7f, 0x73,
+    0x01, 0xf0, 0x17, 0x7c, 0x7c, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x84, 0x84, 0x81, 0x7c, 0x79, 0x7a,
+    0x7f, 0x85, 0x87, 0x85, 0x80, 0x7c, 0x7c, 0x7d, 0x7f, 0x80, 0x80, 0x82, 0x84, 0x84, 0x82, 0x7d,
+    0x79, 0x79, 0x7e, 0x84, 0x87, 0x86, 0x81, 0x7d, 0x7b, 0x12, 0x00, 0xc3, 0x81, 0x84, 0x85, 0x83,
+    0x7e, 0x7a, 0x79, 0x7d, 0x83, 0x87, 0x86, 0x82, 0x12, 0x00, 0xf2, 0x0f, 0x83, 0x84, 0x83, 0x7f,
+    0x7a, 0x79, 0x7c, 0x82, 0x87, 0x87, 0x82, 0x7e, 0x7c, 0x7c, 0x7e, 0x80, 0x80, 0x81, 0x83, 0x84,
+    0x84, 0x80, 0x7b, 0x79, 0x7b, 0x81, 0x86, 0x87, 0x83, 0x7f, 0x12, 0x00, 0x02, 0x5b, 0x00, 0x50,
+    0x7b, 0x80, 0x85, 0x87, 0x84, 0x12, 0x00, 0x02, 0x5b, 0x00, 0x23, 0x81, 0x7d, 0x6d, 0x00, 0x12,
+    0x7d, 0x6d, 0x00, 0xb2, 0x83, 0x84, 0x82, 0x7e, 0x7a, 0x7a, 0x7e, 0x84, 0x87, 0x85, 0x81, 0x12,
+    0x00, 0x12, 0x81, 0x5b, 0x00, 0x61, 0x7d, 0x83, 0x86, 0x86, 0x82, 0x7e, 0x24, 0x00, 0x01, 0x12,
+    0x00, 0x73, 0x7b, 0x79, 0x7c, 0x82, 0x86, 0x86, 0x83, 0x6d, 0x00, 0x85, 0x82, 0x84, 0x84, 0x80,
+    0x7c, 0x79, 0x7b, 0x81, 0x5b, 0x00, 0x01, 0xc8, 0x00, 0x90, 0x7d, 0x7a, 0x7b, 0x7f, 0x85, 0x87,
+    0x84, 0x80, 0x7d, 0xda, 0x00, 0x60, 0x80, 0x82, 0x83, 0x84, 0x82, 0x7d, 0x5b, 0x00, 0x17, 0x86,
+    0x5b, 0x00, 0x01, 0x6d, 0x00, 0x18, 0x83, 0x12, 0x00, 0x66, 0x83, 0x7f, 0x7b, 0x7a, 0x7d, 0x82,
+    0x6d, 0x00, 0xe0, 0x82, 0x84, 0x83, 0x80, 0x7c, 0x7a, 0x7c, 0x81, 0x85, 0x86, 0x83, 0x7f, 0x7c,
+    0x7d, 0xda, 0x00, 0xc5, 0x82, 0x84, 0x83, 0x81, 0x7c, 0x7a, 0x7b, 0x80, 0x85, 0x86, 0x84, 0x7f,
+    0x5b, 0x00, 0x10, 0x81, 0x6d, 0x00, 0x24, 0x84, 0x86, 0x6d, 0x00, 0x13, 0x81, 0xc8, 0x00, 0x09,
+    0x5b, 0x00, 0x12, 0x82, 0x5b, 0x00, 0x14, 0x85, 0xc8, 0x00, 0x95, 0x82, 0x84, 0x83, 0x7f, 0x7c,
+    0x7a, 0x7d, 0x81, 0x85, 0xda, 0x00, 0x03, 0x6d, 0x00, 0x10, 0x80, 0x6d, 0x00, 0x10, 0x7d, 0x6d,
+    0x00, 0x40, 0x80, 0x82, 0x83, 0x83, 0x5b, 0x00, 0x11, 0x80, 0x5b, 0x00, 0x30, 0x7d, 0x7e, 0x7f,
+    0x5a, 0x01, 0xa2, 0x83, 0x81, 0x7e, 0x7b, 0x7b, 0x7f, 0x83, 0x86, 0x84, 0x81, 0x7f, 0x00, 0x01,
+    0x6d, 0x00, 0x30, 0x7b, 0x7b, 0x7e, 0x6d, 0x00, 0x03, 0x23, 0x01, 0x30, 0x82, 0x83, 0x82, 0x5b,
+    0x00, 0x61, 0x82, 0x85, 0x85, 0x82, 0x7e, 0x7d, 0xb4, 0x01, 0x23, 0x82, 0x83, 0xc8, 0x00, 0x31,
+    0x85, 0x83, 0x7f, 0x5b, 0x00, 0x11, 0x81, 0x5b, 0x00, 0xa0, 0x7b, 0x7c, 0x80, 0x84, 0x85, 0x83,
+    0x80, 0x7d, 0x7d, 0x7e, 0x87, 0x00, 0xf2, 0x03, 0x7f, 0x80, 0x80, 0x81, 0x83, 0x83, 0x81, 0x7d,
+    0x7b, 0x7b, 0x7f, 0x84, 0x85, 0x84, 0x80, 0x7d, 0x7d, 0x7e, 0x12, 0x00, 0xa2, 0x82, 0x7e, 0x7b,
+    0x7b, 0x7e, 0x83, 0x85, 0x84, 0x81, 0x7e, 0x12, 0x00, 0xe0, 0x82, 0x83, 0x82, 0x7f, 0x7c, 0x7b,
+    0x7e, 0x82, 0x85, 0x85, 0x81, 0x7e, 0x7d, 0x7d, 0x24, 0x00, 0xc4, 0x82, 0x83, 0x82, 0x80, 0x7c,
+    0x7b, 0x7d, 0x81, 0x85, 0x85, 0x82, 0x7f, 0x12, 0x00, 0xf1, 0x02, 0x83, 0x80, 0x7d, 0x7b, 0x7c,
+    0x80, 0x84, 0x85, 0x83, 0x7f, 0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x82, 0x5b, 0x00, 0x01, 0x12,
+    0x00, 0x06, 0x5b, 0x00, 0x9c, 0x81, 0x7e, 0x7b, 0x7b, 0x7f, 0x83, 0x85, 0x84, 0x80, 0x5b, 0x00,
+    0x0b, 0x6d, 0x00, 0x56, 0x7d, 0x82, 0x85, 0x84, 0x82, 0x24, 0x00, 0x64, 0x80, 0x7d, 0x7b, 0x7d,
+    0x81, 0x84, 0x6d, 0x00, 0x80, 0x80, 0x82, 0x83, 0x83, 0x80, 0x7d, 0x7b, 0x7c,
+};
@@ -0,0 +1,49 @@
+/*
+  Battery Watch
+
+  Uses analogWatch() to get told when a voltage leaves a window instead
+  of polling analogRead(). The ADC converts on its own and its window
+  comparator interrupts only on the way out and back in, so loop()
+  sleeps until something happens.
+
+  Hardware: a potentiometer or divided battery voltage on pin A0.
+
+  This example code is in the public domain.
+*/
+
+#define WATCH_PIN  A0
+#define LOW_LEVEL  300   // analogRead() units, 10 bits by default
+#define HIGH_LEVEL 700
+
+volatile int lastState = ANALOG_WATCH_INSIDE;
+volatile uint16_t lastValue;
+volatile bool changed;
+
+void levelChanged(uint8_t pin, uint16_t value, int state)
+{
+  // Hwi context: just record, print from loop()
+  lastValue = value;
+  lastState = state;
+  changed = true;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+
+  if (!analogWatch(WATCH_PIN, LOW_LEVEL, HIGH_LEVEL, levelChanged)) {
+    Serial.println("analogWatch() failed");
+  }
+}
+
+void loop()
+{
+  if (changed) {
+    changed = false;
+    Serial.print(lastState == ANALOG_WATCH_ABOVE ? "above " :
+                 lastState == ANALOG_WATCH_BELOW ? "below " : "inside ");
+    Serial.println(lastValue);
+  }
+  delay(100);
+}
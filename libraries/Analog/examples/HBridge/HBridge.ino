@@ -0,0 +1,64 @@
+/*
+  H-Bridge
+
+  Drives a full H-bridge with motorPwmBegin(): two complementary pairs
+  on Timer_A2, 20 kHz center aligned PWM with 500 ns dead-time, so the
+  high and low side switches of a leg are never on together. The
+  speed ramps forward and back in reverse; one leg is PWMed while the
+  other one holds its low side on.
+
+  Hardware: gate driver inputs on
+    P5.6 (pin 37) leg A high side, P5.7 (pin 17) leg A low side
+    P6.6 (pin 36) leg B high side, P6.7 (pin 35) leg B low side
+  Check the outputs with a scope before connecting a bridge.
+
+  This example code is in the public domain.
+*/
+
+MotorPwm bridge;
+
+// high, low for leg A, then leg B
+const uint8_t pins[] = { 37, 17, 36, 35 };
+
+void drive(int speed)
+{
+  uint32_t vals[2];
+
+  if (speed >= 0) {
+    vals[0] = speed;
+    vals[1] = 0;
+  }
+  else {
+    vals[0] = 0;
+    vals[1] = -speed;
+  }
+  motorPwmWrite(&bridge, vals);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+
+  if (!motorPwmBegin(&bridge, pins, 2, 20000, 500)) {
+    Serial.println("motorPwmBegin failed");
+    for (;;);
+  }
+
+  Serial.print("half period ");
+  Serial.print(bridge.period);
+  Serial.print(" counts, dead-time ");
+  Serial.print(bridge.dead);
+  Serial.println(" counts");
+}
+
+void loop()
+{
+  for (int speed = -255; speed <= 255; speed++) {
+    drive(speed);
+    delay(10);
+  }
+  for (int speed = 255; speed >= -255; speed--) {
+    drive(speed);
+    delay(10);
+  }
+}
@@ -0,0 +1,74 @@
+/*
+  Performance Scaling
+
+  Idles at the 12MHz performance level and bursts to 48MHz to crunch
+  a block of numbers, while a 1kHz analogWrite() output, Serial and
+  micros() carry on across the clock changes:
+
+    level 0   MCLK 12MHz, SMCLK 3MHz
+    level 2   MCLK 48MHz, SMCLK 12MHz
+
+  Each pass prints the time the burst took at 48MHz and what the same
+  work takes at 12MHz. Put a scope or frequency counter on pin 19
+  (P2.5): it stays at 1kHz and 25% duty throughout.
+
+  This example code is in the public domain.
+*/
+
+#define PWM_PIN  19
+#define WORK     20000
+
+volatile uint32_t sink;
+
+void crunch(void)
+{
+  uint32_t x = 1;
+
+  for (uint32_t i = 0; i < WORK; i++) {
+    x = x * 1664525 + 1013904223;
+  }
+  sink = x;
+}
+
+unsigned long timeAt(uint8_t level)
+{
+  unsigned long start;
+
+  if (!setPerformanceLevel(level)) {
+    Serial.print("level ");
+    Serial.print(level);
+    Serial.println(" not allowed right now");
+    return (0);
+  }
+
+  start = micros();
+  crunch();
+
+  return (micros() - start);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+
+  analogFrequency(1000);
+  analogWrite(PWM_PIN, 64);
+}
+
+void loop()
+{
+  unsigned long fast = timeAt(2);
+  unsigned long slow = timeAt(0);
+
+  Serial.print("48MHz: ");
+  Serial.print(fast);
+  Serial.print("us  12MHz: ");
+  Serial.print(slow);
+  Serial.print("us  CPU now ");
+  Serial.print(getCpuFrequency());
+  Serial.println(" Hz");
+
+  // idle at level 0 until the next burst
+  delay(1000);
+}
@@ -0,0 +1,64 @@
+/*
+  PWM Waveform
+
+  Plays a sine table on a 20 kHz PWM output with pwmWaveformBegin():
+  the uDMA moves one duty value into the timer's compare register at
+  the start of every PWM period, so the 64 entry table comes out as a
+  312 Hz sine after an RC low-pass filter (1 kOhm, 100 nF), while
+  loop() keeps the CPU to itself.
+
+  Every 5 seconds a one-shot chirp replaces the sine for a moment, then
+  the sine is restarted.
+
+  Hardware: RC filter on pin 19 (P2.5), scope on the capacitor.
+
+  This example code is in the public domain.
+*/
+
+#define PWM_PIN     19
+#define CARRIER_HZ  20000
+#define SINE_SIZE   64
+#define CHIRP_SIZE  4000
+
+PwmChannel pwm;
+uint16_t sine[SINE_SIZE];
+uint16_t chirp[CHIRP_SIZE];
+
+void setup()
+{
+  Serial.begin(115200);
+
+  analogFrequency(CARRIER_HZ);
+  if (!pwmChannelBegin(&pwm, PWM_PIN)) {
+    Serial.println("no PWM on this pin");
+    for (;;);
+  }
+
+  // compare values are in timer counts; pwmChannelCompare() scales
+  // analogWrite() values to them
+  for (int i = 0; i < SINE_SIZE; i++) {
+    sine[i] = pwmChannelCompare(&pwm,
+      (uint32_t)(127.5 + 127.5 * sin(2 * PI * i / SINE_SIZE)));
+  }
+  for (int i = 0; i < CHIRP_SIZE; i++) {
+    float t = (float)i / CARRIER_HZ;
+    chirp[i] = pwmChannelCompare(&pwm,
+      (uint32_t)(127.5 + 127.5 * sin(2 * PI * (100 + 5000 * t) * t)));
+  }
+
+  if (!pwmWaveformBegin(&pwm, sine, SINE_SIZE, true)) {
+    Serial.println("uDMA channel busy");
+  }
+}
+
+void loop()
+{
+  delay(5000);
+
+  pwmWaveformBegin(&pwm, chirp, CHIRP_SIZE, false);
+  while (pwmWaveformActive(&pwm)) {
+    delay(10);
+  }
+
+  pwmWaveformBegin(&pwm, sine, SINE_SIZE, true);
+}
@@ -0,0 +1,54 @@
+/*
+  Timer Plan
+
+  Reserves the Timer_As up front so tone() and analogWrite() get the
+  same timers whatever order they start in, then prints who owns each
+  timer and which of its CCRs drive PWM outputs.
+
+    TA0  PWM, the mappable analogWrite() pins
+    TA1  tone()
+    TA2  left for Servo (Timer_ANY)
+    TA3  the Clock tick, reported as unknown
+
+  This example code is in the public domain.
+*/
+
+const char *ownerNames[] = {
+  "free", "PWM", "tone", "Servo", "sketch", "unknown"
+};
+
+void report()
+{
+  for (uint8_t t = 0; t < 4; t++) {
+    uint8_t ccrs;
+    uint8_t owner = timerOwner(t, &ccrs);
+
+    Serial.print("TA");
+    Serial.print(t);
+    Serial.print(": ");
+    Serial.print(ownerNames[owner]);
+    Serial.print(", CCRs in use 0x");
+    Serial.println(ccrs, HEX);
+  }
+  Serial.println();
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+
+  if (!timerReserve(0, TIMER_OWNER_PWM) || !timerReserve(1, TIMER_OWNER_TONE)) {
+    Serial.println("timers already taken");
+  }
+  report();
+
+  tone(40, 440);
+  analogWrite(RED_LED, 64);
+  analogWrite(GREEN_LED, 128);
+  report();
+}
+
+void loop()
+{
+}
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+#
+# audio_compress.py - Convert a WAV clip for AudioPlayer
+#
+# Reads a mono WAV file and writes a header with its samples as a
+# uint8_t array, 8 bit unsigned or 16 bit signed little endian, for
+# AudioPlayer::play(), or with --lz4 for playCompressed():
+#
+#   samples, bits, samples per block     uint32_t, 2 x uint16_t, little endian
+#   per block: size, LZ4 block           uint16_t, size bytes
+#
+# Each block is an independent LZ4 block of at most AUDIO_PLAYER_BLOCK
+# bytes decompressed. The sample rate is not converted: pass the WAV's
+# to AudioPlayer::begin().
+#
+# Usage: audio_compress.py clip.wav output.h [--bits 8] [--lz4] [--block 512]
+#   --bits   8 or 16 bits per sample in the output
+#   --lz4    compress for playCompressed()
+#   --block  AUDIO_PLAYER_BLOCK of the core
+
+import argparse
+import os
+import re
+import struct
+import sys
+import wave
+
+MIN_MATCH = 4
+LAST_LITERALS = 5
+MATCH_LIMIT = 12
+
+
+def _length(n):
+    out = bytearray()
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+    return out
+
+
+def _sequence(out, literals, match_length, offset):
+    lit = len(literals)
+    token = (min(lit, 15) << 4)
+    if match_length:
+        token |= min(match_length - MIN_MATCH, 15)
+    out.append(token)
+    if lit >= 15:
+        out += _length(lit - 15)
+    out += literals
+    if match_length:
+        out += struct.pack('<H', offset)
+        if match_length - MIN_MATCH >= 15:
+            out += _length(match_length - MIN_MATCH - 15)
+
+
+def compress_block(data):
+    """Greedy LZ4 block compressor, without frame or block size."""
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    end = len(data)
+    while i + MATCH_LIMIT <= end:
+        key = data[i:i + MIN_MATCH]
+        candidate = table.get(key)
+        table[key] = i
+        if candidate is None or i - candidate > 0xffff:
+            i += 1
+            continue
+        length = MIN_MATCH
+        while (i + length < end - LAST_LITERALS) and (data[candidate + length] == data[i + length]):
+            length += 1
+        _sequence(out, data[anchor:i], length, i - candidate)
+        i += length
+        anchor = i
+    _sequence(out, data[anchor:], 0, 0)
+    return bytes(out)
+
+
+def read_wav(path, bits):
+    try:
+        w = wave.open(path, 'rb')
+    except (OSError, wave.Error) as e:
+        sys.exit('%s: %s' % (path, e))
+    if w.getnchannels() != 1:
+        sys.exit('%s: %d channels, mono only' % (path, w.getnchannels()))
+    width = w.getsampwidth()
+    if width not in (1, 2):
+        sys.exit('%s: %d bit samples, 8 or 16 only' % (path, 8 * width))
+    rate = w.getframerate()
+    frames = w.readframes(w.getnframes())
+    w.close()
+    if width == 1:
+        samples = [(b - 128) << 8 for b in frames]
+    else:
+        samples = list(struct.unpack('<%dh' % (len(frames) // 2), frames))
+    if bits == 8:
+        data = bytes(min(255, (s + 32768 + 128) >> 8) for s in samples)
+    else:
+        data = struct.pack('<%dh' % len(samples), *samples)
+    return rate, len(samples), data
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a WAV clip for AudioPlayer')
+    parser.add_argument('input')
+    parser.add_argument('output')
+    parser.add_argument('--bits', type=int, choices=(8, 16), default=8)
+    parser.add_argument('--lz4', action='store_true')
+    parser.add_argument('--block', type=int, default=512)
+    args = parser.parse_args()
+
+    rate, count, data = read_wav(args.input, args.bits)
+    name = re.sub(r'\W', '_', os.path.splitext(os.path.basename(args.input))[0])
+    size = args.bits // 8
+
+    if args.lz4:
+        samples = args.block // size
+        clip = bytearray(struct.pack('<IHH', count, args.bits, samples))
+        for k in range(0, len(data), samples * size):
+            block = compress_block(data[k:k + samples * size])
+            clip += struct.pack('<H', len(block)) + block
+        array = 'lz4_%s' % name
+        use = 'playCompressed(%s)' % array
+    else:
+        clip = data
+        array = 'pcm_%s' % name
+        use = 'play(%s, %d, %d)' % (array, count, args.bits)
+
+    with open(args.output, 'w') as f:
+        f.write('// %s, %d samples of %d bits at %d Hz, %d bytes\n' % (name, count, args.bits, rate, len(clip)))
+        f.write('// Generated by audio_compress.py for AudioPlayer::%s\n\n' % use)
+        f.write('#define %s_RATE %d\n\n' % (name.upper(), rate))
+        f.write('static const uint8_t %s[] = {\n' % array)
+        for k in range(0, len(clip), 16):
+            f.write('    ' + ' '.join('0x%02x,' % b for b in clip[k:k + 16]) + '\n')
+        f.write('};\n')
+    print('%s: %d bytes instead of %d' % (args.output, len(clip), len(data)))
+
+
+if __name__ == '__main__':
+    main()
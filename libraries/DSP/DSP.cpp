@@ -0,0 +1,448 @@
+/*
+ * DSP.cpp - block filtering, real FFT and statistics on CMSIS-DSP
+ *
+ * The CMSIS-DSP kernels take non-const source pointers but do not
+ * write through them, except for the FFT's input, which forward()
+ * documents as scratch.
+ */
+
+#include "DSP.h"
+
+#include <stdlib.h>
+
+#include <arm_const_structs.h>
+#include <AnalogStream.h>
+
+#define ADC_MIDSCALE        (1 << (DSP_ADC_BITS - 1))
+
+DSPClass DSP;
+
+FIRFilter::FIRFilter(void)
+{
+    state = NULL;
+}
+
+/*
+ *  ======== begin ========
+ *  process() takes up to blockSize samples per call
+ */
+bool FIRFilter::begin(const float *coeffs, uint16_t taps,
+    uint16_t blockSize)
+{
+    end();
+
+    if (taps == 0 || blockSize == 0) {
+        return (false);
+    }
+
+    state = (float *)calloc(taps + blockSize - 1, sizeof(float));
+    if (state == NULL) {
+        return (false);
+    }
+    this->blockSize = blockSize;
+
+    arm_fir_init_f32(&fir, taps, (float32_t *)coeffs, state, blockSize);
+
+    return (true);
+}
+
+void FIRFilter::end(void)
+{
+    free(state);
+    state = NULL;
+}
+
+void FIRFilter::process(const float *in, float *out, uint16_t count)
+{
+    uint16_t n;
+
+    while (state != NULL && count != 0) {
+        n = count < blockSize ? count : blockSize;
+        arm_fir_f32(&fir, (float32_t *)in, out, n);
+        in += n;
+        out += n;
+        count -= n;
+    }
+}
+
+FIRFilterQ15::FIRFilterQ15(void)
+{
+    state = NULL;
+}
+
+bool FIRFilterQ15::begin(const q15_t *coeffs, uint16_t taps,
+    uint16_t blockSize)
+{
+    end();
+
+    if (blockSize == 0) {
+        return (false);
+    }
+
+    state = (q15_t *)calloc(taps + blockSize, sizeof(q15_t));
+    if (state == NULL) {
+        return (false);
+    }
+    this->blockSize = blockSize;
+
+    /* ARM_MATH_ARGUMENT_ERROR: an odd number of taps, or fewer than 4 */
+    if (arm_fir_init_q15(&fir, taps, (q15_t *)coeffs, state,
+        blockSize) != ARM_MATH_SUCCESS) {
+        end();
+        return (false);
+    }
+
+    return (true);
+}
+
+void FIRFilterQ15::end(void)
+{
+    free(state);
+    state = NULL;
+}
+
+/*
+ *  ======== process ========
+ *  arm_fir_fast_q15() accumulates in 32 bits; the coefficients' sum of
+ *  magnitudes must stay below 1 to keep it from wrapping
+ */
+void FIRFilterQ15::process(const q15_t *in, q15_t *out, uint16_t count)
+{
+    uint16_t n;
+
+    while (state != NULL && count != 0) {
+        n = count < blockSize ? count : blockSize;
+        arm_fir_fast_q15(&fir, (q15_t *)in, out, n);
+        in += n;
+        out += n;
+        count -= n;
+    }
+}
+
+BiquadFilter::BiquadFilter(void)
+{
+    state = NULL;
+}
+
+bool BiquadFilter::begin(const float *coeffs, uint8_t stages)
+{
+    end();
+
+    if (stages == 0) {
+        return (false);
+    }
+
+    state = (float *)calloc(4 * stages, sizeof(float));
+    if (state == NULL) {
+        return (false);
+    }
+
+    arm_biquad_cascade_df1_init_f32(&iir, stages, (float32_t *)coeffs,
+        state);
+
+    return (true);
+}
+
+void BiquadFilter::end(void)
+{
+    free(state);
+    state = NULL;
+}
+
+void BiquadFilter::process(const float *in, float *out, uint16_t count)
+{
+    if (state != NULL) {
+        arm_biquad_cascade_df1_f32(&iir, (float32_t *)in, out, count);
+    }
+}
+
+RealFFT::RealFFT(void)
+{
+    fft.fftLenRFFT = 0;
+    work = NULL;
+}
+
+/*
+ *  ======== begin ========
+ *  What arm_rfft_fast_init_f32() does, for the lengths up to
+ *  DSP_FFT_MAX_LENGTH only: that function refers to the tables of all
+ *  lengths, so calling it links all of them.
+ */
+bool RealFFT::begin(uint16_t length)
+{
+    const arm_cfft_instance_f32 *cfft;
+    const float32_t *twiddle;
+
+    end();
+
+    switch (length) {
+        case 32:
+            cfft = &arm_cfft_sR_f32_len16;
+            twiddle = twiddleCoef_rfft_32;
+            break;
+        case 64:
+            cfft = &arm_cfft_sR_f32_len32;
+            twiddle = twiddleCoef_rfft_64;
+            break;
+        case 128:
+            cfft = &arm_cfft_sR_f32_len64;
+            twiddle = twiddleCoef_rfft_128;
+            break;
+        case 256:
+            cfft = &arm_cfft_sR_f32_len128;
+            twiddle = twiddleCoef_rfft_256;
+            break;
+#if DSP_FFT_MAX_LENGTH >= 512
+        case 512:
+            cfft = &arm_cfft_sR_f32_len256;
+            twiddle = twiddleCoef_rfft_512;
+            break;
+#endif
+#if DSP_FFT_MAX_LENGTH >= 1024
+        case 1024:
+            cfft = &arm_cfft_sR_f32_len512;
+            twiddle = twiddleCoef_rfft_1024;
+            break;
+#endif
+#if DSP_FFT_MAX_LENGTH >= 2048
+        case 2048:
+            cfft = &arm_cfft_sR_f32_len1024;
+            twiddle = twiddleCoef_rfft_2048;
+            break;
+#endif
+#if DSP_FFT_MAX_LENGTH >= 4096
+        case 4096:
+            cfft = &arm_cfft_sR_f32_len2048;
+            twiddle = twiddleCoef_rfft_4096;
+            break;
+#endif
+        default:
+            return (false);
+    }
+
+    work = (float *)malloc(length * sizeof(float));
+    if (work == NULL) {
+        return (false);
+    }
+
+    fft.Sint = *cfft;
+    fft.fftLenRFFT = length;
+    fft.pTwiddleRFFT = (float32_t *)twiddle;
+
+    return (true);
+}
+
+void RealFFT::end(void)
+{
+    free(work);
+    work = NULL;
+    fft.fftLenRFFT = 0;
+}
+
+void RealFFT::forward(float *in, float *out)
+{
+    if (work != NULL) {
+        arm_rfft_fast_f32(&fft, in, out, 0);
+    }
+}
+
+void RealFFT::inverse(float *in, float *out)
+{
+    if (work != NULL) {
+        arm_rfft_fast_f32(&fft, in, out, 1);
+    }
+}
+
+/*
+ *  ======== magnitude ========
+ *  Bin 0 is the DC term alone; out[1] of forward() holds the Nyquist
+ *  bin, which is left out
+ */
+void RealFFT::magnitude(float *in, float *out)
+{
+    if (work != NULL) {
+        arm_rfft_fast_f32(&fft, in, work, 0);
+        arm_cmplx_mag_f32(work, out, fft.fftLenRFFT / 2);
+        out[0] = fabsf(work[0]);
+    }
+}
+
+DSPInput::DSPInput(void)
+{
+    stream = NULL;
+    buffers = NULL;
+}
+
+/*
+ *  ======== begin ========
+ *  Take over stream's block callback; the stream must have been begun
+ */
+bool DSPInput::begin(AnalogStream &stream)
+{
+    Semaphore_Params semParams;
+
+    end();
+
+    samples = stream.samples();
+    blockLength = (uint32_t)stream.channels() * samples;
+    if (blockLength == 0) {
+        return (false);
+    }
+
+    buffers = (float *)malloc(2 * blockLength * sizeof(float));
+    if (buffers == NULL) {
+        return (false);
+    }
+
+    Semaphore_Params_init(&semParams);
+    semParams.mode = Semaphore_Mode_BINARY;
+    Semaphore_construct(&readySem, 0, &semParams);
+
+    fill = 0;
+    pending = false;
+    overrunCount = 0;
+
+    this->stream = &stream;
+    stream.onBlock(blockFxn, this);
+
+    return (true);
+}
+
+void DSPInput::end(void)
+{
+    if (stream != NULL) {
+        stream->onBlock(NULL);
+        stream = NULL;
+        Semaphore_destruct(&readySem);
+    }
+    free(buffers);
+    buffers = NULL;
+}
+
+/*
+ *  ======== read ========
+ *  The newest converted block, waiting up to timeout for one; NULL on
+ *  timeout. It stays valid for one block period after the next one is
+ *  converted.
+ */
+const float *DSPInput::read(uint32_t timeout)
+{
+    if (stream == NULL ||
+        !Semaphore_pend(Semaphore_handle(&readySem), timeout)) {
+        return (NULL);
+    }
+    pending = false;
+
+    return (buffers + (fill ^ 1) * blockLength);
+}
+
+/*
+ *  ======== blockFxn ========
+ *  AnalogStream callback, Hwi context: convert into the block read()
+ *  does not hold
+ */
+void DSPInput::blockFxn(const uint16_t *block, void *arg)
+{
+    DSPInput *input = (DSPInput *)arg;
+
+    DSP.fromADC(block, input->buffers + input->fill * input->blockLength,
+        input->blockLength);
+    input->fill ^= 1;
+
+    if (input->pending) {
+        input->overrunCount++;
+    }
+    input->pending = true;
+    Semaphore_post(Semaphore_handle(&input->readySem));
+}
+
+void DSPClass::fromADC(const uint16_t *raw, float *out, uint16_t count)
+{
+    while (count--) {
+        *out++ = ((int32_t)*raw++ - ADC_MIDSCALE) * (1.0f / ADC_MIDSCALE);
+    }
+}
+
+void DSPClass::fromADC(const uint16_t *raw, q15_t *out, uint16_t count)
+{
+    while (count--) {
+        *out++ = ((int32_t)*raw++ - ADC_MIDSCALE) * (1 << (16 - DSP_ADC_BITS));
+    }
+}
+
+void DSPClass::hann(float *out, const float *in, uint16_t count)
+{
+    float step;
+    uint16_t i;
+
+    if (count < 2) {
+        return;
+    }
+
+    step = 2 * PI / (count - 1);
+    for (i = 0; i < count; i++) {
+        out[i] = in[i] * (0.5f - 0.5f * arm_cos_f32(step * i));
+    }
+}
+
+float DSPClass::mean(const float *in, uint16_t count)
+{
+    float32_t result;
+
+    arm_mean_f32((float32_t *)in, count, &result);
+
+    return (result);
+}
+
+float DSPClass::rms(const float *in, uint16_t count)
+{
+    float32_t result;
+
+    arm_rms_f32((float32_t *)in, count, &result);
+
+    return (result);
+}
+
+float DSPClass::stddev(const float *in, uint16_t count)
+{
+    float32_t result;
+
+    arm_std_f32((float32_t *)in, count, &result);
+
+    return (result);
+}
+
+/*
+ *  ======== peak ========
+ *  The largest value, and its index if index is not NULL
+ */
+float DSPClass::peak(const float *in, uint16_t count, uint16_t *index)
+{
+    float32_t result;
+    uint32_t at;
+
+    arm_max_f32((float32_t *)in, count, &result, &at);
+    if (index != NULL) {
+        *index = at;
+    }
+
+    return (result);
+}
+
+q15_t DSPClass::mean(const q15_t *in, uint16_t count)
+{
+    q15_t result;
+
+    arm_mean_q15((q15_t *)in, count, &result);
+
+    return (result);
+}
+
+q15_t DSPClass::rms(const q15_t *in, uint16_t count)
+{
+    q15_t result;
+
+    arm_rms_q15((q15_t *)in, count, &result);
+
+    return (result);
+}
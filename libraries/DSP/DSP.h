@@ -0,0 +1,189 @@
+/*
+ * DSP.h - block filtering, real FFT and statistics on CMSIS-DSP
+ *
+ *      AnalogStream stream;
+ *      DSPInput input;
+ *      RealFFT fft;
+ *
+ *      stream.begin(pins, 1, 8000, buffer, 512);
+ *      input.begin(stream);                    // takes the block callback
+ *      fft.begin(512);
+ *      ...
+ *      const float *block = input.read();
+ *      DSP.hann(work, block, 512);
+ *      fft.magnitude(work, spectrum);          // 256 bins of 8000 / 512 Hz
+ *
+ * The classes hold a CMSIS-DSP instance and its state and run the
+ * library's Cortex-M4 kernels (arm_*_f32, the SIMD arm_*_q15) on a
+ * block at a time; a filter's state carries over from block to block.
+ * Floating point samples are scaled to [-1, 1), q15 ones to the full
+ * 16 bit range.
+ *
+ * DSPInput is the bridge from AnalogStream: its block callback, in
+ * Hwi context, only converts the raw ADC block to floats; read()
+ * hands the converted block to a task, where the filters and the FFT
+ * run.
+ *
+ * RealFFT supports lengths of 32 to DSP_FFT_MAX_LENGTH; larger ones
+ * would link larger twiddle tables.
+ */
+
+#ifndef DSP_h
+#define DSP_h
+
+#include <Energia.h>
+#include <AnalogStream.h>
+
+#include <ti/sysbios/knl/Semaphore.h>
+
+#ifndef ARM_MATH_CM4
+#define ARM_MATH_CM4
+#endif
+#include <msp.h>
+#undef PI                       /* arm_math.h has a float one */
+#include <arm_math.h>
+#undef PI
+#define PI 3.1415926535897932384626433832795
+
+/* longest RealFFT, a power of two up to 4096 */
+#ifndef DSP_FFT_MAX_LENGTH
+#define DSP_FFT_MAX_LENGTH      1024
+#endif
+
+/* ADC samples are unsigned 14 bit, AnalogStream's raw values */
+#define DSP_ADC_BITS            14
+
+class FIRFilter
+{
+    public:
+        FIRFilter(void);
+        ~FIRFilter(void) { end(); }
+
+        /* coeffs are in time reversed order and must stay valid */
+        bool begin(const float *coeffs, uint16_t taps, uint16_t blockSize);
+        void end(void);
+        void process(const float *in, float *out, uint16_t count);
+
+    private:
+        arm_fir_instance_f32 fir;
+        float *state;
+        uint16_t blockSize;
+};
+
+class FIRFilterQ15
+{
+    public:
+        FIRFilterQ15(void);
+        ~FIRFilterQ15(void) { end(); }
+
+        /* an even number of taps, at least 4 */
+        bool begin(const q15_t *coeffs, uint16_t taps, uint16_t blockSize);
+        void end(void);
+        void process(const q15_t *in, q15_t *out, uint16_t count);
+
+    private:
+        arm_fir_instance_q15 fir;
+        q15_t *state;
+        uint16_t blockSize;
+};
+
+/*
+ *  A cascade of second order sections. Each stage's coefficients are
+ *  {b0, b1, b2, a1, a2} for
+ *      y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2],
+ *  so a1 and a2 have the opposite sign of the usual design tools.
+ */
+class BiquadFilter
+{
+    public:
+        BiquadFilter(void);
+        ~BiquadFilter(void) { end(); }
+
+        bool begin(const float *coeffs, uint8_t stages);
+        void end(void);
+        void process(const float *in, float *out, uint16_t count);
+
+    private:
+        arm_biquad_casd_df1_inst_f32 iir;
+        float *state;
+};
+
+class RealFFT
+{
+    public:
+        RealFFT(void);
+        ~RealFFT(void) { end(); }
+
+        bool begin(uint16_t length);
+        void end(void);
+        uint16_t length(void) { return (fft.fftLenRFFT); }
+
+        /*
+         * in (length samples) is used as scratch; out gets length / 2
+         * complex bins, the real part of bin length / 2 in out[1]
+         */
+        void forward(float *in, float *out);
+        void inverse(float *in, float *out);
+
+        /* |bin| of the length / 2 bins; in is used as scratch */
+        void magnitude(float *in, float *out);
+
+    private:
+        arm_rfft_fast_instance_f32 fft;
+        float *work;                /* length values, for magnitude() */
+};
+
+/*
+ *  Converts AnalogStream blocks to floats in its block callback and
+ *  queues them for read(). A block has the same layout as the stream's,
+ *  channel(block, c) is the first sample of channel c.
+ */
+class DSPInput
+{
+    public:
+        DSPInput(void);
+        ~DSPInput(void) { end(); }
+
+        bool begin(AnalogStream &stream);
+        void end(void);
+
+        const float *read(uint32_t timeout = BIOS_WAIT_FOREVER);
+        const float *channel(const float *block, uint8_t c) {
+            return (block + c * samples);
+        }
+        uint32_t overruns(void) { return (overrunCount); }
+
+    private:
+        static void blockFxn(const uint16_t *block, void *arg);
+
+        AnalogStream *stream;
+        float *buffers;             /* two blocks */
+        uint32_t blockLength;       /* channels * samples */
+        uint16_t samples;
+        uint8_t fill;               /* block converted next */
+        volatile bool pending;
+        volatile uint32_t overrunCount;
+        Semaphore_Struct readySem;
+};
+
+class DSPClass
+{
+    public:
+        /* raw ADC samples to [-1, 1) or q15 */
+        void fromADC(const uint16_t *raw, float *out, uint16_t count);
+        void fromADC(const uint16_t *raw, q15_t *out, uint16_t count);
+
+        /* out = in times a Hann window; in and out may be the same */
+        void hann(float *out, const float *in, uint16_t count);
+
+        float mean(const float *in, uint16_t count);
+        float rms(const float *in, uint16_t count);
+        float stddev(const float *in, uint16_t count);
+        float peak(const float *in, uint16_t count, uint16_t *index = NULL);
+        q15_t mean(const q15_t *in, uint16_t count);
+        q15_t rms(const q15_t *in, uint16_t count);
+};
+
+extern DSPClass DSP;
+
+#endif
@@ -0,0 +1,70 @@
+/*
+  Vibration
+
+  Samples an accelerometer axis on A0 at 4 kHz and, for each block of
+  512 samples (8 a second), removes gravity and drift with a 10 Hz high
+  pass biquad, then prints the RMS vibration level and the frequency
+  of the strongest component of the spectrum. Only those two numbers
+  leave the board, not the 4000 samples a second.
+
+  AnalogStream samples in the background; DSPInput converts each block
+  to floats in the stream's callback and the filter and FFT run here,
+  in loop().
+
+  This example code is in the public domain.
+*/
+
+#include <DSP.h>
+#include <AnalogStream.h>
+
+#define RATE     4000
+#define SAMPLES  512
+
+// 2nd order Butterworth high pass, 10 Hz at 4 kHz: b0, b1, b2, a1, a2
+const float highPass[] = {
+  0.98895425, -1.97790850, 0.98895425, 1.97778648, -0.97803051
+};
+
+uint8_t pins[] = {A0};
+uint16_t samples[2 * SAMPLES];
+float filtered[SAMPLES];
+float spectrum[SAMPLES / 2];
+
+AnalogStream stream;
+DSPInput input;
+BiquadFilter filter;
+RealFFT fft;
+
+void setup()
+{
+  Serial.begin(115200);
+
+  if (!stream.begin(pins, 1, RATE, samples, SAMPLES) ||
+      !input.begin(stream) || !filter.begin(highPass, 1) ||
+      !fft.begin(SAMPLES)) {
+    Serial.println("setup failed");
+    for (;;);
+  }
+}
+
+void loop()
+{
+  const float *block = input.read();
+  uint16_t bin;
+
+  filter.process(block, filtered, SAMPLES);
+  Serial.print("rms ");
+  Serial.print(DSP.rms(filtered, SAMPLES), 4);
+
+  DSP.hann(filtered, filtered, SAMPLES);
+  fft.magnitude(filtered, spectrum);
+  spectrum[0] = 0;
+  DSP.peak(spectrum, SAMPLES / 2, &bin);
+  Serial.print(" peak ");
+  Serial.print(bin * (float)RATE / SAMPLES, 1);
+  Serial.println(" Hz");
+
+  if (input.overruns() != 0) {
+    Serial.println("overrun");
+  }
+}
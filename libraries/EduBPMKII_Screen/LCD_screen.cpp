@@ -18,6 +18,15 @@
 //
 // Library header
 #include "LCD_screen.h"
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+#include <xdc/runtime/Error.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/compression/lz4/lz4_stream.h>
+#endif
+// Render list commands, a word each, then their words of arguments
+#define LCD_RENDER_POINT  1 // x, y, colour
+#define LCD_RENDER_FILL   2 // x1, y1, x2, y2, colour
+#define LCD_RENDER_PIXELS 3 // x0, y0, dx, dy, dx*dy pixels
 // Code
 LCD_screen::LCD_screen()
 {
@@ -27,6 +36,24 @@ LCD_screen::LCD_screen()
     _flagRead       = false;
     _flagStorage    = false;
     _touchTrim      = 0;
+    _buffer         = NULL;
+    _dirtyCount     = 0;
+    _scrollTop      = 0;
+    _scrollHeight   = 0;
+    _scrollOffset   = 0;
+    _scrollHardware = false;
+    _render[0]      = NULL;
+    _render[1]      = NULL;
+    _renderSize     = 0;
+    _renderLength   = 0;
+    _renderList     = 0;
+    _renderPending  = 0;
+    _renderPendingLength = 0;
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    _renderTask     = NULL;
+    Semaphore_construct(&_renderStart, 0, NULL);
+    Semaphore_construct(&_renderDone, 1, NULL);
+#endif
 }
 void LCD_screen::showInformation(uint16_t x0, uint16_t y0)
 {
@@ -64,6 +91,7 @@ void LCD_screen::clear(uint16_t colour)
 }
 void LCD_screen::setOrientation(uint8_t orientation)
 {
+    _renderWait();
     _orientation = orientation % 4;
 }
 uint8_t LCD_screen::getOrientation()
@@ -103,13 +131,14 @@ void LCD_screen::circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colo
     int16_t ddF_y = -2 * radius;
     int16_t x = 0;
     int16_t y = radius;
+    int16_t xs = 0;
     if (_penSolid == false) {
-        point(x0, y0+radius, colour);
-        point(x0, y0-radius, colour);
-        point(x0+radius, y0, colour);
-        point(x0-radius, y0, colour);
+        // Points of one octant that share y form a run, drawn as spans
+        // in all eight octants once y moves on
         while (x<y) {
             if (f >= 0) {
+                _circleSpans(x0, y0, xs, x, y, colour);
+                xs = x + 1;
                 y--;
                 ddF_y += 2;
                 f += ddF_y;
@@ -117,18 +146,16 @@ void LCD_screen::circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colo
             x++;
             ddF_x += 2;
             f += ddF_x;
-            point(x0 + x, y0 + y, colour);
-            point(x0 - x, y0 + y, colour);
-            point(x0 + x, y0 - y, colour);
-            point(x0 - x, y0 - y, colour);
-            point(x0 + y, y0 + x, colour);
-            point(x0 - y, y0 + x, colour);
-            point(x0 + y, y0 - x, colour);
-            point(x0 - y, y0 - x, colour);
         }
+        _circleSpans(x0, y0, xs, x, y, colour);
     } else {
+        // One horizontal span per row: rows y0±x at every step, rows
+        // y0±y at their widest, just before y moves on
+        _fill(x0 - radius, y0, x0 + radius, y0, colour);
         while (x<y) {
             if (f >= 0) {
+                _fill(x0 - x, y0 + y, x0 + x, y0 + y, colour);
+                _fill(x0 - x, y0 - y, x0 + x, y0 - y, colour);
                 y--;
                 ddF_y += 2;
                 f += ddF_y;
@@ -136,15 +163,22 @@ void LCD_screen::circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colo
             x++;
             ddF_x += 2;
             f += ddF_x;
-            line(x0 + x, y0 + y, x0 - x, y0 + y, colour);
-            line(x0 + x, y0 - y, x0 - x, y0 - y, colour);
-            line(x0 + y, y0 - x, x0 + y, y0 + x, colour);
-            line(x0 - y, y0 - x, x0 - y, y0 + x, colour);
+            _fill(x0 - y, y0 + x, x0 + y, y0 + x, colour);
+            _fill(x0 - y, y0 - x, x0 + y, y0 - x, colour);
         }
-        setPenSolid(true);
-        rectangle(x0-x, y0-y, x0+x, y0+y, colour);
     }
 }
+void LCD_screen::_circleSpans(uint16_t x0, uint16_t y0, int16_t xs, int16_t xe, int16_t y, uint16_t colour)
+{
+    _fill(x0 + xs, y0 + y, x0 + xe, y0 + y, colour);
+    _fill(x0 - xe, y0 + y, x0 - xs, y0 + y, colour);
+    _fill(x0 + xs, y0 - y, x0 + xe, y0 - y, colour);
+    _fill(x0 - xe, y0 - y, x0 - xs, y0 - y, colour);
+    _fill(x0 + y, y0 + xs, x0 + y, y0 + xe, colour);
+    _fill(x0 + y, y0 - xe, x0 + y, y0 - xs, colour);
+    _fill(x0 - y, y0 + xs, x0 - y, y0 + xe, colour);
+    _fill(x0 - y, y0 - xe, x0 - y, y0 - xs, colour);
+}
 void LCD_screen::dLine(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour)
 {
     line(x0, y0, x0+dx-1, y0+dy-1, colour);
@@ -152,9 +186,9 @@ void LCD_screen::dLine(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint1
 void LCD_screen::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
 {
     if ((x1 == x2) && (y1 == y2)) {
-        _setPoint(x1, y1, colour);
+        _point(x1, y1, colour);
     } else if ((x1 == x2) || (y1 == y2)) {
-        _fastFill(x1, y1, x2, y2, colour);
+        _fill(x1, y1, x2, y2, colour);
     } else {
         int16_t wx1 = (int16_t)x1;
         int16_t wx2 = (int16_t)x2;
@@ -175,10 +209,20 @@ void LCD_screen::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16
         int16_t ystep;
         if (wy1 < wy2) ystep = 1;
         else ystep = -1;
+        // Pixels that share a row (a column if steep) go as one span
+        int16_t start = wx1;
         for (; wx1<=wx2; wx1++) {
-            if (flag) _setPoint(wy1, wx1, colour);
-            else _setPoint(wx1, wy1, colour);
             err -= dy;
+            if ((err < 0) || (wx1 == wx2)) {
+                if (start == wx1) {
+                    if (flag) _point(wy1, wx1, colour);
+                    else _point(wx1, wy1, colour);
+                } else {
+                    if (flag) _fill(wy1, start, wy1, wx1, colour);
+                    else _fill(start, wy1, wx1, wy1, colour);
+                }
+                start = wx1 + 1;
+            }
             if (err < 0) {
                 wy1 += ystep;
                 err += dx;
@@ -192,7 +236,99 @@ void LCD_screen::setPenSolid(bool flag)
 }
 void LCD_screen::point(uint16_t x1, uint16_t y1, uint16_t colour)
 {
-    _setPoint(x1, y1, colour);
+    _point(x1, y1, colour);
+}
+void LCD_screen::pushPixels(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint16_t *pixels)
+{
+    if ((dx == 0) || (dy == 0)) return;
+    if (_buffer == NULL) {
+        // rows of the scroll area in as many pieces as are contiguous
+        for (uint16_t y=y0; y<y0+dy; ) {
+            uint16_t end = _scrollSpan(y, y0+dy-1);
+            _screenPixels(x0, _scrollRow(y), dx, end-y+1, pixels);
+            pixels += (uint32_t)(end-y+1)*dx;
+            y = end+1;
+        }
+        return;
+    }
+    for (uint16_t j=0; j<dy; j++) {
+        for (uint16_t i=0; i<dx; i++) {
+            if ((x0+i < screenSizeX()) && (y0+j < screenSizeY())) {
+                _buffer[(uint32_t)(y0+j)*screenSizeX() + x0+i] = _packColour(*pixels);
+            }
+            pixels++;
+        }
+    }
+    _markDirty(x0, y0, x0+dx-1, y0+dy-1);
+}
+void LCD_screen::_pushPixels(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint16_t *pixels)
+{
+    for (uint16_t j=0; j<dy; j++) {
+        for (uint16_t i=0; i<dx; i++) {
+            _setPoint(x0+i, y0+j, *pixels++);
+        }
+    }
+}
+void LCD_screen::drawBitmap(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint8_t *bitmap,
+                            uint16_t colour, uint16_t backColour)
+{
+    // Expand as many whole rows as fit in buffer, or pieces of a row
+    // wider than it, so pushPixels() sets a window per block, not per pixel
+    uint16_t buffer[LCD_BITMAP_BUFFER];
+    uint16_t bytesPerRow = (dx+7)/8;
+    uint16_t w = (dx < LCD_BITMAP_BUFFER) ? dx : LCD_BITMAP_BUFFER;
+    uint16_t h;
+    if (w == 0) return;
+    for (uint16_t j=0; j<dy; j+=h) {
+        h = LCD_BITMAP_BUFFER / w;
+        if (h > dy-j) h = dy-j;
+        for (uint16_t i=0; i<dx; i+=w) {
+            uint16_t n = (w < dx-i) ? w : dx-i;
+            uint16_t *p = buffer;
+            for (uint16_t r=0; r<h; r++) {
+                const uint8_t *row = bitmap + (uint32_t)(j+r)*bytesPerRow;
+                for (uint16_t k=i; k<i+n; k++) {
+                    *p++ = (row[k/8] & (0x80 >> (k%8))) ? colour : backColour;
+                }
+            }
+            pushPixels(x0+i, y0+j, n, h, buffer);
+        }
+    }
+}
+bool LCD_screen::drawCompressedBitmap(uint16_t x0, uint16_t y0, const uint8_t *image)
+{
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    // Header of 3 little endian words, width, height and rows per block,
+    // then per block its size and an LZ4 block of that many rows
+    uint16_t buffer[LCD_COMPRESSED_BUFFER];
+    uint16_t dx   = image[0] | (image[1] << 8);
+    uint16_t dy   = image[2] | (image[3] << 8);
+    uint16_t rows = image[4] | (image[5] << 8);
+    uint16_t h;
+    if ((dx == 0) || (rows == 0) || ((uint32_t)dx*rows > LCD_COMPRESSED_BUFFER)) return false;
+    image += 6;
+    for (uint16_t j=0; j<dy; j+=h) {
+        h = (rows < dy-j) ? rows : dy-j;
+        uint16_t size = image[0] | (image[1] << 8);
+        uint32_t length = (uint32_t)dx*h*2;
+        LZ4_streamDecompressBlockParams params;
+        LZ4_streamDecompressBlockState state;
+        LZ4_status status;
+        params.dst = buffer;
+        params.dstLength = length;
+        params.containsBlockSize = false;
+        LZ4_streamDecompressBlockInit(&params, &state, &status);
+        if (LZ4_streamDecompressBlock(&state, image+2, size, &status) != length) return false;
+        if (status != LZ4_SUCCESS) return false;
+        // Rows below the screen are dropped, as pushPixels() needs them on it
+        if (y0+j >= screenSizeY()) break;
+        pushPixels(x0, y0+j, dx, (y0+j+h <= screenSizeY()) ? h : screenSizeY()-y0-j, buffer);
+        image += 2 + size;
+    }
+    return true;
+#else
+    return false;
+#endif
 }
 void LCD_screen::rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
 {
@@ -202,93 +338,36 @@ void LCD_screen::rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, u
         line(x1, y2, x2, y2, colour);
         line(x2, y1, x2, y2, colour);
     } else {
-        _fastFill(x1, y1, x2, y2, colour);
+        _fill(x1, y1, x2, y2, colour);
     }
 }
 void LCD_screen::dRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour)
 {
     rectangle(x0, y0, x0+dx-1, y0+dy-1, colour);
 }
-void LCD_screen::_triangleArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour)
-{
-    int16_t wx1 = (int16_t)x1;
-    int16_t wy1 = (int16_t)y1;
-    int16_t wx2 = (int16_t)x2;
-    int16_t wy2 = (int16_t)y2;
-    int16_t wx3 = (int16_t)x3;
-    int16_t wy3 = (int16_t)y3;
-    int16_t wx4 = wx1;
-    int16_t wy4 = wy1;
-    int16_t wx5 = wx1;
-    int16_t wy5 = wy1;
-    bool changed1 = false;
-    bool changed2 = false;
-    int16_t dx1 = abs(wx2 - wx1);
-    int16_t dy1 = abs(wy2 - wy1);
-    int16_t dx2 = abs(wx3 - wx1);
-    int16_t dy2 = abs(wy3 - wy1);
-    int16_t signx1 = (wx2 >= wx1) ? +1 : -1;
-    int16_t signx2 = (wx3 >= wx1) ? +1 : -1;
-    int16_t signy1 = (wy2 >= wy1) ? +1 : -1;
-    int16_t signy2 = (wy3 >= wy1) ? +1 : -1;
-    if (dy1 > dx1) {
-        _swap(dx1, dy1);
-        changed1 = true;
-    }
-    if (dy2 > dx2) {
-        _swap(dx2, dy2);
-        changed2 = true;
-    }
-    int16_t e1 = 2 * dy1 - dx1;
-    int16_t e2 = 2 * dy2 - dx2;
-    for (int i = 0; i <= dx1; i++) {
-        line(wx4, wy4, wx5, wy5, colour);
-        while (e1 >= 0) {
-            if (changed1) wx4 += signx1;
-            else wy4 += signy1;
-            e1 = e1 - 2 * dx1;
-        }
-        if (changed1) wy4 += signy1;
-        else wx4 += signx1;
-        e1 = e1 + 2 * dy1;
-        while (wy5 != wy4) {
-            while (e2 >= 0) {
-                if (changed2) wx5 += signx2;
-                else wy5 += signy2;
-                e2 = e2 - 2 * dx2;
-            }
-            if (changed2) wy5 += signy2;
-            else wx5 += signx2;
-            e2 = e2 + 2 * dy2;
-        }
-    }
-}
 void LCD_screen::triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour)
 {
     if (_penSolid) {
-        bool b = true;
-        while (b) {
-            b = false;
-            if ((b == false) && (y1 > y2)) {
-                _swap(x1, x2);
-                _swap(y1, y2);
-                b = true;
-            }
-            if ((b == false) && (y2 > y3)) {
-                _swap(x3, x2);
-                _swap(y3, y2);
-                b = true;
-            }
+        // Sort by y, then one span per row between the long edge 1-3
+        // and the short edges 1-2 and 2-3
+        if (y1 > y2) { _swap(x1, x2); _swap(y1, y2); }
+        if (y2 > y3) { _swap(x2, x3); _swap(y2, y3); }
+        if (y1 > y2) { _swap(x1, x2); _swap(y1, y2); }
+        if (y1 == y3) {
+            _fill(min(x1, min(x2, x3)), y1, max(x1, max(x2, x3)), y1, colour);
+            return;
         }
-        if (y2 == y3) {
-            _triangleArea(x1, y1, x2, y2, x3, y3, colour);
-        } else if (y1 == y2) {
-            _triangleArea(x3, y3, x1, y1, x2, y2, colour);
-        } else {
-            uint16_t x4 = (uint16_t)( (int32_t)x1 + (y2 - y1) * (x3 - x1) / (y3 - y1) );
-            uint16_t y4 = y2;
-            _triangleArea(x1, y1, x2, y2, x4, y4, colour);
-            _triangleArea(x3, y3, x2, y2, x4, y4, colour);
+        for (int32_t y = y1; y <= y3; y++) {
+            int32_t xa = (int32_t)x1 + ((int32_t)x3 - x1) * (y - y1) / ((int32_t)y3 - y1);
+            int32_t xb;
+            if (y < y2) {
+                xb = (int32_t)x1 + ((int32_t)x2 - x1) * (y - y1) / ((int32_t)y2 - y1);
+            } else if (y3 == y2) {
+                xb = x2;
+            } else {
+                xb = (int32_t)x2 + ((int32_t)x3 - x2) * (y - y2) / ((int32_t)y3 - y2);
+            }
+            _fill(xa, y, xb, y, colour);
         }
     } else {
         line(x1, y1, x2, y2, colour);
@@ -356,6 +435,348 @@ bool LCD_screen::isTouch()
 {
     return (_touchTrim > 0);
 }
+void LCD_screen::setBackBuffer(uint8_t *buffer)
+{
+    _renderWait();
+    // the buffer scrolls in RAM: show the area as it was drawn
+    if (_scrollOffset != 0) {
+        _scrollOffset = 0;
+        _scrollStart(0);
+    }
+    _buffer = buffer;
+    _dirtyCount = 0;
+}
+void LCD_screen::flush()
+{
+    // Each area goes out as blocks of whole rows, each block one
+    // _pushPixels() window; rows wider than the buffer go in pieces
+    uint16_t line[LCD_FLUSH_BUFFER];
+    for (uint8_t a=0; (_buffer != NULL) && (a<_dirtyCount); a++) {
+        uint16_t x1 = _dirty[a][0];
+        uint16_t y1 = _dirty[a][1];
+        uint16_t dx = _dirty[a][2] - x1 + 1;
+        uint16_t dy = _dirty[a][3] - y1 + 1;
+        uint16_t w = (dx < LCD_FLUSH_BUFFER) ? dx : LCD_FLUSH_BUFFER;
+        uint16_t h;
+        for (uint16_t j=0; j<dy; j+=h) {
+            h = LCD_FLUSH_BUFFER / w;
+            if (h > dy-j) h = dy-j;
+            for (uint16_t i=0; i<dx; i+=w) {
+                uint16_t n = (w < dx-i) ? w : dx-i;
+                uint16_t *p = line;
+                for (uint16_t r=0; r<h; r++) {
+                    uint8_t *q = _buffer + (uint32_t)(y1+j+r)*screenSizeX() + x1+i;
+                    for (uint16_t k=0; k<n; k++) {
+                        *p++ = _unpackColour(*q++);
+                    }
+                }
+                _screenPixels(x1+i, y1+j, n, h, line);
+            }
+        }
+    }
+    _dirtyCount = 0;
+    _renderSubmit();
+}
+bool LCD_screen::setRenderBuffer(uint16_t *buffer, uint16_t size, int priority)
+{
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    _renderWait();
+    _render[0] = NULL;
+    if (buffer == NULL) return true;
+    if (_renderTask == NULL) {
+        Task_Params params;
+        Task_Params_init(&params);
+        params.arg0 = (UArg)this;
+        params.stackSize = LCD_RENDER_STACK;
+        params.priority = priority;
+        params.instance->name = (xdc_String)"render";
+        _renderTask = Task_create(_renderFxn, &params, Error_IGNORE);
+        if (_renderTask == NULL) return false;
+    } else {
+        Task_setPri(_renderTask, priority);
+    }
+    _renderSize = size / 2;
+    _render[0] = buffer;
+    _render[1] = buffer + _renderSize;
+    _renderLength = 0;
+    _renderList = 0;
+    return true;
+#else
+    return false;
+#endif
+}
+void LCD_screen::setScrollArea(uint16_t top, uint16_t bottom)
+{
+    _renderWait();
+    if (_scrollOffset != 0) {
+        _scrollOffset = 0;
+        _scrollStart(0);
+    }
+    if (top + bottom >= screenSizeY()) {
+        _scrollHeight = 0;
+        return;
+    }
+    _scrollTop = top;
+    _scrollHeight = screenSizeY() - top - bottom;
+    _scrollHardware = _scrollArea(top, _scrollHeight);
+}
+void LCD_screen::scroll(int16_t lines, uint16_t colour)
+{
+    if (_scrollHeight == 0) return;
+    int16_t n = lines % (int16_t)_scrollHeight;
+    if (n == 0) return;
+    uint16_t top = _scrollTop;
+    uint16_t bottom = _scrollTop + _scrollHeight - 1;
+    if (_buffer != NULL) {
+        uint16_t w = screenSizeX();
+        if (n > 0) memmove(_buffer + (uint32_t)top*w, _buffer + (uint32_t)(top+n)*w, (uint32_t)(_scrollHeight-n)*w);
+        else memmove(_buffer + (uint32_t)(top-n)*w, _buffer + (uint32_t)top*w, (uint32_t)(_scrollHeight+n)*w);
+        _markDirty(0, top, w-1, bottom);
+    } else if (_scrollHardware) {
+        _renderWait();
+        _scrollOffset = (_scrollOffset + _scrollHeight + n) % _scrollHeight;
+        _scrollStart(_scrollOffset);
+    } else {
+        // nothing to move the pixels with: the area starts over
+        _fill(0, top, screenSizeX()-1, bottom, colour);
+        return;
+    }
+    if (n > 0) _fill(0, bottom-n+1, screenSizeX()-1, bottom, colour);
+    else _fill(0, top, screenSizeX()-1, top-n-1, colour);
+}
+bool LCD_screen::_scrollArea(uint16_t top, uint16_t height)
+{
+    return false;
+}
+void LCD_screen::_scrollStart(uint16_t offset)
+{
+}
+// Once the hardware scrolled by _scrollOffset, screen row y of the
+// scroll area shows what was drawn to row _scrollRow(y)
+uint16_t LCD_screen::_scrollRow(uint16_t y)
+{
+    if ((_scrollOffset == 0) || (y < _scrollTop) || (y >= _scrollTop + _scrollHeight)) return y;
+    return _scrollTop + (y - _scrollTop + _scrollOffset) % _scrollHeight;
+}
+// Last row from y1 to y2 that _scrollRow() keeps contiguous with y1
+uint16_t LCD_screen::_scrollSpan(uint16_t y1, uint16_t y2)
+{
+    uint16_t end = y2;
+    if (_scrollOffset == 0) return end;
+    if (y1 < _scrollTop) {
+        end = _scrollTop - 1;
+    } else if (y1 < _scrollTop + _scrollHeight) {
+        uint16_t wrap = _scrollTop + _scrollHeight - _scrollOffset;
+        end = (y1 < wrap) ? wrap - 1 : _scrollTop + _scrollHeight - 1;
+    }
+    return (end < y2) ? end : y2;
+}
+// What goes to the screen goes through these: drawn now, or recorded
+// for the render task
+void LCD_screen::_screenPoint(uint16_t x1, uint16_t y1, uint16_t colour)
+{
+    uint16_t *p = _renderReserve(4);
+    if (p == NULL) {
+        _renderWait();
+        _setPoint(x1, y1, colour);
+        return;
+    }
+    p[0] = LCD_RENDER_POINT;
+    p[1] = x1;
+    p[2] = y1;
+    p[3] = colour;
+}
+void LCD_screen::_screenFill(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    uint16_t *p = _renderReserve(6);
+    if (p == NULL) {
+        _renderWait();
+        _fastFill(x1, y1, x2, y2, colour);
+        return;
+    }
+    p[0] = LCD_RENDER_FILL;
+    p[1] = x1;
+    p[2] = y1;
+    p[3] = x2;
+    p[4] = y2;
+    p[5] = colour;
+}
+// As many rows as fit in a list per command; rows longer than a
+// list go out directly, once the task caught up
+void LCD_screen::_screenPixels(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint16_t *pixels)
+{
+    uint16_t rows = (_renderSize > 5) ? (_renderSize - 5) / dx : 0;
+    if ((_render[0] == NULL) || (rows == 0)) {
+        _renderWait();
+        _pushPixels(x0, y0, dx, dy, pixels);
+        return;
+    }
+    for (uint16_t j=0; j<dy; j+=rows) {
+        uint16_t h = (rows < dy-j) ? rows : dy-j;
+        uint16_t *p = _renderReserve(5 + h*dx);
+        p[0] = LCD_RENDER_PIXELS;
+        p[1] = x0;
+        p[2] = y0+j;
+        p[3] = dx;
+        p[4] = h;
+        memcpy(p+5, pixels + (uint32_t)j*dx, 2*h*dx);
+    }
+}
+// words at the end of the list recorded, once the other one is handed
+// over if they do not fit; NULL if not recording or never fit
+uint16_t *LCD_screen::_renderReserve(uint16_t words)
+{
+    if ((_render[0] == NULL) || (words > _renderSize)) return NULL;
+    if (_renderLength + words > _renderSize) _renderSubmit();
+    uint16_t *p = _render[_renderList] + _renderLength;
+    _renderLength += words;
+    return p;
+}
+// Hand the list recorded to the task, once done with the other one,
+// and record into that one
+void LCD_screen::_renderSubmit()
+{
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    if ((_render[0] == NULL) || (_renderLength == 0)) return;
+    Semaphore_pend(Semaphore_handle(&_renderDone), BIOS_WAIT_FOREVER);
+    _renderPending = _renderList;
+    _renderPendingLength = _renderLength;
+    _renderList ^= 1;
+    _renderLength = 0;
+    Semaphore_post(Semaphore_handle(&_renderStart));
+#endif
+}
+// Everything recorded on the screen, before what does not go through
+// the lists: commands, readings, direct drawing
+void LCD_screen::_renderWait()
+{
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    if (_render[0] == NULL) return;
+    _renderSubmit();
+    Semaphore_pend(Semaphore_handle(&_renderDone), BIOS_WAIT_FOREVER);
+    Semaphore_post(Semaphore_handle(&_renderDone));
+#endif
+}
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+void LCD_screen::_renderFxn(UArg arg0, UArg arg1)
+{
+    LCD_screen *screen = (LCD_screen *)arg0;
+    for (;;) {
+        Semaphore_pend(Semaphore_handle(&screen->_renderStart), BIOS_WAIT_FOREVER);
+        screen->_renderReplay(screen->_render[screen->_renderPending], screen->_renderPendingLength);
+        Semaphore_post(Semaphore_handle(&screen->_renderDone));
+    }
+}
+#endif
+void LCD_screen::_renderReplay(const uint16_t *list, uint16_t length)
+{
+    const uint16_t *end = list + length;
+    while (list < end) {
+        switch (list[0]) {
+            case LCD_RENDER_POINT:
+                _setPoint(list[1], list[2], list[3]);
+                list += 4;
+                break;
+            case LCD_RENDER_FILL:
+                _fastFill(list[1], list[2], list[3], list[4], list[5]);
+                list += 6;
+                break;
+            case LCD_RENDER_PIXELS:
+                _pushPixels(list[1], list[2], list[3], list[4], list+5);
+                list += 5 + list[3]*list[4];
+                break;
+            default:
+                return;
+        }
+    }
+}
+// Primitives draw through these: onto the screen, or into the back
+// buffer and its dirty areas
+void LCD_screen::_point(uint16_t x1, uint16_t y1, uint16_t colour)
+{
+    if (_buffer == NULL) {
+        _screenPoint(x1, _scrollRow(y1), colour);
+        return;
+    }
+    if ((x1 >= screenSizeX()) || (y1 >= screenSizeY())) return;
+    _buffer[(uint32_t)y1*screenSizeX() + x1] = _packColour(colour);
+    _markDirty(x1, y1, x1, y1);
+}
+void LCD_screen::_fill(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    if (x1 > x2) _swap(x1, x2);
+    if (y1 > y2) _swap(y1, y2);
+    if (_buffer == NULL) {
+        for (uint16_t y=y1; y<=y2; ) {
+            uint16_t end = _scrollSpan(y, y2);
+            _screenFill(x1, _scrollRow(y), x2, _scrollRow(end), colour);
+            if (end == 0xffff) break;
+            y = end+1;
+        }
+        return;
+    }
+    if ((x1 >= screenSizeX()) || (y1 >= screenSizeY())) return;
+    if (x2 >= screenSizeX()) x2 = screenSizeX()-1;
+    if (y2 >= screenSizeY()) y2 = screenSizeY()-1;
+    uint8_t c = _packColour(colour);
+    for (uint16_t j=y1; j<=y2; j++) {
+        memset(_buffer + (uint32_t)j*screenSizeX() + x1, c, x2-x1+1);
+    }
+    _markDirty(x1, y1, x2, y2);
+}
+void LCD_screen::_markDirty(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    // An area already covering this one takes it, else a new one, else
+    // the two areas whose union wastes the fewest pixels are merged
+    if ((x1 >= screenSizeX()) || (y1 >= screenSizeY())) return;
+    if (x2 >= screenSizeX()) x2 = screenSizeX()-1;
+    if (y2 >= screenSizeY()) y2 = screenSizeY()-1;
+    for (uint8_t a=0; a<_dirtyCount; a++) {
+        if ((_dirty[a][0] <= x1) && (_dirty[a][1] <= y1) && (_dirty[a][2] >= x2) && (_dirty[a][3] >= y2)) return;
+    }
+    if (_dirtyCount == LCD_DIRTY_AREAS) {
+        uint8_t best1 = 0, best2 = 1;
+        int32_t bestWaste = 0x7fffffff;
+        for (uint8_t a=0; a<_dirtyCount; a++) {
+            for (uint8_t b=a+1; b<_dirtyCount; b++) {
+                int32_t waste = (int32_t)(max(_dirty[a][2], _dirty[b][2]) - min(_dirty[a][0], _dirty[b][0]) + 1)
+                              * (max(_dirty[a][3], _dirty[b][3]) - min(_dirty[a][1], _dirty[b][1]) + 1)
+                              - (int32_t)(_dirty[a][2] - _dirty[a][0] + 1) * (_dirty[a][3] - _dirty[a][1] + 1)
+                              - (int32_t)(_dirty[b][2] - _dirty[b][0] + 1) * (_dirty[b][3] - _dirty[b][1] + 1);
+                if (waste < bestWaste) {
+                    bestWaste = waste;
+                    best1 = a;
+                    best2 = b;
+                }
+            }
+        }
+        _dirty[best1][0] = min(_dirty[best1][0], _dirty[best2][0]);
+        _dirty[best1][1] = min(_dirty[best1][1], _dirty[best2][1]);
+        _dirty[best1][2] = max(_dirty[best1][2], _dirty[best2][2]);
+        _dirty[best1][3] = max(_dirty[best1][3], _dirty[best2][3]);
+        _dirtyCount--;
+        for (uint8_t i=0; i<4; i++) _dirty[best2][i] = _dirty[_dirtyCount][i];
+    }
+    _dirty[_dirtyCount][0] = x1;
+    _dirty[_dirtyCount][1] = y1;
+    _dirty[_dirtyCount][2] = x2;
+    _dirty[_dirtyCount][3] = y2;
+    _dirtyCount++;
+}
+uint8_t LCD_screen::_packColour(uint16_t rgb)
+{
+    return ((rgb >> 8) & 0b11100000) | ((rgb >> 6) & 0b00011100) | ((rgb >> 3) & 0b00000011);
+}
+uint16_t LCD_screen::_unpackColour(uint8_t rgb332)
+{
+    uint16_t red   = (rgb332 >> 5) & 0b111;
+    uint16_t green = (rgb332 >> 2) & 0b111;
+    uint16_t blue  = rgb332 & 0b11;
+    red   = (red << 2) | (red >> 1);
+    green = (green << 3) | green;
+    blue  = (blue << 3) | (blue << 1) | (blue >> 1);
+    return (red << 11) | (green << 5) | blue;
+}
 bool LCD_screen::isReadable()
 {
     return _flagRead;
@@ -366,6 +787,9 @@ bool LCD_screen::isStorage()
 }
 uint16_t LCD_screen::readPixel(uint16_t x1, uint16_t y1)
 {
+    if ((_buffer != NULL) && (x1 < screenSizeX()) && (y1 < screenSizeY())) {
+        return _unpackColour(_buffer[(uint32_t)y1*screenSizeX() + x1]);
+    }
     return 0;
 }
 void LCD_screen::copyPaste(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t dx, uint16_t dy)
@@ -41,7 +41,21 @@
 #endif
 #ifndef LCD_SCREEN_RELEASE
 #define LCD_SCREEN_RELEASE 114
+/// Pixels drawBitmap() expands per pushPixels()
+#define LCD_BITMAP_BUFFER 64
+/// Pixels drawCompressedBitmap() decompresses per block, at most
+#define LCD_COMPRESSED_BUFFER 256
+/// Areas flush() keeps apart before merging the closest ones
+#define LCD_DIRTY_AREAS 4
+/// Pixels flush() expands per transfer to the screen
+#define LCD_FLUSH_BUFFER 128
+/// Stack of the task setRenderBuffer() starts
+#define LCD_RENDER_STACK 1024
 #include "LCD_utilities.h"
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/knl/Task.h>
+#endif
 const uint16_t blackColour    = 0b0000000000000000;
 const uint16_t whiteColour    = 0b1111111111111111;
 const uint16_t redColour      = 0b1111100000000000;
@@ -55,6 +69,7 @@ const uint16_t violetColour   = 0b1111100000011111;
 const uint16_t grayColour     = 0b0111101111101111;
 const uint16_t darkGrayColour = 0b0011100111100111;
 class LCD_screen {
+    friend class LCD_screen_grlib;
 public:
     LCD_screen();
     virtual void begin() =0;
@@ -74,6 +89,17 @@ public:
     virtual void rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
     virtual void dRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour);
     virtual void point(uint16_t x1, uint16_t y1, uint16_t colour);
+    /// Draw dx*dy pixels, row by row from the top left, at (x0, y0).
+    /// The area must fit on the screen.
+    void pushPixels(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint16_t *pixels);
+    /// Draw a 1-bit bitmap, rows of (dx+7)/8 bytes with the most significant bit leftmost.
+    void drawBitmap(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint8_t *bitmap,
+                    uint16_t colour = whiteColour, uint16_t backColour = blackColour);
+    /// Draw a picture compressed by tools/LCD_compress.py: blocks of whole
+    /// rows, each an LZ4 block, decompressed one at a time and pushed.
+    /// The width must fit on the screen; rows below it are left out.
+    /// false if a block is larger than LCD_COMPRESSED_BUFFER or corrupted.
+    bool drawCompressedBitmap(uint16_t x0, uint16_t y0, const uint8_t *image);
     virtual void setFontSize(uint8_t size) =0;
     virtual void setFontSolid(bool flag = true);
     virtual uint8_t fontSizeX() =0;
@@ -93,6 +119,26 @@ public:
     virtual void copyPaste(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t dx, uint16_t dy);
     virtual void copyArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint32_t &address);
     virtual void pasteArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint32_t &address, bool option=false);
+    /// Draw into buffer, screenSizeX()*screenSizeY() bytes of RGB 3-3-2 colours,
+    /// instead of onto the screen, until flush() sends the areas drawn since.
+    /// NULL draws directly again. The buffer follows the orientation: flush()
+    /// before setOrientation().
+    void setBackBuffer(uint8_t *buffer);
+    void flush();
+    /// Record what goes to the screen into two lists of size/2 words of
+    /// buffer, sent by a task at priority: flush() or a full list hands
+    /// the recorded one over, and waits only while the task still sends
+    /// the other one. NULL sends what is left and draws directly again.
+    /// false if the task could not be created.
+    bool setRenderBuffer(uint16_t *buffer, uint16_t size, int priority = 1);
+    /// Scroll the rows between top fixed rows and bottom fixed rows with
+    /// scroll(); top + bottom >= screenSizeY() stops scrolling. Set it
+    /// again after setOrientation().
+    void setScrollArea(uint16_t top, uint16_t bottom);
+    /// Move the scroll area up by lines, down if negative, and fill the
+    /// rows that come in with colour. Screens without hardware scrolling
+    /// move the back buffer, or without one just clear the area.
+    void scroll(int16_t lines, uint16_t colour = blackColour);
     bool isTouch();
     bool getTouch(uint16_t &x, uint16_t &y, uint16_t &z);
     void calibrateTouch();
@@ -103,17 +149,47 @@ protected:
     uint16_t     _screenWidth, _screenHeigth;
     uint8_t      _touchTrim;
     uint16_t     _touchXmin, _touchXmax, _touchYmin, _touchYmax;
+    uint8_t      *_buffer;
+    uint8_t      _dirtyCount;
+    uint16_t     _dirty[LCD_DIRTY_AREAS][4];
+    uint16_t     _scrollTop, _scrollHeight, _scrollOffset;
+    bool         _scrollHardware;
+    uint16_t     *_render[2];
+    uint16_t     _renderSize, _renderLength, _renderPendingLength;
+    uint8_t      _renderList, _renderPending;
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    Task_Handle  _renderTask;
+    Semaphore_Struct _renderStart, _renderDone;
+    static void  _renderFxn(UArg arg0, UArg arg1);
+#endif
     virtual void _fastFill(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour) =0;
     virtual void _setPoint(uint16_t x1, uint16_t y1, uint16_t colour) =0;
     virtual void _getRawTouch(uint16_t &x0, uint16_t &y0, uint16_t &z0) =0;
     virtual void _setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) =0;
     virtual void _writeData88(uint8_t dataHigh8, uint8_t dataLow8) =0;
+    virtual void _pushPixels(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint16_t *pixels);
+    virtual bool _scrollArea(uint16_t top, uint16_t height);
+    virtual void _scrollStart(uint16_t offset);
+    uint16_t     _scrollRow(uint16_t y);
+    uint16_t     _scrollSpan(uint16_t y1, uint16_t y2);
+    void         _screenPoint(uint16_t x1, uint16_t y1, uint16_t colour);
+    void         _screenFill(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+    void         _screenPixels(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint16_t *pixels);
+    uint16_t     *_renderReserve(uint16_t words);
+    void         _renderSubmit();
+    void         _renderWait();
+    void         _renderReplay(const uint16_t *list, uint16_t length);
+    void         _point(uint16_t x1, uint16_t y1, uint16_t colour);
+    void         _fill(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+    void         _markDirty(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+    uint8_t      _packColour(uint16_t rgb);
+    uint16_t     _unpackColour(uint8_t rgb332);
     void         _displayTarget(uint16_t x0, uint16_t y0, uint16_t colour);
     void         _swap(int16_t &a, int16_t &b);
     void         _swap(uint16_t &a, uint16_t &b);
     void         _swap(uint8_t &a, uint8_t &b);
     uint16_t     _check(uint16_t x0, uint16_t xmin, uint16_t xmax);
-    void         _triangleArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour);
+    void         _circleSpans(uint16_t x0, uint16_t y0, int16_t xs, int16_t xe, int16_t y, uint16_t colour);
     bool         _inValue(int16_t value, int16_t valueLow, int16_t valueHigh);
     bool         _inSector(int16_t valueStart, int16_t valueEnd, int16_t sectorLow, int16_t sectorHigh,
                            int16_t criteriaStart, int16_t criteriaEnd, int16_t criteriaLow, int16_t criteriaHigh,
@@ -100,215 +100,59 @@ void LCD_screen_font::gText(uint16_t x0, uint16_t y0,
                             uint8_t ix, uint8_t iy)
 {
     uint8_t c;
-    uint8_t line, line1, line2, line3;
-    uint16_t x, y;
-    uint8_t i, j, k;
+    uint8_t i, j, e;
+    uint16_t k;
+    uint8_t fx = fontSizeX();
+    uint8_t fy = fontSizeY();
+    if ((fx == 0) || (s.length() == 0)) return;
     if ((ix > 1) || (iy > 1) || !_fontSolid) {
-        if ((_fontSize == 0) && ((ix > 1) || (iy > 1))) {
-            bool oldPenSolid = _penSolid;
-            setPenSolid(true);
-            for (k=0; k<s.length(); k++) {
-                x = x0 + 6 * k * ix;
-                y = y0;
-                c = s.charAt(k)-' ';
-                for ( i=0; i<6; i++ ) {
-                    line = _getCharacter(c, i);
-                    for ( j = 0; j<8; j++) {
-                        if (bitRead(line, j)) rectangle(x+i*ix, y+j*iy, x+i*ix+ix-1, y+j*iy+iy-1, textColour);
-                        else if (_fontSolid)  rectangle(x+i*ix, y+j*iy, x+i*ix+ix-1, y+j*iy+iy-1, backColour);
-                    }
-                }
-            }
-            setPenSolid(oldPenSolid);
-        } else {
-#if (MAX_FONT_SIZE > 0)
-            if (_fontSize == 0) {
-                for (k=0; k<s.length(); k++) {
-                    c = s.charAt(k)-' ';
-                    for (i=0; i<6; i++) {
-                        line = _getCharacter(c, i);
-                        for (j=0; j<8; j++)
-                            if (bitRead(line, j)) point(x0 + 6*k + i, y0 + j, textColour);
-                            else if (_fontSolid)  point(x0 + 6*k + i, y0 + j, backColour);
-                    }
-                }
-            }
-#if (MAX_FONT_SIZE > 1)
-            else if (_fontSize == 1) {
-                for (k=0; k<s.length(); k++) {
-                    c = s.charAt(k)-' ';
-                    for (i=0; i<8; i++) {
-                        line = _getCharacter(c, 2*i);
-                        line1 =_getCharacter(c, 2*i+1);
-                        for (j=0; j<8; j++) {
-                            if (bitRead(line, j)) point(x0 + 8*k + i, y0 + j, textColour);
-                            else if (_fontSolid)  point(x0 + 8*k + i, y0 + j, backColour);
-                            if (bitRead(line1, j))  point(x0 + 8*k + i, y0 +8 + j, textColour);
-                            else if ((_fontSolid) && (j<4)) point(x0 + 8*k + i, y0 +8 + j, backColour);
-                        }
-                    }
-                }
-            }
-#if (MAX_FONT_SIZE > 2)
-            else if (_fontSize == 2) {
-                for (k=0; k<s.length(); k++) {
-                    c = s.charAt(k)-' ';
-                    for (i=0; i<12; i++) {
-                        line = _getCharacter(c, 2*i);
-                        line1 =_getCharacter(c, 2*i+1);
-                        for (j=0; j<8; j++) {
-                            if (bitRead(line, j))  point(x0 + 12*k + i, y0 + j,    textColour);
-                            else if (_fontSolid)   point(x0 + 12*k + i, y0 + j,    backColour);
-                            if (bitRead(line1, j)) point(x0 + 12*k + i, y0 +8 + j, textColour);
-                            else if (_fontSolid)   point(x0 + 12*k + i, y0 +8 + j, backColour);
-                        }
-                    }
-                }
-            }
-#if (MAX_FONT_SIZE > 3)
-            else if (_fontSize == 3) {
-                for (k=0; k<s.length(); k++) {
-                    c = s.charAt(k)-' ';
-                    for (i=0; i<16; i++) {
-                        line  =_getCharacter(c, 3*i);
-                        line1 =_getCharacter(c, 3*i+1);
-                        line2 =_getCharacter(c, 3*i+2);
-                        for (j=0; j<8; j++) {
-                            if (bitRead(line, j))  point(x0 + 16*k + i, y0 + j,     textColour);
-                            else if (_fontSolid)   point(x0 + 16*k + i, y0 + j,     backColour);
-                            if (bitRead(line1, j)) point(x0 + 16*k + i, y0 +8 + j,  textColour);
-                            else if (_fontSolid)   point(x0 + 16*k + i, y0 +8 + j,  backColour);
-                            if (bitRead(line2, j)) point(x0 + 16*k + i, y0 +16 + j, textColour);
-                            else if (_fontSolid)   point(x0 + 16*k + i, y0 +16 + j, backColour);
-                        }
-                    }
-                }
-            }
-#endif
-#endif
-#endif
-#endif
+        // Only the smallest font scales. Each run of like pixels down a
+        // glyph column is one fill; background runs only if solid
+        if (_fontSize != 0) {
+            ix = 1;
+            iy = 1;
         }
-    } else {
-        uint8_t c;
-        uint8_t line, line1;
-        uint16_t x, y;
-        uint8_t i, j, k;
-        uint8_t highTextColour = highByte(textColour);
-        uint8_t lowTextColour = lowByte(textColour);
-        uint8_t highBackColour = highByte(backColour);
-        uint8_t lowBackColour = lowByte(backColour);
-#if (MAX_FONT_SIZE > 0)
-        if (_fontSize == 0) {
-            for (k=0; k<s.length(); k++) {
-                c = s.charAt(k)-' ';
-                _setWindow(x0 +fontSizeX()*k, y0, x0 +fontSizeX()*(k+1)-1, y0+fontSizeY()-1);
-                for (j=0; j<8; j++) {
-                    for (i=0; i<6; i++) {
-                        line = _getCharacter(c, i);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
+        for (k=0; k<s.length(); k++) {
+            c = s.charAt(k)-' ';
+            for (i=0; i<fx; i++) {
+                uint16_t x = x0 + (fx*k + i) * ix;
+                for (j=0; j<fy; j=e) {
+                    bool set = _getGlyphPixel(c, i, j);
+                    for (e=j+1; (e<fy) && (_getGlyphPixel(c, i, e) == set); e++);
+                    if (set || _fontSolid) {
+                        _fill(x, y0 + j*iy, x + ix-1, y0 + e*iy-1, set ? textColour : backColour);
                     }
                 }
             }
         }
-#if (MAX_FONT_SIZE > 1)
-        else if (_fontSize == 1) {
-            for (k=0; k<s.length(); k++) {
-                c = s.charAt(k)-' ';
-                _setWindow(x0 +fontSizeX()*k, y0, x0 +fontSizeX()*(k+1)-1, y0+fontSizeY()-1);
-                for (j=0; j<8; j++) {
-                    for (i=0; i<8; i++) {
-                        line = _getCharacter(c, 2*i);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
-                }
-                for (j=0; j<4; j++) {
-                    for (i=0; i<8; i++) {
-                        line = _getCharacter(c, 2*i+1);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
-                }
-            }
-        }
-#if (MAX_FONT_SIZE > 2)
-        else if (_fontSize == 2) {
-            for (k=0; k<s.length(); k++) {
-                c = s.charAt(k)-' ';
-                _setWindow(x0 +fontSizeX()*k, y0, x0 +fontSizeX()*(k+1)-1, y0+fontSizeY()-1);
-                for (j=0; j<8; j++) {
-                    for (i=0; i<12; i++) {
-                        line = _getCharacter(c, 2*i);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
-                }
-                for (j=0; j<8; j++) {
-                    for (i=0; i<12; i++) {
-                        line = _getCharacter(c, 2*i+1);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
-                }
-            }
-        }
-#if (MAX_FONT_SIZE > 3)
-        else if (_fontSize == 3) {
-            for (k=0; k<s.length(); k++) {
-                c = s.charAt(k)-' ';
-                _setWindow(x0 +fontSizeX()*k, y0, x0 +fontSizeX()*(k+1)-1, y0+fontSizeY()-1);
-                for (j=0; j<8; j++) {
-                    for (i=0; i<16; i++) {
-                        line = _getCharacter(c, 3*i);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
-                }
-                for (j=0; j<8; j++) {
-                    for (i=0; i<16; i++) {
-                        line = _getCharacter(c, 3*i+1);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
-                        }
-                    }
-                }
-                for (j=0; j<8; j++) {
-                    for (i=0; i<16; i++) {
-                        line = _getCharacter(c, 3*i+2);
-                        if (bitRead(line, j)) {
-                            _writeData88(highTextColour, lowTextColour);
-                        } else {
-                            _writeData88(highBackColour, lowBackColour);
+    } else {
+        // Glyphs side by side in buffer, as many as fit, or bands of
+        // rows of one glyph taller than it: one pushPixels() each
+        uint16_t buffer[LCD_TEXT_BUFFER];
+        uint8_t h = (LCD_TEXT_BUFFER / fx < fy) ? LCD_TEXT_BUFFER / fx : fy;
+        uint16_t n = LCD_TEXT_BUFFER / (fx*h);
+        for (k=0; k<s.length(); k+=n) {
+            uint16_t glyphs = (s.length()-k < n) ? s.length()-k : n;
+            uint16_t w = glyphs * fx;
+            for (uint8_t r=0; r<fy; r+=h) {
+                uint8_t rows = (fy-r < h) ? fy-r : h;
+                for (uint16_t g=0; g<glyphs; g++) {
+                    c = s.charAt(k+g)-' ';
+                    for (i=0; i<fx; i++) {
+                        for (j=0; j<rows; j++) {
+                            buffer[j*w + g*fx + i] = _getGlyphPixel(c, i, r+j) ? textColour : backColour;
                         }
                     }
                 }
+                pushPixels(x0 + fx*k, y0 + r, w, rows, buffer);
             }
         }
-#endif
-#endif
-#endif
-#endif
     }
 }
+// Pixel (i, j) of character c: glyphs are stored column by column,
+// (fontSizeY()+7)/8 bytes a column, least significant bit on top
+bool LCD_screen_font::_getGlyphPixel(uint8_t c, uint8_t i, uint8_t j)
+{
+    uint8_t bytesPerColumn = (fontSizeY()+7)/8;
+    return bitRead(_getCharacter(c, i*bytesPerColumn + j/8), j%8);
+}
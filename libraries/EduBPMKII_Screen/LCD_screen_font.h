@@ -41,6 +41,8 @@
 #endif
 #ifndef LCD_SCREEN_FONT_RELEASE
 #define LCD_SCREEN_FONT_RELEASE 114
+/// Pixels gText() renders per pushPixels()
+#define LCD_TEXT_BUFFER 192
 #include "LCD_screen.h"
 #if LCD_SCREEN_RELEASE < 114
 #error Required LCD_SCREEN_RELEASE 114
@@ -77,6 +79,7 @@ public:
                        uint8_t ix = 1, uint8_t iy = 1);
 protected:
     uint8_t _getCharacter(uint8_t c, uint8_t i);
+    bool _getGlyphPixel(uint8_t c, uint8_t i, uint8_t j);
     virtual void _fastFill(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour) =0;
     virtual void _setPoint(uint16_t x1, uint16_t y1, uint16_t colour) =0;
     virtual void _getRawTouch(uint16_t &x0, uint16_t &y0, uint16_t &z0) =0;
@@ -0,0 +1,97 @@
+//
+// LCD_screen_grlib.cpp
+// Library C++ code
+// ----------------------------------
+// Developed with embedXcode
+// http://embedXcode.weebly.com
+//
+// Project LCD_screen
+//
+// Copyright © Rei VILO, 2013-2016
+// License All rights reserved
+//
+// See LCD_screen_grlib.h and ReadMe.txt for references
+//
+// Library header
+#include "LCD_screen_grlib.h"
+const Graphics_Display_Functions LCD_screen_grlib::functions = {
+    _pixelDraw,
+    _pixelDrawMultiple,
+    _lineDrawH,
+    _lineDrawV,
+    _rectFill,
+    _colorTranslate,
+    _flush,
+    _clearDisplay
+};
+void LCD_screen_grlib::initDisplay(Graphics_Display *display, LCD_screen *screen)
+{
+    display->size = sizeof(Graphics_Display);
+    display->displayData = screen;
+    display->width = screen->screenSizeX();
+    display->heigth = screen->screenSizeY();
+    display->pFxns = &functions;
+}
+LCD_screen *LCD_screen_grlib::_screen(const Graphics_Display *display)
+{
+    return (LCD_screen *)display->displayData;
+}
+void LCD_screen_grlib::_pixelDraw(const Graphics_Display *display, int16_t x, int16_t y, uint16_t value)
+{
+    _screen(display)->_point(x, y, value);
+}
+// count pixels from data, the first one x0 pixels into the first byte,
+// most significant bits first; the palette grlib passes is translated
+// already. 16 bpp pixels are colours, least significant byte first
+void LCD_screen_grlib::_pixelDrawMultiple(const Graphics_Display *display, int16_t x, int16_t y,
+                                          int16_t x0, int16_t count, int16_t bpp,
+                                          const uint8_t *data, const uint32_t *palette)
+{
+    uint16_t buffer[LCD_GRLIB_BUFFER];
+    uint16_t bit;
+    bpp &= 0xff;
+    bit = (x0 * bpp) & 7;
+    while (count > 0) {
+        uint8_t n = (count < LCD_GRLIB_BUFFER) ? count : LCD_GRLIB_BUFFER;
+        for (uint8_t i=0; i<n; i++) {
+            if (bpp == 16) {
+                buffer[i] = data[0] | (data[1] << 8);
+                data += 2;
+            } else {
+                uint8_t index = (data[bit / 8] >> (8 - bpp - bit % 8)) & ((1 << bpp) - 1);
+                buffer[i] = palette[index];
+                bit += bpp;
+            }
+        }
+        _screen(display)->pushPixels(x, y, n, 1, buffer);
+        x += n;
+        count -= n;
+    }
+}
+void LCD_screen_grlib::_lineDrawH(const Graphics_Display *display, int16_t x1, int16_t x2, int16_t y, uint16_t value)
+{
+    if (x1 > x2) _screen(display)->_swap(x1, x2);
+    _screen(display)->_fill(x1, y, x2, y, value);
+}
+void LCD_screen_grlib::_lineDrawV(const Graphics_Display *display, int16_t x, int16_t y1, int16_t y2, uint16_t value)
+{
+    if (y1 > y2) _screen(display)->_swap(y1, y2);
+    _screen(display)->_fill(x, y1, x, y2, value);
+}
+void LCD_screen_grlib::_rectFill(const Graphics_Display *display, const Graphics_Rectangle *rect, uint16_t value)
+{
+    _screen(display)->_fill(rect->xMin, rect->yMin, rect->xMax, rect->yMax, value);
+}
+// 24-bit 0x00RRGGBB to the screen's 16-bit colour
+uint32_t LCD_screen_grlib::_colorTranslate(const Graphics_Display *display, uint32_t value)
+{
+    return _screen(display)->calculateColour((value >> 16) & 0xff, (value >> 8) & 0xff, value & 0xff);
+}
+void LCD_screen_grlib::_flush(const Graphics_Display *display)
+{
+    _screen(display)->flush();
+}
+void LCD_screen_grlib::_clearDisplay(const Graphics_Display *display, uint16_t value)
+{
+    _screen(display)->clear(value);
+}
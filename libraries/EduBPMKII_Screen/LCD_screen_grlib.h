@@ -0,0 +1,66 @@
+///
+/// @file       LCD_screen_grlib.h
+/// @brief      Library header
+/// @details    grlib display driver for LCD_screen
+/// @n          Lets the TI graphics library draw on any LCD_screen, as
+/// @n          Screen_HX8353E: pixels, lines, rectangles and image rows
+/// @n          go through the same fills and DMA pixel transfers as the
+/// @n          library's own primitives, and through the back buffer and
+/// @n          the scrolling area when set.
+///
+/// @n          grlib itself comes from system/source/ti/grlib/gcc/grlib.a.
+///
+/// @code
+/// Screen_HX8353E myScreen;
+/// Graphics_Display display;
+/// Graphics_Context context;
+///
+/// myScreen.begin();
+/// LCD_screen_grlib::initDisplay(&display, &myScreen);
+/// Graphics_initContext(&context, &display, &LCD_screen_grlib::functions);
+/// @endcode
+///
+/// @author     Rei VILO
+/// @author     embedXcode.weebly.com
+///
+/// @copyright  (c) Rei VILO, 2013-2016 - SPECIAL EDITION FOR ENERGIA
+/// @copyright  All rights reserved
+///
+/// @n  Dual license:
+/// *   For hobbyists and for personal usage: Attribution-NonCommercial-ShareAlike 3.0 Unported (CC BY-NC-SA 3.0)
+/// *   For professionals or organisations or for commercial usage: All rights reserved
+///
+/// @n  For any enquiry about license, http://embeddedcomputing.weebly.com/contact
+///
+/// @see        ReadMe.txt for references
+#if defined(ENERGIA)
+#include "Energia.h"
+#else
+#error Board not supported
+#endif
+#ifndef LCD_SCREEN_GRLIB_RELEASE
+#define LCD_SCREEN_GRLIB_RELEASE 100
+#include "LCD_screen.h"
+#include <ti/grlib/grlib.h>
+/// Pixels of an image row converted per pushPixels()
+#define LCD_GRLIB_BUFFER 64
+class LCD_screen_grlib {
+public:
+    /// grlib callbacks, for Graphics_initContext()
+    static const Graphics_Display_Functions functions;
+    /// display of screen's size drawing on screen, begin() already called
+    static void initDisplay(Graphics_Display *display, LCD_screen *screen);
+private:
+    static LCD_screen *_screen(const Graphics_Display *display);
+    static void _pixelDraw(const Graphics_Display *display, int16_t x, int16_t y, uint16_t value);
+    static void _pixelDrawMultiple(const Graphics_Display *display, int16_t x, int16_t y,
+                                   int16_t x0, int16_t count, int16_t bpp,
+                                   const uint8_t *data, const uint32_t *palette);
+    static void _lineDrawH(const Graphics_Display *display, int16_t x1, int16_t x2, int16_t y, uint16_t value);
+    static void _lineDrawV(const Graphics_Display *display, int16_t x, int16_t y1, int16_t y2, uint16_t value);
+    static void _rectFill(const Graphics_Display *display, const Graphics_Rectangle *rect, uint16_t value);
+    static uint32_t _colorTranslate(const Graphics_Display *display, uint32_t value);
+    static void _flush(const Graphics_Display *display);
+    static void _clearDisplay(const Graphics_Display *display, uint16_t value);
+};
+#endif
@@ -52,6 +52,8 @@
 #define HX8353E_RGBSET  0x2d
 #define HX8353E_RAMRD   0x2E
 #define HX8353E_PTLAR   0x30
+#define HX8353E_VSCRDEF 0x33
+#define HX8353E_VSCSAD  0x37
 #define HX8353E_MADCTL  0x36
 #define HX8353E_COLMOD  0x3A
 #define HX8353E_SETPWCTR 0xB1
@@ -64,8 +66,16 @@
 #define HX8353E_SETID    0xC3
 #define HX8353E_GETHID   0xd0
 #define HX8353E_SETGAMMA 0xE0
+///
+/// Panel lines in memory, the 128 shown start at line 1
+///
+#define HX8353E_MEMORY_ROWS 132
+///
+/// Pixels sent per DMA transfer by _fastFill() and _pushPixels()
+///
+#define HX8353E_FILL_BLOCK 128
 Screen_HX8353E::Screen_HX8353E() {
-#if defined(__MSP432P401R__) || defined(__LM4F120H5QR__) || defined(__MSP430F5529__) || defined(__TM4C123GH6PM__) || defined(__TM4C1294NCPDT__) || defined(__TM4C1294XNCZAD__)
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__) || defined(__LM4F120H5QR__) || defined(__MSP430F5529__) || defined(__TM4C123GH6PM__) || defined(__TM4C1294NCPDT__) || defined(__TM4C1294XNCZAD__)
     _pinReset          = 17;
     _pinDataCommand    = 31;
     _pinChipSelect     = 13;
@@ -90,10 +100,17 @@ void Screen_HX8353E::begin()
     SPI.setClockDivider(SPI_CLOCK_DIV2);
     SPI.setBitOrder(MSBFIRST);
     SPI.setDataMode(SPI_MODE0);
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    _spiSettings = SPISettings(SPI.getClock(), MSBFIRST, SPI_MODE0);
+#endif
     if (_pinReset!=0) pinMode(_pinReset, OUTPUT);
     if (_pinBacklight!=0) pinMode(_pinBacklight, OUTPUT);
     pinMode(_pinDataCommand, OUTPUT);
     pinMode(_pinChipSelect, OUTPUT);
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    _fastDataCommand = fastPin(_pinDataCommand);
+    _fastChipSelect = fastPin(_pinChipSelect);
+#endif
     if (_pinBacklight!=0) digitalWrite(_pinBacklight, HIGH);
     if (_pinReset!=0) digitalWrite(_pinReset, 1);
     delay(100);
@@ -130,6 +147,7 @@ void Screen_HX8353E::begin()
     _fontSolid = true;
     _flagRead  = false;
     _touchTrim = 0;
+    _scrollFixed = 0;
     clear();
 }
 String Screen_HX8353E::WhoAmI()
@@ -138,6 +156,7 @@ String Screen_HX8353E::WhoAmI()
 }
 void Screen_HX8353E::invert(boolean flag)
 {
+    _renderWait();
     _writeCommand(flag ? HX8353E_INVON : HX8353E_INVOFF);
 }
 void Screen_HX8353E::setBacklight(boolean flag)
@@ -150,6 +169,12 @@ void Screen_HX8353E::setDisplay(boolean flag)
 }
 void Screen_HX8353E::setOrientation(uint8_t orientation)
 {
+    _renderWait();
+    if (_scrollHeight != 0) {
+        _scrollOffset = 0;
+        _scrollStart(0);
+        _scrollHeight = 0;
+    }
     _orientation = orientation % 4;
     _writeCommand(HX8353E_MADCTL);
     switch (_orientation) {
@@ -171,24 +196,118 @@ void Screen_HX8353E::_fastFill(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y
 {
     if (x1 > x2) _swap(x1, x2);
     if (y1 > y2) _swap(y1, y2);
-    _setWindow(x1, y1, x2, y2);
-    digitalWrite(_pinDataCommand, HIGH);
-    digitalWrite(_pinChipSelect, LOW);
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    // The colour goes out HX8353E_FILL_BLOCK pixels per DMA transfer,
+    // while the task sleeps, instead of two transactions per pixel.
+    // The bus stays claimed for the whole window so no other device's
+    // bytes are clocked into the RAMWR.
+    uint8_t block[2*HX8353E_FILL_BLOCK];
+    uint32_t t = (uint32_t)(y2-y1+1)*(x2-x1+1);
+    uint32_t n = (t < HX8353E_FILL_BLOCK) ? t : HX8353E_FILL_BLOCK;
+    for (uint32_t i=0; i<n; i++) {
+        block[2*i] = highByte(colour);
+        block[2*i+1] = lowByte(colour);
+    }
+    SPI.beginTransaction(_spiSettings);
+    _chipSelect(LOW);
+    _sendWindow(x1, y1, x2, y2);
+    _dataCommand(HIGH);
+    for (; t>0; t-=n) {
+        n = (t < HX8353E_FILL_BLOCK) ? t : HX8353E_FILL_BLOCK;
+        SPI.transfer(block, NULL, 2*n);
+    }
+    _chipSelect(HIGH);
+    SPI.endTransaction();
+#else
+    _chipSelect(LOW);
+    _sendWindow(x1, y1, x2, y2);
+    _dataCommand(HIGH);
     uint8_t hi = highByte(colour);
     uint8_t lo = lowByte(colour);
     for (uint32_t t=(uint32_t)(y2-y1+1)*(x2-x1+1); t>0; t--) {
         SPI.transfer(hi);
         SPI.transfer(lo);
     }
-    digitalWrite(_pinChipSelect, HIGH);
+    _chipSelect(HIGH);
+#endif
+}
+void Screen_HX8353E::_pushPixels(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint16_t *pixels)
+{
+    if ((dx == 0) || (dy == 0)) return;
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    // One window for the whole area, then the pixels in the panel's
+    // byte order HX8353E_FILL_BLOCK at a time, each block a DMA transfer
+    uint8_t block[2*HX8353E_FILL_BLOCK];
+    uint32_t t = (uint32_t)dx*dy;
+    uint32_t n;
+    SPI.beginTransaction(_spiSettings);
+    _chipSelect(LOW);
+    _sendWindow(x0, y0, x0+dx-1, y0+dy-1);
+    _dataCommand(HIGH);
+    for (; t>0; t-=n) {
+        n = (t < HX8353E_FILL_BLOCK) ? t : HX8353E_FILL_BLOCK;
+        for (uint32_t i=0; i<n; i++) {
+            block[2*i] = highByte(*pixels);
+            block[2*i+1] = lowByte(*pixels);
+            pixels++;
+        }
+        SPI.transfer(block, NULL, 2*n);
+    }
+    _chipSelect(HIGH);
+    SPI.endTransaction();
+#else
+    _chipSelect(LOW);
+    _sendWindow(x0, y0, x0+dx-1, y0+dy-1);
+    _dataCommand(HIGH);
+    for (uint32_t t=(uint32_t)dx*dy; t>0; t--) {
+        SPI.transfer(highByte(*pixels));
+        SPI.transfer(lowByte(*pixels));
+        pixels++;
+    }
+    _chipSelect(HIGH);
+#endif
+}
+bool Screen_HX8353E::_scrollArea(uint16_t top, uint16_t height)
+{
+    // The panel scrolls its lines, screen rows only in orientations 0
+    // and 2; orientation 0 has the lines bottom up, from line 128
+    if ((_orientation == 1) || (_orientation == 3)) return false;
+    uint16_t bottom = screenSizeY() - top - height;
+    _scrollFixed = 1 + ((_orientation == 0) ? bottom : top);
+    _writeCommand(HX8353E_VSCRDEF);
+    _writeData16(_scrollFixed);
+    _writeData16(height);
+    _writeData16(HX8353E_MEMORY_ROWS - _scrollFixed - height);
+    _writeCommand(HX8353E_VSCSAD);
+    _writeData16(_scrollFixed);
+    return true;
+}
+void Screen_HX8353E::_scrollStart(uint16_t offset)
+{
+    if ((_scrollHeight == 0) || !_scrollHardware) return;
+    if (_orientation == 0) offset = (_scrollHeight - offset) % _scrollHeight;
+    _writeCommand(HX8353E_VSCSAD);
+    _writeData16(_scrollFixed + offset);
 }
 void Screen_HX8353E::_setPoint(uint16_t x1, uint16_t y1, uint16_t colour)
 {
     if( (x1 < 0) || (x1 >= screenSizeX()) || (y1 < 0) || (y1 >= screenSizeY()) ) return;
-    _setWindow(x1, y1, x1+1, y1+1);
-    _writeData16(colour);
+    _chipSelect(LOW);
+    _sendWindow(x1, y1, x1+1, y1+1);
+    _dataCommand(HIGH);
+    SPI.transfer(highByte(colour));
+    SPI.transfer(lowByte(colour));
+    _chipSelect(HIGH);
 }
 void Screen_HX8353E::_setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    _chipSelect(LOW);
+    _sendWindow(x0, y0, x1, y1);
+    _chipSelect(HIGH);
+}
+// The CASET, RASET and RAMWR sequence, with CS already low: DC only
+// selects command or data bytes within it
+void Screen_HX8353E::_sendWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
     switch (_orientation) {
         case 0:
@@ -218,13 +337,42 @@ void Screen_HX8353E::_setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t
         default:
             break;
     }
-    _writeCommand(HX8353E_CASET);
-    _writeData16(x0);
-    _writeData16(x1);
-    _writeCommand(HX8353E_RASET);
-    _writeData16(y0);
-    _writeData16(y1);
-    _writeCommand(HX8353E_RAMWR);
+    uint8_t column[4] = { highByte(x0), lowByte(x0), highByte(x1), lowByte(x1) };
+    uint8_t row[4] = { highByte(y0), lowByte(y0), highByte(y1), lowByte(y1) };
+    _dataCommand(LOW);
+    SPI.transfer(HX8353E_CASET);
+    _dataCommand(HIGH);
+    _writeBytes(column, 4);
+    _dataCommand(LOW);
+    SPI.transfer(HX8353E_RASET);
+    _dataCommand(HIGH);
+    _writeBytes(row, 4);
+    _dataCommand(LOW);
+    SPI.transfer(HX8353E_RAMWR);
+}
+void Screen_HX8353E::_writeBytes(uint8_t *data8, uint8_t count)
+{
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    SPI.transfer(data8, NULL, count);
+#else
+    for (uint8_t i=0; i<count; i++) SPI.transfer(data8[i]);
+#endif
+}
+void Screen_HX8353E::_dataCommand(uint8_t state)
+{
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    _fastDataCommand.write(state);
+#else
+    digitalWrite(_pinDataCommand, state);
+#endif
+}
+void Screen_HX8353E::_chipSelect(uint8_t state)
+{
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    _fastChipSelect.write(state);
+#else
+    digitalWrite(_pinChipSelect, state);
+#endif
 }
 void Screen_HX8353E::_writeRegister(uint8_t command8, uint8_t data8)
 {
@@ -233,40 +381,41 @@ void Screen_HX8353E::_writeRegister(uint8_t command8, uint8_t data8)
 }
 void Screen_HX8353E::_writeCommand(uint8_t command8)
 {
-    digitalWrite(_pinDataCommand, LOW);
-    digitalWrite(_pinChipSelect, LOW);
+    _dataCommand(LOW);
+    _chipSelect(LOW);
     SPI.transfer(command8);
-    digitalWrite(_pinChipSelect, HIGH);
+    _chipSelect(HIGH);
 }
 void Screen_HX8353E::_writeData(uint8_t data8)
 {
-    digitalWrite(_pinDataCommand, HIGH);
-    digitalWrite(_pinChipSelect, LOW);
+    _dataCommand(HIGH);
+    _chipSelect(LOW);
     SPI.transfer(data8);
-    digitalWrite(_pinChipSelect, HIGH);
+    _chipSelect(HIGH);
 }
 void Screen_HX8353E::_writeData16(uint16_t data16)
 {
-    digitalWrite(_pinDataCommand, HIGH);
-    digitalWrite(_pinChipSelect, LOW);
+    _dataCommand(HIGH);
+    _chipSelect(LOW);
     SPI.transfer(highByte(data16));
     SPI.transfer(lowByte(data16));
-    digitalWrite(_pinChipSelect, HIGH);
+    _chipSelect(HIGH);
 }
 void Screen_HX8353E::_writeData88(uint8_t dataHigh8, uint8_t dataLow8)
 {
-    digitalWrite(_pinDataCommand, HIGH);
-    digitalWrite(_pinChipSelect, LOW);
+    _dataCommand(HIGH);
+    _chipSelect(LOW);
     SPI.transfer(dataHigh8);
     SPI.transfer(dataLow8);
-    digitalWrite(_pinChipSelect, HIGH);
+    _chipSelect(HIGH);
 }
 void Screen_HX8353E::_writeData8888(uint8_t dataHigh8, uint8_t dataLow8, uint8_t data8_3, uint8_t data8_4)
 {
-    _writeData(dataHigh8);
-    _writeData(dataLow8);
-    _writeData(data8_3);
-    _writeData(data8_4);
+    uint8_t data[4] = { dataHigh8, dataLow8, data8_3, data8_4 };
+    _dataCommand(HIGH);
+    _chipSelect(LOW);
+    _writeBytes(data, 4);
+    _chipSelect(HIGH);
 }
 void Screen_HX8353E::_getRawTouch(uint16_t &x0, uint16_t &y0, uint16_t &z0)
 {
@@ -51,8 +51,15 @@ public:
     void setDisplay(boolean flag);
     void setOrientation(uint8_t orientation);
 private:
+    void _pushPixels(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint16_t *pixels);
+    bool _scrollArea(uint16_t top, uint16_t height);
+    void _scrollStart(uint16_t offset);
     void _setPoint(uint16_t x1, uint16_t y1, uint16_t colour);
     void _setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+    void _sendWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+    void _writeBytes(uint8_t *data8, uint8_t count);
+    void _dataCommand(uint8_t state);
+    void _chipSelect(uint8_t state);
     void _writeRegister(uint8_t command8, uint8_t data8);
     void _writeCommand(uint8_t command8);
     void _writeData(uint8_t data8);
@@ -65,5 +72,11 @@ private:
     uint8_t _pinDataCommand;
     uint8_t _pinChipSelect;
     uint8_t _pinBacklight;
+    uint16_t _scrollFixed;
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    SPISettings _spiSettings;
+    FastPin _fastDataCommand;
+    FastPin _fastChipSelect;
+#endif
 };
 #endif
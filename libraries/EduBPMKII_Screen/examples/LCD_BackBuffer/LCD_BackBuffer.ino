@@ -0,0 +1,70 @@
+///
+/// @file		LCD_BackBuffer.ino
+/// @brief		Main sketch
+///
+/// @details	Dashboard drawn into a back buffer
+/// @n          Every element is redrawn each time round loop(), into RAM;
+/// @n          flush() then sends only the areas that were drawn, without
+/// @n          the flicker of clearing and redrawing them on the screen.
+/// @n          The 128 x 128 buffer takes 16 KB, a byte per pixel.
+///
+/// @copyright	CC = BY SA NC
+///
+
+// Core library for code-sense
+#if defined(ENERGIA) // LaunchPad MSP430, Stellaris and Tiva, Experimeter Board FR5739 specific
+#include "Energia.h"
+#else // error
+#error Platform not defined
+#endif
+
+// Include application, user and local libraries
+#include "SPI.h"
+#include "Screen_HX8353E.h"
+Screen_HX8353E myScreen;
+
+// Define variables and constants
+#define joystickX 2
+#define joystickY 26
+uint8_t backBuffer[128 * 128];
+uint16_t barX, barY;
+
+void gauge(uint16_t y0, String label, uint16_t value, uint16_t colour)
+{
+    uint16_t width = map(value, 0, 4095, 0, 100);
+    myScreen.gText(4, y0, label, whiteColour, blackColour);
+    myScreen.dRectangle(24, y0, width, 8, colour);
+    myScreen.dRectangle(24 + width, y0, 100 - width, 8, darkGrayColour);
+}
+
+// Add setup code
+void setup()
+{
+    myScreen.begin();
+    myScreen.setPenSolid(true);
+    myScreen.setFontSize(0);
+
+    // MSP432 14-bit set to 12-bit
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    analogReadResolution(12);
+#endif
+
+    myScreen.setBackBuffer(backBuffer);
+    myScreen.clear(blackColour);
+    myScreen.gText(4, 4, "Dashboard", yellowColour, blackColour);
+    myScreen.flush();
+}
+
+// Add loop code
+void loop()
+{
+    barX = analogRead(joystickX);
+    barY = analogRead(joystickY);
+
+    gauge(40, "X", barX, greenColour);
+    gauge(56, "Y", barY, cyanColour);
+    myScreen.gText(4, 80, "t " + String(millis() / 1000) + " s  ", whiteColour, blackColour);
+
+    myScreen.flush();
+    delay(50);
+}
@@ -0,0 +1,709 @@
+// Energia_logo_100_132_bmp, 103 x 137, 11263 bytes instead of 28222
+// Generated by LCD_compress.py for drawCompressedBitmap()
+
+static const uint8_t lz4_Energia_logo_100_132_bmp[] = {
+    0x67, 0x00, 0x89, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x1f, 0xff, 0x01, 0x00, 0xff, 0x84, 0x50, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x1f, 0xff, 0x01, 0x00, 0xff, 0x84, 0x50, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x20, 0x00, 0x1f, 0xff, 0x01, 0x00, 0xff, 0x5f, 0x11, 0xdf, 0x72, 0x01, 0xa1, 0x9a,
+    0xd6, 0x00, 0x00, 0x00, 0x00, 0x30, 0x84, 0x5d, 0xef, 0x0f, 0x00, 0x0c, 0x05, 0x00, 0x50, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x3a, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x92, 0xff, 0x01, 0x59, 0xce, 0x08,
+    0x42, 0xc3, 0x18, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0xd3, 0x9c, 0xb5, 0x00, 0x92,
+    0x0f, 0xa5, 0x00, 0x02, 0x40, 0x5d, 0xef, 0xaa, 0x52, 0xc6, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20,
+    0x05, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xb6, 0xb5, 0x2b, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x48, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x8c, 0xf0, 0x03, 0xef, 0x7b, 0x61, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x82, 0x10, 0x6d, 0x6b, 0x96, 0xb5, 0xf7, 0xbd, 0x8e, 0x73, 0x0e, 0x00, 0x2f, 0x08, 0x42,
+    0xb7, 0x00, 0x8c, 0x0f, 0x9f, 0x00, 0x00, 0x40, 0xdf, 0xff, 0xc7, 0x39, 0xbc, 0x00, 0x46, 0x00,
+    0x00, 0xae, 0x73, 0x1f, 0x00, 0x20, 0xeb, 0x5a, 0x14, 0x00, 0x26, 0x5d, 0xef, 0x12, 0x00, 0xa0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x1f, 0xff, 0x01, 0x00,
+    0x86, 0xf3, 0x02, 0x59, 0xce, 0xc3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xba, 0xd6, 0xff,
+    0xff, 0xdf, 0xff, 0xdf, 0xaa, 0x00, 0x20, 0x38, 0xc6, 0x16, 0x00, 0x23, 0x75, 0xad, 0x0f, 0x00,
+    0x0f, 0x07, 0x00, 0x92, 0x30, 0x79, 0xce, 0x20, 0xb5, 0x00, 0x36, 0x00, 0xb2, 0x94, 0xc8, 0x00,
+    0x02, 0xb9, 0x00, 0x20, 0x7d, 0xef, 0x19, 0x00, 0x22, 0x51, 0x8c, 0x0e, 0x00, 0x05, 0x06, 0x00,
+    0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x47, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x82, 0xd1, 0x55, 0xad,
+    0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0x34, 0xa5, 0xff, 0xff, 0xdf, 0xa2, 0x00, 0x00, 0x06, 0x00,
+    0x13, 0xdf, 0x0c, 0x00, 0x61, 0x20, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x17, 0x00, 0x0f, 0x05, 0x00,
+    0x90, 0x20, 0x14, 0xa5, 0xb0, 0x00, 0x46, 0xe3, 0x18, 0xdb, 0xde, 0xad, 0x00, 0x02, 0xce, 0x00,
+    0x02, 0x10, 0x00, 0x00, 0xea, 0x00, 0x0d, 0xce, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59,
+    0x00, 0x1f, 0xff, 0x01, 0x00, 0x7e, 0xb1, 0x14, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x18, 0xba,
+    0xd6, 0xdf, 0x9c, 0x00, 0x20, 0xdf, 0xff, 0x08, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0f, 0x00, 0x30,
+    0xff, 0x5d, 0xef, 0x20, 0x00, 0x22, 0x55, 0xad, 0x0e, 0x00, 0x0f, 0x06, 0x00, 0x8b, 0xa4, 0x96,
+    0xb5, 0x20, 0x00, 0x00, 0x00, 0x45, 0x29, 0x3c, 0xe7, 0xa8, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04,
+    0x00, 0x11, 0xff, 0xd6, 0x00, 0x40, 0xff, 0xff, 0x79, 0xce, 0xce, 0x00, 0x24, 0x9a, 0xd6, 0x20,
+    0x00, 0x03, 0x08, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x00, 0x1f, 0xff, 0x01, 0x00,
+    0x7a, 0xa0, 0x9a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x18, 0xfb, 0xde, 0x97, 0x00, 0x55, 0xdf,
+    0xff, 0xff, 0xff, 0xdf, 0x02, 0x00, 0x00, 0x12, 0x00, 0x00, 0x04, 0x00, 0x60, 0xb2, 0x94, 0x00,
+    0x00, 0x20, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x0f, 0x04, 0x00, 0x87, 0xa2, 0xba, 0xd6, 0x20,
+    0x00, 0x00, 0x00, 0xe3, 0x18, 0xdb, 0xde, 0xc6, 0x00, 0x00, 0x06, 0x00, 0x00, 0xae, 0x00, 0x02,
+    0xba, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x0e, 0x00, 0x60, 0x0c, 0x63, 0x00, 0x00, 0x45, 0x29, 0x0a,
+    0x00, 0x09, 0x04, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0x00, 0x1f, 0xff, 0x01, 0x00,
+    0x78, 0x95, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0xdb, 0xde, 0xdf, 0x94, 0x00, 0x24, 0xdf, 0xff,
+    0x02, 0x00, 0x22, 0xff, 0xff, 0x16, 0x00, 0x85, 0xbe, 0xf7, 0x86, 0x31, 0x00, 0x00, 0x2c, 0x63,
+    0x23, 0x00, 0x0f, 0x09, 0x00, 0x82, 0xa2, 0x7d, 0xef, 0xa6, 0x31, 0x00, 0x00, 0x20, 0x00, 0x96,
+    0xb5, 0xb8, 0x00, 0x02, 0xbc, 0x00, 0x04, 0xab, 0x00, 0x04, 0x0e, 0x00, 0xa4, 0xbe, 0xf7, 0x1c,
+    0xe7, 0xc3, 0x18, 0x00, 0x00, 0xb2, 0x94, 0x1a, 0x00, 0x05, 0x08, 0x00, 0x50, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x59, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x72, 0xa0, 0xdf, 0xff, 0x0c, 0x63, 0x00, 0x00,
+    0x00, 0x00, 0x71, 0x8c, 0x8f, 0x00, 0x6f, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x06, 0x00, 0x03,
+    0x80, 0xf7, 0xbd, 0x00, 0x00, 0x41, 0x08, 0x38, 0xc6, 0x28, 0x00, 0x0f, 0x04, 0x00, 0x85, 0x20,
+    0x14, 0xa5, 0xcc, 0x00, 0x00, 0x04, 0x00, 0x62, 0x86, 0x31, 0x55, 0xad, 0x1c, 0xe7, 0xa8, 0x00,
+    0x02, 0xd0, 0x00, 0x02, 0x0c, 0x00, 0x04, 0xe0, 0x00, 0x84, 0x6d, 0x6b, 0x00, 0x00, 0xe3, 0x18,
+    0x9e, 0xf7, 0x16, 0x00, 0x05, 0x08, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0x00, 0x1f,
+    0xff, 0x01, 0x00, 0x70, 0x39, 0x96, 0xb5, 0x00, 0x01, 0x00, 0x55, 0xc3, 0x18, 0x6d, 0x6b, 0xdf,
+    0x98, 0x00, 0x00, 0x0a, 0x00, 0x20, 0xdf, 0xff, 0x06, 0x00, 0x00, 0x13, 0x00, 0x60, 0x82, 0x10,
+    0x00, 0x00, 0x0c, 0x63, 0x0a, 0x00, 0x0f, 0x04, 0x00, 0x7d, 0x00, 0xa2, 0x00, 0x69, 0xdf, 0xff,
+    0x5d, 0xef, 0xe3, 0x18, 0xcd, 0x00, 0x03, 0x0d, 0x00, 0x42, 0xb2, 0x94, 0x7d, 0xef, 0x22, 0x00,
+    0x00, 0x06, 0x00, 0x11, 0xff, 0xd0, 0x00, 0x02, 0xf8, 0x00, 0x2f, 0x9a, 0xd6, 0xca, 0x00, 0x00,
+    0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x6e, 0x3f, 0x49, 0x4a,
+    0x00, 0x01, 0x00, 0x04, 0x82, 0x65, 0x29, 0x75, 0xad, 0xff, 0xff, 0xdf, 0xff, 0x04, 0x00, 0x00,
+    0xa9, 0x00, 0x60, 0xe7, 0x39, 0x00, 0x00, 0x45, 0x29, 0x0a, 0x00, 0x0f, 0x04, 0x00, 0x69, 0x00,
+    0x92, 0x00, 0x0f, 0x80, 0x00, 0x03, 0x2f, 0x10, 0x84, 0xcb, 0x00, 0x04, 0x03, 0x17, 0x00, 0x22,
+    0xcf, 0x7b, 0x3c, 0x00, 0xcf, 0xdf, 0xff, 0xdf, 0xff, 0xfb, 0xde, 0x61, 0x08, 0x00, 0x00, 0xb2,
+    0x94, 0x4a, 0x00, 0x02, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x00, 0x1f, 0xff, 0x01, 0x00,
+    0x4a, 0x20, 0xdf, 0xff, 0x02, 0x00, 0x11, 0xde, 0x06, 0x00, 0x1f, 0xdf, 0x6a, 0x00, 0x00, 0x4f,
+    0xfb, 0xde, 0x21, 0x00, 0x01, 0x00, 0x0d, 0x42, 0x08, 0x42, 0x7d, 0xef, 0x3b, 0x00, 0x82, 0xd3,
+    0x9c, 0x00, 0x00, 0x61, 0x08, 0xfb, 0xde, 0x0e, 0x00, 0x0f, 0x06, 0x00, 0x49, 0x00, 0xb6, 0x00,
+    0xf1, 0x18, 0xdf, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x7d, 0xff, 0x5d, 0xff,
+    0x3c, 0xff, 0xba, 0xfe, 0x39, 0xfe, 0xf7, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xd7, 0xfd, 0x38, 0xfe,
+    0xba, 0xfe, 0x1c, 0xff, 0x5d, 0xff, 0x7d, 0xff, 0x9d, 0x22, 0x00, 0x20, 0xbe, 0xff, 0xde, 0x00,
+    0x2f, 0x66, 0x31, 0xcc, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x40, 0x61, 0x08, 0x5d, 0xef, 0x2e, 0x00,
+    0x6f, 0x45, 0x29, 0x00, 0x00, 0x08, 0x42, 0xc6, 0x00, 0x04, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xab, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x32, 0xf0, 0x11, 0xdf, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0x5d,
+    0xff, 0x59, 0xfe, 0x95, 0xfd, 0x91, 0xfc, 0x4c, 0xf3, 0x28, 0xe2, 0x04, 0xc9, 0x04, 0xd1, 0x82,
+    0xc8, 0x82, 0xc8, 0x62, 0xc8, 0x62, 0xd0, 0x62, 0xd0, 0x0a, 0x00, 0xff, 0x06, 0x82, 0xc8, 0xe3,
+    0xd0, 0x65, 0xd9, 0x07, 0xe2, 0x0c, 0xf3, 0x50, 0xfc, 0x75, 0xfd, 0x39, 0xfe, 0x7d, 0xff, 0xae,
+    0x8b, 0x00, 0x01, 0x00, 0x14, 0x60, 0x20, 0x00, 0xfb, 0xde, 0x79, 0xce, 0x2d, 0x00, 0x2f, 0x75,
+    0xad, 0xb1, 0x00, 0x32, 0x0f, 0x45, 0x00, 0x02, 0x00, 0xc6, 0x00, 0xfa, 0x0f, 0xbf, 0xff, 0x9e,
+    0xff, 0x7d, 0xff, 0x38, 0xfe, 0xcf, 0xe3, 0x28, 0xc2, 0x24, 0xb9, 0xe3, 0xc0, 0x81, 0xc8, 0x61,
+    0xd0, 0x20, 0xd8, 0x00, 0xe0, 0x00, 0xe8, 0x00, 0xe8, 0x00, 0xf0, 0x02, 0x00, 0xf0, 0x03, 0x20,
+    0xe8, 0x20, 0xe0, 0x61, 0xd8, 0x82, 0xd0, 0xc3, 0xc8, 0x66, 0xb1, 0x69, 0x92, 0x00, 0x10, 0x00,
+    0x08, 0xa2, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x9f, 0xe3, 0x18, 0x45, 0x29, 0x00, 0x00, 0xe3, 0x18,
+    0xdf, 0x88, 0x00, 0x02, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x00, 0x1f,
+    0xff, 0x01, 0x00, 0x28, 0xf0, 0x0e, 0xdf, 0xff, 0xbe, 0xff, 0x5d, 0xff, 0x59, 0xfe, 0x31, 0xfc,
+    0xc7, 0xd1, 0x82, 0xb8, 0x61, 0xc0, 0x41, 0xc8, 0x41, 0xd0, 0x21, 0xd8, 0x20, 0xe0, 0x20, 0xe0,
+    0x20, 0xe8, 0x00, 0x02, 0x00, 0x2f, 0xf0, 0x00, 0x02, 0x00, 0x00, 0xdf, 0x20, 0xe8, 0x21, 0xe8,
+    0x41, 0xd8, 0xe3, 0xb8, 0x00, 0x40, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1c, 0x2f, 0x76, 0xad, 0xaf,
+    0x00, 0x28, 0x0f, 0x3b, 0x00, 0x08, 0xf1, 0x03, 0xbe, 0xff, 0xbe, 0xff, 0x7d, 0xff, 0x75, 0xfd,
+    0xab, 0xca, 0x04, 0xb1, 0x82, 0xc0, 0x20, 0xd0, 0x00, 0xe0, 0x02, 0x00, 0x00, 0xc4, 0x00, 0x0f,
+    0x04, 0x00, 0x01, 0x09, 0xd6, 0x00, 0x8f, 0x20, 0xe8, 0x62, 0xd8, 0x00, 0x90, 0x00, 0x28, 0xce,
+    0x00, 0x1d, 0x4f, 0x04, 0x21, 0xbe, 0xf7, 0x93, 0x00, 0x06, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x7e, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x20, 0xf5, 0x05, 0xdf, 0xff, 0xbe, 0xff, 0x5d, 0xff, 0xf7,
+    0xfd, 0xc7, 0xc1, 0x82, 0xb8, 0x61, 0xc8, 0x41, 0xd0, 0x20, 0xd8, 0x00, 0xe0, 0x02, 0x00, 0x2e,
+    0xe8, 0x00, 0x02, 0x00, 0x29, 0xf0, 0x00, 0x02, 0x00, 0x9f, 0x41, 0xd8, 0xc3, 0xa8, 0x00, 0x38,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x12, 0x15, 0x20, 0x26, 0x00, 0x2f, 0x10, 0x84, 0xad, 0x00, 0x20,
+    0x0f, 0x33, 0x00, 0x02, 0x15, 0xdf, 0x16, 0x00, 0xc9, 0xbe, 0xff, 0x9d, 0xff, 0xb7, 0xfd, 0x8a,
+    0xca, 0xa2, 0xb0, 0x61, 0xc8, 0xc8, 0x00, 0x0f, 0xd2, 0x00, 0x07, 0x09, 0xcc, 0x00, 0xa5, 0x00,
+    0xe8, 0xa2, 0xc8, 0x00, 0x58, 0x00, 0x18, 0x00, 0x08, 0xa7, 0x00, 0x0f, 0x09, 0x00, 0x10, 0x00,
+    0xd4, 0x00, 0x25, 0x7d, 0xf7, 0x85, 0x00, 0x0e, 0x09, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x1a, 0xf5, 0x05, 0xdf, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x8d,
+    0xeb, 0x81, 0xb0, 0x61, 0xc0, 0x40, 0xc8, 0x00, 0xd0, 0x20, 0xd8, 0x00, 0xe0, 0x02, 0x00, 0x17,
+    0xe8, 0x0a, 0x00, 0x2e, 0xe8, 0x00, 0x02, 0x00, 0xff, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x20,
+    0xe8, 0x41, 0xd8, 0x82, 0xa8, 0x00, 0x28, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1c, 0x2f, 0x71, 0x8c,
+    0xab, 0x00, 0x1a, 0x0f, 0x2d, 0x00, 0x0a, 0xf0, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x9e,
+    0xff, 0x96, 0xfd, 0xa6, 0xb9, 0x61, 0xb8, 0x20, 0xc8, 0x00, 0x02, 0xca, 0x00, 0x02, 0x06, 0x00,
+    0x06, 0xd4, 0x00, 0x00, 0x0a, 0x00, 0x02, 0xca, 0x00, 0x1d, 0xe0, 0xd2, 0x00, 0xff, 0x03, 0xf0,
+    0x00, 0xe8, 0x40, 0xe0, 0xc3, 0xc0, 0x00, 0x58, 0x00, 0x18, 0x82, 0x10, 0x71, 0x8c, 0x49, 0x4a,
+    0x61, 0xd4, 0x00, 0x16, 0x2f, 0x04, 0x19, 0x9f, 0x00, 0x0a, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x8d, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x14, 0xf9, 0x01, 0xdf, 0xff, 0xbe, 0xff, 0x7d,
+    0xff, 0x6d, 0xe3, 0xa2, 0xb0, 0x41, 0xc0, 0x20, 0xd0, 0x00, 0xd8, 0x02, 0x00, 0x2f, 0xe0, 0x00,
+    0x02, 0x00, 0x05, 0x2b, 0xe8, 0x00, 0x02, 0x00, 0xff, 0x06, 0x61, 0xd0, 0x00, 0x70, 0x00, 0x20,
+    0x00, 0x08, 0x39, 0xce, 0xff, 0xff, 0xdf, 0xff, 0x7d, 0xef, 0x34, 0xa5, 0xa6, 0x31, 0x00, 0x01,
+    0x00, 0x10, 0x2f, 0xb3, 0x94, 0xa9, 0x00, 0x14, 0x0f, 0x27, 0x00, 0x10, 0x00, 0xcc, 0x00, 0x9c,
+    0xdb, 0xfe, 0xaa, 0xc2, 0x61, 0xb0, 0x20, 0xc8, 0x00, 0xcc, 0x00, 0x00, 0xda, 0x00, 0x0f, 0xce,
+    0x00, 0x14, 0xa0, 0x20, 0xe0, 0xa2, 0xb8, 0x00, 0x38, 0x00, 0x08, 0xaa, 0x5a, 0x75, 0x00, 0x10,
+    0xdf, 0x05, 0x00, 0x9f, 0xff, 0xff, 0xff, 0x99, 0xce, 0xeb, 0x5a, 0xa2, 0x10, 0xd3, 0x00, 0x09,
+    0x43, 0x82, 0x10, 0x7e, 0xef, 0x2d, 0x00, 0x0f, 0x07, 0x00, 0x05, 0x50, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x10, 0xfd, 0x03, 0xdf, 0xff, 0x9e, 0xff, 0x18, 0xfe,
+    0x45, 0xb1, 0x41, 0xb8, 0x20, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x02, 0x00, 0x31, 0xe0,
+    0x00, 0xe0, 0x14, 0x00, 0x00, 0x08, 0x00, 0x02, 0x04, 0x00, 0x22, 0xe8, 0x00, 0x08, 0x00, 0x00,
+    0x06, 0x00, 0x21, 0xe8, 0x00, 0x02, 0x00, 0xf2, 0x03, 0x20, 0xd8, 0x82, 0xd0, 0x00, 0x80, 0x00,
+    0x20, 0x20, 0x08, 0x79, 0xce, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x83, 0x00,
+    0x5f, 0x1c, 0xe7, 0x8e, 0x73, 0x00, 0x01, 0x00, 0x06, 0x20, 0xb6, 0xb5, 0x24, 0x00, 0x0f, 0x04,
+    0x00, 0x29, 0x00, 0x6e, 0x00, 0x00, 0x40, 0x00, 0xa1, 0xdf, 0xff, 0xbe, 0xff, 0x59, 0xfe, 0x04,
+    0xa1, 0x41, 0xc0, 0xca, 0x00, 0x0f, 0xce, 0x00, 0x15, 0x00, 0xc6, 0x00, 0x20, 0xe0, 0x00, 0xd4,
+    0x00, 0x00, 0x04, 0x00, 0xf2, 0x00, 0xe0, 0x00, 0xe0, 0x20, 0xd8, 0x82, 0xc8, 0xe3, 0xa8, 0x00,
+    0x40, 0x00, 0x10, 0x48, 0x4a, 0x58, 0x00, 0x06, 0x62, 0x00, 0x00, 0xd8, 0x00, 0x60, 0xff, 0xff,
+    0x55, 0xad, 0xa2, 0x10, 0xd1, 0x00, 0x10, 0x20, 0x05, 0x00, 0x07, 0x04, 0x00, 0x11, 0x08, 0x30,
+    0x00, 0x00, 0x34, 0x00, 0x0f, 0x04, 0x00, 0x08, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x00,
+    0x1f, 0xff, 0x01, 0x00, 0x0c, 0xf1, 0x03, 0xdf, 0xff, 0x9e, 0xff, 0x75, 0xfd, 0xc3, 0xa8, 0x41,
+    0xc0, 0x20, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x06, 0x00, 0x00, 0x08, 0x00, 0x28, 0xd8,
+    0x00, 0x02, 0x00, 0x11, 0xe0, 0x0e, 0x00, 0x28, 0xe0, 0x00, 0x02, 0x00, 0xf6, 0x0a, 0xe8, 0x00,
+    0xe0, 0x00, 0xe8, 0x00, 0xe8, 0x00, 0xe0, 0x20, 0xe0, 0x62, 0xd8, 0xc3, 0xc8, 0x24, 0xa9, 0x00,
+    0x48, 0x00, 0x18, 0x00, 0x08, 0x5d, 0xef, 0x75, 0x00, 0x31, 0xdf, 0xff, 0xdf, 0x0d, 0x00, 0x02,
+    0x06, 0x00, 0x5b, 0xdb, 0xde, 0x65, 0x29, 0x00, 0x01, 0x00, 0x42, 0x41, 0x18, 0x79, 0xe6, 0x1e,
+    0x00, 0x01, 0x29, 0x00, 0x0f, 0x05, 0x00, 0x28, 0x00, 0xcc, 0x00, 0x63, 0x59, 0xfe, 0xe3, 0x98,
+    0x41, 0xc0, 0xc4, 0x00, 0x00, 0xd0, 0x00, 0x02, 0x04, 0x00, 0x08, 0xca, 0x00, 0x06, 0x0c, 0x00,
+    0x08, 0xcc, 0x00, 0x01, 0x0c, 0x00, 0xf1, 0x06, 0x20, 0xe0, 0x20, 0xd0, 0xa2, 0xc8, 0x62, 0xb8,
+    0x00, 0x90, 0x00, 0x60, 0x00, 0x38, 0x00, 0x18, 0x00, 0x00, 0x10, 0x8c, 0xff, 0xc2, 0x00, 0x02,
+    0xa2, 0x00, 0x02, 0x06, 0x00, 0x02, 0xa3, 0x00, 0x00, 0xda, 0x00, 0x49, 0xbe, 0xf7, 0xa6, 0x31,
+    0xcf, 0x00, 0x70, 0x10, 0x61, 0x48, 0xd7, 0xfd, 0x9e, 0xff, 0x1c, 0x00, 0x02, 0x26, 0x00, 0x0f,
+    0x06, 0x00, 0x04, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x08,
+    0xed, 0xdf, 0xff, 0xbe, 0xff, 0xf7, 0xfd, 0xe3, 0xa8, 0x41, 0xb8, 0x01, 0xc8, 0x00, 0xd0, 0x02,
+    0x00, 0x2f, 0xd8, 0x00, 0x02, 0x00, 0x01, 0x42, 0xe0, 0x00, 0xd8, 0x00, 0x04, 0x00, 0x10, 0xe0,
+    0x08, 0x00, 0xf9, 0x08, 0xa2, 0xd0, 0x82, 0x98, 0x00, 0x50, 0x00, 0x28, 0x00, 0x20, 0x00, 0x18,
+    0x00, 0x10, 0x00, 0x08, 0x82, 0x10, 0x1c, 0xe7, 0xdf, 0xff, 0xdf, 0x76, 0x00, 0x00, 0x0e, 0x00,
+    0x00, 0x04, 0x00, 0x04, 0x15, 0x00, 0x34, 0xeb, 0x5a, 0x00, 0x01, 0x00, 0xab, 0x10, 0x00, 0x38,
+    0xc3, 0xb0, 0x04, 0xc1, 0x96, 0xfd, 0x9e, 0x34, 0x00, 0x04, 0x2c, 0x00, 0x0f, 0x08, 0x00, 0x15,
+    0x00, 0xcc, 0x00, 0x9f, 0xba, 0xfe, 0x45, 0xa1, 0x41, 0xb8, 0x00, 0xc8, 0x00, 0xce, 0x00, 0x01,
+    0x04, 0xe0, 0x00, 0x02, 0xd4, 0x00, 0x19, 0xd0, 0xdc, 0x00, 0x00, 0xd0, 0x00, 0xf0, 0x02, 0xd8,
+    0x21, 0xd0, 0xa3, 0xc0, 0x00, 0x78, 0x00, 0x30, 0x00, 0x18, 0x28, 0x4a, 0x7d, 0xef, 0xf4, 0x9c,
+    0xa3, 0x00, 0x22, 0x0c, 0x63, 0x80, 0x00, 0x02, 0xd2, 0x00, 0x04, 0x06, 0x00, 0x02, 0x14, 0x00,
+    0x11, 0xde, 0x07, 0x00, 0x00, 0x14, 0x00, 0x20, 0x8a, 0x52, 0x2c, 0x00, 0xef, 0x00, 0x08, 0x00,
+    0x28, 0x81, 0x88, 0x61, 0xd8, 0x41, 0xe0, 0x24, 0xb9, 0x18, 0xfe, 0xd0, 0x00, 0x0c, 0x50, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xee, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x04, 0xe5, 0xdf, 0xff, 0xde, 0xff,
+    0x5c, 0xff, 0x49, 0xc2, 0x41, 0xb0, 0x20, 0xc0, 0x00, 0xc8, 0x02, 0x00, 0x2e, 0xd0, 0x00, 0x02,
+    0x00, 0x31, 0xd8, 0x00, 0xd8, 0x16, 0x00, 0x00, 0x08, 0x00, 0x05, 0x04, 0x00, 0xf0, 0x0b, 0x20,
+    0xd8, 0x01, 0xd0, 0xc3, 0xc0, 0x00, 0x68, 0x00, 0x20, 0xa2, 0x30, 0xb6, 0xbd, 0xff, 0xff, 0xdf,
+    0xff, 0xe4, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xdf, 0x71, 0x00, 0x01, 0x05, 0x00, 0x10, 0xff,
+    0x06, 0x00, 0x00, 0x10, 0x00, 0x20, 0xdf, 0xff, 0x02, 0x00, 0x00, 0x18, 0x00, 0x02, 0x04, 0x00,
+    0x00, 0x18, 0x00, 0xf1, 0x06, 0xaa, 0x52, 0x00, 0x00, 0x00, 0x18, 0x00, 0x60, 0xa2, 0xc8, 0x41,
+    0xe8, 0x00, 0xe8, 0x41, 0xd8, 0xe7, 0xd9, 0xfb, 0xfe, 0xbe, 0x32, 0x00, 0x02, 0x24, 0x00, 0x0f,
+    0x06, 0x00, 0x1b, 0x98, 0xdf, 0xff, 0x9d, 0xff, 0x2c, 0xc3, 0x41, 0xa8, 0x00, 0xcc, 0x00, 0x11,
+    0xc8, 0xb6, 0x00, 0x0f, 0xd0, 0x00, 0x01, 0x00, 0x14, 0x00, 0x05, 0xca, 0x00, 0x71, 0x00, 0xd8,
+    0x00, 0xd8, 0x20, 0xd0, 0xa3, 0xcc, 0x00, 0x40, 0x48, 0x52, 0x7d, 0xf7, 0x7a, 0x00, 0x20, 0x55,
+    0xad, 0xcc, 0x00, 0x20, 0xae, 0x73, 0xd8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0xa2, 0xdf,
+    0xff, 0x9e, 0xf7, 0x45, 0x29, 0x28, 0x42, 0xbe, 0xf7, 0x0e, 0x00, 0x00, 0x18, 0x00, 0x00, 0xca,
+    0x00, 0x00, 0x04, 0x00, 0xff, 0x06, 0xc7, 0x41, 0x00, 0x10, 0x00, 0x30, 0xa2, 0xb8, 0x41, 0xe0,
+    0x20, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x61, 0xd8, 0xaa, 0xd2, 0x5c, 0xce, 0x00, 0x09, 0x50, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xdd, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x04, 0xab, 0x9e, 0xff, 0xf3, 0xfc,
+    0x61, 0x98, 0x41, 0xb8, 0x00, 0xc8, 0x02, 0x00, 0x2f, 0xd0, 0x00, 0x02, 0x00, 0x05, 0x22, 0xd8,
+    0x00, 0x02, 0x00, 0x10, 0xd0, 0x08, 0x00, 0x91, 0x82, 0xc0, 0x20, 0x70, 0x00, 0x20, 0x28, 0x5a,
+    0xdf, 0x60, 0x00, 0xc0, 0xdf, 0xff, 0x8a, 0x52, 0x00, 0x00, 0x41, 0x08, 0x1c, 0xe7, 0xff, 0xff,
+    0x12, 0x00, 0x20, 0xdf, 0xff, 0x02, 0x00, 0xa2, 0xff, 0xff, 0x13, 0x9d, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x42, 0x16, 0x00, 0x01, 0x2b, 0x00, 0x01, 0x05, 0x00, 0xe0, 0x92, 0x94, 0x00, 0x10, 0x00,
+    0x30, 0x40, 0x80, 0x82, 0xd0, 0x00, 0xe8, 0x00, 0xf0, 0x02, 0x00, 0x71, 0x40, 0xe8, 0x82, 0xc8,
+    0x30, 0xfc, 0x9e, 0x1e, 0x00, 0x0f, 0x05, 0x00, 0x1b, 0x00, 0x6a, 0x00, 0x8b, 0x5d, 0xff, 0x24,
+    0xa9, 0x41, 0xb8, 0x00, 0xc0, 0xcc, 0x00, 0x04, 0xdc, 0x00, 0x0f, 0xd2, 0x00, 0x0b, 0xa3, 0xd0,
+    0x82, 0xc8, 0x20, 0x90, 0x00, 0x28, 0xe7, 0x49, 0x9e, 0xbc, 0x00, 0x80, 0x9e, 0xf7, 0x40, 0x08,
+    0x00, 0x00, 0x28, 0x42, 0x5a, 0x00, 0x02, 0xba, 0x00, 0x00, 0xd4, 0x00, 0xa8, 0xbe, 0xf7, 0x61,
+    0x08, 0x00, 0x00, 0x62, 0x08, 0x7a, 0xce, 0xa0, 0x00, 0xe0, 0xdf, 0xff, 0x9e, 0xf7, 0x41, 0x10,
+    0x00, 0x20, 0x00, 0x68, 0xc3, 0xc0, 0x20, 0xe0, 0xca, 0x00, 0x02, 0x04, 0x00, 0x71, 0x40, 0xe8,
+    0x04, 0xd1, 0xba, 0xfe, 0xbe, 0x52, 0x00, 0x08, 0x30, 0x00, 0x03, 0x0c, 0x00, 0x50, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe2, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x00, 0xef, 0xdf, 0xff, 0x5d, 0xff, 0xcb,
+    0xba, 0x41, 0xa8, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc8, 0x02, 0x00, 0x06, 0x2f, 0xd0, 0x00, 0x02,
+    0x00, 0x01, 0xe3, 0xd8, 0x00, 0xd8, 0x41, 0xc8, 0xa3, 0x98, 0x00, 0x38, 0x61, 0x28, 0xdf, 0xff,
+    0xdf, 0x5e, 0x00, 0x80, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x14, 0xa5, 0x12, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x08, 0x00, 0x40, 0xff, 0xff, 0x8a, 0x52, 0x16, 0x00, 0x33, 0x6d, 0x6b, 0xff, 0x28,
+    0x00, 0x02, 0x1a, 0x00, 0xf6, 0x01, 0xbf, 0xff, 0xc7, 0x41, 0x00, 0x10, 0x00, 0x38, 0x61, 0xa8,
+    0x41, 0xd8, 0x20, 0xe8, 0x00, 0xf0, 0x02, 0x00, 0x73, 0x62, 0xd8, 0x49, 0xd2, 0x3c, 0xff, 0xbf,
+    0x54, 0x00, 0x0f, 0x07, 0x00, 0x15, 0x81, 0xbe, 0xff, 0x35, 0xfd, 0x62, 0x98, 0x21, 0xb8, 0xce,
+    0x00, 0x00, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x0e, 0xd6, 0x00, 0x0f, 0xcc, 0x00, 0x01, 0x00, 0x14,
+    0x00, 0x90, 0xc8, 0xc3, 0xb8, 0x00, 0x48, 0x00, 0x18, 0x54, 0xb5, 0x70, 0x00, 0xc0, 0xfe, 0xff,
+    0xff, 0xff, 0xbe, 0xf7, 0x41, 0x00, 0x00, 0x00, 0x61, 0x08, 0xc4, 0x00, 0x00, 0xb2, 0x00, 0x00,
+    0x18, 0x00, 0x40, 0xff, 0xff, 0xf7, 0xbd, 0xcc, 0x00, 0x22, 0xe7, 0x39, 0x0e, 0x00, 0x02, 0xd2,
+    0x00, 0x00, 0x1e, 0x00, 0xb9, 0x4d, 0x6b, 0x00, 0x10, 0x00, 0x28, 0x81, 0x88, 0x62, 0xd0, 0x00,
+    0xcc, 0x00, 0x94, 0x00, 0xf0, 0x21, 0xe0, 0xa2, 0xc8, 0x92, 0xfc, 0x9e, 0x31, 0x00, 0x0a, 0x08,
+    0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x1d, 0xff, 0x01, 0x00, 0xc7, 0xdf, 0xff,
+    0x3c, 0xff, 0xc7, 0xb1, 0x41, 0xb0, 0x00, 0xb8, 0x00, 0xc0, 0x02, 0x00, 0x2f, 0xc8, 0x00, 0x02,
+    0x00, 0x03, 0x60, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x00, 0x06, 0x00, 0x02, 0x04, 0x00, 0xd2, 0xc8,
+    0xa2, 0xb8, 0x00, 0x78, 0x00, 0x20, 0x28, 0x52, 0xff, 0xff, 0xdf, 0xff, 0x04, 0x00, 0x82, 0x51,
+    0x8c, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x6b, 0x00, 0x02, 0x16, 0x00, 0xa0, 0xdf, 0xff, 0xe7,
+    0x39, 0x00, 0x00, 0x61, 0x08, 0x1c, 0xe7, 0x16, 0x00, 0x15, 0xde, 0x2c, 0x00, 0xf9, 0x01, 0x79,
+    0xce, 0x20, 0x08, 0x00, 0x20, 0x00, 0x70, 0xa2, 0xc8, 0x20, 0xe0, 0x00, 0xe8, 0x00, 0xf0, 0x02,
+    0x00, 0x81, 0xe8, 0x41, 0xe0, 0x45, 0xd1, 0xbb, 0xfe, 0xdf, 0x2e, 0x00, 0x00, 0x38, 0x00, 0x0f,
+    0x04, 0x00, 0x0d, 0x8b, 0xdf, 0xff, 0xbe, 0xff, 0x34, 0xf5, 0x41, 0xa0, 0xcc, 0x00, 0x00, 0xd8,
+    0x00, 0x0f, 0xce, 0x00, 0x03, 0x02, 0xca, 0x00, 0x02, 0x06, 0x00, 0xb0, 0xd0, 0x00, 0xd0, 0x61,
+    0xc0, 0x82, 0x90, 0x00, 0x30, 0x82, 0x28, 0xb4, 0x00, 0x00, 0x6c, 0x00, 0xc0, 0xdf, 0xff, 0xbf,
+    0xff, 0xa6, 0x31, 0x00, 0x00, 0x20, 0x00, 0x9d, 0xf7, 0x10, 0x00, 0x04, 0x04, 0x00, 0x20, 0x35,
+    0xad, 0xe2, 0x00, 0x13, 0xf0, 0xe2, 0x00, 0x04, 0x16, 0x00, 0xa1, 0x3c, 0xe7, 0xa2, 0x18, 0x00,
+    0x10, 0x00, 0x40, 0xa2, 0xb8, 0xcc, 0x00, 0x1d, 0xe8, 0xd0, 0x00, 0x6f, 0xf0, 0x61, 0xd0, 0x71,
+    0xfc, 0x9e, 0xce, 0x00, 0x01, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x1b, 0xff, 0x01,
+    0x00, 0xed, 0xde, 0xff, 0x7d, 0xff, 0x44, 0x91, 0x20, 0xa0, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xc0,
+    0x02, 0x00, 0x2f, 0xc8, 0x00, 0x02, 0x00, 0x07, 0xd2, 0xd0, 0x00, 0xd0, 0x00, 0xc8, 0x82, 0xb0,
+    0x00, 0x40, 0x00, 0x10, 0x13, 0xad, 0x57, 0x00, 0xc2, 0xdf, 0xff, 0xdf, 0xff, 0xfc, 0xde, 0x21,
+    0x00, 0x00, 0x00, 0x69, 0x4a, 0x12, 0x00, 0x02, 0x06, 0x00, 0x92, 0x3c, 0xe7, 0x20, 0x00, 0x00,
+    0x00, 0xa6, 0x31, 0xdf, 0x0f, 0x00, 0x01, 0x06, 0x00, 0xf3, 0x01, 0xbf, 0xff, 0xff, 0xff, 0x04,
+    0x21, 0x00, 0x10, 0x00, 0x28, 0x04, 0x99, 0x62, 0xd0, 0x00, 0xe8, 0x02, 0x00, 0x26, 0xf0, 0x00,
+    0x02, 0x00, 0xa1, 0xe8, 0x00, 0xf0, 0x41, 0xd8, 0x24, 0xb9, 0xdb, 0xfe, 0xbe, 0x32, 0x00, 0x0f,
+    0x05, 0x00, 0x0f, 0x83, 0xbe, 0xff, 0x92, 0xec, 0x61, 0x90, 0x20, 0xb0, 0xcc, 0x00, 0x0a, 0xd4,
+    0x00, 0x02, 0xca, 0x00, 0x1f, 0xc0, 0xd2, 0x00, 0x02, 0xf2, 0x00, 0xd0, 0x00, 0xd0, 0x20, 0xc8,
+    0x61, 0xb8, 0x40, 0x88, 0x00, 0x20, 0x24, 0x29, 0x9e, 0xf7, 0x6a, 0x00, 0x00, 0xae, 0x00, 0x80,
+    0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x71, 0x8c, 0x12, 0x00, 0x00, 0xde, 0x00, 0xc0, 0xff, 0xff,
+    0xff, 0xf7, 0x0c, 0x5b, 0x00, 0x00, 0x82, 0x10, 0x3c, 0xe7, 0x14, 0x00, 0x02, 0x04, 0x00, 0x00,
+    0x2a, 0x00, 0xb6, 0x8e, 0x73, 0x00, 0x00, 0x00, 0x10, 0x00, 0x30, 0xc3, 0x98, 0x41, 0xce, 0x00,
+    0x40, 0xe8, 0x00, 0xf0, 0x00, 0x04, 0x00, 0xe2, 0xf0, 0x00, 0xe8, 0x20, 0xf0, 0x00, 0xf0, 0x20,
+    0xe0, 0x61, 0xc8, 0xcf, 0xfb, 0x9e, 0x35, 0x00, 0x08, 0x06, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xed, 0x00, 0x1b, 0xff, 0x01, 0x00, 0xe3, 0x3c, 0xff, 0x86, 0xa9, 0x41, 0xa8, 0x00, 0xb0,
+    0x00, 0xb8, 0x00, 0xb8, 0x00, 0xc0, 0x06, 0x00, 0x2c, 0xc0, 0x00, 0x02, 0x00, 0x2e, 0xc8, 0x00,
+    0x02, 0x00, 0xb8, 0xd0, 0x40, 0xc0, 0xc3, 0xa0, 0x00, 0x38, 0x00, 0x10, 0x38, 0xc6, 0x55, 0x00,
+    0xe0, 0x61, 0x08, 0x00, 0x00, 0x40, 0x08, 0x79, 0xce, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x06,
+    0x00, 0x80, 0x3b, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x71, 0x8c, 0x0c, 0x00, 0x02, 0x2a, 0x00, 0x00,
+    0x0a, 0x00, 0x30, 0xf3, 0x9c, 0x00, 0x01, 0x00, 0x9f, 0x08, 0x00, 0x18, 0x00, 0x60, 0x82, 0xd0,
+    0x00, 0xe8, 0x02, 0x00, 0x05, 0x60, 0x20, 0xe0, 0x25, 0xc9, 0xbb, 0xfe, 0x32, 0x00, 0x02, 0x3c,
+    0x00, 0x0f, 0x06, 0x00, 0x07, 0x63, 0xde, 0xff, 0x18, 0xfe, 0x82, 0x98, 0xcc, 0x00, 0x00, 0xd0,
+    0x00, 0x02, 0x04, 0x00, 0x0c, 0xcc, 0x00, 0x00, 0x10, 0x00, 0x0e, 0xce, 0x00, 0xf0, 0x08, 0xc8,
+    0xa2, 0xb8, 0x00, 0x58, 0x00, 0x20, 0x8a, 0x62, 0xff, 0xff, 0xdb, 0xee, 0xeb, 0x72, 0x00, 0x18,
+    0xa3, 0x30, 0x49, 0x5a, 0x0c, 0x6b, 0xa3, 0x00, 0x20, 0xa2, 0x10, 0x74, 0x00, 0x00, 0xcc, 0x00,
+    0x00, 0x86, 0x00, 0x60, 0xc6, 0x31, 0x00, 0x00, 0xe3, 0x18, 0x12, 0x00, 0x02, 0x04, 0x00, 0x00,
+    0x18, 0x00, 0xff, 0x01, 0xd7, 0xbd, 0x00, 0x00, 0x20, 0x00, 0x61, 0x08, 0x55, 0xb5, 0x20, 0x18,
+    0x00, 0x48, 0x82, 0xc8, 0xcc, 0x00, 0x05, 0x00, 0x18, 0x00, 0x51, 0xa2, 0xd0, 0x34, 0xfd, 0x9e,
+    0x18, 0x01, 0x02, 0x40, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x00, 0x17, 0xff, 0x01, 0x00, 0xcd, 0xdf, 0xff, 0x9e, 0xff, 0x2c, 0xbb, 0x41, 0x98, 0x00,
+    0xb0, 0x00, 0xb8, 0x02, 0x00, 0x2f, 0xc0, 0x00, 0x02, 0x00, 0x01, 0x26, 0xc8, 0x00, 0x02, 0x00,
+    0xf3, 0x11, 0xc0, 0x61, 0x98, 0x00, 0x28, 0x61, 0x18, 0xbe, 0xff, 0x4d, 0x7b, 0x00, 0x28, 0x00,
+    0x30, 0x00, 0x58, 0x00, 0x38, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xff,
+    0xff, 0xdf, 0x6a, 0x00, 0x82, 0x51, 0x8c, 0x00, 0x00, 0x61, 0x08, 0x3c, 0xe7, 0x12, 0x00, 0x11,
+    0xdf, 0x18, 0x00, 0xff, 0x05, 0x1c, 0xe7, 0x82, 0x10, 0x00, 0x00, 0x41, 0x08, 0x59, 0xce, 0xbe,
+    0xff, 0x04, 0x31, 0x00, 0x38, 0x82, 0xc0, 0x00, 0xe8, 0x02, 0x00, 0x07, 0x51, 0x41, 0xd0, 0xcb,
+    0xd2, 0x7d, 0x38, 0x00, 0x03, 0x53, 0x00, 0x0f, 0x07, 0x00, 0x02, 0xaf, 0xdf, 0xff, 0x5d, 0xff,
+    0x04, 0x89, 0x21, 0xa0, 0x00, 0xb0, 0xd0, 0x00, 0x02, 0x1f, 0xb8, 0xd0, 0x00, 0x00, 0x07, 0xcc,
+    0x00, 0xf0, 0x09, 0x82, 0xb0, 0x00, 0x68, 0x00, 0x18, 0xae, 0x83, 0x65, 0x49, 0x00, 0x28, 0x00,
+    0x58, 0x04, 0x99, 0xc3, 0xa8, 0xe3, 0xa0, 0x61, 0x68, 0x00, 0x28, 0xd0, 0x00, 0x24, 0x18, 0xc6,
+    0xbc, 0x00, 0x80, 0x5d, 0xef, 0xe3, 0x18, 0x00, 0x00, 0xd3, 0x9c, 0x10, 0x00, 0x02, 0xca, 0x00,
+    0x40, 0xff, 0xff, 0x9e, 0xf7, 0xf2, 0x00, 0x40, 0x00, 0x00, 0xb3, 0x94, 0x0c, 0x00, 0x1f, 0x44,
+    0xce, 0x00, 0x0f, 0x6a, 0xd8, 0x24, 0xb9, 0xfb, 0xfe, 0xbe, 0xc4, 0x00, 0x50, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x09, 0x01, 0x17, 0xff, 0x01, 0x00, 0xa3, 0xbe, 0xff, 0x92, 0xec, 0x61, 0x90, 0x20,
+    0xa8, 0x00, 0xb0, 0x02, 0x00, 0x2c, 0xb8, 0x00, 0x02, 0x00, 0x2c, 0xc0, 0x00, 0x02, 0x00, 0x21,
+    0xc8, 0x00, 0x02, 0x00, 0xf2, 0x21, 0x21, 0xb8, 0xc3, 0x90, 0x00, 0x30, 0x00, 0x10, 0x82, 0x30,
+    0x00, 0x48, 0x81, 0x90, 0xa2, 0xb8, 0x21, 0xb8, 0x20, 0xb8, 0x41, 0xb8, 0xa3, 0xb8, 0x00, 0x70,
+    0x00, 0x18, 0x00, 0x00, 0x92, 0x94, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xcf, 0x73,
+    0x00, 0x00, 0xa6, 0x31, 0xbe, 0xf7, 0x0e, 0x00, 0x00, 0x06, 0x00, 0xa0, 0x9e, 0xf7, 0x04, 0x21,
+    0x00, 0x00, 0x00, 0x00, 0x71, 0x8c, 0x24, 0x00, 0xff, 0x01, 0x5d, 0xef, 0xc3, 0x20, 0x00, 0x38,
+    0x82, 0xc0, 0x00, 0xe8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe8, 0x02, 0x00, 0x01, 0x77, 0x21, 0xe0,
+    0x61, 0xc8, 0x10, 0xfc, 0x9e, 0xba, 0x00, 0x0f, 0x0b, 0x00, 0x01, 0x76, 0xbe, 0xff, 0x49, 0xb2,
+    0x21, 0x98, 0x21, 0xce, 0x00, 0x40, 0xb0, 0x00, 0xb8, 0x00, 0x04, 0x00, 0x08, 0xd4, 0x00, 0x0c,
+    0xce, 0x00, 0x11, 0xc0, 0xce, 0x00, 0xf0, 0x04, 0xc0, 0xa2, 0xb8, 0x00, 0x50, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x48, 0xe3, 0xa0, 0x20, 0xb8, 0x00, 0xc8, 0x00, 0xd0, 0x18, 0x00, 0x40, 0x20, 0xc8,
+    0x61, 0xa8, 0xe4, 0x00, 0x40, 0x00, 0x08, 0x51, 0x8c, 0x72, 0x00, 0x20, 0x1c, 0xe7, 0xb8, 0x00,
+    0x10, 0xbe, 0x0b, 0x00, 0x10, 0xff, 0xbc, 0x00, 0x00, 0x09, 0x00, 0x20, 0xc3, 0x18, 0x14, 0x00,
+    0x20, 0x6d, 0x6b, 0x0c, 0x00, 0xa1, 0xff, 0xff, 0x9a, 0xde, 0x20, 0x18, 0x00, 0x40, 0xa2, 0xc8,
+    0xcc, 0x00, 0x00, 0xd0, 0x00, 0x0f, 0xd2, 0x00, 0x02, 0x51, 0x41, 0xd8, 0xc7, 0xd1, 0x7d, 0x1e,
+    0x01, 0x02, 0x36, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x00, 0x17,
+    0xff, 0x01, 0x00, 0xa9, 0xfb, 0xfe, 0xe3, 0x90, 0x20, 0xa0, 0x00, 0xa8, 0x00, 0xb0, 0x02, 0x00,
+    0x57, 0xb8, 0x00, 0xb0, 0x00, 0xb8, 0x02, 0x00, 0x2d, 0xc0, 0x00, 0x02, 0x00, 0xf0, 0x07, 0x21,
+    0xb8, 0x61, 0x98, 0x00, 0x28, 0x00, 0x20, 0x00, 0x60, 0xa2, 0xa8, 0x41, 0xb8, 0x00, 0xc0, 0x00,
+    0xc8, 0x00, 0xc8, 0x20, 0xc8, 0x06, 0x00, 0xf3, 0x08, 0x41, 0xc0, 0x82, 0x98, 0x00, 0x40, 0x00,
+    0x18, 0x00, 0x00, 0x8a, 0x52, 0xbb, 0xde, 0x65, 0x29, 0x00, 0x00, 0x54, 0xad, 0xff, 0xff, 0xdf,
+    0x76, 0x00, 0xa4, 0x5d, 0xef, 0x04, 0x19, 0x00, 0x00, 0x00, 0x00, 0x48, 0x42, 0x14, 0x00, 0xa9,
+    0x75, 0xbd, 0x00, 0x20, 0x00, 0x68, 0x82, 0xc8, 0x00, 0xe0, 0x02, 0x00, 0x2a, 0xe8, 0x00, 0x02,
+    0x00, 0x54, 0xe0, 0xa2, 0xc0, 0x9a, 0xfe, 0x46, 0x00, 0x03, 0x4d, 0x00, 0x09, 0x07, 0x00, 0x81,
+    0xdf, 0xff, 0xd7, 0xf5, 0x82, 0x90, 0x00, 0xa8, 0xce, 0x00, 0x02, 0x06, 0x00, 0x0c, 0xd6, 0x00,
+    0x06, 0xd4, 0x00, 0x0a, 0xd0, 0x00, 0xb1, 0xb8, 0x61, 0xb0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x50,
+    0xa3, 0xa8, 0xea, 0x00, 0x01, 0xc8, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x04, 0x00, 0x41, 0x41, 0xb8,
+    0xc2, 0xa0, 0xd0, 0x00, 0x70, 0x08, 0x41, 0x08, 0x00, 0x00, 0x89, 0x52, 0xb8, 0x00, 0x11, 0xdf,
+    0xd0, 0x00, 0x40, 0xbe, 0xf7, 0xa2, 0x10, 0xcc, 0x00, 0x40, 0x69, 0x4a, 0xbe, 0xf7, 0x12, 0x00,
+    0x00, 0x9e, 0x00, 0x7c, 0xaa, 0x72, 0x00, 0x38, 0xc3, 0xa0, 0x41, 0xce, 0x00, 0x1b, 0xe0, 0xce,
+    0x00, 0x68, 0xe8, 0x82, 0xc8, 0x14, 0xfd, 0x9e, 0xc0, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0x00, 0x13, 0xff, 0x01, 0x00, 0xa5, 0xdf, 0xff, 0xbe, 0xff, 0xd3, 0xdc, 0x61, 0x90, 0x00,
+    0xa8, 0x02, 0x00, 0x2a, 0xb0, 0x00, 0x02, 0x00, 0x2c, 0xb8, 0x00, 0x02, 0x00, 0x21, 0xc0, 0x00,
+    0x02, 0x00, 0xc1, 0x20, 0xb8, 0x81, 0xb0, 0x00, 0x68, 0x00, 0x68, 0xa3, 0xa8, 0x21, 0xb8, 0x12,
+    0x00, 0x27, 0xc8, 0x00, 0x02, 0x00, 0xf2, 0x03, 0x20, 0xc8, 0x20, 0xb8, 0xc2, 0xb0, 0x00, 0x60,
+    0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0xe7, 0x39, 0x79, 0xce, 0x73, 0x00, 0xf0, 0x01, 0x9a, 0xd6,
+    0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0x5d, 0xef, 0xff, 0xff, 0xdf, 0xff, 0x04, 0x00,
+    0xcd, 0xbe, 0xf7, 0x00, 0x20, 0x00, 0x58, 0xc3, 0xc0, 0x20, 0xd0, 0x00, 0xe0, 0x02, 0x00, 0x27,
+    0xe8, 0x00, 0x02, 0x00, 0x51, 0x81, 0xd0, 0x10, 0xec, 0x7e, 0x36, 0x00, 0x02, 0x4e, 0x00, 0x0a,
+    0x06, 0x00, 0x78, 0xdf, 0xff, 0x9e, 0xff, 0x4c, 0xbb, 0x20, 0xce, 0x00, 0x1b, 0xa8, 0xce, 0x00,
+    0x00, 0xdc, 0x00, 0x0f, 0xd0, 0x00, 0x02, 0x83, 0x20, 0xb8, 0x40, 0xa8, 0x20, 0xa0, 0x41, 0xb0,
+    0xcc, 0x00, 0x18, 0xc0, 0xcc, 0x00, 0x02, 0x0c, 0x00, 0xf0, 0x07, 0x20, 0xc0, 0xc3, 0xa8, 0x00,
+    0x40, 0x00, 0x10, 0x00, 0x18, 0x00, 0x10, 0x20, 0x10, 0x49, 0x52, 0xfc, 0xde, 0x14, 0xa5, 0x82,
+    0x10, 0xcc, 0x00, 0x42, 0x24, 0x21, 0x3c, 0xe7, 0x8a, 0x00, 0x00, 0xd0, 0x00, 0xa1, 0xae, 0x7b,
+    0x00, 0x20, 0x41, 0x90, 0x41, 0xc8, 0x00, 0xd8, 0xcc, 0x00, 0x02, 0x06, 0x00, 0x06, 0xd8, 0x00,
+    0x00, 0xce, 0x00, 0x12, 0xe0, 0xd4, 0x00, 0x58, 0x61, 0xd0, 0xab, 0xd2, 0x3d, 0xce, 0x00, 0x50,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x00, 0x13, 0xff, 0x01, 0x00, 0xab, 0xdf, 0xff, 0x9e, 0xff,
+    0xe7, 0x91, 0x40, 0x90, 0x00, 0xa8, 0x02, 0x00, 0x2a, 0xb0, 0x00, 0x02, 0x00, 0x28, 0xb8, 0x00,
+    0x02, 0x00, 0x30, 0xc0, 0x00, 0xc0, 0x10, 0x00, 0x50, 0x20, 0xb8, 0x20, 0xb8, 0x20, 0x0c, 0x00,
+    0x04, 0x04, 0x00, 0x63, 0xc8, 0x00, 0xc0, 0x20, 0xc8, 0x00, 0x02, 0x00, 0xf3, 0x04, 0x20, 0xc8,
+    0x20, 0xb8, 0x61, 0xa0, 0x00, 0x38, 0x00, 0x40, 0x20, 0x60, 0x00, 0x40, 0x00, 0x18, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x73, 0xc3, 0x18, 0x7d, 0xef, 0xff, 0xff, 0xdf, 0x02, 0x00, 0xef, 0x3c, 0xef,
+    0x41, 0x18, 0x00, 0x38, 0xa2, 0xb8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xe0, 0x02, 0x00, 0x02, 0x31,
+    0xe8, 0x00, 0xe8, 0x18, 0x00, 0x83, 0xe8, 0x41, 0xd0, 0xc7, 0xb9, 0x1c, 0xff, 0xdf, 0xbe, 0x00,
+    0x0c, 0x07, 0x00, 0xcb, 0xdf, 0xff, 0x5d, 0xff, 0x24, 0x81, 0x40, 0x90, 0x00, 0xa0, 0x00, 0xa0,
+    0xd0, 0x00, 0x1f, 0xa8, 0xd0, 0x00, 0x0a, 0x11, 0xb8, 0xd0, 0x00, 0x04, 0xc6, 0x00, 0x08, 0x08,
+    0x00, 0x03, 0xcc, 0x00, 0xf2, 0x07, 0x00, 0xc8, 0x20, 0xc0, 0x82, 0xb0, 0x00, 0x70, 0x00, 0x50,
+    0xe3, 0x88, 0xc3, 0xa8, 0x82, 0x98, 0x20, 0x60, 0x00, 0x28, 0x00, 0x18, 0x02, 0x00, 0x31, 0x82,
+    0x20, 0x3c, 0xce, 0x00, 0x02, 0x8e, 0x00, 0x81, 0x6d, 0x7b, 0x00, 0x20, 0x00, 0x68, 0x61, 0xc0,
+    0xcc, 0x00, 0x24, 0xd8, 0x00, 0x02, 0x00, 0x0f, 0xd8, 0x00, 0x01, 0x82, 0xe8, 0x41, 0xd0, 0x24,
+    0xb1, 0xbb, 0xfe, 0xbe, 0x39, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x00, 0x13, 0xff, 0x01, 0x00, 0xa1, 0xbf, 0xff, 0x9a, 0xfe, 0x82, 0x78, 0x20, 0x90, 0x00,
+    0xa0, 0x02, 0x00, 0x2e, 0xa8, 0x00, 0x02, 0x00, 0x24, 0xb0, 0x00, 0x02, 0x00, 0x2e, 0xb8, 0x00,
+    0x02, 0x00, 0x2c, 0xc0, 0x00, 0x02, 0x00, 0x23, 0xc8, 0x00, 0x02, 0x00, 0xf3, 0x10, 0x41, 0xb8,
+    0x82, 0x88, 0x00, 0x50, 0x20, 0x98, 0x81, 0xb8, 0x21, 0xb8, 0x20, 0xc0, 0x62, 0xb8, 0xc3, 0xb0,
+    0x00, 0x68, 0x00, 0x48, 0x41, 0x78, 0x00, 0x40, 0x00, 0x18, 0xa6, 0x41, 0xdf, 0x82, 0x00, 0xf1,
+    0x01, 0x5d, 0xef, 0x00, 0x10, 0x00, 0x40, 0xc3, 0xb0, 0x21, 0xc8, 0x00, 0xd8, 0x00, 0xd8, 0x00,
+    0xe0, 0x06, 0x00, 0x02, 0x0a, 0x00, 0x2d, 0xe0, 0x00, 0x02, 0x00, 0x73, 0x21, 0xd0, 0xa3, 0xb0,
+    0xf7, 0xfd, 0xbe, 0x3c, 0x00, 0x0c, 0x07, 0x00, 0x56, 0xbe, 0xff, 0xb6, 0xfd, 0x61, 0xce, 0x00,
+    0x00, 0xd4, 0x00, 0x0c, 0xd0, 0x00, 0x04, 0xcc, 0x00, 0x13, 0xb0, 0xcc, 0x00, 0x00, 0x10, 0x00,
+    0x04, 0xd6, 0x00, 0x11, 0xc0, 0x14, 0x00, 0x05, 0xd0, 0x00, 0xf3, 0x07, 0x20, 0xc0, 0x20, 0xb8,
+    0x61, 0xc0, 0x20, 0xb8, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xc0, 0x82, 0xb0, 0x00, 0x50, 0x00, 0x60,
+    0x81, 0xb8, 0xde, 0x00, 0xf0, 0x02, 0xd0, 0x00, 0xc8, 0xa2, 0xb8, 0x82, 0xa8, 0x82, 0xb8, 0x04,
+    0xa9, 0x00, 0x50, 0x00, 0x18, 0x51, 0x9c, 0x8c, 0x00, 0xc5, 0x9d, 0xf7, 0xe3, 0x20, 0x00, 0x20,
+    0x20, 0x88, 0x82, 0xc8, 0x00, 0xd0, 0xc8, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xd8, 0x00, 0x0d, 0xcc,
+    0x00, 0x90, 0x00, 0xe0, 0x20, 0xd0, 0x82, 0xb8, 0x14, 0xfd, 0x9e, 0x3b, 0x00, 0xb0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x13, 0xff, 0x01, 0x00, 0xab,
+    0xbe, 0xff, 0xd3, 0xe4, 0x41, 0x80, 0x20, 0x90, 0x00, 0xa0, 0x02, 0x00, 0x2a, 0xa8, 0x00, 0x02,
+    0x00, 0x28, 0xb0, 0x00, 0x02, 0x00, 0x2a, 0xb8, 0x00, 0x02, 0x00, 0xf0, 0x11, 0xc0, 0x00, 0xc0,
+    0x00, 0xc0, 0x20, 0xc0, 0x00, 0xb8, 0x82, 0xb8, 0x00, 0x80, 0xa2, 0xa8, 0x20, 0xb8, 0x20, 0xc0,
+    0x61, 0xb0, 0x00, 0x78, 0x00, 0x60, 0x82, 0xa0, 0x20, 0xb8, 0x20, 0xc8, 0x00, 0x02, 0x00, 0xf0,
+    0x02, 0xd0, 0x00, 0xc8, 0x20, 0xc0, 0x40, 0xc0, 0x20, 0xc0, 0x41, 0xb0, 0x04, 0x99, 0x00, 0x38,
+    0x29, 0x62, 0x83, 0x00, 0xe9, 0xae, 0x83, 0x00, 0x10, 0x00, 0x48, 0xa2, 0xb8, 0x00, 0xd0, 0x00,
+    0xd0, 0x00, 0xd8, 0x02, 0x00, 0x20, 0xe0, 0x00, 0x02, 0x00, 0x11, 0xd8, 0x06, 0x00, 0x00, 0x0a,
+    0x00, 0x01, 0x04, 0x00, 0x70, 0x21, 0xd8, 0x61, 0xc0, 0x51, 0xfc, 0x9e, 0x3b, 0x00, 0x0f, 0x04,
+    0x00, 0x00, 0xab, 0xbe, 0xff, 0x30, 0xd4, 0x41, 0x80, 0x00, 0x90, 0x00, 0x98, 0xce, 0x00, 0x00,
+    0xde, 0x00, 0x0f, 0xd0, 0x00, 0x07, 0x0a, 0xcc, 0x00, 0x03, 0x0e, 0x00, 0xf0, 0x08, 0x20, 0xb0,
+    0xa2, 0xa8, 0x00, 0x68, 0x00, 0x58, 0x00, 0x88, 0x41, 0xc0, 0x20, 0xb8, 0x82, 0x98, 0x00, 0x58,
+    0x00, 0x90, 0x82, 0xb8, 0x20, 0xea, 0x00, 0x00, 0xce, 0x00, 0x05, 0x04, 0x00, 0x60, 0x40, 0xc0,
+    0xa3, 0xa0, 0x00, 0x48, 0xce, 0x00, 0xc1, 0xdb, 0xde, 0x20, 0x18, 0x00, 0x30, 0x61, 0x80, 0x40,
+    0xc0, 0x00, 0xd8, 0xce, 0x00, 0x0c, 0xd2, 0x00, 0x00, 0xe0, 0x00, 0x01, 0xc6, 0x00, 0x05, 0xd4,
+    0x00, 0x66, 0xd8, 0x61, 0xc0, 0x8e, 0xf3, 0x9d, 0xca, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x00, 0x13, 0xff, 0x01, 0x00, 0xa1, 0xbe, 0xff, 0x4d, 0xc3, 0x20, 0x80, 0x00, 0x90, 0x00,
+    0x98, 0x02, 0x00, 0x2c, 0xa0, 0x00, 0x02, 0x00, 0x2a, 0xa8, 0x00, 0x02, 0x00, 0x22, 0xb0, 0x00,
+    0x02, 0x00, 0x5a, 0xb8, 0x00, 0xb0, 0x00, 0xb8, 0x02, 0x00, 0xfa, 0x0b, 0x82, 0xa8, 0x00, 0x58,
+    0x00, 0x38, 0x00, 0x68, 0x82, 0xb0, 0x00, 0xb8, 0x82, 0xb8, 0x00, 0x68, 0x00, 0x70, 0x81, 0xb0,
+    0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc8, 0x02, 0x00, 0xf5, 0x07, 0x20, 0xb8, 0xc3, 0xa0, 0x00, 0x40,
+    0x0c, 0x7b, 0xff, 0xff, 0x82, 0x10, 0x00, 0x18, 0x00, 0x68, 0xa2, 0xc0, 0x20, 0xc8, 0x00, 0xd0,
+    0x02, 0x00, 0x2e, 0xd8, 0x00, 0x02, 0x00, 0x23, 0xe0, 0x00, 0x02, 0x00, 0x73, 0x20, 0xd8, 0x41,
+    0xc8, 0x0b, 0xe3, 0x9e, 0xbe, 0x00, 0x0c, 0x07, 0x00, 0x7f, 0xbe, 0xff, 0x0c, 0xbb, 0x20, 0x80,
+    0x20, 0xce, 0x00, 0x15, 0x02, 0xca, 0x00, 0x07, 0x06, 0x00, 0xf3, 0x13, 0x20, 0xb0, 0x41, 0xb0,
+    0x20, 0xa8, 0x00, 0xb0, 0x20, 0xb0, 0x61, 0xa8, 0x20, 0x80, 0x00, 0x30, 0x00, 0x40, 0x82, 0x98,
+    0x20, 0xb0, 0x21, 0xb8, 0x00, 0xa0, 0x00, 0x58, 0x82, 0x98, 0x20, 0xb8, 0x00, 0xc8, 0xce, 0x00,
+    0x07, 0xd4, 0x00, 0xf9, 0x01, 0x40, 0xb8, 0xa2, 0x98, 0x00, 0x38, 0xf3, 0xb4, 0x6d, 0x73, 0x00,
+    0x10, 0x00, 0x38, 0xc3, 0xb0, 0xcc, 0x00, 0x1f, 0xd0, 0xcc, 0x00, 0x00, 0x14, 0xd8, 0xcc, 0x00,
+    0x96, 0x00, 0xe0, 0x20, 0xd8, 0x40, 0xc8, 0xaa, 0xda, 0x7d, 0xc7, 0x00, 0x50, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x04, 0x01, 0x13, 0xff, 0x01, 0x00, 0xa5, 0xbe, 0xff, 0xeb, 0xb2, 0x20, 0x80, 0x20,
+    0x90, 0x00, 0x98, 0x02, 0x00, 0x28, 0xa0, 0x00, 0x02, 0x00, 0x28, 0xa8, 0x00, 0x02, 0x00, 0x11,
+    0xb0, 0x0e, 0x00, 0x23, 0xb0, 0x00, 0x02, 0x00, 0xf7, 0x15, 0x21, 0xa8, 0x61, 0xa0, 0x00, 0x60,
+    0xa2, 0x90, 0x20, 0xa8, 0x41, 0xa8, 0x61, 0x70, 0x00, 0x38, 0x00, 0x48, 0xa2, 0x90, 0x41, 0xa8,
+    0x00, 0xb0, 0x41, 0xb0, 0x00, 0x70, 0x00, 0x98, 0x61, 0xb0, 0x00, 0xb8, 0x00, 0xc0, 0x02, 0x00,
+    0x21, 0xc8, 0x00, 0x02, 0x00, 0xf1, 0x01, 0x40, 0xb0, 0xa2, 0x88, 0x00, 0x30, 0x59, 0xde, 0x20,
+    0x18, 0x00, 0x30, 0x82, 0x88, 0x41, 0xb8, 0x16, 0x00, 0x26, 0xd0, 0x00, 0x02, 0x00, 0x60, 0xd8,
+    0x00, 0xd8, 0x00, 0xd0, 0x00, 0x06, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x53, 0x41, 0xc8, 0x8a, 0xda,
+    0x9e, 0xbe, 0x00, 0x0c, 0x07, 0x00, 0x85, 0xbe, 0xff, 0x4d, 0xbb, 0x20, 0x78, 0x00, 0x88, 0xcc,
+    0x00, 0x00, 0xd6, 0x00, 0x0e, 0xce, 0x00, 0x11, 0xa0, 0xc6, 0x00, 0x02, 0xd8, 0x00, 0x00, 0xd2,
+    0x00, 0xf0, 0x1f, 0xb0, 0x00, 0xb0, 0x20, 0xa8, 0x21, 0xa0, 0xa2, 0x90, 0x00, 0x50, 0x00, 0x48,
+    0x00, 0x70, 0x61, 0x98, 0x82, 0x90, 0x00, 0x38, 0x00, 0x30, 0x41, 0x80, 0x61, 0xa8, 0x00, 0xb8,
+    0x00, 0xb8, 0x41, 0xb0, 0x40, 0xa8, 0x40, 0xb8, 0x20, 0xb8, 0x00, 0xb8, 0x20, 0xb8, 0x41, 0xb0,
+    0x41, 0xd4, 0x00, 0x01, 0xc8, 0x00, 0x01, 0xb8, 0x00, 0xf7, 0x02, 0xc8, 0x41, 0xb0, 0x61, 0x70,
+    0x82, 0x48, 0x45, 0x41, 0x00, 0x20, 0x00, 0x60, 0xa2, 0xb0, 0x20, 0xc0, 0xc8, 0x00, 0x02, 0xd2,
+    0x00, 0x0f, 0xc4, 0x00, 0x00, 0x03, 0xdc, 0x00, 0x77, 0xe0, 0x20, 0xd8, 0x41, 0xc8, 0xcb, 0xe2,
+    0xce, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x13, 0xff, 0x01, 0x00, 0xad, 0xbe,
+    0xff, 0xef, 0xcb, 0x41, 0x78, 0x20, 0x88, 0x00, 0x98, 0x02, 0x00, 0x2a, 0xa0, 0x00, 0x02, 0x00,
+    0x29, 0xa8, 0x00, 0x02, 0x00, 0xf0, 0x0b, 0x62, 0x98, 0x20, 0x78, 0x00, 0x30, 0x00, 0x38, 0x00,
+    0x70, 0x61, 0x90, 0xe3, 0x88, 0x00, 0x50, 0x00, 0x38, 0x00, 0x68, 0x62, 0xa8, 0x00, 0xb0, 0x00,
+    0xb8, 0x02, 0x00, 0x11, 0x20, 0x06, 0x00, 0xc1, 0x21, 0xb8, 0x21, 0xa0, 0x00, 0x50, 0x00, 0x68,
+    0x41, 0xb0, 0x00, 0xc0, 0x02, 0x00, 0xff, 0x0a, 0xc8, 0x00, 0xc8, 0x00, 0xc8, 0x82, 0xb8, 0x00,
+    0x50, 0x00, 0x18, 0x00, 0x20, 0x00, 0x48, 0xa2, 0xb0, 0x00, 0xc0, 0x21, 0xd0, 0x00, 0xc8, 0x00,
+    0xd0, 0x02, 0x00, 0x08, 0x27, 0xd8, 0x00, 0x02, 0x00, 0x73, 0x20, 0xd0, 0x41, 0xc0, 0x4d, 0xeb,
+    0x9e, 0xbe, 0x00, 0x0c, 0x07, 0x00, 0xcd, 0xbf, 0xff, 0x92, 0xdc, 0x41, 0x70, 0x20, 0x88, 0x00,
+    0x90, 0x00, 0x90, 0xd0, 0x00, 0x1f, 0x98, 0xd0, 0x00, 0x05, 0xf3, 0x0a, 0x41, 0xa8, 0x62, 0x98,
+    0x41, 0x78, 0x00, 0x40, 0x00, 0x30, 0x61, 0x60, 0x82, 0x90, 0x82, 0x98, 0x00, 0x48, 0x00, 0x30,
+    0x00, 0x60, 0xa3, 0xa0, 0x20, 0xcc, 0x00, 0x00, 0xd0, 0x00, 0xf0, 0x03, 0x00, 0xb8, 0x20, 0xb8,
+    0x41, 0xb0, 0x00, 0x80, 0x00, 0x38, 0x00, 0x60, 0x41, 0xb0, 0x00, 0xc8, 0x00, 0xc0, 0xca, 0x00,
+    0xff, 0x01, 0x00, 0xc8, 0x20, 0xc8, 0xa2, 0xb0, 0x00, 0x30, 0x00, 0x18, 0x00, 0x38, 0xc3, 0x98,
+    0x21, 0xb8, 0xc6, 0x00, 0x08, 0x40, 0xd0, 0x00, 0xd8, 0x00, 0x04, 0x00, 0x07, 0xcc, 0x00, 0x87,
+    0x00, 0xd8, 0x20, 0xd0, 0x61, 0xc0, 0xf0, 0xfb, 0xce, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x00, 0x13, 0xff, 0x01, 0x00, 0xed, 0xbf, 0xff, 0x76, 0xf5, 0x41, 0x70, 0x20, 0x88, 0x00,
+    0x90, 0x00, 0x90, 0x00, 0x98, 0x02, 0x00, 0x2a, 0xa0, 0x00, 0x02, 0x00, 0xf0, 0x07, 0xa8, 0x00,
+    0xa8, 0x00, 0xa8, 0x01, 0xa0, 0x41, 0x90, 0x20, 0x70, 0x00, 0x30, 0x00, 0x38, 0x00, 0x78, 0x82,
+    0x98, 0x62, 0x90, 0x00, 0x0c, 0x00, 0x96, 0x40, 0xa2, 0x98, 0x20, 0xa8, 0x00, 0xb0, 0x00, 0xb8,
+    0x02, 0x00, 0xe2, 0x20, 0xb0, 0x82, 0xa8, 0x00, 0x70, 0x00, 0x40, 0x61, 0x70, 0x21, 0xb0, 0x00,
+    0xc0, 0x02, 0x00, 0xf3, 0x03, 0x20, 0xc0, 0x61, 0xb8, 0x20, 0x88, 0x00, 0x30, 0x00, 0x28, 0x20,
+    0x88, 0x41, 0xb8, 0x20, 0xc0, 0x00, 0xc8, 0x02, 0x00, 0x2f, 0xd0, 0x00, 0x02, 0x00, 0x05, 0x27,
+    0xd8, 0x00, 0x02, 0x00, 0x73, 0x20, 0xd0, 0x61, 0xb0, 0xb2, 0xfc, 0x9e, 0xbe, 0x00, 0x0c, 0x07,
+    0x00, 0x81, 0xbf, 0xff, 0x38, 0xfe, 0x61, 0x68, 0x20, 0x80, 0xce, 0x00, 0x00, 0xd2, 0x00, 0x00,
+    0x04, 0x00, 0x08, 0xd6, 0x00, 0x11, 0xa0, 0xe2, 0x00, 0x04, 0xd4, 0x00, 0x00, 0xce, 0x00, 0xf1,
+    0x0c, 0xa0, 0x41, 0x90, 0x40, 0x70, 0x00, 0x38, 0x00, 0x38, 0x82, 0x70, 0x41, 0x98, 0x41, 0xa0,
+    0x62, 0x80, 0x00, 0x40, 0x00, 0x38, 0xa2, 0x78, 0x40, 0xa0, 0x00, 0xb0, 0xce, 0x00, 0x00, 0x06,
+    0x00, 0xf7, 0x00, 0xa0, 0x61, 0xa8, 0x00, 0xb0, 0x20, 0xa8, 0xa2, 0xa0, 0x00, 0x58, 0x00, 0x48,
+    0xc2, 0x90, 0xce, 0x00, 0xa0, 0xb8, 0xa1, 0xa8, 0x00, 0x60, 0x00, 0x38, 0x41, 0x70, 0x82, 0xe2,
+    0x00, 0x04, 0xcc, 0x00, 0x00, 0x08, 0x00, 0x0f, 0xce, 0x00, 0x13, 0x66, 0xc8, 0x82, 0xb0, 0x96,
+    0xfd, 0xbe, 0xc7, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x01, 0x13, 0xff, 0x01, 0x00,
+    0xa9, 0xdf, 0xff, 0x1c, 0xff, 0xa2, 0x70, 0x20, 0x80, 0x00, 0x90, 0x02, 0x00, 0x2a, 0x98, 0x00,
+    0x02, 0x00, 0x24, 0xa0, 0x00, 0x02, 0x00, 0xf0, 0x0e, 0x98, 0x61, 0x98, 0x21, 0x78, 0x00, 0x30,
+    0x00, 0x38, 0x00, 0x70, 0x61, 0x90, 0x20, 0x98, 0x82, 0x88, 0x00, 0x30, 0x00, 0x30, 0x41, 0x80,
+    0x61, 0xa0, 0x20, 0xa8, 0x00, 0xb0, 0x02, 0x00, 0xf0, 0x04, 0x41, 0xa8, 0x00, 0x88, 0x00, 0x50,
+    0x00, 0x70, 0x61, 0xb0, 0x20, 0xa8, 0xa3, 0x88, 0x00, 0x48, 0x00, 0x60, 0xa2, 0x1a, 0x00, 0x21,
+    0xc0, 0x00, 0x02, 0x00, 0xef, 0x20, 0xb0, 0x61, 0x98, 0x00, 0x58, 0x00, 0x70, 0xa2, 0xa8, 0x20,
+    0xb8, 0x00, 0xc8, 0x02, 0x00, 0x04, 0x2e, 0xd0, 0x00, 0x02, 0x00, 0x21, 0xd8, 0x00, 0x02, 0x00,
+    0x73, 0x41, 0xc8, 0xc3, 0xa8, 0x59, 0xfe, 0xbe, 0xbe, 0x00, 0x0c, 0x07, 0x00, 0xc7, 0xdf, 0xff,
+    0x9e, 0xff, 0x86, 0x81, 0x20, 0x80, 0x00, 0x88, 0x00, 0x88, 0xd0, 0x00, 0x00, 0xcc, 0x00, 0x19,
+    0x90, 0xd2, 0x00, 0x02, 0xce, 0x00, 0xf0, 0x0b, 0x98, 0x40, 0x90, 0x61, 0x78, 0x00, 0x40, 0x00,
+    0x30, 0x82, 0x68, 0x61, 0x98, 0x20, 0x98, 0xa2, 0x90, 0x00, 0x50, 0x00, 0x30, 0x00, 0x50, 0x82,
+    0xa0, 0x00, 0xb2, 0x00, 0xf2, 0x0c, 0xb0, 0x00, 0xb0, 0x21, 0xa8, 0x82, 0xa0, 0x00, 0x60, 0x00,
+    0x40, 0x82, 0x78, 0x20, 0xa8, 0x61, 0xa8, 0x41, 0x68, 0x00, 0x40, 0x00, 0x80, 0x61, 0xb0, 0x00,
+    0xb8, 0xcc, 0x00, 0xb0, 0x00, 0xc0, 0x20, 0xb0, 0x81, 0xa0, 0x00, 0x78, 0x61, 0xb0, 0x20, 0x12,
+    0x00, 0x0f, 0xce, 0x00, 0x05, 0x1f, 0xc8, 0xce, 0x00, 0x00, 0x12, 0xd0, 0xce, 0x00, 0x67, 0x20,
+    0xc0, 0x65, 0xb1, 0x1b, 0xff, 0xce, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x13,
+    0xff, 0x01, 0x00, 0xa1, 0xdf, 0xff, 0xbe, 0xff, 0xaa, 0x9a, 0x40, 0x78, 0x00, 0x88, 0x02, 0x00,
+    0x2a, 0x90, 0x00, 0x02, 0x00, 0x29, 0x98, 0x00, 0x02, 0x00, 0xf3, 0x29, 0x21, 0x90, 0x82, 0x88,
+    0x00, 0x38, 0x00, 0x30, 0x00, 0x68, 0x61, 0x90, 0x20, 0x98, 0x61, 0x98, 0x41, 0x58, 0x00, 0x30,
+    0x00, 0x48, 0xa2, 0x98, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xb0, 0x21, 0xa0,
+    0xa2, 0x88, 0x00, 0x40, 0x00, 0x50, 0xa2, 0x90, 0x00, 0xa8, 0x82, 0xa0, 0x00, 0x40, 0x00, 0x30,
+    0x62, 0x98, 0x00, 0xb8, 0x02, 0x00, 0x30, 0xc0, 0x00, 0xc0, 0x0a, 0x00, 0x10, 0x61, 0x06, 0x00,
+    0x00, 0x0c, 0x00, 0x40, 0xc0, 0x00, 0xc8, 0x00, 0x04, 0x00, 0x2f, 0xc8, 0x00, 0x02, 0x00, 0x01,
+    0x2e, 0xd0, 0x00, 0x02, 0x00, 0x83, 0xd8, 0x61, 0xc0, 0x08, 0xba, 0x3c, 0xff, 0xbf, 0xbe, 0x00,
+    0x0c, 0x07, 0x00, 0x00, 0xce, 0x00, 0x41, 0x30, 0xbc, 0x40, 0x70, 0xcc, 0x00, 0x0f, 0xd2, 0x00,
+    0x01, 0x07, 0xce, 0x00, 0xf3, 0x0d, 0x21, 0x90, 0x82, 0x80, 0x00, 0x48, 0x00, 0x30, 0x20, 0x50,
+    0x82, 0x90, 0x00, 0x98, 0x41, 0x98, 0x20, 0x78, 0x00, 0x30, 0x00, 0x38, 0x82, 0x88, 0x20, 0xa0,
+    0x00, 0xa8, 0x02, 0x00, 0xf0, 0x06, 0xb0, 0x21, 0x98, 0x61, 0x68, 0x00, 0x38, 0x00, 0x60, 0x61,
+    0x98, 0x41, 0xa8, 0x61, 0x90, 0x00, 0x28, 0x00, 0x38, 0x82, 0xa0, 0xc2, 0x00, 0x01, 0x04, 0x00,
+    0x02, 0xc2, 0x00, 0x0c, 0x06, 0x00, 0x0f, 0xca, 0x00, 0x01, 0x04, 0x14, 0x00, 0x0a, 0xd0, 0x00,
+    0xa6, 0xd8, 0x00, 0xd0, 0x61, 0xb8, 0x4d, 0xd3, 0x5d, 0xff, 0xdf, 0xc7, 0x00, 0x50, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe3, 0x00, 0x15, 0xff, 0x01, 0x00, 0xa7, 0xdf, 0xff, 0x95, 0xe5, 0x61, 0x70,
+    0x00, 0x80, 0x00, 0x88, 0x02, 0x00, 0x24, 0x90, 0x00, 0x02, 0x00, 0x11, 0x98, 0x0a, 0x00, 0xf4,
+    0x12, 0x98, 0x00, 0x98, 0x00, 0x98, 0x41, 0x88, 0x00, 0x40, 0x00, 0x28, 0x00, 0x50, 0x81, 0x88,
+    0x00, 0x98, 0x20, 0x90, 0xa2, 0x80, 0x00, 0x40, 0x00, 0x30, 0x41, 0x68, 0x20, 0x90, 0x00, 0xa0,
+    0x00, 0xa8, 0x02, 0x00, 0xf9, 0x09, 0x61, 0x98, 0x00, 0x48, 0x00, 0x28, 0x00, 0x78, 0x41, 0xa0,
+    0x41, 0x98, 0x00, 0x78, 0x00, 0x30, 0x00, 0x50, 0x61, 0xa0, 0x00, 0xb0, 0x00, 0xb8, 0x02, 0x00,
+    0x2e, 0xc0, 0x00, 0x02, 0x00, 0x2f, 0xc8, 0x00, 0x02, 0x00, 0x01, 0x28, 0xd0, 0x00, 0x02, 0x00,
+    0xa5, 0xd8, 0x00, 0xd0, 0x62, 0xb8, 0xb3, 0xec, 0xbe, 0xff, 0xdf, 0xbe, 0x00, 0x0c, 0x09, 0x00,
+    0x8b, 0xdf, 0xff, 0x9a, 0xfe, 0x82, 0x70, 0x20, 0x80, 0xd0, 0x00, 0x11, 0x88, 0xc6, 0x00, 0x07,
+    0xd4, 0x00, 0xf0, 0x03, 0x61, 0x88, 0x20, 0x68, 0x00, 0x28, 0x00, 0x30, 0x61, 0x80, 0x20, 0x90,
+    0x00, 0x98, 0x82, 0x90, 0x00, 0x48, 0xac, 0x00, 0x48, 0x82, 0x88, 0x20, 0x98, 0xce, 0x00, 0xf4,
+    0x05, 0x82, 0x98, 0x00, 0x30, 0x00, 0x28, 0x62, 0x90, 0x20, 0xa0, 0x82, 0x98, 0x00, 0x60, 0x00,
+    0x38, 0x61, 0x68, 0x40, 0xa0, 0xca, 0x00, 0x13, 0x20, 0xd4, 0x00, 0x4d, 0x20, 0xc0, 0x00, 0xb8,
+    0xd0, 0x00, 0x3f, 0xc8, 0x00, 0xc0, 0xd0, 0x00, 0x10, 0x68, 0xd0, 0x62, 0xb0, 0xd7, 0xfd, 0xdf,
+    0xce, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x17, 0xff, 0x01, 0x00, 0xa9, 0x7d,
+    0xff, 0x86, 0x89, 0x20, 0x78, 0x00, 0x80, 0x00, 0x88, 0x02, 0x00, 0x26, 0x90, 0x00, 0x02, 0x00,
+    0xf2, 0x03, 0x98, 0x21, 0x88, 0x82, 0x68, 0x00, 0x30, 0x00, 0x38, 0xa2, 0x78, 0x20, 0x88, 0x20,
+    0x90, 0x62, 0x88, 0x00, 0x0e, 0x00, 0x51, 0x90, 0x20, 0x98, 0x00, 0xa0, 0x02, 0x00, 0xf1, 0x12,
+    0xa8, 0x00, 0xa8, 0x00, 0xa0, 0x41, 0xa0, 0x00, 0x80, 0x00, 0x30, 0x00, 0x48, 0x82, 0xa0, 0x00,
+    0xa0, 0xa2, 0x90, 0x00, 0x50, 0x00, 0x48, 0x81, 0x80, 0x20, 0xa0, 0x00, 0xb0, 0x00, 0xb0, 0x00,
+    0xb8, 0x04, 0x00, 0x22, 0xb8, 0x00, 0x02, 0x00, 0x2c, 0xc0, 0x00, 0x02, 0x00, 0x11, 0xc8, 0x12,
+    0x00, 0x2f, 0xc8, 0x00, 0x02, 0x00, 0x01, 0x22, 0xd0, 0x00, 0x02, 0x00, 0x67, 0xc8, 0x20, 0xc8,
+    0x04, 0xb1, 0x1c, 0xba, 0x00, 0x0f, 0x0b, 0x00, 0x01, 0x8b, 0xbf, 0xff, 0x6d, 0xbb, 0x20, 0x68,
+    0x20, 0x80, 0xd0, 0x00, 0x06, 0xcc, 0x00, 0x40, 0x90, 0x00, 0x88, 0x62, 0xa6, 0x00, 0xf1, 0x04,
+    0x28, 0x00, 0x68, 0x41, 0x88, 0x00, 0x90, 0x20, 0x88, 0x62, 0x70, 0x00, 0x38, 0x00, 0x30, 0x81,
+    0x68, 0x20, 0x90, 0xca, 0x00, 0x02, 0xd0, 0x00, 0xf1, 0x0a, 0xa0, 0x20, 0xa0, 0x82, 0x90, 0x00,
+    0x58, 0x00, 0x38, 0x82, 0x70, 0x41, 0xa0, 0x20, 0xa0, 0xa2, 0x78, 0x00, 0x40, 0x00, 0x50, 0xa2,
+    0x98, 0x20, 0xa8, 0xce, 0x00, 0x00, 0xd0, 0x00, 0x02, 0xca, 0x00, 0x00, 0x06, 0x00, 0x11, 0xc0,
+    0xd6, 0x00, 0x0c, 0xd2, 0x00, 0x1f, 0xc0, 0xcc, 0x00, 0x02, 0x00, 0xe0, 0x00, 0x01, 0xce, 0x00,
+    0x7a, 0x20, 0xc8, 0x41, 0xb0, 0xec, 0xda, 0x9e, 0xc3, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe4, 0x00, 0x17, 0xff, 0x01, 0x00, 0xcf, 0xdf, 0xff, 0xba, 0xfe, 0x41, 0x60, 0x20, 0x78, 0x00,
+    0x80, 0x00, 0x88, 0x02, 0x00, 0x00, 0xf6, 0x10, 0x90, 0x00, 0x88, 0x62, 0x80, 0x00, 0x58, 0x00,
+    0x28, 0x00, 0x38, 0x62, 0x80, 0x00, 0x90, 0x00, 0x90, 0x82, 0x88, 0x00, 0x38, 0x00, 0x28, 0x00,
+    0x58, 0x61, 0x90, 0x00, 0x98, 0x00, 0xa0, 0x02, 0x00, 0xf0, 0x08, 0x41, 0x98, 0x81, 0x70, 0x00,
+    0x38, 0x00, 0x50, 0x82, 0x88, 0x20, 0xa0, 0x61, 0x98, 0x40, 0x58, 0x00, 0x30, 0x00, 0x78, 0x61,
+    0xa8, 0x00, 0x02, 0x00, 0x20, 0xb0, 0x00, 0x02, 0x00, 0x5b, 0xb8, 0x00, 0xb0, 0x00, 0xb8, 0x02,
+    0x00, 0x2f, 0xc0, 0x00, 0x02, 0x00, 0x01, 0x2f, 0xc8, 0x00, 0x02, 0x00, 0x00, 0x77, 0x20, 0xb8,
+    0x82, 0xa0, 0xf7, 0xfd, 0xbe, 0xba, 0x00, 0x0f, 0x0b, 0x00, 0x01, 0xaf, 0xdf, 0xff, 0xbe, 0xff,
+    0xe7, 0x81, 0x00, 0x70, 0x00, 0x80, 0xd0, 0x00, 0x03, 0xf3, 0x0b, 0x41, 0x80, 0x41, 0x60, 0x00,
+    0x30, 0x00, 0x38, 0xa2, 0x70, 0x20, 0x88, 0x20, 0x90, 0x41, 0x88, 0x00, 0x60, 0x00, 0x28, 0x00,
+    0x30, 0xa2, 0x88, 0x00, 0x98, 0x02, 0x00, 0x03, 0xd2, 0x00, 0xf6, 0x06, 0x41, 0x90, 0x20, 0x50,
+    0x00, 0x30, 0x00, 0x68, 0x41, 0x98, 0x00, 0xa0, 0x82, 0x98, 0x00, 0x38, 0x00, 0x30, 0x61, 0x90,
+    0x20, 0xcc, 0x00, 0x00, 0xd0, 0x00, 0x02, 0x04, 0x00, 0x0a, 0xd2, 0x00, 0x0e, 0xce, 0x00, 0x3f,
+    0xc8, 0x00, 0xc0, 0xce, 0x00, 0x01, 0x7a, 0x61, 0xb8, 0xc7, 0xa9, 0x5d, 0xff, 0xdf, 0xc3, 0x00,
+    0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x17, 0xff, 0x01, 0x00, 0xa3, 0xdf, 0xff, 0xbe,
+    0xff, 0xf3, 0xd4, 0x41, 0x68, 0x00, 0x80, 0x02, 0x00, 0x29, 0x88, 0x00, 0x02, 0x00, 0xf3, 0x0f,
+    0x62, 0x78, 0x00, 0x28, 0x00, 0x28, 0x41, 0x68, 0x20, 0x80, 0x00, 0x90, 0x20, 0x80, 0x82, 0x68,
+    0x00, 0x30, 0x00, 0x38, 0x82, 0x70, 0x20, 0x88, 0x00, 0x98, 0x00, 0x98, 0x00, 0xa0, 0x06, 0x00,
+    0xfd, 0x0c, 0xa0, 0x00, 0xa0, 0x82, 0x90, 0x00, 0x30, 0x00, 0x28, 0x61, 0x88, 0x00, 0x98, 0x20,
+    0xa0, 0x41, 0x80, 0x00, 0x30, 0x00, 0x40, 0x62, 0x98, 0x00, 0xa8, 0x00, 0xb0, 0x02, 0x00, 0x2c,
+    0xb8, 0x00, 0x02, 0x00, 0x2c, 0xc0, 0x00, 0x02, 0x00, 0x2d, 0xc8, 0x00, 0x02, 0x00, 0x77, 0x61,
+    0xb0, 0x30, 0xdc, 0x9e, 0xff, 0xdf, 0xba, 0x00, 0x0f, 0x0b, 0x00, 0x05, 0x8d, 0xdb, 0xfe, 0xc3,
+    0x70, 0x00, 0x78, 0x00, 0x78, 0xd0, 0x00, 0xa0, 0x80, 0x41, 0x78, 0x00, 0x50, 0x00, 0x28, 0x00,
+    0x38, 0x41, 0xcc, 0x00, 0x90, 0x88, 0x61, 0x78, 0x00, 0x40, 0x00, 0x28, 0x00, 0x58, 0x0e, 0x00,
+    0x01, 0xc8, 0x00, 0x05, 0xd2, 0x00, 0xf0, 0x06, 0x40, 0x90, 0x20, 0x70, 0x00, 0x28, 0x00, 0x40,
+    0x81, 0x90, 0x20, 0xa0, 0x41, 0x90, 0x00, 0x60, 0x00, 0x38, 0x41, 0x60, 0x41, 0xce, 0x00, 0x11,
+    0xa8, 0xd2, 0x00, 0x08, 0xd6, 0x00, 0x11, 0xb8, 0xe0, 0x00, 0x0a, 0xd2, 0x00, 0x0c, 0xce, 0x00,
+    0x1c, 0xc0, 0xce, 0x00, 0x6d, 0x20, 0xc0, 0xa3, 0xa8, 0x18, 0xfe, 0xcc, 0x00, 0x50, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xed, 0x00, 0x17, 0xff, 0x01, 0x00, 0xe5, 0xdf, 0xff, 0xff, 0xff, 0xbe, 0xff,
+    0xcb, 0xa2, 0x21, 0x68, 0x00, 0x78, 0x00, 0x80, 0x02, 0x00, 0xf3, 0x16, 0x88, 0x00, 0x80, 0x00,
+    0x88, 0x21, 0x80, 0x62, 0x58, 0x00, 0x30, 0x00, 0x38, 0x61, 0x70, 0x20, 0x80, 0x00, 0x88, 0x41,
+    0x80, 0x20, 0x68, 0x00, 0x28, 0x00, 0x38, 0x62, 0x80, 0x20, 0x90, 0x20, 0x90, 0x00, 0x90, 0x00,
+    0x98, 0x02, 0x00, 0xf7, 0x0c, 0xa0, 0x20, 0x90, 0xa2, 0x80, 0x00, 0x40, 0x00, 0x38, 0x82, 0x78,
+    0x40, 0x90, 0x20, 0x98, 0x82, 0x88, 0x00, 0x48, 0x00, 0x40, 0x82, 0x78, 0x40, 0x98, 0x00, 0xa8,
+    0x02, 0x00, 0x2a, 0xb0, 0x00, 0x02, 0x00, 0x2c, 0xb8, 0x00, 0x02, 0x00, 0x2c, 0xc0, 0x00, 0x02,
+    0x00, 0x22, 0xc8, 0x00, 0x02, 0x00, 0x70, 0xc0, 0x41, 0xb0, 0x29, 0xba, 0x7e, 0xff, 0xac, 0x00,
+    0x07, 0xbb, 0x00, 0x0f, 0x0b, 0x00, 0x04, 0xa9, 0xdf, 0xff, 0x7a, 0xfe, 0x41, 0x58, 0x20, 0x70,
+    0x00, 0x78, 0xd2, 0x00, 0xf0, 0x0b, 0x80, 0x61, 0x78, 0x00, 0x28, 0x00, 0x28, 0x20, 0x68, 0x41,
+    0x80, 0x00, 0x88, 0x20, 0x80, 0x82, 0x78, 0x00, 0x38, 0x00, 0x30, 0xa2, 0x68, 0x21, 0x80, 0x00,
+    0xcc, 0x00, 0x00, 0x04, 0x00, 0x03, 0xd0, 0x00, 0xf7, 0x0b, 0x41, 0x88, 0x00, 0x50, 0x00, 0x30,
+    0x00, 0x58, 0x61, 0x88, 0x20, 0x98, 0x21, 0x90, 0x62, 0x68, 0x00, 0x38, 0x00, 0x48, 0x81, 0x88,
+    0x20, 0x98, 0x00, 0xa0, 0xce, 0x00, 0x1b, 0xa8, 0xce, 0x00, 0x1f, 0xb0, 0xce, 0x00, 0x10, 0x03,
+    0xde, 0x00, 0x7e, 0x20, 0xb8, 0x82, 0x98, 0xf7, 0xfd, 0xbe, 0xbe, 0x00, 0x50, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xdc, 0x00, 0x1b, 0xff, 0x01, 0x00, 0xa1, 0xdf, 0xff, 0xbe, 0xff, 0x2c, 0x9b, 0x20,
+    0x68, 0x00, 0x78, 0x02, 0x00, 0x21, 0x80, 0x00, 0x02, 0x00, 0xfa, 0x0d, 0x20, 0x70, 0x00, 0x58,
+    0x00, 0x28, 0x00, 0x38, 0x82, 0x78, 0x00, 0x80, 0x00, 0x88, 0x40, 0x78, 0x20, 0x48, 0x00, 0x28,
+    0x00, 0x48, 0x61, 0x78, 0x00, 0x88, 0x00, 0x90, 0x02, 0x00, 0xe1, 0x81, 0x80, 0x00, 0x28, 0x00,
+    0x28, 0x61, 0x78, 0x00, 0x90, 0x00, 0xa0, 0x61, 0x90, 0x28, 0x00, 0x51, 0x68, 0x41, 0x98, 0x00,
+    0xa0, 0x02, 0x00, 0x2a, 0xa8, 0x00, 0x02, 0x00, 0x28, 0xb0, 0x00, 0x02, 0x00, 0x2a, 0xb8, 0x00,
+    0x02, 0x00, 0x2f, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x7b, 0x61, 0xb0, 0xeb, 0xc2, 0x7e, 0xff, 0xbf,
+    0xb6, 0x00, 0x0f, 0x0f, 0x00, 0x07, 0x81, 0xdf, 0xff, 0xfb, 0xfe, 0xa2, 0x68, 0x20, 0x70, 0xce,
+    0x00, 0x00, 0xbe, 0x00, 0xc0, 0x80, 0x00, 0x78, 0x82, 0x68, 0x00, 0x38, 0x00, 0x30, 0x61, 0x58,
+    0x20, 0xc0, 0x00, 0xd9, 0x80, 0x61, 0x78, 0x00, 0x28, 0x00, 0x20, 0x41, 0x70, 0x00, 0x80, 0x20,
+    0x88, 0xd0, 0x00, 0x31, 0x88, 0x81, 0x80, 0xf6, 0x00, 0x90, 0x40, 0x61, 0x88, 0x20, 0x98, 0x00,
+    0x98, 0x82, 0x88, 0xda, 0x00, 0x34, 0x82, 0x88, 0x00, 0xce, 0x00, 0x1b, 0xa0, 0xce, 0x00, 0x00,
+    0xdc, 0x00, 0x08, 0xd0, 0x00, 0x00, 0x0c, 0x00, 0x06, 0xd2, 0x00, 0x0f, 0xcc, 0x00, 0x00, 0x7f,
+    0x20, 0xb8, 0xa2, 0xa0, 0x38, 0xfe, 0xbe, 0xbd, 0x00, 0x01, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe4, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x00, 0xf1, 0x0a, 0xbe, 0xff, 0x6d, 0xab, 0x41, 0x60, 0x20,
+    0x70, 0x00, 0x78, 0x00, 0x78, 0x00, 0x80, 0x00, 0x80, 0x61, 0x78, 0x20, 0x40, 0x00, 0x28, 0x00,
+    0x48, 0x61, 0x0e, 0x00, 0xc5, 0x41, 0x78, 0x00, 0x58, 0x00, 0x28, 0x00, 0x40, 0x61, 0x78, 0x00,
+    0x88, 0x02, 0x00, 0xf7, 0x10, 0x90, 0x00, 0x90, 0x00, 0x90, 0x41, 0x88, 0x61, 0x60, 0x00, 0x30,
+    0x00, 0x38, 0xa2, 0x78, 0x20, 0x90, 0x20, 0x98, 0x41, 0x88, 0x00, 0x68, 0x00, 0x30, 0x00, 0x48,
+    0x61, 0x90, 0x00, 0xa0, 0x02, 0x00, 0x2c, 0xa8, 0x00, 0x02, 0x00, 0x28, 0xb0, 0x00, 0x02, 0x00,
+    0x2c, 0xb8, 0x00, 0x02, 0x00, 0x23, 0xc0, 0x00, 0x02, 0x00, 0x7f, 0x20, 0xb8, 0x61, 0xa8, 0xcb,
+    0xca, 0x9e, 0xb2, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x09, 0x91, 0xdf, 0xff, 0x3c, 0xff, 0xe3, 0x60,
+    0x20, 0x60, 0x00, 0xd0, 0x00, 0x90, 0x20, 0x78, 0x41, 0x68, 0x00, 0x20, 0x00, 0x28, 0x61, 0x0e,
+    0x00, 0x40, 0x80, 0x20, 0x78, 0x62, 0xa4, 0x00, 0x55, 0x30, 0x82, 0x68, 0x20, 0x80, 0xcc, 0x00,
+    0x10, 0x88, 0xcc, 0x00, 0xb0, 0x00, 0x90, 0x41, 0x78, 0x00, 0x38, 0x00, 0x28, 0x40, 0x68, 0x20,
+    0x10, 0x00, 0xaa, 0x88, 0x82, 0x80, 0x00, 0x40, 0x00, 0x38, 0xa2, 0x70, 0x20, 0xce, 0x00, 0x00,
+    0xda, 0x00, 0x0a, 0xd0, 0x00, 0x08, 0xcc, 0x00, 0x02, 0x0c, 0x00, 0x0a, 0xd0, 0x00, 0x31, 0xc0,
+    0x00, 0xb8, 0xd0, 0x00, 0x8f, 0xb8, 0x41, 0xb0, 0xe3, 0x98, 0xdb, 0xfe, 0xbe, 0xbb, 0x00, 0x03,
+    0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x02, 0xf6, 0x19, 0xde,
+    0xff, 0x96, 0xdd, 0x41, 0x60, 0x20, 0x70, 0x00, 0x78, 0x20, 0x70, 0x40, 0x68, 0x00, 0x48, 0x00,
+    0x20, 0x20, 0x40, 0x41, 0x70, 0x00, 0x80, 0x00, 0x80, 0x41, 0x70, 0x00, 0x40, 0x00, 0x28, 0x00,
+    0x50, 0x41, 0x78, 0x00, 0x80, 0x00, 0x88, 0x02, 0x00, 0xf1, 0x09, 0x20, 0x88, 0x20, 0x80, 0x00,
+    0x60, 0x00, 0x28, 0x00, 0x38, 0x61, 0x80, 0x00, 0x90, 0x00, 0x90, 0x21, 0x88, 0x61, 0x60, 0x00,
+    0x30, 0x00, 0x50, 0x0e, 0x00, 0x3d, 0x98, 0x00, 0xa0, 0x02, 0x00, 0x2a, 0xa8, 0x00, 0x02, 0x00,
+    0x28, 0xb0, 0x00, 0x02, 0x00, 0x26, 0xb8, 0x00, 0x02, 0x00, 0x20, 0xc0, 0x00, 0x02, 0x00, 0xaf,
+    0xb8, 0x20, 0xb8, 0x61, 0xa0, 0xf3, 0xec, 0xbe, 0xff, 0xdf, 0xb2, 0x00, 0x02, 0x0f, 0x15, 0x00,
+    0x0b, 0xb0, 0xbe, 0xff, 0x2d, 0xa3, 0x21, 0x60, 0x00, 0x70, 0x00, 0x70, 0x81, 0x96, 0x00, 0x30,
+    0x30, 0x41, 0x58, 0xdc, 0x00, 0xb0, 0x00, 0x78, 0x41, 0x70, 0x00, 0x28, 0x00, 0x20, 0x41, 0x68,
+    0x00, 0xce, 0x00, 0x07, 0xd0, 0x00, 0xb1, 0x21, 0x80, 0x82, 0x70, 0x00, 0x38, 0x00, 0x30, 0x81,
+    0x68, 0x20, 0xce, 0x00, 0xc3, 0x82, 0x88, 0x00, 0x38, 0x00, 0x28, 0x00, 0x68, 0x21, 0x90, 0x00,
+    0x98, 0x02, 0x00, 0x0c, 0xd2, 0x00, 0x0a, 0xce, 0x00, 0x19, 0xa8, 0xce, 0x00, 0x00, 0xda, 0x00,
+    0x08, 0xd0, 0x00, 0x8f, 0xb8, 0x20, 0xb8, 0x41, 0xa0, 0x8a, 0xc2, 0x7d, 0xcc, 0x00, 0x07, 0x50,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x00, 0xf5, 0x1b, 0xdf, 0xff,
+    0xff, 0xff, 0xdf, 0xff, 0x3d, 0xff, 0xc3, 0x58, 0x21, 0x70, 0x21, 0x68, 0x20, 0x40, 0x00, 0x20,
+    0x00, 0x48, 0x41, 0x70, 0x00, 0x78, 0x00, 0x78, 0x20, 0x70, 0x20, 0x58, 0x00, 0x20, 0x00, 0x30,
+    0x41, 0x70, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x02, 0x00, 0xa0, 0x80, 0x61, 0x78, 0x00, 0x28,
+    0x00, 0x20, 0x20, 0x60, 0x41, 0x16, 0x00, 0xf9, 0x00, 0x90, 0x20, 0x88, 0x41, 0x70, 0x00, 0x28,
+    0x00, 0x30, 0x82, 0x88, 0x00, 0x90, 0x00, 0x98, 0x02, 0x00, 0x26, 0xa0, 0x00, 0x02, 0x00, 0x2c,
+    0xa8, 0x00, 0x02, 0x00, 0x2c, 0xb0, 0x00, 0x02, 0x00, 0x21, 0xb8, 0x00, 0x02, 0x00, 0x7f, 0x40,
+    0xa8, 0xe3, 0x88, 0xdb, 0xfe, 0xbf, 0xae, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x13, 0xf2, 0x0e, 0xdf,
+    0xff, 0x18, 0xee, 0x62, 0x58, 0x82, 0x60, 0x00, 0x20, 0x00, 0x20, 0x41, 0x68, 0x20, 0x78, 0x00,
+    0x78, 0x00, 0x70, 0x82, 0x68, 0x00, 0x40, 0x00, 0x28, 0x41, 0x50, 0x20, 0xce, 0x00, 0x04, 0xd2,
+    0x00, 0x50, 0x80, 0x41, 0x78, 0x00, 0x50, 0xe6, 0x00, 0x11, 0x82, 0xcc, 0x00, 0xc9, 0x00, 0x88,
+    0x82, 0x78, 0x00, 0x40, 0x00, 0x30, 0x61, 0x60, 0x20, 0x88, 0xca, 0x00, 0x02, 0xd8, 0x00, 0x06,
+    0xce, 0x00, 0x00, 0x0a, 0x00, 0x0f, 0xd0, 0x00, 0x0d, 0x00, 0xcc, 0x00, 0x90, 0xb0, 0x20, 0xb0,
+    0x82, 0x98, 0xb7, 0xfd, 0xbe, 0xff, 0x68, 0x01, 0x0f, 0xbe, 0x00, 0x04, 0x50, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc7, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x08, 0xf5, 0x0f, 0xdf, 0xff, 0xf7, 0xe5, 0x20,
+    0x30, 0x00, 0x18, 0x00, 0x38, 0x41, 0x68, 0x00, 0x78, 0x00, 0x78, 0x21, 0x70, 0x41, 0x50, 0x00,
+    0x28, 0x00, 0x40, 0x61, 0x70, 0x00, 0x78, 0x00, 0x80, 0x02, 0x00, 0xa0, 0x88, 0x21, 0x78, 0x62,
+    0x60, 0x00, 0x30, 0x00, 0x30, 0x82, 0x26, 0x00, 0x60, 0x88, 0x00, 0x90, 0x21, 0x80, 0x21, 0x28,
+    0x00, 0xbd, 0x48, 0x81, 0x80, 0x20, 0x88, 0x00, 0x90, 0x00, 0x90, 0x00, 0x98, 0x02, 0x00, 0x26,
+    0xa0, 0x00, 0x02, 0x00, 0x2e, 0xa8, 0x00, 0x02, 0x00, 0x24, 0xb0, 0x00, 0x02, 0x00, 0xcf, 0xb8,
+    0x00, 0xb0, 0x20, 0xa8, 0x62, 0x90, 0xd3, 0xf4, 0x9e, 0xff, 0xdf, 0xac, 0x00, 0x08, 0x0f, 0x1b,
+    0x00, 0x11, 0x90, 0xbe, 0xff, 0x03, 0x39, 0x00, 0x18, 0x61, 0x48, 0x20, 0xa8, 0x00, 0xa2, 0x78,
+    0x41, 0x68, 0x00, 0x30, 0x00, 0x20, 0x00, 0x58, 0x20, 0xce, 0x00, 0x05, 0xd2, 0x00, 0x90, 0x61,
+    0x70, 0x00, 0x30, 0x00, 0x28, 0x00, 0x60, 0x41, 0xe2, 0x00, 0x50, 0x88, 0x00, 0x80, 0x82, 0x78,
+    0x10, 0x00, 0x52, 0x20, 0x68, 0x00, 0x80, 0x00, 0xce, 0x00, 0x0e, 0xd0, 0x00, 0x06, 0xcc, 0x00,
+    0x04, 0x0a, 0x00, 0x0a, 0xd2, 0x00, 0x04, 0xcc, 0x00, 0x10, 0xb0, 0xcc, 0x00, 0x4f, 0x41, 0x90,
+    0x2c, 0xc3, 0xcc, 0x00, 0x0e, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x00, 0x1f, 0xff, 0x01,
+    0x00, 0x0a, 0xf5, 0x09, 0x58, 0xce, 0x00, 0x08, 0x00, 0x20, 0x82, 0x50, 0x20, 0x68, 0x00, 0x70,
+    0x00, 0x70, 0x41, 0x60, 0x00, 0x20, 0x00, 0x20, 0x41, 0x68, 0x00, 0x78, 0x02, 0x00, 0xf0, 0x00,
+    0x80, 0x00, 0x78, 0x61, 0x70, 0x00, 0x40, 0x00, 0x28, 0x00, 0x40, 0x41, 0x70, 0x00, 0x80, 0x02,
+    0x00, 0x40, 0x62, 0x78, 0x00, 0x50, 0x10, 0x00, 0x85, 0x61, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00,
+    0x90, 0x02, 0x00, 0x2a, 0x98, 0x00, 0x02, 0x00, 0x2a, 0xa0, 0x00, 0x02, 0x00, 0x2e, 0xa8, 0x00,
+    0x02, 0x00, 0xaf, 0xb0, 0x20, 0xa8, 0x61, 0x90, 0x0c, 0xc3, 0x5d, 0xff, 0xdf, 0xa8, 0x00, 0x0a,
+    0x0f, 0x1d, 0x00, 0x0d, 0x02, 0x3e, 0x00, 0xf9, 0x05, 0x8e, 0x73, 0x00, 0x00, 0x75, 0xc5, 0x2c,
+    0x9b, 0x20, 0x58, 0x21, 0x68, 0x00, 0x68, 0x00, 0x50, 0x00, 0x18, 0x00, 0x28, 0xce, 0x00, 0x40,
+    0x78, 0x41, 0x70, 0x41, 0xbc, 0x00, 0xf0, 0x05, 0x30, 0x61, 0x60, 0x20, 0x78, 0x00, 0x80, 0x00,
+    0x88, 0x41, 0x78, 0x41, 0x60, 0x00, 0x30, 0x00, 0x30, 0xa2, 0x70, 0x21, 0xce, 0x00, 0x06, 0xcc,
+    0x00, 0x00, 0x0a, 0x00, 0x0a, 0xce, 0x00, 0x1b, 0x98, 0xce, 0x00, 0x19, 0xa0, 0xce, 0x00, 0x10,
+    0xb0, 0x0e, 0x00, 0x7f, 0x20, 0xa0, 0x41, 0x90, 0x49, 0xaa, 0x1c, 0xcc, 0x00, 0x11, 0x50, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x0a, 0xf4, 0x09, 0x41, 0x08, 0x82,
+    0x10, 0xde, 0xff, 0x9d, 0xff, 0x8d, 0xab, 0x41, 0x50, 0x82, 0x60, 0x00, 0x40, 0x00, 0x28, 0x41,
+    0x48, 0x20, 0x68, 0x00, 0x78, 0x02, 0x00, 0xb0, 0x41, 0x70, 0x41, 0x58, 0x00, 0x20, 0x00, 0x20,
+    0x61, 0x68, 0x20, 0x14, 0x00, 0xf3, 0x04, 0x80, 0x00, 0x80, 0x61, 0x70, 0x00, 0x28, 0x00, 0x20,
+    0x20, 0x60, 0x21, 0x80, 0x00, 0x88, 0x00, 0x90, 0x00, 0x90, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x02,
+    0x04, 0x00, 0x2a, 0x98, 0x00, 0x02, 0x00, 0x2c, 0xa0, 0x00, 0x02, 0x00, 0x23, 0xa8, 0x00, 0x02,
+    0x00, 0xbf, 0x21, 0xa0, 0x61, 0x88, 0xeb, 0xba, 0x3c, 0xff, 0xde, 0xff, 0xdf, 0xa6, 0x00, 0x0a,
+    0x0f, 0x1d, 0x00, 0x13, 0xf4, 0x09, 0x34, 0xa5, 0x00, 0x00, 0xcf, 0x7b, 0xff, 0xff, 0xdf, 0xff,
+    0xbe, 0xff, 0xae, 0xa3, 0xc3, 0x48, 0x00, 0x28, 0x00, 0x30, 0x61, 0x60, 0x00, 0x70, 0xcc, 0x00,
+    0xf3, 0x0f, 0x20, 0x70, 0x61, 0x68, 0x00, 0x38, 0x00, 0x20, 0x21, 0x48, 0x20, 0x70, 0x00, 0x80,
+    0x00, 0x80, 0x20, 0x78, 0x61, 0x78, 0x00, 0x50, 0x00, 0x20, 0x00, 0x30, 0x41, 0x70, 0x00, 0x88,
+    0x02, 0x00, 0x0e, 0xd0, 0x00, 0x1f, 0x90, 0xd0, 0x00, 0x0c, 0x02, 0xcc, 0x00, 0x81, 0xa0, 0x21,
+    0x98, 0x62, 0x88, 0xeb, 0xba, 0x7d, 0xca, 0x00, 0x0f, 0xce, 0x00, 0x10, 0x50, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb1, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x08, 0x60, 0x24, 0x21, 0x41, 0x08, 0xba, 0xde,
+    0x21, 0x00, 0xd4, 0xdf, 0xff, 0xdf, 0xff, 0xae, 0x83, 0x00, 0x18, 0x00, 0x48, 0x21, 0x70, 0x00,
+    0x02, 0x00, 0xf0, 0x0c, 0x78, 0x20, 0x70, 0x00, 0x48, 0x00, 0x30, 0x00, 0x48, 0x41, 0x70, 0x00,
+    0x78, 0x00, 0x78, 0x00, 0x80, 0x20, 0x70, 0x41, 0x50, 0x00, 0x20, 0x00, 0x30, 0x82, 0x68, 0x0e,
+    0x00, 0x29, 0x00, 0x88, 0x02, 0x00, 0x2a, 0x90, 0x00, 0x02, 0x00, 0x2a, 0x98, 0x00, 0x02, 0x00,
+    0x28, 0xa0, 0x00, 0x02, 0x00, 0x90, 0xa8, 0x41, 0x98, 0x61, 0x78, 0xb2, 0xe4, 0x9e, 0xff, 0x7a,
+    0x00, 0x00, 0x82, 0x00, 0x0f, 0x04, 0x00, 0x2d, 0x84, 0xfb, 0xde, 0x41, 0x08, 0x45, 0x29, 0x9e,
+    0xf7, 0x48, 0x00, 0xa5, 0x86, 0x31, 0x00, 0x10, 0xc3, 0x58, 0x41, 0x60, 0x20, 0x68, 0xd0, 0x00,
+    0x31, 0x70, 0x61, 0x60, 0xcc, 0x00, 0x02, 0xce, 0x00, 0xd3, 0x78, 0x41, 0x68, 0x00, 0x28, 0x00,
+    0x20, 0x40, 0x60, 0x41, 0x78, 0x00, 0x80, 0x02, 0x00, 0x0f, 0xd2, 0x00, 0x22, 0xb4, 0x20, 0x98,
+    0x41, 0x90, 0x82, 0x80, 0x75, 0xf5, 0xbe, 0xff, 0xdf, 0x7d, 0x00, 0x0f, 0x08, 0x00, 0x0f, 0x50,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x1d, 0xff, 0x01, 0x00, 0x13, 0xdf, 0x12, 0x00, 0x63,
+    0xf3, 0x9c, 0x00, 0x00, 0x0c, 0x63, 0x0d, 0x00, 0xf0, 0x06, 0xff, 0xfb, 0xde, 0x00, 0x00, 0xc6,
+    0x41, 0x5d, 0xff, 0xcb, 0x92, 0x20, 0x50, 0x00, 0x60, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x06,
+    0x00, 0x12, 0x40, 0x0a, 0x00, 0xc0, 0x78, 0x00, 0x70, 0x61, 0x68, 0x00, 0x40, 0x00, 0x28, 0x00,
+    0x40, 0x41, 0x1a, 0x00, 0x20, 0x80, 0x00, 0x02, 0x00, 0x59, 0x88, 0x00, 0x80, 0x00, 0x88, 0x02,
+    0x00, 0x2c, 0x90, 0x00, 0x02, 0x00, 0x28, 0x98, 0x00, 0x02, 0x00, 0xd4, 0xa0, 0x00, 0x98, 0x20,
+    0x90, 0x41, 0x80, 0x8a, 0xa2, 0xba, 0xfe, 0xbe, 0xff, 0x8a, 0x00, 0x04, 0x84, 0x00, 0x0f, 0x08,
+    0x00, 0x29, 0x73, 0xca, 0x52, 0x00, 0x00, 0xf7, 0xbd, 0xff, 0x54, 0x00, 0xf0, 0x05, 0xd2, 0x94,
+    0x00, 0x00, 0x6d, 0x73, 0xff, 0xff, 0xbe, 0xff, 0x34, 0xdd, 0xa2, 0x58, 0x21, 0x60, 0x21, 0x68,
+    0x00, 0x68, 0xce, 0x00, 0x21, 0x00, 0x78, 0xd6, 0x00, 0x31, 0x78, 0x41, 0x70, 0xcc, 0x00, 0x20,
+    0x38, 0x82, 0x16, 0x00, 0x00, 0xca, 0x00, 0x06, 0x04, 0x00, 0x0f, 0xd0, 0x00, 0x17, 0xa3, 0x90,
+    0x20, 0x90, 0x41, 0x88, 0x82, 0x78, 0x92, 0xe4, 0x7d, 0x76, 0x00, 0x0f, 0xc0, 0x00, 0x18, 0x50,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x04, 0x75, 0xdf, 0xff, 0xc3,
+    0x18, 0x61, 0x08, 0xdf, 0x1e, 0x00, 0x60, 0xeb, 0x5a, 0x00, 0x00, 0x96, 0xb5, 0x0f, 0x00, 0xf0,
+    0x10, 0xdf, 0xff, 0x5d, 0xff, 0xec, 0x92, 0x82, 0x58, 0x20, 0x60, 0x00, 0x68, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x78, 0x00, 0x70, 0x20, 0x68, 0x20, 0x58, 0x00, 0x20, 0x00, 0x28, 0x41, 0x60, 0x20,
+    0x10, 0x00, 0x2c, 0x80, 0x00, 0x02, 0x00, 0x28, 0x88, 0x00, 0x02, 0x00, 0x2c, 0x90, 0x00, 0x02,
+    0x00, 0xf6, 0x02, 0x98, 0x00, 0x98, 0x00, 0x90, 0x41, 0x80, 0xa2, 0x78, 0xaa, 0xa2, 0xda, 0xfe,
+    0xbe, 0xff, 0xdf, 0xff, 0x7a, 0x00, 0x00, 0x74, 0x00, 0x0f, 0x04, 0x00, 0x2d, 0x64, 0x9a, 0xd6,
+    0x00, 0x00, 0x0c, 0x63, 0x46, 0x00, 0x84, 0xbe, 0xf7, 0x24, 0x21, 0x00, 0x00, 0xbf, 0xf7, 0x10,
+    0x00, 0xc0, 0x9e, 0xff, 0xbb, 0xfe, 0x8a, 0x92, 0x20, 0x50, 0x20, 0x60, 0x20, 0x68, 0x02, 0x00,
+    0x90, 0x62, 0x60, 0x00, 0x30, 0x00, 0x20, 0x40, 0x48, 0x40, 0xcc, 0x00, 0x20, 0x78, 0x00, 0x02,
+    0x00, 0x0c, 0xd0, 0x00, 0x19, 0x80, 0xd0, 0x00, 0x18, 0x88, 0xd0, 0x00, 0xf4, 0x00, 0x20, 0x90,
+    0x20, 0x90, 0x21, 0x80, 0x41, 0x78, 0x28, 0xa2, 0x59, 0xfe, 0x9d, 0xff, 0xde, 0x65, 0x00, 0x0f,
+    0x08, 0x00, 0x1b, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x04,
+    0x64, 0xcf, 0x7b, 0x00, 0x00, 0xd7, 0xbd, 0x1d, 0x00, 0x64, 0xdb, 0xde, 0x00, 0x00, 0x08, 0x42,
+    0x0e, 0x00, 0x00, 0x08, 0x00, 0xf3, 0x0b, 0xde, 0xff, 0xbe, 0xff, 0xd7, 0xe5, 0x29, 0x82, 0xa2,
+    0x58, 0x21, 0x58, 0x82, 0x60, 0x00, 0x28, 0x00, 0x20, 0x00, 0x40, 0x61, 0x70, 0x00, 0x70, 0x00,
+    0x78, 0x02, 0x00, 0x2e, 0x80, 0x00, 0x02, 0x00, 0x24, 0x88, 0x00, 0x02, 0x00, 0x11, 0x90, 0x0a,
+    0x00, 0x20, 0x90, 0x00, 0x02, 0x00, 0xf1, 0x01, 0x88, 0x21, 0x80, 0x82, 0x70, 0x28, 0x92, 0x75,
+    0xe5, 0xbe, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x64, 0x00, 0x0f, 0x04, 0x00,
+    0x37, 0x60, 0x04, 0x21, 0x41, 0x08, 0x9e, 0xf7, 0x5c, 0x00, 0x00, 0x54, 0x00, 0x60, 0xbe, 0xf7,
+    0xd7, 0xbd, 0x59, 0xce, 0x0a, 0x00, 0x62, 0xff, 0xff, 0x1c, 0xe7, 0x08, 0x42, 0xe8, 0x00, 0xf0,
+    0x04, 0xdf, 0xff, 0xbe, 0xff, 0x59, 0xf6, 0x51, 0xc4, 0x20, 0x38, 0x00, 0x10, 0x00, 0x20, 0x62,
+    0x58, 0x20, 0x68, 0x20, 0xd0, 0x00, 0x06, 0xd2, 0x00, 0x02, 0xda, 0x00, 0x0a, 0xd6, 0x00, 0xf5,
+    0x09, 0x88, 0x00, 0x80, 0x00, 0x88, 0x00, 0x80, 0x20, 0x80, 0x20, 0x80, 0x40, 0x80, 0x20, 0x78,
+    0x20, 0x70, 0xe4, 0x80, 0x8e, 0xcb, 0x38, 0xfe, 0x9e, 0xc4, 0x00, 0x02, 0xd2, 0x00, 0x02, 0x6c,
+    0x00, 0x0f, 0x06, 0x00, 0x18, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x00, 0x1f, 0xff, 0x01,
+    0x00, 0x02, 0x8e, 0x5d, 0xef, 0x00, 0x00, 0xa6, 0x31, 0xbe, 0xf7, 0x1d, 0x00, 0xe0, 0x9d, 0xf7,
+    0x04, 0x21, 0x00, 0x00, 0xcb, 0x5a, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x06, 0x00, 0xf9, 0x07,
+    0x14, 0xb5, 0x00, 0x08, 0xa2, 0x28, 0x4d, 0x8b, 0x04, 0x59, 0x61, 0x58, 0x41, 0x60, 0x40, 0x68,
+    0x20, 0x70, 0x00, 0x70, 0x00, 0x78, 0x02, 0x00, 0x65, 0x80, 0x00, 0x80, 0x20, 0x80, 0x00, 0x02,
+    0x00, 0xf1, 0x04, 0x20, 0x80, 0x21, 0x78, 0x61, 0x70, 0x82, 0x68, 0xe3, 0x70, 0x69, 0x92, 0x75,
+    0xe5, 0x9e, 0xff, 0xbe, 0xff, 0xde, 0x4c, 0x00, 0x0e, 0x6e, 0x00, 0x0f, 0x12, 0x00, 0x33, 0x6f,
+    0x75, 0xad, 0x00, 0x00, 0x2c, 0x63, 0x4c, 0x00, 0x01, 0x84, 0xae, 0x73, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0x84, 0x1c, 0x00, 0xf1, 0x0b, 0x30, 0x84, 0x00, 0x00, 0x04, 0x21, 0xdb, 0xe6, 0xdf, 0xff,
+    0x1c, 0xff, 0xd7, 0xed, 0x51, 0xc4, 0xca, 0x9a, 0x45, 0x79, 0xa2, 0x68, 0x20, 0x58, 0x20, 0x60,
+    0x02, 0x00, 0x61, 0x68, 0x20, 0x68, 0x20, 0x68, 0x00, 0x06, 0x00, 0x00, 0x0a, 0x00, 0xf1, 0x00,
+    0x20, 0x68, 0x40, 0x68, 0x82, 0x70, 0x86, 0x89, 0xab, 0xaa, 0x51, 0xcc, 0xb6, 0xed, 0x1c, 0xc8,
+    0x00, 0x04, 0x4a, 0x00, 0x0f, 0x08, 0x00, 0x2c, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x00,
+    0x1f, 0xff, 0x01, 0x00, 0x02, 0x6e, 0x10, 0x84, 0x00, 0x00, 0x92, 0x94, 0x1b, 0x00, 0xa2, 0xd7,
+    0xbd, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xb6, 0xb5, 0x1c, 0x00, 0x80, 0x34, 0xa5, 0x00, 0x00,
+    0x61, 0x08, 0x99, 0xd6, 0x0e, 0x00, 0x20, 0xdf, 0xff, 0x02, 0x00, 0xf1, 0x18, 0xde, 0xff, 0xbf,
+    0xff, 0x5d, 0xff, 0x79, 0xf6, 0x55, 0xd5, 0xef, 0xb3, 0xec, 0x9a, 0x6a, 0x8a, 0x29, 0x82, 0x08,
+    0x82, 0x08, 0x82, 0x49, 0x8a, 0x6a, 0x8a, 0x0c, 0x9b, 0x30, 0xb4, 0x75, 0xdd, 0x79, 0xf6, 0x3c,
+    0xff, 0xbe, 0xff, 0xbe, 0x2c, 0x00, 0x00, 0x30, 0x00, 0x10, 0xdf, 0x3b, 0x00, 0x0f, 0x04, 0x00,
+    0x4a, 0x8c, 0xdf, 0xff, 0x8a, 0x52, 0x00, 0x00, 0xf7, 0xbd, 0x65, 0x00, 0xc0, 0x3c, 0xe7, 0x20,
+    0x00, 0x40, 0x00, 0xe3, 0x18, 0x41, 0x08, 0x59, 0xce, 0x1c, 0x00, 0x20, 0x71, 0x8c, 0xcc, 0x00,
+    0x1d, 0xd6, 0x28, 0x00, 0x00, 0x1c, 0x00, 0x00, 0xaa, 0x00, 0x20, 0xbf, 0xff, 0x02, 0x00, 0x31,
+    0xbe, 0xff, 0x9e, 0xc0, 0x00, 0x11, 0xbf, 0xc2, 0x00, 0x00, 0x1c, 0x00, 0x0f, 0x04, 0x00, 0x42,
+    0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x00, 0x8c, 0xbe, 0xf7,
+    0x86, 0x31, 0x00, 0x00, 0x7d, 0xef, 0x1b, 0x00, 0xfc, 0x07, 0xe7, 0x39, 0x00, 0x00, 0xae, 0x73,
+    0xe8, 0x39, 0x82, 0x08, 0xfc, 0xde, 0xff, 0xff, 0x2d, 0x63, 0x00, 0x00, 0x61, 0x08, 0xba, 0xd6,
+    0x26, 0x00, 0x06, 0x10, 0x00, 0x2c, 0xdf, 0xff, 0x02, 0x00, 0x06, 0x1c, 0x00, 0x0f, 0x0a, 0x00,
+    0x57, 0x6c, 0x7d, 0xef, 0xc3, 0x18, 0x61, 0x08, 0x70, 0x00, 0xfc, 0x07, 0x8e, 0x73, 0x00, 0x00,
+    0xa6, 0x31, 0xff, 0xff, 0x04, 0x21, 0xa2, 0x10, 0xfc, 0xde, 0xaa, 0x52, 0x00, 0x00, 0x24, 0x21,
+    0x18, 0xc6, 0x26, 0x00, 0x0f, 0x10, 0x00, 0x66, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0x00,
+    0x1f, 0xff, 0x01, 0x00, 0x00, 0x6a, 0xfb, 0xde, 0x00, 0x00, 0x28, 0x42, 0x19, 0x00, 0xfa, 0x07,
+    0x30, 0x84, 0x00, 0x00, 0x24, 0x21, 0x7d, 0xef, 0x5d, 0xef, 0xe3, 0x18, 0x41, 0x08, 0xe4, 0x20,
+    0x00, 0x00, 0xc7, 0x39, 0x5d, 0xef, 0x24, 0x00, 0x0f, 0x0e, 0x00, 0x83, 0x68, 0x9a, 0xd6, 0x00,
+    0x00, 0x2c, 0x63, 0x9c, 0x00, 0xf8, 0x05, 0x9a, 0xd6, 0x20, 0x00, 0x41, 0x00, 0x38, 0xc6, 0xff,
+    0xff, 0x3c, 0xe7, 0xc3, 0x18, 0x00, 0x00, 0x20, 0x00, 0xaa, 0x52, 0x20, 0x00, 0x0f, 0x0c, 0x00,
+    0x70, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x00, 0x66, 0xf7,
+    0xbd, 0x00, 0x00, 0x30, 0x84, 0x19, 0x00, 0x80, 0xb6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6,
+    0x12, 0x00, 0x80, 0x1b, 0xe7, 0x61, 0x08, 0x24, 0x21, 0xb6, 0xb5, 0x0c, 0x00, 0x0f, 0x04, 0x00,
+    0x93, 0x64, 0xf3, 0x9c, 0x00, 0x00, 0x75, 0xad, 0xac, 0x00, 0x82, 0xba, 0xd6, 0x20, 0x00, 0x00,
+    0x00, 0x14, 0xa5, 0x10, 0x00, 0x42, 0x5c, 0xe7, 0xf3, 0x9c, 0x0a, 0x00, 0x0f, 0x06, 0x00, 0x7c,
+    0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x00, 0x62, 0x8e, 0x73,
+    0x00, 0x00, 0x9a, 0xd6, 0x19, 0x00, 0x82, 0x34, 0xa5, 0x20, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x0e,
+    0x00, 0x0f, 0x06, 0x00, 0xa1, 0x60, 0xaa, 0x52, 0x00, 0x00, 0x3c, 0xe7, 0xba, 0x00, 0x80, 0x34,
+    0xa5, 0x00, 0x00, 0x20, 0x00, 0xd6, 0xb5, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x8c, 0x50, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x36, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x86, 0x31, 0x00, 0x00,
+    0xdf, 0xff, 0xff, 0xff, 0xef, 0x7b, 0x00, 0x00, 0x82, 0x10, 0x34, 0xa5, 0x23, 0x00, 0x00, 0x0f,
+    0x13, 0x00, 0x98, 0xef, 0xa2, 0x10, 0x04, 0x21, 0xff, 0xff, 0x49, 0x4a, 0x00, 0x00, 0xa2, 0x10,
+    0xba, 0xd6, 0xb9, 0x00, 0x94, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2d, 0x00, 0x1f, 0xff, 0x01,
+    0x00, 0x00, 0xcf, 0x00, 0x00, 0x65, 0x29, 0xa6, 0x31, 0x00, 0x00, 0x45, 0x29, 0xfb, 0xde, 0x1f,
+    0x00, 0x00, 0x0f, 0x13, 0x00, 0x9a, 0x31, 0x3c, 0xe7, 0x00, 0x01, 0x00, 0x4f, 0x6d, 0x6b, 0x9e,
+    0xf7, 0xb9, 0x00, 0x98, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0x00, 0x1f, 0xff, 0x01, 0x00,
+    0x00, 0x6f, 0xcb, 0x5a, 0x24, 0x21, 0xf7, 0xbd, 0x19, 0x00, 0x00, 0x0f, 0x13, 0x00, 0xff, 0x58,
+    0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x1f, 0xff, 0x01, 0x00, 0xff, 0x84, 0x50, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x1f, 0xff, 0x01, 0x00, 0xff, 0x84, 0x50, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0b, 0x00, 0x1f, 0xff, 0x01, 0x00, 0xb5, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
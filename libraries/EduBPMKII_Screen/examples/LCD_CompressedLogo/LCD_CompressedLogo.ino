@@ -0,0 +1,49 @@
+///
+/// @file		LCD_CompressedLogo.ino
+/// @brief		Main sketch
+///
+/// @details	Energia logo from an LZ4 compressed picture
+/// @n          Energia_logo_lz4.h is LCD_screen_Logos' picture compressed by
+/// @n          tools/LCD_compress.py --columns, 11 KB of flash instead of 28 KB.
+/// @n          drawCompressedBitmap() decompresses it two rows at a time
+/// @n          and pushes each block to the screen.
+///
+/// @copyright	CC = BY SA NC
+///
+
+// Core library for code-sense
+#if defined(ENERGIA) // LaunchPad MSP430, Stellaris and Tiva, Experimeter Board FR5739 specific
+#include "Energia.h"
+#else // error
+#error Platform not defined
+#endif
+
+// Include application, user and local libraries
+#include "SPI.h"
+#include "Screen_HX8353E.h"
+Screen_HX8353E myScreen;
+
+// Define variables and constants
+#include "Energia_logo_lz4.h"
+uint32_t chrono;
+
+// Add setup code
+void setup()
+{
+    Serial.begin(9600);
+    myScreen.begin();
+    myScreen.setOrientation(0);
+}
+
+// Add loop code
+void loop()
+{
+    myScreen.clear(whiteColour);
+    chrono = millis();
+    // 103 x 137, centred, the rows below the screen left out
+    if (!myScreen.drawCompressedBitmap((myScreen.screenSizeX() - 103) / 2, 0, lz4_Energia_logo_100_132_bmp)) {
+        Serial.println("drawCompressedBitmap failed");
+    }
+    Serial.println(millis() - chrono, DEC);
+    delay(2000);
+}
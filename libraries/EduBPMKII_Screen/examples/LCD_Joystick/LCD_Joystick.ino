@@ -70,7 +70,7 @@ void setup()
     y00 = 0;
 
     // MSP432 14-bit set to 12-bit
-#if defined(__MSP432P401R__)
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
     analogReadResolution(12);
 #endif
 
@@ -128,7 +128,7 @@ Screen_PicasoSGC myScreen(20, &mySerial);
 #elif defined(__LM4F120H5QR__) || defined(__TM4C123GH6PM__) 
 #define ROWS 64 // max 80
 #define COLS 64 // max 60
-#elif defined(__TM4C1294NCPDT__) || defined(__TM4C1294XNCZAD__) || defined(__MSP432P401R__)
+#elif defined(__TM4C1294NCPDT__) || defined(__TM4C1294XNCZAD__) || defined(__MSP432P401R__) || defined(__MSP432P4111__)
 #define ROWS 128 // max 128
 #define COLS 128 // max 128
 #else
@@ -0,0 +1,67 @@
+///
+/// @file		LCD_RenderTask.ino
+/// @brief		Main sketch
+///
+/// @details	Drawing from a control loop through the render task
+/// @n          The loop samples the joystick every 10 ms and plots it.
+/// @n          The drawing is only recorded; flush() hands it to the
+/// @n          render task, which sends it to the screen while the loop
+/// @n          waits for its next sample, so the period stays steady.
+///
+/// @copyright	CC = BY SA NC
+///
+
+// Core library for code-sense
+#if defined(ENERGIA) // LaunchPad MSP430, Stellaris and Tiva, Experimeter Board FR5739 specific
+#include "Energia.h"
+#else // error
+#error Platform not defined
+#endif
+
+// Include application, user and local libraries
+#include "SPI.h"
+#include "Screen_HX8353E.h"
+Screen_HX8353E myScreen;
+
+// Define variables and constants
+#define joystickX 2
+uint16_t renderBuffer[1024];
+uint16_t x = 0;
+uint32_t next, late = 0;
+
+// Add setup code
+void setup()
+{
+    myScreen.begin();
+    myScreen.setFontSize(0);
+    myScreen.setRenderBuffer(renderBuffer, 1024);
+    myScreen.gText(4, 4, "Joystick X", whiteColour, blackColour);
+    myScreen.flush();
+
+    // MSP432 14-bit set to 12-bit
+#if defined(__MSP432P401R__) || defined(__MSP432P4111__)
+    analogReadResolution(12);
+#endif
+    next = millis();
+}
+
+// Add loop code
+void loop()
+{
+    uint16_t y = 127 - map(analogRead(joystickX), 0, 4095, 0, 111);
+
+    myScreen.dLine(x, 16, 1, 112, blackColour);
+    myScreen.point(x, y, greenColour);
+    x = (x + 1) % 128;
+    if (x == 0) {
+        myScreen.gText(80, 4, String(late) + " late  ", yellowColour, blackColour);
+    }
+    myScreen.flush();
+
+    next += 10;
+    if ((int32_t)(next - millis()) > 0) {
+        delay(next - millis());
+    } else {
+        late++;
+    }
+}
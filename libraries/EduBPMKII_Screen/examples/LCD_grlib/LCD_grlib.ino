@@ -0,0 +1,62 @@
+///
+/// @file		LCD_grlib.ino
+/// @brief		Main sketch
+///
+/// @details	TI graphics library on the HX8353E screen
+/// @n          grlib draws through LCD_screen_grlib: its lines, rectangles
+/// @n          and fonts reach the screen as the fills and DMA pixel
+/// @n          transfers of Screen_HX8353E.
+///
+/// @copyright	CC = BY SA NC
+///
+
+// Core library for code-sense
+#if defined(ENERGIA) // LaunchPad MSP430, Stellaris and Tiva, Experimeter Board FR5739 specific
+#include "Energia.h"
+#else // error
+#error Platform not defined
+#endif
+
+// Include application, user and local libraries
+#include "SPI.h"
+#include "Screen_HX8353E.h"
+#include "LCD_screen_grlib.h"
+Screen_HX8353E myScreen;
+
+// Define variables and constants
+Graphics_Display display;
+Graphics_Context context;
+uint16_t count = 0;
+
+// Add setup code
+void setup()
+{
+    myScreen.begin();
+    LCD_screen_grlib::initDisplay(&display, &myScreen);
+    Graphics_initContext(&context, &display, &LCD_screen_grlib::functions);
+
+    Graphics_setForegroundColor(&context, GRAPHICS_COLOR_WHITE);
+    Graphics_setBackgroundColor(&context, GRAPHICS_COLOR_BLACK);
+    Graphics_setFont(&context, &g_sFontCm16b);
+    Graphics_clearDisplay(&context);
+    Graphics_drawStringCentered(&context, (int8_t *)"grlib", AUTO_STRING_LENGTH, 64, 16, TRANSPARENT_TEXT);
+
+    Graphics_setForegroundColor(&context, GRAPHICS_COLOR_RED);
+    Graphics_fillCircle(&context, 64, 72, 24);
+    Graphics_setForegroundColor(&context, GRAPHICS_COLOR_YELLOW);
+    Graphics_drawLine(&context, 0, 36, 127, 36);
+    Graphics_flushBuffer(&context);
+}
+
+// Add loop code
+void loop()
+{
+    char text[8];
+
+    Graphics_setForegroundColor(&context, GRAPHICS_COLOR_WHITE);
+    Graphics_setFont(&context, &g_sFontCm12);
+    String(count++).toCharArray(text, sizeof(text));
+    Graphics_drawStringCentered(&context, (int8_t *)text, AUTO_STRING_LENGTH, 64, 114, OPAQUE_TEXT);
+    Graphics_flushBuffer(&context);
+    delay(100);
+}
@@ -55,7 +55,6 @@ uint32_t chrono;
 void logo50()
 {
     uint32_t p;
-    uint16_t c;
     uint16_t x00 = 0;
     uint16_t y00 = 0;
     uint16_t i00 = 0;
@@ -73,12 +72,12 @@ void logo50()
     }
     p = (uint32_t)x_Energia_logo_100_132_bmp * y_Energia_logo_100_132_bmp;
     
-    for (uint16_t i=0; i<x_Energia_logo_100_132_bmp; i++) {
-        for (uint16_t j=0; j<y_Energia_logo_100_132_bmp; j++) {
-            if ((x00+i < myScreen.screenSizeX()) && (y00+j < myScreen.screenSizeY())) {
-                c = pic_Energia_logo_100_132_bmp[i*y_Energia_logo_100_132_bmp + j];
-                myScreen.point(x00+i-i00, y00+j-j00, c);
-            }
+    // The picture is stored column by column: one pushPixels() per column
+    uint16_t h = y_Energia_logo_100_132_bmp - j00;
+    if (y00+h > myScreen.screenSizeY()) h = myScreen.screenSizeY() - y00;
+    for (uint16_t i=i00; i<x_Energia_logo_100_132_bmp; i++) {
+        if (x00+i-i00 < myScreen.screenSizeX()) {
+            myScreen.pushPixels(x00+i-i00, y00, 1, h, &pic_Energia_logo_100_132_bmp[i*y_Energia_logo_100_132_bmp + j00]);
         }
     }
 }
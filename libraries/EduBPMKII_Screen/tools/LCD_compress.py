@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+#
+# LCD_compress.py - Compress an RGB565 picture for drawCompressedBitmap()
+#
+# Reads a picture header as used by the LCD_screen examples, one
+# #define for the width, one for the height and a uint16_t array, and
+# writes a header with the same picture as a uint8_t array:
+#
+#   width, height, rows per block        3 x uint16_t, little endian
+#   per block: size, LZ4 block           uint16_t, size bytes
+#
+# Each block holds rows per block rows, fewer for the last one, and is
+# an independent LZ4 block, so the sketch decompresses one at a time
+# into a buffer of LCD_COMPRESSED_BUFFER pixels.
+#
+# Usage: LCD_compress.py picture.h output.h [--columns] [--buffer 256]
+#   --columns  the array is stored column by column, as the Energia logo
+#   --buffer   LCD_COMPRESSED_BUFFER of the library
+
+import argparse
+import re
+import struct
+import sys
+
+MIN_MATCH = 4
+LAST_LITERALS = 5
+MATCH_LIMIT = 12
+
+
+def _length(n):
+    out = bytearray()
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+    return out
+
+
+def _sequence(out, literals, match_length, offset):
+    lit = len(literals)
+    token = (min(lit, 15) << 4)
+    if match_length:
+        token |= min(match_length - MIN_MATCH, 15)
+    out.append(token)
+    if lit >= 15:
+        out += _length(lit - 15)
+    out += literals
+    if match_length:
+        out += struct.pack('<H', offset)
+        if match_length - MIN_MATCH >= 15:
+            out += _length(match_length - MIN_MATCH - 15)
+
+
+def compress_block(data):
+    """Greedy LZ4 block compressor, without frame or block size."""
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    end = len(data)
+    while i + MATCH_LIMIT <= end:
+        key = data[i:i + MIN_MATCH]
+        candidate = table.get(key)
+        table[key] = i
+        if candidate is None or i - candidate > 0xffff:
+            i += 1
+            continue
+        length = MIN_MATCH
+        while (i + length < end - LAST_LITERALS) and (data[candidate + length] == data[i + length]):
+            length += 1
+        _sequence(out, data[anchor:i], length, i - candidate)
+        i += length
+        anchor = i
+    _sequence(out, data[anchor:], 0, 0)
+    return bytes(out)
+
+
+def read_picture(path, columns):
+    text = open(path).read()
+    sizes = re.findall(r'#define\s+(\w+)\s+\(?(\d+)\)?', text)
+    if len(sizes) < 2:
+        sys.exit('%s: width and height #define not found' % path)
+    width, height = int(sizes[0][1]), int(sizes[1][1])
+    body = text[text.index('{') + 1:text.rindex('}')]
+    pixels = [int(v, 0) for v in re.findall(r'0x[0-9a-fA-F]+|\b\d+\b', body)]
+    if len(pixels) != width * height:
+        sys.exit('%s: %d pixels for %d x %d' % (path, len(pixels), width, height))
+    if columns:
+        pixels = [pixels[i * height + j] for j in range(height) for i in range(width)]
+    name = re.sub(r'^x_', '', sizes[0][0])
+    return name, width, height, pixels
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compress an RGB565 picture for drawCompressedBitmap()')
+    parser.add_argument('input')
+    parser.add_argument('output')
+    parser.add_argument('--columns', action='store_true')
+    parser.add_argument('--buffer', type=int, default=256)
+    args = parser.parse_args()
+
+    name, width, height, pixels = read_picture(args.input, args.columns)
+    rows = args.buffer // width
+    if rows == 0:
+        sys.exit('%d pixels wide, more than a buffer of %d' % (width, args.buffer))
+
+    image = bytearray(struct.pack('<HHH', width, height, rows))
+    for j in range(0, height, rows):
+        block = pixels[j * width:min(j + rows, height) * width]
+        data = compress_block(struct.pack('<%dH' % len(block), *block))
+        image += struct.pack('<H', len(data)) + data
+
+    with open(args.output, 'w') as f:
+        f.write('// %s, %d x %d, %d bytes instead of %d\n' % (name, width, height, len(image), 2 * len(pixels)))
+        f.write('// Generated by LCD_compress.py for drawCompressedBitmap()\n\n')
+        f.write('static const uint8_t lz4_%s[] = {\n' % name)
+        for k in range(0, len(image), 16):
+            f.write('    ' + ' '.join('0x%02x,' % b for b in image[k:k + 16]) + '\n')
+        f.write('};\n')
+    print('%s: %d bytes instead of %d' % (args.output, len(image), 2 * len(pixels)))
+
+
+if __name__ == '__main__':
+    main()
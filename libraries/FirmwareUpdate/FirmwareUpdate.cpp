@@ -0,0 +1,258 @@
+/*
+ * FirmwareUpdate.cpp - field updates into the second flash bank
+ *
+ * Flash is programmed straight through driverlib's FlashCtl, the way
+ * the NVS driver does it: unprotect the sector, erase or program it,
+ * protect it again. (The NVS region opens only once, and FlashStore
+ * or FlashLog may hold it.) The MSP432P401R protects per sector and
+ * bank, the MSP432P4111's FlashCtl_A per address range.
+ */
+
+#include "FirmwareUpdate.h"
+
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+#include <driverlib/rom.h>
+#include <driverlib/rom_map.h>
+#include <HardwareCRC.h>
+#if defined(__MSP432P401R__)
+#include <driverlib/flash.h>
+#else
+#include <driverlib/flash_a.h>
+#endif
+
+#define SECTOR_SIZE         0x1000
+
+/* from the linker command file */
+extern uint8_t __FLASH_LENGTH__;
+extern uint8_t __UNUSED_FLASH_start__;
+
+FirmwareUpdateClass FirmwareUpdate;
+
+FirmwareUpdateClass::FirmwareUpdateClass(void)
+{
+    bank = (uint32_t)&__FLASH_LENGTH__ / 2;
+    size = 0;
+    offset = 0;
+    verified = false;
+}
+
+/*
+ *  ======== maxSize ========
+ *  All of bank 1, or 0 if the running sketch reaches into it
+ */
+uint32_t FirmwareUpdateClass::maxSize(void)
+{
+    return ((uint32_t)&__UNUSED_FLASH_start__ <= bank ? bank : 0);
+}
+
+/*
+ *  ======== begin ========
+ *  Start an image of size bytes whose CRC-32 is crc; drops any image
+ *  written before.
+ */
+bool FirmwareUpdateClass::begin(uint32_t size, uint32_t crc)
+{
+    abort();
+
+    if (size == 0 || size > maxSize()) {
+        return (false);
+    }
+
+    this->size = size;
+    this->crc = crc;
+
+    return (true);
+}
+
+/*
+ *  ======== abort ========
+ */
+void FirmwareUpdateClass::abort(void)
+{
+    size = 0;
+    offset = 0;
+    verified = false;
+}
+
+/*
+ *  ======== write ========
+ *  Program the next length bytes of the image, erasing each sector
+ *  as it is reached. Returns the bytes written; fewer than length
+ *  aborts the update: past the image size or a flash failure.
+ */
+size_t FirmwareUpdateClass::write(const uint8_t *data, size_t length)
+{
+    size_t done = 0;
+    size_t n;
+
+    if (size == 0 || length > size - offset) {
+        abort();
+        return (0);
+    }
+
+    while (done < length) {
+        if ((offset & (SECTOR_SIZE - 1)) == 0 && !erase(bank + offset)) {
+            break;
+        }
+
+        n = SECTOR_SIZE - (offset & (SECTOR_SIZE - 1));
+        if (n > length - done) {
+            n = length - done;
+        }
+
+        if (!program(bank + offset, data + done, n)) {
+            break;
+        }
+
+        offset += n;
+        done += n;
+    }
+
+    if (done < length) {
+        abort();
+    }
+
+    return (done);
+}
+
+/*
+ *  ======== end ========
+ *  True if the whole image is in bank 1 and its CRC-32 matches
+ */
+bool FirmwareUpdateClass::end(void)
+{
+    verified = size != 0 && offset == size &&
+        Crc32::compute((const void *)bank, size) == crc;
+
+    return (verified);
+}
+
+/*
+ *  ======== update ========
+ *  begin(), write() and end() for an image read from stream; each
+ *  read may wait up to timeout ms
+ */
+bool FirmwareUpdateClass::update(Stream &stream, uint32_t size,
+    uint32_t crc, unsigned long timeout)
+{
+    uint8_t chunk[FIRMWARE_CHUNK_SIZE];
+    size_t n;
+
+    if (!begin(size, crc)) {
+        return (false);
+    }
+
+    stream.setTimeout(timeout);
+
+    while (offset < size) {
+        n = size - offset;
+        if (n > sizeof(chunk)) {
+            n = sizeof(chunk);
+        }
+
+        n = stream.readBytes(chunk, n);
+        if (n == 0 || write(chunk, n) != n) {
+            abort();
+            return (false);
+        }
+    }
+
+    return (end());
+}
+
+/*
+ *  ======== erase ========
+ */
+bool FirmwareUpdateClass::erase(uint32_t address)
+{
+    bool ok;
+
+#if defined(__MSP432P401R__)
+    uint32_t sector = 1 << ((address - bank) / SECTOR_SIZE);
+
+    MAP_FlashCtl_unprotectSector(FLASH_MAIN_MEMORY_SPACE_BANK1, sector);
+    ok = MAP_FlashCtl_eraseSector(address);
+    MAP_FlashCtl_protectSector(FLASH_MAIN_MEMORY_SPACE_BANK1, sector);
+#else
+    MAP_FlashCtl_A_unprotectMemory(address, address + SECTOR_SIZE - 1);
+    ok = MAP_FlashCtl_A_eraseSector(address);
+    MAP_FlashCtl_A_protectMemory(address, address + SECTOR_SIZE - 1);
+#endif
+
+    return (ok);
+}
+
+/*
+ *  ======== program ========
+ *  length bytes within one sector
+ */
+bool FirmwareUpdateClass::program(uint32_t address, const uint8_t *data,
+    size_t length)
+{
+    bool ok;
+
+#if defined(__MSP432P401R__)
+    uint32_t sector = 1 << ((address - bank) / SECTOR_SIZE);
+
+    MAP_FlashCtl_unprotectSector(FLASH_MAIN_MEMORY_SPACE_BANK1, sector);
+    ok = MAP_FlashCtl_programMemory((void *)data, (void *)address, length);
+    MAP_FlashCtl_protectSector(FLASH_MAIN_MEMORY_SPACE_BANK1, sector);
+#else
+    MAP_FlashCtl_A_unprotectMemory(address, address + length - 1);
+    ok = MAP_FlashCtl_A_programMemory((void *)data, (void *)address, length);
+    MAP_FlashCtl_A_protectMemory(address, address + length - 1);
+#endif
+
+    return (ok);
+}
+
+/*
+ *  ======== copyBank ========
+ *  Copy size bytes from bank 1 over bank 0 and reset. Runs from SRAM
+ *  with interrupts off while bank 0 is erased under it, so it calls
+ *  ROM functions only and reads no constants from flash.
+ */
+static RAMFUNC void copyBank(uint32_t bank, uint32_t size)
+{
+    uint32_t address;
+
+#if defined(__MSP432P401R__)
+    ROM_FlashCtl_unprotectSector(FLASH_MAIN_MEMORY_SPACE_BANK0, 0xffffffff);
+#else
+    ROM_FlashCtl_A_unprotectMemory(0, bank - 1);
+#endif
+
+    for (address = 0; address < size; address += SECTOR_SIZE) {
+#if defined(__MSP432P401R__)
+        ROM_FlashCtl_eraseSector(address);
+        ROM_FlashCtl_programMemory((void *)(bank + address), (void *)address,
+            SECTOR_SIZE);
+#else
+        ROM_FlashCtl_A_eraseSector(address);
+        ROM_FlashCtl_A_programMemory((void *)(bank + address),
+            (void *)address, SECTOR_SIZE);
+#endif
+    }
+
+    /* SCB->AIRCR = VECTKEY | SYSRESETREQ */
+    *(volatile uint32_t *)0xE000ED0C = 0x05FA0004;
+    for (;;) {
+    }
+}
+
+/*
+ *  ======== apply ========
+ *  Replace the running sketch with the image end() verified
+ */
+bool FirmwareUpdateClass::apply(void)
+{
+    if (!verified) {
+        return (false);
+    }
+
+    Hwi_disable();
+    copyBank(bank, size);
+
+    return (false);
+}
@@ -0,0 +1,80 @@
+/*
+ * FirmwareUpdate.h - field updates into the second flash bank
+ *
+ *      FirmwareUpdate.begin(size, crc);
+ *      FirmwareUpdate.write(chunk, length);    // as the image arrives
+ *      ...
+ *      if (FirmwareUpdate.end()) {             // all there, CRC-32 good
+ *          FirmwareUpdate.apply();             // boots the new image
+ *      }
+ *
+ * or, from anything that is a Stream (WiFiClient, Serial):
+ *
+ *      FirmwareUpdate.update(client, size, crc);
+ *
+ * The image, a sketch's .bin, is programmed into bank 1 while the
+ * sketch keeps running from bank 0: the two banks read and write
+ * independently, so a sector erase or program in bank 1 doesn't stall
+ * the CPU, and the sketch goes on serving its network and sensors.
+ * Each sector is erased as the image reaches it. end() checks the
+ * bytes in flash against the sender's CRC-32 (the zlib one, as the
+ * CRC32 module computes it).
+ *
+ * The MSP432 cannot swap its banks, so apply() copies bank 1 over
+ * bank 0 and resets. The copy runs from SRAM, with interrupts off, on
+ * the ROM flash functions, and takes about a second for a 128KB image.
+ * A power loss during it leaves bank 0 half written and needs the
+ * debugger or the BSL to recover; everything before apply() can fail
+ * with no harm done.
+ *
+ * The sketch must fit in bank 0 (128KB on the MSP432P401R, 1MB on the
+ * MSP432P4111) and so must the image. FlashStore and FlashLog keep
+ * their sectors from the start of the flash after the sketch; they
+ * have to stay in bank 0 too, and an image larger than the sketch
+ * overwrites the first of them. Their writes share the flash
+ * controller with write(), so don't run them meanwhile.
+ */
+
+#ifndef FirmwareUpdate_h
+#define FirmwareUpdate_h
+
+#include <Energia.h>
+
+/* update()'s chunk size, on the stack of the caller */
+#ifndef FIRMWARE_CHUNK_SIZE
+#define FIRMWARE_CHUNK_SIZE     256
+#endif
+
+class FirmwareUpdateClass
+{
+    public:
+        FirmwareUpdateClass(void);
+
+        bool begin(uint32_t size, uint32_t crc);
+        size_t write(const uint8_t *data, size_t length);
+        bool end(void);
+        void abort(void);
+
+        bool update(Stream &stream, uint32_t size, uint32_t crc,
+            unsigned long timeout = 5000);
+
+        bool apply(void);           /* returns only if there is no image */
+
+        uint32_t maxSize(void);     /* of an image */
+        uint32_t written(void) { return (offset); }
+        bool ready(void) { return (verified); }
+
+    private:
+        bool erase(uint32_t address);
+        bool program(uint32_t address, const uint8_t *data, size_t length);
+
+        uint32_t bank;              /* bank 1 base = bank size */
+        uint32_t size;              /* of the image, 0 if none */
+        uint32_t crc;
+        uint32_t offset;            /* bytes written so far */
+        bool verified;
+};
+
+extern FirmwareUpdateClass FirmwareUpdate;
+
+#endif
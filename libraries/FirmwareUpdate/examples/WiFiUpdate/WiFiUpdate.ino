@@ -0,0 +1,82 @@
+/*
+  WiFi Update
+
+  Takes a new sketch over WiFi while this one keeps blinking. Connect
+  to port 3232 and send the image's size and CRC-32, both 4 bytes
+  little endian, then the .bin itself, e.g. with Python:
+
+    data = open("sketch.bin", "rb").read()
+    s = socket.create_connection((address, 3232))
+    s.sendall(struct.pack("<II", len(data), zlib.crc32(data)) + data)
+
+  The image goes into the second flash bank as it arrives; once it is
+  all there and its CRC-32 checks out, the board replies "ok" and
+  boots it. Anything short of that replies "failed" and carries on
+  with the running sketch.
+
+  This example code is in the public domain.
+*/
+
+#ifndef __CC3200R1M1RGC__
+#include <SPI.h>
+#endif
+#include <WiFi.h>
+#include <FirmwareUpdate.h>
+
+char ssid[] = "energia";
+char password[] = "supersecret";
+
+WiFiServer server(3232);
+
+void setup()
+{
+  Serial.begin(115200);
+  pinMode(RED_LED, OUTPUT);
+
+  WiFi.begin(ssid, password);
+  while (WiFi.status() != WL_CONNECTED || WiFi.localIP() == INADDR_NONE) {
+    delay(300);
+  }
+
+  Serial.print("update port ");
+  Serial.print(WiFi.localIP());
+  Serial.print(":3232, images up to ");
+  Serial.print(FirmwareUpdate.maxSize());
+  Serial.println(" bytes");
+
+  server.begin();
+}
+
+void loop()
+{
+  static unsigned long lastBlink;
+  WiFiClient client = server.available();
+
+  if (millis() - lastBlink >= 500) {
+    lastBlink = millis();
+    digitalWrite(RED_LED, !digitalRead(RED_LED));
+  }
+
+  if (!client) {
+    delay(10);
+    return;
+  }
+
+  uint32_t header[2];   // size, CRC-32
+
+  client.setTimeout(5000);
+  if (client.readBytes((uint8_t *)header, sizeof(header)) == sizeof(header)
+      && FirmwareUpdate.update(client, header[0], header[1])) {
+    Serial.println("update received, restarting");
+    client.print("ok\n");
+    client.stop();
+    Serial.flush();
+    FirmwareUpdate.apply();
+  }
+
+  Serial.print("update failed after ");
+  Serial.print(FirmwareUpdate.written());
+  Serial.println(" bytes");
+  client.print("failed\n");
+  client.stop();
+}
@@ -0,0 +1,484 @@
+/*
+ * FlashLog.cpp - crash-safe binary event log on flash
+ *
+ * The region is pages pages of FLASHLOG_PAGE_SIZE bytes, sectorPages
+ * to an erase sector, written in turn around the ring. Pages within a
+ * sector are written in order after it is erased, so past the newest
+ * page of a sector the rest is blank; a reset can leave a torn page,
+ * which is skipped.
+ *
+ * log() and queueFill() run with interrupts disabled; the writer task
+ * and the reader only take the mutex, which covers the NVS region.
+ */
+
+#include "FlashLog.h"
+
+#include <string.h>
+
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+#include <xdc/runtime/Error.h>
+
+#define SEQUENCE_ERASED     0xffffffff
+
+FlashLogClass FlashLog;
+
+FlashLogClass::FlashLogClass(void)
+{
+    nvs = NULL;
+    writer = NULL;
+}
+
+/*
+ *  ======== begin ========
+ *  Open the log in size bytes at offset in NVS region nvsIndex (all of
+ *  the region from offset if size is 0) and find its newest page
+ */
+bool FlashLogClass::begin(uint_least8_t nvsIndex, uint32_t offset,
+    uint32_t size)
+{
+    Semaphore_Params semParams;
+    Task_Params taskParams;
+    NVS_Attrs attrs;
+
+    if (nvs != NULL) {
+        return (true);
+    }
+
+    if (writer == NULL) {
+        Semaphore_Params_init(&semParams);
+        Semaphore_construct(&writeSem, 0, &semParams);
+
+        Task_Params_init(&taskParams);
+        taskParams.arg0 = (UArg)this;
+        taskParams.stackSize = 768;
+        taskParams.priority = FLASHLOG_PRIORITY;
+        taskParams.instance->name = (xdc_String)"flashlog";
+
+        writer = Task_create(writerFxn, &taskParams, Error_IGNORE);
+        if (writer == NULL) {
+            Semaphore_destruct(&writeSem);
+            return (false);
+        }
+    }
+
+    NVS_init();
+    nvs = NVS_open(nvsIndex, NULL);
+    if (nvs == NULL) {
+        return (false);
+    }
+
+    NVS_getAttrs(nvs, &attrs);
+    if (size == 0 && offset < attrs.regionSize) {
+        size = attrs.regionSize - offset;
+    }
+    if (attrs.sectorSize % FLASHLOG_PAGE_SIZE != 0 ||
+        offset % attrs.sectorSize != 0 || size % attrs.sectorSize != 0 ||
+        size < 2 * attrs.sectorSize || offset > attrs.regionSize ||
+        size > attrs.regionSize - offset) {
+        NVS_close(nvs);
+        nvs = NULL;
+        return (false);
+    }
+
+    this->offset = offset;
+    sectorSize = attrs.sectorSize;
+    pages = size / FLASHLOG_PAGE_SIZE;
+    sectorPages = sectorSize / FLASHLOG_PAGE_SIZE;
+
+    fill = 0;
+    drain = 0;
+    queued = 0;
+    fillLength = sizeof(FlashLogPage);
+    lost = 0;
+
+    mount();
+    rewind();
+
+    return (true);
+}
+
+/*
+ *  ======== end ========
+ *  Commit the records in RAM and close the region
+ */
+void FlashLogClass::end(void)
+{
+    if (nvs != NULL) {
+        flush();
+
+        MutexLock hold(lock);
+        NVS_close(nvs);
+        nvs = NULL;
+    }
+}
+
+/*
+ *  ======== log ========
+ *  Add a record to the page being filled, queueing the page for the
+ *  writer when the record does not fit. Callable from any context.
+ */
+bool FlashLogClass::log(uint8_t id, const void *data, uint8_t length)
+{
+    uint32_t time = micros();
+    uint8_t *rec;
+    uintptr_t key;
+
+    if (nvs == NULL || length > FLASHLOG_PAYLOAD_MAX) {
+        return (false);
+    }
+
+    key = Hwi_disable();
+
+    if (fillLength + FLASHLOG_RECORD_HEADER + length > FLASHLOG_PAGE_SIZE &&
+        !queueFill()) {
+        lost++;
+        Hwi_restore(key);
+        return (false);
+    }
+
+    rec = buffers[fill] + fillLength;
+    memcpy(rec, &time, sizeof(time));
+    rec[4] = id;
+    rec[5] = length;
+    if (length != 0) {
+        memcpy(rec + FLASHLOG_RECORD_HEADER, data, length);
+    }
+    fillLength += FLASHLOG_RECORD_HEADER + length;
+
+    Hwi_restore(key);
+
+    return (true);
+}
+
+/*
+ *  ======== flush ========
+ *  Queue the page being filled and wait until every queued page is in
+ *  flash
+ */
+void FlashLogClass::flush(void)
+{
+    uintptr_t key;
+    bool ok;
+
+    if (nvs == NULL) {
+        return;
+    }
+
+    for (;;) {
+        key = Hwi_disable();
+        ok = queueFill();
+        Hwi_restore(key);
+        if (ok) {
+            break;
+        }
+        delay(1);
+    }
+
+    while (queued != 0) {
+        delay(1);
+    }
+}
+
+uint32_t FlashLogClass::dropped(void)
+{
+    return (lost);
+}
+
+/*
+ *  ======== rewind ========
+ *  Start next() and dump() at the oldest page: the first of the sector
+ *  after the newest page's, which the writer erases last
+ */
+void FlashLogClass::rewind(void)
+{
+    uint32_t newest = (head + pages - 1) % pages;
+
+    readPosition = (newest / sectorPages + 1) * sectorPages % pages;
+    readRemaining = pages;
+    readSequence = 0;
+    readOffset = 0;
+    readLength = 0;
+}
+
+/*
+ *  ======== next ========
+ *  The next record, oldest first; false at the end of the log
+ */
+bool FlashLogClass::next(FlashLogEntry *entry)
+{
+    const uint8_t *rec;
+
+    for (;;) {
+        while (readOffset >= readLength) {
+            if (!nextPage()) {
+                return (false);
+            }
+        }
+
+        rec = readBuf + readOffset;
+        if (readOffset + FLASHLOG_RECORD_HEADER + rec[5] > readLength ||
+            rec[5] > FLASHLOG_PAYLOAD_MAX) {
+            readOffset = readLength;
+            continue;
+        }
+
+        memcpy(&entry->time, rec, sizeof(entry->time));
+        entry->id = rec[4];
+        entry->length = rec[5];
+        memcpy(entry->data, rec + FLASHLOG_RECORD_HEADER, entry->length);
+        readOffset += FLASHLOG_RECORD_HEADER + entry->length;
+
+        return (true);
+    }
+}
+
+/*
+ *  ======== dump ========
+ *  Write every valid page, header included, oldest first; returns the
+ *  number of bytes written
+ */
+size_t FlashLogClass::dump(Print &out)
+{
+    size_t total = 0;
+
+    rewind();
+    while (nextPage()) {
+        total += out.write(readBuf, readLength);
+    }
+    readOffset = readLength;
+
+    return (total);
+}
+
+/*
+ *  ======== writerFxn ========
+ *  Write the queued pages; writeSem is posted once per page
+ */
+void FlashLogClass::writerFxn(UArg arg0, UArg arg1)
+{
+    FlashLogClass *log = (FlashLogClass *)arg0;
+    uintptr_t key;
+
+    for (;;) {
+        Semaphore_pend(Semaphore_handle(&log->writeSem), BIOS_WAIT_FOREVER);
+
+        if (log->queued != 0) {
+            log->writePage(log->buffers[log->drain]);
+            log->drain = (log->drain + 1) % FLASHLOG_BUFFERS;
+
+            key = Hwi_disable();
+            log->queued--;
+            Hwi_restore(key);
+        }
+    }
+}
+
+/*
+ *  ======== crc16 ========
+ *  CRC-16-CCITT
+ */
+uint16_t FlashLogClass::crc16(uint16_t crc, const uint8_t *data,
+    size_t length)
+{
+    uint8_t bit;
+
+    while (length--) {
+        crc ^= (uint16_t)*data++ << 8;
+        for (bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+
+    return (crc);
+}
+
+/*
+ *  ======== queueFill ========
+ *  Hand the page being filled to the writer and start the next one.
+ *  Called with interrupts disabled; false if no buffer is free.
+ */
+bool FlashLogClass::queueFill(void)
+{
+    if (fillLength == sizeof(FlashLogPage)) {
+        return (true);
+    }
+    if (queued == FLASHLOG_BUFFERS - 1) {
+        return (false);
+    }
+
+    ((FlashLogPage *)buffers[fill])->length =
+        fillLength - sizeof(FlashLogPage);
+    fill = (fill + 1) % FLASHLOG_BUFFERS;
+    fillLength = sizeof(FlashLogPage);
+    queued++;
+
+    Semaphore_post(Semaphore_handle(&writeSem));
+
+    return (true);
+}
+
+/*
+ *  ======== writePage ========
+ *  Seal a page with the next sequence number and its CRC and program
+ *  it at the head, erasing the head's sector first if it starts there.
+ *  A page that fails to program is skipped; its CRC will not match.
+ */
+void FlashLogClass::writePage(uint8_t *page)
+{
+    FlashLogPage *header = (FlashLogPage *)page;
+    uint32_t address;
+
+    MutexLock hold(lock);
+
+    if (nvs == NULL) {
+        return;
+    }
+
+    header->sequence = sequence + 1;
+    header->crc = crc16(0xffff, page + sizeof(header->crc),
+        sizeof(FlashLogPage) - sizeof(header->crc) + header->length);
+
+    address = offset + head * FLASHLOG_PAGE_SIZE;
+    if (head % sectorPages == 0) {
+        NVS_erase(nvs, address, sectorSize);
+    }
+    NVS_write(nvs, address, page, sizeof(FlashLogPage) + header->length, 0);
+
+    sequence++;
+    head = (head + 1) % pages;
+}
+
+/*
+ *  ======== readPage ========
+ *  Read a page into buf; whether it is a complete page with a good CRC
+ */
+bool FlashLogClass::readPage(uint32_t page, uint8_t *buf)
+{
+    FlashLogPage header;
+
+    {
+        MutexLock hold(lock);
+
+        if (nvs == NULL || NVS_read(nvs, offset + page * FLASHLOG_PAGE_SIZE,
+            buf, FLASHLOG_PAGE_SIZE) != NVS_STATUS_SUCCESS) {
+            return (false);
+        }
+    }
+
+    memcpy(&header, buf, sizeof(header));
+
+    return (header.sequence != SEQUENCE_ERASED &&
+        header.length <= FLASHLOG_PAGE_SIZE - sizeof(FlashLogPage) &&
+        crc16(0xffff, buf + sizeof(header.crc),
+            sizeof(FlashLogPage) - sizeof(header.crc) + header.length) ==
+        header.crc);
+}
+
+/*
+ *  ======== blank ========
+ *  Whether a page read by readPage() was never written
+ */
+bool FlashLogClass::blank(const uint8_t *buf)
+{
+    uint16_t i;
+
+    for (i = 0; i < FLASHLOG_PAGE_SIZE; i++) {
+        if (buf[i] != 0xff) {
+            return (false);
+        }
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== nextPage ========
+ *  Load the next valid page into readBuf. A blank page ends its
+ *  sector; a page older than the last one read is the end of the log.
+ */
+bool FlashLogClass::nextPage(void)
+{
+    FlashLogPage header;
+    uint32_t page;
+
+    while (readRemaining != 0) {
+        page = readPosition;
+        readPosition = (readPosition + 1) % pages;
+        readRemaining--;
+
+        if (!readPage(page, readBuf)) {
+            if (blank(readBuf)) {
+                /* skip the rest of the sector */
+                while (readRemaining != 0 && readPosition % sectorPages) {
+                    readPosition = (readPosition + 1) % pages;
+                    readRemaining--;
+                }
+            }
+            continue;
+        }
+
+        memcpy(&header, readBuf, sizeof(header));
+        if (header.sequence <= readSequence) {
+            readRemaining = 0;
+            break;
+        }
+
+        readSequence = header.sequence;
+        readOffset = sizeof(FlashLogPage);
+        readLength = sizeof(FlashLogPage) + header.length;
+
+        return (true);
+    }
+
+    return (false);
+}
+
+/*
+ *  ======== mount ========
+ *  Find the newest page: the newest sector by the first valid page of
+ *  each, then the last valid page in it. The head is the first blank
+ *  page after it, or the next sector.
+ */
+void FlashLogClass::mount(void)
+{
+    FlashLogPage header;
+    uint32_t newest = pages;
+    uint32_t page;
+    uint32_t sector;
+
+    sequence = 0;
+
+    for (sector = 0; sector < pages; sector += sectorPages) {
+        for (page = sector; page < sector + sectorPages; page++) {
+            if (readPage(page, readBuf)) {
+                memcpy(&header, readBuf, sizeof(header));
+                if (newest == pages || header.sequence > sequence) {
+                    newest = page;
+                    sequence = header.sequence;
+                }
+                break;
+            }
+            if (blank(readBuf)) {
+                break;
+            }
+        }
+    }
+
+    if (newest == pages) {
+        head = 0;
+        return;
+    }
+
+    for (page = newest + 1; page % sectorPages != 0; page++) {
+        if (readPage(page, readBuf)) {
+            memcpy(&header, readBuf, sizeof(header));
+            if (header.sequence > sequence) {
+                sequence = header.sequence;
+            }
+        }
+        else if (blank(readBuf)) {
+            break;
+        }
+    }
+    head = page % pages;
+}
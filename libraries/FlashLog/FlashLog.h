@@ -0,0 +1,135 @@
+/*
+ * FlashLog.h - crash-safe binary event log on flash
+ *
+ *      FlashLog.begin();                       // internal flash
+ *      FlashLog.log(EVENT_ADC, &sample, 2);    // from a task or a Hwi
+ *      ...
+ *      FlashLog.dump(Serial);                  // raw pages, oldest first
+ *
+ * log() stamps a record with micros() and copies it into a RAM page
+ * buffer, with interrupts disabled for the copy only, so it can be
+ * called thousands of times a second from anywhere. Full pages go to
+ * the writer task, which programs each in one NVS write with a
+ * sequence number and a CRC; FLASHLOG_BUFFERS pages absorb the time
+ * an erase takes. A record that finds every buffer full is dropped
+ * and counted (dropped()).
+ *
+ * The log is a ring of erase sectors in an NVS region, the internal
+ * flash (index 0) or a SPI flash (index 1, NVSSPI25X): the sector
+ * after the newest page is erased as the log reaches it. A page torn
+ * by a reset fails its CRC and is skipped, so everything committed
+ * before it survives; records still in RAM are lost, flush() commits
+ * them early.
+ *
+ * rewind() and next() walk the records oldest first; dump() writes the
+ * valid pages as they are in flash, for decoding on the host.
+ *
+ * FlashStore keeps the first sectors of the internal flash region:
+ * give the log an offset past them if both are used.
+ */
+
+#ifndef FlashLog_h
+#define FlashLog_h
+
+#include <Energia.h>
+
+#include <ti/drivers/NVS.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/knl/Task.h>
+#include <Mutex.h>
+
+/* bytes programmed at a time, a divisor of the erase sector size */
+#ifndef FLASHLOG_PAGE_SIZE
+#define FLASHLOG_PAGE_SIZE      256
+#endif
+
+/* RAM page buffers, the one being filled included */
+#ifndef FLASHLOG_BUFFERS
+#define FLASHLOG_BUFFERS        4
+#endif
+
+/* writer task priority */
+#ifndef FLASHLOG_PRIORITY
+#define FLASHLOG_PRIORITY       1
+#endif
+
+#define FLASHLOG_PAYLOAD_MAX    32
+
+/* the start of every page */
+struct FlashLogPage {
+    uint16_t crc;               /* of the rest of the page */
+    uint16_t length;            /* of the records after the header */
+    uint32_t sequence;          /* 0xffffffff: erased */
+};
+
+/* records are packed: time (4 bytes), id, length, then the payload */
+#define FLASHLOG_RECORD_HEADER  6
+
+struct FlashLogEntry {
+    uint32_t time;              /* micros() when logged */
+    uint8_t id;
+    uint8_t length;
+    uint8_t data[FLASHLOG_PAYLOAD_MAX];
+};
+
+class FlashLogClass
+{
+    public:
+        FlashLogClass(void);
+
+        bool begin(uint_least8_t nvsIndex = 0, uint32_t offset = 0,
+            uint32_t size = 0);
+        void end(void);
+
+        bool log(uint8_t id, const void *data, uint8_t length);
+        void flush(void);
+        uint32_t dropped(void);
+
+        void rewind(void);
+        bool next(FlashLogEntry *entry);
+        size_t dump(Print &out);
+
+    private:
+        static void writerFxn(UArg arg0, UArg arg1);
+        static uint16_t crc16(uint16_t crc, const uint8_t *data,
+            size_t length);
+
+        bool queueFill(void);
+        void writePage(uint8_t *page);
+        bool readPage(uint32_t page, uint8_t *buf);
+        static bool blank(const uint8_t *buf);
+        bool nextPage(void);
+        void mount(void);
+
+        NVS_Handle nvs;
+        uint32_t offset;            /* of the log in the NVS region */
+        uint32_t sectorSize;
+        uint32_t pages;
+        uint32_t sectorPages;
+        uint32_t head;              /* page written next */
+        uint32_t sequence;          /* of the newest page */
+
+        /* page buffers, filled and written in turn */
+        uint8_t buffers[FLASHLOG_BUFFERS][FLASHLOG_PAGE_SIZE];
+        uint16_t fill;              /* buffer being filled */
+        uint16_t fillLength;        /* of the header and records in it */
+        uint16_t drain;             /* next buffer to write */
+        volatile uint16_t queued;   /* full buffers not written yet */
+        volatile uint32_t lost;
+
+        /* rewind()/next() */
+        uint8_t readBuf[FLASHLOG_PAGE_SIZE];
+        uint32_t readPosition;      /* page read next */
+        uint32_t readRemaining;     /* pages left to look at */
+        uint32_t readSequence;
+        uint16_t readOffset;        /* in readBuf */
+        uint16_t readLength;
+
+        Mutex lock;                 /* the NVS region */
+        Semaphore_Struct writeSem;
+        Task_Handle writer;
+};
+
+extern FlashLogClass FlashLog;
+
+#endif
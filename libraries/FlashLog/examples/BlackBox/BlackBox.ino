@@ -0,0 +1,62 @@
+/*
+  Black box
+
+  Records A0 a thousand times a second, plus an event each time the
+  PUSH1 button is pressed, in the internal flash. After a reset, send
+  'p' to print the records, oldest first, or 'd' to dump the raw pages
+  for a host tool.
+
+  This example code is in the public domain.
+*/
+
+#include <FlashLog.h>
+
+#define EVENT_A0      1
+#define EVENT_BUTTON  2
+
+void setup()
+{
+  Serial.begin(115200);
+  pinMode(PUSH1, INPUT_PULLUP);
+
+  if (!FlashLog.begin()) {
+    Serial.println("no flash for the log");
+    for (;;);
+  }
+}
+
+void loop()
+{
+  static bool pressed = false;
+  uint16_t sample = analogRead(A0);
+  FlashLogEntry entry;
+
+  FlashLog.log(EVENT_A0, &sample, sizeof(sample));
+
+  if (digitalRead(PUSH1) == LOW && !pressed) {
+    FlashLog.log(EVENT_BUTTON, NULL, 0);
+    FlashLog.flush();
+  }
+  pressed = digitalRead(PUSH1) == LOW;
+
+  switch (Serial.read()) {
+    case 'p':
+      FlashLog.rewind();
+      while (FlashLog.next(&entry)) {
+        Serial.print(entry.time);
+        Serial.print(entry.id == EVENT_BUTTON ? " button" : " A0 ");
+        if (entry.id == EVENT_A0) {
+          memcpy(&sample, entry.data, sizeof(sample));
+          Serial.print(sample);
+        }
+        Serial.println();
+      }
+      break;
+
+    case 'd':
+      FlashLog.dump(Serial);
+      break;
+  }
+
+  delay(1);
+}
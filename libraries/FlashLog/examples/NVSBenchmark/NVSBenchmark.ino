@@ -0,0 +1,179 @@
+/*
+  NVS Benchmark
+
+  Measures the NVS regions of the board file, the internal flash
+  (NVS_config[0]) and the SPI flash (NVS_config[1], skipped if there
+  is no chip): sector erase, programming a sector in writes of 16
+  bytes to a whole sector, and reading it back in the same sizes. For
+  each it prints the throughput and the latency per call: average,
+  99th percentile (as the bound of its power of two bucket) and worst
+  case. The erase and program times are what a logger's RAM buffers
+  have to cover (FLASHLOG_BUFFERS).
+
+  The test uses the last TEST_SECTORS sectors of each region, which
+  it erases: anything FlashLog or FlashStore keeps there is lost.
+
+  This example code is in the public domain.
+*/
+
+#include <ti/drivers/NVS.h>
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
+
+#define TEST_SECTORS  4
+#define MAX_CHUNK     4096
+
+uint8_t buf[MAX_CHUNK];
+
+float ticksPerUs;
+
+// latency distribution, buckets of powers of two microseconds
+struct Latency {
+  uint32_t count;
+  float totalUs;
+  float maxUs;
+  uint32_t buckets[24];
+};
+
+void reset(Latency &l)
+{
+  memset(&l, 0, sizeof(l));
+}
+
+void add(Latency &l, float us)
+{
+  int b = 0;
+
+  while (b < 23 && us >= (1UL << b)) {
+    b++;
+  }
+  l.buckets[b]++;
+  l.count++;
+  l.totalUs += us;
+  if (us > l.maxUs) {
+    l.maxUs = us;
+  }
+}
+
+uint32_t percentile(Latency &l, int p)
+{
+  uint32_t target = (l.count * p + 99) / 100;
+  uint32_t seen = 0;
+
+  for (int b = 0; b < 24; b++) {
+    seen += l.buckets[b];
+    if (seen >= target) {
+      return 1UL << b;
+    }
+  }
+  return 1UL << 23;
+}
+
+void report(const char *name, size_t chunk, Latency &l, bool ok)
+{
+  Serial.print(name);
+  Serial.print(" bytes=");
+  Serial.print(chunk);
+  Serial.print(" MB/s=");
+  Serial.print(l.count * chunk / l.totalUs, 3);
+  Serial.print(" avg_us=");
+  Serial.print(l.totalUs / l.count, 1);
+  Serial.print(" p99_us<");
+  Serial.print(percentile(l, 99));
+  Serial.print(" max_us=");
+  Serial.print(l.maxUs, 1);
+  Serial.println(ok ? "" : " (error)");
+}
+
+// time one call, in microseconds
+#define TIMED(l, ok, call) do { \
+    uint32_t start = Timestamp_get32(); \
+    ok = (call) == NVS_STATUS_SUCCESS && ok; \
+    add(l, (Timestamp_get32() - start) / ticksPerUs); \
+  } while (0)
+
+void benchmark(uint_least8_t index)
+{
+  NVS_Handle nvs;
+  NVS_Attrs attrs;
+  size_t base;
+  size_t sectorSize;
+  Latency l;
+  bool ok;
+
+  nvs = NVS_open(index, NULL);
+  if (nvs == NULL) {
+    Serial.print("NVS region ");
+    Serial.print(index);
+    Serial.println(" not available");
+    return;
+  }
+
+  NVS_getAttrs(nvs, &attrs);
+  sectorSize = attrs.sectorSize;
+  if (sectorSize > MAX_CHUNK || attrs.regionSize < TEST_SECTORS * sectorSize) {
+    Serial.println("region too small");
+    NVS_close(nvs);
+    return;
+  }
+  base = attrs.regionSize - TEST_SECTORS * sectorSize;
+
+  Serial.print("NVS region ");
+  Serial.print(index);
+  Serial.print(", ");
+  Serial.print(attrs.regionSize / 1024);
+  Serial.print(" KB, ");
+  Serial.print(sectorSize);
+  Serial.println(" byte sectors");
+
+  for (size_t chunk = 16; chunk <= sectorSize; chunk *= 16) {
+    reset(l);
+    ok = true;
+    for (size_t s = 0; s < TEST_SECTORS; s++) {
+      TIMED(l, ok, NVS_erase(nvs, base + s * sectorSize, sectorSize));
+    }
+    report("erase  ", sectorSize, l, ok);
+
+    reset(l);
+    ok = true;
+    for (size_t n = 0; n < TEST_SECTORS * sectorSize; n += chunk) {
+      TIMED(l, ok, NVS_write(nvs, base + n, buf, chunk, 0));
+    }
+    report("program", chunk, l, ok);
+
+    reset(l);
+    ok = true;
+    for (size_t n = 0; n < TEST_SECTORS * sectorSize; n += chunk) {
+      TIMED(l, ok, NVS_read(nvs, base + n, buf, chunk));
+    }
+    report("read   ", chunk, l, ok);
+  }
+  Serial.println();
+
+  NVS_close(nvs);
+}
+
+void setup()
+{
+  Types_FreqHz freq;
+
+  Serial.begin(115200);
+  delay(1000);
+
+  Timestamp_getFreq(&freq);
+  ticksPerUs = freq.lo / 1000000.0;
+
+  for (int i = 0; i < MAX_CHUNK; i++) {
+    buf[i] = (uint8_t)(i * 13 + 5);
+  }
+
+  NVS_init();
+}
+
+void loop()
+{
+  benchmark(0);
+  benchmark(1);
+
+  delay(10000);
+}
@@ -0,0 +1,650 @@
+/*
+ * FlashStore.cpp - log-structured key-value store on the internal flash
+ *
+ * Every sector in use starts with a header holding a sequence number;
+ * they form a ring from the oldest (tail) to the newest (head), new
+ * sectors are opened after the head and the tail is the one compacted
+ * and erased. Offsets are from the start of the NVS region.
+ *
+ * One mutex covers the index and the flash: the compaction task moves
+ * records and erases sectors under it, so get() copies a value out
+ * under it too.
+ */
+
+#include "FlashStore.h"
+
+#include <string.h>
+
+#include <xdc/runtime/Error.h>
+
+#define FLASHSTORE_MAGIC    0x3153564b      /* "KVS1" */
+
+/* index slot offsets that are not records */
+#define SLOT_EMPTY          0               /* a sector header */
+#define SLOT_DELETED        0xffffffff      /* reusable, keep probing */
+
+#define ALIGN(n)            (((n) + FLASHSTORE_ALIGN - 1) & \
+                                ~(FLASHSTORE_ALIGN - 1))
+#define RECORD_SIZE(rec)    ALIGN(sizeof(FlashRecord) + (rec)->keyLength + \
+                                (rec)->valueLength)
+
+struct SectorHeader {
+    uint32_t magic;
+    uint32_t sequence;
+    uint32_t reserved[2];
+};
+
+FlashStoreClass FlashStore;
+
+FlashStoreClass::FlashStoreClass(void)
+{
+    nvs = NULL;
+    compactor = NULL;
+}
+
+/*
+ *  ======== begin ========
+ *  Open the NVS region and replay the store into the index, formatting
+ *  it if there is none
+ */
+bool FlashStoreClass::begin(uint16_t sectors)
+{
+    Semaphore_Params semParams;
+    Task_Params taskParams;
+    NVS_Attrs attrs;
+    bool mounted;
+
+    if (nvs != NULL) {
+        return (true);
+    }
+
+    if (compactor == NULL) {
+        Semaphore_Params_init(&semParams);
+        semParams.mode = Semaphore_Mode_BINARY;
+        Semaphore_construct(&mutex, 1, &semParams);
+        Semaphore_construct(&compactSem, 0, &semParams);
+
+        Task_Params_init(&taskParams);
+        taskParams.arg0 = (UArg)this;
+        taskParams.stackSize = 768;
+        taskParams.priority = FLASHSTORE_PRIORITY;
+        taskParams.instance->name = (xdc_String)"flashstore";
+
+        compactor = Task_create(compactFxn, &taskParams, Error_IGNORE);
+        if (compactor == NULL) {
+            Semaphore_destruct(&compactSem);
+            Semaphore_destruct(&mutex);
+            return (false);
+        }
+    }
+
+    NVS_init();
+    nvs = NVS_open(0, NULL);
+    if (nvs == NULL) {
+        return (false);
+    }
+
+    NVS_getAttrs(nvs, &attrs);
+    if (attrs.regionBase == NVS_REGION_NOT_ADDRESSABLE || sectors < 2 ||
+        sectors * attrs.sectorSize > attrs.regionSize) {
+        end();
+        return (false);
+    }
+    base = (uint8_t *)attrs.regionBase;
+    sectorSize = attrs.sectorSize;
+    this->sectors = sectors;
+
+    lock();
+    mounted = mount();
+    unlock();
+
+    if (!mounted) {
+        end();
+        return (false);
+    }
+
+    return (true);
+}
+
+void FlashStoreClass::end(void)
+{
+    if (nvs != NULL) {
+        lock();
+        NVS_close(nvs);
+        nvs = NULL;
+        unlock();
+    }
+}
+
+/*
+ *  ======== put ========
+ *  Append a record with the new value; the same value again is not
+ *  written
+ */
+bool FlashStoreClass::put(const char *key, const void *value,
+    uint16_t length)
+{
+    size_t keyLength = strlen(key);
+    const FlashRecord *rec;
+    uint32_t offset;
+    Slot *slot;
+
+    if (nvs == NULL || keyLength == 0 || keyLength > FLASHSTORE_KEY_MAX ||
+        length > FLASHSTORE_VALUE_MAX) {
+        return (false);
+    }
+
+    lock();
+
+    slot = lookup(key, keyLength, true);
+    if (slot == NULL) {
+        unlock();
+        return (false);
+    }
+
+    if (slot->offset != SLOT_EMPTY && slot->offset != SLOT_DELETED) {
+        rec = record(slot->offset);
+        if (!(rec->flags & FLASHRECORD_DELETED) &&
+            rec->valueLength == length &&
+            memcmp((const uint8_t *)(rec + 1) + keyLength, value,
+                length) == 0) {
+            unlock();
+            return (true);
+        }
+    }
+
+    offset = append(key, keyLength, 0, value, length);
+    if (offset != 0) {
+        /*
+         * append() may have compacted, moving the old record: it is
+         * found again. Deletion records are counted when written.
+         */
+        if (slot->offset != SLOT_EMPTY && slot->offset != SLOT_DELETED &&
+            !(record(slot->offset)->flags & FLASHRECORD_DELETED)) {
+            deadBytes += RECORD_SIZE(record(slot->offset));
+        }
+        slot->offset = offset;
+    }
+
+    unlock();
+
+    return (offset != 0);
+}
+
+/*
+ *  ======== get ========
+ *  Copy up to length bytes of the value; returns the length of the
+ *  stored value, or -1 if there is none
+ */
+int FlashStoreClass::get(const char *key, void *value, uint16_t length)
+{
+    size_t keyLength = strlen(key);
+    const FlashRecord *rec;
+    Slot *slot;
+    int stored = -1;
+
+    if (nvs == NULL || keyLength == 0 || keyLength > FLASHSTORE_KEY_MAX) {
+        return (-1);
+    }
+
+    lock();
+
+    slot = lookup(key, keyLength, false);
+    if (slot != NULL) {
+        rec = record(slot->offset);
+        if (!(rec->flags & FLASHRECORD_DELETED)) {
+            stored = rec->valueLength;
+            if (value != NULL) {
+                memcpy(value, (const uint8_t *)(rec + 1) + keyLength,
+                    length < stored ? length : stored);
+            }
+        }
+    }
+
+    unlock();
+
+    return (stored);
+}
+
+/*
+ *  ======== remove ========
+ *  Append a deletion record; false if there was no such key
+ */
+bool FlashStoreClass::remove(const char *key)
+{
+    size_t keyLength = strlen(key);
+    uint32_t offset = 0;
+    uint32_t size;
+    Slot *slot;
+
+    if (nvs == NULL || keyLength == 0 || keyLength > FLASHSTORE_KEY_MAX) {
+        return (false);
+    }
+
+    lock();
+
+    slot = lookup(key, keyLength, false);
+    if (slot != NULL && !(record(slot->offset)->flags & FLASHRECORD_DELETED)) {
+        offset = append(key, keyLength, FLASHRECORD_DELETED, NULL, 0);
+        if (offset != 0) {
+            /* both are garbage once compaction reaches them */
+            size = RECORD_SIZE(record(slot->offset));
+            deadBytes += size + RECORD_SIZE(record(offset));
+            slot->offset = offset;
+        }
+    }
+
+    unlock();
+
+    return (offset != 0);
+}
+
+bool FlashStoreClass::exists(const char *key)
+{
+    return (get(key, NULL, 0) >= 0);
+}
+
+/*
+ *  ======== compactFxn ========
+ *  Compact the tail until a sector besides the spare is free again,
+ *  giving up once compacting frees nothing
+ */
+void FlashStoreClass::compactFxn(UArg arg0, UArg arg1)
+{
+    FlashStoreClass *store = (FlashStoreClass *)arg0;
+    uint16_t used;
+
+    for (;;) {
+        Semaphore_pend(Semaphore_handle(&store->compactSem),
+            BIOS_WAIT_FOREVER);
+
+        store->lock();
+        while (store->nvs != NULL && store->sectors - store->used <= 1 &&
+            store->deadBytes != 0) {
+            used = store->used;
+            if (!store->compact() || store->used >= used) {
+                break;
+            }
+        }
+        store->unlock();
+    }
+}
+
+/*
+ *  ======== hashKey ========
+ *  16 bit FNV-1a
+ */
+uint16_t FlashStoreClass::hashKey(const char *key, uint8_t length)
+{
+    uint32_t hash = 2166136261u;
+
+    while (length--) {
+        hash ^= (uint8_t)*key++;
+        hash *= 16777619u;
+    }
+
+    return ((uint16_t)(hash ^ (hash >> 16)));
+}
+
+/*
+ *  ======== crc16 ========
+ *  CRC-16-CCITT
+ */
+uint16_t FlashStoreClass::crc16(uint16_t crc, const uint8_t *data,
+    size_t length)
+{
+    uint8_t bit;
+
+    while (length--) {
+        crc ^= (uint16_t)*data++ << 8;
+        for (bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+
+    return (crc);
+}
+
+const FlashRecord *FlashStoreClass::record(uint32_t offset)
+{
+    return ((const FlashRecord *)(base + offset));
+}
+
+/*
+ *  ======== valid ========
+ *  Whether a complete record with a good CRC is at rec, within room
+ *  bytes of the end of its sector
+ */
+bool FlashStoreClass::valid(const FlashRecord *rec, uint32_t room)
+{
+    if (room < sizeof(FlashRecord) || rec->keyLength == 0 ||
+        rec->keyLength > FLASHSTORE_KEY_MAX ||
+        rec->valueLength > FLASHSTORE_VALUE_MAX ||
+        RECORD_SIZE(rec) > room) {
+        return (false);
+    }
+
+    return (crc16(0xffff, (const uint8_t *)rec + sizeof(rec->crc),
+        sizeof(FlashRecord) - sizeof(rec->crc) + rec->keyLength +
+        rec->valueLength) == rec->crc);
+}
+
+/*
+ *  ======== lookup ========
+ *  The key's index slot, by linear probing. With insert, an unused
+ *  slot for a key not in the index; NULL if the index is full.
+ */
+FlashStoreClass::Slot *FlashStoreClass::lookup(const char *key,
+    uint8_t length, bool insert)
+{
+    uint16_t hash = hashKey(key, length);
+    const FlashRecord *rec;
+    Slot *reuse = NULL;
+    Slot *slot;
+    uint16_t i;
+    uint16_t n;
+
+    i = hash % FLASHSTORE_KEYS;
+    for (n = 0; n < FLASHSTORE_KEYS; n++, i = (i + 1) % FLASHSTORE_KEYS) {
+        slot = &index[i];
+        if (slot->offset == SLOT_EMPTY) {
+            if (reuse == NULL) {
+                reuse = slot;
+            }
+            break;
+        }
+        if (slot->offset == SLOT_DELETED) {
+            if (reuse == NULL) {
+                reuse = slot;
+            }
+            continue;
+        }
+        if (slot->hash == hash) {
+            rec = record(slot->offset);
+            if (rec->keyLength == length &&
+                memcmp(rec + 1, key, length) == 0) {
+                return (slot);
+            }
+        }
+    }
+
+    if (!insert || reuse == NULL) {
+        return (NULL);
+    }
+    reuse->hash = hash;
+
+    return (reuse);
+}
+
+/*
+ *  ======== append ========
+ *  Write a record at the head, opening a sector or compacting for
+ *  room. Returns its offset, or 0 if the store is full or the write
+ *  failed.
+ */
+uint32_t FlashStoreClass::append(const char *key, uint8_t keyLength,
+    uint8_t flags, const void *value, uint16_t length)
+{
+    FlashRecord *rec = (FlashRecord *)buffer;
+    uint32_t offset;
+    uint32_t size;
+    uint16_t tries;
+
+    size = ALIGN(sizeof(FlashRecord) + keyLength + length);
+
+    for (tries = 0; headOffset + size > sectorSize; tries++) {
+        if (tries > sectors) {
+            return (0);
+        }
+
+        /* the spare sector is for compaction to copy into */
+        if (used < sectors && (sectors - used > 1 || compacting)) {
+            if (!openSector()) {
+                return (0);
+            }
+        }
+        else if (compacting || deadBytes == 0 || !compact()) {
+            return (0);
+        }
+    }
+
+    /* value may be in flash, in the sector being compacted */
+    memset(buffer, 0xff, size);
+    rec->keyLength = keyLength;
+    rec->flags = flags;
+    rec->valueLength = length;
+    memcpy(rec + 1, key, keyLength);
+    if (length != 0) {
+        memcpy((uint8_t *)(rec + 1) + keyLength, value, length);
+    }
+    rec->crc = crc16(0xffff, buffer + sizeof(rec->crc),
+        sizeof(FlashRecord) - sizeof(rec->crc) + keyLength + length);
+
+    offset = head * sectorSize + headOffset;
+    if (NVS_write(nvs, offset, buffer, size, NVS_WRITE_POST_VERIFY) !=
+        NVS_STATUS_SUCCESS) {
+        /* begin() stops at what is there now: so does the head */
+        headOffset = sectorSize;
+        return (0);
+    }
+    headOffset += size;
+
+    if (sectors - used <= 1 && !compacting) {
+        Semaphore_post(Semaphore_handle(&compactSem));
+    }
+
+    return (offset);
+}
+
+/*
+ *  ======== openSector ========
+ *  Start the erased sector after the head
+ */
+bool FlashStoreClass::openSector(void)
+{
+    SectorHeader header;
+    uint16_t next = (head + 1) % sectors;
+
+    header.magic = FLASHSTORE_MAGIC;
+    header.sequence = sequence + 1;
+    header.reserved[0] = header.reserved[1] = 0xffffffff;
+
+    if (NVS_write(nvs, next * sectorSize, &header, sizeof(header),
+        NVS_WRITE_POST_VERIFY) != NVS_STATUS_SUCCESS) {
+        return (false);
+    }
+
+    head = next;
+    sequence++;
+    used++;
+    headOffset = sizeof(SectorHeader);
+
+    return (true);
+}
+
+/*
+ *  ======== compact ========
+ *  Copy the tail's current records to the head, drop its deletion
+ *  records (nothing older is left for them to hide) and erase it
+ */
+bool FlashStoreClass::compact(void)
+{
+    const FlashRecord *rec;
+    const char *key;
+    uint32_t start;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t moved;
+    Slot *slot;
+    bool copied = true;
+
+    if (used <= 1) {
+        return (false);
+    }
+
+    compacting = true;
+
+    start = tail * sectorSize;
+    for (offset = sizeof(SectorHeader); copied; offset += size) {
+        rec = record(start + offset);
+        if (!valid(rec, sectorSize - offset)) {
+            break;
+        }
+        size = RECORD_SIZE(rec);
+        key = (const char *)(rec + 1);
+
+        slot = lookup(key, rec->keyLength, false);
+        if (slot == NULL || slot->offset != start + offset) {
+            deadBytes -= deadBytes < size ? deadBytes : size;
+        }
+        else if (rec->flags & FLASHRECORD_DELETED) {
+            deadBytes -= deadBytes < size ? deadBytes : size;
+            slot->offset = SLOT_DELETED;
+        }
+        else {
+            moved = append(key, rec->keyLength, rec->flags,
+                key + rec->keyLength, rec->valueLength);
+            if (moved == 0) {
+                copied = false;
+            }
+            else {
+                slot->offset = moved;
+            }
+        }
+    }
+
+    compacting = false;
+
+    if (!copied || NVS_erase(nvs, start, sectorSize) != NVS_STATUS_SUCCESS) {
+        return (false);
+    }
+
+    tail = (tail + 1) % sectors;
+    used--;
+
+    return (true);
+}
+
+/*
+ *  ======== mount ========
+ *  Find the ring of sectors in use, erase any others that are not
+ *  blank and replay the records into the index
+ */
+bool FlashStoreClass::mount(void)
+{
+    const SectorHeader *header;
+    const FlashRecord *rec;
+    const uint32_t *word;
+    uint32_t lowest = 0;
+    uint32_t start;
+    uint32_t offset;
+    uint32_t size;
+    uint16_t count = 0;
+    uint16_t s;
+    uint16_t i;
+    Slot *slot;
+
+    memset(index, 0, sizeof(index));
+    deadBytes = 0;
+    compacting = false;
+
+    for (s = 0; s < sectors; s++) {
+        header = (const SectorHeader *)(base + s * sectorSize);
+        if (header->magic != FLASHSTORE_MAGIC) {
+            continue;
+        }
+        if (count == 0 || (int32_t)(header->sequence - sequence) > 0) {
+            head = s;
+            sequence = header->sequence;
+        }
+        if (count == 0 || (int32_t)(header->sequence - lowest) < 0) {
+            tail = s;
+            lowest = header->sequence;
+        }
+        count++;
+    }
+
+    if (count == 0) {
+        head = sectors - 1;
+        tail = 0;
+        used = 0;
+        sequence = 0;
+    }
+    else {
+        used = (head + sectors - tail) % sectors + 1;
+    }
+
+    /* outside the ring: left by a reset during an erase, or not ours */
+    for (i = used; i < sectors; i++) {
+        s = (tail + i) % sectors;
+        word = (const uint32_t *)(base + s * sectorSize);
+        for (offset = 0; offset < sectorSize; offset += sizeof(*word)) {
+            if (*word++ != 0xffffffff) {
+                if (NVS_erase(nvs, s * sectorSize, sectorSize) !=
+                    NVS_STATUS_SUCCESS) {
+                    return (false);
+                }
+                break;
+            }
+        }
+    }
+
+    if (used == 0) {
+        return (openSector());
+    }
+
+    for (i = 0; i < used; i++) {
+        s = (tail + i) % sectors;
+        start = s * sectorSize;
+
+        for (offset = sizeof(SectorHeader); ; offset += size) {
+            rec = record(start + offset);
+            if (!valid(rec, sectorSize - offset)) {
+                break;
+            }
+            size = RECORD_SIZE(rec);
+
+            slot = lookup((const char *)(rec + 1), rec->keyLength, true);
+            if (slot == NULL) {
+                continue;
+            }
+            if (slot->offset != SLOT_EMPTY && slot->offset != SLOT_DELETED &&
+                !(record(slot->offset)->flags & FLASHRECORD_DELETED)) {
+                deadBytes += RECORD_SIZE(record(slot->offset));
+            }
+            if (rec->flags & FLASHRECORD_DELETED) {
+                deadBytes += size;
+            }
+            slot->offset = start + offset;
+        }
+
+        if (s == head) {
+            /* a torn record ends the head: start the next sector */
+            headOffset = offset;
+            word = (const uint32_t *)(base + start + offset);
+            for (size = 0; size < FLASHSTORE_ALIGN &&
+                offset + size < sectorSize; size += sizeof(*word)) {
+                if (*word++ != 0xffffffff) {
+                    headOffset = sectorSize;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (sectors - used <= 1) {
+        Semaphore_post(Semaphore_handle(&compactSem));
+    }
+
+    return (true);
+}
+
+void FlashStoreClass::lock(void)
+{
+    Semaphore_pend(Semaphore_handle(&mutex), BIOS_WAIT_FOREVER);
+}
+
+void FlashStoreClass::unlock(void)
+{
+    Semaphore_post(Semaphore_handle(&mutex));
+}
@@ -0,0 +1,134 @@
+/*
+ * FlashStore.h - log-structured key-value store on the internal flash
+ *
+ *      FlashStore.begin();
+ *      boots = FlashStore.getUInt("boots") + 1;
+ *      FlashStore.putUInt("boots", boots);    // one small flash write
+ *
+ * The store keeps FLASHSTORE_SECTORS erase sectors at the start of the
+ * NVS region (the flash the sketch does not use) as a ring. put()
+ * appends a record holding the key and the new value to the newest
+ * sector, so an update programs a few words of flash instead of
+ * erasing and rewriting a sector; remove() appends a deletion record.
+ * begin() replays the sectors oldest first into a RAM index of
+ * FLASHSTORE_KEYS keys, and get() goes through the index straight to
+ * the value in flash.
+ *
+ * Once only the spare sector is left free, the compaction task copies
+ * the records still current in the oldest sector to the newest and
+ * erases it, which frees it and moves every sector along the ring in
+ * turn, spreading the erases evenly. If the task does not get to run
+ * (it is at FLASHSTORE_PRIORITY, the sketch's priority) a put() that
+ * finds no room compacts itself.
+ *
+ * Records carry a CRC: one torn by a reset while being written is
+ * skipped at begin(), leaving the key at its previous value.
+ */
+
+#ifndef FlashStore_h
+#define FlashStore_h
+
+#include <Energia.h>
+
+#include <ti/drivers/NVS.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/knl/Task.h>
+
+/* erase sectors of the store, one of them kept free for compaction */
+#ifndef FLASHSTORE_SECTORS
+#define FLASHSTORE_SECTORS      4
+#endif
+
+/* keys the index holds */
+#ifndef FLASHSTORE_KEYS
+#define FLASHSTORE_KEYS         64
+#endif
+
+/* compaction task priority */
+#ifndef FLASHSTORE_PRIORITY
+#define FLASHSTORE_PRIORITY     1
+#endif
+
+#define FLASHSTORE_KEY_MAX      15
+#define FLASHSTORE_VALUE_MAX    256
+
+/* flash is programmed in 128 bit words, each once between erases */
+#define FLASHSTORE_ALIGN        16
+
+struct FlashRecord {
+    uint16_t crc;               /* of the rest of the record */
+    uint8_t keyLength;          /* 0xff: erased, the end of the sector */
+    uint8_t flags;
+    uint16_t valueLength;
+    uint16_t reserved;
+    /* key, then value */
+};
+
+#define FLASHRECORD_DELETED     0x01
+
+class FlashStoreClass
+{
+    public:
+        FlashStoreClass(void);
+
+        bool begin(uint16_t sectors = FLASHSTORE_SECTORS);
+        void end(void);
+
+        bool put(const char *key, const void *value, uint16_t length);
+        int get(const char *key, void *value, uint16_t length);
+        bool remove(const char *key);
+        bool exists(const char *key);
+
+        bool putUInt(const char *key, uint32_t value) {
+            return (put(key, &value, sizeof(value)));
+        }
+        uint32_t getUInt(const char *key, uint32_t defaultValue = 0) {
+            uint32_t value;
+            return (get(key, &value, sizeof(value)) == sizeof(value) ?
+                value : defaultValue);
+        }
+
+    private:
+        struct Slot {
+            uint16_t hash;
+            uint32_t offset;        /* of the key's newest record */
+        };
+
+        static void compactFxn(UArg arg0, UArg arg1);
+        static uint16_t hashKey(const char *key, uint8_t length);
+        static uint16_t crc16(uint16_t crc, const uint8_t *data,
+            size_t length);
+
+        const FlashRecord *record(uint32_t offset);
+        bool valid(const FlashRecord *rec, uint32_t room);
+        Slot *lookup(const char *key, uint8_t length, bool insert);
+        uint32_t append(const char *key, uint8_t keyLength, uint8_t flags,
+            const void *value, uint16_t length);
+        bool openSector(void);
+        bool compact(void);
+        bool mount(void);
+        void lock(void);
+        void unlock(void);
+
+        NVS_Handle nvs;
+        uint8_t *base;              /* of the region, memory mapped */
+        uint32_t sectorSize;
+        uint16_t sectors;
+        uint16_t tail;              /* oldest sector in use */
+        uint16_t head;              /* sector being appended to */
+        uint16_t used;              /* sectors in use, tail to head */
+        uint32_t headOffset;        /* next record in the head sector */
+        uint32_t sequence;          /* of the head sector */
+        uint32_t deadBytes;         /* in superseded and deletion records */
+        bool compacting;
+        Slot index[FLASHSTORE_KEYS];
+        uint8_t buffer[sizeof(FlashRecord) + FLASHSTORE_KEY_MAX +
+            FLASHSTORE_VALUE_MAX + FLASHSTORE_ALIGN];
+        Semaphore_Struct mutex;
+        Semaphore_Struct compactSem;
+        Task_Handle compactor;
+};
+
+extern FlashStoreClass FlashStore;
+
+#endif
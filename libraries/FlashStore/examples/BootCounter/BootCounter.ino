@@ -0,0 +1,38 @@
+/*
+  Boot counter
+
+  Counts resets in the internal flash and keeps the last value of A0
+  read before each one. Each update appends a small record to the
+  FlashStore log instead of erasing a flash sector, so the sketch can
+  save every second for years.
+
+  This example code is in the public domain.
+*/
+
+#include <FlashStore.h>
+
+void setup()
+{
+  uint32_t boots;
+
+  Serial.begin(115200);
+
+  if (!FlashStore.begin()) {
+    Serial.println("no flash for the store");
+    for (;;);
+  }
+
+  boots = FlashStore.getUInt("boots") + 1;
+  FlashStore.putUInt("boots", boots);
+
+  Serial.print("boot ");
+  Serial.print(boots);
+  Serial.print(", A0 was ");
+  Serial.println(FlashStore.getUInt("a0"));
+}
+
+void loop()
+{
+  FlashStore.putUInt("a0", analogRead(A0));
+  delay(1000);
+}
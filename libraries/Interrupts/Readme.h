@@ -0,0 +1,5 @@
+/*
+ * This file is here to prevent the IDE complaining about this library being invalid.
+ * The attachInterrupt implementation for all EMT targets is common and hence live in
+ * cores/msp432/ti/runtime/wiring/
+ */
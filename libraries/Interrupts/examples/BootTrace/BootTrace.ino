@@ -0,0 +1,41 @@
+/*
+  Boot Trace
+
+  Prints how long each boot stage took, from Board_init() to the first
+  line of setup() and through the driver inits setup() triggers. Only
+  GPIO and Power are set up at boot; PWM, ADC, UART, SPI and I2C are
+  initialized when a sketch first uses them.
+
+  Put bootTraceMark() calls of your own in setup() to see where a
+  sensor node spends its time before it gets to work.
+
+  This example code is in the public domain.
+*/
+
+void setup()
+{
+  BootTraceStage stages[BOOT_TRACE_STAGES];
+  uint8_t count;
+
+  bootTraceMark("setup");
+
+  Serial.begin(115200);
+  bootTraceMark("Serial.begin");
+
+  analogRead(A0);
+  analogWrite(19, 128);
+  bootTraceMark("analog");
+
+  delay(1000);
+
+  count = bootTraceGet(stages, BOOT_TRACE_STAGES);
+  for (uint8_t i = 0; i < count; i++) {
+    Serial.print(stages[i].us);
+    Serial.print("us\t");
+    Serial.println(stages[i].name);
+  }
+}
+
+void loop()
+{
+}
@@ -0,0 +1,52 @@
+/*
+  Deferred Log
+
+  Logs from an interrupt handler without printing in it: logPrintf()
+  only queues the format and its arguments, and the core's log task
+  formats them and writes them to Serial when nothing more urgent
+  runs. Each press of PUSH1 logs the press count and the time since
+  the last one; every second loop() logs what a logPrintf() call cost
+  in cycles, and how many records were lost to a full ring.
+
+  Formats and %s strings must be constants, and arguments integers:
+  the formatting happens later, in the log task.
+
+  This example code is in the public domain.
+*/
+
+LogRecord ring[64];
+
+volatile uint32_t presses;
+volatile uint32_t lastPress;
+
+void pressed(void)
+{
+  uint32_t now = millis();
+
+  presses++;
+  logPrintf("press %lu, %lu ms since the last\n", presses, now - lastPress);
+  lastPress = now;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  cyclesEnable();
+  logBegin(ring, 64, Serial);
+
+  pinMode(PUSH1, INPUT_PULLUP);
+  attachInterrupt(PUSH1, pressed, FALLING);
+}
+
+void loop()
+{
+  uint32_t start, cost;
+
+  start = cycles();
+  logPrintf("tick at %lu ms, %s\n", millis(), "all well");
+  cost = cycles() - start;
+
+  logPrintf("that logPrintf() took %lu cycles, %lu dropped\n", cost,
+    logDropped());
+  delay(1000);
+}
@@ -0,0 +1,68 @@
+/*
+  Edge Logger
+
+  Logs every press and release of PUSH1 and PUSH2 with the time of
+  the edge, taken in the port interrupt, and prints the log from
+  loop(). Nothing is printed from the interrupt; loop() can fall
+  behind for up to RING_SIZE edges before any are dropped.
+
+  Bounce shows up as bursts of edges microseconds apart.
+
+  This example code is in the public domain.
+*/
+
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
+
+#define RING_SIZE 256   // power of 2
+
+EdgeLogRecord ring[RING_SIZE];
+EdgeLogRecord batch[16];
+
+float ticksPerUs;
+uint32_t lastTime;
+uint32_t lastDropped;
+
+void setup()
+{
+  Types_FreqHz freq;
+
+  Serial.begin(115200);
+
+  Timestamp_getFreq(&freq);
+  ticksPerUs = freq.lo / 1000000.0;
+
+  pinMode(PUSH1, INPUT_PULLUP);
+  pinMode(PUSH2, INPUT_PULLUP);
+
+  edgeLogBegin(ring, RING_SIZE);
+  edgeLogPin(PUSH1, CHANGE);
+  edgeLogPin(PUSH2, CHANGE);
+
+  lastTime = Timestamp_get32();
+}
+
+void loop()
+{
+  unsigned int n = edgeLogRead(batch, 16);
+
+  for (unsigned int i = 0; i < n; i++) {
+    Serial.print("pin ");
+    Serial.print(batch[i].pin);
+    Serial.print(batch[i].level ? " high" : " low ");
+    Serial.print(" +");
+    Serial.print((unsigned long)((batch[i].time - lastTime) / ticksPerUs));
+    Serial.println(" us");
+    lastTime = batch[i].time;
+  }
+
+  if (edgeLogDropped() != lastDropped) {
+    lastDropped = edgeLogDropped();
+    Serial.print("dropped ");
+    Serial.println(lastDropped);
+  }
+
+  if (n == 0) {
+    delay(10);
+  }
+}
@@ -0,0 +1,42 @@
+/*
+  Encoder
+
+  Reads an incremental encoder with QuadratureEncoder: the A/B edges
+  are counted in the port interrupts, four per encoder cycle, and
+  loop() only prints the position and speed ten times a second. A and
+  B are on different ports so both get the direct interrupt path.
+
+  Wire A to pin 11 (P3.6) and B to pin 12 (P5.2), common to GND; the
+  inputs get pull-ups.
+
+  This example code is in the public domain.
+*/
+
+#include <QuadratureEncoder.h>
+
+#define PIN_A           11
+#define PIN_B           12
+#define COUNTS_PER_REV  (100 * 4)   // 100 line encoder, X4
+
+QuadratureEncoder encoder;
+
+void setup()
+{
+  Serial.begin(115200);
+
+  if (!encoder.begin(PIN_A, PIN_B, QUADRATURE_X4)) {
+    Serial.println("encoder pins have no interrupts");
+  }
+}
+
+void loop()
+{
+  Serial.print("position ");
+  Serial.print(encoder.position());
+  Serial.print("  rpm ");
+  Serial.print(encoder.velocity() * 60 / COUNTS_PER_REV, 1);
+  Serial.print("  missed ");
+  Serial.println(encoder.errors());
+
+  delay(100);
+}
@@ -0,0 +1,47 @@
+/*
+  Event Loop
+
+  An event driven loop(): instead of running flat out to poll Serial
+  and the button, each pass says what the next one waits for, and the
+  task sleeps in between, so an idle board goes to sleep too. The loop
+  echoes what comes in on Serial, toggles the green LED on each press
+  of PUSH1 and blinks the red one about once a second.
+
+  This example code is in the public domain.
+*/
+
+#include <TaskAttrs.h>
+
+EVENT_LOOP(loop, 0, 0);
+
+unsigned long lastBlink;
+
+void setup()
+{
+  Serial.begin(115200);
+  pinMode(PUSH1, INPUT_PULLUP);
+  pinMode(RED_LED, OUTPUT);
+  pinMode(GREEN_LED, OUTPUT);
+}
+
+void loop()
+{
+  uint32_t woke = loopEvents();
+
+  while (Serial.available()) {
+    Serial.write(Serial.read());
+  }
+
+  if (woke & LOOP_EVENT_PIN) {
+    digitalWrite(GREEN_LED, !digitalRead(GREEN_LED));
+  }
+
+  if (millis() - lastBlink >= 1000) {
+    lastBlink = millis();
+    digitalWrite(RED_LED, !digitalRead(RED_LED));
+  }
+
+  loopWaitSerial(Serial);
+  loopWaitPin(PUSH1, FALLING);
+  loopWaitMs(1000 - (millis() - lastBlink));
+}
@@ -0,0 +1,117 @@
+/*
+  Interrupt Latency
+
+  Measures the time from a pin edge to the first line of the handler
+  for the three ways of attaching one:
+
+    plain   attachInterrupt(), through the GPIO driver's port Hwi
+    arg     attachInterruptArg(), the same plus the context argument
+    direct  attachInterruptDirect(), the port Hwi calls the handler
+
+  The sketch raises an output with digitalWriteFast(), takes
+  Timestamp_get32() right before, and the handler takes it again;
+  min/avg/max over SAMPLES edges are printed in CPU cycles.
+
+  Hardware: connect pin 11 (P3.6) to pin 12 (P5.2).
+
+  This example code is in the public domain.
+*/
+
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
+#include <ti/sysbios/BIOS.h>
+
+#define OUT_PIN  11
+#define IN_PIN   12
+#define SAMPLES  1000
+
+volatile uint32_t edgeTime;
+volatile bool fired;
+
+float cyclesPerTick;
+
+void plainHandler(void)
+{
+  edgeTime = Timestamp_get32();
+  fired = true;
+}
+
+void argHandler(void *arg)
+{
+  edgeTime = Timestamp_get32();
+  *(volatile bool *)arg = true;
+}
+
+void measure(const char *name)
+{
+  uint32_t minT = 0xffffffff, maxT = 0;
+  uint64_t total = 0;
+
+  for (int i = 0; i < SAMPLES; i++) {
+    uint32_t start, t;
+
+    digitalWriteFast(OUT_PIN, LOW);
+    delayMicroseconds(20);
+    fired = false;
+
+    start = Timestamp_get32();
+    digitalWriteFast(OUT_PIN, HIGH);
+    while (!fired) {
+      ;
+    }
+
+    t = edgeTime - start;
+    total += t;
+    if (t < minT) {
+      minT = t;
+    }
+    if (t > maxT) {
+      maxT = t;
+    }
+  }
+  detachInterrupt(IN_PIN);
+
+  Serial.print(name);
+  Serial.print(" min=");
+  Serial.print((unsigned long)(minT * cyclesPerTick));
+  Serial.print(" avg=");
+  Serial.print((unsigned long)(total * cyclesPerTick / SAMPLES));
+  Serial.print(" max=");
+  Serial.print((unsigned long)(maxT * cyclesPerTick));
+  Serial.println(" cycles");
+}
+
+void setup()
+{
+  Types_FreqHz tsFreq, cpuFreq;
+
+  Serial.begin(115200);
+  delay(1000);
+
+  Timestamp_getFreq(&tsFreq);
+  BIOS_getCpuFreq(&cpuFreq);
+  cyclesPerTick = (float)cpuFreq.lo / tsFreq.lo;
+
+  pinMode(OUT_PIN, OUTPUT);
+  digitalWrite(OUT_PIN, LOW);
+
+  Serial.print("Interrupt latency, CPU ");
+  Serial.print(cpuFreq.lo);
+  Serial.println(" Hz");
+}
+
+void loop()
+{
+  attachInterrupt(IN_PIN, plainHandler, RISING);
+  measure("plain ");
+
+  attachInterruptArg(IN_PIN, argHandler, (void *)&fired, RISING);
+  measure("arg   ");
+
+  if (attachInterruptDirect(IN_PIN, argHandler, (void *)&fired, RISING)) {
+    measure("direct");
+  }
+
+  Serial.println();
+  delay(5000);
+}
@@ -0,0 +1,96 @@
+/*
+  Logic Capture
+
+  Samples all eight pins of port 4 at 1 MS/s, from a press of PUSH1
+  until a press of PUSH2, and lists every change of the port with its
+  time in us. Timer_A and the uDMA take the samples; the CPU only
+  scans each full 512 sample block for changes, once every 512 us.
+
+  Up to MAX_EVENTS changes are kept; the first sample of a capture is
+  listed as a change from 0. Pins of port 4 left unconnected float,
+  so tie them down or expect noise.
+
+  This example code is in the public domain.
+*/
+
+#include <PortCapture.h>
+
+#define PORT        4
+#define RATE        1000000
+#define SAMPLES     512
+#define MAX_EVENTS  64
+
+uint8_t buf0[SAMPLES], buf1[SAMPLES];
+PortCapture capture;
+
+volatile uint32_t eventTimes[MAX_EVENTS];
+volatile uint8_t eventValues[MAX_EVENTS];
+volatile int events;
+volatile uint32_t sampleCount;
+uint8_t lastValue;
+
+// DMA Hwi for full blocks, the calling task for flush()
+void gotBlock(const uint8_t *block, uint16_t count, void *arg)
+{
+  for (uint16_t i = 0; i < count; i++) {
+    if (block[i] != lastValue && events < MAX_EVENTS) {
+      eventTimes[events] = sampleCount + i;
+      eventValues[events] = block[i];
+      events++;
+    }
+    lastValue = block[i];
+  }
+  sampleCount += count;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  pinMode(PUSH1, INPUT_PULLUP);
+  pinMode(PUSH2, INPUT_PULLUP);
+
+  for (unsigned pin = 0; pin < sizeof(digital_pin_to_port_pin) / 2; pin++) {
+    if (digitalPinToPort(pin) == PORT) {
+      pinMode(pin, INPUT);
+    }
+  }
+
+  if (!capture.begin(PORT, RATE, buf0, buf1, SAMPLES, gotBlock)) {
+    Serial.println("no timer or uDMA channel free");
+    while (1);
+  }
+  Serial.print("sampling port 4 at ");
+  Serial.print(capture.rate());
+  Serial.println(" samples/s, press PUSH1 to start");
+
+  capture.startOn(PUSH1, FALLING);
+}
+
+void loop()
+{
+  if (!capture.running()) {
+    delay(10);
+    return;
+  }
+
+  Serial.println("capturing, press PUSH2 to stop");
+  capture.stopOn(PUSH2, FALLING);
+  while (capture.running()) {
+    delay(10);
+  }
+  capture.flush();
+
+  Serial.print(sampleCount);
+  Serial.println(" samples");
+  for (int i = 0; i < events; i++) {
+    Serial.print(eventTimes[i] * 1000000.0 / capture.rate(), 1);
+    Serial.print(" us  0x");
+    Serial.println(eventValues[i], HEX);
+  }
+
+  events = 0;
+  sampleCount = 0;
+  lastValue = 0;
+  Serial.println("press PUSH1 to start again");
+  capture.startOn(PUSH1, FALLING);
+}
@@ -0,0 +1,73 @@
+/*
+  Micro Timers
+
+  Runs three software timers on the core's shared microsecond timer
+  service, none of which takes a Timer_A away from analogWrite():
+
+    blink   periodic 250 ms, toggles the red LED
+    square  periodic 50 us, toggles pin 11 (P3.6), a 10 kHz square
+            wave for a scope
+    probe   one-shot, re-armed with microTimerNext() each time so its
+            expiries stay on a 1 ms grid; records how late each one
+            ran (dispatch latency) in micros()
+
+  Once a second the worst probe latency is printed.
+
+  This example code is in the public domain.
+*/
+
+#define SQUARE_PIN 11
+
+MicroTimer blinkTimer, squareTimer, probeTimer;
+
+volatile uint64_t probeDue;
+volatile uint32_t worstLate;
+
+void blink(uintptr_t arg)
+{
+  digitalWrite(RED_LED, !digitalRead(RED_LED));
+}
+
+void square(uintptr_t arg)
+{
+  static bool level;
+
+  level = !level;
+  digitalWriteFast(SQUARE_PIN, level);
+}
+
+void probe(uintptr_t arg)
+{
+  uint32_t late = (uint32_t)(micros64() - probeDue);
+
+  if (late > worstLate) {
+    worstLate = late;
+  }
+
+  probeDue += 1000;
+  microTimerNext(&probeTimer, 1000);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+
+  pinMode(RED_LED, OUTPUT);
+  pinMode(SQUARE_PIN, OUTPUT);
+
+  microTimerStart(&blinkTimer, blink, 0, 250000, 250000);
+  microTimerStart(&squareTimer, square, 0, 50, 50);
+
+  probeDue = micros64() + 1000;
+  microTimerStart(&probeTimer, probe, 0, 1000, 0);
+}
+
+void loop()
+{
+  delay(1000);
+
+  Serial.print("worst probe latency: ");
+  Serial.print(worstLate);
+  Serial.println(" us");
+  worstLate = 0;
+}
@@ -0,0 +1,72 @@
+/*
+  Periodic Loop
+
+  Runs loop() at a fixed 10ms rate with PeriodicTask instead of a
+  delay() at its end, and prints once a second how far each release
+  was from its ideal time and how many releases were missed.
+
+  Every 5 seconds one pass takes 25ms on purpose: the releases it
+  sleeps through fold into one and count as overruns, and the passes
+  after it are back on the 10ms grid rather than shifted by the late
+  one.
+
+  A second sketch tab with its own PeriodicTask on 20ms, phase 5,
+  would run between every other pair of these releases.
+
+  This example code is in the public domain.
+*/
+
+#include <PeriodicTask.h>
+
+#define PERIOD_MS 10
+
+PeriodicTask control;
+
+unsigned long passes;
+unsigned long worstLateUs;
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+
+  control.begin(PERIOD_MS);
+}
+
+void loop()
+{
+  static unsigned long expected;
+  unsigned long now, late;
+
+  control.wait();
+  now = micros();
+
+  // the first release sets the grid
+  if (passes == 0) {
+    expected = now;
+  }
+  late = now - expected;
+  if (late < PERIOD_MS * 1000UL && late > worstLateUs) {
+    worstLateUs = late;
+  }
+  // next grid point after now, skipping releases an overrun folded
+  expected += late / (PERIOD_MS * 1000UL) * (PERIOD_MS * 1000UL)
+      + PERIOD_MS * 1000UL;
+  passes++;
+
+  // the control work would go here
+
+  if (passes % 500 == 0) {
+    delay(25);
+  }
+
+  if (passes % 100 == 0) {
+    Serial.print("releases=");
+    Serial.print(control.releases());
+    Serial.print(" overruns=");
+    Serial.print(control.overruns());
+    Serial.print(" worst late us=");
+    Serial.println(worstLateUs);
+    worstLateUs = 0;
+  }
+}
@@ -0,0 +1,69 @@
+/*
+  PID Control
+
+  Holds the voltage on A0 at a setpoint by driving a PWM output, with
+  the PID evaluated by a ControlLoop at an exact 1kHz instead of in
+  loop(). For a quick test, filter the PWM pin with an RC (10k, 10uF)
+  and feed it back to A0; the setpoint steps between 30% and 70% of
+  full scale every 2 seconds.
+
+  loop() only changes the setpoint and prints the input, output, the
+  longest Swi run and the number of overruns; a long delay() or a busy
+  task doesn't disturb the control.
+
+  Hardware: PWM on pin 39 (P2.6), RC filtered into A0.
+
+  This example code is in the public domain.
+*/
+
+#include <ControlLoop.h>
+
+#define PWM_PIN   39
+
+AnalogPin sensor;
+PwmChannel drive;
+PidController pid;
+ControlLoop control;
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+
+  analogPinBegin(&sensor, A0);
+  pwmChannelBegin(&drive, PWM_PIN);
+
+  pid.setGains(0.8, 20.0, 0);   // the RC is ~0.1s
+  pid.setLimits(0, 1);
+  pid.inputAnalog(&sensor);
+  pid.outputPwm(&drive);
+  pid.setSetpoint(0.3);
+
+  control.add(&pid);
+  if (!control.begin(1000)) {
+    Serial.println("control loop failed to start");
+  }
+}
+
+void loop()
+{
+  static unsigned long lastStep;
+
+  if (millis() - lastStep >= 2000) {
+    lastStep = millis();
+    pid.setSetpoint(pid.getSetpoint() < 0.5 ? 0.7 : 0.3);
+  }
+
+  Serial.print("setpoint ");
+  Serial.print(pid.getSetpoint(), 2);
+  Serial.print(" input ");
+  Serial.print(pid.input(), 3);
+  Serial.print(" output ");
+  Serial.print(pid.output(), 3);
+  Serial.print(" max_us ");
+  Serial.print(control.maxMicros());
+  Serial.print(" overruns ");
+  Serial.println(control.overruns());
+
+  delay(200);
+}
@@ -0,0 +1,91 @@
+/*
+  Power Profile
+
+  Shows where the board spends its time between loop() passes. Every
+  5 seconds it prints the share of time spent running and in each
+  idle state of the core's Power policy, and which interrupts ended
+  the sleeps:
+
+    WFI         clocks running, a driver disallows sleep
+    SLEEP       LPM0, peripherals clocked
+    DEEPSLEEP_0 LPM3, tickless, only the 32kHz clocks run
+
+  The sketch blinks the red LED and otherwise sleeps in delay(); it
+  only writes to Serial, so the receiver is left off, which on the
+  MSP432P401R is what lets the idle loop reach DEEPSLEEP_0. Press
+  S1 (P1.1) to add PORT1 wakeups. Interrupt numbers are the INT_xxx
+  values of driverlib/interrupt.h minus 16, e.g. 29 for INT_RTC_C (the
+  tickless idle's own wakeup) and 35 for INT_PORT1.
+
+  This example code is in the public domain.
+*/
+
+const char *stateNames[POWER_STATS_STATES] = {
+  "WFI        ", "SLEEP      ", "DEEPSLEEP_0"
+};
+
+void pressed(void)
+{
+}
+
+void printShare(const char *name, uint64_t us, uint64_t total)
+{
+  Serial.print(name);
+  Serial.print(" ");
+  Serial.print((float)us * 100 / total, 2);
+  Serial.println("%");
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.setRxOnDemand(true);
+  delay(1000);
+
+  pinMode(RED_LED, OUTPUT);
+  pinMode(PUSH1, INPUT_PULLUP);
+  attachInterrupt(PUSH1, pressed, FALLING);
+
+  powerStatsReset();
+}
+
+void loop()
+{
+  static unsigned long last;
+  PowerStats stats;
+  uint64_t idle = 0;
+
+  digitalWrite(RED_LED, HIGH);
+  delay(10);
+  digitalWrite(RED_LED, LOW);
+  delay(490);
+
+  if (millis() - last < 5000) {
+    return;
+  }
+  last = millis();
+
+  powerStatsGet(&stats);
+  powerStatsReset();
+
+  for (int i = 0; i < POWER_STATS_STATES; i++) {
+    idle += stats.stateUs[i];
+  }
+
+  printShare("running    ", stats.elapsedUs - idle, stats.elapsedUs);
+  for (int i = 0; i < POWER_STATS_STATES; i++) {
+    printShare(stateNames[i], stats.stateUs[i], stats.elapsedUs);
+  }
+
+  Serial.print("wakeups:");
+  for (int i = 0; i < POWER_STATS_IRQS; i++) {
+    if (stats.wakeups[i] != 0) {
+      Serial.print(" irq");
+      Serial.print(i);
+      Serial.print("=");
+      Serial.print(stats.wakeups[i]);
+    }
+  }
+  Serial.println();
+  Serial.println();
+}
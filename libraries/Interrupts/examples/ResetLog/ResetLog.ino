@@ -0,0 +1,69 @@
+/*
+  Reset Log
+
+  Keeps a record in NOINIT memory, which the startup code does not
+  zero: it survives a reset, button or software, and holds garbage
+  after power-up. A magic word tells the two apart. Each boot prints
+  how many resets there have been since power-up and how long the
+  sketch ran before the last one, then counts on; send any character
+  to reset the board.
+
+  This example code is in the public domain.
+*/
+
+#include <ti/devices/msp432p4xx/inc/msp.h>   // NVIC_SystemReset()
+
+#define LOG_MAGIC 0x52534c47  // "RSLG"
+
+struct ResetLog {
+  uint32_t magic;
+  uint32_t resets;
+  uint32_t lastUptime;        // millis() at the last update
+  uint32_t check;             // ~(resets ^ lastUptime)
+};
+
+NOINIT ResetLog resetLog;
+
+bool logValid()
+{
+  return resetLog.magic == LOG_MAGIC
+      && resetLog.check == ~(resetLog.resets ^ resetLog.lastUptime);
+}
+
+void logUpdate()
+{
+  resetLog.lastUptime = millis();
+  resetLog.check = ~(resetLog.resets ^ resetLog.lastUptime);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+
+  if (logValid()) {
+    resetLog.resets++;
+    Serial.print("reset ");
+    Serial.print(resetLog.resets);
+    Serial.print(" since power-up, ran ");
+    Serial.print(resetLog.lastUptime);
+    Serial.println(" ms before it");
+  }
+  else {
+    resetLog.magic = LOG_MAGIC;
+    resetLog.resets = 0;
+    Serial.println("power-up, no log");
+  }
+  logUpdate();
+}
+
+void loop()
+{
+  logUpdate();
+
+  if (Serial.available()) {
+    Serial.println("resetting");
+    Serial.flush();
+    NVIC_SystemReset();
+  }
+  delay(100);
+}
@@ -0,0 +1,82 @@
+/*
+  RTC Alarm
+
+  Keeps wall clock time in RTC_C, which runs from the 32768Hz crystal
+  in every idle state, prints it once a minute from a periodic RTC
+  event and blinks the red LED when the alarm minute comes.
+
+  Set the start time below; the alarm goes off two minutes later. In
+  between the board sleeps in waitAlarm(), mostly in deep sleep.
+
+  This example code is in the public domain.
+*/
+
+#include <RTC.h>
+
+RTCTime start = { 2017, 6, 1, 12, 0, 0 };
+
+volatile bool minutePassed;
+
+void everyMinute(void)
+{
+  minutePassed = true;
+}
+
+void printTime(void)
+{
+  RTCTime now;
+
+  RTC.getTime(&now);
+  Serial.print(now.year);
+  Serial.print("-");
+  Serial.print(now.month);
+  Serial.print("-");
+  Serial.print(now.day);
+  Serial.print(" ");
+  Serial.print(now.hour);
+  Serial.print(":");
+  if (now.minute < 10) Serial.print("0");
+  Serial.print(now.minute);
+  Serial.print(":");
+  if (now.second < 10) Serial.print("0");
+  Serial.print(now.second);
+  Serial.print("  epoch ");
+  Serial.println(RTC.getEpoch());
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+
+  pinMode(RED_LED, OUTPUT);
+
+  if (!RTC.begin()) {
+    Serial.println("no 32kHz crystal, running from REFO");
+  }
+  RTC.setTime(&start);
+  RTC.setAlarm(start.hour, start.minute + 2);
+  RTC.attachPeriodic(RTC_EVERY_MINUTE, everyMinute);
+
+  printTime();
+}
+
+void loop()
+{
+  // wakes once a minute for the periodic event as well
+  if (RTC.waitAlarm(60000)) {
+    Serial.print("alarm at ");
+    printTime();
+    for (int i = 0; i < 10; i++) {
+      digitalWrite(RED_LED, HIGH);
+      delay(100);
+      digitalWrite(RED_LED, LOW);
+      delay(100);
+    }
+  }
+
+  if (minutePassed) {
+    minutePassed = false;
+    printTime();
+  }
+}
@@ -0,0 +1,362 @@
+/*
+  RTOS Benchmark
+
+  Measures the kernel paths a sketch's timing depends on, in MCLK
+  cycles from cycles(), min/avg/max over SAMPLES runs each:
+
+    gpio       pin edge to the attachInterrupt() handler
+    hwi->swi   handler to a Swi it posts
+    swi->task  that Swi to a task pending on a Semaphore it posts
+    sem wake   Semaphore_post() to the higher priority task it wakes
+    sem pair   Semaphore_post() + Semaphore_pend() in one task
+    yield      Task_yield() to the other task of the same priority
+    mailbox    a 16 byte message from a producer task to loop()
+    clock      the period of a one tick Clock, its spread the jitter;
+               a tick is 32 ACLK counts, 976.5625us
+
+  Run it before and after a change (priorities, RAMFUNC handlers, the
+  Optimize menu's LTO) to see what the change bought. The maxima
+  include whatever else interrupted, the 1ms Clock tick for one.
+
+  SCOPE_PIN goes high in the edge handler and low in the task at the
+  end of the Hwi -> Swi -> Task chain, and toggles on every clock
+  period, for a scope to show the same as the numbers without the
+  cycles() calls' own cost.
+
+  Hardware: connect pin 11 (P3.6) to pin 12 (P5.2); scope on pin 13
+  (P5.0).
+
+  This example code is in the public domain.
+*/
+
+#include <xdc/runtime/Types.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Clock.h>
+#include <ti/sysbios/knl/Mailbox.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/knl/Swi.h>
+#include <ti/sysbios/knl/Task.h>
+
+#define OUT_PIN        11
+#define IN_PIN         12
+#define SCOPE_PIN      13
+#define SAMPLES        1000
+#define MSG_SIZE       16
+#define MAILBOX_MSGS   8
+#define MAILBOX_COUNT  10000
+
+struct Stat {
+  uint32_t min;
+  uint32_t max;
+  uint32_t count;
+  uint64_t total;
+};
+
+float cyclesPerUs;
+
+Swi_Struct swiStruct;
+Semaphore_Struct handoffSem, yieldSem, producerSem, pairSem;
+Mailbox_Struct mailboxStruct;
+Clock_Struct clockStruct;
+Task_Struct handoffTask, yieldTask, producerTask;
+uint8_t handoffStack[768], yieldStack[768], producerStack[768];
+
+volatile bool chain;
+volatile bool done;
+volatile uint32_t edgeTime, hwiTime, swiTime, taskTime;
+
+volatile uint32_t yieldMark;
+volatile uint32_t yieldCount;
+
+volatile uint32_t clockLast;
+volatile uint32_t clockCount;
+
+Stat yieldStat, clockStat;
+
+void reset(Stat &s)
+{
+  s.min = 0xffffffff;
+  s.max = 0;
+  s.count = 0;
+  s.total = 0;
+}
+
+void add(Stat &s, uint32_t cycles)
+{
+  if (cycles < s.min) {
+    s.min = cycles;
+  }
+  if (cycles > s.max) {
+    s.max = cycles;
+  }
+  s.count++;
+  s.total += cycles;
+}
+
+void report(const char *name, Stat &s)
+{
+  uint32_t avg = s.count ? s.total / s.count : 0;
+
+  Serial.printf("%-10s min=%-7lu avg=%-7lu max=%-7lu cycles, avg %.2f us\r\n",
+    name, (unsigned long)s.min, (unsigned long)avg, (unsigned long)s.max,
+    avg / cyclesPerUs);
+}
+
+// Hwi: the pin edge, the start of the chain
+void edgeHandler(void)
+{
+  hwiTime = cycles();
+  digitalWriteFast(SCOPE_PIN, HIGH);
+
+  if (chain) {
+    Swi_post(Swi_handle(&swiStruct));
+  }
+  else {
+    done = true;
+  }
+}
+
+void swiFxn(UArg a0, UArg a1)
+{
+  swiTime = cycles();
+  Semaphore_post(Semaphore_handle(&handoffSem));
+}
+
+// highest priority, woken by the Swi or by loop()
+void handoffFxn(UArg a0, UArg a1)
+{
+  for (;;) {
+    Semaphore_pend(Semaphore_handle(&handoffSem), BIOS_WAIT_FOREVER);
+    taskTime = cycles();
+    digitalWriteFast(SCOPE_PIN, LOW);
+    done = true;
+  }
+}
+
+// run by loop() and yieldTask, at the same priority, in turns
+void yieldTurns(void)
+{
+  while (yieldCount < SAMPLES) {
+    yieldMark = cycles();
+    Task_yield();
+    add(yieldStat, cycles() - yieldMark);
+    yieldCount++;
+  }
+}
+
+void yieldFxn(UArg a0, UArg a1)
+{
+  for (;;) {
+    Semaphore_pend(Semaphore_handle(&yieldSem), BIOS_WAIT_FOREVER);
+    yieldTurns();
+  }
+}
+
+void producerFxn(UArg a0, UArg a1)
+{
+  uint8_t msg[MSG_SIZE] = {0};
+
+  for (;;) {
+    Semaphore_pend(Semaphore_handle(&producerSem), BIOS_WAIT_FOREVER);
+    for (uint32_t i = 0; i < MAILBOX_COUNT; i++) {
+      msg[0] = (uint8_t)i;
+      Mailbox_post(Mailbox_handle(&mailboxStruct), msg, BIOS_WAIT_FOREVER);
+    }
+  }
+}
+
+// Swi context, every tick
+void clockFxn(UArg arg)
+{
+  uint32_t now = cycles();
+
+  digitalWriteFast(SCOPE_PIN, clockCount & 1);
+  if (clockCount != 0) {
+    add(clockStat, now - clockLast);
+  }
+  clockLast = now;
+  if (++clockCount > SAMPLES) {
+    Clock_stop(Clock_handle(&clockStruct));
+  }
+}
+
+void createTask(Task_Struct *task, Task_FuncPtr fxn, uint8_t *stack,
+  size_t stackSize, int priority)
+{
+  Task_Params params;
+
+  Task_Params_init(&params);
+  params.stack = stack;
+  params.stackSize = stackSize;
+  params.priority = priority;
+  Task_construct(task, fxn, &params, NULL);
+}
+
+// one edge through the jumper, waited for to the end of the chain
+void edge(void)
+{
+  digitalWriteFast(OUT_PIN, LOW);
+  delayMicroseconds(20);
+  done = false;
+
+  edgeTime = cycles();
+  digitalWriteFast(OUT_PIN, HIGH);
+  while (!done) {
+    ;
+  }
+}
+
+void benchGpio(void)
+{
+  Stat gpio;
+
+  reset(gpio);
+  chain = false;
+  for (int i = 0; i < SAMPLES; i++) {
+    edge();
+    digitalWriteFast(SCOPE_PIN, LOW);
+    add(gpio, hwiTime - edgeTime);
+  }
+  report("gpio", gpio);
+}
+
+void benchHandoff(void)
+{
+  Stat hwiSwi, swiTask;
+
+  reset(hwiSwi);
+  reset(swiTask);
+  chain = true;
+  for (int i = 0; i < SAMPLES; i++) {
+    edge();
+    add(hwiSwi, swiTime - hwiTime);
+    add(swiTask, taskTime - swiTime);
+  }
+  report("hwi->swi", hwiSwi);
+  report("swi->task", swiTask);
+}
+
+void benchSemaphore(void)
+{
+  Stat wake, pair;
+  uint32_t start;
+
+  reset(wake);
+  for (int i = 0; i < SAMPLES; i++) {
+    start = cycles();
+    Semaphore_post(Semaphore_handle(&handoffSem));
+    add(wake, taskTime - start);
+  }
+  digitalWriteFast(SCOPE_PIN, LOW);
+  report("sem wake", wake);
+
+  reset(pair);
+  for (int i = 0; i < SAMPLES; i++) {
+    start = cycles();
+    Semaphore_post(Semaphore_handle(&pairSem));
+    Semaphore_pend(Semaphore_handle(&pairSem), BIOS_WAIT_FOREVER);
+    add(pair, cycles() - start);
+  }
+  report("sem pair", pair);
+}
+
+void benchYield(void)
+{
+  reset(yieldStat);
+  yieldCount = 0;
+  Semaphore_post(Semaphore_handle(&yieldSem));
+  yieldTurns();
+  report("yield", yieldStat);
+}
+
+void benchMailbox(void)
+{
+  uint8_t msg[MSG_SIZE];
+  uint32_t start, elapsed;
+
+  start = cycles();
+  Semaphore_post(Semaphore_handle(&producerSem));
+  for (uint32_t i = 0; i < MAILBOX_COUNT; i++) {
+    Mailbox_pend(Mailbox_handle(&mailboxStruct), msg, BIOS_WAIT_FOREVER);
+  }
+  elapsed = cycles() - start;
+
+  Serial.printf("%-10s %lu cycles per message, %lu messages/s\r\n",
+    "mailbox", (unsigned long)(elapsed / MAILBOX_COUNT),
+    (unsigned long)(MAILBOX_COUNT * cyclesPerUs * 1000000.0f / elapsed));
+}
+
+void benchClock(void)
+{
+  reset(clockStat);
+  clockCount = 0;
+  Clock_start(Clock_handle(&clockStruct));
+  while (clockCount <= SAMPLES) {
+    delay(10);
+  }
+  report("clock", clockStat);
+  Serial.printf("%-10s jitter %lu cycles\r\n", "",
+    (unsigned long)(clockStat.max - clockStat.min));
+}
+
+void setup()
+{
+  Types_FreqHz cpuFreq;
+  Semaphore_Params semParams;
+  Clock_Params clockParams;
+  Mailbox_Params mailboxParams;
+  int loopPriority = Task_getPri(Task_self());
+
+  Serial.begin(115200);
+  delay(1000);
+
+  BIOS_getCpuFreq(&cpuFreq);
+  cyclesPerUs = cpuFreq.lo / 1000000.0f;
+
+  pinMode(OUT_PIN, OUTPUT);
+  digitalWrite(OUT_PIN, LOW);
+  pinMode(SCOPE_PIN, OUTPUT);
+  digitalWrite(SCOPE_PIN, LOW);
+  attachInterrupt(IN_PIN, edgeHandler, RISING);
+
+  Swi_construct(&swiStruct, swiFxn, NULL, NULL);
+
+  Semaphore_Params_init(&semParams);
+  semParams.mode = Semaphore_Mode_BINARY;
+  Semaphore_construct(&handoffSem, 0, &semParams);
+  Semaphore_construct(&yieldSem, 0, &semParams);
+  Semaphore_construct(&producerSem, 0, &semParams);
+  Semaphore_construct(&pairSem, 0, &semParams);
+
+  Mailbox_Params_init(&mailboxParams);
+  Mailbox_construct(&mailboxStruct, MSG_SIZE, MAILBOX_MSGS, &mailboxParams,
+    NULL);
+
+  Clock_Params_init(&clockParams);
+  clockParams.period = 1;
+  Clock_construct(&clockStruct, clockFxn, 1, &clockParams);
+
+  createTask(&handoffTask, handoffFxn, handoffStack, sizeof(handoffStack),
+    Task_numPriorities - 1);
+  createTask(&yieldTask, yieldFxn, yieldStack, sizeof(yieldStack),
+    loopPriority);
+  createTask(&producerTask, producerFxn, producerStack, sizeof(producerStack),
+    loopPriority + 1);
+
+  Serial.print("RTOS benchmark, CPU ");
+  Serial.print(cpuFreq.lo);
+  Serial.println(" Hz");
+}
+
+void loop()
+{
+  benchGpio();
+  benchHandoff();
+  benchSemaphore();
+  benchYield();
+  benchMailbox();
+  benchClock();
+
+  Serial.println();
+  delay(5000);
+}
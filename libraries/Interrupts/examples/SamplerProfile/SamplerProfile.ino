@@ -0,0 +1,67 @@
+/*
+  Sampler Profile
+
+  Samples where the CPU spends its time while the sketch runs: 4000
+  times a second a timer interrupt notes the code address it
+  interrupted and the task that was running. After RUN_MS the counts
+  are printed, one line per address and task:
+
+    0x<pc> 0x<task> <count>
+
+  Capture the output to a file and let the tools/sampler_report.py
+  script of this library turn it into a table of functions:
+
+    sampler_report.py capture.txt --elf Sketch.ino.elf --tasks
+
+  The work below stands in for a real sketch's; the sampler sees the
+  core, the drivers, the kernel and the C library alike.
+
+  This example code is in the public domain.
+*/
+
+#define BINS    1024    // power of 2
+#define RUN_MS  5000
+
+SamplerBin bins[BINS];
+
+void work()
+{
+  float x = 0;
+
+  for (int i = 0; i < 200; i++) {
+    x += sqrt(analogRead(A0));
+  }
+  Serial1.println(x);
+  delay(5);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial1.begin(115200);
+  delay(1000);
+
+  samplerBegin(bins, BINS, 4000);
+
+  uint32_t start = millis();
+  while (millis() - start < RUN_MS) {
+    work();
+  }
+
+  samplerEnd();
+
+  Serial.print(samplerSamples());
+  Serial.print(" samples, ");
+  Serial.print(samplerDropped());
+  Serial.println(" dropped");
+  for (int i = 0; i < BINS; i++) {
+    if (bins[i].count != 0) {
+      Serial.printf("0x%08lx 0x%08lx %lu\r\n", (unsigned long)bins[i].pc,
+        (unsigned long)bins[i].task, (unsigned long)bins[i].count);
+    }
+  }
+}
+
+void loop()
+{
+}
@@ -0,0 +1,52 @@
+/*
+  Shutdown Wake
+
+  Spends most of its life in LPM3.5, where only the RTC runs: each
+  minute the RTC's periodic event resets the board out of it, the
+  sketch flashes the red LED, prints the time and shuts down again.
+  setup() runs on every wakeup; powerWokeFromShutdown() tells those
+  boots from power-up or the reset button, which set the clock.
+
+  This example code is in the public domain.
+*/
+
+#include <RTC.h>
+
+void minute(void)
+{
+}
+
+void setup()
+{
+  RTCTime now;
+
+  Serial.begin(115200);
+  pinMode(RED_LED, OUTPUT);
+
+  RTC.begin();
+  if (!powerWokeFromShutdown()) {
+    RTC.setEpoch(0);
+    Serial.println("power-up");
+  }
+  RTC.attachPeriodic(RTC_EVERY_MINUTE, minute);
+
+  RTC.getTime(&now);
+  Serial.print("awake at ");
+  Serial.print(now.hour);
+  Serial.print(":");
+  Serial.println(now.minute);
+
+  digitalWrite(RED_LED, HIGH);
+  delay(50);
+  digitalWrite(RED_LED, LOW);
+
+  Serial.flush();
+  powerShutdown();
+
+  Serial.println("shutdown refused");
+}
+
+void loop()
+{
+  delay(1000);
+}
@@ -0,0 +1,43 @@
+// adc: the joystick's two axes streamed at ADC_RATE sets per second
+
+#if BENCH_ADC
+
+#define ADC_RATE      10000
+#define ADC_SAMPLES   100     // per pin and block, 100 blocks/s
+
+uint8_t adcPins[] = {2, 26};
+uint16_t adcBuffer[2 * 2 * ADC_SAMPLES];
+AnalogStream adcStream;
+volatile uint32_t adcBlockTime;
+uint32_t adcOverruns;
+
+void adcBlockDone(const uint16_t *block, void *arg)
+{
+  adcBlockTime = micros();
+}
+
+void setupAdc()
+{
+  adcStream.onBlock(adcBlockDone);
+  adcStream.begin(adcPins, 2, ADC_RATE, adcBuffer, ADC_SAMPLES);
+}
+
+void loopAdc()
+{
+  const uint16_t *block = adcStream.read(100);
+  uint32_t overruns = adcStream.overruns();
+
+  if (block == NULL || overruns != adcOverruns) {
+    adcOverruns = overruns;
+    benchRecord(ADC_ID, 0, 0, false);
+    return;
+  }
+  benchRecord(ADC_ID, sizeof(adcBuffer) / 2, micros() - adcBlockTime, true);
+}
+
+#else
+
+void setupAdc() {}
+void loopAdc() { benchIdle(); }
+
+#endif
@@ -0,0 +1,48 @@
+// display: filled rectangles walking across the screen
+
+#if BENCH_DISPLAY
+
+#define DISPLAY_SIZE  32
+
+Screen_HX8353E screen;
+uint16_t displayX, displayY, displayColour;
+
+void setupDisplay()
+{
+  screen.begin();
+  screen.setPenSolid(true);
+  screen.clear();
+}
+
+void loopDisplay()
+{
+  uint32_t start;
+
+  if (!benchRunning) {
+    delay(10);
+    return;
+  }
+
+  start = micros();
+  screen.dRectangle(displayX, displayY, DISPLAY_SIZE, DISPLAY_SIZE,
+    displayColour);
+  benchRecord(DISPLAY_ID, DISPLAY_SIZE * DISPLAY_SIZE * 2,
+    micros() - start, true);
+
+  displayColour += 0x0841;
+  displayX += DISPLAY_SIZE;
+  if (displayX + DISPLAY_SIZE > screen.screenSizeX()) {
+    displayX = 0;
+    displayY += DISPLAY_SIZE;
+    if (displayY + DISPLAY_SIZE > screen.screenSizeY()) {
+      displayY = 0;
+    }
+  }
+}
+
+#else
+
+void setupDisplay() {}
+void loopDisplay() { benchIdle(); }
+
+#endif
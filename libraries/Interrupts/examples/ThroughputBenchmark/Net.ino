@@ -0,0 +1,99 @@
+// tcp and udp: a sink and an echo server on the host, bench_collect.py --serve
+
+#if BENCH_NET
+
+#define NET_SSID      "network"
+#define NET_PASSWORD  "password"
+#define NET_HOST      IPAddress(192, 168, 1, 10)
+#define NET_TCP_PORT  5001
+#define NET_UDP_PORT  5002
+#define TCP_BLOCK     1024
+#define UDP_BLOCK     64
+
+TASK_ATTRS(loopTcp, 2048, 0);
+TASK_ATTRS(loopUdp, 2048, 0);
+
+WiFiClient tcpClient;
+WiFiUDP udp;
+uint8_t tcpOut[TCP_BLOCK];
+uint8_t udpOut[UDP_BLOCK], udpIn[UDP_BLOCK];
+volatile bool netReady;
+
+void setupTcp()
+{
+  WiFi.begin((char *)NET_SSID, (char *)NET_PASSWORD);
+  while (WiFi.localIP() == INADDR_NONE) {
+    delay(100);
+  }
+  udp.begin(NET_UDP_PORT);
+  netReady = true;
+}
+
+void loopTcp()
+{
+  uint32_t start;
+  bool ok;
+
+  if (!benchRunning) {
+    delay(10);
+    return;
+  }
+
+  if (!tcpClient.connected()) {
+    tcpClient.stop();
+    if (!tcpClient.connect(NET_HOST, NET_TCP_PORT)) {
+      benchRecord(TCP_ID, 0, 0, false);
+      delay(100);
+      return;
+    }
+  }
+
+  start = micros();
+  ok = tcpClient.write(tcpOut, TCP_BLOCK) == TCP_BLOCK;
+  benchRecord(TCP_ID, TCP_BLOCK, micros() - start, ok);
+}
+
+void setupUdp()
+{
+  for (int i = 0; i < UDP_BLOCK; i++) {
+    udpOut[i] = i;
+  }
+}
+
+void loopUdp()
+{
+  uint32_t start, sent;
+  int n = 0;
+
+  if (!netReady || !benchRunning) {
+    delay(10);
+    return;
+  }
+
+  start = micros();
+  udp.beginPacket(NET_HOST, NET_UDP_PORT);
+  udp.write(udpOut, UDP_BLOCK);
+  udp.endPacket();
+  sent = millis();
+  while (millis() - sent < 100) {
+    if (udp.parsePacket() != 0) {
+      n = udp.read(udpIn, UDP_BLOCK);
+      break;
+    }
+    delay(1);
+  }
+  benchRecord(UDP_ID, 2 * UDP_BLOCK, micros() - start,
+    n == UDP_BLOCK && memcmp(udpIn, udpOut, UDP_BLOCK) == 0);
+
+  // the round trip rate a telemetry link would run at
+  delay(10);
+}
+
+#else
+
+void setupTcp() {}
+void loopTcp() { benchIdle(); }
+void setupUdp() {}
+void loopUdp() { benchIdle(); }
+
+#endif
@@ -0,0 +1,59 @@
+// sd: appends to a file, flushed every SD_FLUSH bytes, restarted at SD_LIMIT
+
+#if BENCH_SD
+
+#define SD_FILE       "bench.dat"
+#define SD_BLOCK      512
+#define SD_FLUSH      32768
+#define SD_LIMIT      (4L * 1024 * 1024)
+
+File sdFile;
+uint8_t sdOut[SD_BLOCK];
+uint32_t sdWritten;
+bool sdMounted;
+
+void setupSd()
+{
+  memset(sdOut, 'x', SD_BLOCK);
+  sdMounted = SD.begin();
+}
+
+void loopSd()
+{
+  uint32_t start;
+  bool ok;
+
+  if (!sdMounted || !benchRunning) {
+    delay(10);
+    return;
+  }
+
+  if (!sdFile || sdWritten >= SD_LIMIT) {
+    if (sdFile) {
+      sdFile.close();
+    }
+    SD.remove(SD_FILE);
+    sdFile = SD.open(SD_FILE, FILE_WRITE);
+    sdWritten = 0;
+    if (!sdFile) {
+      benchRecord(SD_ID, 0, 0, false);
+      delay(100);
+      return;
+    }
+  }
+
+  start = micros();
+  ok = sdFile.write(sdOut, SD_BLOCK) == SD_BLOCK;
+  sdWritten += SD_BLOCK;
+  if (sdWritten % SD_FLUSH == 0) {
+    sdFile.flush();
+  }
+  benchRecord(SD_ID, SD_BLOCK, micros() - start, ok);
+}
+
+#else
+
+void setupSd() {}
+void loopSd() { benchIdle(); }
+
+#endif
@@ -0,0 +1,48 @@
+// spi: transfers on the shared bus, checked through a MOSI to MISO jumper
+
+#if BENCH_SPI
+
+#define SPI_CS_PIN    18      // pulsed per transfer, nothing attached
+#define SPI_BLOCK     256
+
+SPISettings spiSettings(8000000, MSBFIRST, SPI_MODE0);
+uint8_t spiOut[SPI_BLOCK], spiIn[SPI_BLOCK];
+
+void setupSpi()
+{
+  SPI.begin();
+  pinMode(SPI_CS_PIN, OUTPUT);
+  digitalWrite(SPI_CS_PIN, HIGH);
+  for (int i = 0; i < SPI_BLOCK; i++) {
+    spiOut[i] = i * 7;
+  }
+}
+
+void loopSpi()
+{
+  uint32_t start;
+
+  if (!benchRunning) {
+    delay(10);
+    return;
+  }
+
+  start = micros();
+  SPI.beginTransaction(spiSettings);
+  digitalWrite(SPI_CS_PIN, LOW);
+  SPI.transfer(spiOut, spiIn, SPI_BLOCK);
+  digitalWrite(SPI_CS_PIN, HIGH);
+  SPI.endTransaction();
+  benchRecord(SPI_ID, SPI_BLOCK, micros() - start,
+    memcmp(spiIn, spiOut, SPI_BLOCK) == 0);
+
+  // a device would need the bus between transfers too
+  delay(1);
+}
+
+#else
+
+void setupSpi() {}
+void loopSpi() { benchIdle(); }
+
+#endif
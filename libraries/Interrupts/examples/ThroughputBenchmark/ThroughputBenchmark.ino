@@ -0,0 +1,247 @@
+/*
+  Throughput Benchmark
+
+  Runs the peripherals a typical application uses all at once, each
+  from its own task as a multi-tab sketch would, and reports per
+  subsystem what got through in a RUN_MS window:
+
+    uart     64 byte blocks through Serial1, TX looped back to RX
+    spi      256 byte SPI transfers, MOSI looped back to MISO
+    wire     2 byte register reads from an I2C device
+    adc      AnalogStream blocks, latency from block end to read()
+    tcp      1KB writes to a sink on the host
+    udp      64 byte round trips to an echo server on the host
+    sd       512 byte appends to a file, flushed every 32KB
+    display  32x32 filled rectangles on the Educational BoosterPack
+             MKII screen
+
+  For each it prints operations, bytes, throughput, errors and the
+  50th, 90th and 99th percentile and maximum latency of one operation
+  in us, then the CPU load the Load module measured over the window,
+  one line each, and starts the next window:
+
+    run n=1 ms=10000 core=<ENERGIA version>
+    bench name=uart ops=... bytes=... kBps=... errors=... p50=... ...
+    cpu load=...
+    end
+
+  The tools/bench_collect.py script of this library reads the
+  reports off the serial port, serves the tcp and udp endpoints,
+  keeps the median of several windows and compares them with a
+  previous release's results:
+
+    bench_collect.py --port /dev/ttyACM0 --serve --runs 5 \
+        --out new.json --baseline old.json
+
+  Turn the subsystems the board has no hardware for off below. The
+  percentiles come from a histogram with four buckets per power of
+  two, so they read up to 25% high.
+
+  Hardware: jumper pin 4 (P3.3) to pin 3 (P3.2) for uart and pin 15
+  (P1.6) to pin 14 (P1.7) for spi; an Educational BoosterPack MKII
+  for wire (its OPT3001), adc (its joystick) and display; a CC3100
+  BoosterPack for tcp and udp; an SD card BoosterPack for sd.
+
+  This example code is in the public domain.
+*/
+
+#define BENCH_UART      1
+#define BENCH_SPI       1
+#define BENCH_WIRE      1
+#define BENCH_ADC       1
+#define BENCH_NET       0       // tcp and udp
+#define BENCH_SD        0
+#define BENCH_DISPLAY   0
+
+#define RUN_MS          10000
+#define LOAD_WINDOW_MS  500     // the Load module's window
+
+#include <TaskAttrs.h>
+#if BENCH_SPI
+#include <SPI.h>
+#endif
+#if BENCH_WIRE
+#include <Wire.h>
+#endif
+#if BENCH_ADC
+#include <AnalogStream.h>
+#endif
+#if BENCH_NET
+#include <WiFi.h>
+#endif
+#if BENCH_SD
+#include <SD.h>
+#endif
+#if BENCH_DISPLAY
+#include <Screen_HX8353E.h>
+#endif
+
+// latency histogram: 0-3 us exact, then four buckets per power of two
+#define HIST_BUCKETS    96
+
+struct Bench {
+  const char *name;
+  bool enabled;
+  uint32_t ops;
+  uint64_t bytes;
+  uint32_t errors;
+  uint32_t maxUs;
+  uint32_t hist[HIST_BUCKETS];
+};
+
+enum {
+  UART_ID, SPI_ID, WIRE_ID, ADC_ID, TCP_ID, UDP_ID, SD_ID, DISPLAY_ID, BENCHES
+};
+
+Bench benches[BENCHES] = {
+  {"uart", BENCH_UART},
+  {"spi", BENCH_SPI},
+  {"wire", BENCH_WIRE},
+  {"adc", BENCH_ADC},
+  {"tcp", BENCH_NET},
+  {"udp", BENCH_NET},
+  {"sd", BENCH_SD},
+  {"display", BENCH_DISPLAY}
+};
+
+volatile bool benchRunning;
+uint32_t runCount;
+
+int histBucket(uint32_t us)
+{
+  int e;
+
+  if (us < 4) {
+    return us;
+  }
+  e = 31 - __builtin_clz(us);
+  if (e > HIST_BUCKETS / 4) {
+    return HIST_BUCKETS - 1;
+  }
+  return 4 * (e - 1) + ((us >> (e - 2)) & 3);
+}
+
+// the highest latency bucket b holds
+uint32_t histLimit(int b)
+{
+  if (b < 4) {
+    return b;
+  }
+  return ((uint32_t)(4 + (b & 3) + 1) << (b / 4 - 1)) - 1;
+}
+
+// one operation of a bench, from its own task only; dropped outside a window
+void benchRecord(int id, uint32_t bytes, uint32_t us, bool ok)
+{
+  Bench *b = &benches[id];
+
+  if (!benchRunning) {
+    return;
+  }
+  if (!ok) {
+    b->errors++;
+    return;
+  }
+  b->ops++;
+  b->bytes += bytes;
+  b->hist[histBucket(us)]++;
+  if (us > b->maxUs) {
+    b->maxUs = us;
+  }
+}
+
+// for the tabs of benches turned off
+void benchIdle()
+{
+  delay(60000);
+}
+
+uint32_t percentile(const Bench *b, uint32_t percent)
+{
+  uint64_t want = ((uint64_t)b->ops * percent + 99) / 100;
+  uint64_t seen = 0;
+
+  for (int i = 0; i < HIST_BUCKETS; i++) {
+    seen += b->hist[i];
+    if (seen >= want && seen != 0) {
+      return min(histLimit(i), b->maxUs);
+    }
+  }
+  return b->maxUs;
+}
+
+void report(const Bench *b, uint32_t ms)
+{
+  Serial.print("bench name=");
+  Serial.print(b->name);
+  Serial.print(" ops=");
+  Serial.print(b->ops);
+  Serial.print(" bytes=");
+  Serial.print((uint32_t)b->bytes);
+  Serial.print(" kBps=");
+  Serial.print((float)b->bytes / ms, 2);
+  Serial.print(" errors=");
+  Serial.print(b->errors);
+  Serial.print(" p50=");
+  Serial.print(percentile(b, 50));
+  Serial.print(" p90=");
+  Serial.print(percentile(b, 90));
+  Serial.print(" p99=");
+  Serial.print(percentile(b, 99));
+  Serial.print(" max=");
+  Serial.println(b->maxUs);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(2000);  // let the other tabs' setups connect and mount
+}
+
+void loop()
+{
+  uint32_t start, ms, loadSum = 0, loads = 0;
+
+  for (int i = 0; i < BENCHES; i++) {
+    Bench *b = &benches[i];
+
+    b->ops = 0;
+    b->bytes = 0;
+    b->errors = 0;
+    b->maxUs = 0;
+    memset(b->hist, 0, sizeof(b->hist));
+  }
+
+  start = millis();
+  benchRunning = true;
+  while (millis() - start < RUN_MS) {
+    delay(LOAD_WINDOW_MS);
+    loadSum += cpuLoad();
+    loads++;
+  }
+  benchRunning = false;
+  ms = millis() - start;
+
+  // let operations in flight finish before reading the counts
+  delay(200);
+
+  runCount++;
+  Serial.print("run n=");
+  Serial.print(runCount);
+  Serial.print(" ms=");
+  Serial.print(ms);
+  Serial.print(" core=");
+#ifdef ENERGIA
+  Serial.println(ENERGIA);
+#else
+  Serial.println("unknown");
+#endif
+  for (int i = 0; i < BENCHES; i++) {
+    if (benches[i].enabled) {
+      report(&benches[i], ms);
+    }
+  }
+  Serial.print("cpu load=");
+  Serial.println(loadSum / loads);
+  Serial.println("end");
+}
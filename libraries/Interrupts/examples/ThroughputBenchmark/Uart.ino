@@ -0,0 +1,48 @@
+// uart: blocks written to Serial1 and read back through a loopback jumper
+
+#if BENCH_UART
+
+#define UART_BAUD     1000000
+#define UART_BLOCK    64
+
+uint8_t uartOut[UART_BLOCK], uartIn[UART_BLOCK];
+
+void setupUart()
+{
+  Serial1.begin(UART_BAUD);
+  Serial1.setTimeout(100);
+  for (int i = 0; i < UART_BLOCK; i++) {
+    uartOut[i] = i;
+  }
+}
+
+void loopUart()
+{
+  uint32_t start;
+  bool ok;
+
+  if (!benchRunning) {
+    delay(10);
+    return;
+  }
+
+  start = micros();
+  Serial1.write(uartOut, UART_BLOCK);
+  ok = Serial1.readBytes(uartIn, UART_BLOCK) == UART_BLOCK &&
+    memcmp(uartIn, uartOut, UART_BLOCK) == 0;
+  benchRecord(UART_ID, UART_BLOCK, micros() - start, ok);
+
+  if (!ok) {
+    delay(10);
+    while (Serial1.available()) {
+      Serial1.read();
+    }
+  }
+}
+
+#else
+
+void setupUart() {}
+void loopUart() { benchIdle(); }
+
+#endif
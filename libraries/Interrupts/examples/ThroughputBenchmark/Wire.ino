@@ -0,0 +1,38 @@
+// wire: register reads from the BoosterPack's OPT3001 light sensor
+
+#if BENCH_WIRE
+
+#define WIRE_DEVICE   0x44
+#define WIRE_REGISTER 0x7e    // manufacturer id, reads 0x5449
+
+void setupWire()
+{
+  Wire.begin();
+  Wire.setClock(400000);
+}
+
+void loopWire()
+{
+  uint8_t id[2];
+  uint32_t start;
+  bool ok;
+
+  if (!benchRunning) {
+    delay(10);
+    return;
+  }
+
+  start = micros();
+  ok = Wire.readRegisters(WIRE_DEVICE, WIRE_REGISTER, id, 2) == WIRE_SUCCESS;
+  benchRecord(WIRE_ID, 2, micros() - start, ok);
+
+  // a sensor polled every ms, as a control loop would
+  delay(1);
+}
+
+#else
+
+void setupWire() {}
+void loopWire() { benchIdle(); }
+
+#endif
@@ -0,0 +1,44 @@
+/*
+  Trace Dump
+
+  Records what the core does, with timestamps, into a RAM ring:
+  task switches, delay(), Serial writes and frames, SPI and I2C
+  transfers, and events of the sketch's own (traceEvent() with ids
+  from TRACE_USER). loop() drains the ring to Serial as raw 12 byte
+  TraceRecords, little endian: time (Timestamp_get32() ticks, 48 MHz
+  by default), event, arg, data. A host script turns them into a
+  timeline; an event with TRACE_END set closes the one before it.
+
+  The dump goes out in one Serial.write() per batch, which traces
+  only two records of its own. Printing record by record would trace
+  more than it drains.
+
+  This example code is in the public domain.
+*/
+
+#define RING_SIZE 512   // power of 2
+#define MY_SAMPLE TRACE_USER
+
+TraceRecord ring[RING_SIZE];
+TraceRecord batch[32];
+
+void setup()
+{
+  Serial.begin(921600);
+  pinMode(RED_LED, OUTPUT);
+
+  traceBegin(ring, RING_SIZE);
+}
+
+void loop()
+{
+  unsigned int n;
+
+  traceEvent(MY_SAMPLE, 0, analogRead(A0));
+  digitalWrite(RED_LED, !digitalRead(RED_LED));
+  delay(10);
+
+  while ((n = traceRead(batch, 32)) != 0) {
+    Serial.write((const uint8_t *)batch, n * sizeof(TraceRecord));
+  }
+}
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+#
+# bench_collect.py - Collect and compare ThroughputBenchmark results
+#
+# Reads the reports the ThroughputBenchmark example prints, a window at
+# a time from "run" to "end", off the serial port (needs pyserial) or
+# out of a captured file:
+#
+#   run n=<window> ms=<length> core=<version>
+#   bench name=<subsystem> ops=... bytes=... kBps=... errors=... p50=...
+#   cpu load=<percent>
+#   end
+#
+# and keeps the median of each figure over --runs windows. --out saves
+# them as JSON for the next release to compare against; --baseline
+# prints each figure next to a saved one and marks the ones more than
+# --threshold percent worse (lower kBps or ops, higher errors, latency
+# or load), exiting with 1 if there are any.
+#
+# --serve also runs the host side of the tcp and udp benches: a TCP
+# sink on port 5001 and a UDP echo server on port 5002.
+#
+# Usage: bench_collect.py (--port /dev/ttyACM0 [--baud 115200] | --file capture.txt)
+#          [--runs N] [--skip N] [--serve] [--out results.json]
+#          [--baseline previous.json] [--threshold PERCENT]
+#   --skip  drop the first N windows, while caches and connections warm up
+
+import argparse
+import json
+import socket
+import statistics
+import sys
+import threading
+
+TCP_PORT = 5001
+UDP_PORT = 5002
+
+# figures where more is better; for the rest (errors, latency, load) less is
+HIGHER_BETTER = ('ops', 'bytes', 'kBps')
+
+
+def fields(line):
+    """'bench name=uart ops=12' -> ('bench', {'name': 'uart', 'ops': '12'})"""
+    words = line.split()
+    if not words:
+        return None, {}
+    values = {}
+    for word in words[1:]:
+        key, sep, value = word.partition('=')
+        if sep:
+            values[key] = value
+    return words[0], values
+
+
+def number(value):
+    try:
+        return float(value)
+    except ValueError:
+        return None
+
+
+def windows(lines):
+    """Yield each complete window as (run fields, {name: figures}, load)"""
+    run, benches, load = None, {}, None
+    for line in lines:
+        kind, values = fields(line.strip())
+        if kind == 'run':
+            run, benches, load = values, {}, None
+        elif run is None:
+            continue
+        elif kind == 'bench' and 'name' in values:
+            name = values.pop('name')
+            benches[name] = {k: number(v) for k, v in values.items()
+                             if number(v) is not None}
+        elif kind == 'cpu':
+            load = number(values.get('load', ''))
+        elif kind == 'end':
+            yield run, benches, load
+            run = None
+
+
+def serial_lines(port, baud):
+    import serial  # pyserial
+
+    with serial.Serial(port, baud, timeout=1) as s:
+        while True:
+            line = s.readline()
+            if line:
+                text = line.decode('ascii', errors='replace')
+                sys.stdout.write(text)
+                sys.stdout.flush()
+                yield text
+
+
+def file_lines(path):
+    with open(path, errors='replace') as f:
+        yield from f
+
+
+def tcp_sink():
+    server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    server.bind(('', TCP_PORT))
+    server.listen(1)
+    while True:
+        conn, _ = server.accept()
+        with conn:
+            while conn.recv(65536):
+                pass
+
+
+def udp_echo():
+    server = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    server.bind(('', UDP_PORT))
+    while True:
+        data, addr = server.recvfrom(2048)
+        server.sendto(data, addr)
+
+
+def collect(lines, runs, skip):
+    """Medians of the figures over runs windows after skip ones"""
+    samples, loads, core, seen = {}, [], None, 0
+    for run, benches, load in windows(lines):
+        seen += 1
+        if seen <= skip:
+            continue
+        core = run.get('core', core)
+        for name, figures in benches.items():
+            for key, value in figures.items():
+                samples.setdefault(name, {}).setdefault(key, []).append(value)
+        if load is not None:
+            loads.append(load)
+        if seen - skip >= runs:
+            break
+
+    if seen <= skip:
+        sys.exit('no complete benchmark window read')
+
+    result = {'core': core, 'runs': seen - skip, 'benches': {}}
+    for name, figures in samples.items():
+        result['benches'][name] = {k: statistics.median(v)
+                                   for k, v in figures.items()}
+    if loads:
+        result['cpuLoad'] = statistics.median(loads)
+    return result
+
+
+def change(key, old, new):
+    """Percent change, positive when worse"""
+    if old == 0:
+        return 0.0 if new == 0 else float('inf')
+    delta = 100.0 * (new - old) / old
+    return -delta if key in HIGHER_BETTER else delta
+
+
+def compare(result, baseline, threshold):
+    print('%-8s %-7s %12s %12s %8s' % ('bench', 'figure', 'baseline', 'now', 'worse%'))
+    worse = 0
+    rows = [(name, key, figures.get(key), baseline['benches'].get(name, {}).get(key))
+            for name, figures in sorted(result['benches'].items())
+            for key in sorted(figures)]
+    rows.append(('cpu', 'load', result.get('cpuLoad'), baseline.get('cpuLoad')))
+    for name, key, new, old in rows:
+        if new is None or old is None:
+            continue
+        c = change(key, old, new)
+        flag = ''
+        if c > threshold:
+            flag = '  <--'
+            worse += 1
+        print('%-8s %-7s %12.2f %12.2f %8.1f%s' % (name, key, old, new, c, flag))
+    return worse
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument('--port')
+    source.add_argument('--file')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--runs', type=int, default=5)
+    parser.add_argument('--skip', type=int, default=1)
+    parser.add_argument('--serve', action='store_true')
+    parser.add_argument('--out')
+    parser.add_argument('--baseline')
+    parser.add_argument('--threshold', type=float, default=5.0)
+    args = parser.parse_args()
+
+    if args.serve:
+        for fxn in (tcp_sink, udp_echo):
+            threading.Thread(target=fxn, daemon=True).start()
+
+    if args.port:
+        lines = serial_lines(args.port, args.baud)
+    else:
+        lines = file_lines(args.file)
+
+    result = collect(lines, args.runs, args.skip)
+
+    if args.out:
+        with open(args.out, 'w') as f:
+            json.dump(result, f, indent=2, sort_keys=True)
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        print('core %s against %s, %d windows'
+              % (result['core'], baseline.get('core'), result['runs']))
+        if compare(result, baseline, args.threshold):
+            sys.exit(1)
+    else:
+        print(json.dumps(result, indent=2, sort_keys=True))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+#
+# sampler_report.py - Symbolize samplerBegin() profiles
+#
+# Reads the bins a sketch printed, one per line as
+#
+#   0x<pc> 0x<task> <count>
+#
+# (the SamplerProfile example's format; other lines are ignored) and
+# prints where the samples fell by function, hottest first, with the
+# share of all samples. The functions come from the sketch's ELF file,
+# through arm-none-eabi-nm, or from the linker's .map file. Task
+# handles are named after the symbol they point into, the Task_Struct
+# of a statically created task, when there is one.
+#
+# Usage: sampler_report.py capture.txt (--elf sketch.elf | --map sketch.map)
+#          [--nm arm-none-eabi-nm] [--tasks] [--lines N]
+#   --tasks  split each function's samples by task
+#   --lines  print only the N hottest functions
+
+import argparse
+import bisect
+import re
+import subprocess
+import sys
+
+BIN_LINE = re.compile(r'^\s*0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\d+)\s*$')
+
+# "                0x00001234                analogRead"
+MAP_SYMBOL = re.compile(r'^\s+0x([0-9a-fA-F]{8})\s+([A-Za-z_$][\w.$]*)\s*$')
+
+
+class Symbols:
+    """Address to name, each symbol reaching to its size or the next one"""
+
+    def __init__(self, entries):
+        entries.sort()
+        self.starts = [e[0] for e in entries]
+        self.entries = entries
+
+    def lookup(self, addr):
+        i = bisect.bisect_right(self.starts, addr) - 1
+        if i < 0:
+            return None
+        start, size, name = self.entries[i]
+        if size and addr >= start + size:
+            return None
+        return name
+
+
+def elf_symbols(elf, nm):
+    out = subprocess.run([nm, '-S', '-C', '--defined-only', elf],
+                         check=True, capture_output=True, text=True).stdout
+    code, data = [], []
+    for line in out.splitlines():
+        fields = line.split(None, 3)
+        if len(fields) == 4:
+            addr, size, kind, name = fields
+            size = int(size, 16)
+        elif len(fields) == 3:
+            addr, kind, name = fields
+            size = 0
+        else:
+            continue
+        entry = (int(addr, 16), size, name)
+        if kind in 'tTwW':
+            code.append(entry)
+        elif kind in 'bBdD':
+            data.append(entry)
+    return Symbols(code), Symbols(data)
+
+
+def map_symbols(path):
+    entries = []
+    with open(path) as f:
+        for line in f:
+            m = MAP_SYMBOL.match(line)
+            if m:
+                entries.append((int(m.group(1), 16), 0, m.group(2)))
+    # the map does not say which are functions; use the one table for both
+    symbols = Symbols(entries)
+    return symbols, symbols
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('capture')
+    group = parser.add_mutually_exclusive_group(required=True)
+    group.add_argument('--elf')
+    group.add_argument('--map')
+    parser.add_argument('--nm', default='arm-none-eabi-nm')
+    parser.add_argument('--tasks', action='store_true')
+    parser.add_argument('--lines', type=int, default=0)
+    args = parser.parse_args()
+
+    if args.elf:
+        code, data = elf_symbols(args.elf, args.nm)
+    else:
+        code, data = map_symbols(args.map)
+
+    functions = {}
+    total = 0
+    with open(args.capture, errors='replace') as f:
+        for line in f:
+            m = BIN_LINE.match(line)
+            if not m:
+                continue
+            pc, task, count = int(m.group(1), 16), int(m.group(2), 16), int(m.group(3))
+            name = code.lookup(pc) or '0x%08x' % pc
+            if task == 0:
+                task_name = '(Hwi/Swi)'
+            else:
+                task_name = data.lookup(task) or '0x%08x' % task
+            counts = functions.setdefault(name, {})
+            counts[task_name] = counts.get(task_name, 0) + count
+            total += count
+
+    if total == 0:
+        sys.exit('no samples in %s' % args.capture)
+
+    ranked = sorted(functions.items(), key=lambda kv: -sum(kv[1].values()))
+    if args.lines:
+        ranked = ranked[:args.lines]
+
+    print('%d samples' % total)
+    for name, counts in ranked:
+        n = sum(counts.values())
+        print('%6.2f%% %8d  %s' % (100.0 * n / total, n, name))
+        if args.tasks:
+            for task_name, c in sorted(counts.items(), key=lambda kv: -kv[1]):
+                print('        %8d    %s' % (c, task_name))
+
+
+if __name__ == '__main__':
+    main()
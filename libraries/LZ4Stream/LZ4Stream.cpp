@@ -0,0 +1,215 @@
+/*
+ * LZ4Stream.cpp - LZ4 compression of a byte stream into any Print
+ *
+ * The frame format is that of the LZ4 frame specification 1.6: magic,
+ * FLG (version 01, independent blocks, block checksums if asked), BD
+ * (64 KB maximum block) and the header checksum, then the blocks, each
+ * a little endian size word whose top bit marks stored data, then a 0
+ * size word as end mark. There is no content checksum, which would
+ * take the whole stream at once.
+ */
+
+#include "LZ4Stream.h"
+
+#include <ti/compression/lz4/lz4_xxhash.h>
+
+#define LZ4_MAGIC           0x184d2204
+#define LZ4_FLG             0x60    /* version 01, independent blocks */
+#define LZ4_FLG_CHECKSUMS   0x10
+#define LZ4_BD_64KB         0x40
+#define LZ4_STORED          0x80000000
+
+/* shorter blocks go stored, LZ4_compressBlock() needs 12 bytes */
+#define LZ4_MIN_COMPRESS    16
+
+static void put32(uint8_t *p, uint32_t value)
+{
+    p[0] = value;
+    p[1] = value >> 8;
+    p[2] = value >> 16;
+    p[3] = value >> 24;
+}
+
+LZ4Stream::LZ4Stream(void)
+{
+    out = NULL;
+    inCount = 0;
+    outCount = 0;
+}
+
+/*
+ *  ======== begin ========
+ *  Split work into the block buffer, the output buffer and the hash
+ *  table, and write the frame header
+ */
+bool LZ4Stream::begin(Print &out, void *work, size_t workSize,
+    uint16_t blockSize, bool checksums)
+{
+    uint8_t header[7];
+    uintptr_t table;
+    size_t rest;
+    uint8_t bits;
+
+    this->out = NULL;
+
+    if (blockSize == 0 || blockSize > LZ4STREAM_MAX_BLOCK ||
+        workSize < LZ4STREAM_WORK_SIZE(blockSize, LZ4STREAM_MIN_HASH_BITS)) {
+        return (false);
+    }
+
+    block = (uint8_t *)work;
+    output = block + blockSize;
+
+    /* 16 bit entries */
+    table = ((uintptr_t)(output + LZ4STREAM_OUT_SIZE(blockSize)) + 1) & ~1;
+    rest = workSize - (table - (uintptr_t)work);
+    bits = LZ4STREAM_MIN_HASH_BITS;
+    while (bits < LZ4STREAM_MAX_HASH_BITS && (2UL << bits) <= rest) {
+        bits++;
+    }
+    hashTable = (void *)table;
+    hashBits = bits;
+
+    this->blockSize = blockSize;
+    this->checksums = checksums;
+    fill = 0;
+    inCount = 0;
+    outCount = 0;
+    clearWriteError();
+
+    put32(header, LZ4_MAGIC);
+    header[4] = LZ4_FLG | (checksums ? LZ4_FLG_CHECKSUMS : 0);
+    header[5] = LZ4_BD_64KB;
+    header[6] = LZ4_xxHashCompute(header + 4, 2, 0) >> 8;
+
+    this->out = &out;
+    if (!send(header, sizeof(header))) {
+        this->out = NULL;
+        return (false);
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== send ========
+ *  All of data to out, or a write error
+ */
+bool LZ4Stream::send(const void *data, size_t size)
+{
+    if (out->write((const uint8_t *)data, size) != size) {
+        setWriteError();
+        return (false);
+    }
+    outCount += size;
+
+    return (true);
+}
+
+/*
+ *  ======== emit ========
+ *  Compress and send the buffered bytes as one block, stored if they
+ *  don't compress
+ */
+bool LZ4Stream::emit(void)
+{
+    LZ4_compressBlockParams params;
+    LZ4_status status;
+    uint32_t size = 0;
+    uint8_t word[4];
+    bool ok;
+
+    if (fill == 0) {
+        return (true);
+    }
+
+    if (fill >= LZ4_MIN_COMPRESS) {
+        params.src = block;
+        params.dst = output;
+        params.length = fill;
+        params.hashTable = hashTable;
+        params.hashLog2Size = hashBits;
+        params.addBlockChecksum = checksums;
+        size = LZ4_compressBlock(&params, &status);
+    }
+
+    /* the size word and any checksum are the same for both forms */
+    if (size != 0 && size - 4 - (checksums ? 4 : 0) < fill) {
+        ok = send(output, size);
+    }
+    else {
+        put32(word, LZ4_STORED | fill);
+        ok = send(word, 4) && send(block, fill);
+        if (ok && checksums) {
+            put32(word, LZ4_xxHashCompute(block, fill, 0));
+            ok = send(word, 4);
+        }
+    }
+    fill = 0;
+
+    return (ok);
+}
+
+size_t LZ4Stream::write(uint8_t c)
+{
+    return (write(&c, 1));
+}
+
+size_t LZ4Stream::write(const uint8_t *buffer, size_t size)
+{
+    size_t done = 0;
+    size_t n;
+
+    if (out == NULL) {
+        return (0);
+    }
+
+    while (done < size) {
+        n = blockSize - fill;
+        if (n > size - done) {
+            n = size - done;
+        }
+        memcpy(block + fill, buffer + done, n);
+        fill += n;
+        done += n;
+        inCount += n;
+
+        if (fill == blockSize && !emit()) {
+            break;
+        }
+    }
+
+    return (done);
+}
+
+/*
+ *  ======== flush ========
+ *  Send the buffered bytes now, as a block of their own
+ */
+bool LZ4Stream::flush(void)
+{
+    if (out == NULL) {
+        return (false);
+    }
+
+    return (emit());
+}
+
+/*
+ *  ======== end ========
+ *  Flush and write the end mark; begin() starts a new frame
+ */
+bool LZ4Stream::end(void)
+{
+    uint8_t mark[4] = {0, 0, 0, 0};
+    bool ok;
+
+    if (out == NULL) {
+        return (false);
+    }
+
+    ok = emit() && send(mark, sizeof(mark));
+    out = NULL;
+
+    return (ok);
+}
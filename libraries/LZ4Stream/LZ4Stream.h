@@ -0,0 +1,83 @@
+/*
+ * LZ4Stream.h - LZ4 compression of a byte stream into any Print
+ *
+ *      static uint8_t work[LZ4STREAM_WORK_SIZE(1024, 10)];
+ *      LZ4Stream lz4;
+ *
+ *      lz4.begin(client, work, sizeof(work), 1024);
+ *      lz4.write((const uint8_t *)&record, sizeof(record));
+ *      ...
+ *      lz4.flush();                // send what is buffered, e.g. per burst
+ *      lz4.end();                  // the end mark completes the frame
+ *
+ * The output is a standard LZ4 frame of independent blocks, so the
+ * lz4 command line tool or any LZ4 library decompresses it; out can be
+ * a WiFiClient, a HardwareSerial, an SD File or anything else that
+ * is a Print. Bytes collect in a block buffer, and a full block, or
+ * the partial one at flush(), is compressed with the lz4 library the
+ * core links (LZ4_compressBlock()) and written to out in one call. A
+ * block that does not shrink is sent stored, a few bytes larger than
+ * the data. Blocks don't refer to each other, so a flush() after every
+ * record costs most of the compression.
+ *
+ * No heap is used: work holds the block buffer, the output buffer and
+ * the match hash table, which gets the rest rounded down to a power of
+ * two bytes. LZ4STREAM_WORK_SIZE(blockSize, hashBits) sizes work for a
+ * 2^hashBits byte table. A bigger table finds more matches; 1 KB does
+ * well on repetitive sensor records.
+ */
+
+#ifndef LZ4Stream_h
+#define LZ4Stream_h
+
+#include <Energia.h>
+
+#include <ti/compression/lz4/lz4.h>
+
+#define LZ4STREAM_BLOCK_SIZE    1024
+#define LZ4STREAM_MAX_BLOCK     32768
+#define LZ4STREAM_MIN_HASH_BITS 8
+#define LZ4STREAM_MAX_HASH_BITS 16
+
+/* a compressed block: size word, literals and tokens, checksum */
+#define LZ4STREAM_OUT_SIZE(blockSize) ((blockSize) + (blockSize) / 255 + 24)
+
+#define LZ4STREAM_WORK_SIZE(blockSize, hashBits) \
+    ((blockSize) + LZ4STREAM_OUT_SIZE(blockSize) + 1 + (1UL << (hashBits)))
+
+class LZ4Stream : public Print
+{
+    public:
+        LZ4Stream(void);
+
+        /* writes the frame header; checksums adds one per block */
+        bool begin(Print &out, void *work, size_t workSize,
+            uint16_t blockSize = LZ4STREAM_BLOCK_SIZE,
+            bool checksums = false);
+        bool flush(void);
+        bool end(void);
+
+        virtual size_t write(uint8_t c);
+        virtual size_t write(const uint8_t *buffer, size_t size);
+        using Print::write;
+
+        uint32_t bytesIn(void) { return (inCount); }
+        uint32_t bytesOut(void) { return (outCount); }
+
+    private:
+        bool send(const void *data, size_t size);
+        bool emit(void);
+
+        Print *out;
+        uint8_t *block;
+        uint8_t *output;
+        void *hashTable;
+        uint16_t blockSize;
+        uint16_t fill;
+        uint8_t hashBits;
+        bool checksums;
+        uint32_t inCount;
+        uint32_t outCount;
+};
+
+#endif
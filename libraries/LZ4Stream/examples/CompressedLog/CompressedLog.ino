@@ -0,0 +1,72 @@
+/*
+  Compressed Log
+
+  Logs A0..A2 as text records, ten a second, into an LZ4 compressed
+  file on the SD card: LOG.LZ4 holds one LZ4 frame per minute, each
+  readable on its own. On a PC, "lz4 -dc LOG.LZ4" prints the records.
+  The compression ratio is printed after every frame.
+
+  The same LZ4Stream writes to a WiFiClient or to Serial1 just as
+  well; everything that is a Print can be the output.
+
+  Hardware: SD card on SPI B0 (P1.5 CLK, P1.6 MOSI, P1.7 MISO), chip
+  select on pin 8 (P4.6).
+
+  This example code is in the public domain.
+*/
+
+#include <SD.h>
+#include <LZ4Stream.h>
+
+#define BLOCK_SIZE  2048
+#define HASH_BITS   11
+
+const uint8_t pins[] = {A0, A1, A2};
+
+uint8_t work[LZ4STREAM_WORK_SIZE(BLOCK_SIZE, HASH_BITS)];
+LZ4Stream lz4;
+File logFile;
+unsigned long frameStart;
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+
+  if (!SD.begin()) {
+    Serial.println("card failed, or not present");
+    for (;;);
+  }
+
+  logFile = SD.open("log.lz4", FILE_WRITE);
+  if (!logFile || !lz4.begin(logFile, work, sizeof(work), BLOCK_SIZE)) {
+    Serial.println("error opening log.lz4");
+    for (;;);
+  }
+  frameStart = millis();
+}
+
+void loop()
+{
+  lz4.print(millis());
+  for (int i = 0; i < 3; i++) {
+    lz4.print(',');
+    lz4.print(analogRead(pins[i]));
+  }
+  lz4.println();
+
+  if (millis() - frameStart >= 60000) {
+    lz4.end();
+    logFile.flush();
+
+    Serial.print(lz4.bytesIn());
+    Serial.print(" bytes logged in ");
+    Serial.print(lz4.bytesOut());
+    Serial.println(" bytes");
+
+    lz4.begin(logFile, work, sizeof(work), BLOCK_SIZE);
+    frameStart = millis();
+  }
+
+  delay(100);
+}
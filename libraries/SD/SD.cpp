@@ -0,0 +1,787 @@
+/*
+ * SD.cpp - Arduino style SD card library on the SDSPI driver and FatFs
+ *
+ * FatFs is built reentrant: every f_*() call holds the volume's lock,
+ * so the writer task and sketch tasks can use it side by side. A
+ * file's FIL belongs to the writer for as long as it has queued
+ * buffers; everything else a File does to its FIL waits for them to
+ * be written first (drain()).
+ */
+
+#include "SD.h"
+#include "SDDisk.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <xdc/runtime/Error.h>
+
+#include <third_party/fatfs/diskio.h>
+
+/* FatFs drive of the card, and its SDSPI_config[] entry */
+#define SD_DRIVE        0
+#define SD_SDSPI_INDEX  0
+
+SDClass SD;
+
+/*
+ *  ======== File ========
+ */
+File::File(void)
+{
+    _file = NULL;
+}
+
+File::File(SDFile *file)
+{
+    _file = file;
+}
+
+/*
+ *  ======== write ========
+ *  Copy into the head buffer, queueing it for the writer once it
+ *  reaches the end of its sector
+ */
+size_t File::write(const uint8_t *buf, size_t size)
+{
+    size_t left = size;
+    uint16_t room;
+
+    if (_file == NULL || _file->buffers == NULL || _file->error) {
+        return (0);
+    }
+
+    while (left) {
+        room = SD_SECTOR_SIZE - _file->headPos % SD_SECTOR_SIZE -
+            _file->fill;
+        if (room > left) {
+            room = left;
+        }
+
+        memcpy(&_file->buffers[_file->head][_file->fill], buf, room);
+        _file->fill += room;
+        buf += room;
+        left -= room;
+
+        if ((_file->headPos + _file->fill) % SD_SECTOR_SIZE == 0) {
+            if (!queueHead()) {
+                return (size - left);
+            }
+        }
+    }
+
+    return (size);
+}
+
+size_t File::write(uint8_t c)
+{
+    return (write(&c, 1));
+}
+
+/*
+ *  ======== queueHead ========
+ *  Hand the head buffer to the writer and move on to the next, waiting
+ *  only if they are all queued
+ */
+bool File::queueHead(void)
+{
+    UInt key;
+
+    _file->lengths[_file->head] = _file->fill;
+    _file->headPos += _file->fill;
+    if (_file->headPos > _file->end) {
+        _file->end = _file->headPos;
+    }
+    _file->fill = 0;
+    _file->head = (_file->head + 1) % SD_WRITE_BUFFERS;
+
+    key = Task_disable();
+    _file->queued++;
+    Task_restore(key);
+
+    Semaphore_post(Semaphore_handle(&SD.writerSem));
+
+    /* the card is behind by every buffer we have */
+    while (_file->queued == SD_WRITE_BUFFERS) {
+        Semaphore_pend(Semaphore_handle(&_file->done), BIOS_WAIT_FOREVER);
+    }
+
+    return (!_file->error);
+}
+
+/*
+ *  ======== drain ========
+ *  Wait for the writer to be done with the queued buffers
+ */
+void File::drain(void)
+{
+    while (_file->queued != 0) {
+        Semaphore_pend(Semaphore_handle(&_file->done), BIOS_WAIT_FOREVER);
+    }
+}
+
+/*
+ *  ======== commit ========
+ *  Write out everything buffered, the partial head buffer included,
+ *  leaving the FIL to the caller
+ */
+bool File::commit(void)
+{
+    UINT written;
+
+    if (_file->buffers == NULL) {
+        return (true);
+    }
+
+    drain();
+
+    if (_file->fill != 0) {
+        if (f_write(&_file->fil, _file->buffers[_file->head], _file->fill,
+            &written) != FR_OK || written != _file->fill) {
+            _file->error = true;
+        }
+        _file->headPos += _file->fill;
+        if (_file->headPos > _file->end) {
+            _file->end = _file->headPos;
+        }
+        _file->fill = 0;
+    }
+
+    return (!_file->error);
+}
+
+/*
+ *  ======== flush ========
+ *  Write out the buffers and commit the file's size and clusters to
+ *  the card
+ */
+void File::flush(void)
+{
+    if (_file == NULL || _file->isDir || _file->buffers == NULL) {
+        return;
+    }
+
+    commit();
+    if (f_sync(&_file->fil) != FR_OK) {
+        _file->error = true;
+    }
+}
+
+int File::read(void *buf, uint16_t nbyte)
+{
+    UINT count;
+
+    if (_file == NULL || _file->isDir || !commit()) {
+        return (-1);
+    }
+
+    if (f_read(&_file->fil, buf, nbyte, &count) != FR_OK) {
+        return (-1);
+    }
+
+    return (count);
+}
+
+int File::read(void)
+{
+    uint8_t c;
+
+    return (read(&c, 1) == 1 ? c : -1);
+}
+
+int File::peek(void)
+{
+    int c = read();
+
+    if (c != -1) {
+        f_lseek(&_file->fil, f_tell(&_file->fil) - 1);
+    }
+
+    return (c);
+}
+
+int File::available(void)
+{
+    uint32_t left;
+
+    if (_file == NULL || _file->isDir) {
+        return (0);
+    }
+
+    left = size() - position();
+
+    return (left > 0x7fff ? 0x7fff : left);
+}
+
+bool File::seek(uint32_t pos)
+{
+    if (_file == NULL || _file->isDir || !commit()) {
+        return (false);
+    }
+
+    if (sdFileSeek(&_file->fil, &_file->map, pos) != FR_OK) {
+        return (false);
+    }
+    _file->headPos = f_tell(&_file->fil);
+
+    return (true);
+}
+
+uint32_t File::position(void)
+{
+    if (_file == NULL || _file->isDir) {
+        return (0);
+    }
+
+    if (_file->buffers != NULL) {
+        return (_file->headPos + _file->fill);
+    }
+
+    return (f_tell(&_file->fil));
+}
+
+/*
+ *  ======== size ========
+ *  The size once the buffers are written; of a preallocated file, the
+ *  size close() trims it to
+ */
+uint32_t File::size(void)
+{
+    uint32_t end;
+    uint32_t size;
+
+    if (_file == NULL || _file->isDir) {
+        return (0);
+    }
+
+    end = position();
+    size = _file->preallocated ? _file->end : f_size(&_file->fil);
+
+    return (size > end ? size : end);
+}
+
+/*
+ *  ======== preallocate ========
+ *  Give an empty file open for writing length bytes of contiguous
+ *  clusters. If the card has no run that long, link them wherever
+ *  they are free by seeking FatFs past the end. Fails if the card has
+ *  less free space.
+ */
+bool File::preallocate(uint32_t length)
+{
+    if (_file == NULL || _file->isDir || _file->buffers == NULL ||
+        _file->preallocated || size() != 0 || !commit()) {
+        return (false);
+    }
+
+    if (sdFileExpand(&_file->fil, length) != FR_OK &&
+        (f_lseek(&_file->fil, length) != FR_OK ||
+        f_tell(&_file->fil) != length)) {
+        /* the card filled up: give back what was linked */
+        if (f_lseek(&_file->fil, 0) == FR_OK) {
+            f_truncate(&_file->fil);
+        }
+        return (false);
+    }
+    _file->preallocated = true;
+
+    return (f_lseek(&_file->fil, _file->headPos) == FR_OK);
+}
+
+/*
+ *  ======== fastSeek ========
+ *  Map all of the file's clusters now rather than as seeks reach them.
+ *  False if they are in more than SD_LINK_MAP_RUNS runs; seek() then
+ *  follows the FAT past the last run mapped.
+ */
+bool File::fastSeek(void)
+{
+    if (_file == NULL || _file->isDir || !commit()) {
+        return (false);
+    }
+
+    return (sdFileMap(&_file->fil, &_file->map));
+}
+
+void File::close(void)
+{
+    if (_file == NULL) {
+        return;
+    }
+
+    if (_file->isDir) {
+        f_closedir(&_file->dir);
+    }
+    else {
+        if (_file->buffers != NULL) {
+            commit();
+            SD.detach(_file);
+            Semaphore_destruct(&_file->done);
+            free(_file->buffers);
+
+            /* give back the preallocated clusters past the data */
+            if (_file->preallocated &&
+                f_lseek(&_file->fil, _file->end) == FR_OK) {
+                f_truncate(&_file->fil);
+            }
+        }
+        f_close(&_file->fil);
+    }
+
+    free(_file);
+    _file = NULL;
+}
+
+File::operator bool(void)
+{
+    return (_file != NULL);
+}
+
+char *File::name(void)
+{
+    return (_file != NULL ? _file->name : NULL);
+}
+
+bool File::isDirectory(void)
+{
+    return (_file != NULL && _file->isDir);
+}
+
+/*
+ *  ======== openNextFile ========
+ *  The next entry of a directory, skipping "." and ".."
+ */
+File File::openNextFile(uint8_t mode)
+{
+    char path[SD_PATH_MAX];
+    FILINFO info;
+    size_t length;
+
+    if (_file == NULL || !_file->isDir) {
+        return (File());
+    }
+
+    do {
+        if (f_readdir(&_file->dir, &info) != FR_OK || info.fname[0] == 0) {
+            return (File());
+        }
+    } while (info.fname[0] == '.');
+
+    length = strlen(_file->path);
+    if (length + 1 + strlen(info.fname) >= SD_PATH_MAX) {
+        return (File());
+    }
+
+    strcpy(path, _file->path);
+    if (length == 0 || path[length - 1] != '/') {
+        path[length++] = '/';
+    }
+    strcpy(&path[length], info.fname);
+
+    return (SD.open(path, mode));
+}
+
+void File::rewindDirectory(void)
+{
+    if (_file != NULL && _file->isDir) {
+        f_readdir(&_file->dir, NULL);
+    }
+}
+
+/*
+ *  ======== SDClass ========
+ */
+SDClass::SDClass(void)
+{
+    sdspi = NULL;
+    writer = NULL;
+    writing = NULL;
+    ramDisk = NULL;
+}
+
+/*
+ *  ======== startWriter ========
+ *  Create the SD writer task, once
+ */
+bool SDClass::startWriter(void)
+{
+    Semaphore_Params semParams;
+    Task_Params taskParams;
+
+    if (writer != NULL) {
+        return (true);
+    }
+
+    Semaphore_Params_init(&semParams);
+    semParams.mode = Semaphore_Mode_COUNTING;
+    Semaphore_construct(&writerSem, 0, &semParams);
+
+    Task_Params_init(&taskParams);
+    taskParams.arg0 = (UArg)this;
+    taskParams.stackSize = 1024;
+    taskParams.priority = SD_WRITER_PRIORITY;
+    taskParams.instance->name = (xdc_String)"sd";
+
+    writer = Task_create(writerFxn, &taskParams, Error_IGNORE);
+    if (writer == NULL) {
+        Semaphore_destruct(&writerSem);
+        return (false);
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== begin ========
+ *  Open the SDSPI driver at bitRate and mount the card. Returns false
+ *  if there is no card or no FAT file system on it.
+ */
+bool SDClass::begin(uint8_t csPin, uint32_t bitRate)
+{
+    static bool sdspiInitialized = false;
+    SDSPI_Params params;
+    char path[SD_PATH_MAX];
+    DWORD clusters;
+    FATFS *fs;
+
+    if (sdspi != NULL) {
+        return (true);
+    }
+
+    if (csPin != SD_CHIP_SELECT) {
+        return (false);
+    }
+
+    if (!startWriter()) {
+        return (false);
+    }
+
+    if (!sdspiInitialized) {
+        SDSPI_init();
+        sdspiInitialized = true;
+    }
+
+    SDSPI_Params_init(&params);
+    params.bitRate = bitRate;
+
+    sdspi = SDSPI_open(SD_SDSPI_INDEX, SD_DRIVE, &params);
+    if (sdspi == NULL) {
+        return (false);
+    }
+
+    if (!sdDiskBegin(SD_DRIVE, sdspi)) {
+        end();
+        return (false);
+    }
+
+    /* FatFs mounts on first use: make it happen now */
+    makePath(path, "");
+    if (f_getfree(path, &clusters, &fs) != FR_OK) {
+        end();
+        return (false);
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== end ========
+ *  Unmount the card; files must be closed first
+ */
+void SDClass::end(void)
+{
+    if (sdspi != NULL) {
+        sdDiskEnd(SD_DRIVE);
+        SDSPI_close(sdspi);
+        sdspi = NULL;
+    }
+}
+
+/*
+ *  ======== beginRamDisk ========
+ *  Format a RAM disk of bytes on SD_RAM_DRIVE
+ */
+bool SDClass::beginRamDisk(uint32_t bytes)
+{
+    if (ramDisk != NULL) {
+        return (true);
+    }
+
+    if (!startWriter()) {
+        return (false);
+    }
+
+    ramDisk = (uint8_t *)malloc(bytes);
+    if (ramDisk == NULL) {
+        return (false);
+    }
+
+    if (!sdDiskFormatRam(ramDisk, bytes)) {
+        free(ramDisk);
+        ramDisk = NULL;
+        return (false);
+    }
+
+    if (ramdisk_start(SD_RAM_DRIVE, ramDisk, bytes, 0) != RES_OK) {
+        ramdisk_stop(SD_RAM_DRIVE);
+        free(ramDisk);
+        ramDisk = NULL;
+        return (false);
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== endRamDisk ========
+ *  Drop the RAM disk and its files, which must be closed first
+ */
+void SDClass::endRamDisk(void)
+{
+    if (ramDisk != NULL) {
+        ramdisk_stop(SD_RAM_DRIVE);
+        free(ramDisk);
+        ramDisk = NULL;
+    }
+}
+
+/*
+ *  ======== open ========
+ *  Open a file or a directory. FILE_WRITE creates the file if needed
+ *  and starts at its end.
+ */
+File SDClass::open(const char *filepath, uint8_t mode)
+{
+    char path[SD_PATH_MAX];
+    Semaphore_Params semParams;
+    FILINFO info;
+    SDFile *file;
+    const char *local;
+    const char *name;
+    bool root;
+
+    if (!mounted(filepath) || strlen(filepath) + 3 >= SD_PATH_MAX) {
+        return (File());
+    }
+
+    file = (SDFile *)calloc(1, sizeof(SDFile));
+    if (file == NULL) {
+        return (File());
+    }
+
+    makePath(path, filepath);
+    local = skipDrive(filepath);
+    name = strrchr(local, '/');
+    name = name != NULL ? name + 1 : local;
+    root = (*name == '\0') && strspn(local, "/") == strlen(local);
+
+    if (root || (f_stat(path, &info) == FR_OK && (info.fattrib & AM_DIR))) {
+        if (f_opendir(&file->dir, path) != FR_OK) {
+            free(file);
+            return (File());
+        }
+        file->isDir = true;
+        strcpy(file->path, filepath);
+        strncpy(file->name, root ? "/" : name, sizeof(file->name) - 1);
+        return (File(file));
+    }
+
+    if (f_open(&file->fil, path, mode) != FR_OK) {
+        free(file);
+        return (File());
+    }
+    strncpy(file->name, name, sizeof(file->name) - 1);
+
+    if (mode & FA_WRITE) {
+        file->buffers = (uint8_t (*)[SD_SECTOR_SIZE])malloc(
+            SD_WRITE_BUFFERS * SD_SECTOR_SIZE);
+        if (file->buffers == NULL ||
+            f_lseek(&file->fil, f_size(&file->fil)) != FR_OK) {
+            free(file->buffers);
+            f_close(&file->fil);
+            free(file);
+            return (File());
+        }
+        file->headPos = f_size(&file->fil);
+        file->end = file->headPos;
+
+        Semaphore_Params_init(&semParams);
+        semParams.mode = Semaphore_Mode_BINARY;
+        Semaphore_construct(&file->done, 0, &semParams);
+
+        attach(file);
+    }
+
+    return (File(file));
+}
+
+bool SDClass::exists(const char *filepath)
+{
+    char path[SD_PATH_MAX];
+    const char *local = skipDrive(filepath);
+    FILINFO info;
+
+    if (strspn(local, "/") == strlen(local)) {
+        return (mounted(filepath));
+    }
+    makePath(path, filepath);
+
+    return (f_stat(path, &info) == FR_OK);
+}
+
+bool SDClass::mkdir(const char *filepath)
+{
+    char path[SD_PATH_MAX];
+
+    makePath(path, filepath);
+
+    return (f_mkdir(path) == FR_OK);
+}
+
+bool SDClass::remove(const char *filepath)
+{
+    char path[SD_PATH_MAX];
+
+    makePath(path, filepath);
+
+    return (f_unlink(path) == FR_OK);
+}
+
+/* FatFs only removes empty directories */
+bool SDClass::rmdir(const char *filepath)
+{
+    return (remove(filepath));
+}
+
+bool SDClass::rename(const char *from, const char *to)
+{
+    char pathFrom[SD_PATH_MAX];
+    char pathTo[SD_PATH_MAX];
+
+    makePath(pathFrom, from);
+    makePath(pathTo, to);
+
+    return (f_rename(pathFrom, pathTo) == FR_OK);
+}
+
+/*
+ *  ======== makePath ========
+ *  filepath, absolute or not, on the card's drive unless it names
+ *  another
+ */
+void SDClass::makePath(char *path, const char *filepath)
+{
+    const char *local = skipDrive(filepath);
+
+    path[0] = local != filepath ? filepath[0] : '0' + SD_DRIVE;
+    path[1] = ':';
+    filepath = local;
+    path[2] = '/';
+    while (*filepath == '/') {
+        filepath++;
+    }
+    strncpy(&path[3], filepath, SD_PATH_MAX - 4);
+    path[SD_PATH_MAX - 1] = '\0';
+}
+
+/*
+ *  ======== skipDrive ========
+ *  filepath past a "N:" drive prefix
+ */
+const char *SDClass::skipDrive(const char *filepath)
+{
+    if (filepath[0] >= '0' && filepath[0] <= '9' && filepath[1] == ':') {
+        return (filepath + 2);
+    }
+
+    return (filepath);
+}
+
+/*
+ *  ======== mounted ========
+ *  Whether the drive of filepath is up
+ */
+bool SDClass::mounted(const char *filepath)
+{
+    int drive = SD_DRIVE;
+
+    if (skipDrive(filepath) != filepath) {
+        drive = filepath[0] - '0';
+    }
+
+    if (drive == SD_DRIVE) {
+        return (sdspi != NULL);
+    }
+
+    return (drive == SD_RAM_DRIVE && ramDisk != NULL);
+}
+
+/*
+ *  ======== attach ========
+ *  Put a file with a write-behind cache on the writer's list
+ */
+void SDClass::attach(SDFile *file)
+{
+    UInt key;
+
+    key = Task_disable();
+    file->next = writing;
+    writing = file;
+    Task_restore(key);
+}
+
+/*
+ *  ======== detach ========
+ *  Take a drained file off the writer's list
+ */
+void SDClass::detach(SDFile *file)
+{
+    SDFile **p;
+    UInt key;
+
+    key = Task_disable();
+    for (p = &writing; *p != NULL; p = &(*p)->next) {
+        if (*p == file) {
+            *p = file->next;
+            break;
+        }
+    }
+    Task_restore(key);
+}
+
+/*
+ *  ======== writerFxn ========
+ *  Write the queued sectors of every file, oldest first. A file's next
+ *  pointer stays valid while its buffers are queued, as close() drains
+ *  them before taking it off the list.
+ */
+void SDClass::writerFxn(UArg arg0, UArg arg1)
+{
+    SDClass *sd = (SDClass *)arg0;
+    SDFile *file;
+    UINT written;
+    uint8_t tail;
+    UInt key;
+
+    for (;;) {
+        Semaphore_pend(Semaphore_handle(&sd->writerSem), BIOS_WAIT_FOREVER);
+
+        for (file = sd->writing; file != NULL; file = file->next) {
+            while (file->queued != 0) {
+                tail = file->tail;
+                if (f_write(&file->fil, file->buffers[tail],
+                    file->lengths[tail], &written) != FR_OK ||
+                    written != file->lengths[tail]) {
+                    file->error = true;
+                }
+
+                key = Task_disable();
+                file->tail = (tail + 1) % SD_WRITE_BUFFERS;
+                file->queued--;
+                Task_restore(key);
+
+                Semaphore_post(Semaphore_handle(&file->done));
+            }
+        }
+    }
+}
@@ -0,0 +1,219 @@
+/*
+ * SD.h - Arduino style SD card library on the SDSPI driver and FatFs
+ *
+ *      File log;
+ *
+ *      SD.begin();
+ *      log = SD.open("log.csv", FILE_WRITE);
+ *      log.println(value);         // returns as soon as it is buffered
+ *      log.flush();                // on the card once this returns
+ *
+ * Writes go through a write-behind cache: a file open for writing has
+ * SD_WRITE_BUFFERS sector buffers, aligned to the card's sectors. Once
+ * one is full it is queued for the SD writer task and the next is
+ * filled, so write() only waits when all of them are queued, that is
+ * when the card falls behind for longer than the buffers last. Full
+ * sectors reach FatFs whole, which hands them to the card without a
+ * read-modify-write of its own sector window, and back to back
+ * sectors are gathered into one multiple block write (SDDisk.h).
+ *
+ * A partly filled buffer stays in RAM until flush(), close(), a read
+ * or a seek; FatFs commits the directory entry (the size the card
+ * shows) on flush() and close() only.
+ *
+ * For large logs, preallocate() gives a new file one contiguous run
+ * of clusters up front, so writing it never searches the FAT for free
+ * space and the card sees one sector after another; close() trims it
+ * to what was written.
+ *
+ * seek() keeps a map of the file's runs of contiguous clusters, of up
+ * to SD_LINK_MAP_RUNS runs, and goes through it straight to the
+ * cluster of any offset they cover instead of following the FAT chain
+ * from the start; a preallocated file is one run. The map is filled in
+ * as seeks reach further; fastSeek() maps the whole file up front.
+ *
+ * Single sector reads, which are most of what FatFs does to the FAT
+ * and directories, go through an LRU cache of SD_CACHE_SECTORS
+ * sectors, so walking a directory or a cluster chain again does not
+ * read the card again. The cache is write-through.
+ *
+ * beginRamDisk() formats a FAT volume in RAM for scratch files, of
+ * SD_RAM_DISK_MIN to 2MB; its paths start with SD_RAM, as in
+ * SD.open(SD_RAM "/tmp.dat", FILE_WRITE). Its contents are lost on
+ * endRamDisk() and reset.
+ *
+ * Names are 8.3 (FatFs is built without long file names). The card
+ * is on the board's SDSPI entry, whose chip select is fixed in the
+ * board file; the SPI library must not drive the same EUSCI at the
+ * same time.
+ */
+
+#ifndef SD_h
+#define SD_h
+
+#include <Energia.h>
+
+#include <ti/drivers/SDSPI.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/knl/Task.h>
+
+#include <third_party/fatfs/ff.h>
+
+#define FILE_READ       FA_READ
+#define FILE_WRITE      (FA_READ | FA_WRITE | FA_OPEN_ALWAYS)   /* appends */
+
+#define SD_SECTOR_SIZE  512
+
+/* sector buffers of a file open for writing */
+#ifndef SD_WRITE_BUFFERS
+#define SD_WRITE_BUFFERS    4
+#endif
+
+/* SD writer task priority, above the tasks that write files */
+#ifndef SD_WRITER_PRIORITY
+#define SD_WRITER_PRIORITY  2
+#endif
+
+/* chip select of the LaunchPad's SDSPI entry, P4.6 */
+#define SD_CHIP_SELECT  8
+
+#define SD_PATH_MAX     64
+
+/* consecutive sectors gathered into one multiple block write, 0 for none */
+#ifndef SD_RUN_SECTORS
+#define SD_RUN_SECTORS      4
+#endif
+
+/* sectors of the card's read cache, 0 for none */
+#ifndef SD_CACHE_SECTORS
+#define SD_CACHE_SECTORS    4
+#endif
+
+/* FatFs drive of the RAM disk, and the prefix of its paths */
+#define SD_RAM_DRIVE    1
+#define SD_RAM          "1:"
+
+/* the smallest RAM disk beginRamDisk() formats */
+#define SD_RAM_DISK_MIN 16384
+
+/* runs of contiguous clusters seek() maps per file */
+#ifndef SD_LINK_MAP_RUNS
+#define SD_LINK_MAP_RUNS    8
+#endif
+
+/* where a file's clusters are, from its first cluster on */
+struct SDLinkMap {
+    DWORD sclust;               /* the first cluster, 0: nothing mapped */
+    uint8_t count;              /* runs in use */
+    struct {
+        DWORD cluster;
+        DWORD length;
+    } runs[SD_LINK_MAP_RUNS];
+};
+
+/* per open file or directory, shared by copies of a File */
+struct SDFile {
+    FIL fil;
+    DIR dir;
+    bool isDir;
+    char name[13];
+    char path[SD_PATH_MAX];     /* of a directory, as given to open() */
+    SDLinkMap map;
+    bool preallocated;          /* trimmed to end on close */
+    uint32_t end;               /* furthest offset written */
+
+    /* write-behind cache, NULL when read-only */
+    uint8_t (*buffers)[SD_SECTOR_SIZE];
+    uint16_t lengths[SD_WRITE_BUFFERS];
+    uint32_t headPos;           /* file offset of the head buffer */
+    uint16_t fill;              /* bytes in the head buffer */
+    uint8_t head;               /* buffer being filled */
+    uint8_t tail;               /* oldest queued buffer */
+    volatile uint8_t queued;    /* buffers waiting for the writer */
+    volatile bool error;        /* a queued write failed */
+    Semaphore_Struct done;      /* posted as queued buffers are written */
+    SDFile *next;               /* on the writer's list */
+};
+
+class File : public Stream
+{
+    public:
+        File(void);
+        File(SDFile *file);
+
+        virtual size_t write(uint8_t);
+        virtual size_t write(const uint8_t *buf, size_t size);
+        virtual int read(void);
+        virtual int peek(void);
+        virtual int available(void);
+        virtual void flush(void);
+        int read(void *buf, uint16_t nbyte);
+        bool seek(uint32_t pos);
+        uint32_t position(void);
+        uint32_t size(void);
+        void close(void);
+        operator bool(void);
+        char *name(void);
+
+        bool preallocate(uint32_t length);
+        bool fastSeek(void);
+
+        bool isDirectory(void);
+        File openNextFile(uint8_t mode = FILE_READ);
+        void rewindDirectory(void);
+
+        using Print::write;
+
+    private:
+        bool queueHead(void);
+        void drain(void);
+        bool commit(void);
+
+        SDFile *_file;
+};
+
+class SDClass
+{
+    public:
+        SDClass(void);
+
+        /* csPin is for compatibility; the board file has the SD's */
+        bool begin(uint8_t csPin = SD_CHIP_SELECT,
+            uint32_t bitRate = 12000000);
+        void end(void);
+
+        File open(const char *filepath, uint8_t mode = FILE_READ);
+        File open(const String &filepath, uint8_t mode = FILE_READ) {
+            return (open(filepath.c_str(), mode));
+        }
+
+        bool exists(const char *filepath);
+        bool mkdir(const char *filepath);
+        bool remove(const char *filepath);
+        bool rmdir(const char *filepath);
+        bool rename(const char *from, const char *to);
+
+        bool beginRamDisk(uint32_t bytes);
+        void endRamDisk(void);
+
+    private:
+        friend class File;
+
+        bool startWriter(void);
+        static void writerFxn(UArg arg0, UArg arg1);
+        static void makePath(char *path, const char *filepath);
+        static const char *skipDrive(const char *filepath);
+        bool mounted(const char *filepath);
+        void attach(SDFile *file);
+        void detach(SDFile *file);
+
+        SDSPI_Handle sdspi;
+        Task_Handle writer;
+        Semaphore_Struct writerSem;
+        SDFile *writing;            /* files with a write-behind cache */
+        uint8_t *ramDisk;
+};
+
+extern SDClass SD;
+
+#endif
@@ -0,0 +1,917 @@
+/*
+ * SDDisk.cpp - the SD library's disk layer between FatFs and the SDSPI driver
+ *
+ * FatFs calls these with the volume's lock held, so they never run
+ * concurrently for the one drive they serve.
+ *
+ * Reads and writes talk to the card themselves, as the prebuilt
+ * SDSPIMSP432 driver does, but with the 512 bytes of each data block
+ * on the uDMA; the driver still brings the card up and answers
+ * disk_status() and disk_ioctl().
+ */
+
+#include "SD.h"
+#include "SDDisk.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ti/drivers/Power.h>
+#include <ti/drivers/power/PowerMSP432.h>
+#include <ti/drivers/sdspi/SDSPIMSP432.h>
+
+#include <driverlib/rom.h>
+#include <driverlib/rom_map.h>
+#include <driverlib/dma.h>
+#include <driverlib/gpio.h>
+#include <driverlib/spi.h>
+
+/* the prebuilt driver's disk functions, which its header does not declare */
+extern "C" {
+DSTATUS SDSPIMSP432_diskInitialize(BYTE drv);
+DSTATUS SDSPIMSP432_diskStatus(BYTE drv);
+DRESULT SDSPIMSP432_diskRead(BYTE drv, BYTE *buf, DWORD sector, UINT count);
+DRESULT SDSPIMSP432_diskWrite(BYTE drv, const BYTE *buf, DWORD sector,
+    UINT count);
+DRESULT SDSPIMSP432_diskIOctrl(BYTE drv, BYTE ctrl, void *buf);
+}
+
+/* the prebuilt FatFs's FAT access, which its header does not declare */
+extern "C" {
+DWORD get_fat(FATFS *fs, DWORD clst);
+FRESULT put_fat(FATFS *fs, DWORD clst, DWORD val);
+}
+
+/* the commands and tokens the data path uses */
+#define CMD12               (0x40 + 12)     /* STOP_TRANSMISSION */
+#define CMD17               (0x40 + 17)     /* READ_SINGLE_BLOCK */
+#define CMD18               (0x40 + 18)     /* READ_MULTIPLE_BLOCK */
+#define CMD23               (0x40 + 23)     /* SET_WR_BLK_ERASE_COUNT (ACMD) */
+#define CMD24               (0x40 + 24)     /* WRITE_BLOCK */
+#define CMD25               (0x40 + 25)     /* WRITE_MULTIPLE_BLOCK */
+#define CMD55               (0x40 + 55)     /* APP_CMD */
+
+#define START_BLOCK_TOKEN       0xFE
+#define START_MULTIBLOCK_TOKEN  0xFC
+#define STOP_MULTIBLOCK_TOKEN   0xFD
+
+/* the driver's pin encoding */
+#define PIN_PORT(config)    (((config) >> 4) & 0xF)
+#define PIN_MASK(config)    (1 << ((config) & 0x7))
+
+/* ms the card may take to be ready or to start a block */
+#define CARD_TIMEOUT        1000
+
+/* the uDMA trigger pair of each EUSCI in SPI mode */
+static const struct {
+    uint32_t base;
+    uint32_t tx;
+    uint32_t rx;
+} dmaSources[] = {
+    {EUSCI_A0_BASE, DMA_CH0_EUSCIA0TX, DMA_CH1_EUSCIA0RX},
+    {EUSCI_A1_BASE, DMA_CH2_EUSCIA1TX, DMA_CH3_EUSCIA1RX},
+    {EUSCI_A2_BASE, DMA_CH4_EUSCIA2TX, DMA_CH5_EUSCIA2RX},
+    {EUSCI_A3_BASE, DMA_CH6_EUSCIA3TX, DMA_CH7_EUSCIA3RX},
+    {EUSCI_B0_BASE, DMA_CH0_EUSCIB0TX0, DMA_CH1_EUSCIB0RX0},
+    {EUSCI_B1_BASE, DMA_CH2_EUSCIB1TX0, DMA_CH3_EUSCIB1RX0},
+    {EUSCI_B2_BASE, DMA_CH4_EUSCIB2TX0, DMA_CH5_EUSCIB2RX0},
+    {EUSCI_B3_BASE, DMA_CH6_EUSCIB3TX0, DMA_CH7_EUSCIB3RX0}
+};
+
+/* a cached sector */
+struct CacheEntry {
+    DWORD sector;               /* CACHE_INVALID if unused */
+    DWORD used;                 /* cacheClock at the last hit */
+    BYTE data[SD_SECTOR_SIZE];
+};
+
+#define CACHE_INVALID   0xFFFFFFFF
+
+static uint8_t *run;            /* SD_RUN_SECTORS sectors, or NULL */
+static DWORD runStart;          /* sector of run[0] */
+static UINT runCount;           /* sectors in run */
+
+static CacheEntry *cache;       /* SD_CACHE_SECTORS entries, or NULL */
+static DWORD cacheClock;
+
+static SDSPI_Handle card;
+static int dmaTx = -1;          /* channels held for one disk call */
+static int dmaRx = -1;
+static Semaphore_Struct dmaDone;
+static bool dmaDoneConstructed;
+
+/*
+ *  ======== cacheDrop ========
+ *  Forget the cached copies of count sectors from sector
+ */
+static void cacheDrop(DWORD sector, UINT count)
+{
+    unsigned int i;
+
+    for (i = 0; cache != NULL && i < SD_CACHE_SECTORS; i++) {
+        if (cache[i].sector - sector < count) {
+            cache[i].sector = CACHE_INVALID;
+        }
+    }
+}
+
+/*
+ *  ======== cacheWrite ========
+ *  Write through to the cached copies, or drop them if the write failed
+ */
+static void cacheWrite(const BYTE *buf, DWORD sector, UINT count, bool ok)
+{
+    unsigned int i;
+
+    for (i = 0; cache != NULL && i < SD_CACHE_SECTORS; i++) {
+        if (cache[i].sector != CACHE_INVALID &&
+            cache[i].sector - sector < count) {
+            if (ok) {
+                memcpy(cache[i].data,
+                    buf + (cache[i].sector - sector) * SD_SECTOR_SIZE,
+                    SD_SECTOR_SIZE);
+            }
+            else {
+                cache[i].sector = CACHE_INVALID;
+            }
+        }
+    }
+}
+
+/*
+ *  ======== spiByte ========
+ *  Clock one byte out and one in, polled
+ */
+static uint8_t spiByte(uint32_t base, uint8_t out)
+{
+    while (!(MAP_SPI_getInterruptStatus(base,
+        EUSCI_A_SPI_TRANSMIT_INTERRUPT) & EUSCI_A_SPI_TRANSMIT_INTERRUPT)) {
+    }
+    MAP_SPI_transmitData(base, out);
+
+    while (!(MAP_SPI_getInterruptStatus(base,
+        EUSCI_A_SPI_RECEIVE_INTERRUPT) & EUSCI_A_SPI_RECEIVE_INTERRUPT)) {
+    }
+
+    return (MAP_SPI_receiveData(base));
+}
+
+/*
+ *  ======== waitReady ========
+ *  The card holds its output low while it is busy programming
+ */
+static bool waitReady(uint32_t base)
+{
+    uint32_t start = millis();
+
+    spiByte(base, 0xFF);
+    while (spiByte(base, 0xFF) != 0xFF) {
+        if (millis() - start > CARD_TIMEOUT) {
+            return (false);
+        }
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== sendCmd ========
+ *  Returns the R1 response, 0 when the command was accepted
+ */
+static uint8_t sendCmd(uint32_t base, uint8_t cmd, uint32_t arg)
+{
+    uint8_t res;
+    int n;
+
+    if (!waitReady(base)) {
+        return (0xFF);
+    }
+
+    spiByte(base, cmd);
+    spiByte(base, (uint8_t)(arg >> 24));
+    spiByte(base, (uint8_t)(arg >> 16));
+    spiByte(base, (uint8_t)(arg >> 8));
+    spiByte(base, (uint8_t)arg);
+    spiByte(base, 0x01);                /* no CRC in SPI mode */
+
+    /* a stuff byte follows STOP_TRANSMISSION */
+    if (cmd == CMD12) {
+        spiByte(base, 0xFF);
+    }
+
+    n = 10;
+    do {
+        res = spiByte(base, 0xFF);
+    } while ((res & 0x80) && --n);
+
+    return (res);
+}
+
+/*
+ *  ======== dmaSent ========
+ *  The TX channel has handed its last byte to the EUSCI
+ */
+static void dmaSent(uintptr_t)
+{
+    Semaphore_post(Semaphore_handle(&dmaDone));
+}
+
+/*
+ *  ======== dmaBlock ========
+ *  Clock a sector in to rx, or out of tx, over the uDMA while the task
+ *  sleeps. The other direction moves 0xFF, or into a sink.
+ */
+static void dmaBlock(uint32_t base, uint8_t *rx, const uint8_t *tx)
+{
+    static uint8_t fill = 0xFF;
+    static uint8_t sink;
+
+    /* receive first, so no byte clocked in is missed */
+    dmaTransferStart(dmaRx,
+        (volatile void *)MAP_SPI_getReceiveBufferAddressForDMA(base), false,
+        rx != NULL ? rx : &sink, SD_SECTOR_SIZE, rx != NULL, NULL, 0);
+    dmaTransferStart(dmaTx,
+        (volatile void *)MAP_SPI_getTransmitBufferAddressForDMA(base), true,
+        tx != NULL ? (void *)tx : &fill, SD_SECTOR_SIZE, tx != NULL,
+        dmaSent, 0);
+
+    Semaphore_pend(Semaphore_handle(&dmaDone), BIOS_WAIT_FOREVER);
+
+    /* the last byte or two are still being shifted in */
+    while (dmaBusy(dmaRx)) {
+    }
+}
+
+/*
+ *  ======== readBlock ========
+ */
+static bool readBlock(uint32_t base, uint8_t *buf)
+{
+    uint32_t start = millis();
+    uint8_t token;
+
+    while ((token = spiByte(base, 0xFF)) == 0xFF) {
+        if (millis() - start > CARD_TIMEOUT) {
+            return (false);
+        }
+    }
+    if (token != START_BLOCK_TOKEN) {
+        return (false);
+    }
+
+    dmaBlock(base, buf, NULL);
+
+    /* the CRC, unchecked */
+    spiByte(base, 0xFF);
+    spiByte(base, 0xFF);
+
+    return (true);
+}
+
+/*
+ *  ======== writeBlock ========
+ */
+static bool writeBlock(uint32_t base, const uint8_t *buf, uint8_t token)
+{
+    if (!waitReady(base)) {
+        return (false);
+    }
+
+    spiByte(base, token);
+    if (token == STOP_MULTIBLOCK_TOKEN) {
+        return (true);
+    }
+
+    dmaBlock(base, NULL, buf);
+
+    spiByte(base, 0xFF);
+    spiByte(base, 0xFF);
+
+    /* the data response: accepted */
+    return ((spiByte(base, 0xFF) & 0x1F) == 0x05);
+}
+
+/*
+ *  ======== dmaOpen ========
+ *  Take the card's EUSCI channels for one disk call. They are held
+ *  only that long: the SPI library takes the same ones while it is
+ *  begun on that EUSCI, and then the driver's polled loop is used.
+ */
+static bool dmaOpen(uint32_t base)
+{
+    unsigned int i;
+
+    for (i = 0; i < sizeof(dmaSources) / sizeof(dmaSources[0]); i++) {
+        if (dmaSources[i].base == base) {
+            break;
+        }
+    }
+    if (i == sizeof(dmaSources) / sizeof(dmaSources[0])) {
+        return (false);
+    }
+
+    dmaTx = dmaAllocate(dmaSources[i].tx);
+    dmaRx = dmaAllocate(dmaSources[i].rx);
+    if (dmaTx < 0 || dmaRx < 0) {
+        dmaFree(dmaTx);
+        dmaFree(dmaRx);
+        return (false);
+    }
+
+    return (true);
+}
+
+static void dmaClose(void)
+{
+    dmaFree(dmaTx);
+    dmaFree(dmaRx);
+    dmaTx = dmaRx = -1;
+}
+
+/*
+ *  ======== cardRead ========
+ *  The driver's diskRead() with the data blocks moved by the uDMA
+ */
+static DRESULT cardRead(BYTE drive, BYTE *buf, DWORD sector, UINT count)
+{
+    SDSPIMSP432_Object *object;
+    SDSPIMSP432_HWAttrsV1 const *hwAttrs;
+    uint32_t base;
+
+    if (card == NULL) {
+        return (SDSPIMSP432_diskRead(drive, buf, sector, count));
+    }
+
+    object = (SDSPIMSP432_Object *)card->object;
+    hwAttrs = (SDSPIMSP432_HWAttrsV1 const *)card->hwAttrs;
+    base = hwAttrs->baseAddr;
+
+    if (count == 0 || (object->diskState & STA_NOINIT) ||
+        !dmaOpen(base)) {
+        return (SDSPIMSP432_diskRead(drive, buf, sector, count));
+    }
+
+    Power_setConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    /* SDSC cards are addressed in bytes */
+    if (object->cardType != SDSPIMSP432_SDHC) {
+        sector *= SD_SECTOR_SIZE;
+    }
+
+    MAP_GPIO_setOutputLowOnPin(PIN_PORT(hwAttrs->csPin),
+        PIN_MASK(hwAttrs->csPin));
+
+    if (count == 1) {
+        if (sendCmd(base, CMD17, sector) == 0 && readBlock(base, buf)) {
+            count = 0;
+        }
+    }
+    else if (sendCmd(base, CMD18, sector) == 0) {
+        do {
+            if (!readBlock(base, buf)) {
+                break;
+            }
+            buf += SD_SECTOR_SIZE;
+        } while (--count);
+
+        sendCmd(base, CMD12, 0);
+    }
+
+    MAP_GPIO_setOutputHighOnPin(PIN_PORT(hwAttrs->csPin),
+        PIN_MASK(hwAttrs->csPin));
+    spiByte(base, 0xFF);
+
+    Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+    dmaClose();
+
+    return (count ? RES_ERROR : RES_OK);
+}
+
+/*
+ *  ======== cardWrite ========
+ *  The driver's diskWrite() with the data blocks moved by the uDMA
+ */
+static DRESULT cardWrite(BYTE drive, const BYTE *buf, DWORD sector,
+    UINT count)
+{
+    SDSPIMSP432_Object *object;
+    SDSPIMSP432_HWAttrsV1 const *hwAttrs;
+    uint32_t base;
+
+    if (card == NULL) {
+        return (SDSPIMSP432_diskWrite(drive, buf, sector, count));
+    }
+
+    object = (SDSPIMSP432_Object *)card->object;
+    hwAttrs = (SDSPIMSP432_HWAttrsV1 const *)card->hwAttrs;
+    base = hwAttrs->baseAddr;
+
+    if (count == 0 || (object->diskState & (STA_NOINIT | STA_PROTECT)) ||
+        !dmaOpen(base)) {
+        return (SDSPIMSP432_diskWrite(drive, buf, sector, count));
+    }
+
+    Power_setConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+
+    if (object->cardType != SDSPIMSP432_SDHC) {
+        sector *= SD_SECTOR_SIZE;
+    }
+
+    MAP_GPIO_setOutputLowOnPin(PIN_PORT(hwAttrs->csPin),
+        PIN_MASK(hwAttrs->csPin));
+
+    if (count == 1) {
+        if (sendCmd(base, CMD24, sector) == 0 &&
+            writeBlock(base, buf, START_BLOCK_TOKEN)) {
+            count = 0;
+        }
+    }
+    else {
+        /* pre-erase the run */
+        if (object->cardType == SDSPIMSP432_SDSC ||
+            object->cardType == SDSPIMSP432_SDHC) {
+            sendCmd(base, CMD55, 0);
+            sendCmd(base, CMD23, count);
+        }
+        if (sendCmd(base, CMD25, sector) == 0) {
+            do {
+                if (!writeBlock(base, buf, START_MULTIBLOCK_TOKEN)) {
+                    break;
+                }
+                buf += SD_SECTOR_SIZE;
+            } while (--count);
+
+            if (!writeBlock(base, NULL, STOP_MULTIBLOCK_TOKEN)) {
+                count = 1;
+            }
+        }
+    }
+
+    MAP_GPIO_setOutputHighOnPin(PIN_PORT(hwAttrs->csPin),
+        PIN_MASK(hwAttrs->csPin));
+    spiByte(base, 0xFF);
+
+    Power_releaseConstraint(PowerMSP432_DISALLOW_PERF_CHANGES);
+    dmaClose();
+
+    return (count ? RES_ERROR : RES_OK);
+}
+
+/*
+ *  ======== writeRun ========
+ *  Write out the gathered sectors, if any
+ */
+static DRESULT writeRun(BYTE drive)
+{
+    DRESULT res = RES_OK;
+
+    if (runCount != 0) {
+        res = cardWrite(drive, run, runStart, runCount);
+        if (res != RES_OK) {
+            cacheDrop(runStart, runCount);
+        }
+        runCount = 0;
+    }
+
+    return (res);
+}
+
+/*
+ *  ======== readCard ========
+ *  Sectors of the run are written out first, so the card has them
+ */
+static DRESULT readCard(BYTE drive, BYTE *buf, DWORD sector, UINT count)
+{
+    if (runCount != 0 && sector < runStart + runCount &&
+        sector + count > runStart) {
+        if (writeRun(drive) != RES_OK) {
+            return (RES_ERROR);
+        }
+    }
+
+    return (cardRead(drive, buf, sector, count));
+}
+
+/*
+ *  ======== writeCard ========
+ *  Add to the run if this continues it, else start a new one
+ */
+static DRESULT writeCard(BYTE drive, const BYTE *buf, DWORD sector,
+    UINT count)
+{
+    if (run == NULL) {
+        return (cardWrite(drive, buf, sector, count));
+    }
+
+    if (runCount != 0 && sector == runStart + runCount &&
+        runCount + count <= SD_RUN_SECTORS) {
+        memcpy(&run[runCount * SD_SECTOR_SIZE], buf, count * SD_SECTOR_SIZE);
+        runCount += count;
+
+        return (runCount == SD_RUN_SECTORS ? writeRun(drive) : RES_OK);
+    }
+
+    if (writeRun(drive) != RES_OK) {
+        return (RES_ERROR);
+    }
+
+    /* a run's worth already is one multiple block write */
+    if (count >= SD_RUN_SECTORS) {
+        return (cardWrite(drive, buf, sector, count));
+    }
+
+    memcpy(run, buf, count * SD_SECTOR_SIZE);
+    runStart = sector;
+    runCount = count;
+
+    return (RES_OK);
+}
+
+/*
+ *  ======== diskInitialize ========
+ *  The card may have been changed: forget what was gathered and cached
+ */
+static DSTATUS diskInitialize(BYTE drive)
+{
+    runCount = 0;
+    cacheDrop(0, CACHE_INVALID);
+
+    return (SDSPIMSP432_diskInitialize(drive));
+}
+
+/*
+ *  ======== diskRead ========
+ *  Single sectors, the FAT, directory and partial data sectors FatFs
+ *  reads one at a time, go through the cache, evicting the least
+ *  recently used sector on a miss
+ */
+static DRESULT diskRead(BYTE drive, BYTE *buf, DWORD sector, UINT count)
+{
+    CacheEntry *entry, *victim;
+    DRESULT res;
+    unsigned int i;
+
+    if (cache == NULL || count != 1) {
+        return (readCard(drive, buf, sector, count));
+    }
+
+    victim = &cache[0];
+    for (i = 0, entry = cache; i < SD_CACHE_SECTORS; i++, entry++) {
+        if (entry->sector == sector) {
+            memcpy(buf, entry->data, SD_SECTOR_SIZE);
+            entry->used = ++cacheClock;
+            return (RES_OK);
+        }
+        if (victim->sector != CACHE_INVALID &&
+            (entry->sector == CACHE_INVALID || entry->used < victim->used)) {
+            victim = entry;
+        }
+    }
+
+    res = readCard(drive, buf, sector, 1);
+    if (res == RES_OK) {
+        victim->sector = sector;
+        victim->used = ++cacheClock;
+        memcpy(victim->data, buf, SD_SECTOR_SIZE);
+    }
+
+    return (res);
+}
+
+/*
+ *  ======== diskWrite ========
+ */
+static DRESULT diskWrite(BYTE drive, const BYTE *buf, DWORD sector,
+    UINT count)
+{
+    DRESULT res = writeCard(drive, buf, sector, count);
+
+    cacheWrite(buf, sector, count, res == RES_OK);
+
+    return (res);
+}
+
+/*
+ *  ======== diskIOctrl ========
+ *  A CTRL_SYNC also fails if the run could not be written
+ */
+static DRESULT diskIOctrl(BYTE drive, BYTE ctrl, void *buf)
+{
+    DRESULT written = writeRun(drive);
+    DRESULT res = SDSPIMSP432_diskIOctrl(drive, ctrl, buf);
+
+    return (ctrl == CTRL_SYNC && written != RES_OK ? RES_ERROR : res);
+}
+
+/*
+ *  ======== sdDiskBegin ========
+ *  Without memory for the run or the cache the card does without
+ */
+bool sdDiskBegin(BYTE drive, SDSPI_Handle handle)
+{
+    Semaphore_Params semParams;
+
+    if (!dmaDoneConstructed) {
+        Semaphore_Params_init(&semParams);
+        semParams.mode = Semaphore_Mode_BINARY;
+        Semaphore_construct(&dmaDone, 0, &semParams);
+        dmaDoneConstructed = true;
+    }
+    card = handle;
+
+#if SD_RUN_SECTORS > 1
+    run = (uint8_t *)malloc(SD_RUN_SECTORS * SD_SECTOR_SIZE);
+#endif
+    runCount = 0;
+
+#if SD_CACHE_SECTORS > 0
+    cache = (CacheEntry *)malloc(SD_CACHE_SECTORS * sizeof(CacheEntry));
+#endif
+    cacheDrop(0, CACHE_INVALID);
+    cacheClock = 0;
+
+    return (disk_register(drive, diskInitialize, SDSPIMSP432_diskStatus,
+        diskRead, diskWrite, diskIOctrl) == RES_OK);
+}
+
+/*
+ *  ======== sdDiskEnd ========
+ */
+void sdDiskEnd(BYTE drive)
+{
+    if (run != NULL) {
+        writeRun(drive);
+        free(run);
+        run = NULL;
+    }
+
+    free(cache);
+    cache = NULL;
+
+    card = NULL;
+}
+
+/*
+ *  ======== mapCluster ========
+ *  The cluster holding the file's index'th, from the map, following
+ *  the FAT on from the last cluster mapped and adding to the map on
+ *  the way. 0 past the end of the chain or once the map is full.
+ */
+static DWORD mapCluster(FIL *fp, SDLinkMap *map, DWORD index)
+{
+    FATFS *fs = fp->fs;
+    DWORD base = 0;
+    DWORD clst;
+    DWORD next;
+    int i;
+
+    if (map->sclust != fp->sclust) {
+        map->sclust = fp->sclust;
+        map->count = 0;
+    }
+    if (map->sclust == 0) {
+        return (0);
+    }
+    if (map->count == 0) {
+        map->runs[0].cluster = map->sclust;
+        map->runs[0].length = 1;
+        map->count = 1;
+    }
+
+    for (i = 0; i < map->count; i++) {
+        if (index < base + map->runs[i].length) {
+            return (map->runs[i].cluster + (index - base));
+        }
+        base += map->runs[i].length;
+    }
+
+    i = map->count - 1;
+    clst = map->runs[i].cluster + map->runs[i].length - 1;
+
+    if (!ff_req_grant(fs->sobj)) {
+        return (0);
+    }
+    while (base <= index) {
+        next = get_fat(fs, clst);
+        if (next < 2 || next >= fs->n_fatent) {
+            /* the end of the chain, or a disk error */
+            clst = 0;
+            break;
+        }
+
+        if (next == clst + 1) {
+            map->runs[i].length++;
+        }
+        else if (++i < SD_LINK_MAP_RUNS) {
+            map->runs[i].cluster = next;
+            map->runs[i].length = 1;
+            map->count = i + 1;
+        }
+        else {
+            clst = 0;
+            break;
+        }
+        clst = next;
+        base++;
+    }
+    ff_rel_grant(fs->sobj);
+
+    return (clst);
+}
+
+/*
+ *  ======== sdFileExpand ========
+ *  Link the first run of length bytes of free clusters after the last
+ *  one allocated to an empty file, as FatFs's f_expand() does. The
+ *  caller closes or syncs the file to write its directory entry.
+ */
+FRESULT sdFileExpand(FIL *fp, DWORD length)
+{
+    FATFS *fs = fp->fs;
+    FRESULT res = FR_OK;
+    DWORD bcs;
+    DWORD need;
+    DWORD start;
+    DWORD clst;
+    DWORD scl = 0;
+    DWORD run = 0;
+    DWORD val;
+
+    if (fs == NULL || !(fp->flag & FA_WRITE) || fp->sclust != 0 ||
+        fp->fsize != 0) {
+        return (FR_DENIED);
+    }
+    if (length == 0) {
+        return (FR_OK);
+    }
+
+    bcs = (DWORD)fs->csize * SD_SECTOR_SIZE;
+    need = length / bcs + (length % bcs != 0);
+
+    if (!ff_req_grant(fs->sobj)) {
+        return (FR_TIMEOUT);
+    }
+
+    if (fs->free_clust != 0xFFFFFFFF && fs->free_clust < need) {
+        res = FR_DENIED;
+    }
+    else {
+        start = fs->last_clust + 1;
+        if (start < 2 || start >= fs->n_fatent) {
+            start = 2;
+        }
+
+        /* first fit, from start round to start */
+        clst = start;
+        do {
+            val = get_fat(fs, clst);
+            if (val == 0xFFFFFFFF || val == 1) {
+                res = FR_DISK_ERR;
+                break;
+            }
+            if (val == 0) {
+                if (run++ == 0) {
+                    scl = clst;
+                }
+                if (run == need) {
+                    break;
+                }
+            }
+            else {
+                run = 0;
+            }
+
+            /* a run does not wrap past the end of the FAT */
+            if (++clst >= fs->n_fatent) {
+                clst = 2;
+                run = 0;
+            }
+        } while (clst != start);
+
+        if (res == FR_OK && run != need) {
+            res = FR_DENIED;
+        }
+    }
+
+    for (clst = scl; res == FR_OK && clst < scl + need - 1; clst++) {
+        res = put_fat(fs, clst, clst + 1);
+    }
+    if (res == FR_OK) {
+        res = put_fat(fs, scl + need - 1, 0x0FFFFFFF);
+    }
+    if (res == FR_OK) {
+        fs->last_clust = scl + need - 1;
+        if (fs->free_clust != 0xFFFFFFFF) {
+            fs->free_clust -= need;
+            fs->fsi_flag |= 1;
+        }
+    }
+
+    ff_rel_grant(fs->sobj);
+
+    if (res == FR_OK) {
+        fp->sclust = scl;
+        fp->fsize = length;
+        fp->flag |= FA__WRITTEN;
+    }
+
+    return (res);
+}
+
+/*
+ *  ======== sdFileSeek ========
+ *  Where the map has the cluster for ofs, hand it to f_lseek() as the
+ *  current one, so it only moves within that cluster rather than
+ *  following the FAT from the file's first.
+ */
+FRESULT sdFileSeek(FIL *fp, SDLinkMap *map, DWORD ofs)
+{
+    DWORD bcs;
+    DWORD index;
+    DWORD clst;
+
+    if (fp->fs != NULL && fp->err == 0) {
+        /* as f_lseek() clips it */
+        if (!(fp->flag & FA_WRITE) && ofs > fp->fsize) {
+            ofs = fp->fsize;
+        }
+
+        if (ofs != 0) {
+            bcs = (DWORD)fp->fs->csize * SD_SECTOR_SIZE;
+            index = (ofs - 1) / bcs;
+            clst = mapCluster(fp, map, index);
+            if (clst != 0) {
+                fp->clust = clst;
+                fp->fptr = index * bcs + 1;
+            }
+        }
+    }
+
+    return (f_lseek(fp, ofs));
+}
+
+/*
+ *  ======== sdFileMap ========
+ */
+bool sdFileMap(FIL *fp, SDLinkMap *map)
+{
+    DWORD bcs;
+
+    if (fp->fs == NULL) {
+        return (false);
+    }
+    if (fp->fsize == 0) {
+        return (true);
+    }
+
+    bcs = (DWORD)fp->fs->csize * SD_SECTOR_SIZE;
+
+    return (mapCluster(fp, map, (fp->fsize - 1) / bcs) != 0);
+}
+
+/*
+ *  ======== sdDiskFormatRam ========
+ *  Lay out a FAT12 volume of one sector clusters: the boot sector, one
+ *  FAT and a root directory of 64 entries. FatFs's own f_mkfs() wants
+ *  at least 128 sectors, all of the MSP432's SRAM, and a partition
+ *  table of another 63.
+ */
+bool sdDiskFormatRam(uint8_t *data, uint32_t bytes)
+{
+    uint32_t sectors = bytes / SD_SECTOR_SIZE;
+    uint32_t fatSectors;
+    uint8_t *boot = data;
+
+    /* FatFs takes a volume of more than 4085 clusters for FAT16 */
+    if (sectors < SD_RAM_DISK_MIN / SD_SECTOR_SIZE || sectors > 4085) {
+        return (false);
+    }
+
+    /* 12 bits for each cluster and the two reserved entries */
+    fatSectors = ((sectors + 2) * 3 / 2 + SD_SECTOR_SIZE - 1) /
+        SD_SECTOR_SIZE;
+
+    memset(data, 0, (1 + fatSectors + 4) * SD_SECTOR_SIZE);
+
+    memcpy(&boot[0], "\xEB\xFE\x90" "MSDOS5.0", 11);
+    boot[11] = SD_SECTOR_SIZE & 0xFF;           /* BPB_BytsPerSec */
+    boot[12] = SD_SECTOR_SIZE >> 8;
+    boot[13] = 1;                               /* BPB_SecPerClus */
+    boot[14] = 1;                               /* BPB_RsvdSecCnt */
+    boot[16] = 1;                               /* BPB_NumFATs */
+    boot[17] = 64;                              /* BPB_RootEntCnt */
+    boot[19] = sectors & 0xFF;                  /* BPB_TotSec16 */
+    boot[20] = sectors >> 8;
+    boot[21] = 0xF8;                            /* BPB_Media */
+    boot[22] = fatSectors & 0xFF;               /* BPB_FATSz16 */
+    boot[23] = fatSectors >> 8;
+    boot[38] = 0x29;                            /* BS_BootSig */
+    memcpy(&boot[43], "NO NAME    FAT12   ", 19); /* BS_VolLab, BS_FilSysType */
+    boot[510] = 0x55;
+    boot[511] = 0xAA;
+
+    /* the reserved entries: media type, end of chain */
+    memcpy(&data[SD_SECTOR_SIZE], "\xF8\xFF\xFF", 3);
+
+    return (true);
+}
@@ -0,0 +1,73 @@
+/*
+ * SDDisk.h - the SD library's disk layer between FatFs and the SDSPI driver
+ *
+ * SD.begin() registers these disk functions for the card's drive in
+ * place of the driver's own, which they call in turn. Consecutive
+ * sector writes, such as the writer task's one sector buffer after
+ * another, are gathered into a run of up to SD_RUN_SECTORS sectors and
+ * written as one multiple block write (CMD25, with an
+ * ACMD23 pre-erase), so a logger pays for one command and one busy
+ * wait per run instead of per sector.
+ *
+ * A run goes to the card once it is full, and before a write that
+ * does not continue it, a read of any of its sectors, any disk_ioctl()
+ * (which includes the CTRL_SYNC of f_sync() and f_close()) and
+ * sdDiskEnd(). A run that fails to write fails the call that wrote it
+ * out.
+ *
+ * Single sector reads, most of what FatFs reads of the FAT and the
+ * directories, go through a write-through LRU cache of
+ * SD_CACHE_SECTORS sectors.
+ *
+ * Data blocks move between the EUSCI and memory over the uDMA, the
+ * task sleeping meanwhile instead of polling the driver's byte loop;
+ * commands, tokens and the CRC stay polled. The two channels of the
+ * card's EUSCI are taken for each disk call. When they are held by
+ * someone else, such as the SPI library begun on the same EUSCI, the
+ * driver's own polled read and write are used.
+ *
+ * sdDiskFormatRam() lays out the FAT volume the RAM disk mounts, as
+ * the prebuilt ramdisk.c is only given formatted memory here.
+ *
+ * The prebuilt FatFs is built without f_expand() and fast seek;
+ * sdFileExpand() and sdFileSeek() do the same with the FAT access
+ * functions it exports, under the volume's lock.
+ */
+
+#ifndef SDDisk_h
+#define SDDisk_h
+
+#include <stdint.h>
+
+#include <ti/drivers/SDSPI.h>
+
+#include <third_party/fatfs/ff.h>
+#include <third_party/fatfs/diskio.h>
+
+/* after SDSPI_open() has returned handle and registered the driver */
+bool sdDiskBegin(BYTE drive, SDSPI_Handle handle);
+
+/* before SDSPI_close() */
+void sdDiskEnd(BYTE drive);
+
+/* a FAT12 volume in bytes of memory, at least SD_RAM_DISK_MIN */
+bool sdDiskFormatRam(uint8_t *data, uint32_t bytes);
+
+struct SDLinkMap;
+
+/* one contiguous run of clusters for an empty file open for writing */
+FRESULT sdFileExpand(FIL *fp, DWORD length);
+
+/* f_lseek() starting from the cluster map has for ofs, if any */
+FRESULT sdFileSeek(FIL *fp, SDLinkMap *map, DWORD ofs);
+
+/* map all of the file's clusters; false if they take more runs */
+bool sdFileMap(FIL *fp, SDLinkMap *map);
+
+/* the prebuilt ramdisk.c, which has no header */
+extern "C" {
+DRESULT ramdisk_start(BYTE drive, unsigned char *data, int numBytes, int mkfs);
+DRESULT ramdisk_stop(BYTE drive);
+}
+
+#endif
@@ -0,0 +1,54 @@
+/*
+  SD card datalogger
+
+  Logs three analog inputs to DATALOG.CSV on the LaunchPad's SD card
+  every 2 ms. Each record is a small write() that lands in the SD
+  library's sector buffers; the library's writer task puts whole
+  sectors on the card in the background, so the sampling loop keeps
+  its period while the card is busy programming. Once a second the
+  file is flushed, which commits its size to the card.
+
+  Hardware: SD card on SPI B0 (P1.5 CLK, P1.6 MOSI, P1.7 MISO), chip
+  select on pin 8 (P4.6).
+
+  This example code is in the public domain.
+*/
+
+#include <SD.h>
+
+File dataFile;
+uint32_t lastFlush;
+
+void setup()
+{
+  Serial.begin(115200);
+
+  if (!SD.begin()) {
+    Serial.println("card failed, or not present");
+    for (;;);
+  }
+
+  dataFile = SD.open("datalog.csv", FILE_WRITE);
+  if (!dataFile) {
+    Serial.println("error opening datalog.csv");
+    for (;;);
+  }
+}
+
+void loop()
+{
+  dataFile.print(millis());
+  for (int pin = A0; pin <= A2; pin++) {
+    dataFile.print(',');
+    dataFile.print(analogRead(pin));
+  }
+  dataFile.println();
+
+  if (millis() - lastFlush >= 1000) {
+    lastFlush = millis();
+    dataFile.flush();
+    Serial.println(dataFile.size());
+  }
+
+  delay(2);
+}
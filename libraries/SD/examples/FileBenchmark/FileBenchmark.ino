@@ -0,0 +1,191 @@
+/*
+  File Benchmark
+
+  Measures FatFs file I/O through the SD library: writes a FILE_SIZE
+  file in records of 16 bytes to 4 KB, flushes it, then reads it back
+  in records of the same size. For each record size it prints the
+  throughput and the latency of the write() and read() calls: average,
+  99th percentile (as the bound of its power of two bucket) and worst
+  case. write() mostly returns once the record is in the library's
+  sector buffers, so its worst case shows when SD_WRITE_BUFFERS did
+  not cover the card's busy time.
+
+  The card's cluster size is printed first. Set FORMAT_CLUSTERS to 1
+  to repeat the run for cluster sizes of 4 KB to 32 KB by formatting
+  the card before each; this ERASES the card.
+
+  Hardware: SD card on SPI B0 (P1.5 CLK, P1.6 MOSI, P1.7 MISO), chip
+  select on pin 8 (P4.6).
+
+  This example code is in the public domain.
+*/
+
+#include <SD.h>
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
+
+#define FORMAT_CLUSTERS 0                 // 1: format the card, see above
+#define FILE_SIZE       (512UL * 1024)
+#define MAX_RECORD      4096
+
+uint8_t buf[MAX_RECORD];
+
+float ticksPerUs;
+
+// latency distribution, buckets of powers of two microseconds
+struct Latency {
+  uint32_t count;
+  float totalUs;
+  float maxUs;
+  uint32_t buckets[24];
+};
+
+void reset(Latency &l)
+{
+  memset(&l, 0, sizeof(l));
+}
+
+void add(Latency &l, float us)
+{
+  int b = 0;
+
+  while (b < 23 && us >= (1UL << b)) {
+    b++;
+  }
+  l.buckets[b]++;
+  l.count++;
+  l.totalUs += us;
+  if (us > l.maxUs) {
+    l.maxUs = us;
+  }
+}
+
+uint32_t percentile(Latency &l, int p)
+{
+  uint32_t target = (l.count * p + 99) / 100;
+  uint32_t seen = 0;
+
+  for (int b = 0; b < 24; b++) {
+    seen += l.buckets[b];
+    if (seen >= target) {
+      return 1UL << b;
+    }
+  }
+  return 1UL << 23;
+}
+
+void report(const char *name, size_t record, float totalUs, Latency &l,
+  bool ok)
+{
+  Serial.print(name);
+  Serial.print(" record=");
+  Serial.print(record);
+  Serial.print(" MB/s=");
+  Serial.print(FILE_SIZE / totalUs, 3);
+  Serial.print(" avg_us=");
+  Serial.print(l.totalUs / l.count, 1);
+  Serial.print(" p99_us<");
+  Serial.print(percentile(l, 99));
+  Serial.print(" max_us=");
+  Serial.print(l.maxUs, 1);
+  Serial.println(ok ? "" : " (I/O error)");
+}
+
+void run(size_t record)
+{
+  Latency l;
+  File file;
+  uint32_t start;
+  uint32_t t;
+  bool ok = true;
+
+  SD.remove("bench.dat");
+
+  // write, the time of the final flush included
+  file = SD.open("bench.dat", FILE_WRITE);
+  if (!file) {
+    Serial.println("error opening bench.dat");
+    return;
+  }
+  reset(l);
+  start = Timestamp_get32();
+  for (uint32_t n = 0; n < FILE_SIZE; n += record) {
+    t = Timestamp_get32();
+    ok = file.write(buf, record) == record && ok;
+    add(l, (Timestamp_get32() - t) / ticksPerUs);
+  }
+  file.close();
+  report("write", record, (Timestamp_get32() - start) / ticksPerUs, l, ok);
+
+  // read
+  file = SD.open("bench.dat");
+  reset(l);
+  ok = true;
+  start = Timestamp_get32();
+  for (uint32_t n = 0; n < FILE_SIZE; n += record) {
+    t = Timestamp_get32();
+    ok = file.read(buf, record) == (int)record && ok;
+    add(l, (Timestamp_get32() - t) / ticksPerUs);
+  }
+  report("read ", record, (Timestamp_get32() - start) / ticksPerUs, l, ok);
+  file.close();
+}
+
+void runAll(void)
+{
+  DWORD freeClusters;
+  FATFS *fs;
+
+  if (f_getfree("0:", &freeClusters, &fs) == FR_OK) {
+    Serial.print("cluster size ");
+    Serial.print(fs->csize * SD_SECTOR_SIZE);
+    Serial.println(" bytes");
+  }
+
+  for (size_t record = 16; record <= MAX_RECORD; record *= 4) {
+    run(record);
+  }
+  SD.remove("bench.dat");
+  Serial.println();
+}
+
+void setup()
+{
+  Types_FreqHz freq;
+
+  Serial.begin(115200);
+  delay(1000);
+
+  Timestamp_getFreq(&freq);
+  ticksPerUs = freq.lo / 1000000.0;
+
+  for (int i = 0; i < MAX_RECORD; i++) {
+    buf[i] = (uint8_t)(i * 13 + 5);
+  }
+
+  if (!SD.begin()) {
+    Serial.println("card failed, or not present");
+    for (;;);
+  }
+
+  Serial.print("File benchmark, ");
+  Serial.print(FILE_SIZE / 1024);
+  Serial.println(" KB file");
+}
+
+void loop()
+{
+#if FORMAT_CLUSTERS
+  for (UINT cluster = 4096; cluster <= 32768; cluster *= 2) {
+    if (f_mkfs("0:", 0, cluster) != FR_OK) {
+      Serial.println("format failed");
+      continue;
+    }
+    runAll();
+  }
+#else
+  runAll();
+#endif
+
+  delay(10000);
+}
@@ -0,0 +1,192 @@
+/*
+  SD Benchmark
+
+  Measures the card's raw sector I/O below FatFs: sequential writes
+  and reads of 1 to 64 sectors per call, then single sector writes and
+  reads at random places. For each it prints the throughput and the
+  latency per call: average, 99th percentile (as the bound of its
+  power of two bucket) and worst case. The worst case write latency
+  is what a logger's buffers have to cover.
+
+  The sectors are those of BENCH.DAT, a file of TEST_SIZE bytes
+  given one contiguous run of clusters, so the benchmark never writes
+  over the file system; the file is left on the card. The card needs
+  that much contiguous free space.
+
+  Single sector reads go through the SD library's sector cache, which
+  the random reads mostly miss.
+
+  Hardware: SD card on SPI B0 (P1.5 CLK, P1.6 MOSI, P1.7 MISO), chip
+  select on pin 8 (P4.6).
+
+  This example code is in the public domain.
+*/
+
+#include <SD.h>
+#include <SDDisk.h>
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
+
+#define TEST_SIZE     (4UL * 1024 * 1024)
+#define MAX_SECTORS   64                    // per call
+#define RANDOM_CALLS  256
+
+uint8_t buf[MAX_SECTORS * SD_SECTOR_SIZE];
+
+float ticksPerUs;
+DWORD firstSector;
+DWORD sectors;
+
+// latency distribution, buckets of powers of two microseconds
+struct Latency {
+  uint32_t count;
+  float totalUs;
+  float maxUs;
+  uint32_t buckets[24];
+};
+
+void reset(Latency &l)
+{
+  memset(&l, 0, sizeof(l));
+}
+
+void add(Latency &l, float us)
+{
+  int b = 0;
+
+  while (b < 23 && us >= (1UL << b)) {
+    b++;
+  }
+  l.buckets[b]++;
+  l.count++;
+  l.totalUs += us;
+  if (us > l.maxUs) {
+    l.maxUs = us;
+  }
+}
+
+uint32_t percentile(Latency &l, int p)
+{
+  uint32_t target = (l.count * p + 99) / 100;
+  uint32_t seen = 0;
+
+  for (int b = 0; b < 24; b++) {
+    seen += l.buckets[b];
+    if (seen >= target) {
+      return 1UL << b;
+    }
+  }
+  return 1UL << 23;
+}
+
+void report(const char *name, UINT count, Latency &l, bool ok)
+{
+  Serial.print(name);
+  Serial.print(" sectors=");
+  Serial.print(count);
+  Serial.print(" MB/s=");
+  Serial.print(l.count * count * SD_SECTOR_SIZE / l.totalUs, 3);
+  Serial.print(" avg_us=");
+  Serial.print(l.totalUs / l.count, 1);
+  Serial.print(" p99_us<");
+  Serial.print(percentile(l, 99));
+  Serial.print(" max_us=");
+  Serial.print(l.maxUs, 1);
+  Serial.println(ok ? "" : " (I/O error)");
+}
+
+// time one call, in microseconds
+#define TIMED(l, ok, call) do { \
+    uint32_t start = Timestamp_get32(); \
+    ok = (call) == RES_OK && ok; \
+    add(l, (Timestamp_get32() - start) / ticksPerUs); \
+  } while (0)
+
+void sequential(UINT count)
+{
+  Latency l;
+  bool ok = true;
+
+  reset(l);
+  for (DWORD s = 0; s + count <= sectors; s += count) {
+    TIMED(l, ok, disk_write(0, buf, firstSector + s, count));
+  }
+  disk_ioctl(0, CTRL_SYNC, NULL);
+  report("seq write ", count, l, ok);
+
+  reset(l);
+  ok = true;
+  for (DWORD s = 0; s + count <= sectors; s += count) {
+    TIMED(l, ok, disk_read(0, buf, firstSector + s, count));
+  }
+  report("seq read  ", count, l, ok);
+}
+
+void random1(void)
+{
+  Latency l;
+  bool ok = true;
+
+  reset(l);
+  randomSeed(1);
+  for (int i = 0; i < RANDOM_CALLS; i++) {
+    TIMED(l, ok, disk_write(0, buf, firstSector + random(sectors), 1));
+  }
+  disk_ioctl(0, CTRL_SYNC, NULL);
+  report("rand write", 1, l, ok);
+
+  reset(l);
+  ok = true;
+  randomSeed(2);
+  for (int i = 0; i < RANDOM_CALLS; i++) {
+    TIMED(l, ok, disk_read(0, buf, firstSector + random(sectors), 1));
+  }
+  report("rand read ", 1, l, ok);
+}
+
+void setup()
+{
+  Types_FreqHz freq;
+  static FIL fil;
+
+  Serial.begin(115200);
+  delay(1000);
+
+  Timestamp_getFreq(&freq);
+  ticksPerUs = freq.lo / 1000000.0;
+
+  for (unsigned i = 0; i < sizeof(buf); i++) {
+    buf[i] = (uint8_t)(i * 13 + 5);
+  }
+
+  if (!SD.begin()) {
+    Serial.println("card failed, or not present");
+    for (;;);
+  }
+
+  // one run of clusters to test on, made afresh each time
+  if (f_open(&fil, "0:/BENCH.DAT", FA_READ | FA_WRITE | FA_OPEN_ALWAYS) != FR_OK ||
+      f_truncate(&fil) != FR_OK || sdFileExpand(&fil, TEST_SIZE) != FR_OK) {
+    Serial.println("no contiguous room for BENCH.DAT");
+    for (;;);
+  }
+  firstSector = fil.fs->database + (fil.sclust - 2) * fil.fs->csize;
+  sectors = TEST_SIZE / SD_SECTOR_SIZE;
+  f_close(&fil);
+
+  Serial.print("SD benchmark, ");
+  Serial.print(TEST_SIZE / 1024);
+  Serial.print(" KB from sector ");
+  Serial.println(firstSector);
+}
+
+void loop()
+{
+  for (UINT count = 1; count <= MAX_SECTORS; count *= 2) {
+    sequential(count);
+  }
+  random1();
+  Serial.println();
+
+  delay(10000);
+}
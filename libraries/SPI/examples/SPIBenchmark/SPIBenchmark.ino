@@ -0,0 +1,166 @@
+/*
+  SPI Benchmark
+
+  Sweeps transfer sizes from 1 byte to 4 KB over three ways of moving
+  a buffer through SPI and prints, for each size, the average time
+  per transaction, the resulting throughput and the fixed overhead
+  per transaction (time beyond the bytes' own clock time):
+
+    poll   one SPI.transfer(byte) call per byte (register polling)
+    sync   SPI.transfer(tx, rx, size), which polls below the board's
+           minDmaTransferSize and uses DMA from there on
+    dma    SPI.transferAsync(), always DMA, waiting on the done flag
+
+  It then suggests the smallest size from which DMA beats polling at
+  the current clock settings, i.e. a value for minDmaTransferSize in
+  the board file. Times come from Timestamp_get32().
+
+  Nothing needs to be connected; jumper MOSI (P1.6) to MISO (P1.7) to
+  also check the received data.
+
+  This example code is in the public domain.
+*/
+
+#include <SPI.h>
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
+
+#define BUS_CLOCK   8000000  // requested SPI clock
+#define MAX_SIZE    4096
+#define REPEAT      16       // transactions averaged per measurement
+
+uint8_t txBuf[MAX_SIZE];
+uint8_t rxBuf[MAX_SIZE];
+
+float ticksPerUs;
+unsigned long busClock;
+
+float timePoll(size_t size)
+{
+  uint32_t start = Timestamp_get32();
+
+  for (int r = 0; r < REPEAT; r++) {
+    for (size_t i = 0; i < size; i++) {
+      rxBuf[i] = SPI.transfer(txBuf[i]);
+    }
+  }
+
+  return (Timestamp_get32() - start) / ticksPerUs / REPEAT;
+}
+
+float timeSync(size_t size)
+{
+  uint32_t start = Timestamp_get32();
+
+  for (int r = 0; r < REPEAT; r++) {
+    SPI.transfer(txBuf, rxBuf, size);
+  }
+
+  return (Timestamp_get32() - start) / ticksPerUs / REPEAT;
+}
+
+float timeDma(size_t size)
+{
+  SPIAsyncTransfer xfer;
+  uint32_t start = Timestamp_get32();
+
+  xfer.txBuf = txBuf;
+  xfer.rxBuf = rxBuf;
+  xfer.count = size;
+
+  for (int r = 0; r < REPEAT; r++) {
+    SPI.transferAsync(&xfer);
+    while (!xfer.done) {
+      ;
+    }
+  }
+
+  return (Timestamp_get32() - start) / ticksPerUs / REPEAT;
+}
+
+bool verify(size_t size)
+{
+  return memcmp(txBuf, rxBuf, size) == 0;
+}
+
+void report(const char *name, size_t size, float us)
+{
+  // time the bytes themselves take on the wire
+  float wireUs = size * 8 * 1000000.0 / busClock;
+
+  Serial.print(name);
+  Serial.print(" size=");
+  Serial.print(size);
+  Serial.print(" us=");
+  Serial.print(us, 2);
+  Serial.print(" bytes/s=");
+  Serial.print((unsigned long)(size * 1000000.0 / us));
+  Serial.print(" overhead_us=");
+  Serial.print(us > wireUs ? us - wireUs : 0, 2);
+  Serial.print(verify(size) ? "" : " (no loopback)");
+  Serial.println();
+}
+
+void setup()
+{
+  Types_FreqHz freq;
+
+  Serial.begin(115200);
+  delay(1000);
+
+  Timestamp_getFreq(&freq);
+  ticksPerUs = freq.lo / 1000000.0;
+
+  for (int i = 0; i < MAX_SIZE; i++) {
+    txBuf[i] = (uint8_t)(i * 13 + 5);
+  }
+
+  SPI.begin();
+  SPI.setClock(BUS_CLOCK);
+  busClock = SPI.getClock();
+
+  Serial.print("SPI benchmark, bus clock ");
+  Serial.print(busClock);
+  Serial.println(" Hz");
+}
+
+void loop()
+{
+  size_t crossover = 0;
+
+  for (size_t size = 1; size <= MAX_SIZE; size *= 2) {
+    float poll = timePoll(size);
+    float sync = timeSync(size);
+    float dma = timeDma(size);
+
+    report("poll", size, poll);
+    report("sync", size, sync);
+    report("dma ", size, dma);
+
+    if (crossover == 0 && dma < poll) {
+      crossover = size;
+    }
+  }
+
+  // refine between the last power of two where polling still won
+  // and the one where DMA took over
+  if (crossover > 1) {
+    for (size_t size = crossover / 2 + 1; size < crossover; size++) {
+      if (timeDma(size) < timePoll(size)) {
+        crossover = size;
+        break;
+      }
+    }
+  }
+
+  Serial.print("suggested minDmaTransferSize: ");
+  if (crossover != 0) {
+    Serial.println(crossover);
+  }
+  else {
+    Serial.println("none, polling always won");
+  }
+  Serial.println();
+
+  delay(10000);
+}
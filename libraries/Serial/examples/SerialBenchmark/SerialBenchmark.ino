@@ -0,0 +1,219 @@
+/*
+  Serial Benchmark
+
+  Measures the UART path of HardwareSerial with a loopback on Serial1's
+  module (EUSCI_A2). For every combination of receive mode, buffer size
+  and baud rate it reports:
+
+    - sustained throughput in bytes/sec
+    - driver/ISR cost per byte: CPU cycles taken away from loop() while
+      a transfer is in flight, divided by the bytes moved
+    - dropped or corrupted bytes, plus rx DMA overruns
+    - worst-case time spent inside a single write() call
+
+  Times are taken with Timestamp_get32() and converted to CPU cycles
+  using the Timestamp and CPU frequencies. Results are printed to
+  Serial (the backchannel UART) as one line per run, so they can be
+  diffed between builds to catch regressions.
+
+  Hardware: connect pin 3 (P3.2, RXD) to pin 4 (P3.3, TXD).
+
+  This example code is in the public domain.
+*/
+
+#include <xdc/runtime/Timestamp.h>
+#include <xdc/runtime/Types.h>
+#include <ti/sysbios/BIOS.h>
+
+#define XFER_SIZE   4096  // bytes per throughput run
+#define CHUNK_SIZE  32    // bytes per write() call
+#define IDLE_SPINS  64    // spin iterations between available() polls
+#define TIMEOUT_MS  2000  // give up on a run after this long
+
+// one port object per receive mode, all on Serial1's module; only one
+// is open at a time
+HardwareSerial ringPort(1);                   // UART driver ring buffer
+HardwareSerial contPort(1, NULL, NULL, true); // continuous read into rxBuffer
+HardwareSerial dmaPort(1);                    // rx DMA into rxBuffer
+
+struct Mode {
+  const char *name;
+  HardwareSerial *port;
+  unsigned long rxSize;
+  unsigned long txSize;
+};
+
+const Mode modes[] = {
+  // rxSize only applies to continuous read and rx DMA modes
+  { "ring", &ringPort,  128,  128 },
+  { "ring", &ringPort,  128, 1024 },
+  { "cont", &contPort,  128,  128 },
+  { "cont", &contPort, 1024, 1024 },
+  { "dma",  &dmaPort,   256,  256 },
+  { "dma",  &dmaPort,  2048, 1024 },
+};
+
+// 115200 comes from the board's baud-rate table; the rest exercise
+// updateBaudRate()'s computed dividers
+const unsigned long bauds[] = { 115200, 230400, 460800, 921600 };
+
+uint8_t txData[XFER_SIZE];
+uint8_t rxData[CHUNK_SIZE * 4];
+
+float cyclesPerTick;
+uint32_t timeoutTicks;
+volatile unsigned long spinCount;
+
+unsigned long cpuFreq(void)
+{
+  Types_FreqHz freq;
+
+  BIOS_getCpuFreq(&freq);
+  return freq.lo;
+}
+
+unsigned long ticksToCycles(uint32_t ticks)
+{
+  return (unsigned long)(ticks * cyclesPerTick);
+}
+
+// spin for IDLE_SPINS iterations; used to see how much CPU is left
+void spin(void)
+{
+  for (int i = 0; i < IDLE_SPINS; i++) {
+    spinCount++;
+  }
+}
+
+// Timestamp ticks one spin() + available() round takes on an idle port
+float calibrate(HardwareSerial &port)
+{
+  const int rounds = 1000;
+  uint32_t start = Timestamp_get32();
+
+  for (int i = 0; i < rounds; i++) {
+    spin();
+    port.available();
+  }
+
+  return (float)(Timestamp_get32() - start) / rounds;
+}
+
+void runOne(const Mode &mode, unsigned long baud)
+{
+  HardwareSerial &port = *mode.port;
+  unsigned long sent = 0, received = 0, errors = 0, rounds = 0;
+  uint32_t start, elapsed, worstWrite = 0, writeTicks = 0;
+  float idleTicks;
+
+  port.begin(115200, mode.rxSize, mode.txSize);
+  if (baud != 115200 && !port.updateBaudRate(baud)) {
+    Serial.print(mode.name);
+    Serial.print(" baud ");
+    Serial.print(baud);
+    Serial.println(" not supported");
+    port.end();
+    return;
+  }
+
+  idleTicks = calibrate(port);
+
+  start = Timestamp_get32();
+  while (received < XFER_SIZE) {
+    int n;
+
+    if (sent < XFER_SIZE) {
+      uint32_t t0 = Timestamp_get32();
+      uint32_t t;
+
+      sent += port.write(&txData[sent], min(CHUNK_SIZE, XFER_SIZE - sent));
+      t = Timestamp_get32() - t0;
+      writeTicks += t;
+      if (t > worstWrite) {
+        worstWrite = t;
+      }
+    }
+
+    spin();
+    rounds++;
+
+    n = port.available();
+    if (n > 0) {
+      n = port.read(rxData, min((unsigned long)n, sizeof(rxData)));
+      for (int i = 0; i < n; i++) {
+        if (received + i >= XFER_SIZE || rxData[i] != txData[received + i]) {
+          errors++;
+        }
+      }
+      received += n;
+    }
+
+    if (Timestamp_get32() - start > timeoutTicks) {
+      break;
+    }
+  }
+  elapsed = Timestamp_get32() - start;
+  port.end();
+
+  // cycles not spent in spin(), write() or the calibrated available()
+  // overhead; this still includes read() and the compare loop
+  float busyTicks = (float)elapsed - writeTicks - rounds * idleTicks;
+  if (busyTicks < 0) {
+    busyTicks = 0;
+  }
+
+  Serial.print(mode.name);
+  Serial.print(" rx=");
+  Serial.print(mode.rxSize);
+  Serial.print(" tx=");
+  Serial.print(mode.txSize);
+  Serial.print(" baud=");
+  Serial.print(baud);
+  Serial.print(" bytes/s=");
+  Serial.print((unsigned long)(received / (ticksToCycles(elapsed) / (float)cpuFreq())));
+  Serial.print(" cycles/byte=");
+  Serial.print(received ? ticksToCycles(busyTicks) / received : 0);
+  Serial.print(" dropped=");
+  Serial.print(received < XFER_SIZE ? XFER_SIZE - received : 0);
+  Serial.print(" corrupt=");
+  Serial.print(errors);
+  Serial.print(" overruns=");
+  Serial.print(port.rxOverruns());
+  Serial.print(" worstWrite=");
+  Serial.print(ticksToCycles(worstWrite));
+  Serial.println(" cycles");
+}
+
+void setup()
+{
+  Types_FreqHz tsFreq;
+
+  Serial.begin(115200);
+  dmaPort.enableRxDma(true);
+  delay(1000);
+
+  Timestamp_getFreq(&tsFreq);
+  cyclesPerTick = (float)cpuFreq() / tsFreq.lo;
+  timeoutTicks = (uint32_t)((float)tsFreq.lo * TIMEOUT_MS / 1000);
+
+  for (int i = 0; i < XFER_SIZE; i++) {
+    txData[i] = (uint8_t)(i * 7 + (i >> 8));
+  }
+
+  Serial.print("Serial benchmark, CPU ");
+  Serial.print(cpuFreq());
+  Serial.print(" Hz, timestamp ");
+  Serial.print(tsFreq.lo);
+  Serial.println(" Hz");
+}
+
+void loop()
+{
+  for (unsigned int m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+    for (unsigned int b = 0; b < sizeof(bauds) / sizeof(bauds[0]); b++) {
+      runOne(modes[m], bauds[b]);
+    }
+  }
+  Serial.println();
+  delay(10000);
+}
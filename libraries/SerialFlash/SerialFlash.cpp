@@ -0,0 +1,439 @@
+/*
+ * SerialFlash.cpp - 25 series SPI NOR flash on SPIClass's DMA queue
+ *
+ * 'erasing' is set when an erase is started and cleared the first time
+ * the status register shows the chip idle again; while it is set every
+ * other command is wrapped in suspendErase()/resumeErase().
+ */
+
+#include "SerialFlash.h"
+
+#include <ti/sysbios/family/arm/m3/Hwi.h>
+
+#define CMD_WRITE           0x02    /* page program */
+#define CMD_READ_STATUS     0x05
+#define CMD_WRITE_ENABLE    0x06
+#define CMD_FAST_READ       0x0b
+#define CMD_SECTOR_ERASE    0x20    /* 4K */
+#define CMD_SUSPEND         0x75
+#define CMD_RESUME          0x7a
+#define CMD_JEDEC_ID        0x9f
+#define CMD_RELEASE_PD      0xab    /* release from deep power down */
+#define CMD_BLOCK_ERASE     0xd8    /* 64K */
+
+#define STATUS_BUSY         0x01
+
+/* status polls before waiting starts to sleep between them */
+#define SPIN_POLLS          32
+
+SerialFlashClass SerialFlash;
+
+SerialFlashClass::SerialFlashClass(void)
+{
+    spi = NULL;
+    size = 0;
+    erasing = false;
+    suspended = false;
+}
+
+/*
+ *  ======== begin ========
+ *  Wake the chip and size it from its JEDEC ID. Returns false if no
+ *  chip answers or it needs more than 3 address bytes.
+ */
+bool SerialFlashClass::begin(uint8_t csPin, SPIClass &spi)
+{
+    static const uint8_t release[] = {CMD_RELEASE_PD};
+    static const uint8_t jedec[] = {CMD_JEDEC_ID, 0xff, 0xff, 0xff};
+    Semaphore_Params semParams;
+    uint8_t id[sizeof(jedec)];
+
+    if (this->spi == NULL) {
+        Semaphore_Params_init(&semParams);
+        semParams.mode = Semaphore_Mode_BINARY;
+        Semaphore_construct(&done, 0, &semParams);
+    }
+
+    this->spi = &spi;
+    this->csPin = csPin;
+    erasing = false;
+    suspended = false;
+
+    pinMode(csPin, OUTPUT);
+    digitalWrite(csPin, HIGH);
+    spi.begin();
+
+    command(release, NULL, sizeof(release));
+    delayMicroseconds(30);
+
+    command(jedec, id, sizeof(jedec));
+    if (id[1] == 0x00 || id[1] == 0xff || id[3] < 16 || id[3] > 24) {
+        size = 0;
+        return (false);
+    }
+    size = 1UL << id[3];
+
+    return (true);
+}
+
+uint32_t SerialFlashClass::capacity(void)
+{
+    return (size);
+}
+
+/*
+ *  ======== read ========
+ *  Fast read count bytes at address, suspending a running erase
+ */
+bool SerialFlashClass::read(uint32_t address, void *buf, size_t count)
+{
+    uint8_t header[5];
+
+    if (size == 0 || address + count > size) {
+        return (false);
+    }
+    if (count == 0) {
+        return (true);
+    }
+
+    MutexLock hold(lock);
+
+    suspendErase();
+
+    header[0] = CMD_FAST_READ;
+    header[1] = address >> 16;
+    header[2] = address >> 8;
+    header[3] = address;
+    header[4] = 0xff;               /* dummy byte */
+    commandData(header, sizeof(header), NULL, buf, count);
+
+    resumeErase();
+
+    return (true);
+}
+
+/*
+ *  ======== readAsync ========
+ *  Queue a fast read and return. A running erase is suspended first,
+ *  which can take a few tens of microseconds, and its resume is queued
+ *  after the read.
+ */
+bool SerialFlashClass::readAsync(SerialFlashRead *request, uint32_t address,
+    void *buf, size_t count)
+{
+    uintptr_t key;
+
+    if (size == 0 || count == 0 || address + count > size) {
+        return (false);
+    }
+
+    MutexLock hold(lock);
+
+    suspendErase();
+
+    request->header[0] = CMD_FAST_READ;
+    request->header[1] = address >> 16;
+    request->header[2] = address >> 8;
+    request->header[3] = address;
+    request->header[4] = 0xff;
+    request->resumeCommand = CMD_RESUME;
+
+    prepare(&request->command, request->header, NULL,
+        sizeof(request->header), SPI_CONTINUE);
+    request->data.txBuf = NULL;
+    request->data.rxBuf = buf;
+    request->data.count = count;
+    request->data.ssPin = csPin;
+    request->data.transferMode = SPI_LAST;
+    request->data.dataMode = SPI_MODE0;
+    request->data.bitOrder = MSBFIRST;
+
+    key = Hwi_disable();
+    spi->transferAsync(&request->command);
+    spi->transferAsync(&request->data);
+    if (suspended) {
+        prepare(&request->resume, &request->resumeCommand, NULL, 1, SPI_LAST);
+        spi->transferAsync(&request->resume);
+        suspended = false;
+        resumedAt = micros();
+    }
+    Hwi_restore(key);
+
+    return (true);
+}
+
+/*
+ *  ======== write ========
+ *  Program count bytes at address, a page at a time. The bytes must
+ *  have been erased.
+ */
+bool SerialFlashClass::write(uint32_t address, const void *buf,
+    size_t count)
+{
+    static const uint8_t writeEnable[] = {CMD_WRITE_ENABLE};
+    const uint8_t *data = (const uint8_t *)buf;
+    uint8_t header[4];
+    size_t chunk;
+    bool ok = true;
+
+    if (size == 0 || address + count > size) {
+        return (false);
+    }
+
+    MutexLock hold(lock);
+
+    suspendErase();
+
+    while (ok && count != 0) {
+        chunk = SERIALFLASH_PAGE_SIZE - address % SERIALFLASH_PAGE_SIZE;
+        if (chunk > count) {
+            chunk = count;
+        }
+
+        command(writeEnable, NULL, sizeof(writeEnable));
+
+        header[0] = CMD_WRITE;
+        header[1] = address >> 16;
+        header[2] = address >> 8;
+        header[3] = address;
+        commandData(header, sizeof(header), data, NULL, chunk);
+
+        ok = waitWrite();
+
+        address += chunk;
+        data += chunk;
+        count -= chunk;
+    }
+
+    resumeErase();
+
+    return (ok);
+}
+
+bool SerialFlashClass::eraseSector(uint32_t address)
+{
+    if (!eraseSectorAsync(address)) {
+        return (false);
+    }
+    waitReady();
+
+    return (true);
+}
+
+bool SerialFlashClass::eraseBlock(uint32_t address)
+{
+    if (!eraseBlockAsync(address)) {
+        return (false);
+    }
+    waitReady();
+
+    return (true);
+}
+
+bool SerialFlashClass::eraseSectorAsync(uint32_t address)
+{
+    return (startErase(CMD_SECTOR_ERASE,
+        address & ~(SERIALFLASH_SECTOR_SIZE - 1)));
+}
+
+bool SerialFlashClass::eraseBlockAsync(uint32_t address)
+{
+    return (startErase(CMD_BLOCK_ERASE,
+        address & ~(SERIALFLASH_BLOCK_SIZE - 1)));
+}
+
+/*
+ *  ======== busy ========
+ *  Whether an erase started by eraseSectorAsync() or eraseBlockAsync()
+ *  is still running
+ */
+bool SerialFlashClass::busy(void)
+{
+    if (!erasing) {
+        return (false);
+    }
+
+    MutexLock hold(lock);
+
+    if (erasing && !(readStatus() & STATUS_BUSY)) {
+        erasing = false;
+    }
+
+    return (erasing);
+}
+
+/*
+ *  ======== waitReady ========
+ *  Wait for a running erase to complete
+ */
+void SerialFlashClass::waitReady(void)
+{
+    MutexLock hold(lock);
+
+    if (erasing) {
+        waitWrite();
+        erasing = false;
+    }
+}
+
+/*
+ *  ======== startErase ========
+ *  One erase runs at a time: wait for the previous one first
+ */
+bool SerialFlashClass::startErase(uint8_t opcode, uint32_t address)
+{
+    static const uint8_t writeEnable[] = {CMD_WRITE_ENABLE};
+    uint8_t erase[4];
+
+    if (size == 0 || address >= size) {
+        return (false);
+    }
+
+    MutexLock hold(lock);
+
+    if (erasing) {
+        waitWrite();
+    }
+
+    command(writeEnable, NULL, sizeof(writeEnable));
+
+    erase[0] = opcode;
+    erase[1] = address >> 16;
+    erase[2] = address >> 8;
+    erase[3] = address;
+    command(erase, NULL, sizeof(erase));
+
+    erasing = true;
+    suspended = false;
+    resumedAt = micros();
+
+    return (true);
+}
+
+/*
+ *  ======== prepare ========
+ *  Fill in a transfer framed by the chip select
+ */
+void SerialFlashClass::prepare(SPIAsyncTransfer *xfer, const void *tx,
+    void *rx, size_t count, uint8_t transferMode)
+{
+    xfer->txBuf = tx;
+    xfer->rxBuf = rx;
+    xfer->count = count;
+    xfer->ssPin = csPin;
+    xfer->transferMode = transferMode;
+    xfer->dataMode = SPI_MODE0;
+    xfer->bitOrder = MSBFIRST;
+    xfer->callback = NULL;
+    xfer->sem = NULL;
+}
+
+/*
+ *  ======== command ========
+ *  One chip select framed transfer, sleeping until it is done
+ */
+void SerialFlashClass::command(const uint8_t *tx, uint8_t *rx, size_t count)
+{
+    SPIAsyncTransfer xfer;
+
+    prepare(&xfer, tx, rx, count, SPI_LAST);
+    xfer.sem = Semaphore_handle(&done);
+
+    if (spi->transferAsync(&xfer)) {
+        Semaphore_pend(Semaphore_handle(&done), BIOS_WAIT_FOREVER);
+    }
+}
+
+/*
+ *  ======== commandData ========
+ *  A command header and its data in one chip select frame, queued
+ *  together so that nothing else queued on the port gets in between
+ */
+void SerialFlashClass::commandData(const uint8_t *header, size_t headerCount,
+    const void *tx, void *rx, size_t count)
+{
+    SPIAsyncTransfer command;
+    SPIAsyncTransfer data;
+    uintptr_t key;
+    bool queued;
+
+    prepare(&command, header, NULL, headerCount, SPI_CONTINUE);
+    prepare(&data, tx, rx, count, SPI_LAST);
+    data.sem = Semaphore_handle(&done);
+
+    key = Hwi_disable();
+    queued = spi->transferAsync(&command) && spi->transferAsync(&data);
+    Hwi_restore(key);
+
+    if (queued) {
+        Semaphore_pend(Semaphore_handle(&done), BIOS_WAIT_FOREVER);
+    }
+}
+
+uint8_t SerialFlashClass::readStatus(void)
+{
+    static const uint8_t readStatus[] = {CMD_READ_STATUS, 0xff};
+    uint8_t status[sizeof(readStatus)];
+
+    command(readStatus, status, sizeof(readStatus));
+
+    return (status[1]);
+}
+
+/*
+ *  ======== waitWrite ========
+ *  Poll until the program or erase in progress is done; a page takes
+ *  well under a millisecond, so sleeping starts after a few polls
+ */
+bool SerialFlashClass::waitWrite(void)
+{
+    uint16_t polls = 0;
+
+    while (readStatus() & STATUS_BUSY) {
+        if (++polls > SPIN_POLLS) {
+            delay(1);
+        }
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== suspendErase ========
+ *  Suspend a running erase, once it has had SERIALFLASH_RESUME_MICROS
+ *  since it was last resumed
+ */
+void SerialFlashClass::suspendErase(void)
+{
+    static const uint8_t suspend[] = {CMD_SUSPEND};
+    uint32_t ran;
+
+    if (!erasing || suspended) {
+        return;
+    }
+
+    ran = micros() - resumedAt;
+    if (ran < SERIALFLASH_RESUME_MICROS) {
+        delayMicroseconds(SERIALFLASH_RESUME_MICROS - ran);
+    }
+
+    if (!(readStatus() & STATUS_BUSY)) {
+        erasing = false;
+        return;
+    }
+
+    command(suspend, NULL, sizeof(suspend));
+    waitWrite();
+    suspended = true;
+}
+
+void SerialFlashClass::resumeErase(void)
+{
+    static const uint8_t resume[] = {CMD_RESUME};
+
+    if (suspended) {
+        command(resume, NULL, sizeof(resume));
+        suspended = false;
+        resumedAt = micros();
+    }
+}
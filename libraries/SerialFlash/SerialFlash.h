@@ -0,0 +1,107 @@
+/*
+ * SerialFlash.h - 25 series SPI NOR flash on SPIClass's DMA queue
+ *
+ *      SerialFlash.begin(18);
+ *      SerialFlash.eraseSectorAsync(0);        // returns at once
+ *      SerialFlash.read(0x10000, buf, 512);    // suspends the erase
+ *      SerialFlash.write(0x20000, buf, 512);
+ *
+ * Commands go out as transfers queued on SPIClass::transferAsync(), so
+ * page programs and fast reads (0x0B) are DMA transfers the calling
+ * task sleeps through. Each command's parts are queued together, so
+ * nothing else queued on the port gets between them; the port's clock
+ * is whatever SPIClass is set to (SPI.setClock()).
+ *
+ * Erases can run in the background: eraseSectorAsync() and
+ * eraseBlockAsync() start one and return. A read() or write() while it
+ * runs suspends it (0x75), does its work and resumes it (0x7A); the
+ * erase gets at least SERIALFLASH_RESUME_MICROS between suspends so
+ * that a busy reader cannot hold it off forever. Programming a page
+ * of the sector being erased is not allowed by the chips.
+ *
+ * The commands are those of the NVSSPI25X driver, which the board
+ * file also configures (NVS_config[1]). That driver opens the SPI
+ * port itself, so the two must not be used at the same time.
+ */
+
+#ifndef SerialFlash_h
+#define SerialFlash_h
+
+#include <Energia.h>
+#include <SPI.h>
+
+#include <ti/sysbios/knl/Semaphore.h>
+#include <Mutex.h>
+
+#define SERIALFLASH_PAGE_SIZE       256
+#define SERIALFLASH_SECTOR_SIZE     4096
+#define SERIALFLASH_BLOCK_SIZE      65536
+
+/* chip select of the BoosterPack's flash, P3.0 */
+#ifndef SERIALFLASH_CS
+#define SERIALFLASH_CS              18
+#endif
+
+/* erase progress guaranteed between two suspends */
+#ifndef SERIALFLASH_RESUME_MICROS
+#define SERIALFLASH_RESUME_MICROS   500
+#endif
+
+/*
+ *  A read queued by SerialFlashClass::readAsync(). The caller owns it
+ *  and the buffer until data.done is set; data.callback and data.sem
+ *  report completion as for SPIClass::transferAsync().
+ */
+struct SerialFlashRead {
+    SPIAsyncTransfer command;
+    SPIAsyncTransfer data;
+    SPIAsyncTransfer resume;    /* of a suspended erase */
+    uint8_t header[5];
+    uint8_t resumeCommand;
+};
+
+class SerialFlashClass
+{
+    public:
+        SerialFlashClass(void);
+
+        bool begin(uint8_t csPin = SERIALFLASH_CS, SPIClass &spi = SPI);
+        uint32_t capacity(void);
+
+        bool read(uint32_t address, void *buf, size_t count);
+        bool readAsync(SerialFlashRead *request, uint32_t address,
+            void *buf, size_t count);
+        bool write(uint32_t address, const void *buf, size_t count);
+
+        bool eraseSector(uint32_t address);
+        bool eraseBlock(uint32_t address);
+        bool eraseSectorAsync(uint32_t address);
+        bool eraseBlockAsync(uint32_t address);
+        bool busy(void);
+        void waitReady(void);
+
+    private:
+        bool startErase(uint8_t opcode, uint32_t address);
+        void command(const uint8_t *tx, uint8_t *rx, size_t count);
+        void commandData(const uint8_t *header, size_t headerCount,
+            const void *tx, void *rx, size_t count);
+        void prepare(SPIAsyncTransfer *xfer, const void *tx, void *rx,
+            size_t count, uint8_t transferMode);
+        uint8_t readStatus(void);
+        bool waitWrite(void);
+        void suspendErase(void);
+        void resumeErase(void);
+
+        SPIClass *spi;
+        uint8_t csPin;
+        uint32_t size;
+        volatile bool erasing;      /* an erase was started */
+        bool suspended;
+        uint32_t resumedAt;         /* micros() of the last resume */
+        Mutex lock;
+        Semaphore_Struct done;
+};
+
+extern SerialFlashClass SerialFlash;
+
+#endif
@@ -0,0 +1,60 @@
+/*
+  Flash logger
+
+  Logs A0 to a SPI flash chip, a 256 byte page at a time. The next
+  sector is erased in the background while the current one fills, so
+  a page write never waits for an erase; each page written is read
+  back and checked.
+
+  The flash's chip select is on pin 18 (P3.0).
+
+  This example code is in the public domain.
+*/
+
+#include <SPI.h>
+#include <SerialFlash.h>
+
+uint16_t page[SERIALFLASH_PAGE_SIZE / 2];
+uint16_t check[SERIALFLASH_PAGE_SIZE / 2];
+uint16_t samples = 0;
+uint32_t address = 0;
+
+void setup()
+{
+  Serial.begin(115200);
+
+  if (!SerialFlash.begin()) {
+    Serial.println("no flash");
+    for (;;);
+  }
+
+  Serial.print(SerialFlash.capacity() / 1024);
+  Serial.println(" KB of flash");
+
+  SerialFlash.eraseSector(0);
+  SerialFlash.eraseSectorAsync(SERIALFLASH_SECTOR_SIZE);
+}
+
+void loop()
+{
+  page[samples++] = analogRead(A0);
+  if (samples < SERIALFLASH_PAGE_SIZE / 2) {
+    delay(10);
+    return;
+  }
+  samples = 0;
+
+  SerialFlash.write(address, page, sizeof(page));
+  SerialFlash.read(address, check, sizeof(check));
+  if (memcmp(page, check, sizeof(page)) != 0) {
+    Serial.print("bad page at ");
+    Serial.println(address, HEX);
+  }
+
+  address = (address + sizeof(page)) % SerialFlash.capacity();
+  if (address % SERIALFLASH_SECTOR_SIZE == 0) {
+    /* the sector after this one */
+    SerialFlash.eraseSectorAsync((address + SERIALFLASH_SECTOR_SIZE) %
+      SerialFlash.capacity());
+  }
+}
@@ -21,6 +21,7 @@
 
 
 #include "Servo.h"
+#include <ti/runtime/wiring/wiring_private.h>
 
 #include <stdlib.h>
 
@@ -33,15 +34,32 @@ unsigned int remainderPulseWidth;
 volatile int currentServo;
 bool servoInitialized = false;
 
-Timer_Params timerParams;
-Timer_Handle timerHandle;
+static MicroTimer servoTimer;
+
+// Whether the ISR generates the pulses of a servo
+static inline bool softwareServo(int i)
+{
+	return (servos[i].enabled && !servos[i].hardware);
+}
+
+// Set a servo's pulse width, effective from its next pulse
+static void setPulseWidth(int i, unsigned int value)
+{
+	servos[i].pulse_width = value;
+	if (servos[i].hardware)
+	{
+		servoPwmWrite(&servos[i].pwm, value);
+	}
+}
 
 // Calculate the new period remainder
 static void calculatePeriodRemainder(void)
 {
 	unsigned long servoPeriodSum = 0;
 	for (int i = 0; i < SERVOS_PER_TIMER; i++){
-		servoPeriodSum += servos[i].pulse_width;
+		if (softwareServo(i)) {
+			servoPeriodSum += servos[i].pulse_width;
+		}
 	}
 	remainderPulseWidth = REFRESH_INTERVAL - servoPeriodSum;
 }
@@ -59,21 +77,11 @@ void initServo(void) {
 		servos[i].pin_number = 0;
 		servos[i].pulse_width = DEFAULT_SERVO_PULSE_WIDTH;
 		servos[i].enabled = false;
+		servos[i].hardware = false;
+		servos[i].moving = false;
 	}
 
 	calculatePeriodRemainder();
-
-
-	Error_Block eb;
-	Error_init(&eb);
-
-	Timer_Params_init(&timerParams);
-	timerParams.period = 10;
-	//timerParams.clockSource = Timer_Source_SMCLK;
-	timerParams.runMode = Timer_RunMode_ONESHOT;
-	timerParams.periodType = Timer_PeriodType_MICROSECS;
-	timerHandle = Timer_create(Timer_ANY, ServoIntHandler, &timerParams, &eb);
-
 }
 
 /** end of static functions **/
@@ -110,7 +118,9 @@ void Servo::writeMicroseconds(int value)
 	if(value < this->min) value = this->min;
 	if(value > this->max) value = this->max;
 
-	servos[this->index].pulse_width = value;
+	// A direct write overrides any motion in progress
+	servos[this->index].moving = false;
+	setPulseWidth(this->index, value);
 	calculatePeriodRemainder();
 }
 
@@ -129,6 +139,59 @@ void Servo::write(int value)
 	this->writeMicroseconds(value);
 }
 
+//! Move smoothly to the given degrees or microseconds (as for write()) over
+//! duration milliseconds, following the given easing curve. The ISR steps
+//! the pulse width once per refresh interval, so the call returns at once.
+void Servo::moveTo(int value, unsigned long duration, uint8_t easing)
+{
+	servo_t *servo = &servos[this->index];
+	unsigned long frames = duration * 1000 / REFRESH_INTERVAL;
+
+	if(value < MIN_SERVO_PULSE_WIDTH)
+	{
+		if(value < 0) value = 0;
+		if(value > 180) value = 180;
+
+		value = map(value, 0, 180, this->min,  this->max);
+	}
+	if(value < this->min) value = this->min;
+	if(value > this->max) value = this->max;
+
+	if (!servo->enabled || frames <= 1)
+	{
+		this->writeMicroseconds(value);
+		return;
+	}
+
+	// The ISR ignores the fields until moving is set again
+	servo->moving = false;
+	servo->start_width = servo->pulse_width;
+	servo->target_width = value;
+	servo->easing = easing;
+	servo->frame = 0;
+	servo->frames = frames;
+	servo->moving = true;
+
+	// Hardware servos only need the ISR for the frame tick
+	if (!microTimerActive(&servoTimer))
+	{
+		currentServo = 0;
+		microTimerStart(&servoTimer, ServoIntHandler, 0, 10, 0);
+	}
+}
+
+//! Returns true while a moveTo() is in progress
+bool Servo::moving()
+{
+	return servos[this->index].moving;
+}
+
+//! Stops a moveTo() where it is
+void Servo::stop()
+{
+	servos[this->index].moving = false;
+}
+
 //! Returns the current pulse width of the Servo's signal, in microseconds
 int Servo::readMicroseconds()
 {
@@ -161,64 +224,161 @@ unsigned int Servo::attach(unsigned int pin, int min, int max)
 	pinMode(pin, OUTPUT);
 	digitalWrite(pin, LOW);
 
-	calculatePeriodRemainder();
+	// PWM capable pins get their pulses from a Timer_A CCR, the ISR
+	// only serves the others
+	servos[this->index].hardware = servoPwmBegin(&servos[this->index].pwm,
+		pin, REFRESH_INTERVAL, servos[this->index].pulse_width);
 
 	servos[this->index].enabled = true;
 
+	if (!servos[this->index].hardware)
+	{
+		calculatePeriodRemainder();
+
+		// Pulses run on the shared microsecond timer service
+		if (!microTimerActive(&servoTimer))
+		{
+			currentServo = 0;
+			microTimerStart(&servoTimer, ServoIntHandler, 0, 10, 0);
+		}
+	}
+
 	return this->index;
 }
 
 //! Detach the Servo from its pin
 void Servo::detach()
 {
+	bool software = false;
+
 	// Disable, clean up
+	servos[this->index].moving = false;
 	servos[this->index].enabled = false;
 	servos[this->index].pulse_width = DEFAULT_SERVO_PULSE_WIDTH;
 	calculatePeriodRemainder();
 
-	digitalWrite(servos[this->index].pin_number, LOW);
+	if (servos[this->index].hardware)
+	{
+		servoPwmEnd(&servos[this->index].pwm);
+		servos[this->index].hardware = false;
+	}
+	else
+	{
+		digitalWrite(servos[this->index].pin_number, LOW);
+	}
+
+	// No pulses or motions left for the ISR
+	for (int i = 0; i < SERVOS_PER_TIMER; i++)
+	{
+		software |= softwareServo(i) || servos[i].moving;
+	}
+	if (!software)
+	{
+		microTimerStop(&servoTimer);
+	}
 }
 
-//! ISR for generating the pulse widths
-Void ServoIntHandler(UArg arg0)
+// Advance every moveTo() by one frame; returns true if any is left
+static bool updateMotions(void)
 {
+	bool moving = false;
 
-	//Timer_stop(timerHandle);
-	// Get the pulse width value for the current servo from the array
-	// and reload the timer with the new pulse width count value
-	// if we have already serviced all servos (currentServo = MAX_SERVO_NO)
-	// then this value should be the 20ms period value
-	if(currentServo < SERVOS_PER_TIMER)
-	{
-		Timer_setPeriodMicroSecs(timerHandle, servos[currentServo].pulse_width);
-	}
-	else
+	for (int i = 0; i < SERVOS_PER_TIMER; i++)
 	{
-		Timer_setPeriodMicroSecs(timerHandle, remainderPulseWidth);
+		servo_t *servo = &servos[i];
+		uint32_t f, e;
+		int delta;
+
+		if (!servo->moving)
+		{
+			continue;
+		}
+
+		// Position along the motion, 0 to 1 in 16.16 fixed point
+		servo->frame++;
+		f = ((uint32_t)servo->frame << 16) / servo->frames;
+
+		switch (servo->easing)
+		{
+		case SERVO_EASE_IN:
+			e = ((uint64_t)f * f) >> 16;
+			break;
+		case SERVO_EASE_OUT:
+			e = 65536 - (((uint64_t)(65536 - f) * (65536 - f)) >> 16);
+			break;
+		case SERVO_EASE_IN_OUT:
+			// smoothstep, 3f^2 - 2f^3
+			e = ((uint64_t)f * f) >> 16;
+			e = ((uint64_t)e * (3 * 65536 - 2 * f)) >> 16;
+			break;
+		default:
+			e = f;
+			break;
+		}
+
+		delta = (int)servo->target_width - (int)servo->start_width;
+		setPulseWidth(i, servo->start_width + ((delta * (int)e) >> 16));
+
+		if (servo->frame >= servo->frames)
+		{
+			servo->moving = false;
+		}
+		else
+		{
+			moving = true;
+		}
 	}
 
+	return moving;
+}
+
+//! ISR for generating the pulse widths
+RAMFUNC void ServoIntHandler(uintptr_t arg0)
+{
 	// End the servo pulse set previously (if any)
 	if(currentServo > 0)  // If not the 1st Servo....
 	{
-		if (servos[currentServo - 1].enabled)
+		if (softwareServo(currentServo - 1))
 		{
 			digitalWrite(servos[currentServo - 1].pin_number, LOW);
 		}
 	}
 
-	// Set the current servo pin HIGH
+	// Servos on hardware PWM, and free slots, take no time here
+	while(currentServo < SERVOS_PER_TIMER && !softwareServo(currentServo))
+	{
+		currentServo++;
+	}
+
+	// Get the pulse width value for the current servo from the array
+	// and reload the timer with the new pulse width count value
+	// if we have already serviced all servos (currentServo = MAX_SERVO_NO)
+	// then this value should be the 20ms period value
+	// (relative to this expiry, so latency doesn't stretch the frame)
 	if(currentServo < SERVOS_PER_TIMER)
 	{
-		if (servos[currentServo - 1].enabled)
-		{
-			digitalWrite(servos[currentServo].pin_number, HIGH);
-		}
+		microTimerNext(&servoTimer, servos[currentServo].pulse_width);
+
+		// Set the current servo pin HIGH
+		digitalWrite(servos[currentServo].pin_number, HIGH);
 		currentServo++;  // Advance to next servo for processing next time
 	}
 	else
 	{
+		// Step the motions at the end of the frame; the ISR keeps
+		// running for them even with only hardware servos left
+		bool moving = updateMotions();
+		bool software = false;
+
+		calculatePeriodRemainder();
+		for (int i = 0; i < SERVOS_PER_TIMER; i++)
+		{
+			software |= softwareServo(i);
+		}
+		if (software || moving)
+		{
+			microTimerNext(&servoTimer, remainderPulseWidth);
+		}
 		currentServo = 0; // Start all over again
 	}
-
-	Timer_start(timerHandle);
 }
@@ -3,10 +3,6 @@
 
 #include "Energia.h"
 #include <inttypes.h>
-#include <ti/sysbios/hal/Timer.h>
-#include <xdc/runtime/Types.h>
-#include <xdc/runtime/Error.h>
-//#include <ti/sysbios/family/arm/msp432/Timer.h>
 
 // Hardware limitations information
 #define MIN_SERVO_PULSE_WIDTH 		544
@@ -26,11 +22,26 @@
 #define SERVOS_PER_TIMER 	8
 #define INVALID_SERVO 		255
 
+// Easing curves for moveTo()
+#define SERVO_LINEAR		0
+#define SERVO_EASE_IN		1	// accelerate from rest
+#define SERVO_EASE_OUT		2	// decelerate to rest
+#define SERVO_EASE_IN_OUT	3	// both
+
 typedef struct
 {
 	unsigned int pin_number;
 	unsigned int pulse_width;
 	bool enabled;
+	bool hardware;		// pulses from a Timer_A CCR instead of the ISR
+	ServoPwm pwm;
+	// moveTo() motion, advanced by the ISR once per refresh interval
+	volatile bool moving;
+	uint8_t easing;
+	unsigned int start_width;
+	unsigned int target_width;
+	unsigned int frame;
+	unsigned int frames;
 } servo_t;
 
 class Servo
@@ -41,8 +52,6 @@ private:
 	int max;
 public:
 	Servo();
-	static Timer_Params timerParams;
-	static Timer_Handle timerHandle;
 	unsigned int attach(unsigned int pin, int min = MIN_SERVO_PULSE_WIDTH, int max = MAX_SERVO_PULSE_WIDTH);
 	void detach();
 	void writeMicroseconds(int value);
@@ -50,8 +59,11 @@ public:
 	void write(int value);
 	int read();
 	bool attached();
+	void moveTo(int value, unsigned long duration, uint8_t easing = SERVO_EASE_IN_OUT);
+	bool moving();
+	void stop();
 };
 
-extern "C" Void ServoIntHandler(UArg arg0);
+extern "C" void ServoIntHandler(uintptr_t arg0);
 
 #endif // SERVO_H
@@ -0,0 +1,31 @@
+// SmoothSweep
+// Two servos sweeping with eased motions. moveTo() returns at once and
+// the servo interrupt steps the pulse widths every 20ms, so loop() only
+// has to hand out new targets.
+// This example code is in the public domain.
+
+#include <Servo.h>
+
+Servo pan;
+Servo tilt;
+
+void setup()
+{
+  pan.attach(19);   // P2.5
+  tilt.attach(40);  // P2.7
+}
+
+void loop()
+{
+  pan.moveTo(180, 2000);                  // ease in and out over 2s
+  tilt.moveTo(135, 1000, SERVO_EASE_OUT); // arrive gently
+  while (pan.moving() || tilt.moving()) {
+    delay(10);
+  }
+
+  pan.moveTo(0, 2000);
+  tilt.moveTo(45, 1000, SERVO_LINEAR);
+  while (pan.moving() || tilt.moving()) {
+    delay(10);
+  }
+}
@@ -32,6 +32,8 @@ SLFS::SLFS(void)
     retval = SL_FS_OK;
     is_write = false;
     _readBytesInstance = NULL;
+    bufOffset = 0;
+    bufLen = 0;
 }
 
 void SLFS::begin(void)
@@ -58,6 +60,8 @@ int32_t SLFS::open(const uint8_t *filename, int32_t mode)
 
     offset = 0;
     filesize = 0;
+    bufOffset = 0;
+    bufLen = 0;
     if (mode == FS_MODE_OPEN_READ) {
         is_write = false;
 
@@ -98,17 +102,23 @@ int32_t SLFS::open(String filename, int32_t mode)
 
 int32_t SLFS::close(void)
 {
+    int32_t pending;
+
     if (!filehandle) {
         retval = SLFS_LIB_ERR_FILE_NOT_OPEN;
         return retval;
     }
     
+    pending = writePending();
     offset = 0;
     filesize = 0;
+    bufLen = 0;
     retval = sl_FsClose(filehandle, NULL, NULL, 0);
     filehandle = 0;
     is_write = false;
 
+    if (pending < 0)
+        retval = pending;  // The file is closed, but what was pending didn't all make it
     return retval;
 }
 
@@ -117,13 +127,55 @@ int32_t SLFS::seek(int32_t pos)
     retval = SL_FS_OK;
 
     if (pos >= 0 && pos <= filesize) {
+        // Pending bytes go where they were written; a read cache stays valid wherever we seek
+        if (writePending() < 0)
+            return retval;
         offset = pos;
+        if (is_write)
+            bufOffset = pos;
         return SL_FS_OK;
     }
     retval = SLFS_LIB_ERR_OFFSET_OUT_OF_BOUNDS;
     return retval;
 }
 
+/* Read ahead from the file pointer into the cache, returning the number of bytes cached or an error */
+int32_t SLFS::fill(void)
+{
+    int32_t len = filesize - offset;
+
+    if (len > SLFS_BUFFER_SIZE)
+        len = SLFS_BUFFER_SIZE;
+
+    bufLen = 0;
+    retval = sl_FsRead(filehandle, offset, buffer, len);
+    if (retval < 0)
+        return retval;
+    bufOffset = offset;
+    bufLen = retval;
+    return retval;
+}
+
+/* Write out the bytes collected by write(), returning SL_FS_OK or an error (the bytes are dropped then) */
+int32_t SLFS::writePending(void)
+{
+    int32_t len = bufLen;
+
+    if (!is_write || len == 0)
+        return SL_FS_OK;
+
+    bufLen = 0;
+    retval = sl_FsWrite(filehandle, bufOffset, buffer, len);
+    bufOffset = offset;
+    if (retval < 0)
+        return retval;
+    if (retval < len) {
+        retval = SL_FS_ERR_FAILED_TO_WRITE;
+        return retval;
+    }
+    return SL_FS_OK;
+}
+
 size_t SLFS::size(void)
 {
     return (size_t)filesize;
@@ -156,8 +208,6 @@ int SLFS::available(void)
 
 int SLFS::peek(void)
 {
-    uint8_t buf[4];
-
     if (!filehandle) {
         retval = SLFS_LIB_ERR_FILE_NOT_OPEN;
         return (int)retval;
@@ -170,17 +220,15 @@ int SLFS::peek(void)
     if (offset == filesize)
         return -1;
     
-    retval = sl_FsRead(filehandle, offset, buf, 1);
-    if (retval != 1) {
-        return -1;
+    if (offset < bufOffset || offset >= bufOffset + bufLen) {
+        if (fill() < 1)
+            return -1;
     }
-    return (int)buf[0];
+    return (int)buffer[offset - bufOffset];
 }
 
 int SLFS::read(void)
 {
-    uint8_t buf[4];
-
     if (!filehandle) {
         retval = SLFS_LIB_ERR_FILE_NOT_OPEN;
         return (int)retval;
@@ -193,17 +241,17 @@ int SLFS::read(void)
     if (offset == filesize)
         return -1;
     
-    retval = sl_FsRead(filehandle, offset, buf, 1);
-    if (retval != 1) {
-        return -1;
+    if (offset < bufOffset || offset >= bufOffset + bufLen) {
+        if (fill() < 1)
+            return -1;
     }
-    offset++;
-    return (int)buf[0];
+    return (int)buffer[offset++ - bufOffset];
 }
 
-size_t SLFS::readBytes(void *buffer, size_t len)
+size_t SLFS::readBytes(void *buf, size_t len)
 {
-    unsigned char *cbuf = (unsigned char *)buffer;
+    unsigned char *cbuf = (unsigned char *)buf;
+    size_t done = 0;
 
     if (!filehandle) {
         retval = SLFS_LIB_ERR_FILE_NOT_OPEN;
@@ -216,12 +264,35 @@ size_t SLFS::readBytes(void *buffer, size_t len)
     
     if (offset == filesize)
         return 0;
-    
-    retval = sl_FsRead(filehandle, offset, cbuf, len);
-    if (retval < 0)
-        return 0;
-    offset += retval;
-    return retval;
+    if (len > (size_t)(filesize - offset))
+        len = filesize - offset;
+
+    // Whatever the cache holds at the file pointer comes first
+    if (offset >= bufOffset && offset < bufOffset + bufLen) {
+        done = bufOffset + bufLen - offset;
+        if (done > len)
+            done = len;
+        memcpy(cbuf, &buffer[offset - bufOffset], done);
+        offset += done;
+    }
+    if (done == len)
+        return done;
+
+    // Large remainders go straight into the caller's buffer, small ones through the cache
+    if (len - done >= SLFS_BUFFER_SIZE) {
+        retval = sl_FsRead(filehandle, offset, cbuf + done, len - done);
+        if (retval < 0)
+            return done;
+        offset += retval;
+        return done + retval;
+    }
+    if (fill() <= 0)
+        return done;
+    if ((size_t)bufLen < len - done)
+        len = done + bufLen;
+    memcpy(cbuf + done, buffer, len - done);
+    offset += len - done;
+    return len;
 }
 
 String SLFS::readBytes(size_t maxlen)
@@ -255,12 +326,8 @@ String SLFS::readBytes(size_t maxlen)
     sh = (char *) malloc(len+1);
     sh[len] = '\0';
     
-    retval = sl_FsRead(filehandle, offset, (uint8_t *)sh, len);
-    if (retval < 0) {
-        free(sh);
-        return String("");
-    }
-    offset += retval;
+    len = readBytes((void *)sh, len);
+    sh[len] = '\0';
 
     // Allocate a new String instance to hold the contents (which is strcpy'd by String's constructor)
     _readBytesInstance = new String(sh);
@@ -277,7 +344,9 @@ void SLFS::freeString(void)
 
 void SLFS::flush(void)
 {
-    return;
+    if (!filehandle)
+        return;
+    writePending();
 }
 
 size_t SLFS::write(uint8_t c)
@@ -291,18 +360,17 @@ size_t SLFS::write(uint8_t c)
         return 0;
     }
     
-    if (offset > filesize)
+    if (offset >= filesize)
         return 0;
 
-    retval = sl_FsWrite(filehandle, offset, &c, 1);
-    if (retval < 1) {
+    if (bufLen == SLFS_BUFFER_SIZE && writePending() < 0)
         return 0;
-    }
+    buffer[bufLen++] = c;
     offset++;
     return 1;
 }
 
-size_t SLFS::write(const uint8_t *buffer, size_t len)
+size_t SLFS::write(const uint8_t *buf, size_t len)
 {
     if (!filehandle) {
         retval = SLFS_LIB_ERR_FILE_NOT_OPEN;
@@ -313,14 +381,28 @@ size_t SLFS::write(const uint8_t *buffer, size_t len)
         return 0;
     }
     
-    if (offset > filesize)
+    if (offset >= filesize)
         return 0;
-
-    retval = sl_FsWrite(filehandle, offset, (unsigned char *)buffer, len);
+    if (len > (size_t)(filesize - offset))
+        len = filesize - offset;
+
+    // Small writes are collected, large ones go out as they are (after what's pending, to keep the order)
+    if (len < SLFS_BUFFER_SIZE) {
+        if (bufLen + (int32_t)len > SLFS_BUFFER_SIZE && writePending() < 0)
+            return 0;
+        memcpy(&buffer[bufLen], buf, len);
+        bufLen += len;
+        offset += len;
+        return len;
+    }
+    if (writePending() < 0)
+        return 0;
+    retval = sl_FsWrite(filehandle, offset, (unsigned char *)buf, len);
     if (retval < 0) {
         return 0;
     }
     offset += retval;
+    bufOffset = offset;
     return retval;
 }
 
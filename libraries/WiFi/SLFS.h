@@ -53,6 +53,12 @@
 
 /// @}
 
+/// Size of the block cache: reads fetch this much ahead of the file pointer and writes are
+/// collected until this much is pending, so byte-at-a-time I/O doesn't cost an SPI command per byte.
+#ifndef SLFS_BUFFER_SIZE
+#define SLFS_BUFFER_SIZE 256
+#endif
+
 
 class SLFS : public Stream {
     private:
@@ -61,6 +67,11 @@ class SLFS : public Stream {
         int32_t retval;
         boolean is_write;
         String *_readBytesInstance;
+        uint8_t buffer[SLFS_BUFFER_SIZE];
+        int32_t bufOffset, bufLen;  // read: file bytes bufOffset.. cached; write: bufLen bytes pending at bufOffset
+
+        int32_t fill(void);
+        int32_t writePending(void);
 
         
     public:
@@ -94,7 +105,7 @@ class SLFS : public Stream {
 
         ///
         /// @brief Close file
-        /// @details Close a previously-opened file
+        /// @details Close a previously-opened file, writing out any pending bytes first
         /// @returns SL_FS_OK if successful, negative number if error
         int32_t close(void);
 
@@ -220,7 +231,7 @@ class SLFS : public Stream {
         ///
         /// @brief Read many bytes
         /// @details Read more than 1 byte, up to @c maxlen bytes (but possibly fewer if fewer than @c maxlen bytes are available
-        ///          for reading)
+        ///          for reading).  Requests of SLFS_BUFFER_SIZE or more are read straight into @c buf, past the cache.
         /// @param buf Buffer for receiving data.  This buffer must be able to take up to @c maxlen bytes.
         /// @param maxlen Maximum number of bytes to read
         /// @returns Number of bytes actually read, or 0 if we're at the end-of-file or an error in the SimpleLink API occurred.
@@ -234,7 +245,10 @@ class SLFS : public Stream {
         void freeString(void);
 
         ///
-        /// @brief Not implemented
+        /// @brief Write out pending bytes
+        /// @details Bytes written are collected in RAM until SLFS_BUFFER_SIZE are pending, a write of that size or more
+        ///          comes along, seek() or close() is called, or flush() writes them out.  Does nothing on a file open
+        ///          for read. Check lastError() to see whether the deferred write succeeded.
         virtual void flush(void);
 
         ///
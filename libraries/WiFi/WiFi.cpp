@@ -34,6 +34,7 @@
 
 #include <Energia.h>
 #include "WiFi.h"
+#include <Mutex.h>
 #include "utility/wl_definitions.h"
 #include <xdc/runtime/System.h>
 
@@ -67,6 +68,21 @@ __attribute__((section(".text")))
 #endif
 volatile wlanAttachedDevice_t WiFiClass::_connectedDevices[MAX_AP_DEVICE_REGISTRY];
 
+//
+//hostByName() cache, shared by every task that connects by name
+//
+wlanDnsEntry_t WiFiClass::_dnsCache[WIFI_DNS_CACHE_SIZE];
+unsigned long WiFiClass::_dnsTTL = WIFI_DNS_TTL_DEFAULT * 1000UL;
+uint32_t WiFiClass::_dnsUseCount = 0;
+static Mutex dnsCacheLock;
+
+//
+//sslConnect() options per server, see _sslLookup()
+//
+wlanSslSession_t WiFiClass::_sslSessions[WIFI_SSL_CACHE_SIZE];
+uint32_t WiFiClass::_sslUseCount = 0;
+static Mutex sslCacheLock;
+
 //
 //initialize the ssid and bssid to blank and 0s respectively
 //
@@ -76,11 +92,18 @@ unsigned char WiFiClass::connected_bssid[BSSID_LEN] = {0,0,0,0,0,0};
 //
 //a better way of keeping track of servers, clients, ports, and handles
 //these provide a central hub for WiFiClient, WiFiServer, WiFiUDP to keep track
+//(free indexes are a stack, descriptors map straight to their index)
 //
-int16_t WiFiClass::_handleArray[MAX_SOCK_NUM];
-int16_t WiFiClass::_portArray[MAX_SOCK_NUM];
-int16_t WiFiClass::_typeArray[MAX_SOCK_NUM];
-int16_t WiFiClass::_serverPortArray[MAX_SOCK_NUM];
+wlanSocket_t WiFiClass::_sockets[MAX_SOCK_NUM];
+uint8_t WiFiClass::_freeSockets[MAX_SOCK_NUM];
+uint8_t WiFiClass::_freeCount = 0;
+uint8_t WiFiClass::_socketById[WIFI_SOCKET_IDS];
+static Mutex socketTableLock;
+
+//
+//link and traffic counters, see getStats()
+//
+wlanStats_t WiFiClass::_stats;
 #ifdef __MSP430_HAS_FRAM__
 __attribute__((section(".text")))
 #endif
@@ -104,11 +127,18 @@ IPAddress WiFiClass::ipaddress_output_buffer;
 WiFiClass::WiFiClass()
 {
     //
-    //Initialize the WiFi socket state arrays
+    //Initialize the WiFi socket table, lowest index on top of the stack
     //
     int i;
     for (i = 0; i < MAX_SOCK_NUM; i++) {
-        _handleArray[i] = _portArray[i] = _typeArray[i] = _serverPortArray[i] = -1;
+        _sockets[i].handle = _sockets[i].port = _sockets[i].serverPort = -1;
+        _sockets[i].type = -1;
+        _sockets[i].refs = 0;
+        _freeSockets[i] = MAX_SOCK_NUM - 1 - i;
+    }
+    _freeCount = MAX_SOCK_NUM;
+    for (i = 0; i < WIFI_SOCKET_IDS; i++) {
+        _socketById[i] = NO_SOCKET_AVAIL;
     }
 }
 
@@ -179,16 +209,177 @@ void WiFiClass::setPinIRQ(uint8_t pin)
 uint8_t WiFiClass::getSocket()
 {
     //
-    //return the first socket that is available
+    //return the socket that is available next
     //
-    for (uint8_t i = 0; i < MAX_SOCK_NUM; ++i)
-    {
-        if (_handleArray[i] == -1)
-        {
-            return i;
+    MutexLock lock(socketTableLock);
+
+    return _freeCount ? _freeSockets[_freeCount - 1] : NO_SOCKET_AVAIL;
+}
+
+uint8_t WiFiClass::openSocket(int16_t handle, int8_t type, int16_t port,
+                              int16_t serverPort)
+{
+    MutexLock lock(socketTableLock);
+
+    if (_freeCount == 0) {
+        return NO_SOCKET_AVAIL;
+    }
+
+    uint8_t i = _freeSockets[--_freeCount];
+    _sockets[i].handle = handle;
+    _sockets[i].type = type;
+    _sockets[i].port = port;
+    _sockets[i].serverPort = serverPort;
+    _sockets[i].refs = 0;
+    memset(&_sockets[i].stats, 0, sizeof(_sockets[i].stats));
+    _socketById[handle & BSD_SOCKET_ID_MASK] = i;
+    return i;
+}
+
+void WiFiClass::closeSocket(uint8_t socketIndex)
+{
+    MutexLock lock(socketTableLock);
+
+    if (socketIndex >= MAX_SOCK_NUM || _sockets[socketIndex].type == -1) {
+        return;
+    }
+
+    //
+    //the descriptor is the device's to hand out again right away
+    //
+    int16_t handle = _sockets[socketIndex].handle;
+    if (handle != -1) {
+        if (_socketById[handle & BSD_SOCKET_ID_MASK] == socketIndex) {
+            _socketById[handle & BSD_SOCKET_ID_MASK] = NO_SOCKET_AVAIL;
         }
+        _sockets[socketIndex].handle = -1;
+    }
+
+    //
+    //a server's copy of the client has nothing left to show
+    //
+    if (clients[socketIndex]._socketIndex == socketIndex) {
+        clients[socketIndex]._socketIndex = NO_SOCKET_AVAIL;
+        clients[socketIndex].rx_buffer.reset();
+        clients[socketIndex].tx_fill = 0;
+        _sockets[socketIndex].refs--;
+    }
+
+    if (_sockets[socketIndex].refs == 0) {
+        _sockets[socketIndex].type = -1;
+        _sockets[socketIndex].port = _sockets[socketIndex].serverPort = -1;
+        _freeSockets[_freeCount++] = socketIndex;
+    }
+}
+
+//
+//count traffic for a socket and in the totals; counts may be lost when
+//tasks race, which doesn't matter for what they're for
+//
+void WiFiClass::_countTx(uint8_t socketIndex, int bytes)
+{
+    if (socketIndex < MAX_SOCK_NUM) {
+        _sockets[socketIndex].stats.txBytes += bytes;
+        _sockets[socketIndex].stats.txPackets++;
+    }
+    _stats.sockets.txBytes += bytes;
+    _stats.sockets.txPackets++;
+}
+
+void WiFiClass::_countRx(uint8_t socketIndex, int bytes)
+{
+    if (socketIndex < MAX_SOCK_NUM) {
+        _sockets[socketIndex].stats.rxBytes += bytes;
+        _sockets[socketIndex].stats.rxPackets++;
+    }
+    _stats.sockets.rxBytes += bytes;
+    _stats.sockets.rxPackets++;
+}
+
+void WiFiClass::_countTxStall(uint8_t socketIndex)
+{
+    if (socketIndex < MAX_SOCK_NUM) {
+        _sockets[socketIndex].stats.txStalls++;
+    }
+    _stats.sockets.txStalls++;
+}
+
+void WiFiClass::_countRxEmpty(uint8_t socketIndex)
+{
+    if (socketIndex < MAX_SOCK_NUM) {
+        _sockets[socketIndex].stats.rxEmpty++;
+    }
+    _stats.sockets.rxEmpty++;
+}
+
+void WiFiClass::_countHandshake(unsigned long ms)
+{
+    _stats.sslHandshakes++;
+    _stats.sslHandshakeMs += ms;
+    if (ms > _stats.sslHandshakeMaxMs) {
+        _stats.sslHandshakeMaxMs = ms;
+    }
+}
+
+void WiFiClass::getStats(wlanStats_t &stats)
+{
+    stats = _stats;
+}
+
+void WiFiClass::resetStats()
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+bool WiFiClass::getSocketStats(uint8_t socketIndex, wlanSocketStats_t &stats)
+{
+    if (socketIndex >= MAX_SOCK_NUM || _sockets[socketIndex].type == -1) {
+        return false;
+    }
+    stats = _sockets[socketIndex].stats;
+    return true;
+}
+
+uint8_t WiFiClass::socketIndex(int16_t handle)
+{
+    if (handle < 0) {
+        return NO_SOCKET_AVAIL;
+    }
+
+    uint8_t i = _socketById[handle & BSD_SOCKET_ID_MASK];
+    if (i == NO_SOCKET_AVAIL || _sockets[i].handle != handle) {
+        return NO_SOCKET_AVAIL;
+    }
+    return i;
+}
+
+void WiFiClass::retainSocket(uint8_t socketIndex)
+{
+    MutexLock lock(socketTableLock);
+
+    if (socketIndex < MAX_SOCK_NUM) {
+        _sockets[socketIndex].refs++;
+    }
+}
+
+void WiFiClass::releaseSocket(uint8_t socketIndex)
+{
+    MutexLock lock(socketTableLock);
+
+    if (socketIndex >= MAX_SOCK_NUM || _sockets[socketIndex].refs == 0) {
+        return;
+    }
+
+    //
+    //the last copy of a closed connection gives the index back
+    //
+    if (--_sockets[socketIndex].refs == 0
+        && _sockets[socketIndex].handle == -1
+        && _sockets[socketIndex].type != -1) {
+        _sockets[socketIndex].type = -1;
+        _sockets[socketIndex].port = _sockets[socketIndex].serverPort = -1;
+        _freeSockets[_freeCount++] = socketIndex;
     }
-    return NO_SOCKET_AVAIL;
 }
 
 
@@ -645,6 +836,11 @@ void WiFiClass::setDNS(IPAddress dns_server1)
     //
     config.ipV4DnsServer = (uint32_t)SL_IPV4_VAL(dns_server1[0], dns_server1[1], dns_server1[2], dns_server1[3]);
     sl_NetCfgSet(SL_IPV4_STA_P2P_CL_STATIC_ENABLE, 1, sizeof(SlNetCfgIpV4Args_t), (unsigned char*)&config);
+
+    //
+    //the new server may answer differently
+    //
+    flushDNSCache();
 }
 
 
@@ -708,7 +904,9 @@ IPAddress WiFiClass::localIP()
     //the local IP is maintained with callbacks, so _SlNonOsMainLoopTask()
     //is critical. The IP is "written" into the buffer to avoid memory errors
     //
+#ifndef SL_PLATFORM_MULTI_THREADED
     _SlNonOsMainLoopTask();
+#endif
 
     SlNetCfgIpV4Args_t config = {0};
     unsigned char len = sizeof(SlNetCfgIpV4Args_t);
@@ -818,6 +1016,15 @@ int32_t WiFiClass::RSSI()
         return 0;
     }
 
+    //
+    //keep the last WIFI_STATS_RSSI_HISTORY readings, oldest first
+    //
+    if (_stats.rssiCount == WIFI_STATS_RSSI_HISTORY) {
+        memmove(_stats.rssi, _stats.rssi + 1, WIFI_STATS_RSSI_HISTORY - 1);
+        _stats.rssiCount--;
+    }
+    _stats.rssi[_stats.rssiCount++] = rxStatResp.AvarageMgMntRssi;
+
     return rxStatResp.AvarageMgMntRssi;
 }
 
@@ -987,7 +1194,9 @@ uint8_t WiFiClass::status()
     //
     //This class variable is maintained by the slWlanEvenHandler
     //
+#ifndef SL_PLATFORM_MULTI_THREADED
     _SlNonOsMainLoopTask();
+#endif
     return WiFi_status;
 }
 
@@ -997,6 +1206,13 @@ int WiFiClass::hostByName(char* aHostname, IPAddress& aResult)
     if (!_initialized) {
         init();
     }
+    //
+    //a name resolved within the TTL is answered without the round trip
+    //
+    if (_dnsLookup(aHostname, aResult)) {
+        return 1;
+    }
+
     //
     //Use the netapp api to resolve an IP for the requested hostname
     //
@@ -1005,6 +1221,7 @@ int WiFiClass::hostByName(char* aHostname, IPAddress& aResult)
     aResult = sl_Htonl(DestinationIP);
     
     if (iRet >= 0) {
+        _dnsStore(aHostname, aResult);
         return 1;
     } else {
         return iRet;
@@ -1012,6 +1229,152 @@ int WiFiClass::hostByName(char* aHostname, IPAddress& aResult)
     
 }
 
+void WiFiClass::setDNSCacheTTL(unsigned long seconds)
+{
+    MutexLock lock(dnsCacheLock);
+
+    _dnsTTL = seconds * 1000UL;
+}
+
+void WiFiClass::flushDNSCache()
+{
+    MutexLock lock(dnsCacheLock);
+
+    for (int i = 0; i < WIFI_DNS_CACHE_SIZE; i++) {
+        _dnsCache[i].name[0] = '\0';
+    }
+}
+
+//
+//find an unexpired entry for name, names compare like DNS: any case
+//
+bool WiFiClass::_dnsLookup(const char *name, IPAddress &result)
+{
+    MutexLock lock(dnsCacheLock);
+
+    for (int i = 0; i < WIFI_DNS_CACHE_SIZE; i++) {
+        wlanDnsEntry_t *entry = &_dnsCache[i];
+        if (entry->name[0] == '\0' || strcasecmp(entry->name, name) != 0) {
+            continue;
+        }
+        if (millis() - entry->stored >= _dnsTTL) {
+            entry->name[0] = '\0';
+            return false;
+        }
+        entry->used = ++_dnsUseCount;
+        result = entry->ip;
+        return true;
+    }
+
+    return false;
+}
+
+//
+//remember name in an empty entry, else in the least recently used one;
+//names too long for an entry aren't cached
+//
+void WiFiClass::_dnsStore(const char *name, uint32_t ip)
+{
+    MutexLock lock(dnsCacheLock);
+    wlanDnsEntry_t *entry = &_dnsCache[0];
+
+    if (_dnsTTL == 0 || strlen(name) >= WIFI_DNS_NAME_MAX) {
+        return;
+    }
+
+    for (int i = 0; i < WIFI_DNS_CACHE_SIZE; i++) {
+        if (_dnsCache[i].name[0] == '\0'
+            || strcasecmp(_dnsCache[i].name, name) == 0) {
+            entry = &_dnsCache[i];
+            break;
+        }
+        if (_dnsCache[i].used < entry->used) {
+            entry = &_dnsCache[i];
+        }
+    }
+
+    strcpy(entry->name, name);
+    entry->ip = ip;
+    entry->stored = millis();
+    entry->used = ++_dnsUseCount;
+}
+
+void WiFiClass::flushSSLSessions()
+{
+    MutexLock lock(sslCacheLock);
+
+    for (int i = 0; i < WIFI_SSL_CACHE_SIZE; i++) {
+        _sslSessions[i].port = 0;
+    }
+}
+
+//
+//the options that last got a handshake through to ip:port. SimpleLink
+//keeps no TLS session between sockets, so every sslConnect() is a full
+//handshake; what can be saved is the device trying suites the server
+//won't take, or ones with a slow key exchange (DHE, ECDHE) where the
+//sketch found a faster one the server accepts
+//
+bool WiFiClass::_sslLookup(uint32_t ip, uint16_t port, wlanSslSession_t &session)
+{
+    MutexLock lock(sslCacheLock);
+
+    for (int i = 0; i < WIFI_SSL_CACHE_SIZE; i++) {
+        wlanSslSession_t *entry = &_sslSessions[i];
+        if (entry->port == port && entry->ip == ip) {
+            entry->used = ++_sslUseCount;
+            session = *entry;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//
+//remember session in the entry for its server, else in an empty one,
+//else in the least recently used one
+//
+void WiFiClass::_sslStore(const wlanSslSession_t &session)
+{
+    MutexLock lock(sslCacheLock);
+    wlanSslSession_t *entry = NULL;
+    int i;
+
+    for (i = 0; entry == NULL && i < WIFI_SSL_CACHE_SIZE; i++) {
+        if (_sslSessions[i].port == session.port && _sslSessions[i].ip == session.ip) {
+            entry = &_sslSessions[i];
+        }
+    }
+    for (i = 0; entry == NULL && i < WIFI_SSL_CACHE_SIZE; i++) {
+        if (_sslSessions[i].port == 0) {
+            entry = &_sslSessions[i];
+        }
+    }
+    if (entry == NULL) {
+        entry = &_sslSessions[0];
+        for (i = 1; i < WIFI_SSL_CACHE_SIZE; i++) {
+            if (_sslSessions[i].used < entry->used) {
+                entry = &_sslSessions[i];
+            }
+        }
+    }
+
+    *entry = session;
+    entry->used = ++_sslUseCount;
+}
+
+void WiFiClass::_sslForget(uint32_t ip, uint16_t port)
+{
+    MutexLock lock(sslCacheLock);
+
+    for (int i = 0; i < WIFI_SSL_CACHE_SIZE; i++) {
+        if (_sslSessions[i].port == port && _sslSessions[i].ip == ip) {
+            _sslSessions[i].port = 0;
+        }
+    }
+}
+
 int WiFiClass::startSmartConfig(bool block)
 {
     unsigned char policyVal;
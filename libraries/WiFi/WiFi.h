@@ -28,22 +28,105 @@
 #include "WiFiClient.h"
 #include "WiFiServer.h"
 #include "WiFiUdp.h"
+#include "WiFiClientPool.h"
 //
-//Max socket number is 8
+//Max socket number is 8, the CC3100/CC3200's own limit; indexes are
+//uint8_t and NO_SOCKET_AVAIL (255) is none
 //
+#ifndef MAX_SOCK_NUM
 #define MAX_SOCK_NUM 8
+#endif
 #define MAX_SSID_LEN 32
 #define BSSID_LEN 6
 #define WLAN_DEL_ALL_PROFILES 0xff
 #define WL_FW_VER_LENGTH 64
 #define MAX_AP_DEVICE_REGISTRY 4
 
+//
+//hostByName() remembers the last WIFI_DNS_CACHE_SIZE names it resolved
+//
+#ifndef WIFI_DNS_CACHE_SIZE
+#define WIFI_DNS_CACHE_SIZE 4
+#endif
+#define WIFI_DNS_NAME_MAX 64
+#define WIFI_DNS_TTL_DEFAULT 300
+
 typedef struct {
     boolean in_use;
     uint8_t ipAddress[4];
     uint8_t mac[6];
 } wlanAttachedDevice_t;
 
+typedef struct {
+    char name[WIFI_DNS_NAME_MAX];
+    uint32_t ip;
+    unsigned long stored;
+    uint32_t used;
+} wlanDnsEntry_t;
+
+//
+//sslConnect() remembers the security options that got it through to
+//the last WIFI_SSL_CACHE_SIZE servers, and how long that took
+//
+#ifndef WIFI_SSL_CACHE_SIZE
+#define WIFI_SSL_CACHE_SIZE 4
+#endif
+#define WIFI_SSL_METHOD_DEFAULT -1  //the device's own choice, SL_SO_SEC_METHOD_SSLv3_TLSV1_2
+#define WIFI_SSL_MASK_DEFAULT 0     //SL_SEC_MASK_SECURE_DEFAULT, every cipher suite
+
+typedef struct {
+    uint32_t ip;
+    uint16_t port;              //0 if the entry is free
+    int8_t method;              //SL_SO_SEC_METHOD_xxx or WIFI_SSL_METHOD_DEFAULT
+    uint32_t mask;              //SL_SEC_MASK_xxx or WIFI_SSL_MASK_DEFAULT
+    unsigned long handshakeMs;  //the last handshake with these options
+    uint32_t used;
+} wlanSslSession_t;
+
+//
+//RSSI() readings kept in wlanStats_t
+//
+#define WIFI_STATS_RSSI_HISTORY 8
+
+//
+//link and host driver counters, see WiFiClass::getStats()
+//
+typedef struct {
+    wlanSocketStats_t sockets;  //all sockets, closed ones included
+    uint32_t connects;          //connections to an AP; more than 1 are reconnects
+    uint32_t disconnects;
+    uint32_t commands;          //host driver command round trips to the device (not sl_Send()/sl_Recv() data)
+    uint32_t commandUs;         //their total time; commandUs / commands is the average
+    uint32_t commandMaxUs;
+    uint32_t spiBytes;          //bytes across the host interface either way
+    uint32_t spiUs;             //time spent moving them
+    int8_t rssi[WIFI_STATS_RSSI_HISTORY];  //latest RSSI() readings, oldest first
+    uint8_t rssiCount;          //how many of rssi[] are valid
+    uint32_t sslHandshakes;     //sslConnect() handshakes that succeeded
+    uint32_t sslHandshakeMs;    //their total time
+    uint32_t sslHandshakeMaxMs;
+} wlanStats_t;
+
+//
+//one entry of the socket table for each socket index. WiFiClient copies
+//of a connection all hold its index; refs counts them, so that stop()
+//through one copy leaves the others looking at a closed entry rather
+//than at the next connection to take the index
+//
+typedef struct {
+    int16_t handle;         //SimpleLink descriptor, -1 once closed
+    int16_t port;           //local port, or the remote port of a client
+    int16_t serverPort;     //the listening port a client came in on
+    int8_t type;            //TYPE_xxx of wl_definitions.h, -1 if free
+    uint8_t refs;           //WiFiClient objects holding the index
+    wlanSocketStats_t stats;    //since the socket was opened
+} wlanSocket_t;
+
+//
+//SimpleLink descriptors carry the device's socket id in their low bits
+//
+#define WIFI_SOCKET_IDS (BSD_SOCKET_ID_MASK + 1)
+
 
 class WiFiClass
 {
@@ -52,10 +135,20 @@ private:
     static int8_t role;
     static char fwVersion[WL_FW_VER_LENGTH];
 public:
-    static int16_t _handleArray[MAX_SOCK_NUM];
-    static int16_t _portArray[MAX_SOCK_NUM];
-    static int16_t _serverPortArray[MAX_SOCK_NUM];
-    static int16_t _typeArray[MAX_SOCK_NUM];
+    static wlanSocket_t _sockets[MAX_SOCK_NUM];
+    static uint8_t _freeSockets[MAX_SOCK_NUM];
+    static uint8_t _freeCount;
+    static uint8_t _socketById[WIFI_SOCKET_IDS];
+
+    /* Counters behind getStats(), updated by the socket classes and the
+     * host interface
+     */
+    static wlanStats_t _stats;
+    static void _countTx(uint8_t socketIndex, int bytes);
+    static void _countRx(uint8_t socketIndex, int bytes);
+    static void _countTxStall(uint8_t socketIndex);
+    static void _countRxEmpty(uint8_t socketIndex);
+    static void _countHandshake(unsigned long ms);
     
     static bool _initialized;
     static bool _connecting;
@@ -96,9 +189,39 @@ public:
     WiFiClass();
     
     /*
-     * Get the first socket available
+     * Get the socket index openSocket() would take next, NO_SOCKET_AVAIL
+     * if all are in use
      */
     static uint8_t getSocket();
+
+    /*
+     * Enter a SimpleLink descriptor into the socket table. Returns its
+     * socket index, or NO_SOCKET_AVAIL if the table is full
+     */
+    static uint8_t openSocket(int16_t handle, int8_t type, int16_t port,
+                              int16_t serverPort = -1);
+
+    /*
+     * Mark a socket closed (after sl_Close()). The index is free again
+     * once no WiFiClient holds it
+     */
+    static void closeSocket(uint8_t socketIndex);
+
+    /*
+     * Socket index of a SimpleLink descriptor, NO_SOCKET_AVAIL if none
+     */
+    static uint8_t socketIndex(int16_t handle);
+
+    /*
+     * SimpleLink descriptor of a socket index, -1 if closed
+     */
+    static int16_t socketHandle(uint8_t socketIndex)
+    {
+        return socketIndex < MAX_SOCK_NUM ? _sockets[socketIndex].handle : -1;
+    }
+
+    static void retainSocket(uint8_t socketIndex);
+    static void releaseSocket(uint8_t socketIndex);
     
     /*
      * Get firmware and driver version
@@ -128,6 +251,22 @@ public:
     static void _registerNewDeviceIP(uint8_t *ip, uint8_t *mac);
     static void _unregisterDevice(uint8_t *mac);
 
+    /* hostByName() cache
+     */
+    static wlanDnsEntry_t _dnsCache[WIFI_DNS_CACHE_SIZE];
+    static unsigned long _dnsTTL;
+    static uint32_t _dnsUseCount;
+    static bool _dnsLookup(const char *name, IPAddress &result);
+    static void _dnsStore(const char *name, uint32_t ip);
+
+    /* sslConnect() options cache
+     */
+    static wlanSslSession_t _sslSessions[WIFI_SSL_CACHE_SIZE];
+    static uint32_t _sslUseCount;
+    static bool _sslLookup(uint32_t ip, uint16_t port, wlanSslSession_t &session);
+    static void _sslStore(const wlanSslSession_t &session);
+    static void _sslForget(uint32_t ip, uint16_t port);
+
     /* Query AP-mode station registration database
      */
     IPAddress getLatestDevice(void) { return IPAddress((const uint8_t *)_connectedDevices[_latestConnect].ipAddress); };
@@ -262,7 +401,8 @@ public:
     
     /*
      * Return the current RSSI /Received Signal Strength in dBm)
-     * associated with the network
+     * associated with the network. Each reading is also kept in the
+     * RSSI history of getStats()
      *
      * return: signed value
      */
@@ -324,6 +464,41 @@ public:
      *          else error code
      */
     int hostByName(char* aHostname, IPAddress& aResult);
+
+    /*
+     * Keep names hostByName() resolved for up to seconds before asking
+     * the DNS server again; 0 always asks. The device doesn't report
+     * the record's TTL, so this is the most any answer is trusted
+     * (WIFI_DNS_TTL_DEFAULT until set).
+     */
+    void setDNSCacheTTL(unsigned long seconds);
+
+    /*
+     * Forget all the names hostByName() remembers, e.g. after a host
+     * moved. setDNS() does this too.
+     */
+    void flushDNSCache();
+
+    /*
+     * Forget the security options sslConnect() remembers for each
+     * server (see WiFiClient::sslSetMethod()), e.g. after a server
+     * changed its certificate or cipher suites
+     */
+    void flushSSLSessions();
+
+    /*
+     * Copy the link counters (see wlanStats_t) to stats. They count from
+     * power up or the last resetStats()
+     */
+    void getStats(wlanStats_t &stats);
+    void resetStats();
+
+    /*
+     * Copy the counters of an open socket to stats. The WiFiClient or
+     * WiFiUDP of the socket has them too, as getStats()
+     * return: false if socketIndex isn't open
+     */
+    static bool getSocketStats(uint8_t socketIndex, wlanSocketStats_t &stats);
     
     /*
      * Start Smartconfig.
@@ -48,12 +48,20 @@ WiFiClient::WiFiClient()
     //
     //initialize to empty buffer and no socket assigned yet
     //
-    rx_currentIndex = 0;
-    rx_fillLevel = 0;
     _socketIndex = NO_SOCKET_AVAIL;
+    tx_buffer = tx_storage;
+    tx_size = TCP_TX_BUFF_MAX_SIZE;
+    tx_fill = 0;
+    tx_noDelay = true;
+    rx_buffer.init(rx_storage, TCP_RX_BUFF_MAX_SIZE);
+    rx_external = false;
+    rx_lastPoll = 0;
     hasRootCA = false;
     sslVerifyStrict = false;
     sslLastError = 0;
+    sslSecMethod = WIFI_SSL_METHOD_DEFAULT;
+    sslSecMask = WIFI_SSL_MASK_DEFAULT;
+    sslHandshakeMs = 0;
 }
 
 //--tested, working--//
@@ -63,9 +71,72 @@ WiFiClient::WiFiClient(uint8_t socketIndex)
     //
     //this is called by the server class. Initialize with the assigned socket index
     //
-    rx_currentIndex = 0;
-    rx_fillLevel = 0;
     _socketIndex = socketIndex;
+    if (socketIndex != NO_SOCKET_AVAIL) {
+        WiFiClass::retainSocket(socketIndex);
+    }
+    tx_buffer = tx_storage;
+    tx_size = TCP_TX_BUFF_MAX_SIZE;
+    tx_fill = 0;
+    tx_noDelay = true;
+    rx_buffer.init(rx_storage, TCP_RX_BUFF_MAX_SIZE);
+    rx_external = false;
+    rx_lastPoll = 0;
+    sslSecMethod = WIFI_SSL_METHOD_DEFAULT;
+    sslSecMask = WIFI_SSL_MASK_DEFAULT;
+    sslHandshakeMs = 0;
+}
+
+WiFiClient::WiFiClient(const WiFiClient &other) : Client(other)
+{
+    _socketIndex = NO_SOCKET_AVAIL;
+    *this = other;
+}
+
+//
+//copies share a setRxBuffer() or setTxBuffer() buffer, but the built-in
+//ones travel with the copy, which has to point at its own storage
+//
+WiFiClient &WiFiClient::operator=(const WiFiClient &other)
+{
+    if (this == &other) {
+        return *this;
+    }
+
+    Client::operator=(other);
+    sslIsVerified = other.sslIsVerified;
+    if (_socketIndex != other._socketIndex) {
+        if (other._socketIndex != NO_SOCKET_AVAIL) {
+            WiFiClass::retainSocket(other._socketIndex);
+        }
+        unbind();
+        _socketIndex = other._socketIndex;
+    }
+    memcpy(rx_storage, other.rx_storage, sizeof(rx_storage));
+    rx_buffer = other.rx_buffer;
+    rx_external = other.rx_external;
+    if (!rx_external) {
+        rx_buffer.rebase(rx_storage);
+    }
+    rx_lastPoll = other.rx_lastPoll;
+    if (other.tx_buffer == other.tx_storage) {
+        tx_buffer = tx_storage;
+        fastMemcpy(tx_storage, other.tx_storage, other.tx_fill);
+    }
+    else {
+        tx_buffer = other.tx_buffer;
+    }
+    tx_size = other.tx_size;
+    tx_fill = other.tx_fill;
+    tx_since = other.tx_since;
+    tx_noDelay = other.tx_noDelay;
+    sslVerifyStrict = other.sslVerifyStrict;
+    hasRootCA = other.hasRootCA;
+    sslLastError = other.sslLastError;
+    sslSecMethod = other.sslSecMethod;
+    sslSecMask = other.sslSecMask;
+    sslHandshakeMs = other.sslHandshakeMs;
+    return *this;
 }
 
 
@@ -74,7 +145,15 @@ WiFiClient::~WiFiClient()
     //
     //don't do anything if the socket was never set up
     //
-    if (_socketIndex == NO_SOCKET_AVAIL) {
+    if (!bound()) {
+        return;
+    }
+
+    //
+    //the copy below must not carry unsent output along
+    //
+    sendPending();
+    if (!bound()) {
         return;
     }
 
@@ -83,7 +162,41 @@ WiFiClient::~WiFiClient()
     //out of scope in the loop. This is an ugly hack but there is no
     //other way to keep track of state of a client.
     //
-    memcpy(&WiFiClass::clients[_socketIndex], this, sizeof(WiFiClient));
+    if (this != &WiFiClass::clients[_socketIndex]) {
+        WiFiClass::clients[_socketIndex] = *this;
+    }
+    unbind();
+}
+
+//
+//true if the client holds a socket index whose connection is open. A
+//copy finds out here that another one stopped it, and lets go of the
+//index
+//
+bool WiFiClient::bound()
+{
+    if (_socketIndex == NO_SOCKET_AVAIL) {
+        return false;
+    }
+    if (WiFiClass::socketHandle(_socketIndex) != -1) {
+        return true;
+    }
+    unbind();
+    return false;
+}
+
+//
+//give up the socket index without closing anything
+//
+void WiFiClient::unbind()
+{
+    uint8_t socketIndex = _socketIndex;
+
+    if (socketIndex == NO_SOCKET_AVAIL) {
+        return;
+    }
+    _socketIndex = NO_SOCKET_AVAIL;
+    WiFiClass::releaseSocket(socketIndex);
 }
 
 //--tested, working--//
@@ -109,7 +222,7 @@ int WiFiClient::connect(IPAddress ip, uint16_t port)
     //
     //this function should only be called once and only on the client side
     //
-    if (_socketIndex != NO_SOCKET_AVAIL) {
+    if (bound()) {
         return false;
     }
     
@@ -150,12 +263,15 @@ int WiFiClient::connect(IPAddress ip, uint16_t port)
 
     //
     //we've successfully created a socket and connected, so store the
-    //information in the arrays provided by WiFiClass
+    //information in the socket table provided by WiFiClass
     //
+    socketIndex = WiFiClass::openSocket(socketHandle, TYPE_TCP_CLIENT, port);
+    if (socketIndex == NO_SOCKET_AVAIL) {
+        sl_Close(socketHandle);
+        return false;
+    }
     _socketIndex = socketIndex;
-    WiFiClass::_handleArray[socketIndex] = socketHandle;
-    WiFiClass::_typeArray[socketIndex] = TYPE_TCP_CLIENT;
-    WiFiClass::_portArray[socketIndex] = port;
+    WiFiClass::retainSocket(socketIndex);
     return true;
 }
 
@@ -180,7 +296,7 @@ int WiFiClient::sslConnect(IPAddress ip, uint16_t port)
     //
     //this function should only be called once and only on the client side
     //
-    if (_socketIndex != NO_SOCKET_AVAIL) {
+    if (bound()) {
         return false;
     }
     
@@ -208,6 +324,32 @@ int WiFiClient::sslConnect(IPAddress ip, uint16_t port)
     }
     sslIsVerified = true;
 
+    //
+    //options set on this client, else the ones that last got through to
+    //this server, else the device's defaults
+    //
+    wlanSslSession_t session;
+    bool cached = false;
+    if (sslSecMethod == WIFI_SSL_METHOD_DEFAULT && sslSecMask == WIFI_SSL_MASK_DEFAULT) {
+        cached = WiFiClass::_sslLookup(ip, port, session);
+    }
+    if (!cached) {
+        session.ip = ip;
+        session.port = port;
+        session.method = sslSecMethod;
+        session.mask = sslSecMask;
+    }
+    if (session.method != WIFI_SSL_METHOD_DEFAULT) {
+        SlSockSecureMethod method;
+        method.secureMethod = session.method;
+        sl_SetSockOpt(socketHandle, SL_SOL_SOCKET, SL_SO_SECMETHOD, &method, sizeof(method));
+    }
+    if (session.mask != WIFI_SSL_MASK_DEFAULT) {
+        SlSockSecureMask cipher;
+        cipher.secureMask = session.mask;
+        sl_SetSockOpt(socketHandle, SL_SOL_SOCKET, SL_SO_SECURE_MASK, &cipher, sizeof(cipher));
+    }
+
     //
     //connect the socket to the requested IP address and port. Check for success
     //
@@ -216,11 +358,17 @@ int WiFiClient::sslConnect(IPAddress ip, uint16_t port)
     server.sin_family = SL_AF_INET;
     server.sin_port = sl_Htons(port);
     server.sin_addr.s_addr = ip;
+    unsigned long start = millis();
     int iRet = sl_Connect(socketHandle, (SlSockAddr_t*)&server, sizeof(SlSockAddrIn_t));
+    sslHandshakeMs = millis() - start;
 
     if ( iRet < 0 && (iRet != SL_ESECSNOVERIFY && iRet != SL_ESECDATEERROR) ) {
         sslLastError = iRet;
         sl_Close(socketHandle);
+        //the server may have changed; the next try starts from the defaults
+        if (cached) {
+            WiFiClass::_sslForget(ip, port);
+        }
         return false;
     }
 
@@ -236,21 +384,55 @@ int WiFiClient::sslConnect(IPAddress ip, uint16_t port)
         sslIsVerified = false;
     }
 
+    session.handshakeMs = sslHandshakeMs;
+    WiFiClass::_sslStore(session);
+    WiFiClass::_countHandshake(sslHandshakeMs);
+
     int enableOption = 1;
     sl_SetSockOpt(socketHandle, SL_SOL_SOCKET, SL_SO_NONBLOCKING, &enableOption, sizeof(enableOption));
     sl_SetSockOpt(socketHandle, SL_SOL_SOCKET, SL_SO_KEEPALIVE, &enableOption, sizeof(enableOption));
 
     //
     //we've successfully created a socket and connected, so store the
-    //information in the arrays provided by WiFiClass
+    //information in the socket table provided by WiFiClass
     //
+    socketIndex = WiFiClass::openSocket(socketHandle, TYPE_TCP_CLIENT, port);
+    if (socketIndex == NO_SOCKET_AVAIL) {
+        sl_Close(socketHandle);
+        return false;
+    }
     _socketIndex = socketIndex;
-    WiFiClass::_handleArray[socketIndex] = socketHandle;
-    WiFiClass::_typeArray[socketIndex] = TYPE_TCP_CLIENT;
-    WiFiClass::_portArray[socketIndex] = port;
+    WiFiClass::retainSocket(socketIndex);
     return true;
 }
 
+//
+//security method (SL_SO_SEC_METHOD_xxx) and cipher suites (SL_SEC_MASK_xxx
+//or'ed together) the next sslConnect() offers. Offering only what the
+//server takes, at the cheapest key exchange it allows (plain RSA rather
+//than DHE or ECDHE), is what shortens the handshake; sslConnect() keeps
+//the options that worked for each server and uses them for clients that
+//don't set their own
+//
+void WiFiClient::sslSetMethod(int8_t method)
+{
+    sslSecMethod = method;
+}
+
+void WiFiClient::sslSetCipherMask(uint32_t mask)
+{
+    sslSecMask = mask;
+}
+
+//
+//milliseconds the last sslConnect() spent in sl_Connect(): the TCP
+//connect and the TLS handshake
+//
+unsigned long WiFiClient::sslHandshakeTime()
+{
+    return sslHandshakeMs;
+}
+
 /*  SSL root CA verification is a work in progress
 int32_t WiFiClient::sslGetReasonID(void)
 {
@@ -330,7 +512,7 @@ size_t WiFiClient::write(uint8_t b)
     //
     //don't do anything if not properly set up
     //
-    if (_socketIndex == NO_SOCKET_AVAIL) {
+    if (!bound()) {
         return 0;
     }
     
@@ -347,23 +529,135 @@ size_t WiFiClient::write(const uint8_t *buffer, size_t size)
     //
     //don't do anything if not properly set up
     //
-    if (_socketIndex == NO_SOCKET_AVAIL) {
+    if (!bound()) {
         return 0;
     }
 
+    //
+    //collect small writes (print() output is mostly those) and send them
+    //as one packet when the buffer fills, at the end of a line (unless
+    //setNoDelay(false), then once it has waited TCP_TX_FLUSH_MS), or when
+    //the sketch turns to reading the reply
+    //
+    if (tx_fill + size > tx_size) {
+        sendPending();
+        if (!bound()) {
+            return 0;
+        }
+    }
+    if (size >= tx_size) {
+        return send(buffer, size);
+    }
+
+    if (tx_fill == 0) {
+        tx_since = millis();
+    }
+    fastMemcpy(&tx_buffer[tx_fill], buffer, size);
+    tx_fill += size;
+    if (tx_fill == tx_size
+        || (tx_noDelay && memchr(buffer, '\n', size) != NULL)
+        || (!tx_noDelay && millis() - tx_since >= TCP_TX_FLUSH_MS)) {
+        sendPending();
+        if (!bound()) {
+            return 0;
+        }
+    }
+    return size;
+}
+
+//
+//collect output in size bytes the sketch provides, e.g. a whole 1460 byte
+//segment, instead of the TCP_TX_BUFF_MAX_SIZE built-in buffer. What was
+//collected so far is sent first. NULL goes back to the built-in buffer
+//
+bool WiFiClient::setTxBuffer(uint8_t *buffer, size_t size)
+{
+    if (buffer != NULL && size == 0) {
+        return false;
+    }
+
+    sendPending();
+    if (buffer == NULL) {
+        tx_buffer = tx_storage;
+        tx_size = TCP_TX_BUFF_MAX_SIZE;
+    }
+    else {
+        tx_buffer = buffer;
+        tx_size = size;
+    }
+    return true;
+}
+
+//
+//true (the default) sends collected output at every newline, so each
+//line of a line based protocol goes out as soon as it is complete.
+//false keeps collecting until the buffer is full, the output is
+//TCP_TX_FLUSH_MS old, or flush(), available() or read() is called
+//
+void WiFiClient::setNoDelay(bool noDelay)
+{
+    tx_noDelay = noDelay;
+}
+
+//
+//this connection's traffic counters, false if it isn't open
+//
+bool WiFiClient::getStats(wlanSocketStats_t &stats)
+{
+    if (!bound()) {
+        return false;
+    }
+    return WiFiClass::getSocketStats(_socketIndex, stats);
+}
+
+bool WiFiClient::getNoDelay()
+{
+    return tx_noDelay;
+}
+
+//
+//send whatever write() has collected
+//
+void WiFiClient::sendPending()
+{
+    size_t fill = tx_fill;
+
+    //
+    //cleared first: a failed send() calls stop(), which comes back here
+    //
+    tx_fill = 0;
+    if (fill != 0) {
+        send(tx_buffer, fill);
+    }
+}
+
+size_t WiFiClient::send(const uint8_t *buffer, size_t size)
+{
+    PROFILE_SCOPE("sl_Send");
+
     //
     //write the buffer to the socket
     //
-    int iRet = sl_Send(WiFiClass::_handleArray[_socketIndex], buffer, size, 0);
+    uint8_t socketIndex = _socketIndex;
+    int socketHandle = WiFiClass::socketHandle(socketIndex);
+    int iRet = sl_Send(socketHandle, buffer, size, 0);
 
-    // Flow control signal; perform a paced-retry.
-    while (iRet == SL_EAGAIN) {
-        delay(10);
-#ifndef SL_PLATFORM_MULTI_THREADED$
-        /* HACK: required in nonos builds, otherwise we hang in this loop */
-        sl_Task();
-#endif
-        iRet = sl_Send(WiFiClass::_handleArray[_socketIndex], buffer, size, 0);
+    //
+    //Flow control signal: the network processor is out of tx buffers.
+    //Rather than sleep and retry, send this one as a blocking socket; the
+    //host driver then waits for the buffer credits the network processor
+    //hands back and sends the moment they arrive
+    //
+    if (iRet == SL_EAGAIN) {
+        int option = 0;
+        WiFiClass::_countTxStall(socketIndex);
+        sl_SetSockOpt(socketHandle, SL_SOL_SOCKET, SL_SO_NONBLOCKING, &option, sizeof(option));
+        iRet = sl_Send(socketHandle, buffer, size, 0);
+        option = 1;
+        sl_SetSockOpt(socketHandle, SL_SOL_SOCKET, SL_SO_NONBLOCKING, &option, sizeof(option));
+    }
+    if (iRet > 0) {
+        WiFiClass::_countTx(socketIndex, iRet);
     }
 
     if ((iRet < 0) || (iRet != size)) {
@@ -385,53 +679,30 @@ int WiFiClient::available()
     //
     //don't do anything if not properly set up
     //
-    if (_socketIndex == NO_SOCKET_AVAIL) {
+    if (!bound()) {
         return 0;
     }
     
+    //
+    //a reply can only come once the request is out
+    //
+    sendPending();
+    if (!bound()) {
+        return 0;
+    }
+
     //
     //if the buffer doesn't have any data in it or we've read everything
-    //then receive some data
+    //then receive some data, unless an empty poll was just made: a
+    //while (!client.available()); loop would otherwise keep the link to
+    //the network processor busy with nothing but sl_Recv() commands
     //
-    int bytesLeft = rx_fillLevel - rx_currentIndex;
+    int bytesLeft = rx_buffer.available();
     if (bytesLeft <= 0) {
-        SlTimeval_t timeout;
-        memset(&timeout, 0, sizeof(SlTimeval_t));
-        timeout.tv_sec = 0;
-        timeout.tv_usec = 500;
-        SlFdSet_t readsds, errorsds;
-        SL_FD_ZERO(&readsds);
-        SL_FD_ZERO(&errorsds);
-        SL_FD_SET(WiFiClass::_handleArray[_socketIndex], &readsds);
-        SL_FD_SET(WiFiClass::_handleArray[_socketIndex], &errorsds);
-
-//        sl_Select(WiFiClass::_handleArray[_socketIndex] + 1, &readsds, NULL, &errorsds, &timeout);
-//        if(!SL_FD_ISSET(WiFiClass::_handleArray[_socketIndex], &readsds)) return 0;
-
-        //
-        //Receive any pending information into the buffer
-        //if the connection has died, call stop() to make the object aware it's dead
-        //
-        int iRet = sl_Recv(WiFiClass::_handleArray[_socketIndex], rx_buffer, TCP_RX_BUFF_MAX_SIZE, 0);
-        if ((iRet <= 0)  &&  (iRet != SL_EAGAIN)) {
-            sl_Close(WiFiClass::_handleArray[_socketIndex]);
-
-            WiFiClass::_portArray[_socketIndex] = -1;
-            WiFiClass::_handleArray[_socketIndex] = -1;
-            WiFiClass::_typeArray[_socketIndex] = -1;
-            _socketIndex = NO_SOCKET_AVAIL;
-
-            memset(rx_buffer, 0, TCP_RX_BUFF_MAX_SIZE);
+        if (millis() - rx_lastPoll < TCP_RX_POLL_MS) {
             return 0;
         }
-        
-        //
-        //receive successful. Reset rx index pointer and set buffer fill level indicator
-        //(if SL_EAGAIN was received, the actual number of bytes received was zero, not -11)
-        //
-        rx_currentIndex = 0;
-        rx_fillLevel = (iRet != SL_EAGAIN) ? iRet : 0;
-        bytesLeft = rx_fillLevel - rx_currentIndex;
+        bytesLeft = receive();
     }
     
     //
@@ -443,6 +714,176 @@ int WiFiClient::available()
     return bytesLeft;
 }
 
+//
+//sl_Recv() whatever the socket has into the empty buffer. Returns the
+//number of bytes buffered, 0 if there were none or the connection died
+//
+int WiFiClient::receive()
+{
+    uint8_t *span;
+    size_t spanLen;
+    int received;
+
+    //
+    //(the buffer is empty, so rewind it to get one contiguous span)
+    //
+    rx_buffer.reset();
+    span = rx_buffer.writeSpan(&spanLen);
+    received = receive(span, spanLen);
+    rx_buffer.commit(received);
+    return received;
+}
+
+//
+//sl_Recv() up to size bytes into buffer and return how many arrived
+//
+int WiFiClient::receive(uint8_t *buffer, size_t size)
+{
+    PROFILE_SCOPE("sl_Recv");
+
+    if (size > TCP_RX_RECV_MAX) {
+        size = TCP_RX_RECV_MAX;
+    }
+
+    //
+    //Receive any pending information into the buffer
+    //if the connection has died, call stop() to make the object aware it's dead
+    //
+    int iRet = sl_Recv(WiFiClass::socketHandle(_socketIndex), buffer, size, 0);
+    if ((iRet <= 0)  &&  (iRet != SL_EAGAIN)) {
+        sl_Close(WiFiClass::socketHandle(_socketIndex));
+
+        WiFiClass::closeSocket(_socketIndex);
+        unbind();
+
+        return 0;
+    }
+
+    //
+    //receive successful
+    //(if SL_EAGAIN was received, the actual number of bytes received was zero, not -11)
+    //
+    if (iRet == SL_EAGAIN) {
+        WiFiClass::_countRxEmpty(_socketIndex);
+        rx_lastPoll = millis();
+        return 0;
+    }
+    WiFiClass::_countRx(_socketIndex, iRet);
+    return iRet;
+}
+
+//
+//receive into buffer, size bytes (a power of 2) the sketch provides,
+//instead of the TCP_RX_BUFF_MAX_SIZE built-in one. Anything buffered is
+//dropped. NULL goes back to the built-in buffer
+//
+bool WiFiClient::setRxBuffer(uint8_t *buffer, size_t size)
+{
+    if (buffer == NULL) {
+        rx_buffer.init(rx_storage, TCP_RX_BUFF_MAX_SIZE);
+        rx_external = false;
+        return true;
+    }
+    if (size < 2 || (size & (size - 1)) != 0) {
+        return false;
+    }
+
+    rx_buffer.init(buffer, size);
+    rx_external = true;
+    return true;
+}
+
+//
+//sleep in sl_Select() until the socket has data (or closes) so the
+//Stream timed reads don't spin on available()
+//
+bool WiFiClient::waitForData(unsigned long timeout)
+{
+    return waitAvailable(timeout) > 0;
+}
+
+//
+//wait up to timeout ms for data and return the number of bytes available,
+//0 on timeout or if the connection died. The task sleeps in one
+//sl_Select() meanwhile instead of polling the network processor
+//
+int WiFiClient::waitAvailable(unsigned long timeout)
+{
+    WiFiClient *self = this;
+
+    if (waitAvailable(&self, 1, timeout) < 0) {
+        return 0;
+    }
+    return rx_buffer.available();
+}
+
+//
+//wait up to timeout ms for any of count clients (NULL entries are skipped)
+//to have data, with one sl_Select() across all their sockets. Returns the
+//index of a client with data available, or whose connection has died, or
+//-1 on timeout
+//
+int WiFiClient::waitAvailable(WiFiClient *clients[], int count,
+                              unsigned long timeout)
+{
+    SlFdSet_t readsds;
+    SlTimeval_t tv;
+    int maxHandle = -1;
+    int i;
+
+    SL_FD_ZERO(&readsds);
+    for (i = 0; i < count; i++) {
+        WiFiClient *c = clients[i];
+
+        if (c == NULL || !c->bound()) {
+            continue;
+        }
+
+        //
+        //a reply can only come once the request is out
+        //
+        c->sendPending();
+        if (!c->bound()) {
+            return i;
+        }
+        if (c->rx_buffer.available() > 0) {
+            return i;
+        }
+
+        int socketHandle = WiFiClass::socketHandle(c->_socketIndex);
+        SL_FD_SET(socketHandle, &readsds);
+        if (socketHandle > maxHandle) {
+            maxHandle = socketHandle;
+        }
+    }
+    if (maxHandle < 0) {
+        return -1;
+    }
+
+    tv.tv_sec = timeout / 1000;
+    tv.tv_usec = (timeout % 1000) * 1000;
+    if (sl_Select(maxHandle + 1, &readsds, NULL, NULL, &tv) <= 0) {
+        return -1;
+    }
+
+    //
+    //a socket closed by the peer selects as readable too; receive()
+    //finds out which it was
+    //
+    for (i = 0; i < count; i++) {
+        WiFiClient *c = clients[i];
+
+        if (c == NULL || !c->bound()) {
+            continue;
+        }
+        if (SL_FD_ISSET(WiFiClass::socketHandle(c->_socketIndex), &readsds)) {
+            c->receive();
+            return i;
+        }
+    }
+    return -1;
+}
+
 //--tested, working--//
 int WiFiClient::read()
 {
@@ -451,7 +892,7 @@ int WiFiClient::read()
     //if there are no more bytes left in the buffer. Returns 0 if nothing more
     //
     if ( available() ) {
-        return rx_buffer[rx_currentIndex++];
+        return rx_buffer.pop();
     } else {
         return -1;
     }
@@ -463,18 +904,25 @@ int WiFiClient::read(uint8_t* buf, size_t size)
     //
     // read up to the requested number of bytes into the buffer
     // uses direct buffer copies to speed things up
-    if (!available()) {
-        return 0;
+    //
+    // a read at least the size of the empty rx buffer is received straight
+    // into buf: one sl_Recv() can then bring a whole segment, or several
+    //
+    if (size >= rx_buffer.size() && rx_buffer.isEmpty()
+        && bound()) {
+        sendPending();
+        if (!bound()
+            || millis() - rx_lastPoll < TCP_RX_POLL_MS) {
+            return 0;
+        }
+        return receive(buf, size);
     }
 
-    int len = rx_fillLevel - rx_currentIndex;
-    if (len > size) {
-        len = size;
+    if (!available()) {
+        return 0;
     }
-    memcpy(buf, &rx_buffer[rx_currentIndex], len);
-    rx_currentIndex += len;
 
-    return len;
+    return rx_buffer.pop(buf, size);
 }
 
 //--tested, working--//
@@ -483,22 +931,18 @@ int WiFiClient::peek()
     //
     //return the next byte in the buffer or zero if we're past the end of the data
     //
-    if (rx_currentIndex < rx_fillLevel) {
-        return rx_buffer[rx_currentIndex];
-    } else {
-        return -1;
-    }
+    return rx_buffer.peek();
 }
 
 //--tested, working--//
 void WiFiClient::flush()
 {
     //
-    //clear out the buffer and reset all the buffer indicators
+    //send collected output, then clear out the receive buffer and
+    //reset all the buffer indicators
     //
-    memset(rx_buffer, 0, TCP_RX_BUFF_MAX_SIZE);
-    rx_fillLevel = 0;
-    rx_currentIndex = 0;
+    sendPending();
+    rx_buffer.reset();
 }
 
 //--tested, working--//
@@ -507,26 +951,33 @@ void WiFiClient::stop()
     //
     //don't do anything if not properly set up
     //
-    if (_socketIndex == NO_SOCKET_AVAIL) {
+    if (!bound()) {
         return;
     }
     
+    //
+    //send collected output first
+    //
+    sendPending();
+    if (!bound()) {
+        return;
+    }
+
     //
     //disconnect, destroy the socket, and reset the socket tracking variables
     //in WiFiClass, but don't destroy any of the received data
     //
-    int iRet = sl_Close(WiFiClass::_handleArray[_socketIndex]);
+    int iRet = sl_Close(WiFiClass::socketHandle(_socketIndex));
     if (iRet < 0) {
         return;
     }
     
     //
-    //since no error occurred while closing the socket, reset WiFiClass variables
+    //since no error occurred while closing the socket, close its entry
+    //in WiFiClass: copies of this client see it closed from now on
     //
-    WiFiClass::_portArray[_socketIndex] = -1;
-    WiFiClass::_handleArray[_socketIndex] = -1;
-    WiFiClass::_typeArray[_socketIndex] = -1;
-    _socketIndex = NO_SOCKET_AVAIL;
+    WiFiClass::closeSocket(_socketIndex);
+    unbind();
     
 }
 
@@ -551,7 +1002,7 @@ uint8_t WiFiClient::connected()
 uint8_t WiFiClient::status()
 {
     available();
-    if(_socketIndex == NO_SOCKET_AVAIL) return false;
+    if(!bound()) return false;
 
     return true;
 }
@@ -562,7 +1013,7 @@ WiFiClient::operator bool()
     //
     //a "fake" client instance with index==255 should evaluate to false
     //
-    return _socketIndex != 255;
+    return bound();
 }
 
 
@@ -23,8 +23,40 @@
 #include <IPAddress.h>
 #include <Stream.h>
 #include <Client.h>
+#include <RingBuffer.h>
+#include "utility/wl_definitions.h"
 
-#define TCP_RX_BUFF_MAX_SIZE 255
+/*
+ * size of each client's built-in rx buffer, must be a power of 2; a
+ * client can be given a larger one with setRxBuffer()
+ */
+#ifndef TCP_RX_BUFF_MAX_SIZE
+#define TCP_RX_BUFF_MAX_SIZE 256
+#endif
+
+/* largest single sl_Recv() SimpleLink accepts */
+#define TCP_RX_RECV_MAX 16000
+
+/*
+ * available() on an empty buffer asks SimpleLink for data at most once
+ * per this many ms; waitAvailable() sleeps until data arrives instead
+ */
+#ifndef TCP_RX_POLL_MS
+#define TCP_RX_POLL_MS 2
+#endif
+
+/* small writes are collected into one sl_Send() of up to this size */
+#ifndef TCP_TX_BUFF_MAX_SIZE
+#define TCP_TX_BUFF_MAX_SIZE 128
+#endif
+
+/*
+ * with setNoDelay(false), output collected this many ms ago goes out
+ * with the next write() even if the buffer isn't full
+ */
+#ifndef TCP_TX_FLUSH_MS
+#define TCP_TX_FLUSH_MS 50
+#endif
 
 //
 //Inhereting from stream (which inherits from print)
@@ -35,7 +67,9 @@ class WiFiClient : public Client {
 public:
     WiFiClient();
     WiFiClient(uint8_t sock);
+    WiFiClient(const WiFiClient &other);
     ~WiFiClient();
+    WiFiClient &operator=(const WiFiClient &other);
     
     uint8_t status();
     virtual int connect(IPAddress ip, uint16_t port);
@@ -48,6 +82,9 @@ public:
     //virtual void sslStrict(boolean);
     //virtual int32_t sslGetReasonID(void);
     //virtual const char *sslGetReason(void);
+    void sslSetMethod(int8_t method);
+    void sslSetCipherMask(uint32_t mask);
+    unsigned long sslHandshakeTime();
     virtual size_t write(uint8_t);
     virtual size_t write(const uint8_t *buffer, size_t size);
     virtual int available();
@@ -55,22 +92,50 @@ public:
     virtual int read(uint8_t* buf, size_t size);
     virtual int peek();
     virtual void flush();
+    virtual bool waitForData(unsigned long timeout);
+    int waitAvailable(unsigned long timeout);
+    static int waitAvailable(WiFiClient *clients[], int count,
+                             unsigned long timeout);
+    bool setRxBuffer(uint8_t *buffer, size_t size);
+    bool setTxBuffer(uint8_t *buffer, size_t size);
+    void setNoDelay(bool noDelay);
+    bool getNoDelay();
+    bool getStats(wlanSocketStats_t &stats);
     virtual void stop();
     virtual uint8_t connected();
     virtual operator bool();
     
     friend class WiFiServer;
+    friend class WiFiClass;
 
     boolean sslIsVerified;
     
 protected:
     int _socketIndex;
-    uint8_t rx_buffer[TCP_RX_BUFF_MAX_SIZE];
-    int rx_fillLevel;
-    int rx_currentIndex;
+    uint8_t rx_storage[TCP_RX_BUFF_MAX_SIZE];
+    RingBufferBase rx_buffer;   /* over rx_storage or setRxBuffer()'s */
+    boolean rx_external;
+    unsigned long rx_lastPoll;
+    uint8_t tx_storage[TCP_TX_BUFF_MAX_SIZE];
+    uint8_t *tx_buffer;         /* tx_storage or setTxBuffer()'s */
+    size_t tx_size;
+    size_t tx_fill;
+    unsigned long tx_since;     /* millis() of the oldest byte collected */
+    boolean tx_noDelay;
     boolean sslVerifyStrict;
     boolean hasRootCA;
     int32_t sslLastError;
+    int8_t sslSecMethod;        /* sslSetMethod()'s, WIFI_SSL_METHOD_DEFAULT if unset */
+    uint32_t sslSecMask;        /* sslSetCipherMask()'s, WIFI_SSL_MASK_DEFAULT if unset */
+    unsigned long sslHandshakeMs;
+
+private:
+    bool bound();
+    void unbind();
+    size_t send(const uint8_t *buffer, size_t size);
+    void sendPending();
+    int receive();
+    int receive(uint8_t *buffer, size_t size);
 };
 
 #endif
@@ -0,0 +1,195 @@
+/*
+ WiFiClientPool.cpp - Connection reuse for the Energia WiFi library
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <string.h>
+
+#include "WiFi.h"
+#include "WiFiClientPool.h"
+
+WiFiClientPool::WiFiClientPool()
+{
+    for (int i = 0; i < WIFI_POOL_SIZE; i++) {
+        entries[i].host[0] = '\0';
+        entries[i].port = 0;
+        entries[i].ssl = false;
+        entries[i].inUse = false;
+        entries[i].idleSince = 0;
+    }
+    idleTimeout = WIFI_POOL_IDLE_TIMEOUT;
+}
+
+WiFiClientPool::~WiFiClientPool()
+{
+    for (int i = 0; i < WIFI_POOL_SIZE; i++) {
+        entries[i].client.stop();
+    }
+}
+
+WiFiClient *WiFiClientPool::connect(const char *host, uint16_t port, bool ssl)
+{
+    Entry *entry = NULL;
+    IArg key;
+    int i;
+
+    if (strlen(host) >= WIFI_POOL_HOST_MAX) {
+        return NULL;
+    }
+
+    key = lock.lock();
+
+    //
+    //an idle connection to the same server is the one to hand out
+    //
+    for (i = 0; i < WIFI_POOL_SIZE; i++) {
+        Entry *e = &entries[i];
+        if (e->inUse || !e->client || e->port != port || e->ssl != ssl
+            || strcasecmp(e->host, host) != 0) {
+            continue;
+        }
+        if (alive(e)) {
+            e->inUse = true;
+            lock.unlock(key);
+            return &e->client;
+        }
+        e->client.stop();
+        entry = e;
+        break;
+    }
+
+    //
+    //else a free entry, else the one idle longest makes room
+    //
+    for (i = 0; entry == NULL && i < WIFI_POOL_SIZE; i++) {
+        if (!entries[i].inUse && !entries[i].client) {
+            entry = &entries[i];
+        }
+    }
+    for (i = 0; entry == NULL && i < WIFI_POOL_SIZE; i++) {
+        Entry *e = &entries[i];
+        if (!e->inUse && (entry == NULL
+            || millis() - e->idleSince > millis() - entry->idleSince)) {
+            entry = e;
+        }
+    }
+    if (entry == NULL) {
+        lock.unlock(key);
+        return NULL;
+    }
+
+    //
+    //claim it, then connect without holding up the other tasks
+    //
+    entry->inUse = true;
+    strcpy(entry->host, host);
+    entry->port = port;
+    entry->ssl = ssl;
+    lock.unlock(key);
+
+    entry->client.stop();
+    int connected = ssl ? entry->client.sslConnect(host, port)
+                        : entry->client.connect(host, port);
+    if (!connected) {
+        entry->client.stop();
+        entry->host[0] = '\0';
+        entry->inUse = false;
+        return NULL;
+    }
+
+    return &entry->client;
+}
+
+void WiFiClientPool::release(WiFiClient *client)
+{
+    MutexLock hold(lock);
+    Entry *entry = find(client);
+
+    if (entry == NULL) {
+        return;
+    }
+
+    //
+    //a reply left half read would be taken for the next one
+    //
+    if (client->available() > 0) {
+        client->stop();
+    }
+    client->flush();
+    entry->idleSince = millis();
+    entry->inUse = false;
+}
+
+void WiFiClientPool::close(WiFiClient *client)
+{
+    MutexLock hold(lock);
+    Entry *entry = find(client);
+
+    if (entry == NULL) {
+        return;
+    }
+
+    client->stop();
+    entry->host[0] = '\0';
+    entry->inUse = false;
+}
+
+void WiFiClientPool::closeIdle()
+{
+    MutexLock hold(lock);
+
+    for (int i = 0; i < WIFI_POOL_SIZE; i++) {
+        if (!entries[i].inUse) {
+            entries[i].client.stop();
+            entries[i].host[0] = '\0';
+        }
+    }
+}
+
+void WiFiClientPool::setIdleTimeout(unsigned long ms)
+{
+    idleTimeout = ms;
+}
+
+WiFiClientPool::Entry *WiFiClientPool::find(WiFiClient *client)
+{
+    for (int i = 0; i < WIFI_POOL_SIZE; i++) {
+        if (&entries[i].client == client) {
+            return &entries[i];
+        }
+    }
+
+    return NULL;
+}
+
+//
+//whether an idle connection can carry another exchange: one that idled
+//too long may have been dropped by the server without a word, and
+//anything it sent meanwhile would be misread as the next reply. The
+//available() check costs a single non-blocking sl_Recv(), which also
+//notices a connection the server closed
+//
+bool WiFiClientPool::alive(Entry *entry)
+{
+    if (millis() - entry->idleSince >= idleTimeout) {
+        return false;
+    }
+    if (entry->client.available() > 0) {
+        return false;
+    }
+
+    return (bool)entry->client;
+}
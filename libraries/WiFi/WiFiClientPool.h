@@ -0,0 +1,107 @@
+/*
+ WiFiClientPool.h - Connection reuse for the Energia WiFi library
+
+ A sketch that talks to the same few servers over and over can keep
+ its connections open between exchanges instead of paying a TCP (and
+ SSL) handshake every time:
+
+     WiFiClientPool pool;
+
+     WiFiClient *client = pool.connect("api.example.com", 443, true);
+     if (client) {
+         client->print(request);
+         ...read the whole reply...
+         pool.release(client);  // open for the next connect()
+     }
+
+ connect() hands out an idle connection to the same host, port and
+ SSL setting if there is one that is still up, else opens a new one.
+ release() puts a client back once its exchange is over; close() is
+ for one that must not be reused, e.g. after "Connection: close" or
+ a reply that wasn't read to the end.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef wificlientpool_h
+#define wificlientpool_h
+
+#include <Energia.h>
+#include "WiFiClient.h"
+#include <Mutex.h>
+
+//
+//connections a pool keeps, in use or idle; each is a socket of the
+//MAX_SOCK_NUM the device has while it is open
+//
+#ifndef WIFI_POOL_SIZE
+#define WIFI_POOL_SIZE 2
+#endif
+#define WIFI_POOL_HOST_MAX 64
+
+//
+//servers drop idle keep-alive connections after a while; one idle
+//longer than this is closed rather than reused
+//
+#define WIFI_POOL_IDLE_TIMEOUT 30000
+
+class WiFiClientPool {
+public:
+    WiFiClientPool();
+    ~WiFiClientPool();
+
+    /*
+     * A connected client for host:port, NULL if none could be opened,
+     * all are in use or host is WIFI_POOL_HOST_MAX or more characters
+     */
+    WiFiClient *connect(const char *host, uint16_t port, bool ssl = false);
+
+    /*
+     * Give a client back for reuse; it is closed instead if the
+     * server hung up or there is still unread data
+     */
+    void release(WiFiClient *client);
+
+    /*
+     * Disconnect a client and give it back
+     */
+    void close(WiFiClient *client);
+
+    /*
+     * Disconnect every idle client
+     */
+    void closeIdle();
+
+    void setIdleTimeout(unsigned long ms);
+
+private:
+    typedef struct {
+        WiFiClient client;
+        char host[WIFI_POOL_HOST_MAX];
+        uint16_t port;
+        bool ssl;
+        bool inUse;
+        unsigned long idleSince;
+    } Entry;
+
+    Entry *find(WiFiClient *client);
+    bool alive(Entry *entry);
+
+    Entry entries[WIFI_POOL_SIZE];
+    unsigned long idleTimeout;
+    Mutex lock;
+};
+
+#endif
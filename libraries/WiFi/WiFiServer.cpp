@@ -104,21 +104,26 @@ void WiFiServer::begin()
     //
     //Simplelink api calls are done, so set the object's variables
     //
+    socketIndex = WiFiClass::openSocket(socketHandle, TYPE_TCP_SERVER, _port);
+    if (socketIndex == NO_SOCKET_AVAIL) {
+        sl_Close(socketHandle);
+        return;
+    }
     _socketIndex = socketIndex;
-    WiFiClass::_handleArray[socketIndex] = socketHandle;
-    WiFiClass::_portArray[socketIndex] = _port;
-    WiFiClass::_typeArray[socketIndex] = TYPE_TCP_SERVER;
 }
 
-//--tested, working--//
-WiFiClient WiFiServer::available(byte* status)
+//
+//accept one queued connection into a free socket. Returns its socket
+//index, or NO_SOCKET_AVAIL if nothing was accepted
+//
+int WiFiServer::accept()
 {
     //
     //Get a socket number from the wificlass
     //
     int clientSocketIndex = WiFiClass::getSocket();
     if (clientSocketIndex == NO_SOCKET_AVAIL) {
-        return WiFiClient(255);
+        return NO_SOCKET_AVAIL;
     }
     
     //
@@ -130,20 +135,45 @@ WiFiClient WiFiServer::available(byte* status)
     //
     //get the client handle, if there's a queued client. If no client, return 0
     //
-    int socketHandle = WiFiClass::_handleArray[_socketIndex];
+    int socketHandle = WiFiClass::socketHandle(_socketIndex);
     int clientHandle = sl_Accept(socketHandle, (SlSockAddr_t*)&clientAddress, &clientAddressSize);
 
     //
     //We've successfully created a socket, so store everything in the wificlass
     //arrays used to keep track of the connected sockets, port #s, and types
     //
-    if (clientHandle > 0) {
-        WiFiClass::_handleArray[clientSocketIndex] = clientHandle;
-        WiFiClass::_typeArray[clientSocketIndex] = TYPE_TCP_CONNECTED_CLIENT;
-        WiFiClass::_portArray[clientSocketIndex] = sl_Htons(clientAddress.sin_port);
-        WiFiClass::_serverPortArray[clientSocketIndex] = _port;
-        WiFiClass::clients[clientSocketIndex] = WiFiClient(clientSocketIndex);
+    if (clientHandle <= 0) {
+        return NO_SOCKET_AVAIL;
+    }
+    clientSocketIndex = WiFiClass::openSocket(clientHandle,
+        TYPE_TCP_CONNECTED_CLIENT, sl_Htons(clientAddress.sin_port), _port);
+    if (clientSocketIndex == NO_SOCKET_AVAIL) {
+        sl_Close(clientHandle);
+        return NO_SOCKET_AVAIL;
+    }
+    WiFiClass::clients[clientSocketIndex] = WiFiClient(clientSocketIndex);
+    return clientSocketIndex;
+}
+
+//
+//true if socketIndex is a client connected to this server
+//
+bool WiFiServer::isClient(int socketIndex)
+{
+    wlanSocket_t *socket = &WiFiClass::_sockets[socketIndex];
+
+    return socket->handle != -1
+        && socket->type == TYPE_TCP_CONNECTED_CLIENT
+        && socket->serverPort == _port;
+}
+
+//--tested, working--//
+WiFiClient WiFiServer::available(byte* status)
+{
+    if (WiFiClass::getSocket() == NO_SOCKET_AVAIL) {
+        return WiFiClient(255);
     }
+    accept();
 
     //
     //Now loop through the connected clients
@@ -151,7 +181,7 @@ WiFiClient WiFiServer::available(byte* status)
 
     uint8_t oneclient = 0;
     for(uint8_t i = 0; i < MAX_SOCK_NUM; i++) {
-        if(WiFiClass::_handleArray[i] != -1 && WiFiClass::_typeArray[i] == TYPE_TCP_CONNECTED_CLIENT && WiFiClass::_serverPortArray[i] == _port) {
+        if(isClient(i)) {
 
             if( i == _lastServicedClient) {
                 oneclient = 1;
@@ -171,6 +201,97 @@ WiFiClient WiFiServer::available(byte* status)
     return WiFiClient(255);
 }
 
+//
+//Event driven alternative to available(): one sl_Select() waits up to
+//timeout ms on the listening socket and every client of this server at
+//once. New connections are accepted, and handler is called on each
+//client that has data, in place in WiFiClass::clients[] rather than on
+//a copy. Returns the number of clients handled.
+//
+//A client stays connected until the handler stop()s it or the peer
+//closes. Output the handler leaves collected is sent when it returns.
+//Use either serve() or available() with a server, not both.
+//
+int WiFiServer::serve(WiFiServerHandler handler, unsigned long timeout, void *arg)
+{
+    SlFdSet_t readsds;
+    SlTimeval_t tv;
+    uint32_t selected = 0;
+    int handled = 0;
+    int i;
+
+    if (_socketIndex == NO_SOCKET_AVAIL || handler == NULL) {
+        return 0;
+    }
+
+    int listenHandle = WiFiClass::socketHandle(_socketIndex);
+    int maxHandle = listenHandle;
+
+    SL_FD_ZERO(&readsds);
+    SL_FD_SET(listenHandle, &readsds);
+    for (i = 0; i < MAX_SOCK_NUM; i++) {
+        if (!isClient(i)) {
+            continue;
+        }
+
+        //
+        //data a handler left unread doesn't need to wait for the select
+        //
+        if (!WiFiClass::clients[i].rx_buffer.isEmpty()) {
+            timeout = 0;
+        }
+
+        int clientHandle = WiFiClass::socketHandle(i);
+        SL_FD_SET(clientHandle, &readsds);
+        if (clientHandle > maxHandle) {
+            maxHandle = clientHandle;
+        }
+        selected |= 1UL << i;
+    }
+
+    tv.tv_sec = timeout / 1000;
+    tv.tv_usec = (timeout % 1000) * 1000;
+    if (sl_Select(maxHandle + 1, &readsds, NULL, NULL, &tv) < 0) {
+        SL_FD_ZERO(&readsds);
+    }
+
+    //
+    //the new clients' first data is picked up by the next select
+    //
+    if (SL_FD_ISSET(listenHandle, &readsds)) {
+        while (accept() != NO_SOCKET_AVAIL) {
+        }
+    }
+
+    for (i = 0; i < MAX_SOCK_NUM; i++) {
+        if (!(selected & (1UL << i)) || !isClient(i)) {
+            continue;
+        }
+
+        WiFiClient &client = WiFiClass::clients[i];
+        if (client.rx_buffer.isEmpty()) {
+            if (!SL_FD_ISSET(WiFiClass::socketHandle(i), &readsds)) {
+                continue;
+            }
+
+            //
+            //readable with nothing to receive: the peer closed, and
+            //receive() has released the socket
+            //
+            if (client.receive() == 0) {
+                continue;
+            }
+        }
+
+        handler(client, arg);
+        handled++;
+
+        client.sendPending();
+    }
+
+    return handled;
+}
+
 uint8_t WiFiServer::status()
 {
     //
@@ -199,13 +320,18 @@ size_t WiFiServer::write(const uint8_t *buffer, size_t size)
     int i;
     int sentBytes = 0;
     for (i = 0; i < MAX_SOCK_NUM; i++) {
-        if (WiFiClass::_typeArray[i] == TYPE_TCP_CONNECTED_CLIENT) {
+        if (WiFiClass::_sockets[i].type == TYPE_TCP_CONNECTED_CLIENT
+            && WiFiClass::_sockets[i].handle != -1) {
             //
             //Write the data to the connected client and increment
             //the number of bytes send
             //
-            int handle = WiFiClass::_handleArray[i];
-            sentBytes += sl_Send(handle, buffer, size, 0);
+            int handle = WiFiClass::socketHandle(i);
+            int sent = sl_Send(handle, buffer, size, 0);
+            if (sent > 0) {
+                WiFiClass::_countTx(i, sent);
+            }
+            sentBytes += sent;
         }
     }
     return sentBytes;
@@ -28,6 +28,11 @@ extern "C" {
 
 class WiFiClient;
 
+//
+//called by serve() for each client of the server that has data to read
+//
+typedef void (*WiFiServerHandler)(WiFiClient &client, void *arg);
+
 //
 //Inhereting from Print provides all the cool print format methods
 //
@@ -36,9 +41,13 @@ private:
     uint16_t _port;
     int _socketIndex;
     int8_t _lastServicedClient;
+    int accept();
+    bool isClient(int socketIndex);
 public:
     WiFiServer(uint16_t);
     WiFiClient available(uint8_t* status = NULL);
+    int serve(WiFiServerHandler handler, unsigned long timeout,
+              void *arg = NULL);
     void begin();
     virtual size_t write(uint8_t);
     size_t write(const uint8_t *buffer, size_t size);
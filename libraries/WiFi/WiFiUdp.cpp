@@ -31,11 +31,6 @@ extern "C" {
 //--tested, working--//
 WiFiUDP::WiFiUDP()
 {
-    //
-    //fill the buffers with zeroes
-    //
-    memset(rx_buf, 0, UDP_RX_PACKET_MAX_SIZE);
-    memset(tx_buf, 0, UDP_TX_PACKET_MAX_SIZE);
     rx_currentIndex = 0;
     rx_fillLevel = 0;
     tx_fillLevel = 0;
@@ -77,14 +72,23 @@ uint8_t WiFiUDP::begin(uint16_t port)
         sl_Close(socketHandle);
         return 0;
     }
+
+    //
+    //non blocking, so a receive finds out in one command whether a
+    //datagram is waiting; parsePacket() waits in sl_Select() if not
+    //
+    int enableOption = 1;
+    sl_SetSockOpt(socketHandle, SL_SOL_SOCKET, SL_SO_NONBLOCKING, &enableOption, sizeof(enableOption));
     
     //
     //now that simplelink api calls are done, set the object's variables
     //
+    socketIndex = WiFiClass::openSocket(socketHandle, TYPE_UDP_PORT, port);
+    if (socketIndex == NO_SOCKET_AVAIL) {
+        sl_Close(socketHandle);
+        return 0;
+    }
     _socketIndex = socketIndex;
-    WiFiClass::_handleArray[socketIndex] = socketHandle;
-    WiFiClass::_portArray[socketIndex] = port;
-    WiFiClass::_typeArray[socketIndex] = TYPE_UDP_PORT;
     return 1;
 }
 
@@ -117,10 +121,8 @@ void WiFiUDP::stop()
     //close the socket and reset any important variables
     //
     flush();
-    sl_Close(WiFiClass::_handleArray[_socketIndex]);
-    WiFiClass::_handleArray[_socketIndex] = -1;
-    WiFiClass::_portArray[_socketIndex] = -1;
-    WiFiClass::_typeArray[_socketIndex] = -1;
+    sl_Close(WiFiClass::socketHandle(_socketIndex));
+    WiFiClass::closeSocket(_socketIndex);
     _socketIndex = NO_SOCKET_AVAIL;
 }
 
@@ -163,7 +165,6 @@ int WiFiUDP::beginPacket(IPAddress ip, uint16_t port)
     //
     //reset all tx buffer indicators
     //
-    memset(tx_buf, 0, UDP_TX_PACKET_MAX_SIZE);
     tx_fillLevel = 0;
     
     return 1;
@@ -180,29 +181,94 @@ int WiFiUDP::endPacket()
         return 0;
     }
 
+    //
+    //use the simplelink library to send the tx buffer
+    //
+    int iRet = sendTo(_sendIP, _sendPort, tx_buf, tx_fillLevel);
+
+    //
+    //reset all tx buffer indicators
+    //
+    tx_fillLevel = 0;
+    return iRet;
+}
+
+int WiFiUDP::sendTo(IPAddress ip, uint16_t port, const uint8_t *buffer, size_t size)
+{
+    //
+    //only do the rest of this function if a socket actually exists
+    //
+    if (_socketIndex == NO_SOCKET_AVAIL) {
+        return 0;
+    }
+
     //
     //fill in the address structure
     //
     SlSockAddrIn_t sendAddress;
     memset(&sendAddress, 0, sizeof(SlSockAddrIn_t));
     sendAddress.sin_family = SL_AF_INET;
-    sendAddress.sin_port = sl_Htons(_sendPort);
-    sendAddress.sin_addr.s_addr = _sendIP;
-    
+    sendAddress.sin_port = sl_Htons(port);
+    sendAddress.sin_addr.s_addr = (uint32_t)ip;
+
+    return sendDatagram(&sendAddress, buffer, size);
+}
+
+int WiFiUDP::sendBatch(const WiFiUDPPacket *packets, int count)
+{
+    SlSockAddrIn_t sendAddress;
+    int i;
+
+    if (_socketIndex == NO_SOCKET_AVAIL || count <= 0) {
+        return 0;
+    }
+
     //
-    //use the simplelink library to send the tx buffer
+    //the address structure is only rebuilt when the destination changes
+    //
+    memset(&sendAddress, 0, sizeof(SlSockAddrIn_t));
+    sendAddress.sin_family = SL_AF_INET;
+    for (i = 0; i < count; i++) {
+        IPAddress ip = packets[i].ip;
+
+        if (i == 0 || packets[i].port != packets[i - 1].port
+            || (uint32_t)ip != sendAddress.sin_addr.s_addr) {
+            sendAddress.sin_port = sl_Htons(packets[i].port);
+            sendAddress.sin_addr.s_addr = (uint32_t)ip;
+        }
+        if (!sendDatagram(&sendAddress, packets[i].data, packets[i].size)) {
+            break;
+        }
+    }
+    return i;
+}
+
+//
+//sl_SendTo() one datagram. Returns 1 if it was sent, 0 on error
+//
+int WiFiUDP::sendDatagram(SlSockAddrIn_t *address, const uint8_t *buffer, size_t size)
+{
+    PROFILE_SCOPE("sl_SendTo");
+    int socketHandle = WiFiClass::socketHandle(_socketIndex);
+    int iRet = sl_SendTo(socketHandle, buffer, size, 0, (SlSockAddr_t*)address, sizeof(SlSockAddrIn_t));
+
     //
-    int socketHandle = WiFiClass::_handleArray[_socketIndex];
-    int iRet = sl_SendTo(socketHandle, tx_buf, tx_fillLevel, 0, (SlSockAddr_t*)&sendAddress, sizeof(SlSockAddrIn_t));
+    //out of tx buffers on the network processor: send this one blocking,
+    //the host driver then waits for the buffer credits to come back
+    //(see WiFiClient::send())
+    //
+    if (iRet == SL_EAGAIN) {
+        int option = 0;
+        WiFiClass::_countTxStall(_socketIndex);
+        sl_SetSockOpt(socketHandle, SL_SOL_SOCKET, SL_SO_NONBLOCKING, &option, sizeof(option));
+        iRet = sl_SendTo(socketHandle, buffer, size, 0, (SlSockAddr_t*)address, sizeof(SlSockAddrIn_t));
+        option = 1;
+        sl_SetSockOpt(socketHandle, SL_SOL_SOCKET, SL_SO_NONBLOCKING, &option, sizeof(option));
+    }
     if (iRet < 0) {
         return 0;
     }
-    
-    //
-    //reset all tx buffer indicators
-    //
-    memset(tx_buf, 0, UDP_TX_PACKET_MAX_SIZE);
-    tx_fillLevel = 0;
+    WiFiClass::_countTx(_socketIndex, iRet);
     return 1;
 }
 
@@ -238,7 +304,7 @@ size_t WiFiUDP::write(const uint8_t *buffer, size_t size)
     //
     //copy the appropriate number of bytes into the buffer
     //
-    memcpy(&tx_buf[tx_fillLevel], buffer, size);
+    fastMemcpy(&tx_buf[tx_fillLevel], buffer, size);
     tx_fillLevel += size;
     return size;
 }
@@ -259,42 +325,32 @@ int WiFiUDP::parsePacket()
     }
     
     //
-    //the sl_select command blocks until something interesting happens or
-    //it times out (current timeout set for 10 ms, the minimum)
-    //
-    SlTimeval_t timeout;
-    timeout.tv_sec = 0;
-    timeout.tv_usec = 10000;
-    
-    int socketHandle = WiFiClass::_handleArray[_socketIndex];
-    
-    SlFdSet_t readSocketHandles, errorSocketHandles;
-    SL_FD_ZERO(&readSocketHandles);
-    SL_FD_ZERO(&errorSocketHandles);
-    SL_FD_SET(socketHandle, &readSocketHandles);
-    SL_FD_SET(socketHandle, &errorSocketHandles);
-    
-    int iRet = sl_Select(socketHandle+1, &readSocketHandles, NULL, &errorSocketHandles, &timeout);
-    if (iRet <= 0) {
-        return 0;
-    }
+    //take a datagram that is already waiting without a select
+    //
+    int bytes = recvFrom(rx_buf, UDP_RX_PACKET_MAX_SIZE);
+    if (bytes == SL_EAGAIN) {
+        //
+        //the sl_select command blocks until something interesting happens or
+        //it times out (current timeout set for 10 ms, the minimum)
+        //
+        SlTimeval_t timeout;
+        timeout.tv_sec = 0;
+        timeout.tv_usec = 10000;
 
-    //
-    //Since we've reached this point, the sl_select command has indicated
-    //that either we're going to get an error, or an immediate read
-    //
-    SlSockAddrIn_t  address = {0};
-    int AddrSize = sizeof(address);
-    int bytes = sl_RecvFrom(socketHandle, rx_buf, UDP_RX_PACKET_MAX_SIZE, 0, (SlSockAddr_t*)&address, (SlSocklen_t*)&AddrSize);
+        int socketHandle = WiFiClass::socketHandle(_socketIndex);
+
+        SlFdSet_t readSocketHandles;
+        SL_FD_ZERO(&readSocketHandles);
+        SL_FD_SET(socketHandle, &readSocketHandles);
+
+        int iRet = sl_Select(socketHandle+1, &readSocketHandles, NULL, NULL, &timeout);
+        if (iRet <= 0) {
+            rx_fillLevel = 0;
+            return 0;
+        }
+        bytes = recvFrom(rx_buf, UDP_RX_PACKET_MAX_SIZE);
+    }
 
-    //
-    //store the sender's address (sl_HtonX reorders bits to processor order)
-    //!! Although this follows some examples (upd_socket), it goes against the
-    //!! API documentation. The API maintains that the 5th arg to RecvFrom is not in/out
-    //
-    _remoteIP = address.sin_addr.s_addr;
-    _remotePort = sl_Htons(address.sin_port);
-    
     //
     //If an error occured, return 0, otherwise return the byte length of the packet
     //and reset the buffer index counter and fill level variables
@@ -309,6 +365,65 @@ int WiFiUDP::parsePacket()
     }
 }
 
+int WiFiUDP::receiveInto(uint8_t *buffer, size_t size)
+{
+    if (_socketIndex == NO_SOCKET_AVAIL) {
+        return 0;
+    }
+
+    int bytes = recvFrom(buffer, size);
+    return (bytes < 0) ? 0 : bytes;
+}
+
+int WiFiUDP::receiveBatch(WiFiUDPPacket *packets, int count)
+{
+    int i;
+
+    if (_socketIndex == NO_SOCKET_AVAIL) {
+        return 0;
+    }
+
+    for (i = 0; i < count; i++) {
+        int bytes = recvFrom(packets[i].data, packets[i].capacity);
+        if (bytes < 0) {
+            break;
+        }
+        packets[i].size = bytes;
+        packets[i].ip = _remoteIP;
+        packets[i].port = _remotePort;
+    }
+    return i;
+}
+
+//
+//sl_RecvFrom() one datagram and note its sender. Returns its size,
+//SL_EAGAIN if none is waiting or another negative SimpleLink error
+//
+int WiFiUDP::recvFrom(uint8_t *buffer, size_t size)
+{
+    PROFILE_SCOPE("sl_RecvFrom");
+    SlSockAddrIn_t  address = {0};
+    int AddrSize = sizeof(address);
+    int socketHandle = WiFiClass::socketHandle(_socketIndex);
+    int bytes = sl_RecvFrom(socketHandle, buffer, size, 0, (SlSockAddr_t*)&address, (SlSocklen_t*)&AddrSize);
+    if (bytes == SL_EAGAIN) {
+        WiFiClass::_countRxEmpty(_socketIndex);
+    }
+    if (bytes < 0) {
+        return bytes;
+    }
+    WiFiClass::_countRx(_socketIndex, bytes);
+
+    //
+    //store the sender's address (sl_HtonX reorders bits to processor order)
+    //!! Although this follows some examples (upd_socket), it goes against the
+    //!! API documentation. The API maintains that the 5th arg to RecvFrom is not in/out
+    //
+    _remoteIP = address.sin_addr.s_addr;
+    _remotePort = sl_Htons(address.sin_port);
+    return bytes;
+}
+
 //--tested, working--//
 int WiFiUDP::read()
 {
@@ -339,7 +454,7 @@ int WiFiUDP::read(unsigned char* buffer, size_t size)
     if (len > size) {
         len = size;
     }
-    memcpy(buffer, &rx_buf[rx_currentIndex], len);
+    fastMemcpy(buffer, &rx_buf[rx_currentIndex], len);
     rx_currentIndex += len;
 
     return len;
@@ -361,9 +476,8 @@ int WiFiUDP::peek()
 void WiFiUDP::flush()
 {
     //
-    //destroy the remaining data in the buffer and reset index and length variables
+    //drop the remaining data in the buffer by resetting index and length variables
     //
-    memset(rx_buf, 0, UDP_RX_PACKET_MAX_SIZE);
     rx_currentIndex = 0;
     rx_fillLevel = 0;
 }
@@ -389,3 +503,8 @@ uint16_t WiFiUDP::remotePort()
     return retPort;
 }
 
+bool WiFiUDP::getStats(wlanSocketStats_t &stats)
+{
+    return WiFiClass::getSocketStats(_socketIndex, stats);
+}
+
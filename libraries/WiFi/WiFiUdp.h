@@ -26,9 +26,38 @@
 //!!definitions from CC3000 library. Make sure these are right !!//
 #define MAX_SENDTO_SIZE 95
 #define MAX_RECVFROM_SIZE 95
+#define NO_SOCKET_AVAIL 255
+
+//
+//largest datagram payload that fits one 1500 byte ethernet frame
+//
+#define UDP_PACKET_MAX_SIZE 1472
+
+//
+//sizes of the staging buffers behind beginPacket()/parsePacket(); may be
+//overridden up to UDP_PACKET_MAX_SIZE. receiveInto() and sendTo() don't
+//use them and take datagrams of any size up to that
+//
+#ifndef UDP_TX_PACKET_MAX_SIZE
 #define UDP_TX_PACKET_MAX_SIZE 255
+#endif
+#ifndef UDP_RX_PACKET_MAX_SIZE
 #define UDP_RX_PACKET_MAX_SIZE 255
-#define NO_SOCKET_AVAIL 255
+#endif
+#if UDP_TX_PACKET_MAX_SIZE > UDP_PACKET_MAX_SIZE || UDP_RX_PACKET_MAX_SIZE > UDP_PACKET_MAX_SIZE
+#error "UDP buffers larger than UDP_PACKET_MAX_SIZE"
+#endif
+
+//
+//one datagram of a sendBatch() or receiveBatch()
+//
+struct WiFiUDPPacket {
+    uint8_t *data;
+    uint16_t size;      // bytes to send, or bytes received
+    uint16_t capacity;  // receiveBatch(): room at data
+    IPAddress ip;       // destination, or sender
+    uint16_t port;
+};
 
 //
 //Inhereting from stream (which inherits from print)
@@ -46,6 +75,9 @@ private:
     unsigned int tx_fillLevel;
     uint32_t _sendIP; // used by all the write/send methods
     uint16_t _sendPort; //used by all the write/send methods
+
+    int recvFrom(uint8_t *buffer, size_t size);
+    int sendDatagram(SlSockAddrIn_t *address, const uint8_t *buffer, size_t size);
     
 public:
     WiFiUDP();  // Constructor
@@ -86,11 +118,30 @@ public:
     // Return the next byte from the current packet without moving on to the next byte
     int peek();
     void flush();	// Finish reading the current packet
+    // Nothing more arrives in the current packet, so this doesn't wait
+    bool waitForData(unsigned long timeout) { return available() > 0; }
     
+    // Receive the next datagram straight into buffer, without the staging
+    // buffer or waiting; a datagram longer than size is truncated.
+    // Returns its size, or 0 if none has arrived
+    int receiveInto(uint8_t *buffer, size_t size);
+    // Send size bytes from buffer as one datagram, without the staging buffer
+    // Returns 1 if the packet was sent successfully, 0 if there was an error
+    int sendTo(IPAddress ip, uint16_t port, const uint8_t *buffer, size_t size);
+    // Send count datagrams back to back. Returns how many were sent; it
+    // stops at the first one that fails
+    int sendBatch(const WiFiUDPPacket *packets, int count);
+    // Receive up to count datagrams that have already arrived, each into
+    // its packet's data, without waiting. Returns how many were received
+    int receiveBatch(WiFiUDPPacket *packets, int count);
+
     // Return the IP address of the host who sent the current incoming packet
     IPAddress remoteIP();
     // Return the port of the host who sent the current incoming packet
     uint16_t remotePort();
+
+    // Copy this socket's traffic counters to stats, false if it isn't open
+    bool getStats(wlanSocketStats_t &stats);
 };
 
 #endif
@@ -0,0 +1,81 @@
+/*
+ Event Server
+
+ A line based server on port 23 that serves several telnet sessions at
+ once. Nothing is polled: server.serve() sleeps in one sl_Select() on
+ the listening socket and all connected sessions, and calls
+ handleClient() as soon as any of them has sent something.
+
+ Each line a session sends is answered with the time since reset and
+ the line itself. A "quit" line closes that session.
+
+ Circuit:
+ * CC3200 LaunchPad or
+   F5529/TivaC LaunchPad with CC3000/CC3100 BoosterPack
+
+ This example code is in the public domain.
+ */
+
+#ifndef __CC3200R1M1RGC__
+// Do not include SPI for CC3200 LaunchPad
+#include <SPI.h>
+#endif
+#include <WiFi.h>
+
+// your network name also called SSID
+char ssid[] = "energia";
+// your network password
+char password[] = "supersecret";
+
+WiFiServer server(23);
+
+void handleClient(WiFiClient &client, void *arg)
+{
+  char line[64];
+  int len;
+
+  // serve() only calls this when there is data, so this doesn't wait
+  len = client.readBytesUntil('\n', line, sizeof(line) - 1);
+  line[len] = '\0';
+  if (len > 0 && line[len - 1] == '\r') {
+    line[--len] = '\0';
+  }
+
+  if (strcmp(line, "quit") == 0) {
+    client.println("bye");
+    client.stop();
+    return;
+  }
+
+  client.print(millis());
+  client.print(" ms: ");
+  client.println(line);
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  Serial.print("Attempting to connect to Network named: ");
+  Serial.println(ssid);
+  WiFi.begin(ssid, password);
+  while (WiFi.status() != WL_CONNECTED) {
+    Serial.print(".");
+    delay(300);
+  }
+
+  Serial.println("\nWaiting for an ip address");
+  while (WiFi.localIP() == INADDR_NONE) {
+    Serial.print(".");
+    delay(300);
+  }
+
+  Serial.print("\nTelnet to ");
+  Serial.println(WiFi.localIP());
+
+  server.begin();
+}
+
+void loop() {
+  // handles every session with data, or returns after a second
+  server.serve(handleClient, 1000);
+}
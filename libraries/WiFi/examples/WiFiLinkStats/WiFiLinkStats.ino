@@ -0,0 +1,130 @@
+/*
+  WiFi Link Statistics
+
+ This sketch fetches a page every few seconds and prints the link
+ counters of WiFi.getStats() after each fetch: traffic and flow
+ control stalls for all sockets and for this connection, reconnects,
+ the average and worst command round trip to the network processor,
+ the SPI throughput of the host interface and the RSSI history.
+
+ A throughput collapse shows up as txStalls climbing (the network
+ processor is out of tx buffers), as the command latency going up, or
+ as the RSSI dropping.
+
+ This code is in the public domain.
+
+ Circuit:
+ * CC3200 WiFi LaunchPad or CC3100 WiFi BoosterPack
+   with TM4C or MSP430 LaunchPad
+ */
+
+#ifndef __CC3200R1M1RGC__
+// Do not include SPI for CC3200 LaunchPad
+#include <SPI.h>
+#endif
+#include <WiFi.h>
+
+// your network name also called SSID
+char ssid[] = "energia";
+// your network password
+char password[] = "launchpad";
+
+char server[] = "energia.nu";
+
+void setup() {
+  Serial.begin(115200);
+
+  Serial.print("Attempting to connect to Network named: ");
+  Serial.println(ssid);
+  WiFi.begin(ssid, password);
+  while ( WiFi.status() != WL_CONNECTED) {
+    Serial.print(".");
+    delay(300);
+  }
+  while (WiFi.localIP() == INADDR_NONE) {
+    Serial.print(".");
+    delay(300);
+  }
+  Serial.println("\nConnected");
+}
+
+void loop() {
+  WiFiClient client;
+  wlanSocketStats_t connection;
+  wlanStats_t stats;
+  bool fetched = false;
+
+  if (client.connect(server, 80)) {
+    client.println("GET /hello.html HTTP/1.1");
+    client.println("Host: energia.nu");
+    client.println("Connection: close");
+    client.println();
+
+    unsigned long start = millis();
+    while (client.connected() && millis() - start < 5000) {
+      while (client.available()) {
+        client.read();
+      }
+    }
+    fetched = client.getStats(connection);
+    client.stop();
+  }
+
+  WiFi.RSSI();
+  WiFi.getStats(stats);
+
+  if (fetched) {
+    Serial.print("this connection: tx ");
+    Serial.print(connection.txBytes);
+    Serial.print(" B, rx ");
+    Serial.print(connection.rxBytes);
+    Serial.print(" B in ");
+    Serial.print(connection.rxPackets);
+    Serial.print(" receives, ");
+    Serial.print(connection.rxEmpty);
+    Serial.println(" empty polls");
+  }
+
+  Serial.print("all sockets: tx ");
+  Serial.print(stats.sockets.txBytes);
+  Serial.print(" B in ");
+  Serial.print(stats.sockets.txPackets);
+  Serial.print(" sends, ");
+  Serial.print(stats.sockets.txStalls);
+  Serial.print(" stalls; rx ");
+  Serial.print(stats.sockets.rxBytes);
+  Serial.println(" B");
+
+  Serial.print("connects ");
+  Serial.print(stats.connects);
+  Serial.print(", disconnects ");
+  Serial.println(stats.disconnects);
+
+  if (stats.commands) {
+    Serial.print("commands ");
+    Serial.print(stats.commands);
+    Serial.print(", average ");
+    Serial.print(stats.commandUs / stats.commands);
+    Serial.print(" us, worst ");
+    Serial.print(stats.commandMaxUs);
+    Serial.println(" us");
+  }
+
+  if (stats.spiUs) {
+    Serial.print("SPI ");
+    Serial.print(stats.spiBytes);
+    Serial.print(" B at ");
+    Serial.print((float)stats.spiBytes * 1000 / stats.spiUs);
+    Serial.println(" kB/s");
+  }
+
+  Serial.print("RSSI history:");
+  for (int i = 0; i < stats.rssiCount; i++) {
+    Serial.print(" ");
+    Serial.print(stats.rssi[i]);
+  }
+  Serial.println();
+  Serial.println();
+
+  delay(5000);
+}
@@ -0,0 +1,137 @@
+/*
+  Pooled WiFi Web Client
+
+ This sketch POSTs a reading to a web server every few seconds over a
+ kept-alive connection from a WiFiClientPool, so only the first report
+ (and the first after the server drops the connection) pays for the
+ TCP handshake. It prints how long each exchange took.
+
+ The reply has to be read to its end before the connection goes back
+ to the pool; this sketch uses the Content-Length header for that.
+
+ This code is in the public domain.
+
+ Circuit:
+ * CC3200 WiFi LaunchPad or CC3100 WiFi BoosterPack
+   with TM4C or MSP430 LaunchPad
+ */
+
+#ifndef __CC3200R1M1RGC__
+// Do not include SPI for CC3200 LaunchPad
+#include <SPI.h>
+#endif
+#include <WiFi.h>
+
+// your network name also called SSID
+char ssid[] = "energia";
+// your network password
+char password[] = "launchpad";
+
+// server address:
+char server[] = "energia.nu";
+
+WiFiClientPool pool;
+
+const unsigned long postingInterval = 5L * 1000L; // delay between reports, in milliseconds
+
+void setup() {
+  //Initialize serial and wait for port to open:
+  Serial.begin(115200);
+
+  // attempt to connect to Wifi network:
+  Serial.print("Attempting to connect to Network named: ");
+  // print the network name (SSID);
+  Serial.println(ssid);
+  WiFi.begin(ssid, password);
+  while ( WiFi.status() != WL_CONNECTED) {
+    // print dots while we wait to connect
+    Serial.print(".");
+    delay(300);
+  }
+
+  Serial.println("\nYou're connected to the network");
+  Serial.println("Waiting for an ip address");
+
+  while (WiFi.localIP() == INADDR_NONE) {
+    // print dots while we wait for an ip addresss
+    Serial.print(".");
+    delay(300);
+  }
+
+  Serial.println("\nIP Address obtained");
+}
+
+void loop() {
+  unsigned long start = millis();
+  String body = "reading=" + String(analogRead(A0));
+
+  WiFiClient *client = pool.connect(server, 80);
+  if (client == NULL) {
+    Serial.println("connection failed");
+    delay(postingInterval);
+    return;
+  }
+
+  client->println("POST /post HTTP/1.1");
+  client->print("Host: ");
+  client->println(server);
+  client->println("User-Agent: Energia/1.1");
+  client->println("Connection: keep-alive");
+  client->println("Content-Type: application/x-www-form-urlencoded");
+  client->print("Content-Length: ");
+  client->println(body.length());
+  client->println();
+  client->print(body);
+
+  if (readReply(client)) {
+    pool.release(client);
+  } else {
+    pool.close(client);
+  }
+
+  Serial.print("report took ");
+  Serial.print(millis() - start);
+  Serial.println(" ms");
+
+  delay(postingInterval);
+}
+
+// read the whole reply, true if the connection can carry another one
+bool readReply(WiFiClient *client) {
+  long length = -1;
+  bool keepAlive = true;
+
+  client->setTimeout(5000);
+
+  // headers, up to the empty line
+  for (;;) {
+    String line = client->readStringUntil('\n');
+    line.trim();
+    if (line.length() == 0) {
+      break;
+    }
+    line.toLowerCase();
+    if (line.startsWith("content-length:")) {
+      length = line.substring(15).toInt();
+    }
+    if (line.startsWith("connection:") && line.indexOf("close") >= 0) {
+      keepAlive = false;
+    }
+  }
+
+  // without a length the body only ends when the server closes
+  if (length < 0) {
+    return false;
+  }
+
+  while (length > 0) {
+    uint8_t buf[64];
+    int n = client->readBytes(buf, length < (long)sizeof(buf) ? length : sizeof(buf));
+    if (n <= 0) {
+      return false;
+    }
+    length -= n;
+  }
+
+  return keepAlive;
+}
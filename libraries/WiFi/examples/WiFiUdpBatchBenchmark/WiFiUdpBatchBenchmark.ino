@@ -0,0 +1,126 @@
+/*
+ WiFi UDP Batch Benchmark
+
+ Sends 1000 telemetry datagrams of 64 bytes to a host, first one at a
+ time with beginPacket()/write()/endPacket(), then 16 at a time with
+ sendBatch(), and prints the packets per second of each. Then it
+ drains whatever the host sent back with receiveBatch().
+
+ Listen on the host with e.g.
+   nc -u -l 5000 > /dev/null
+ and set host below to its address.
+
+ Circuit:
+ * CC3200 LaunchPad or
+   F5529/TivaC LaunchPad with CC3000/CC3100 BoosterPack
+
+ This example code is in the public domain.
+ */
+
+#ifndef __CC3200R1M1RGC__
+// Do not include SPI for CC3200 LaunchPad
+#include <SPI.h>
+#endif
+#include <WiFi.h>
+
+// your network name also called SSID
+char ssid[] = "energia";
+// your network password
+char password[] = "supersecret";
+
+IPAddress host(192, 168, 1, 100);
+const uint16_t hostPort = 5000;
+
+#define PACKETS 1000
+#define PACKET_SIZE 64
+#define BATCH 16
+
+WiFiUDP Udp;
+
+uint8_t records[BATCH][PACKET_SIZE];
+WiFiUDPPacket packets[BATCH];
+
+void fill(uint8_t *record, unsigned long seq)
+{
+  memcpy(record, &seq, sizeof(seq));
+  for (int i = sizeof(seq); i < PACKET_SIZE; i++) {
+    record[i] = i;
+  }
+}
+
+void report(const char *name, unsigned long ms)
+{
+  Serial.print(name);
+  Serial.print(PACKETS * 1000UL / (ms ? ms : 1));
+  Serial.println(" packets/s");
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  Serial.print("Attempting to connect to Network named: ");
+  Serial.println(ssid);
+  WiFi.begin(ssid, password);
+  while (WiFi.status() != WL_CONNECTED) {
+    Serial.print(".");
+    delay(300);
+  }
+  while (WiFi.localIP() == INADDR_NONE) {
+    Serial.print(".");
+    delay(300);
+  }
+  Serial.println();
+
+  Udp.begin(hostPort);
+
+  for (int i = 0; i < BATCH; i++) {
+    packets[i].data = records[i];
+    packets[i].ip = host;
+    packets[i].port = hostPort;
+  }
+}
+
+void loop() {
+  unsigned long start;
+  unsigned long seq;
+
+  start = millis();
+  for (seq = 0; seq < PACKETS; seq++) {
+    fill(records[0], seq);
+    Udp.beginPacket(host, hostPort);
+    Udp.write(records[0], PACKET_SIZE);
+    Udp.endPacket();
+  }
+  report("endPacket():  ", millis() - start);
+
+  start = millis();
+  for (seq = 0; seq < PACKETS; seq += BATCH) {
+    for (int i = 0; i < BATCH; i++) {
+      fill(records[i], seq + i);
+      packets[i].size = PACKET_SIZE;
+    }
+    Udp.sendBatch(packets, BATCH);
+  }
+  report("sendBatch():  ", millis() - start);
+
+  // whatever arrived meanwhile, without waiting for more
+  int received = 0;
+  int n;
+  do {
+    for (int i = 0; i < BATCH; i++) {
+      packets[i].capacity = PACKET_SIZE;
+    }
+    n = Udp.receiveBatch(packets, BATCH);
+    received += n;
+  } while (n == BATCH);
+  Serial.print("received: ");
+  Serial.println(received);
+
+  // receiveBatch() overwrote the destinations with the senders
+  for (int i = 0; i < BATCH; i++) {
+    packets[i].ip = host;
+    packets[i].port = hostPort;
+  }
+
+  delay(5000);
+}
@@ -54,6 +54,7 @@ extern void sl_WlanEvtHdlr(SlWlanEvent_t *pSlWlanEvent)
         //
         case SL_WLAN_CONNECT_EVENT: {
             WiFiClass::WiFi_status = WL_CONNECTED;
+            WiFiClass::_stats.connects++;
             //
             //copy ssid name to WiFiClass and manually add null terminator
             //
@@ -83,6 +84,7 @@ extern void sl_WlanEvtHdlr(SlWlanEvent_t *pSlWlanEvent)
         //
         case SL_WLAN_DISCONNECT_EVENT:
             WiFiClass::WiFi_status = WL_DISCONNECTED;
+            WiFiClass::_stats.disconnects++;
             memset(WiFiClass::connected_ssid, 0, MAX_SSID_LEN);
             memset(WiFiClass::connected_bssid, 0, BSSID_LEN);
             
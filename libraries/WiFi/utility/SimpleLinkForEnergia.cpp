@@ -11,6 +11,12 @@
 #include <SPI.h>
 #include "WiFi.h"
 
+#include <xdc/runtime/Error.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/knl/Task.h>
+#include <MessageQueue.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -23,6 +29,53 @@ extern "C" {
 #define DEBUG_TRACE(info)
 #endif
 
+//
+//the CC3100 host interface runs at up to 20 MHz; SPI picks the fastest
+//rate the module clock can divide down to without exceeding it
+//
+#define CC3100_SPI_CLOCK 20000000
+
+//
+//sl_Spawn() is called from the host IRQ; the entries it queues run in
+//order in one task above every sketch, so events and asynchronous
+//messages are read as soon as the device raises them
+//
+#define SPAWN_QUEUE_SIZE 8
+#define SPAWN_STACK_SIZE 2048
+
+typedef struct {
+    void (*entry)(void *);
+    void *value;
+} SpawnEntry;
+
+static MessageQueue<SpawnEntry, SPAWN_QUEUE_SIZE> spawnQueue;
+static Task_Handle spawnTask;
+
+static void spawnTaskFxn(UArg arg0, UArg arg1)
+{
+    SpawnEntry spawn;
+
+    for (;;) {
+        spawnQueue.receive(spawn);
+        spawn.entry(spawn.value);
+    }
+}
+
+static void spawnTaskStart()
+{
+    Task_Params params;
+
+    if (spawnTask != NULL) {
+        return;
+    }
+
+    Task_Params_init(&params);
+    params.stackSize = SPAWN_STACK_SIZE;
+    params.priority = Task_numPriorities - 1;
+    params.instance->name = (xdc_String)"simplelink";
+    spawnTask = Task_create(spawnTaskFxn, &params, Error_IGNORE);
+}
+
 
 void CC3100_enable()
 {
@@ -64,6 +117,17 @@ int spi_Open(char* pIfName , unsigned long flags)
     SPI.begin();
     SPI.setBitOrder(MSBFIRST);
     SPI.setDataMode(SPI_MODE0);
+    SPI.setClock(CC3100_SPI_CLOCK);
+
+#ifdef SL_PLATFORM_MULTI_THREADED
+    //
+    //the device can't be talked to without the spawn task
+    //
+    spawnTaskStart();
+    if (spawnTask == NULL) {
+        return -1;
+    }
+#endif
     
     //
     //return a success
@@ -88,20 +152,19 @@ int spi_Close(int Fd)
 //
 //read from the SPI interface (Fd doesn't actually matter)
 //
-int spi_Read(int Fd , char* pBuff , int Len)\
+int spi_Read(int Fd , char* pBuff , int Len)
 {
-    digitalWrite(WiFiClass::pin_cs, LOW);
-    
+    unsigned long start = micros();
+
     DEBUG_TRACE("SPI_READ");
     //
-    //read bytes into the buffer by transmitting NULL over and over
+    //read the whole buffer in one CS-framed transaction, the SPI
+    //driver clocks out 0 as there is nothing to transmit
     //
-    for (int i = 0; i < Len; i++) {
-        pBuff[i] = SPI.transfer(0);
-        DEBUG_TRACE(pBuff[i]);
-    }
-    
-    digitalWrite(WiFiClass::pin_cs, HIGH);
+    SPI.transferBurst(WiFiClass::pin_cs, NULL, pBuff, Len);
+
+    WiFiClass::_stats.spiBytes += Len;
+    WiFiClass::_stats.spiUs += micros() - start;
     return Len;
 }
 
@@ -110,18 +173,17 @@ int spi_Read(int Fd , char* pBuff , int Len)\
 //
 int spi_Write(int Fd , char* pBuff , int Len)
 {
-    digitalWrite(WiFiClass::pin_cs, LOW);
-    
+    unsigned long start = micros();
+
     DEBUG_TRACE("SPI_WRITE");
     //
-    //transfer all the bytes from the buffer
+    //transfer all the bytes from the buffer in one CS-framed
+    //transaction, discarding what comes back
     //
-    for (int i = 0; i < Len; i++) {
-        SPI.transfer(pBuff[i]);
-        DEBUG_TRACE(pBuff[i]);
-    }
-    
-    digitalWrite(WiFiClass::pin_cs, HIGH);
+    SPI.transferBurst(WiFiClass::pin_cs, pBuff, NULL, Len);
+
+    WiFiClass::_stats.spiBytes += Len;
+    WiFiClass::_stats.spiUs += micros() - start;
     return Len;
 }
 
@@ -156,6 +218,94 @@ int registerInterruptHandler(void* InterruptHdl , void* pValue)
     return 0;
 }
 
+
+//
+//sync objects are binary semaphores the device's answers post (the
+//driver clears one with a pend that doesn't wait); lock objects are
+//binary semaphores too, taken while the driver is busy. A
+//Semaphore_Handle is the driver's object and timeouts are ticks
+//
+int osi_SyncObjCreate(OsiObj_t* pObj)
+{
+    Semaphore_Params params;
+
+    Semaphore_Params_init(&params);
+    params.mode = Semaphore_Mode_BINARY;
+    *pObj = Semaphore_create(0, &params, Error_IGNORE);
+
+    return *pObj == NULL ? -1 : 0;
+}
+
+int osi_LockObjCreate(OsiObj_t* pObj)
+{
+    Semaphore_Params params;
+
+    Semaphore_Params_init(&params);
+    params.mode = Semaphore_Mode_BINARY;
+    *pObj = Semaphore_create(1, &params, Error_IGNORE);
+
+    return *pObj == NULL ? -1 : 0;
+}
+
+int osi_ObjDelete(OsiObj_t* pObj)
+{
+    Semaphore_Handle sem = (Semaphore_Handle)*pObj;
+
+    Semaphore_delete(&sem);
+    *pObj = NULL;
+
+    return 0;
+}
+
+int osi_ObjPost(OsiObj_t* pObj)
+{
+    Semaphore_post((Semaphore_Handle)*pObj);
+
+    return 0;
+}
+
+int osi_ObjPend(OsiObj_t* pObj , unsigned long Timeout)
+{
+    if (Timeout == SL_OS_WAIT_FOREVER) {
+        Timeout = BIOS_WAIT_FOREVER;
+    }
+
+    return Semaphore_pend((Semaphore_Handle)*pObj, Timeout) ? 0 : -1;
+}
+
+//
+//queue pEntry for the spawn task, from a Hwi as well as a task
+//
+int osi_Spawn(void* pEntry , void* pValue , unsigned long flags)
+{
+    SpawnEntry spawn;
+
+    spawn.entry = (void (*)(void *))pEntry;
+    spawn.value = pValue;
+
+    return spawnQueue.send(spawn, BIOS_NO_WAIT) ? 0 : -1;
+}
+
+//
+//time one command round trip: from when the driver has the device to
+//itself until the response is in
+//
+unsigned long osi_CmdOpStart(void)
+{
+    return micros();
+}
+
+void osi_CmdOpEnd(unsigned long start)
+{
+    unsigned long us = micros() - start;
+
+    WiFiClass::_stats.commands++;
+    WiFiClass::_stats.commandUs += us;
+    if (us > WiFiClass::_stats.commandMaxUs) {
+        WiFiClass::_stats.commandMaxUs = us;
+    }
+}
+
 #ifdef __cplusplus
 }
 #endif /* extern "C" */
@@ -24,6 +24,25 @@ int spi_Read(int Fd , char* pBuff , int Len);
 int spi_Write(int Fd , char* pBuff , int Len);
 int registerInterruptHandler(void* InterruptHdl , void* pValue);
 
+//
+//TI-RTOS objects behind the driver's sync and lock objects and sl_Spawn
+//(see the porting_os section of user.h)
+//
+typedef void* OsiObj_t;
+
+int osi_SyncObjCreate(OsiObj_t* pObj);
+int osi_LockObjCreate(OsiObj_t* pObj);
+int osi_ObjDelete(OsiObj_t* pObj);
+int osi_ObjPost(OsiObj_t* pObj);
+int osi_ObjPend(OsiObj_t* pObj , unsigned long Timeout);
+int osi_Spawn(void* pEntry , void* pValue , unsigned long flags);
+
+//
+//command latency and host interface counters of WiFiClass::getStats()
+//
+unsigned long osi_CmdOpStart(void);
+void osi_CmdOpEnd(unsigned long start);
+
 #ifdef __cplusplus
 }
 #endif /* extern "C" */
@@ -601,9 +601,15 @@ _SlReturnVal_t _SlDrvCmdOp(
     _SlCmdExt_t   *pCmdExt)
 {
     _SlReturnVal_t RetVal;
+#ifdef sl_CmdOpStart
+    _u32 CmdStart;
+#endif
 
     
     _SlDrvObjLockWaitForever(&g_pCB->GlobalLockObj);
+#ifdef sl_CmdOpStart
+    CmdStart = sl_CmdOpStart();
+#endif
     
     g_pCB->IsCmdRespWaited = TRUE;
 
@@ -634,6 +640,10 @@ _SlReturnVal_t _SlDrvCmdOp(
     {
         _SlDrvObjUnLock(&g_pCB->GlobalLockObj);
     }
+
+#ifdef sl_CmdOpEnd
+    sl_CmdOpEnd(CmdStart);
+#endif
     
     return RetVal;
 }
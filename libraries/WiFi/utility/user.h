@@ -644,6 +644,74 @@ extern "C" {
 
 #endif
 
+/*!
+
+ Close the Doxygen group.
+ @}
+
+ */
+
+/*!
+ ******************************************************************************
+
+    \defgroup   porting_os                  Porting - Operating System
+
+    The SimpleLink driver runs in the multi threaded model on TI-RTOS:
+    callers block on semaphores until the device answers, and messages
+    the device sends on its own are read by a spawn task. Several tasks
+    may use the driver at once and nothing needs to call sl_Task().
+
+    Define SL_NONOS to build the single threaded (nonos.h) model instead.
+
+    @{
+
+ *****************************************************************************
+ */
+
+#ifndef SL_NONOS
+
+#define SL_PLATFORM_MULTI_THREADED
+
+/*!
+    \brief     the spawn task is the porting layer's, not spawn.c's, so
+               sl_Spawn() is safe to call from the host IRQ's Hwi
+*/
+#define SL_PLATFORM_EXTERNAL_SPAWN
+
+/*!
+    \brief     sync and lock objects are TI-RTOS semaphores; timeouts are
+               in Clock ticks (about 1 ms)
+*/
+#define _SlSyncObj_t                        OsiObj_t
+#define _SlLockObj_t                        OsiObj_t
+#define _SlTime_t                           unsigned long
+
+#define SL_OS_RET_CODE_OK                   (0)
+#define SL_OS_WAIT_FOREVER                  (~0UL)
+#define SL_OS_NO_WAIT                       (0)
+
+#define sl_SyncObjCreate(pSyncObj,pName)    osi_SyncObjCreate(pSyncObj)
+#define sl_SyncObjDelete(pSyncObj)          osi_ObjDelete(pSyncObj)
+#define sl_SyncObjSignal(pSyncObj)          osi_ObjPost(pSyncObj)
+#define sl_SyncObjSignalFromIRQ(pSyncObj)   osi_ObjPost(pSyncObj)
+#define sl_SyncObjWait(pSyncObj,Timeout)    osi_ObjPend(pSyncObj,Timeout)
+
+#define sl_LockObjCreate(pLockObj,pName)    osi_LockObjCreate(pLockObj)
+#define sl_LockObjDelete(pLockObj)          osi_ObjDelete(pLockObj)
+#define sl_LockObjLock(pLockObj,Timeout)    osi_ObjPend(pLockObj,Timeout)
+#define sl_LockObjUnlock(pLockObj)          osi_ObjPost(pLockObj)
+
+#define sl_Spawn(pEntry,pValue,flags)       osi_Spawn(pEntry,pValue,flags)
+
+#endif /* SL_NONOS */
+
+/*!
+    \brief     called around each command round trip _SlDrvCmdOp() makes,
+               for the latency counters of WiFiClass::getStats()
+*/
+#define sl_CmdOpStart()                     osi_CmdOpStart()
+#define sl_CmdOpEnd(Start)                  osi_CmdOpEnd(Start)
+
 /*!
 
  Close the Doxygen group.
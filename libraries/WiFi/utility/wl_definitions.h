@@ -27,6 +27,8 @@
 #ifndef WL_DEFINITIONS_H_
 #define WL_DEFINITIONS_H_
 
+#include <stdint.h>
+
 // Maximum size of a SSID
 #define WL_SSID_MAX_LENGTH 32
 // Length of passphrase. Valid lengths are 8-63.
@@ -40,7 +42,9 @@
 // Maximum size of a SSID list
 #define WL_NETWORKS_LIST_MAXNUM	10
 // Maxmium number of socket
+#ifndef MAX_SOCK_NUM
 #define	MAX_SOCK_NUM		8
+#endif
 // Default state value for Wifi state field
 #define NA_STATE -1
 //Maximum number of attempts to establish wifi connection
@@ -56,6 +60,18 @@
 #define TYPE_TCP_SERVER (2)
 #define TYPE_UDP_PORT (3)
 
+//
+//traffic counters of one socket, and of all of them together
+//
+typedef struct {
+    uint32_t txBytes;
+    uint32_t rxBytes;
+    uint32_t txPackets;     //sl_Send()/sl_SendTo() commands that went out
+    uint32_t rxPackets;     //sl_Recv()/sl_RecvFrom() commands that brought data
+    uint32_t txStalls;      //sends the device had no tx buffers for (SL_EAGAIN)
+    uint32_t rxEmpty;       //receives that found nothing waiting (SL_EAGAIN)
+} wlanSocketStats_t;
+
 typedef enum {
 		WL_NO_SHIELD = 255,
         WL_IDLE_STATUS = 0,
@@ -32,9 +32,29 @@ SECTIONS {
 
     .data : {
          *(.data*)
+         /* RAMFUNC code, see Energia.h */
+         . = ALIGN(4);
+         *(.ramfunc*)
     } > REGION_DATA AT> REGION_TEXT
     __data_end__ = __data_start__ + SIZEOF(.data);
 
+    /*
+     * Neither copied nor zeroed at startup: DMA_BUFFER and NOINIT
+     * variables, see Energia.h. They keep their contents across any
+     * reset but a power-up. .dmabuf starts on the 256 byte boundary the
+     * uDMA control table needs, so it costs no padding there.
+     */
+    .dmabuf (NOLOAD) : ALIGN(256) {
+        *(SORT_BY_ALIGNMENT(.dmabuf*))
+    } > REGION_DATA
+
+    .noinit (NOLOAD) : ALIGN(4) {
+        __noinit_start__ = .;
+        *(.noinit*)
+        . = ALIGN(4);
+        __noinit_end__ = .;
+    } > REGION_DATA
+
     /*
      * Linker command file contributions from all loaded packages:
      */
@@ -335,6 +335,229 @@ const ADC_Config ADC_config[Board_ADCCOUNT] = {
 
 const uint_least8_t ADC_count = Board_ADCCOUNT;
 
+/*
+ *  =============================== ADCBuf ===============================
+ *  The same 24 channels, triggered from Timer_A1 CCR1: Timer_A3 drives
+ *  Clock, and analogWrite() fills Timer_A0 before it maps pins onto
+ *  Timer_A1. The driver takes the whole timer. channelSetting[] is not
+ *  const: the driver configures the GPIO of entries 0..count-1 rather
+ *  than of the channels converted, AnalogStream patches them around
+ *  ADCBuf_convert(). Used by AnalogStream.
+ */
+#include <ti/drivers/ADCBuf.h>
+#include <ti/drivers/adcbuf/ADCBufMSP432.h>
+
+ADCBufMSP432_Object adcbufMSP432Objects[Board_ADCBUFCOUNT];
+
+ADCBufMSP432_Channels adcbufMSP432Channels[Board_ADCCOUNT] = {
+    {
+        .adcPin = ADCBufMSP432_P5_5_A0,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P5_4_A1,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P5_3_A2,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P5_2_A3,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P5_1_A4,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P5_0_A5,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P4_7_A6,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P4_6_A7,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P4_5_A8,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P4_4_A9,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P4_3_A10,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P4_2_A11,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P4_1_A12,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P4_0_A13,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P6_1_A14,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P6_0_A15,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P9_1_A16,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P9_0_A17,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P8_7_A18,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P8_6_A19,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P8_5_A20,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P8_4_A21,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P8_3_A22,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    },
+    {
+        .adcPin = ADCBufMSP432_P8_2_A23,
+        .refSource = ADCBufMSP432_VREFPOS_AVCC_VREFNEG_VSS,
+        .refVoltage = 3300000
+    }
+};
+
+const ADCBufMSP432_HWAttrs adcbufMSP432HWAttrs[Board_ADCBUFCOUNT] = {
+    {
+        .intPriority = ~0,
+        .channelSetting = adcbufMSP432Channels,
+        .adcTimerTriggerSource = ADCBufMSP432_TIMERA1_CAPTURECOMPARE1
+    }
+};
+
+const ADCBuf_Config ADCBuf_config[Board_ADCBUFCOUNT] = {
+    {
+        .fxnTablePtr = &ADCBufMSP432_fxnTable,
+        .object = &adcbufMSP432Objects[0],
+        .hwAttrs = &adcbufMSP432HWAttrs[0]
+    }
+};
+
+const uint_least8_t ADCBuf_count = Board_ADCBUFCOUNT;
+
+/*
+ *  =============================== Capture ===============================
+ *  The header pins on Timer_A2; Timer_A0/A1 carry the mapped PWM pins
+ *  and Timer_A3 drives Clock. The driver takes the whole timer, so
+ *  only one entry can be open at a time, and not while analogWrite()
+ *  runs one of these pins. Used by pulseIn().
+ */
+#include <ti/drivers/Capture.h>
+#include <ti/drivers/capture/CaptureMSP432.h>
+
+CaptureMSP432_Object captureMSP432Objects[Board_CAPTURECOUNT];
+
+const CaptureMSP432_HWAttrs captureMSP432HWAttrs[Board_CAPTURECOUNT] = {
+    {
+        .timerBaseAddress = TIMER_A2_BASE,
+        .clockSource = TIMER_A_CLOCKSOURCE_SMCLK,
+        .clockDivider = TIMER_A_CLOCKSOURCE_DIVIDER_1,
+        .capturePort = CaptureMSP432_P5_6_TA2,
+        .intPriority = ~0
+    },
+    {
+        .timerBaseAddress = TIMER_A2_BASE,
+        .clockSource = TIMER_A_CLOCKSOURCE_SMCLK,
+        .clockDivider = TIMER_A_CLOCKSOURCE_DIVIDER_1,
+        .capturePort = CaptureMSP432_P5_7_TA2,
+        .intPriority = ~0
+    },
+    {
+        .timerBaseAddress = TIMER_A2_BASE,
+        .clockSource = TIMER_A_CLOCKSOURCE_SMCLK,
+        .clockDivider = TIMER_A_CLOCKSOURCE_DIVIDER_1,
+        .capturePort = CaptureMSP432_P6_6_TA2,
+        .intPriority = ~0
+    },
+    {
+        .timerBaseAddress = TIMER_A2_BASE,
+        .clockSource = TIMER_A_CLOCKSOURCE_SMCLK,
+        .clockDivider = TIMER_A_CLOCKSOURCE_DIVIDER_1,
+        .capturePort = CaptureMSP432_P6_7_TA2,
+        .intPriority = ~0
+    }
+};
+
+const Capture_Config Capture_config[Board_CAPTURECOUNT] = {
+    {
+        .fxnTablePtr = &CaptureMSP432_captureFxnTable,
+        .object = &captureMSP432Objects[0],
+        .hwAttrs = &captureMSP432HWAttrs[0]
+    },
+    {
+        .fxnTablePtr = &CaptureMSP432_captureFxnTable,
+        .object = &captureMSP432Objects[1],
+        .hwAttrs = &captureMSP432HWAttrs[1]
+    },
+    {
+        .fxnTablePtr = &CaptureMSP432_captureFxnTable,
+        .object = &captureMSP432Objects[2],
+        .hwAttrs = &captureMSP432HWAttrs[2]
+    },
+    {
+        .fxnTablePtr = &CaptureMSP432_captureFxnTable,
+        .object = &captureMSP432Objects[3],
+        .hwAttrs = &captureMSP432HWAttrs[3]
+    }
+};
+
+const uint_least8_t Capture_count = Board_CAPTURECOUNT;
+
 /*
  *  =============================== DMA ===============================
  */
@@ -347,9 +570,14 @@ const uint_least8_t ADC_count = Board_ADCCOUNT;
 #elif defined(__IAR_SYSTEMS_ICC__)
 #pragma data_alignment=256
 #elif defined(__GNUC__)
-__attribute__ ((aligned (256)))
+__attribute__ ((section(".dmabuf"), aligned (256)))
 #endif
-static DMA_ControlTable dmaControlTable[8];
+/*
+ * primary (0-7) and alternate (8-15) structures; ping-pong needs both.
+ * Each is written before its channel is enabled, so .dmabuf leaves it
+ * unzeroed, and puts it at its start, without padding.
+ */
+static DMA_ControlTable dmaControlTable[16];
 
 /*
  *  ======== dmaErrorHwi ========
@@ -672,7 +900,7 @@ extern I2C_Handle I2CMSP432_open(I2C_Handle handle, I2C_Params *params);
 extern bool I2CMSP432_transfer(I2C_Handle handle, I2C_Transaction *transaction);
 
 const I2C_FxnTable myI2CMSP432_fxnTable = {
-    NULL, /* I2CMSP432_cancel, */
+    I2CMSP432_cancel,
     I2CMSP432_close,
     NULL, /* I2CMSP432_control, */
     I2CMSP432_init,
@@ -718,14 +946,80 @@ const I2C_Config I2C_config[] = {
 
 const uint_least8_t I2C_count = Board_I2CCOUNT;
 
+/*
+ *  =============================== I2CSlave ===============================
+ *  Same modules and pins as I2C_config[], in the same order, so a
+ *  TwoWire module index selects either. The own address is programmed
+ *  by TwoWire::begin(address); slaveAddress is only the power-up value.
+ */
+
+#include <ti/drivers/I2CSlave.h>
+#include <ti/drivers/i2cslave/I2CSlaveMSP432.h>
+
+extern void I2CSlaveMSP432_close(I2CSlave_Handle handle);
+extern int_fast16_t I2CSlaveMSP432_control(I2CSlave_Handle handle, uint_fast16_t cmd, void *arg);
+extern void I2CSlaveMSP432_init(I2CSlave_Handle handle);
+extern I2CSlave_Handle I2CSlaveMSP432_open(I2CSlave_Handle handle, I2CSlave_Params *params);
+extern bool I2CSlaveMSP432_read(I2CSlave_Handle handle, void *buffer, size_t size);
+extern bool I2CSlaveMSP432_write(I2CSlave_Handle handle, const void *buffer, size_t size);
+
+const I2CSlave_FxnTable myI2CSlaveMSP432_fxnTable = {
+    I2CSlaveMSP432_close,
+    NULL, /* I2CSlaveMSP432_control, */
+    I2CSlaveMSP432_init,
+    I2CSlaveMSP432_open,
+    I2CSlaveMSP432_read,
+    I2CSlaveMSP432_write
+};
+
+/* I2CSlave objects */
+I2CSlaveMSP432_Object i2cSlaveMSP432Objects[Board_I2CSLAVECOUNT];
+
+/* I2CSlave configuration structure */
+const I2CSlaveMSP432_HWAttrs i2cSlaveMSP432HWAttrs[Board_I2CSLAVECOUNT] = {
+    {
+        .baseAddr = EUSCI_B1_BASE,
+        .intNum = INT_EUSCIB1,
+        .intPriority = (~0),
+        .slaveAddress = 0x48,
+        .dataPin = I2CSLAVEMSP432_P6_4_UCB1SDA,
+        .clkPin = I2CSLAVEMSP432_P6_5_UCB1SCL
+    },
+    {
+        .baseAddr = EUSCI_B0_BASE,
+        .intNum = INT_EUSCIB0,
+        .intPriority = (~0),
+        .slaveAddress = 0x48,
+        .dataPin = I2CSLAVEMSP432_P1_6_UCB0SDA,
+        .clkPin = I2CSLAVEMSP432_P1_7_UCB0SCL
+    }
+};
+
+const I2CSlave_Config I2CSlave_config[] = {
+    {
+        .fxnTablePtr = &myI2CSlaveMSP432_fxnTable,
+        .object = &i2cSlaveMSP432Objects[0],
+        .hwAttrs = &i2cSlaveMSP432HWAttrs[0]
+    },
+    {
+        .fxnTablePtr = &myI2CSlaveMSP432_fxnTable,
+        .object = &i2cSlaveMSP432Objects[1],
+        .hwAttrs = &i2cSlaveMSP432HWAttrs[1]
+    },
+};
+
+const uint_least8_t I2CSlave_count = Board_I2CSLAVECOUNT;
+
 /*
  *  =============================== NVS ===============================
  *  Non-Volatile Storage configuration.
  */
 #include <ti/drivers/NVS.h>
 #include <ti/drivers/nvs/NVSMSP432.h>
+#include <ti/drivers/nvs/NVSSPI25X.h>
 
 NVSMSP432_Object nvsMSP432Objects[1];
+NVSSPI25X_Object nvsSPI25XObjects[1];
 
 extern uint8_t __NVS_BASE__;
 extern uint8_t __NVS_SIZE__;
@@ -737,15 +1031,38 @@ NVSMSP432_HWAttrs nvsMSP432HWAttrs[1] = {
     },
 };
 
+/* write verify buffer for the SPI flash */
+static uint8_t nvsSPI25XVerifyBuf[64];
+
+/* 25 series SPI flash on SPI 0, chip select on pin 18 (P3.0) */
+NVSSPI25X_HWAttrs nvsSPI25XHWAttrs[1] = {
+    {
+        .regionBaseOffset = 0,
+        .regionSize = 0x800000,
+        .sectorSize = 0x1000,
+        .verifyBuf = nvsSPI25XVerifyBuf,
+        .verifyBufSize = 64,
+        .spiHandle = NULL,
+        .spiIndex = 0,
+        .spiBitRate = 20000000,
+        .spiCsnGpioIndex = 18
+    },
+};
+
 const NVS_Config NVS_config[] = {
     {
         &NVSMSP432_fxnTable,
         &nvsMSP432Objects[0],
         &nvsMSP432HWAttrs[0]
     },
+    {
+        &NVSSPI25X_fxnTable,
+        &nvsSPI25XObjects[0],
+        &nvsSPI25XHWAttrs[0]
+    },
 };
 
-int NVS_count = 1;
+int NVS_count = 2;
 
 /*
  *  =============================== Power ===============================
@@ -754,9 +1071,13 @@ int NVS_count = 1;
 #include <ti/drivers/Power.h>
 #include <ti/drivers/power/PowerMSP432.h>
 
+/* tickless idle, see wiring.c */
+extern void wiringIdleInitPolicy(void);
+extern void wiringIdlePolicy(void);
+
 const PowerMSP432_ConfigV1 PowerMSP432_config = {
-    .policyInitFxn = PowerMSP432_initPolicy,
-    .policyFxn = PowerMSP432_deepSleepPolicy,
+    .policyInitFxn = wiringIdleInitPolicy,
+    .policyFxn = wiringIdlePolicy,
     .initialPerfLevel = 2,
     .enablePolicy = true,
     .enablePerf = true,
@@ -1040,6 +1361,40 @@ const SPIMSP432DMA_HWAttrsV1 spiMSP432DMAHWAttrs[Board_SPICOUNT] = {
         .stePin  = SPIMSP432DMA_P3_4_UCB2STE,
         .pinMode  = EUSCI_SPI_3PIN,
         .minDmaTransferSize = 16
+    },
+    {
+        /* shares P6.4/P6.5 with the default Wire port */
+        .baseAddr = EUSCI_B1_BASE,
+        .bitOrder = EUSCI_B_SPI_MSB_FIRST,
+        .clockSource = EUSCI_B_SPI_CLOCKSOURCE_SMCLK,
+        .defaultTxBufValue = 0,
+        .dmaIntNum = INT_DMA_INT3,
+        .intPriority = 0xC0,       /* make SPI interrupt one priority higher than default */
+        .rxDMAChannelIndex = DMA_CH3_EUSCIB1RX0,
+        .txDMAChannelIndex = DMA_CH2_EUSCIB1TX0,
+        .clkPin  = SPIMSP432DMA_P6_3_UCB1CLK,
+        .simoPin = SPIMSP432DMA_P6_4_UCB1SIMO,
+        .somiPin = SPIMSP432DMA_P6_5_UCB1SOMI,
+        .stePin  = SPIMSP432DMA_P6_2_UCB1STE,
+        .pinMode  = EUSCI_SPI_3PIN,
+        .minDmaTransferSize = 16
+    },
+    {
+        /* shares INT_DMA_INT3 with EUSCI_B1, only one can be open */
+        .baseAddr = EUSCI_B3_BASE,
+        .bitOrder = EUSCI_B_SPI_MSB_FIRST,
+        .clockSource = EUSCI_B_SPI_CLOCKSOURCE_SMCLK,
+        .defaultTxBufValue = 0,
+        .dmaIntNum = INT_DMA_INT3,
+        .intPriority = 0xC0,       /* make SPI interrupt one priority higher than default */
+        .rxDMAChannelIndex = DMA_CH7_EUSCIB3RX0,
+        .txDMAChannelIndex = DMA_CH6_EUSCIB3TX0,
+        .clkPin  = SPIMSP432DMA_P10_1_UCB3CLK,
+        .simoPin = SPIMSP432DMA_P10_2_UCB3SIMO,
+        .somiPin = SPIMSP432DMA_P10_3_UCB3SOMI,
+        .stePin  = SPIMSP432DMA_P10_0_UCB3STE,
+        .pinMode  = EUSCI_SPI_3PIN,
+        .minDmaTransferSize = 16
     }
 };
 
@@ -1054,6 +1409,16 @@ const SPI_Config SPI_config[] = {
         .object = &spiMSP432DMAObjects[1],
         .hwAttrs = &spiMSP432DMAHWAttrs[1]
     },
+    {
+        .fxnTablePtr = &mySPIMSP432DMA_fxnTable,
+        .object = &spiMSP432DMAObjects[2],
+        .hwAttrs = &spiMSP432DMAHWAttrs[2]
+    },
+    {
+        .fxnTablePtr = &mySPIMSP432DMA_fxnTable,
+        .object = &spiMSP432DMAObjects[3],
+        .hwAttrs = &spiMSP432DMAHWAttrs[3]
+    },
 };
 
 const uint_least8_t SPI_count = Board_SPICOUNT;
@@ -1171,8 +1536,30 @@ const UART_FxnTable myUARTMSP432_fxnTable = {
 
 /* UART objects */
 UARTMSP432_Object uartMSP432Objects[Board_UARTCOUNT];
-unsigned char uartMSP432RingBuffer0[128];
-unsigned char uartMSP432RingBuffer1[128];
+
+/* driver-level rx ring sizes, may be overridden on the compiler command line */
+#ifndef Board_UART0_RINGBUF_SIZE
+#define Board_UART0_RINGBUF_SIZE 128
+#endif
+#ifndef Board_UART1_RINGBUF_SIZE
+#define Board_UART1_RINGBUF_SIZE 128
+#endif
+#ifndef Board_UART2_RINGBUF_SIZE
+#define Board_UART2_RINGBUF_SIZE 128
+#endif
+#ifndef Board_UART3_RINGBUF_SIZE
+#define Board_UART3_RINGBUF_SIZE 128
+#endif
+
+/* the driver writes them before reading, no need to zero them at startup */
+__attribute__ ((section(".noinit")))
+unsigned char uartMSP432RingBuffer0[Board_UART0_RINGBUF_SIZE];
+__attribute__ ((section(".noinit")))
+unsigned char uartMSP432RingBuffer1[Board_UART1_RINGBUF_SIZE];
+__attribute__ ((section(".noinit")))
+unsigned char uartMSP432RingBuffer2[Board_UART2_RINGBUF_SIZE];
+__attribute__ ((section(".noinit")))
+unsigned char uartMSP432RingBuffer3[Board_UART3_RINGBUF_SIZE];
 
 
 /*
@@ -1224,8 +1611,11 @@ const UARTMSP432_BaudrateConfig uartMSP432Baudrates[] = {
     {4800,   32768,      6,  0, 238, 0},
 };
 
-/* UART configuration structure */
-const UARTMSP432_HWAttrsV1 uartMSP432HWAttrs[Board_UARTCOUNT] = {
+/*
+ * UART configuration structure
+ * Not const: HardwareSerial::setPins() re-targets rxPin/txPin at runtime
+ */
+UARTMSP432_HWAttrsV1 uartMSP432HWAttrs[Board_UARTCOUNT] = {
     {
         .baseAddr = EUSCI_A0_BASE,
         .intNum = INT_EUSCIA0,
@@ -1253,6 +1643,34 @@ const UARTMSP432_HWAttrsV1 uartMSP432HWAttrs[Board_UARTCOUNT] = {
         .ringBufSize = sizeof(uartMSP432RingBuffer1),
         .rxPin = UARTMSP432_P3_2_UCA2RXD,
         .txPin = UARTMSP432_P3_3_UCA2TXD
+    },
+    {
+        .baseAddr = EUSCI_A1_BASE,
+        .intNum = INT_EUSCIA1,
+        .intPriority = (0xc0),
+        .clockSource = EUSCI_A_UART_CLOCKSOURCE_SMCLK,
+        .bitOrder = EUSCI_A_UART_LSB_FIRST,
+        .numBaudrateEntries = sizeof(uartMSP432Baudrates) /
+            sizeof(UARTMSP432_BaudrateConfig),
+        .baudrateLUT = uartMSP432Baudrates,
+        .ringBufPtr  = uartMSP432RingBuffer2,
+        .ringBufSize = sizeof(uartMSP432RingBuffer2),
+        .rxPin = UARTMSP432_P7_2_UCA1RXD,   /* pin 64, P2.2 is BLUE_LED */
+        .txPin = UARTMSP432_P7_3_UCA1TXD    /* pin 47 */
+    },
+    {
+        .baseAddr = EUSCI_A3_BASE,
+        .intNum = INT_EUSCIA3,
+        .intPriority = (0xc0),
+        .clockSource = EUSCI_A_UART_CLOCKSOURCE_SMCLK,
+        .bitOrder = EUSCI_A_UART_LSB_FIRST,
+        .numBaudrateEntries = sizeof(uartMSP432Baudrates) /
+            sizeof(UARTMSP432_BaudrateConfig),
+        .baudrateLUT = uartMSP432Baudrates,
+        .ringBufPtr  = uartMSP432RingBuffer3,
+        .ringBufSize = sizeof(uartMSP432RingBuffer3),
+        .rxPin = UARTMSP432_P9_6_UCA3RXD,
+        .txPin = UARTMSP432_P9_7_UCA3TXD
     }
 };
 
@@ -1267,6 +1685,16 @@ const UART_Config UART_config[] = {
         .object = &uartMSP432Objects[1],
         .hwAttrs = &uartMSP432HWAttrs[1]
     },
+    {
+        .fxnTablePtr = &myUARTMSP432_fxnTable,
+        .object = &uartMSP432Objects[2],
+        .hwAttrs = &uartMSP432HWAttrs[2]
+    },
+    {
+        .fxnTablePtr = &myUARTMSP432_fxnTable,
+        .object = &uartMSP432Objects[3],
+        .hwAttrs = &uartMSP432HWAttrs[3]
+    },
 };
 
 const uint_least8_t UART_count = Board_UARTCOUNT;
@@ -1312,12 +1740,22 @@ void Board_initWatchdog(void)
     Watchdog_init();
 }
 
+/*
+ *  =============================== Board ===============================
+ */
+
+extern void bootTraceMark(const char *name);
+
 /*
  *  ======== Board_init ========
+ *  Only what every sketch needs; the other drivers are initialized by
+ *  the wiring APIs on first use (analogWrite(), Serial.begin(), ...).
  */
 void Board_init(void) {
+    bootTraceMark("reset");
     Board_initGPIO();
-    Board_initPWM();
+    bootTraceMark("GPIO");
     Board_initPower();
+    bootTraceMark("Power");
 }
 
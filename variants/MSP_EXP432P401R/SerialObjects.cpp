@@ -32,33 +32,13 @@
 
 #include <ti/runtime/wiring/HardwareSerial.h>
 
-#include <ti/drivers/UART.h>
-
-void uartReadCallback(UART_Handle uart, void *buf, size_t count)
-{
-    Serial.readCallback(uart, buf, count);
-}
-
-void uartReadCallback1(UART_Handle uart, void *buf, size_t count)
-{
-    Serial1.readCallback(uart, buf, count);
-}
-
-void uartWriteCallback(UART_Handle uart, void *buf, size_t count)
-{
-    Serial.writeCallback(uart, buf, count);
-}
-
-void uartWriteCallback1(UART_Handle uart, void *buf, size_t count)
-{
-    Serial1.writeCallback(uart, buf, count);
-}
-
 /*
  * Pre-Initialize Serial instances
+ *
+ * UART driver callbacks are dispatched to these objects by
+ * HardwareSerial's shared callbacks, indexed by UART_config[] entry.
  */
-HardwareSerial Serial(0, uartReadCallback, uartWriteCallback);
-HardwareSerial Serial1(1, uartReadCallback1, uartWriteCallback1);
-
-
-
+HardwareSerial Serial(0);   /* EUSCI_A0 */
+HardwareSerial Serial1(1);  /* EUSCI_A2 */
+HardwareSerial Serial2(2);  /* EUSCI_A1, RX pin 64 (P7.2), TX pin 47 (P7.3) */
+HardwareSerial Serial3(3);  /* EUSCI_A3, RX P9.6, TX P9.7 */
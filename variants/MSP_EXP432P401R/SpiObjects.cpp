@@ -34,6 +34,11 @@
 
 /*
  * Pre-Initialize SPI instances
+ *
+ * Driver completion callbacks are dispatched to these objects by
+ * SPIClass, indexed by SPI_config[] entry.
  */
-SPIClass SPI(0);
-SPIClass SPI1(1);
+SPIClass SPI(0);   /* EUSCI_B0 */
+SPIClass SPI1(1);  /* EUSCI_B2 */
+SPIClass SPI2(2);  /* EUSCI_B1 */
+SPIClass SPI3(3);  /* EUSCI_B3 */
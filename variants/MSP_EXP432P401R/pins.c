@@ -231,103 +231,3 @@ uint8_t digital_pin_to_pwm_index[] = {
     PWM_NOT_MAPPABLE,       /*  78 - P1.0 LED1 */
 };
 
-/*
- * mapping of pins to an ADC channel
- */
-const uint8_t digital_pin_to_adc_index[] = {
-    /* port_pin */
-    NOT_ON_ADC,     /*  dummy */
-
-    /* pins 1-10 */
-    NOT_ON_ADC,     /*  1  - 3.3V */
-    15,             /*  2  - P6.0_A15 */
-    NOT_ON_ADC,     /*  3  - P3.2_URXD */
-    NOT_ON_ADC,     /*  4  - P3.3_UTXD */
-    12,             /*  5  - P4.1_IO_A12 */
-    10,             /*  6  - P4.3_A10 */
-    NOT_ON_ADC,     /*  7  - P1.5_SPICLK */
-    7,              /*  8  - P4.6_IO_A7 */
-    NOT_ON_ADC,     /*  9  - P6.5_I2CSCL */
-    NOT_ON_ADC,     /*  10 - P6.4_I2CSDA */
-
-    /* pins 11-20 */
-    NOT_ON_ADC,     /*  11 - P3.6_IO */
-    3,              /*  12 - P5.2_IO */
-    5,              /*  13 - P5.0_IO */
-    NOT_ON_ADC,     /*  14 - P1.7_SPIMISO */
-    NOT_ON_ADC,     /*  15 - P1.6_SPIMOSI */
-    NOT_ON_ADC,     /*  16 - RESET */
-    NOT_ON_ADC,     /*  17 - P5.7_IO */
-    NOT_ON_ADC,     /*  18 - P3.0_IO */
-    NOT_ON_ADC,     /*  19 - P2.5_IO_PWM */
-    NOT_ON_ADC,     /*  20 - GND */
-
-    /* pins 21-30 */
-    NOT_ON_ADC,     /*  21 - 5V */
-    NOT_ON_ADC,     /*  22 - GND */
-    14,             /*  23 - P6.1_A14 */
-    13,             /*  24 - P4.0_A13 */
-    11,             /*  25 - P4.2_A11 */
-    9,              /*  26 - P4.4_A9 */
-    8,              /*  27 - P4.5_A8 */
-    6,              /*  28 - P4.7_A6 */
-    1,              /*  29 - P5.4_IO */
-    0,              /*  30 - P5.5_IO */
-
-    /* pins 31-40 */
-    NOT_ON_ADC,     /*  31 - P3.7_IO */
-    NOT_ON_ADC,     /*  32 - P3.5_IO */
-    4,              /*  33 - P5.1_IO */
-    NOT_ON_ADC,     /*  34 - P2.3_IO */
-    NOT_ON_ADC,     /*  35 - P6.7_IO_CAPT */
-    NOT_ON_ADC,     /*  36 - P6.6_IO_CAPT */
-    NOT_ON_ADC,     /*  37 - P5.6_PWM */
-    NOT_ON_ADC,     /*  38 - P2.4_PWM */
-    NOT_ON_ADC,     /*  39 - P2.6_PWM */
-    NOT_ON_ADC,     /*  40 - P2.7_PWM */
-
-    /* pins 41-56 */
-    20,             /*  41 - P8.5 */
-    17,             /*  42 - P9.0 */
-    21,             /*  43 - P8.4 */
-    23,             /*  44 - P8.2 */
-    NOT_ON_ADC,     /*  45 - P9.2 */
-    NOT_ON_ADC,     /*  46 - P6.2 */
-    NOT_ON_ADC,     /*  47 - P7.3 */
-    NOT_ON_ADC,     /*  48 - P7.1 */
-    NOT_ON_ADC,     /*  49 - P9.4 */
-    NOT_ON_ADC,     /*  40 - P9.6 */
-    NOT_ON_ADC,     /*  51 - P8.0 */
-    NOT_ON_ADC,     /*  52 - P7.4 */
-    NOT_ON_ADC,     /*  53 - P7.6 */
-    NOT_ON_ADC,     /*  54 - P10.0 */
-    NOT_ON_ADC,     /*  55 - P10_2 */
-    NOT_ON_ADC,     /*  56 - P10.4 */
-
-    /* pins 57-72 */
-    19,             /*  57 - P8.6 */
-    18,             /*  58 - P8.7 */
-    16,             /*  59 - P9.1 */
-    22,             /*  60 - P8.3 */
-    2,              /*  61 - P5.3 */
-    NOT_ON_ADC,     /*  62 - P9.3 */
-    NOT_ON_ADC,     /*  63 - P6.3 */
-    NOT_ON_ADC,     /*  64 - P7.2 */
-    NOT_ON_ADC,     /*  65 - P7.0 */
-    NOT_ON_ADC,     /*  66 - P9.5 */
-    NOT_ON_ADC,     /*  67 - P9.7 */
-    NOT_ON_ADC,     /*  68 - P7.5 */
-    NOT_ON_ADC,     /*  69 - P7.7 */
-    NOT_ON_ADC,     /*  70 - P10.1 */
-    NOT_ON_ADC,     /*  71 - P10.3 */
-    NOT_ON_ADC,     /*  72 - P10.5 */
-
-    /* virtual pins 73-78 */
-    NOT_ON_ADC,     /*  73 - P1.1 SW1 */
-    NOT_ON_ADC,     /*  73 - P1.4 SW2 */
-    NOT_ON_ADC,     /*  75 - P2.0 RED_LED */
-    NOT_ON_ADC,     /*  76 - P2.1 GREEN_LED */
-    NOT_ON_ADC,     /*  77 - P2.2 BLUE_LED */
-    NOT_ON_ADC,     /*  78 - P1.0 LED1 */
-};
-